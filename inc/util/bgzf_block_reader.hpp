@@ -0,0 +1,301 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UTIL_BGZF_BLOCK_READER_HPP
+#define UTIL_BGZF_BLOCK_READER_HPP
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <zlib.h>
+
+#include "util/block_reader.hpp"
+#include "util/trace.hpp"
+#include "util/gzip_block_reader.hpp"
+
+namespace ebi
+{
+  namespace util
+  {
+    size_t const bgzf_header_size = 18;
+    /// a BGZF block never holds more text than this, see the SAM specification
+    size_t const bgzf_max_uncompressed_size = 65536;
+
+    /**
+     * Size of a whole BGZF block, from the BSIZE subfield of its gzip header
+     * @throw std::runtime_error if the header is not a BGZF one
+     */
+    inline size_t bgzf_block_size(Block const & header)
+    {
+        size_t const extra_length_offset = 10, block_size_offset = 16;
+
+        // the BC subfield must be the only one, as written by bgzip
+        if (header.size < bgzf_header_size || not is_bgzf(header) || header.data[extra_length_offset] != 6
+                || header.data[extra_length_offset + 1] != 0) {
+            throw std::runtime_error{"Couldn't decompress the BGZF input: invalid block header"};
+        }
+        return static_cast<unsigned char>(header.data[block_size_offset])
+               + (static_cast<unsigned char>(header.data[block_size_offset + 1]) << 8)
+               + 1;
+    }
+
+    inline uint32_t read_uint32(char const * bytes)
+    {
+        auto b = reinterpret_cast<unsigned char const *>(bytes);
+        return b[0] | (b[1] << 8) | (b[2] << 16) | (static_cast<uint32_t>(b[3]) << 24);
+    }
+
+    /**
+     * Inflates a whole BGZF block into `uncompressed`, checking its size and CRC
+     * @return the reason why it couldn't be inflated, or an empty string
+     */
+    inline std::string inflate_bgzf_block(char const * compressed, size_t size, std::vector<char> & uncompressed)
+    {
+        size_t const footer_size = 8;
+        if (size < bgzf_header_size + footer_size) {
+            return "invalid block size";
+        }
+
+        char const * footer = compressed + size - footer_size;
+        uint32_t expected_crc = read_uint32(footer);
+        uint32_t uncompressed_size = read_uint32(footer + 4);
+        if (uncompressed_size > bgzf_max_uncompressed_size) {
+            return "corrupted block";
+        }
+        // one extra byte allows inflate to make progress on empty blocks, and detects longer contents
+        uncompressed.resize(uncompressed_size + 1);
+
+        z_stream stream{};
+        stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(compressed + bgzf_header_size));
+        stream.avail_in = static_cast<uInt>(size - bgzf_header_size - footer_size);
+        stream.next_out = reinterpret_cast<Bytef *>(uncompressed.data());
+        stream.avail_out = uncompressed_size + 1;
+
+        // negative window bits: raw deflate data, the gzip header and footer were already parsed
+        if (inflateInit2(&stream, -MAX_WBITS) != Z_OK) {
+            return "couldn't initialize the decompression";
+        }
+        int status = inflate(&stream, Z_FINISH);
+        inflateEnd(&stream);
+
+        uncompressed.resize(uncompressed_size);
+        if (status != Z_STREAM_END || stream.total_out != uncompressed_size) {
+            return "corrupted block";
+        }
+        if (crc32(0, reinterpret_cast<Bytef const *>(uncompressed.data()), uncompressed_size) != expected_crc) {
+            return "checksum mismatch";
+        }
+        return "";
+    }
+
+    /**
+     * Decompresses a BGZF input using several threads.
+     *
+     * BGZF blocks are independent gzip members, so they can be inflated in any order. This reader splits the
+     * compressed input into blocks, lets a pool of workers inflate them, and returns them in the original order.
+     * The number of blocks in flight is bounded, so memory usage does not depend on the size of the input.
+     */
+    class BgzfBlockReader : public BlockReader
+    {
+      public:
+        BgzfBlockReader(BlockReader & compressed, size_t threads)
+        : compressed(compressed), remaining{nullptr, 0}, next_offset(0), max_in_flight(4 * std::max(threads, size_t{1})),
+          stop(false)
+        {
+            for (size_t i = 0; i < std::max(threads, size_t{1}); ++i) {
+                workers.emplace_back(&BgzfBlockReader::inflate_blocks, this);
+            }
+        }
+
+        ~BgzfBlockReader()
+        {
+            {
+                std::lock_guard<std::mutex> lock{mutex};
+                stop = true;
+            }
+            work_available.notify_all();
+            for (auto & worker : workers) {
+                worker.join();
+            }
+        }
+
+        BgzfBlockReader(BgzfBlockReader const &) = delete;
+        BgzfBlockReader & operator=(BgzfBlockReader const &) = delete;
+
+        /**
+         * Offset in the compressed input of the block last returned, like in the virtual offsets of an index
+         */
+        uint64_t block_offset() const
+        {
+            return current->offset;
+        }
+
+        /**
+         * Offset in the compressed input of the block after the last one returned
+         */
+        uint64_t next_block_offset() const
+        {
+            return current->offset + current->compressed_size;
+        }
+
+      protected:
+        bool next_block(Block & block) override
+        {
+            // the BGZF end-of-file marker, and any other empty block, is skipped
+            do {
+                // keep the workers busy while the parser consumes the oldest block
+                while (in_flight.size() < max_in_flight) {
+                    std::shared_ptr<Job> job = read_compressed_block();
+                    if (not job) {
+                        break;
+                    }
+                    std::lock_guard<std::mutex> lock{mutex};
+                    in_flight.push_back(job);
+                    pending_jobs.push_back(job);
+                    Trace::counter("BGZF blocks in flight", static_cast<int64_t>(in_flight.size()));
+                    work_available.notify_one();
+                }
+
+                if (in_flight.empty()) {
+                    return false;
+                }
+
+                {
+                    std::unique_lock<std::mutex> lock{mutex};
+                    work_done.wait(lock, [this] { return in_flight.front()->done; });
+                    current = in_flight.front();
+                    in_flight.pop_front();
+                }
+
+                if (not current->error.empty()) {
+                    throw std::runtime_error{"Couldn't decompress the BGZF input: " + current->error};
+                }
+            } while (current->uncompressed.empty());
+
+            block = Block{current->uncompressed.data(), current->uncompressed.size()};
+            return true;
+        }
+
+      private:
+        struct Job
+        {
+            Job() : offset(0), compressed_size(0), done(false) {}
+
+            uint64_t offset;
+            size_t compressed_size;
+            std::vector<char> compressed;
+            std::vector<char> uncompressed;
+            std::string error;
+            bool done;
+        };
+
+        /**
+         * Reads a whole BGZF block
+         */
+        std::shared_ptr<Job> read_compressed_block()
+        {
+            std::shared_ptr<Job> job = std::make_shared<Job>();
+
+            if (not read_bytes(bgzf_header_size, job->compressed)) {
+                return nullptr;
+            }
+            size_t total_size = bgzf_block_size(Block{job->compressed.data(), job->compressed.size()});
+            if (not read_bytes(total_size - bgzf_header_size, job->compressed)) {
+                throw std::runtime_error{"Couldn't decompress the BGZF input: the input is truncated"};
+            }
+            job->offset = next_offset;
+            job->compressed_size = total_size;
+            next_offset += total_size;
+            return job;
+        }
+
+        /**
+         * Appends the next `size` bytes of the compressed input to `bytes`
+         * @return false if there was not enough input
+         */
+        bool read_bytes(size_t size, std::vector<char> & bytes)
+        {
+            while (size != 0) {
+                if (remaining.size == 0 && not compressed.read(remaining)) {
+                    return false;
+                }
+                size_t copied = std::min(size, remaining.size);
+                bytes.insert(bytes.end(), remaining.data, remaining.data + copied);
+                remaining = Block{remaining.data + copied, remaining.size - copied};
+                size -= copied;
+            }
+            return true;
+        }
+
+        void inflate_blocks()
+        {
+            Trace::name_thread("inflate");
+            while (true) {
+                std::shared_ptr<Job> job;
+                {
+                    std::unique_lock<std::mutex> lock{mutex};
+                    work_available.wait(lock, [this] { return stop || not pending_jobs.empty(); });
+                    if (stop) {
+                        return;
+                    }
+                    job = pending_jobs.front();
+                    pending_jobs.pop_front();
+                }
+
+                inflate_block(*job);
+
+                {
+                    std::lock_guard<std::mutex> lock{mutex};
+                    job->done = true;
+                }
+                work_done.notify_all();
+            }
+        }
+
+        static void inflate_block(Job & job)
+        {
+            TraceSpan span{"decompression", "inflate", "bytes", static_cast<int64_t>(job.compressed.size())};
+            job.error = inflate_bgzf_block(job.compressed.data(), job.compressed.size(), job.uncompressed);
+            std::vector<char>().swap(job.compressed);
+        }
+
+        BlockReader & compressed;
+        Block remaining;                            // unused part of the last block read from `compressed`
+        uint64_t next_offset;                       // of the next block read from `compressed`
+        size_t max_in_flight;
+
+        std::deque<std::shared_ptr<Job>> in_flight; // in input order, only accessed by the reading thread
+        std::shared_ptr<Job> current;               // owns the memory of the last block returned
+
+        std::mutex mutex;
+        std::condition_variable work_available;
+        std::condition_variable work_done;
+        std::deque<std::shared_ptr<Job>> pending_jobs;
+        bool stop;
+        std::vector<std::thread> workers;
+    };
+  }
+}
+
+#endif // UTIL_BGZF_BLOCK_READER_HPP
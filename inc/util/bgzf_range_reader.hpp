@@ -0,0 +1,133 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UTIL_BGZF_RANGE_READER_HPP
+#define UTIL_BGZF_RANGE_READER_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "util/bgzf_block_reader.hpp"
+#include "util/block_reader.hpp"
+#include "util/trace.hpp"
+
+namespace ebi
+{
+  namespace util
+  {
+    /**
+     * Offset in a BGZF file: the offset of a block in the compressed file in the upper 48 bits, and the offset in
+     * the uncompressed block in the lower 16 bits. See section 4.1.1 of the SAM/BAM specification.
+     */
+    using VirtualOffset = uint64_t;
+
+    /**
+     * Decompresses some ranges of a BGZF file held in memory, seeking straight to the blocks of each one.
+     *
+     * The ranges are [begin, end) pairs of virtual offsets, like the chunks of a tabix or CSI index. They are read
+     * in the order given, so they should be sorted and not overlap to get each byte once.
+     */
+    class BgzfRangeReader : public BlockReader
+    {
+      public:
+        BgzfRangeReader(Block compressed, std::vector<std::pair<VirtualOffset, VirtualOffset>> ranges)
+        : compressed(compressed), ranges(std::move(ranges)), next_range{0}, block_offset{0}, current_block{0},
+          started{false}
+        {
+        }
+
+        /**
+         * Virtual offset of a position in the last block read
+         */
+        VirtualOffset offset_of(char const * position) const
+        {
+            size_t in_block = static_cast<size_t>(position - uncompressed.data());
+
+            // the end of a full block doesn't fit in 16 bits, but it is also the beginning of the next one
+            if (in_block == uncompressed.size()) {
+                return block_offset << 16;
+            }
+            return (current_block << 16) | in_block;
+        }
+
+      protected:
+        bool next_block(Block & block) override
+        {
+            while (next_range < ranges.size()) {
+                VirtualOffset begin = ranges[next_range].first;
+                VirtualOffset end = ranges[next_range].second;
+                if (not started) {
+                    block_offset = begin >> 16;
+                    started = true;
+                }
+
+                // the end may point to the start of the block after the last one with data of the range
+                if (block_offset > (end >> 16) || (block_offset == (end >> 16) && (end & 0xffff) == 0)
+                        || block_offset >= compressed.size) {
+                    ++next_range;
+                    started = false;
+                    continue;
+                }
+
+                uint64_t offset = block_offset;
+                inflate_block_at(offset);
+                size_t from = offset == (begin >> 16) ? begin & 0xffff : 0;
+                size_t to = offset == (end >> 16) ? std::min<size_t>(end & 0xffff, uncompressed.size())
+                                                  : uncompressed.size();
+                if (from < to) {
+                    block = Block{uncompressed.data() + from, to - from};
+                    return true;
+                }
+            }
+            return false;
+        }
+
+      private:
+        /**
+         * Inflates the block at `offset` of the compressed file, and moves `block_offset` to the next one
+         */
+        void inflate_block_at(uint64_t offset)
+        {
+            TraceSpan span{"decompression", "inflate", "offset", static_cast<int64_t>(offset)};
+            Block header{compressed.data + offset, std::min<size_t>(bgzf_header_size, compressed.size - offset)};
+            size_t size = bgzf_block_size(header);
+            if (size > compressed.size - offset) {
+                throw std::runtime_error{"Couldn't decompress the BGZF input: the input is truncated"};
+            }
+            std::string error = inflate_bgzf_block(compressed.data + offset, size, uncompressed);
+            if (not error.empty()) {
+                throw std::runtime_error{"Couldn't decompress the BGZF input: " + error};
+            }
+            current_block = offset;
+            block_offset = offset + size;
+        }
+
+        Block compressed;
+        std::vector<std::pair<VirtualOffset, VirtualOffset>> ranges;
+        size_t next_range;
+        uint64_t block_offset;      // in the compressed file, of the next block to inflate
+        uint64_t current_block;     // in the compressed file, of the block in `uncompressed`
+        bool started;               // whether block_offset is within the range `next_range`
+        std::vector<char> uncompressed;
+    };
+  }
+}
+
+#endif // UTIL_BGZF_RANGE_READER_HPP
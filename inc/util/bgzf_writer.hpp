@@ -0,0 +1,315 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UTIL_BGZF_WRITER_HPP
+#define UTIL_BGZF_WRITER_HPP
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <zlib.h>
+
+#include "util/bgzf_block_reader.hpp"
+
+namespace ebi
+{
+  namespace util
+  {
+    /**
+     * Bytes of text in each BGZF block written by bgzip, small enough for the block to fit in 64 KB even if the
+     * text can't be compressed
+     */
+    size_t const bgzf_max_block_text = 0xff00;
+
+    /**
+     * Empty block that marks the end of a BGZF file
+     */
+    char const bgzf_eof_marker[] = "\x1f\x8b\x08\x04\0\0\0\0\0\xff\x06\0\x42\x43\x02\0\x1b\0\x03\0\0\0\0\0\0\0\0\0";
+    size_t const bgzf_eof_marker_size = sizeof(bgzf_eof_marker) - 1;
+
+    inline void write_uint32(uint32_t value, char * bytes)
+    {
+        for (size_t i = 0; i < 4; ++i) {
+            bytes[i] = static_cast<char>((value >> (8 * i)) & 0xff);
+        }
+    }
+
+    /**
+     * Deflates `text` into a whole BGZF block, with the same header and zlib parameters as bgzip
+     * @return the reason why it couldn't be deflated, or an empty string
+     */
+    inline std::string deflate_bgzf_block(char const * text, size_t size, int level, std::vector<char> & compressed)
+    {
+        size_t const footer_size = 8;
+        if (size > bgzf_max_block_text) {
+            return "too much text for a block";
+        }
+
+        z_stream stream{};
+        // negative window bits: raw deflate data, the gzip header and footer are written here
+        if (deflateInit2(&stream, level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+            return "couldn't initialize the compression";
+        }
+        compressed.resize(bgzf_header_size + deflateBound(&stream, size) + footer_size);
+        stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(text));
+        stream.avail_in = static_cast<uInt>(size);
+        stream.next_out = reinterpret_cast<Bytef *>(compressed.data() + bgzf_header_size);
+        stream.avail_out = static_cast<uInt>(compressed.size() - bgzf_header_size - footer_size);
+        int status = deflate(&stream, Z_FINISH);
+        deflateEnd(&stream);
+        if (status != Z_STREAM_END) {
+            return "couldn't compress a block";
+        }
+
+        size_t block_size = bgzf_header_size + stream.total_out + footer_size;
+        compressed.resize(block_size);
+        std::memcpy(compressed.data(), bgzf_eof_marker, bgzf_header_size);
+        compressed[16] = static_cast<char>((block_size - 1) & 0xff);
+        compressed[17] = static_cast<char>((block_size - 1) >> 8);
+        write_uint32(crc32(0, reinterpret_cast<Bytef const *>(text), static_cast<uInt>(size)),
+                     compressed.data() + block_size - footer_size);
+        write_uint32(static_cast<uint32_t>(size), compressed.data() + block_size - 4);
+        return "";
+    }
+
+    /**
+     * Stream buffer that compresses what is written through it as BGZF, using several threads.
+     *
+     * The text is cut in blocks of the same size as bgzip does, and each block is deflated with the same
+     * parameters, so the output is byte-identical to that of bgzip (built with zlib) at the same level, however
+     * many threads are used. The blocks are deflated by a pool of workers and written in order; the number of
+     * blocks in flight is bounded, so memory usage does not depend on the size of the output.
+     *
+     * Flushing the stream doesn't cut a block, so that the output doesn't depend on when it's done. The last
+     * block and the end-of-file marker are only written by close.
+     */
+    class BgzfStreamBuffer : public std::streambuf
+    {
+      public:
+        /**
+         * @param threads that deflate the blocks; with 1, they are deflated by the thread writing the text
+         * @param level of zlib, Z_DEFAULT_COMPRESSION like bgzip by default
+         * @param block_size bytes of text in each block, at most bgzf_max_block_text
+         */
+        BgzfStreamBuffer(std::ostream & output, size_t threads, int level = Z_DEFAULT_COMPRESSION,
+                         size_t block_size = bgzf_max_block_text)
+        : output(output), level(level), text(block_size), max_in_flight(4 * std::max(threads, size_t{1})),
+          closed(false), stop(false)
+        {
+            if (block_size == 0 || block_size > bgzf_max_block_text) {
+                throw std::invalid_argument{"The blocks of BGZF must have between 1 and "
+                                            + std::to_string(bgzf_max_block_text) + " bytes of text"};
+            }
+            if (level < Z_DEFAULT_COMPRESSION || level > Z_BEST_COMPRESSION) {
+                throw std::invalid_argument{"The compression level must be between -1 and 9"};
+            }
+            setp(text.data(), text.data() + text.size());
+            for (size_t i = 0; threads > 1 && i < threads; ++i) {
+                workers.emplace_back(&BgzfStreamBuffer::deflate_blocks, this);
+            }
+        }
+
+        /**
+         * Closes the output if close wasn't called, ignoring any error
+         */
+        ~BgzfStreamBuffer()
+        {
+            try {
+                close();
+            } catch (std::exception const &) {
+            }
+            {
+                std::lock_guard<std::mutex> lock{mutex};
+                stop = true;
+            }
+            work_available.notify_all();
+            for (auto & worker : workers) {
+                worker.join();
+            }
+        }
+
+        BgzfStreamBuffer(BgzfStreamBuffer const &) = delete;
+        BgzfStreamBuffer & operator=(BgzfStreamBuffer const &) = delete;
+
+        /**
+         * Writes the last block and the end-of-file marker, and flushes the output
+         * @throw std::runtime_error if a block couldn't be compressed or written
+         */
+        void close()
+        {
+            if (closed) {
+                return;
+            }
+            closed = true;
+            if (pptr() != pbase()) {
+                submit_block();
+            }
+            while (not in_flight.empty()) {
+                write_oldest_block();
+            }
+            output.write(bgzf_eof_marker, bgzf_eof_marker_size);
+            output.flush();
+            if (not output) {
+                throw std::runtime_error{"Couldn't write the BGZF output"};
+            }
+        }
+
+      protected:
+        int_type overflow(int_type character) override
+        {
+            if (closed) {
+                return traits_type::eof();
+            }
+            try {
+                // only full blocks are cut, the last one is written by close
+                if (pptr() == epptr()) {
+                    submit_block();
+                }
+            } catch (std::exception const &) {
+                return traits_type::eof();
+            }
+            if (not traits_type::eq_int_type(character, traits_type::eof())) {
+                *pptr() = traits_type::to_char_type(character);
+                pbump(1);
+            }
+            return traits_type::not_eof(character);
+        }
+
+        int sync() override
+        {
+            return output.flush() ? 0 : -1;
+        }
+
+      private:
+        struct Job
+        {
+            Job() : done(false) {}
+
+            std::vector<char> text;
+            std::vector<char> compressed;
+            std::string error;
+            bool done;
+        };
+
+        /**
+         * Hands the text buffered over to be deflated, and writes the oldest blocks if too many are in flight
+         */
+        void submit_block()
+        {
+            std::shared_ptr<Job> job = std::make_shared<Job>();
+            job->text.assign(pbase(), pptr());
+            setp(text.data(), text.data() + text.size());
+
+            if (workers.empty()) {
+                deflate_block(*job);
+                job->done = true;
+                in_flight.push_back(job);
+            } else {
+                std::lock_guard<std::mutex> lock{mutex};
+                in_flight.push_back(job);
+                pending_jobs.push_back(job);
+                work_available.notify_one();
+            }
+
+            while (in_flight.size() >= max_in_flight || (not in_flight.empty() && is_done(*in_flight.front()))) {
+                write_oldest_block();
+            }
+        }
+
+        bool is_done(Job const & job)
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            return job.done;
+        }
+
+        void write_oldest_block()
+        {
+            std::shared_ptr<Job> job;
+            {
+                std::unique_lock<std::mutex> lock{mutex};
+                work_done.wait(lock, [this] { return in_flight.front()->done; });
+                job = in_flight.front();
+                in_flight.pop_front();
+            }
+
+            if (not job->error.empty()) {
+                throw std::runtime_error{"Couldn't compress the BGZF output: " + job->error};
+            }
+            if (not output.write(job->compressed.data(), job->compressed.size())) {
+                throw std::runtime_error{"Couldn't write the BGZF output"};
+            }
+        }
+
+        void deflate_blocks()
+        {
+            while (true) {
+                std::shared_ptr<Job> job;
+                {
+                    std::unique_lock<std::mutex> lock{mutex};
+                    work_available.wait(lock, [this] { return stop || not pending_jobs.empty(); });
+                    if (stop) {
+                        return;
+                    }
+                    job = pending_jobs.front();
+                    pending_jobs.pop_front();
+                }
+
+                deflate_block(*job);
+
+                {
+                    std::lock_guard<std::mutex> lock{mutex};
+                    job->done = true;
+                }
+                work_done.notify_all();
+            }
+        }
+
+        void deflate_block(Job & job)
+        {
+            job.error = deflate_bgzf_block(job.text.data(), job.text.size(), level, job.compressed);
+            std::vector<char>().swap(job.text);
+        }
+
+        std::ostream & output;
+        int level;
+        std::vector<char> text;                     // put area, with the text of the next block
+        size_t max_in_flight;
+        bool closed;
+
+        std::deque<std::shared_ptr<Job>> in_flight; // in output order, only accessed by the writing thread
+
+        std::mutex mutex;
+        std::condition_variable work_available;
+        std::condition_variable work_done;
+        std::deque<std::shared_ptr<Job>> pending_jobs;
+        bool stop;
+        std::vector<std::thread> workers;
+    };
+  }
+}
+
+#endif // UTIL_BGZF_WRITER_HPP
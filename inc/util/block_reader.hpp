@@ -0,0 +1,246 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UTIL_BLOCK_READER_HPP
+#define UTIL_BLOCK_READER_HPP
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
+
+namespace ebi
+{
+  namespace util
+  {
+    size_t const default_block_size = 4 * 1024 * 1024;
+
+    /**
+     * View over a chunk of the input. The memory is owned by the BlockReader that returned it, and is only valid
+     * until the next call to `read` or `readline` on that reader.
+     */
+    struct Block
+    {
+        char const * data;
+        size_t size;
+    };
+
+    /**
+     * Reads an input in big chunks, so the parser can be fed with several lines at once instead of one at a time.
+     *
+     * Blocks are not aligned to line boundaries: a line may span several blocks, and the ragel machines are
+     * expected to resume where the previous block left off.
+     */
+    class BlockReader
+    {
+      public:
+        BlockReader() : pending{nullptr, 0} {}
+        virtual ~BlockReader() = default;
+
+        /**
+         * Provides the next chunk of input
+         * @return false if the end of the input was reached, and no data was provided
+         */
+        bool read(Block & block)
+        {
+            if (pending.size != 0) {
+                block = pending;
+                pending = Block{nullptr, 0};
+                return true;
+            }
+            return next_block(block);
+        }
+
+        /**
+         * Provides the next chunk of input without consuming it, so it will be returned again by `read`
+         * @return false if the end of the input was reached
+         */
+        bool peek(Block & block)
+        {
+            if (read(block)) {
+                pending = block;
+                return true;
+            }
+            return false;
+        }
+
+        /**
+         * Reads until the end of line ('\n') or end of input, with the same semantics as `util::readline`.
+         * The contents of the block after the newline will be returned by the next call to `read`.
+         */
+        template <typename Container>
+        Container & readline(Container & container)
+        {
+            Block block;
+            container.clear();
+
+            while (read(block)) {
+                char const * block_end = block.data + block.size;
+                char const * newline = static_cast<char const *>(std::memchr(block.data, '\n', block.size));
+                if (newline != nullptr) {
+                    container.insert(container.end(), block.data, newline + 1);
+                    pending = Block{newline + 1, static_cast<size_t>(block_end - (newline + 1))};
+                    break;
+                }
+                container.insert(container.end(), block.data, block_end);
+            }
+
+            return container;
+        }
+
+        /**
+         * Copies the next `lines` lines to `output`, writing whole blocks (or the parts of them) at once instead of
+         * line by line
+         * @return number of complete lines copied, less than `lines` only if the input ended before
+         */
+        size_t copy_lines(size_t lines, std::ostream & output)
+        {
+            Block block;
+            size_t copied = 0;
+
+            while (copied < lines && read(block)) {
+                char const * block_end = block.data + block.size;
+                char const * p = block.data;
+                while (copied < lines && p != block_end) {
+                    char const * newline = static_cast<char const *>(std::memchr(p, '\n', block_end - p));
+                    if (newline == nullptr) {
+                        p = block_end;  // the line continues in the next block
+                    } else {
+                        p = newline + 1;
+                        ++copied;
+                    }
+                }
+                output.write(block.data, p - block.data);
+                if (p != block_end) {
+                    pending = Block{p, static_cast<size_t>(block_end - p)};
+                }
+            }
+
+            return copied;
+        }
+
+        /**
+         * Copies the rest of the input to `output`
+         */
+        void copy_rest(std::ostream & output)
+        {
+            Block block;
+            while (read(block)) {
+                output.write(block.data, block.size);
+            }
+        }
+
+        /**
+         * Whether the blocks are views of an input that is already in memory, like a mapped file, so reading them
+         * ahead would only copy them
+         */
+        virtual bool is_in_memory() const
+        {
+            return false;
+        }
+
+      protected:
+        virtual bool next_block(Block & block) = 0;
+
+      private:
+        Block pending;
+    };
+
+    /**
+     * Reads from any std::istream (e.g. stdin) into an internal buffer of fixed size
+     */
+    class StreamBlockReader : public BlockReader
+    {
+      public:
+        StreamBlockReader(std::istream & input, size_t block_size = default_block_size)
+        : input(input), buffer(block_size)
+        {
+        }
+
+      protected:
+        bool next_block(Block & block) override
+        {
+            if (not input) {
+                return false;
+            }
+            input.read(buffer.data(), buffer.size());
+            size_t read_bytes = static_cast<size_t>(input.gcount());
+            block = Block{buffer.data(), read_bytes};
+            return read_bytes != 0;
+        }
+
+      private:
+        std::istream & input;
+        std::vector<char> buffer;
+    };
+
+    /**
+     * Maps a regular file in memory and provides views of it, avoiding any copies of the input
+     */
+    class MappedFileBlockReader : public BlockReader
+    {
+      public:
+        MappedFileBlockReader(std::string const & path, size_t block_size = default_block_size)
+        : file(), block_size(block_size), offset(0)
+        {
+            // mapping an empty file is an error, but reading it is not
+            if (boost::filesystem::file_size(path) != 0) {
+                file.open(path);
+                if (not file.is_open()) {
+                    throw std::runtime_error{"Couldn't map file " + path};
+                }
+            }
+        }
+
+        /**
+         * The whole file, regardless of the blocks already read
+         */
+        Block contents() const
+        {
+            return file.is_open() ? Block{file.data(), file.size()} : Block{nullptr, 0};
+        }
+
+        bool is_in_memory() const override
+        {
+            return true;
+        }
+
+      protected:
+        bool next_block(Block & block) override
+        {
+            if (not file.is_open() || offset >= file.size()) {
+                return false;
+            }
+            size_t read_bytes = std::min(block_size, file.size() - offset);
+            block = Block{file.data() + offset, read_bytes};
+            offset += read_bytes;
+            return true;
+        }
+
+      private:
+        boost::iostreams::mapped_file_source file;
+        size_t block_size;
+        size_t offset;
+    };
+  }
+}
+
+#endif // UTIL_BLOCK_READER_HPP
@@ -0,0 +1,135 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UTIL_GZIP_BLOCK_READER_HPP
+#define UTIL_GZIP_BLOCK_READER_HPP
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <zlib.h>
+
+#include "util/block_reader.hpp"
+#include "util/trace.hpp"
+
+namespace ebi
+{
+  namespace util
+  {
+    /**
+     * Checks the gzip magic number (RFC 1952) at the beginning of a block
+     */
+    inline bool is_gzip(Block const & block)
+    {
+        return block.size >= 2
+               && static_cast<unsigned char>(block.data[0]) == 0x1f
+               && static_cast<unsigned char>(block.data[1]) == 0x8b;
+    }
+
+    /**
+     * Checks whether a gzip member is a BGZF block: it must have an extra field whose first subfield is "BC".
+     * See section 4.1 of the SAM/BAM specification.
+     */
+    inline bool is_bgzf(Block const & block)
+    {
+        size_t const flags = 3, extra_field = 0x04, subfield_id = 12;
+        return is_gzip(block)
+               && block.size >= subfield_id + 2
+               && (block.data[flags] & extra_field) != 0
+               && block.data[subfield_id] == 'B'
+               && block.data[subfield_id + 1] == 'C';
+    }
+
+    /**
+     * Decompresses a gzip or BGZF input on the fly. Concatenated gzip members (which is how BGZF files
+     * are built) are decompressed one after another as a single stream.
+     */
+    class GzipBlockReader : public BlockReader
+    {
+      public:
+        GzipBlockReader(BlockReader & compressed, size_t block_size = default_block_size)
+        : compressed(compressed), buffer(block_size), stream(), input_left(false)
+        {
+            stream.zalloc = Z_NULL;
+            stream.zfree = Z_NULL;
+            stream.opaque = Z_NULL;
+            stream.next_in = Z_NULL;
+            stream.avail_in = 0;
+            // 16 + MAX_WBITS: expect a gzip header and trailer instead of zlib ones
+            if (inflateInit2(&stream, 16 + MAX_WBITS) != Z_OK) {
+                throw std::runtime_error{"Couldn't initialize the gzip decompression"};
+            }
+        }
+
+        ~GzipBlockReader()
+        {
+            inflateEnd(&stream);
+        }
+
+        GzipBlockReader(GzipBlockReader const &) = delete;
+        GzipBlockReader & operator=(GzipBlockReader const &) = delete;
+
+      protected:
+        bool next_block(Block & block) override
+        {
+            TraceSpan span{"decompression", "inflate", "bytes"};
+            stream.next_out = reinterpret_cast<Bytef *>(buffer.data());
+            stream.avail_out = static_cast<uInt>(buffer.size());
+
+            while (stream.avail_out != 0) {
+                if (stream.avail_in == 0) {
+                    Block input;
+                    if (not compressed.read(input)) {
+                        if (input_left) {
+                            throw std::runtime_error{"The compressed input is truncated"};
+                        }
+                        break;
+                    }
+                    stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(input.data));
+                    stream.avail_in = static_cast<uInt>(input.size);
+                }
+
+                int status = inflate(&stream, Z_NO_FLUSH);
+                if (status == Z_STREAM_END) {
+                    // another gzip member may follow
+                    input_left = false;
+                    if (inflateReset(&stream) != Z_OK) {
+                        throw std::runtime_error{"Couldn't decompress the gzip input"};
+                    }
+                } else if (status == Z_OK || status == Z_BUF_ERROR) {
+                    input_left = true;
+                } else {
+                    throw std::runtime_error{"Couldn't decompress the gzip input: "
+                                             + std::string{stream.msg != nullptr ? stream.msg : "invalid data"}};
+                }
+            }
+
+            block = Block{buffer.data(), buffer.size() - stream.avail_out};
+            span.set_arg(static_cast<int64_t>(block.size));
+            return block.size != 0;
+        }
+
+      private:
+        BlockReader & compressed;
+        std::vector<char> buffer;
+        z_stream stream;
+        bool input_left;    // a gzip member was started and not finished
+    };
+  }
+}
+
+#endif // UTIL_GZIP_BLOCK_READER_HPP
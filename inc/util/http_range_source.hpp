@@ -0,0 +1,451 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UTIL_HTTP_RANGE_SOURCE_HPP
+#define UTIL_HTTP_RANGE_SOURCE_HPP
+
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/ssl.hpp>
+#include <boost/beast/core.hpp>
+#include <boost/beast/http.hpp>
+#include <boost/beast/ssl.hpp>
+#include <boost/version.hpp>
+#include <openssl/hmac.h>
+#include <openssl/sha.h>
+
+#include "util/range_request_block_reader.hpp"
+
+namespace ebi
+{
+  namespace util
+  {
+    /**
+     * Reads an object served over HTTP or HTTPS with byte-range GET requests, keeping the connections open to
+     * reuse them. Each thread that reads at the same time uses a connection of its own.
+     *
+     * An s3:// URL is read from https://<bucket>.s3.<region>.amazonaws.com, with the region of AWS_REGION or
+     * AWS_DEFAULT_REGION (us-east-1 by default), or from <AWS_ENDPOINT_URL>/<bucket> if that is set, like for
+     * other services compatible with S3. Its requests are signed with AWS Signature Version 4 if
+     * AWS_ACCESS_KEY_ID and AWS_SECRET_ACCESS_KEY are set (and AWS_SESSION_TOKEN, if temporary), and are
+     * anonymous otherwise.
+     *
+     * Responses of the server that mean the object can't be read, like 403 or 404, throw std::invalid_argument,
+     * so they are not retried; errors of the network and of the server, like 500 or 503, throw
+     * std::runtime_error.
+     */
+    class HttpRangeSource : public RangeSource
+    {
+      public:
+        explicit HttpRangeSource(std::string const & url, std::chrono::seconds timeout = std::chrono::seconds{60})
+        : url(url), timeout(timeout), tls(boost::asio::ssl::context::tls_client)
+        {
+            tls.set_default_verify_paths();
+            tls.set_verify_mode(boost::asio::ssl::verify_peer);
+
+            std::string location = url;
+            if (url.compare(0, 5, "s3://") == 0) {
+                location = s3_location(url.substr(5));
+            }
+            parse(location);
+        }
+
+        uint64_t size() override
+        {
+            namespace http = boost::beast::http;
+            auto response = exchange<http::empty_body>(http::verb::head, "", 0);
+            check_status(response.result_int());
+            auto length = response.find(http::field::content_length);
+            if (length == response.end()) {
+                throw std::invalid_argument{"The server doesn't tell the size of " + url};
+            }
+            return std::stoull(std::string{length->value().data(), length->value().size()});
+        }
+
+        void read(uint64_t offset, size_t size, std::vector<char> & data) override
+        {
+            namespace http = boost::beast::http;
+            std::string range = "bytes=" + std::to_string(offset) + "-" + std::to_string(offset + size - 1);
+            auto response = exchange<http::vector_body<char>>(http::verb::get, range, size);
+            unsigned status = response.result_int();
+            check_status(status);
+            if (status != 206 && !(status == 200 && offset == 0)) {
+                throw std::invalid_argument{"The server doesn't accept range requests for " + url};
+            }
+            data.swap(response.body());
+        }
+
+      private:
+        /**
+         * Connection to the server, which runs each request with a timeout
+         */
+        class Connection
+        {
+          public:
+            Connection(HttpRangeSource const & source, boost::asio::ssl::context & tls)
+            : source(source), stream(io, tls)
+            {
+                namespace asio = boost::asio;
+                boost::system::error_code error;
+                asio::ip::tcp::resolver resolver{io};
+                auto & socket = boost::beast::get_lowest_layer(stream);
+                socket.expires_after(source.timeout);
+                resolver.async_resolve(source.host, source.port, [&](boost::system::error_code const & resolved,
+                                                                     asio::ip::tcp::resolver::results_type hosts) {
+                    error = resolved;
+                    if (!error) {
+                        socket.async_connect(hosts, [&](boost::system::error_code const & connected,
+                                                        asio::ip::tcp::endpoint const &) {
+                            error = connected;
+                        });
+                    }
+                });
+                run(error);
+
+                if (source.secure) {
+                    // the name is needed by servers of several hosts, and to verify the certificate
+                    if (!SSL_set_tlsext_host_name(stream.native_handle(), source.host.c_str())) {
+                        throw std::runtime_error{"Couldn't set the name of the server " + source.host};
+                    }
+#if BOOST_VERSION >= 107300
+                    stream.set_verify_callback(asio::ssl::host_name_verification(source.host));
+#else
+                    stream.set_verify_callback(asio::ssl::rfc2818_verification(source.host));
+#endif
+                    socket.expires_after(source.timeout);
+                    stream.async_handshake(asio::ssl::stream_base::client,
+                                           [&](boost::system::error_code const & handshaken) { error = handshaken; });
+                    run(error);
+                }
+            }
+
+            template <typename Request, typename Response>
+            void exchange(Request const & request, Response & response)
+            {
+                if (source.secure) {
+                    exchange(stream, request, response);
+                } else {
+                    exchange(boost::beast::get_lowest_layer(stream), request, response);
+                }
+            }
+
+          private:
+            template <typename Stream, typename Request, typename Response>
+            void exchange(Stream & connection, Request const & request, Response & response)
+            {
+                namespace http = boost::beast::http;
+                boost::system::error_code error;
+                boost::beast::get_lowest_layer(stream).expires_after(source.timeout);
+                http::async_write(connection, request, [&](boost::system::error_code const & written, size_t) {
+                    error = written;
+                    if (!error) {
+                        http::async_read(connection, buffer, response,
+                                         [&](boost::system::error_code const & read, size_t) { error = read; });
+                    }
+                });
+                run(error);
+            }
+
+            /**
+             * Runs the operation started, which sets `error`, throwing it as a boost::system::system_error
+             */
+            void run(boost::system::error_code const & error)
+            {
+                io.restart();
+                io.run();
+                if (error) {
+                    throw boost::system::system_error{error};
+                }
+            }
+
+            HttpRangeSource const & source;
+            boost::asio::io_context io;
+            boost::beast::ssl_stream<boost::beast::tcp_stream> stream;
+            boost::beast::flat_buffer buffer;
+        };
+
+        /**
+         * Sends a request, on a connection kept open if there is one, and receives its response
+         */
+        template <typename Body>
+        boost::beast::http::response<Body> exchange(boost::beast::http::verb method, std::string const & range,
+                                                    uint64_t body_limit)
+        {
+            namespace http = boost::beast::http;
+            http::request<http::empty_body> request{method, target, 11};
+            request.set(http::field::host, host_header);
+            request.set(http::field::user_agent, "vcf-validator");
+            if (!range.empty()) {
+                request.set(http::field::range, range);
+            }
+            if (!access_key.empty()) {
+                sign(request, range, utc_date_time());
+            }
+
+            // a connection kept open may have been closed by the server since, so then a new one is tried
+            std::unique_ptr<Connection> connection = take_connection();
+            for (bool reused = connection != nullptr; ; reused = false) {
+                http::response_parser<Body> response;
+                response.skip(method == http::verb::head);  // a response to HEAD has the length of a body, not one
+                response.body_limit(body_limit);
+                try {
+                    if (!connection) {
+                        connection.reset(new Connection{*this, tls});
+                    }
+                    connection->exchange(request, response);
+                } catch (boost::system::system_error const &) {
+                    if (!reused) {
+                        throw;
+                    }
+                    connection.reset();
+                    continue;
+                }
+
+                if (response.get().keep_alive()) {
+                    std::lock_guard<std::mutex> lock{mutex};
+                    idle.push_back(std::move(connection));
+                }
+                return response.release();
+            }
+        }
+
+        std::unique_ptr<Connection> take_connection()
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            if (idle.empty()) {
+                return nullptr;
+            }
+            std::unique_ptr<Connection> connection = std::move(idle.back());
+            idle.pop_back();
+            return connection;
+        }
+
+        void check_status(unsigned status) const
+        {
+            std::string message = "The server answered " + std::to_string(status) + " when reading " + url;
+            if (status >= 500 || status == 408 || status == 429) {
+                throw std::runtime_error{message};
+            }
+            if (status >= 300) {
+                throw std::invalid_argument{message};
+            }
+        }
+
+        /**
+         * Splits an http:// or https:// URL into the server and the target of the requests
+         */
+        void parse(std::string const & location)
+        {
+            size_t scheme_end = location.find("://");
+            std::string scheme = location.substr(0, scheme_end);
+            if (scheme_end == std::string::npos || (scheme != "http" && scheme != "https")) {
+                throw std::invalid_argument{"Only http://, https:// and s3:// URLs can be read, not " + url};
+            }
+            secure = scheme == "https";
+
+            size_t authority_begin = scheme_end + 3;
+            size_t authority_end = location.find('/', authority_begin);
+            std::string authority = location.substr(authority_begin, authority_end - authority_begin);
+            target = authority_end == std::string::npos ? "/" : location.substr(authority_end);
+            size_t colon = authority.rfind(':');
+            if (colon != std::string::npos && authority.find(']', colon) == std::string::npos) {
+                host = authority.substr(0, colon);
+                port = authority.substr(colon + 1);
+                host_header = authority;
+            } else {
+                host = authority;
+                port = secure ? "443" : "80";
+                host_header = authority;
+            }
+            if (host.empty()) {
+                throw std::invalid_argument{"There is no server in the URL " + url};
+            }
+        }
+
+        /**
+         * URL of the object of an s3:// URL, without its scheme, taking the credentials from the environment
+         */
+        std::string s3_location(std::string const & bucket_and_key)
+        {
+            size_t slash = bucket_and_key.find('/');
+            if (slash == std::string::npos || slash == 0 || slash + 1 == bucket_and_key.size()) {
+                throw std::invalid_argument{"The URL " + url + " must be like s3://bucket/key"};
+            }
+            std::string bucket = bucket_and_key.substr(0, slash);
+            std::string key = uri_encode(bucket_and_key.substr(slash + 1));
+
+            region = environment("AWS_REGION");
+            if (region.empty()) {
+                region = environment("AWS_DEFAULT_REGION");
+            }
+            if (region.empty()) {
+                region = "us-east-1";
+            }
+            access_key = environment("AWS_ACCESS_KEY_ID");
+            secret_key = environment("AWS_SECRET_ACCESS_KEY");
+            session_token = environment("AWS_SESSION_TOKEN");
+            if (secret_key.empty()) {
+                access_key.clear();
+            }
+
+            std::string endpoint = environment("AWS_ENDPOINT_URL");
+            if (!endpoint.empty()) {
+                if (endpoint.back() == '/') {
+                    endpoint.pop_back();
+                }
+                return endpoint + "/" + bucket + "/" + key;
+            }
+            return "https://" + bucket + ".s3." + region + ".amazonaws.com/" + key;
+        }
+
+        /**
+         * Adds the headers of AWS Signature Version 4 to a request without a body, signing its range too
+         * @param date_time like 20130524T000000Z
+         */
+        template <typename Request>
+        void sign(Request & request, std::string const & range, std::string const & date_time) const
+        {
+            std::string date = date_time.substr(0, 8);
+            std::string const empty_payload = hex(sha256(""));
+
+            // the headers signed are sorted by name
+            request.set("x-amz-content-sha256", empty_payload);
+            request.set("x-amz-date", date_time);
+            std::string headers = "host:" + host_header + "\n";
+            std::string signed_headers = "host";
+            if (!range.empty()) {
+                headers += "range:" + range + "\n";
+                signed_headers += ";range";
+            }
+            headers += "x-amz-content-sha256:" + empty_payload + "\nx-amz-date:" + date_time + "\n";
+            signed_headers += ";x-amz-content-sha256;x-amz-date";
+            if (!session_token.empty()) {
+                request.set("x-amz-security-token", session_token);
+                headers += "x-amz-security-token:" + session_token + "\n";
+                signed_headers += ";x-amz-security-token";
+            }
+
+            auto method = request.method_string();
+            size_t query_begin = std::min(target.find('?'), target.size());
+            std::string canonical_request = std::string{method.data(), method.size()} + "\n"
+                                            + target.substr(0, query_begin) + "\n"
+                                            + target.substr(std::min(query_begin + 1, target.size())) + "\n"
+                                            + headers + "\n" + signed_headers + "\n" + empty_payload;
+            std::string scope = date + "/" + region + "/s3/aws4_request";
+            std::string string_to_sign = "AWS4-HMAC-SHA256\n" + date_time + "\n" + scope + "\n"
+                                         + hex(sha256(canonical_request));
+
+            std::string key = hmac("AWS4" + secret_key, date);
+            for (std::string const & part : {region, std::string{"s3"}, std::string{"aws4_request"}}) {
+                key = hmac(key, part);
+            }
+            request.set(boost::beast::http::field::authorization,
+                        "AWS4-HMAC-SHA256 Credential=" + access_key + "/" + scope + ", SignedHeaders="
+                        + signed_headers + ", Signature=" + hex(hmac(key, string_to_sign)));
+        }
+
+        static std::string utc_date_time()
+        {
+            char date_time[17];
+            std::time_t now = std::time(nullptr);
+            std::tm utc;
+            gmtime_r(&now, &utc);
+            std::strftime(date_time, sizeof date_time, "%Y%m%dT%H%M%SZ", &utc);
+            return date_time;
+        }
+
+        static std::string environment(char const * name)
+        {
+            char const * value = std::getenv(name);
+            return value != nullptr ? value : "";
+        }
+
+        /**
+         * Percent-encodes every byte but the unreserved characters and the slashes, like S3 expects in a path
+         */
+        static std::string uri_encode(std::string const & path)
+        {
+            std::string encoded;
+            for (unsigned char c : path) {
+                if (std::isalnum(c) || c == '-' || c == '.' || c == '_' || c == '~' || c == '/') {
+                    encoded += static_cast<char>(c);
+                } else {
+                    encoded += '%';
+                    encoded += hex(std::string(1, static_cast<char>(c)), true);
+                }
+            }
+            return encoded;
+        }
+
+        static std::string sha256(std::string const & data)
+        {
+            unsigned char digest[SHA256_DIGEST_LENGTH];
+            SHA256(reinterpret_cast<unsigned char const *>(data.data()), data.size(), digest);
+            return std::string{reinterpret_cast<char const *>(digest), sizeof digest};
+        }
+
+        static std::string hmac(std::string const & key, std::string const & data)
+        {
+            unsigned char digest[EVP_MAX_MD_SIZE];
+            unsigned int size = 0;
+            HMAC(EVP_sha256(), key.data(), static_cast<int>(key.size()),
+                 reinterpret_cast<unsigned char const *>(data.data()), data.size(), digest, &size);
+            return std::string{reinterpret_cast<char const *>(digest), size};
+        }
+
+        static std::string hex(std::string const & bytes, bool upper = false)
+        {
+            char const * digits = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+            std::string text;
+            for (unsigned char byte : bytes) {
+                text += digits[byte >> 4];
+                text += digits[byte & 0xf];
+            }
+            return text;
+        }
+
+        std::string url;
+        std::chrono::seconds timeout;
+        boost::asio::ssl::context tls;
+
+        bool secure;
+        std::string host;
+        std::string port;
+        std::string host_header;
+        std::string target;
+
+        std::string region;
+        std::string access_key;     // empty if the requests are not signed
+        std::string secret_key;
+        std::string session_token;
+
+        std::mutex mutex;
+        std::vector<std::unique_ptr<Connection>> idle;
+    };
+  }
+}
+
+#endif // UTIL_HTTP_RANGE_SOURCE_HPP
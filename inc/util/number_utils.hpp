@@ -0,0 +1,195 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UTIL_NUMBER_UTILS_HPP
+#define UTIL_NUMBER_UTILS_HPP
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <string>
+
+#include <locale.h>
+#include <stdlib.h>
+#ifdef __APPLE__
+#include <xlocale.h>
+#endif
+
+namespace ebi
+{
+  namespace util
+  {
+    namespace detail
+    {
+      inline bool is_space(char c)
+      {
+          return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+      }
+
+      inline bool is_digit(char c)
+      {
+          return c >= '0' && c <= '9';
+      }
+
+      /**
+       * Most digits of a plain decimal converted directly: their mantissa and power of 10 are exact in a double,
+       * so the division gives the correctly rounded value
+       */
+      size_t const max_fast_digits = 15;
+
+      /**
+       * Converts a whole string that is a plain decimal, [+-]digits[.digits] with up to max_fast_digits digits
+       *
+       * @return false if the string has another shape, which must be converted by the C library
+       */
+      inline bool parse_plain_decimal(std::string const & text, double & value)
+      {
+          char const * p = text.data();
+          char const * end = p + text.size();
+          bool negative = p != end && *p == '-';
+          if (p != end && (*p == '-' || *p == '+')) {
+              ++p;
+          }
+
+          uint64_t mantissa = 0;
+          size_t digits = 0;
+          size_t fraction_digits = 0;
+          bool point = false;
+          for (; p != end; ++p) {
+              if (is_digit(*p)) {
+                  mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+                  ++digits;
+                  fraction_digits += point;
+              } else if (*p == '.' && !point) {
+                  point = true;
+              } else {
+                  return false;
+              }
+          }
+          if (digits == 0 || digits > max_fast_digits) {
+              return false;
+          }
+
+          static double const powers_of_10[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12,
+                                                1e13, 1e14, 1e15};
+          value = static_cast<double>(mantissa) / powers_of_10[fraction_digits];
+          if (negative) {
+              value = -value;
+          }
+          return true;
+      }
+
+      /**
+       * The "C" locale, for the C library to convert the numbers with a point as the decimal separator whatever
+       * LC_NUMERIC the program runs with
+       */
+      inline locale_t c_locale()
+      {
+          static locale_t const locale = newlocale(LC_ALL_MASK, "C", static_cast<locale_t>(0));
+          return locale;
+      }
+    }
+
+    /**
+     * Parses an int like std::stoi: leading whitespace and a sign, then as many digits as there are, ignoring
+     * what follows them. Unlike std::stoi, it doesn't allocate, depend on the locale or throw.
+     *
+     * @return false if there are no digits, or the number doesn't fit in an int
+     */
+    inline bool parse_int(char const * begin, char const * end, int & value)
+    {
+        char const * p = begin;
+        while (p != end && detail::is_space(*p)) {
+            ++p;
+        }
+        bool negative = p != end && *p == '-';
+        if (p != end && (*p == '-' || *p == '+')) {
+            ++p;
+        }
+        if (p == end || !detail::is_digit(*p)) {
+            return false;
+        }
+
+        // accumulated as a negative number, whose range includes the minimum int
+        long long const limit = static_cast<long long>(std::numeric_limits<int>::min());
+        long long accumulated = 0;
+        for (; p != end && detail::is_digit(*p); ++p) {
+            accumulated = accumulated * 10 - (*p - '0');
+            if (accumulated < limit) {
+                return false;
+            }
+        }
+        if (!negative && -accumulated > std::numeric_limits<int>::max()) {
+            return false;
+        }
+        value = static_cast<int>(negative ? accumulated : -accumulated);
+        return true;
+    }
+
+    inline bool parse_int(std::string const & text, int & value)
+    {
+        return parse_int(text.data(), text.data() + text.size(), value);
+    }
+
+    /**
+     * Parses a number like std::stold, ignoring what follows it, but without throwing. Plain decimals, the usual
+     * values, are converted directly, and the rest (exponents, long mantissas, hexadecimal, infinities...) by
+     * strtold in the "C" locale, so unlike std::stold the decimal separator is always a point.
+     *
+     * @return false if there is no number, or it is out of the range of a long double
+     */
+    inline bool parse_long_double(std::string const & text, long double & value)
+    {
+        double fast;
+        if (detail::parse_plain_decimal(text, fast)) {
+            value = fast;
+            return true;
+        }
+        char * end;
+        int previous_errno = errno;
+        errno = 0;
+        value = strtold_l(text.c_str(), &end, detail::c_locale());
+        bool parsed = end != text.c_str() && errno != ERANGE;
+        errno = previous_errno;
+        return parsed;
+    }
+
+    /**
+     * Like parse_long_double, for a float like std::stof
+     *
+     * @return false if there is no number, or it is out of the range of a float
+     */
+    inline bool parse_float(std::string const & text, float & value)
+    {
+        double fast;
+        if (detail::parse_plain_decimal(text, fast)) {
+            // up to 15 digits, a plain decimal is in the normal range of a float, or 0
+            value = static_cast<float>(fast);
+            return true;
+        }
+        char * end;
+        int previous_errno = errno;
+        errno = 0;
+        value = strtof_l(text.c_str(), &end, detail::c_locale());
+        bool parsed = end != text.c_str() && errno != ERANGE;
+        errno = previous_errno;
+        return parsed;
+    }
+  }
+}
+
+#endif // UTIL_NUMBER_UTILS_HPP
@@ -0,0 +1,232 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UTIL_RANGE_REQUEST_BLOCK_READER_HPP
+#define UTIL_RANGE_REQUEST_BLOCK_READER_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "util/block_reader.hpp"
+#include "util/trace.hpp"
+
+namespace ebi
+{
+  namespace util
+  {
+    size_t const default_range_attempts = 4;
+
+    /**
+     * Input that can be read from any offset, like an object in a storage service that accepts byte-range
+     * requests
+     */
+    class RangeSource
+    {
+      public:
+        virtual ~RangeSource() = default;
+
+        /**
+         * Total bytes of the input
+         * @throw std::runtime_error if it can't be asked now, but may be later
+         */
+        virtual uint64_t size() = 0;
+
+        /**
+         * Reads `size` bytes from `offset` into `data`, which is resized to them. It is called from several threads
+         * at the same time.
+         * @throw std::runtime_error if they can't be read now, but may be later; any other exception if they never
+         * will, like when the input doesn't exist
+         */
+        virtual void read(uint64_t offset, size_t size, std::vector<char> & data) = 0;
+    };
+
+    /**
+     * Reads a RangeSource with several requests at the same time, so a single connection doesn't limit the
+     * throughput, and provides the blocks in order.
+     *
+     * Each thread requests the next block not requested yet, into a ring of buffers that holds twice as many blocks
+     * as threads. When the ring is full, they wait until the parser releases the oldest block, which happens when
+     * the next one is requested. A request that fails with a std::runtime_error is repeated, waiting longer each
+     * time, up to `attempts` times; after that, or after any other error, the error is thrown by `read` when the
+     * parser gets to the block that failed.
+     */
+    class RangeRequestBlockReader : public BlockReader
+    {
+      public:
+        RangeRequestBlockReader(RangeSource & source, size_t connections, size_t block_size = default_block_size,
+                                size_t attempts = default_range_attempts)
+        : source(source), block_size(std::max(block_size, size_t{1})), attempts(std::max(attempts, size_t{1})),
+          ring(2 * std::max(connections, size_t{1})), next_to_request(0), next_to_read(0), holding(false),
+          stop(false), failed_block(0)
+        {
+            total_size = with_retries([this] { return this->source.size(); });
+            n_blocks = static_cast<size_t>((total_size + this->block_size - 1) / this->block_size);
+            for (size_t i = 0; i < std::max(connections, size_t{1}); ++i) {
+                requesters.emplace_back(&RangeRequestBlockReader::request_blocks, this);
+            }
+        }
+
+        ~RangeRequestBlockReader()
+        {
+            {
+                std::lock_guard<std::mutex> lock{mutex};
+                stop = true;
+            }
+            space_available.notify_all();
+            for (auto & requester : requesters) {
+                requester.join();
+            }
+        }
+
+        RangeRequestBlockReader(RangeRequestBlockReader const &) = delete;
+        RangeRequestBlockReader & operator=(RangeRequestBlockReader const &) = delete;
+
+        uint64_t size() const
+        {
+            return total_size;
+        }
+
+      protected:
+        bool next_block(Block & block) override
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+
+            // the previous block is not used anymore, its buffer can be filled again
+            if (holding) {
+                holding = false;
+                ring[next_to_read % ring.size()].ready = false;
+                ++next_to_read;
+                space_available.notify_all();
+            }
+            if (next_to_read == n_blocks) {
+                return false;
+            }
+
+            Buffer & buffer = ring[next_to_read % ring.size()];
+            data_available.wait(lock, [&] { return buffer.ready || (error && failed_block <= next_to_read); });
+            if (!buffer.ready) {
+                std::rethrow_exception(error);
+            }
+            block = Block{buffer.data.data(), buffer.data.size()};
+            holding = true;
+            return true;
+        }
+
+      private:
+        struct Buffer
+        {
+            std::vector<char> data;
+            bool ready = false;
+        };
+
+        void request_blocks()
+        {
+            Trace::name_thread("range request");
+            while (true) {
+                size_t index;
+                {
+                    std::unique_lock<std::mutex> lock{mutex};
+                    space_available.wait(lock, [this] {
+                        return stop || next_to_request == n_blocks || next_to_request < next_to_read + ring.size();
+                    });
+                    if (stop || next_to_request == n_blocks) {
+                        return;
+                    }
+                    index = next_to_request++;
+                }
+
+                // no other thread writes this buffer until the parser is done with it
+                Buffer & buffer = ring[index % ring.size()];
+                uint64_t offset = static_cast<uint64_t>(index) * block_size;
+                size_t size = static_cast<size_t>(std::min<uint64_t>(block_size, total_size - offset));
+                try {
+                    TraceSpan span{"reading", "range request", "offset", static_cast<int64_t>(offset)};
+                    with_retries([&] {
+                        source.read(offset, size, buffer.data);
+                        if (buffer.data.size() != size) {
+                            throw std::runtime_error{"Received " + std::to_string(buffer.data.size())
+                                                     + " bytes instead of " + std::to_string(size)
+                                                     + " from the offset " + std::to_string(offset)};
+                        }
+                        return size;
+                    });
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock{mutex};
+                    if (!error || index < failed_block) {
+                        error = std::current_exception();
+                        failed_block = index;
+                    }
+                    stop = true;
+                    space_available.notify_all();
+                    data_available.notify_all();
+                    return;
+                }
+
+                {
+                    std::lock_guard<std::mutex> lock{mutex};
+                    buffer.ready = true;
+                }
+                data_available.notify_all();
+            }
+        }
+
+        template <typename Request>
+        auto with_retries(Request request) -> decltype(request())
+        {
+            std::chrono::milliseconds wait{100};
+            for (size_t attempt = 1; ; ++attempt) {
+                try {
+                    return request();
+                } catch (std::runtime_error const &) {
+                    if (attempt == attempts) {
+                        throw;
+                    }
+                }
+                std::this_thread::sleep_for(wait);
+                wait *= 2;
+            }
+        }
+
+        RangeSource & source;
+        size_t block_size;
+        size_t attempts;
+        uint64_t total_size;
+        size_t n_blocks;
+
+        std::vector<Buffer> ring;
+        size_t next_to_request;
+        size_t next_to_read;    // the parser holds it if `holding`
+        bool holding;
+
+        std::mutex mutex;
+        std::condition_variable data_available;
+        std::condition_variable space_available;
+        bool stop;
+        std::exception_ptr error;
+        size_t failed_block;
+        std::vector<std::thread> requesters;
+    };
+  }
+}
+
+#endif // UTIL_RANGE_REQUEST_BLOCK_READER_HPP
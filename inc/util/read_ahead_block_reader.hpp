@@ -0,0 +1,180 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UTIL_READ_AHEAD_BLOCK_READER_HPP
+#define UTIL_READ_AHEAD_BLOCK_READER_HPP
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "util/block_reader.hpp"
+#include "util/trace.hpp"
+
+namespace ebi
+{
+  namespace util
+  {
+    size_t const default_read_ahead_buffers = 4;
+
+    /**
+     * Reads another BlockReader from a background thread, so the latency of the disk or network does not stall
+     * the parser.
+     *
+     * The blocks are copied into a ring of reusable buffers. When all of them are filled, the background thread
+     * waits until the parser releases one (which happens when the next block is requested).
+     *
+     * A source already in memory (see BlockReader::is_in_memory) is not read ahead: its blocks are provided as
+     * they are, without copying them nor starting the thread.
+     */
+    class ReadAheadBlockReader : public BlockReader
+    {
+      public:
+        ReadAheadBlockReader(BlockReader & source, size_t buffers = default_read_ahead_buffers)
+        : source(source), ring(std::max(buffers, size_t{2})), first_filled(0), filled(0), holding(false),
+          finished(false), stop(false), error()
+        {
+            if (not source.is_in_memory()) {
+                producer = std::thread{&ReadAheadBlockReader::read_ahead, this};
+            }
+        }
+
+        ~ReadAheadBlockReader()
+        {
+            if (not producer.joinable()) {
+                return;
+            }
+            {
+                std::lock_guard<std::mutex> lock{mutex};
+                stop = true;
+            }
+            space_available.notify_one();
+            producer.join();
+        }
+
+        ReadAheadBlockReader(ReadAheadBlockReader const &) = delete;
+        ReadAheadBlockReader & operator=(ReadAheadBlockReader const &) = delete;
+
+      protected:
+        bool next_block(Block & block) override
+        {
+            if (not producer.joinable()) {
+                return source.read(block);
+            }
+
+            std::unique_lock<std::mutex> lock{mutex};
+
+            // the previous block is not used anymore, its buffer can be filled again
+            if (holding) {
+                holding = false;
+                first_filled = (first_filled + 1) % ring.size();
+                --filled;
+                Trace::counter("read-ahead buffers filled", static_cast<int64_t>(filled));
+                space_available.notify_one();
+            }
+
+            data_available.wait(lock, [this] { return filled != 0 || finished; });
+            if (filled == 0) {
+                if (error) {
+                    std::rethrow_exception(error);
+                }
+                return false;
+            }
+
+            Buffer & buffer = ring[first_filled];
+            block = Block{buffer.data.data(), buffer.size};
+            holding = true;
+            return true;
+        }
+
+      private:
+        struct Buffer
+        {
+            std::vector<char> data;
+            size_t size;
+        };
+
+        void read_ahead()
+        {
+            size_t next = 0;
+            Trace::name_thread("read ahead");
+
+            while (true) {
+                {
+                    std::unique_lock<std::mutex> lock{mutex};
+                    space_available.wait(lock, [this] { return filled < ring.size() || stop; });
+                    if (stop) {
+                        return;
+                    }
+                }
+
+                // the buffer at `next` is free, so it can be written without holding the lock
+                Block block;
+                bool read;
+                try {
+                    TraceSpan span{"reading", "read ahead", "bytes"};
+                    read = source.read(block);
+                    if (read) {
+                        span.set_arg(static_cast<int64_t>(block.size));
+                        Buffer & buffer = ring[next];
+                        if (buffer.data.size() < block.size) {
+                            buffer.data.resize(block.size);
+                        }
+                        std::copy(block.data, block.data + block.size, buffer.data.begin());
+                        buffer.size = block.size;
+                    }
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock{mutex};
+                    error = std::current_exception();
+                    finished = true;
+                    data_available.notify_one();
+                    return;
+                }
+
+                std::lock_guard<std::mutex> lock{mutex};
+                if (not read) {
+                    finished = true;
+                    data_available.notify_one();
+                    return;
+                }
+                ++filled;
+                Trace::counter("read-ahead buffers filled", static_cast<int64_t>(filled));
+                next = (next + 1) % ring.size();
+                data_available.notify_one();
+            }
+        }
+
+        BlockReader & source;
+        std::vector<Buffer> ring;
+        size_t first_filled;    // oldest buffer not yet released by the parser
+        size_t filled;
+        bool holding;           // the parser is using the oldest buffer
+
+        std::mutex mutex;
+        std::condition_variable data_available;
+        std::condition_variable space_available;
+        bool finished;
+        bool stop;
+        std::exception_ptr error;
+        std::thread producer;
+    };
+  }
+}
+
+#endif // UTIL_READ_AHEAD_BLOCK_READER_HPP
@@ -17,9 +17,11 @@
 #ifndef UTIL_STREAM_UTILS_HPP
 #define UTIL_STREAM_UTILS_HPP
 
+#include <cstdint>
 #include <iostream>
 #include <vector>
 #include <map>
+#include <stdexcept>
 #include <string>
 #include <functional>
 
@@ -63,13 +65,57 @@ namespace ebi
         return container;
     }
 
+    /**
+     * Writes a contiguous container of chars, like std::string or std::vector<char>, in a single call
+     */
     template <typename Container>
     std::ostream & writeline(std::ostream & stream, const Container & container)
     {
-        for (auto c : container) {
-            stream << c;
+        return stream.write(container.data(), container.size());
+    }
+
+    /**
+     * Writes a number so that read_number can read it back, in decimal and followed by a newline
+     */
+    inline std::ostream & write_number(std::ostream & stream, uint64_t number)
+    {
+        return stream << number << '\n';
+    }
+
+    /**
+     * Writes a string so that read_string can read it back: its size, a newline, and its chars followed by another
+     * newline, so it can contain any char
+     */
+    inline std::ostream & write_string(std::ostream & stream, std::string const & text)
+    {
+        write_number(stream, text.size());
+        return stream.write(text.data(), text.size()) << '\n';
+    }
+
+    /**
+     * Reads a number written by write_number
+     * @throw std::runtime_error if the stream doesn't continue with one
+     */
+    inline uint64_t read_number(std::istream & stream)
+    {
+        uint64_t number;
+        if (!(stream >> number) || stream.get() != '\n') {
+            throw std::runtime_error{"Expected a number"};
+        }
+        return number;
+    }
+
+    /**
+     * Reads a string written by write_string
+     * @throw std::runtime_error if the stream doesn't continue with one
+     */
+    inline std::string read_string(std::istream & stream)
+    {
+        std::string text(read_number(stream), '\0');
+        if (!stream.read(&text[0], text.size()) || stream.get() != '\n') {
+            throw std::runtime_error{"Expected a string of " + std::to_string(text.size()) + " chars"};
         }
-        return stream;
+        return text;
     }
 
     template <typename F, typename S>
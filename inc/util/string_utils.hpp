@@ -17,7 +17,9 @@
 #ifndef UTIL_STRING_UTILS_HPP
 #define UTIL_STRING_UTILS_HPP
 
+#include <algorithm>
 #include <cstring>
+#include <iterator>
 #include <string>
 #include <vector>
 
@@ -25,6 +27,104 @@ namespace ebi
 {
   namespace util
   {
+    /**
+     * Part of a string, seen in place instead of copied
+     */
+    struct StringPiece
+    {
+        char const * begin;
+        char const * end;
+
+        size_t size() const { return end - begin; }
+        bool empty() const { return begin == end; }
+        std::string str() const { return std::string(begin, end); }
+
+        bool operator==(char const * other) const
+        {
+            size_t other_size = strlen(other);
+            return size() == other_size && std::equal(begin, end, other);
+        }
+
+        bool operator!=(char const * other) const { return !(*this == other); }
+    };
+
+    /**
+     * Walks the parts of a string split by any of `delims`, with the rules of string_split: the first character
+     * is never a delimiter, and a trailing delimiter doesn't add an empty part.
+     */
+    class SplitIterator : public std::iterator<std::forward_iterator_tag, StringPiece>
+    {
+      public:
+        /**
+         * Iterator past the last part
+         */
+        SplitIterator() : piece{nullptr, nullptr}, end(nullptr), delims(nullptr) { }
+
+        SplitIterator(char const * begin, char const * end, char const * delims)
+        : piece{begin, begin}, end(end), delims(delims)
+        {
+            if (begin == end) {
+                *this = SplitIterator{};
+            } else {
+                piece.end = find_delimiter(begin + 1);
+            }
+        }
+
+        StringPiece const & operator*() const { return piece; }
+        StringPiece const * operator->() const { return &piece; }
+
+        SplitIterator & operator++()
+        {
+            if (piece.end == end || piece.end + 1 == end) {
+                *this = SplitIterator{};
+            } else {
+                piece.begin = piece.end + 1;
+                piece.end = find_delimiter(piece.begin);
+            }
+            return *this;
+        }
+
+        SplitIterator operator++(int)
+        {
+            SplitIterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        bool operator==(SplitIterator const & other) const { return piece.begin == other.piece.begin; }
+        bool operator!=(SplitIterator const & other) const { return piece.begin != other.piece.begin; }
+
+      private:
+        char const * find_delimiter(char const * from) const
+        {
+            return std::find_first_of(from, end, delims, delims + strlen(delims));
+        }
+
+        StringPiece piece;
+        char const * end;
+        char const * delims;
+    };
+
+    /**
+     * Parts of a string split by any of `delims`, to be walked in a range-based for loop
+     */
+    struct SplitRange
+    {
+        SplitIterator first;
+
+        SplitIterator begin() const { return first; }
+        SplitIterator end() const { return SplitIterator{}; }
+    };
+
+    /**
+     * Splits `s` like string_split, but only finds the parts when iterated and doesn't copy them. `s` must
+     * outlive the range.
+     */
+    inline SplitRange split_view(std::string const & s, char const * delims)
+    {
+        return SplitRange{SplitIterator{s.data(), s.data() + s.size(), delims}};
+    }
+
     /**
      * Splits `s` using `delims` as separator and fills the container `ret` with the parts.
      * An empty string results in an empty container `ret`.
@@ -36,25 +136,28 @@ namespace ebi
     void string_split(std::string const & s, char const * delims, C & ret)
     {
         C output;
+        for (StringPiece const & part : split_view(s, delims)) {
+            output.push_back(typename C::value_type(part.begin, part.end));
+        }
+        output.swap(ret);
+    }
 
-        if (s.size() > 0) {
-            char const* p = s.c_str();
-            char const* q = strpbrk(p+1, delims);
-
-            // Insert first to last-1 elements
-            for( ; q != NULL; q = strpbrk(p, delims) )
-            {
-                output.push_back(typename C::value_type(p, q));
-                p = q + 1;
-            }
-
-            // Insert last element
-            if (p < &(s.back()) + 1) {
-                output.push_back(typename C::value_type(p));
+    /**
+     * Same as string_split, but keeps the memory of `ret` and of its strings, so that splitting many strings
+     * into the same vector doesn't allocate once it's big enough
+     */
+    inline void string_split_into(std::string const & s, char const * delims, std::vector<std::string> & ret)
+    {
+        size_t n_parts = 0;
+        for (StringPiece const & part : split_view(s, delims)) {
+            if (n_parts < ret.size()) {
+                ret[n_parts].assign(part.begin, part.end);
+            } else {
+                ret.emplace_back(part.begin, part.end);
             }
+            ++n_parts;
         }
-
-        output.swap(ret);
+        ret.resize(n_parts);
     }
 
     /**
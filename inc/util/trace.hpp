@@ -0,0 +1,257 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UTIL_TRACE_HPP
+#define UTIL_TRACE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace ebi
+{
+  namespace util
+  {
+    /**
+     * Timeline of what every thread of the process does, written in the trace-event JSON format of Chrome, that
+     * chrome://tracing and https://ui.perfetto.dev open. It has a span for each block read or inflated, each buffer
+     * parsed, each batch of checks and of reports, with the thread that ran it, and counters of how full the
+     * queues between those stages are.
+     *
+     * Nothing is recorded until start is called, and until then a TraceSpan only reads a flag. Each thread records
+     * its events without locks in a ring buffer of its own, so when it is full the oldest events of that thread are
+     * overwritten. The buffers are only read by write, after stop, once the threads that record are done.
+     *
+     * The names, categories and argument names of the events must be string literals, because only their pointers
+     * are kept.
+     */
+    class Trace
+    {
+      public:
+        static size_t const default_capacity = 1 << 16;
+
+        struct Event
+        {
+            char const * name;
+            char const * category;      /**< Stage of the pipeline; nullptr for a counter */
+            uint64_t begin;             /**< Nanoseconds since start */
+            uint64_t duration;
+            char const * arg_name;      /**< Optional, like the bytes of a block or the number of a batch */
+            int64_t arg;
+        };
+
+        /**
+         * Starts recording
+         * @param capacity maximum number of events kept by each thread
+         */
+        static void start(size_t capacity = default_capacity)
+        {
+            Registry & all = registry();
+            {
+                std::lock_guard<std::mutex> lock{all.mutex};
+                all.capacity = std::max(capacity, size_t{1});
+                all.origin = std::chrono::steady_clock::now();
+            }
+            enabled().store(true, std::memory_order_release);
+        }
+
+        static void stop()
+        {
+            enabled().store(false, std::memory_order_release);
+        }
+
+        static bool is_enabled()
+        {
+            return enabled().load(std::memory_order_relaxed);
+        }
+
+        /**
+         * Nanoseconds since start
+         */
+        static uint64_t now()
+        {
+            auto elapsed = std::chrono::steady_clock::now() - registry().origin;
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        }
+
+        /**
+         * Names the calling thread in the timeline, if recording
+         */
+        static void name_thread(char const * name)
+        {
+            if (is_enabled()) {
+                thread_events().name = name;
+            }
+        }
+
+        /**
+         * Records the value of a counter, like the depth of a queue, if recording
+         */
+        static void counter(char const * name, int64_t value)
+        {
+            if (is_enabled()) {
+                record(Event{name, nullptr, now(), 0, nullptr, value});
+            }
+        }
+
+        static void record(Event const & event)
+        {
+            ThreadEvents & thread = thread_events();
+            if (thread.events.size() < thread.capacity) {
+                thread.events.push_back(event);
+                return;
+            }
+            thread.events[thread.next] = event;
+            thread.next = (thread.next + 1) % thread.capacity;
+            ++thread.dropped;
+        }
+
+        /**
+         * Writes the events of every thread as a JSON object with a "traceEvents" array, oldest first in each thread
+         */
+        static void write(std::ostream & output)
+        {
+            Registry & all = registry();
+            std::lock_guard<std::mutex> lock{all.mutex};
+            auto flags = output.flags();
+            auto precision = output.precision();
+            output << std::fixed << std::setprecision(3);
+
+            uint64_t dropped = 0;
+            char const * separator = "\n";
+            output << "{\"traceEvents\":[";
+            for (auto & thread : all.threads) {
+                dropped += thread->dropped;
+                if (thread->name != nullptr) {
+                    output << separator << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << thread->id
+                           << ",\"args\":{\"name\":\"" << thread->name << "\"}}";
+                    separator = ",\n";
+                }
+                size_t size = thread->events.size();
+                for (size_t i = 0; i < size; ++i) {
+                    Event const & event = thread->events[(thread->next + i) % size];
+                    output << separator << "{\"name\":\"" << event.name << "\",";
+                    if (event.category != nullptr) {
+                        output << "\"cat\":\"" << event.category << "\",\"ph\":\"X\",\"ts\":" << event.begin / 1e3
+                               << ",\"dur\":" << event.duration / 1e3;
+                    } else {
+                        output << "\"ph\":\"C\",\"ts\":" << event.begin / 1e3;
+                    }
+                    output << ",\"pid\":1,\"tid\":" << thread->id;
+                    if (event.category == nullptr) {
+                        output << ",\"args\":{\"value\":" << event.arg << "}";
+                    } else if (event.arg_name != nullptr) {
+                        output << ",\"args\":{\"" << event.arg_name << "\":" << event.arg << "}";
+                    }
+                    output << "}";
+                    separator = ",\n";
+                }
+            }
+            output << "\n],\"displayTimeUnit\":\"ms\",\"otherData\":{\"dropped events\":\"" << dropped << "\"}}\n";
+
+            output.flags(flags);
+            output.precision(precision);
+        }
+
+      private:
+        struct ThreadEvents
+        {
+            size_t id;
+            char const * name;
+            size_t capacity;
+            std::vector<Event> events;
+            size_t next;        // oldest event, once the buffer is full
+            uint64_t dropped;
+        };
+
+        struct Registry
+        {
+            std::mutex mutex;
+            size_t capacity;
+            std::chrono::steady_clock::time_point origin;
+            std::vector<std::unique_ptr<ThreadEvents>> threads;     // kept after their threads finish
+        };
+
+        static std::atomic<bool> & enabled()
+        {
+            static std::atomic<bool> flag{false};
+            return flag;
+        }
+
+        static Registry & registry()
+        {
+            static Registry all;
+            return all;
+        }
+
+        static ThreadEvents & thread_events()
+        {
+            static thread_local ThreadEvents * thread = nullptr;
+            if (thread == nullptr) {
+                Registry & all = registry();
+                std::lock_guard<std::mutex> lock{all.mutex};
+                all.threads.emplace_back(new ThreadEvents{all.threads.size() + 1, nullptr, all.capacity, {}, 0, 0});
+                thread = all.threads.back().get();
+            }
+            return *thread;
+        }
+    };
+
+    /**
+     * Records the time from its construction to its destruction as a span of the calling thread, if the trace was
+     * recording when it was constructed
+     */
+    class TraceSpan
+    {
+      public:
+        TraceSpan(char const * category, char const * name, char const * arg_name = nullptr, int64_t arg = 0)
+        : recording{Trace::is_enabled()}, event{name, category, recording ? Trace::now() : 0, 0, arg_name, arg}
+        {
+        }
+
+        ~TraceSpan()
+        {
+            if (recording && Trace::is_enabled()) {
+                event.duration = Trace::now() - event.begin;
+                Trace::record(event);
+            }
+        }
+
+        /**
+         * Sets the argument once it is known, like the size of a block after reading it
+         */
+        void set_arg(int64_t arg)
+        {
+            event.arg = arg;
+        }
+
+        TraceSpan(TraceSpan const &) = delete;
+        TraceSpan & operator=(TraceSpan const &) = delete;
+
+      private:
+        bool recording;
+        Trace::Event event;
+    };
+  }
+}
+
+#endif // UTIL_TRACE_HPP
@@ -0,0 +1,168 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UTIL_WORKER_POOL_HPP
+#define UTIL_WORKER_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "util/trace.hpp"
+
+namespace ebi
+{
+  namespace util
+  {
+    /**
+     * Fixed set of threads that run the tasks of a batch in parallel.
+     *
+     * Every thread, including the one calling run, takes the next task of the batch from a shared counter until
+     * there are none left, so the threads that get cheap tasks keep taking more while others are busy with the
+     * expensive ones. The tasks finish in any order; it's up to the caller to put their results in sequence.
+     */
+    class WorkerPool
+    {
+      public:
+        /**
+         * @param threads total number of threads running tasks, including the caller of run
+         */
+        explicit WorkerPool(size_t threads)
+        : task(nullptr), n_tasks(0), next_task(0), batch(0), busy_workers(0), stop(false), error()
+        {
+            for (size_t i = 1; i < std::max(threads, size_t{1}); ++i) {
+                workers.emplace_back(&WorkerPool::work, this);
+            }
+        }
+
+        ~WorkerPool()
+        {
+            {
+                std::lock_guard<std::mutex> lock{mutex};
+                stop = true;
+            }
+            batch_available.notify_all();
+            for (auto & worker : workers) {
+                worker.join();
+            }
+        }
+
+        WorkerPool(WorkerPool const &) = delete;
+        WorkerPool & operator=(WorkerPool const &) = delete;
+
+        size_t size() const
+        {
+            return workers.size() + 1;
+        }
+
+        /**
+         * Calls `run_task(i)` for every i in [0, tasks), and returns when all of them have finished. If any task
+         * throws, the first exception is rethrown here, after the rest of the batch has finished.
+         */
+        void run(size_t tasks, std::function<void(size_t)> const & run_task)
+        {
+            if (tasks == 0) {
+                return;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock{mutex};
+                task = &run_task;
+                n_tasks = tasks;
+                next_task = 0;
+                error = nullptr;
+                busy_workers = workers.size();
+                ++batch;
+            }
+            batch_available.notify_all();
+
+            run_tasks();
+
+            std::unique_lock<std::mutex> lock{mutex};
+            batch_finished.wait(lock, [this] { return busy_workers == 0; });
+            task = nullptr;
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+
+      private:
+        void work()
+        {
+            size_t last_batch = 0;
+            Trace::name_thread("worker");
+
+            while (true) {
+                {
+                    std::unique_lock<std::mutex> lock{mutex};
+                    batch_available.wait(lock, [&] { return batch != last_batch || stop; });
+                    if (stop) {
+                        return;
+                    }
+                    last_batch = batch;
+                }
+
+                run_tasks();
+
+                std::lock_guard<std::mutex> lock{mutex};
+                if (--busy_workers == 0) {
+                    batch_finished.notify_one();
+                }
+            }
+        }
+
+        void run_tasks()
+        {
+            TraceSpan span{"workers", "tasks", "tasks"};
+            int64_t tasks_run = 0;
+            for (size_t i = next_task++; i < n_tasks; i = next_task++) {
+                ++tasks_run;
+                try {
+                    (*task)(i);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock{mutex};
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                }
+            }
+            span.set_arg(tasks_run);
+        }
+
+        std::vector<std::thread> workers;
+
+        // current batch, only modified while no worker is running tasks
+        std::function<void(size_t)> const * task;
+        size_t n_tasks;
+        std::atomic<size_t> next_task;
+
+        std::mutex mutex;
+        std::condition_variable batch_available;
+        std::condition_variable batch_finished;
+        size_t batch;           // number of batches started, so each worker runs every batch once
+        size_t busy_workers;    // workers that have not finished the current batch
+        bool stop;
+        std::exception_ptr error;
+    };
+  }
+}
+
+#endif // UTIL_WORKER_POOL_HPP
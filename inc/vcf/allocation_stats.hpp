@@ -0,0 +1,125 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VCF_ALLOCATION_STATS_HPP
+#define VCF_ALLOCATION_STATS_HPP
+
+#include <cstdint>
+#include <ostream>
+
+namespace ebi
+{
+  namespace vcf
+  {
+
+    /**
+     * Stages of the validation whose heap allocations are counted apart
+     */
+    enum class AllocationStage : size_t
+    {
+        other,
+        reading,
+        parsing,
+        records,
+        checks,
+        normalization,
+        record_cache,
+        errors,
+        reporting
+    };
+
+    size_t const n_allocation_stages = static_cast<size_t>(AllocationStage::reporting) + 1;
+
+    /**
+     * Heap allocations, and their bytes, made by each stage of the validation.
+     *
+     * They are only counted when the validator is built with the ALLOCATION_STATS option of CMake, which replaces
+     * the global operator new with one that adds each allocation to the stage running in the calling thread, once
+     * counting has started. The counts are shared by every validation run by the process. Without the option
+     * nothing is counted, and marking the stages costs nothing.
+     */
+    class AllocationStats
+    {
+      public:
+        /**
+         * Whether the allocations can be counted in this build
+         */
+        static bool is_available();
+
+        static void start();
+
+        static uint64_t allocations(AllocationStage stage);
+
+        static uint64_t bytes(AllocationStage stage);
+
+        /**
+         * Counts a record read, to report the allocations per record
+         */
+        static void add_record()
+        {
+#ifdef VCF_ALLOCATION_STATS
+            count_record();
+#endif
+        }
+
+        static uint64_t records();
+
+        /**
+         * Writes a table of the allocations of each stage, also per record
+         */
+        static void write(std::ostream & output);
+
+      private:
+        static void count_record();
+    };
+
+    /**
+     * Attributes the allocations of the calling thread to a stage, from its construction to its destruction, when
+     * they are counted. Scopes can be nested, the innermost stage is the one counted.
+     */
+    class AllocationScope
+    {
+      public:
+#ifdef VCF_ALLOCATION_STATS
+        explicit AllocationScope(AllocationStage stage) : m_previous{current}
+        {
+            current = stage;
+        }
+
+        ~AllocationScope()
+        {
+            current = m_previous;
+        }
+
+        static AllocationStage current_stage()
+        {
+            return current;
+        }
+
+      private:
+        static thread_local AllocationStage current;
+        AllocationStage m_previous;
+#else
+        explicit AllocationScope(AllocationStage stage)
+        {
+        }
+#endif
+    };
+
+  }
+}
+
+#endif // VCF_ALLOCATION_STATS_HPP
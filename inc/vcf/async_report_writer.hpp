@@ -0,0 +1,119 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef VCF_ASYNC_REPORT_WRITER_HPP
+#define VCF_ASYNC_REPORT_WRITER_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "vcf/error.hpp"
+#include "vcf/memory_budget.hpp"
+#include "vcf/report_writer.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    /**
+     * Writes to another report from a thread of its own, so the parser doesn't wait for the files or the database.
+     *
+     * Every batch is copied into a queue of at most `max_queued_errors` errors, and the caller only waits when it is
+     * full. The output must not be used by anyone else until close() returns. Any exception thrown by the output
+     * is rethrown by the next write or by close().
+     *
+     * The writes are done later, so is_full is always false: a LimitedReportWriter must wrap this writer, not be
+     * wrapped by it.
+     *
+     * If a `memory` budget is provided, the most errors ever queued are recorded in it.
+     */
+    class AsyncReportWriter : public ReportWriter
+    {
+      public:
+        static size_t const default_max_queued_errors = 100000;
+
+        AsyncReportWriter(std::unique_ptr<ReportWriter> output,
+                          size_t max_queued_errors = default_max_queued_errors,
+                          MemoryBudget * memory = nullptr);
+
+        /**
+         * Closes the writer, only logging the exceptions of the output
+         */
+        virtual ~AsyncReportWriter();
+
+        virtual void write_error(Error &error) override;
+        virtual void write_warning(Error &error) override;
+        virtual void write_batch(std::vector<ReportedError> const & batch) override;
+        virtual void write_message(const std::string &report_result) override;
+        virtual std::string get_filename() override;
+
+        /**
+         * Waits until everything queued has been written, so the output saves its state after all of it
+         */
+        virtual void save_checkpoint(std::ostream &checkpoint) override;
+
+        /**
+         * Must be called before writing anything, while the thread has nothing to write
+         */
+        virtual void load_checkpoint(std::istream &checkpoint) override;
+
+        /**
+         * Waits until everything queued has been written, and stops the thread
+         */
+        void close();
+
+      private:
+        struct Item
+        {
+            std::vector<std::unique_ptr<Error>> errors;     // copies owned by the queue
+            std::vector<ReportedError> batch;               // pointing to `errors`
+            bool is_message;
+            std::string message;
+        };
+
+        void push(Item item, size_t size);
+        void work();
+
+        /**
+         * Waits until the queue is empty, rethrowing any exception of the output
+         */
+        void wait_until_written();
+
+        std::unique_ptr<ReportWriter> output;
+        std::string file_name;      // taken at construction, so the output is only used by the thread
+        size_t max_queued_errors;
+        MemoryBudget * memory;
+
+        std::mutex mutex;
+        std::condition_variable item_available;
+        std::condition_variable space_available;
+        std::deque<Item> queue;
+        size_t queued_errors;       // in the queue or being written
+        bool closed;
+        std::exception_ptr error;
+        std::thread worker;
+    };
+  }
+}
+
+#endif // VCF_ASYNC_REPORT_WRITER_HPP
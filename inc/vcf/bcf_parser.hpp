@@ -0,0 +1,148 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VCF_BCF_PARSER_HPP
+#define VCF_BCF_PARSER_HPP
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "vcf/validator.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+
+    /**
+     * Bytes before the header text of a BCF input: the magic string, the version and the length of the text
+     */
+    size_t const bcf_prefix_size = 9;
+
+    /**
+     * Whether an uncompressed input begins like BCF version 2
+     */
+    bool is_bcf(char const * begin, char const * end);
+
+    /**
+     * Parser of an uncompressed BCF2 input, which decodes its records from their typed binary fields into a Record,
+     * without writing and tokenizing them as text.
+     *
+     * The header text is parsed by a parser of its VCF version, which then checks each record decoded as if it had
+     * parsed its line, with its policies: at the error level only the binary structure of the records is checked,
+     * and at the others they are checked like the text ones. Each record counts as a line after the header.
+     */
+    class BcfParser : public Parser
+    {
+      public:
+        /**
+         * @param text_parser parser of the VCF version of the header text, which checks the records too
+         */
+        explicit BcfParser(std::unique_ptr<ParserImpl> text_parser);
+
+        void parse(std::string const & text) override;
+        void parse(std::vector<char> const & text) override;
+
+        /**
+         * Decodes the records in a buffer of the uncompressed input, keeping the last one if it is incomplete
+         */
+        void parse(char const * begin, char const * end) override;
+
+        void end() override;
+
+        bool is_valid() const override;
+        const std::vector<std::unique_ptr<Error>> & errors() const override;
+        const std::vector<std::unique_ptr<Error>> & warnings() const override;
+        const std::vector<size_t> & error_lines_read() const override;
+        const std::vector<size_t> & warning_lines_read() const override;
+        size_t omitted_errors() const override;
+        size_t omitted_warnings() const override;
+        size_t first_unfinished_line() const override;
+        size_t lines_read() const override;
+        ContigId last_contig() const override;
+        size_t last_position() const override;
+
+        ParserImpl & text_parser();
+        ParserImpl const & text_parser() const;
+
+      private:
+        /**
+         * Part of the input decoded next
+         */
+        enum class Section { prefix, header, lengths, record, stopped };
+
+        /**
+         * Provides the next `size` bytes of the input contiguously: from the buffer if they are all in it, or
+         * copied after the ones kept from the previous buffers
+         *
+         * @return false if the buffer ended before, keeping what it had
+         */
+        bool next_bytes(char const *& p, char const * end, size_t size, char const *& bytes);
+
+        void decode_prefix(char const * bytes);
+        void decode_header(char const * bytes);
+
+        /**
+         * Reads the dictionaries of contigs and of strings from the meta lines of the header text
+         */
+        void read_dictionaries(std::string const & text);
+
+        void decode_record(char const * shared, char const * individual);
+
+        /**
+         * Stops decoding, reporting that the input is not valid BCF
+         */
+        void stop(std::string const & message);
+
+        std::unique_ptr<ParserImpl> text;
+
+        Section section;
+        size_t section_size;        ///< bytes of the section decoded next
+        size_t shared_size;         ///< of the record decoded next
+        std::vector<char> pending;  ///< bytes of the next section that were in previous buffers
+
+        std::vector<std::string> contigs;
+        std::vector<std::string> dictionary;    ///< IDs of the FILTER, INFO and FORMAT meta entries
+        std::set<std::string> flags;            ///< IDs of the INFO entries of type Flag
+        size_t n_samples;
+
+        /**
+         * Fields of the last record decoded, reused with every record so they don't allocate strings once they
+         * have grown enough
+         */
+        struct RecordFields
+        {
+            std::string chromosome;
+            std::vector<std::string> ids;
+            std::string reference;
+            std::vector<std::string> alternates;
+            std::vector<std::string> filters;
+            std::multimap<std::string, std::string> info;
+            std::vector<std::string> format;
+            std::vector<std::string> samples;
+            std::string value;
+        };
+
+        RecordFields fields;
+    };
+  }
+}
+
+#endif // VCF_BCF_PARSER_HPP
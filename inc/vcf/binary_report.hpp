@@ -0,0 +1,137 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef VCF_BINARY_REPORT_HPP
+#define VCF_BINARY_REPORT_HPP
+
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/iostreams/device/mapped_file.hpp>
+
+#include "vcf/report_reader.hpp"
+#include "vcf/report_writer.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    /**
+     * Layout of a binary report, in the byte order of the machine that wrote it:
+     * - header: `magic`, then `byte_order_mark` as 4 bytes
+     * - one record per error, in the order they were written: its size as 4 bytes, then the error type, severity
+     *   and fix as 1 byte each, the line and the field cardinality as 8 bytes each, and 4 strings (message,
+     *   detailed message, field or value, expected value), each one as its size in 4 bytes followed by its chars
+     * - footer: for errors and then warnings, their count, the offset of the first one and whether they were
+     *   written sorted by line, as 8 bytes each; then the offset of the footer as 8 bytes
+     */
+    namespace binary_report
+    {
+      char const magic[] = "VCFERRB1";
+      uint32_t const byte_order_mark = 0x01020304;
+      size_t const header_size = sizeof(magic) - 1 + sizeof(byte_order_mark);
+      size_t const footer_size = 7 * sizeof(uint64_t);
+
+      /**
+       * @return whether the file starts like a binary report
+       */
+      bool is_binary_report(std::string const & path);
+    }
+
+    /**
+     * Writes the errors as an append-only binary log, much cheaper to write and to read than a database. The
+     * footer is written by close() or by the destructor, and the report can't be read before that.
+     */
+    class BinaryReportWriter : public ReportWriter
+    {
+      public:
+        /**
+         * @param resume: whether to keep the contents of the file, to continue it from a checkpoint
+         */
+        BinaryReportWriter(std::string const & filename, bool resume = false);
+        virtual ~BinaryReportWriter();
+
+        virtual void write_error(Error &error) override;
+        virtual void write_warning(Error &error) override;
+        virtual void write_batch(std::vector<ReportedError> const & batch) override;
+        virtual void write_message(const std::string &report_result) override;
+        virtual std::string get_filename() override;
+        virtual void save_checkpoint(std::ostream &checkpoint) override;
+        virtual void load_checkpoint(std::istream &checkpoint) override;
+
+        void close();
+
+      private:
+        struct SeverityCount
+        {
+            uint64_t count;
+            uint64_t first_offset;
+            uint64_t last_line;
+            bool sorted;
+        };
+
+        void write(Error &error, Severity severity, SeverityCount & severity_count);
+
+        std::string file_name;
+        std::vector<char> file_buffer;
+        std::ofstream file;
+        std::string record;     // reused to encode every record
+        uint64_t offset;
+        SeverityCount errors;
+        SeverityCount warnings;
+    };
+
+    /**
+     * Reads a report written by BinaryReportWriter, mapped in memory. The errors and warnings are iterated in
+     * order of line, like in the database report.
+     */
+    class BinaryReportReader : public ReportReader
+    {
+      public:
+        BinaryReportReader(std::string const & filename);
+
+        virtual size_t count_errors() override;
+        virtual void for_each_error(std::function<void(std::shared_ptr<Error>)> user_function) override;
+
+        virtual size_t count_warnings() override;
+        virtual void for_each_warning(std::function<void(std::shared_ptr<Error>)> user_function) override;
+
+      private:
+        struct SeverityIndex
+        {
+            uint64_t count;
+            uint64_t first_offset;
+            bool sorted;
+        };
+
+        void for_each(SeverityIndex const & index, Severity severity,
+                      std::function<void(std::shared_ptr<Error>)> const & user_function);
+
+        boost::iostreams::mapped_file_source file;
+        uint64_t records_end;
+        SeverityIndex errors;
+        SeverityIndex warnings;
+    };
+  }
+}
+
+#endif // VCF_BINARY_REPORT_HPP
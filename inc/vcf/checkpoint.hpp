@@ -0,0 +1,182 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VCF_CHECKPOINT_HPP
+#define VCF_CHECKPOINT_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "util/block_reader.hpp"
+#include "vcf/report_writer.hpp"
+#include "vcf/validator.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    /**
+     * Checkpoints of the validation of a file, so it can be resumed from the last one if the process is interrupted.
+     *
+     * A checkpoint is taken at the beginning of a body line. It has the offset of that line in the input (a virtual
+     * offset if it is BGZF), the state of the parser after the previous lines, and the state of each report. It is
+     * written to a temporary file that then replaces the previous checkpoint, so an interruption while writing it
+     * leaves the previous one intact.
+     */
+    class Checkpoints
+    {
+      public:
+        /**
+         * Checkpoints written to `path` at most once every `interval`, or after every block of the input if it is
+         * zero
+         */
+        Checkpoints(std::string const & path, std::chrono::steady_clock::duration interval);
+
+        /**
+         * Reads the checkpoint written to the file, to resume the validation from it
+         *
+         * @throw std::runtime_error if the file can't be read or is not a checkpoint
+         */
+        void load();
+
+        /**
+         * Whether a checkpoint was loaded
+         */
+        bool is_resuming() const;
+
+        /**
+         * Files of the reports of the loaded checkpoint, in the order of the outputs, to open them again
+         */
+        std::vector<std::string> const & report_files() const;
+
+        /**
+         * Continues a parser that has just parsed the header, and the reports, from the loaded checkpoint
+         *
+         * @return offset of the input where the validation continues
+         * @throw std::runtime_error if the checkpoint was taken validating another input, at another level or with
+         * other reports
+         */
+        uint64_t restore(uint64_t input_size,
+                         ValidationLevel level,
+                         ParserImpl & parser,
+                         std::vector<std::unique_ptr<ReportWriter>> & outputs);
+
+        /**
+         * Whether the interval has passed since the last checkpoint was written
+         */
+        bool is_due() const;
+
+        /**
+         * Writes a checkpoint at `input_offset`, the beginning of the next line the parser would read
+         *
+         * @throw std::runtime_error if it can't be written, or a report can't be resumed
+         */
+        void write(uint64_t input_size,
+                   uint64_t input_offset,
+                   ValidationLevel level,
+                   ParserImpl const & parser,
+                   std::vector<std::unique_ptr<ReportWriter>> & outputs);
+
+        /**
+         * Removes the checkpoint, once the validation is finished
+         */
+        void remove();
+
+        std::string const & get_path() const;
+
+      private:
+        std::string path;
+        std::chrono::steady_clock::duration interval;
+        std::chrono::steady_clock::time_point last_written;
+
+        bool loaded;
+        uint64_t input_size;
+        uint64_t level;
+        uint64_t input_offset;
+        std::vector<std::string> reports;
+        std::istringstream state;   /**< Of the loaded reports and parser */
+    };
+
+    /**
+     * State of the parser at the end of a file that keeps growing, so the records appended to it later can be
+     * validated without validating again the ones before.
+     *
+     * It is taken at the beginning of the last line of the input, so a line that was being written is validated
+     * again with the rest of it. The input is assumed to be the same up to that line if it is not shorter, and the
+     * checksum of the last bytes it had is the same.
+     */
+    class IncrementalState
+    {
+      public:
+        /**
+         * Bytes at the end of the input whose checksum tells whether it changed
+         */
+        static size_t const tail_size = 1 << 16;
+
+        explicit IncrementalState(std::string const & path);
+
+        /**
+         * Reads the state written to the file by a previous validation
+         *
+         * @throw std::runtime_error if the file can't be read or is not a state
+         */
+        void load();
+
+        /**
+         * Whether a state was loaded
+         */
+        bool is_continuing() const;
+
+        /**
+         * Whether the loaded state was written validating the beginning of `input` at the same level
+         */
+        bool matches(util::Block input, ValidationLevel level) const;
+
+        /**
+         * Continues a parser that has just parsed the header from the loaded state
+         *
+         * @return offset of the input where the validation continues
+         * @throw std::runtime_error if the state is not valid
+         */
+        uint64_t restore(ParserImpl & parser);
+
+        /**
+         * Writes the state of a parser that has read `input` up to `input_offset`, the beginning of its last line
+         *
+         * @throw std::runtime_error if it can't be written
+         */
+        void write(util::Block input, uint64_t input_offset, ValidationLevel level, ParserImpl const & parser);
+
+        std::string const & get_path() const;
+
+      private:
+        std::string path;
+
+        bool loaded;
+        uint64_t input_size;
+        uint64_t tail_checksum;
+        uint64_t level;
+        uint64_t input_offset;
+        std::istringstream state;   /**< Of the loaded parser */
+    };
+  }
+}
+
+#endif // VCF_CHECKPOINT_HPP
@@ -0,0 +1,55 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef VCF_CONTIG_TABLE_HPP
+#define VCF_CONTIG_TABLE_HPP
+
+#include <cstddef>
+#include <limits>
+#include <string>
+
+namespace ebi
+{
+  namespace vcf
+  {
+    /**
+     * Identifier of an interned contig name. The ids are dense, given in the order the names are first seen, so
+     * they can index vectors; and they are shared by all the parsers, so the parts of a file read separately can
+     * compare them.
+     */
+    using ContigId = size_t;
+
+    /**
+     * Id of a contig that has not been interned, like that of an empty record
+     */
+    ContigId const unknown_contig = std::numeric_limits<ContigId>::max();
+
+    /**
+     * Adds the contig name to the table of the program if it was not there yet. Can be called from several threads.
+     *
+     * @return id of the contig, valid until the end of the program
+     */
+    ContigId intern_contig(std::string const & name);
+
+    /**
+     * @return name of a contig returned by intern_contig
+     */
+    std::string const & contig_name(ContigId id);
+  }
+}
+
+#endif // VCF_CONTIG_TABLE_HPP
@@ -19,10 +19,13 @@
 
 
 #include <iostream>
+#include <map>
 #include <memory>
+#include <sstream>
 #include <vector>
 #include <stdexcept>
 
+#include "util/block_reader.hpp"
 #include "util/stream_utils.hpp"
 #include "vcf/fixer.hpp"
 #include "vcf/report_reader.hpp"
@@ -39,6 +42,75 @@ namespace ebi
       size_t fix_vcf_file(std::istream &input,
                         ebi::vcf::ReportReader &errorDAO,
                         std::ostream &output);
+
+      /**
+       * Walks the input and the errors, sorted by line, at the same time. Only the lines with errors are read one
+       * by one, the lines between them are copied in blocks. Each line is fixed with all its errors at once.
+       *
+       * @return number of errors that couldn't be fixed
+       */
+      size_t fix_vcf_file(util::BlockReader &input,
+                          ebi::vcf::ReportReader &errorDAO,
+                          std::ostream &output);
+
+      /**
+       * Fixes an input while it's being validated, instead of reading it again along with the report.
+       *
+       * The validator adds the text it parses and then the errors it found in it. Each line is held until no more
+       * errors can be reported for it, which may happen long after it was read if a later variant duplicates it.
+       * Then it's written with all its errors fixed at once, or copied as is if it had none.
+       */
+      class StreamingFixer
+      {
+        public:
+          static size_t const default_max_held_size = 64 * 1024 * 1024;
+
+          /**
+           * @param max_held_size bytes of input held before writing the lines even if they could still be
+           * reported as duplicated, which only happens with unsorted inputs
+           */
+          StreamingFixer(std::ostream &output, size_t max_held_size = default_max_held_size);
+
+          /**
+           * Appends the text that follows the one already added, which may end with an incomplete line
+           */
+          void add_input(char const * begin, char const * end);
+
+          /**
+           * Keeps a copy of the error to fix its line when it's written
+           */
+          void add_error(Error const &error);
+
+          /**
+           * Writes the lines before `line`, whose errors were all added
+           */
+          void write_until(size_t line);
+
+          /**
+           * Writes the rest of the input
+           *
+           * @return number of errors that couldn't be fixed
+           */
+          size_t finish();
+
+        private:
+          using LineErrors = std::multimap<size_t, std::unique_ptr<Error>>;
+
+          void write_line(size_t line_number, char const * begin, char const * end,
+                          LineErrors::iterator first_error, LineErrors::iterator last_error);
+
+          std::ostream &output;
+          Fixer fixer;
+          std::vector<char> line;
+          std::vector<Error *> line_errors;     ///< reused to fix each line with all its errors at once
+          size_t max_held_size;
+
+          std::vector<char> held;               ///< text from the start of first_held_line
+          std::vector<size_t> line_starts;      ///< offsets in `held` of each line, the last one may be incomplete
+          size_t first_held_line;
+          LineErrors errors;                    ///< of the held lines, in the order they were reported
+          size_t late_errors;                   ///< reported after their line was written
+      };
     }
   }
 }
@@ -0,0 +1,111 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VCF_DUPLICATE_FILTER_HPP
+#define VCF_DUPLICATE_FILTER_HPP
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "error.hpp"
+#include "normalizer.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+
+    /**
+     * Bloom filter of the variants forgotten by a cache of recent variants, to also find their duplicates further
+     * away with a few bytes per variant.
+     *
+     * A variant that the cache doesn't find is looked up in the filter, and if it may have been forgotten, it is
+     * kept as a suspect. The forgotten variants are only appended to a temporary file, which is read once at the end
+     * to confirm the suspects exactly: the false positives of the filter are discarded, and the duplicates are
+     * reported with the line where the variant first occurred.
+     */
+    class DuplicateFilter
+    {
+      public:
+        static constexpr double default_false_positive_rate = 0.01;
+
+        /**
+         * @param directory where the forgotten variants are written, to a temporary file removed along with the filter
+         * @param expected_variants variants that will be forgotten, to size the filter
+         * @param false_positive_rate of the filter with that many variants
+         * @throw std::invalid_argument if the rate is not between 0 and 1
+         * @throw std::runtime_error if the temporary file can't be created
+         */
+        DuplicateFilter(std::string const & directory,
+                        size_t expected_variants,
+                        double false_positive_rate = default_false_positive_rate);
+
+        DuplicateFilter(DuplicateFilter const &) = delete;
+        DuplicateFilter & operator=(DuplicateFilter const &) = delete;
+
+        ~DuplicateFilter();
+
+        /**
+         * Adds a variant that the cache forgot, with the hash the cache gave it
+         */
+        void forget(RecordCore const & record_core, uint64_t hash);
+
+        /**
+         * Keeps a variant that the cache didn't find duplicated, if it may be a duplicate of a forgotten one
+         */
+        void check(RecordCore const & record_core, uint64_t hash);
+
+        /**
+         * Errors of the suspects that are duplicates of a forgotten variant, in the order they were checked
+         *
+         * @throw std::runtime_error if the forgotten variants can't be read
+         */
+        std::vector<std::unique_ptr<Error>> find_duplicates();
+
+        /**
+         * Smallest line of the variants forgotten, which may still be reported as duplicated, or the maximum size_t
+         * if none was
+         */
+        size_t first_line() const;
+
+        /**
+         * Bytes taken by the filter and the suspects
+         */
+        size_t allocated_bytes() const;
+
+        size_t bit_count() const;
+
+        size_t hash_count() const;
+
+        size_t suspect_count() const;
+
+      private:
+        bool may_contain(uint64_t hash) const;
+
+        std::string path;
+        std::ofstream forgotten;
+        size_t first;   ///< line of the first variant forgotten
+        std::vector<uint64_t> bits;
+        size_t hashes;  ///< bits set per variant
+        std::vector<RecordCore> suspects;
+    };
+  }
+}
+
+#endif // VCF_DUPLICATE_FILTER_HPP
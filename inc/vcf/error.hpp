@@ -100,7 +100,7 @@ namespace ebi
      * Child classes may be used for more specific Errors. To add another error type, follow these steps:
      * - predeclare class before ErrorVisitor
      * - add a class at the end of this file
-     * - change its name, its parent, its message and its error code
+     * - change its name, its parent, its message and its error code, and the type returned by clone
      * - add a new method visit in ErrorVisitor
      */
     #pragma db object polymorphic
@@ -110,26 +110,73 @@ namespace ebi
 
         Error(size_t line) : Error{line, "Error, invalid file."} {}
 
-        Error(size_t line, const std::string &message, const std::string &detailed_message = "")
-                : runtime_error{std::string{"Line "} + std::to_string(line) + ": " + message
-                                    + (detailed_message != "" ? (". " + detailed_message) : "") + "."},
+        /**
+         * @param message_template: the message without its values, if it has some (see type_message)
+         */
+        Error(size_t line,
+              const std::string &message,
+              const std::string &detailed_message = "",
+              const std::string &message_template = "")
+                : runtime_error{""},
                   line{line},
                   message{message},
-                  detailed_message{detailed_message} {}
+                  detailed_message{detailed_message},
+                  message_template{message_template} {}
 
         virtual ~Error() override { }
 
         virtual void apply_visitor(ErrorVisitor &visitor) { visitor.visit(*this); }
+
+        /**
+         * Copy with the same dynamic type, for those who keep an error after the parser that reported it is cleared
+         */
+        virtual Error * clone() const { return new Error{*this}; }
+
         unsigned long get_id() const { return id_; }
 
+        /**
+         * Most errors are only counted, or grouped by their message, so the full description is not built until
+         * something prints it
+         */
+        virtual const char* what() const noexcept override
+        {
+            if (formatted_message.empty()) {
+                try {
+                    formatted_message = std::string{"Line "} + std::to_string(line) + ": " + message
+                                        + (detailed_message != "" ? (". " + detailed_message) : "") + ".";
+                } catch (std::exception &) {
+                    return message.c_str();
+                }
+            }
+            return formatted_message.c_str();
+        }
+
+        /**
+         * Message shared by all the errors of the same type, to group them: the message, unless it includes
+         * values like the name of a contig, and then its message_template
+         */
+        std::string const & type_message() const
+        {
+            return message_template.empty() ? message : message_template;
+        }
+
         const size_t line;
         const std::string message;
         const std::string detailed_message;
         Severity severity;
 
+        /**
+         * Message without its values, or empty if it has none
+         */
+        #pragma db transient
+        const std::string message_template;
+
       private:
         friend class odb::access;
 
+        #pragma db transient
+        mutable std::string formatted_message;
+
         #pragma db id auto
         unsigned long id_;
     };
@@ -157,6 +204,7 @@ namespace ebi
                 }
         virtual ~MetaSectionError() override { }
         virtual void apply_visitor(ErrorVisitor &visitor) override { visitor.visit(*this); }
+        virtual MetaSectionError * clone() const override { return new MetaSectionError{*this}; }
 
         ErrorFix error_fix;
         const std::string value;
@@ -171,6 +219,7 @@ namespace ebi
         HeaderSectionError(size_t line) : HeaderSectionError{line, "Error in header section"} { }
         virtual ~HeaderSectionError() override { }
         virtual void apply_visitor(ErrorVisitor &visitor) override { visitor.visit(*this); }
+        virtual HeaderSectionError * clone() const override { return new HeaderSectionError{*this}; }
     };
 
     #pragma db object
@@ -181,6 +230,7 @@ namespace ebi
         BodySectionError(size_t line) : BodySectionError{line, "Error in body section"} { }
         virtual ~BodySectionError() override { }
         virtual void apply_visitor(ErrorVisitor &visitor) override { visitor.visit(*this); }
+        virtual BodySectionError * clone() const override { return new BodySectionError{*this}; }
     };
 
     #pragma db object
@@ -188,10 +238,12 @@ namespace ebi
     {
       public:
         NoMetaDefinitionError(size_t line,
-                              const std::string &message)
-                : Error{line, message} {}
+                              const std::string &message,
+                              const std::string &message_template = "")
+                : Error{line, message, "", message_template} {}
         virtual ~NoMetaDefinitionError() override { }
         virtual void apply_visitor(ErrorVisitor &visitor) override { visitor.visit(*this); }
+        virtual NoMetaDefinitionError * clone() const override { return new NoMetaDefinitionError{*this}; }
       private:
         friend class odb::access;
         NoMetaDefinitionError() {}
@@ -206,6 +258,7 @@ namespace ebi
         FileformatError(size_t line) : FileformatError{line, "Error in file format section"} { }
         virtual ~FileformatError() override { }
         virtual void apply_visitor(ErrorVisitor &visitor) override { visitor.visit(*this); }
+        virtual FileformatError * clone() const override { return new FileformatError{*this}; }
     };
 
     #pragma db object
@@ -217,6 +270,7 @@ namespace ebi
             "Chromosome is not a string without colons or whitespaces, optionally wrapped with angle brackets (<>)"} { }
         virtual ~ChromosomeBodyError() override { }
         virtual void apply_visitor(ErrorVisitor &visitor) override { visitor.visit(*this); }
+        virtual ChromosomeBodyError * clone() const override { return new ChromosomeBodyError{*this}; }
     };
 
     #pragma db object
@@ -227,6 +281,7 @@ namespace ebi
         PositionBodyError(size_t line) : PositionBodyError{line, "Position is not a positive number"} { }
         virtual ~PositionBodyError() override { }
         virtual void apply_visitor(ErrorVisitor &visitor) override { visitor.visit(*this); }
+        virtual PositionBodyError * clone() const override { return new PositionBodyError{*this}; }
     };
     #pragma db object
     struct IdBodyError : public BodySectionError
@@ -237,6 +292,7 @@ namespace ebi
                 : BodySectionError{line, message}, error_fix{error_fix} { }
         virtual ~IdBodyError() override { }
         virtual void apply_visitor(ErrorVisitor &visitor) override { visitor.visit(*this); }
+        virtual IdBodyError * clone() const override { return new IdBodyError{*this}; }
 
         ErrorFix error_fix;
     };
@@ -248,6 +304,7 @@ namespace ebi
         ReferenceAlleleBodyError(size_t line) : ReferenceAlleleBodyError{line, "Reference is not a string of bases"} { }
         virtual ~ReferenceAlleleBodyError() override { }
         virtual void apply_visitor(ErrorVisitor &visitor) override { visitor.visit(*this); }
+        virtual ReferenceAlleleBodyError * clone() const override { return new ReferenceAlleleBodyError{*this}; }
     };
     #pragma db object
     struct AlternateAllelesBodyError : public BodySectionError
@@ -257,6 +314,7 @@ namespace ebi
         AlternateAllelesBodyError(size_t line) : AlternateAllelesBodyError{line, "Alternate is not a single dot or a comma-separated list of bases"} { }
         virtual ~AlternateAllelesBodyError() override { }
         virtual void apply_visitor(ErrorVisitor &visitor) override { visitor.visit(*this); }
+        virtual AlternateAllelesBodyError * clone() const override { return new AlternateAllelesBodyError{*this}; }
     };
     #pragma db object
     struct QualityBodyError : public BodySectionError
@@ -266,6 +324,7 @@ namespace ebi
         QualityBodyError(size_t line) : QualityBodyError{line, "Quality is not a single dot or a positive number"} { }
         virtual ~QualityBodyError() override { }
         virtual void apply_visitor(ErrorVisitor &visitor) override { visitor.visit(*this); }
+        virtual QualityBodyError * clone() const override { return new QualityBodyError{*this}; }
     };
     #pragma db object
     struct FilterBodyError : public BodySectionError
@@ -277,6 +336,7 @@ namespace ebi
                 : BodySectionError{line, message}, error_fix{error_fix}, field{field} { }
         virtual ~FilterBodyError() override { }
         virtual void apply_visitor(ErrorVisitor &visitor) override { visitor.visit(*this); }
+        virtual FilterBodyError * clone() const override { return new FilterBodyError{*this}; }
 
         ErrorFix error_fix;
         const std::string field;
@@ -297,6 +357,7 @@ namespace ebi
                 }
         virtual ~InfoBodyError() override { }
         virtual void apply_visitor(ErrorVisitor &visitor) override { visitor.visit(*this); }
+        virtual InfoBodyError * clone() const override { return new InfoBodyError{*this}; }
 
         ErrorFix error_fix;
         const std::string field;
@@ -311,6 +372,7 @@ namespace ebi
                 : BodySectionError{line, message}, error_fix{error_fix} { }
         virtual ~FormatBodyError() override { }
         virtual void apply_visitor(ErrorVisitor &visitor) override { visitor.visit(*this); }
+        virtual FormatBodyError * clone() const override { return new FormatBodyError{*this}; }
 
         ErrorFix error_fix;
     };
@@ -322,6 +384,7 @@ namespace ebi
         SamplesBodyError(size_t line) : SamplesBodyError{line, "Error in samples columns, in body section"} { }
         virtual ~SamplesBodyError() override { }
         virtual void apply_visitor(ErrorVisitor &visitor) override { visitor.visit(*this); }
+        virtual SamplesBodyError * clone() const override { return new SamplesBodyError{*this}; }
     };
     #pragma db object
     struct SamplesFieldBodyError : public BodySectionError
@@ -331,8 +394,10 @@ namespace ebi
                               const std::string &message,
                               const std::string &detailed_message,
                               const std::string &field,
-                              long field_cardinality = -1)
-                : BodySectionError{line, message, detailed_message}, field{field}, field_cardinality{field_cardinality} {
+                              long field_cardinality = -1,
+                              const std::string &message_template = "")
+                : BodySectionError{line, message, detailed_message, message_template}, field{field},
+                  field_cardinality{field_cardinality} {
             if (field.empty()) {
                 throw std::invalid_argument{"SamplesFieldBodyError: field should not be an empty string. Use "
                                                     "SamplesBodyError for unknown errors in the samples columns"};
@@ -340,6 +405,7 @@ namespace ebi
         }
         virtual ~SamplesFieldBodyError() override { }
         virtual void apply_visitor(ErrorVisitor &visitor) override { visitor.visit(*this); }
+        virtual SamplesFieldBodyError * clone() const override { return new SamplesFieldBodyError{*this}; }
 
         std::string field;
         long field_cardinality;    // [0, inf): valid number of values. -1: unknown amount of values
@@ -355,15 +421,21 @@ namespace ebi
         NormalizationError(size_t line) : NormalizationError{line, "Allele normalization could not be performed"} { }
         virtual ~NormalizationError() override { }
         virtual void apply_visitor(ErrorVisitor &visitor) override { visitor.visit(*this); }
+        virtual NormalizationError * clone() const override { return new NormalizationError{*this}; }
     };
     #pragma db object
     struct DuplicationError : public BodySectionError
     {
-        using BodySectionError::BodySectionError;
-        DuplicationError() : DuplicationError{0} {}
-        DuplicationError(size_t line) : DuplicationError{line, "A duplicated variant was found"} { }
+        /**
+         * Every duplicated variant is an error of the same type, whatever the variant in the message
+         */
+        DuplicationError(size_t line = 0,
+                         const std::string &message = "A duplicated variant was found",
+                         const std::string &detailed_message = "")
+                : BodySectionError{line, message, detailed_message, "A duplicated variant was found"} { }
         virtual ~DuplicationError() override { }
         virtual void apply_visitor(ErrorVisitor &visitor) override { visitor.visit(*this); }
+        virtual DuplicationError * clone() const override { return new DuplicationError{*this}; }
     };
   }
 }
@@ -28,7 +28,7 @@ namespace ebi
   {
     
     /**
-     * Error management policy that aborts execution when an error is found
+     * Error management policy that aborts execution when an error is found, throwing it with its dynamic type
      */
     class AbortErrorPolicy
     {
@@ -0,0 +1,35 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VCF_ERROR_THROWER_HPP
+#define VCF_ERROR_THROWER_HPP
+
+#include "error.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    /**
+     * Throws a pointer to the error with its dynamic type, like the `throw new XxxError{...}` that would have
+     * created it. Checks that return their errors use it where the caller expects them to be thrown, so they can
+     * still be caught as `XxxError *`.
+     */
+    [[noreturn]] void throw_error(Error * error);
+  }
+}
+
+#endif // VCF_ERROR_THROWER_HPP
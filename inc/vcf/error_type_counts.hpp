@@ -0,0 +1,70 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VCF_ERROR_TYPE_COUNTS_HPP
+#define VCF_ERROR_TYPE_COUNTS_HPP
+
+#include <cstddef>
+#include <istream>
+#include <map>
+#include <ostream>
+#include <tuple>
+#include <typeindex>
+#include <unordered_map>
+
+#include "vcf/error.hpp"
+#include "vcf/message_table.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    /**
+     * Number of errors or warnings seen of each type, to keep only the first ones of each. Two errors are of the
+     * same type if they have the same severity, class and message without values (see Error::type_message), so
+     * the duplicated variants or the undefined contigs are one type each, whatever their values.
+     */
+    class ErrorTypeCounts
+    {
+      public:
+        /**
+         * Counts an error or warning, unless `max` of its type were counted already
+         *
+         * @return whether it was counted
+         */
+        bool add(Severity severity, Error const & error, size_t max);
+
+        void clear();
+
+        /**
+         * Writes the counts so that load can read them back, naming the types instead of using their ids
+         */
+        void save(std::ostream & checkpoint) const;
+        void load(std::istream & checkpoint);
+
+      private:
+        using Type = std::tuple<Severity, MessageId, MessageId>;    // severity, class and message template
+
+        MessageId class_id(Error const & error);
+
+        MessageTable messages;                                      // names of the classes and message templates
+        std::unordered_map<std::type_index, MessageId> class_ids;   // to name each class only once
+        std::map<Type, size_t> counts;
+    };
+  }
+}
+
+#endif // VCF_ERROR_TYPE_COUNTS_HPP
@@ -0,0 +1,122 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VCF_EXTERNAL_RECORD_CACHE_HPP
+#define VCF_EXTERNAL_RECORD_CACHE_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "error.hpp"
+#include "file_structure.hpp"
+#include "normalizer.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+
+    /**
+     * Alternative to the caches of recent variants that finds every duplicate of the input exactly, with bounded
+     * memory, by sorting all its variants externally.
+     *
+     * The normalized variants are kept in memory until there are `run_capacity`, and then sorted and written to a
+     * temporary file as a run. Once the whole input has been read, the runs are merged (in several passes if there
+     * are too many to open at once), so the occurrences of each variant come together in the order they were read.
+     * The duplicates are reported like an unlimited RecordCache would have done, only at the end.
+     */
+    class ExternalRecordCache
+    {
+      public:
+        static size_t const default_run_capacity = 256 * 1024;
+
+        /**
+         * Most runs merged at once
+         */
+        static size_t const max_merged_runs = 64;
+
+        /**
+         * @param directory where the runs are written, as temporary files removed along with the cache
+         * @param run_capacity variants sorted in memory before they are written as a run
+         */
+        ExternalRecordCache(std::string const & directory, size_t run_capacity = default_run_capacity);
+
+        ExternalRecordCache(ExternalRecordCache const &) = delete;
+        ExternalRecordCache & operator=(ExternalRecordCache const &) = delete;
+
+        ~ExternalRecordCache();
+
+        /**
+         * Keeps the variants of a record, normalized in `alleles`, to compare them with all the others at the end
+         *
+         * @throw std::runtime_error if a run can't be written
+         */
+        void add(Record const & record, std::vector<NormalizedAllele> const & alleles);
+
+        /**
+         * Errors of all the duplicated variants added, sorted by the line where an unlimited RecordCache would have
+         * reported them. The variants are forgotten.
+         *
+         * @throw std::runtime_error if the runs can't be read or written
+         */
+        std::vector<std::unique_ptr<Error>> find_duplicates();
+
+        /**
+         * Smallest line of the variants added, or the maximum size_t if none was
+         */
+        size_t first_line() const;
+
+        /**
+         * Approximate bytes taken by the variants not written yet
+         */
+        size_t allocated_bytes() const;
+
+        /**
+         * Number of runs written so far
+         */
+        size_t written_runs() const;
+
+      private:
+        struct Variant
+        {
+            RecordCore record_core;
+            size_t allele;      ///< order of the variant in its record
+        };
+
+        static bool read_order(Variant const & a, Variant const & b);
+
+        std::string new_run_path() const;
+
+        void write_run();
+
+        /**
+         * Merges some runs into a new one, removing them
+         *
+         * @return path of the new run
+         */
+        std::string merge_runs(std::vector<std::string> const & merged);
+
+        std::string directory;
+        size_t run_capacity;
+        std::vector<Variant> variants;      ///< not written to a run yet
+        std::vector<std::string> runs;
+        size_t first;                       ///< line of the first variant added
+    };
+  }
+}
+
+#endif // VCF_EXTERNAL_RECORD_CACHE_HPP
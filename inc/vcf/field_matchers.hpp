@@ -0,0 +1,137 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VCF_FIELD_MATCHERS_HPP
+#define VCF_FIELD_MATCHERS_HPP
+
+#include <algorithm>
+#include <string>
+
+namespace ebi
+{
+  namespace vcf
+  {
+    /**
+     * Set of characters, tested with a lookup table
+     */
+    class CharClass
+    {
+      public:
+        template<typename Predicate>
+        explicit CharClass(Predicate predicate)
+        {
+            for (int c = 0; c < 256; ++c) {
+                table[c] = predicate(static_cast<unsigned char>(c));
+            }
+        }
+
+        bool contains(char c) const
+        {
+            return table[static_cast<unsigned char>(c)];
+        }
+
+        /**
+         * @return true if `s` is not empty and all its characters belong to the class
+         */
+        bool matches(std::string const & s) const
+        {
+            return matches(s.data(), s.data() + s.size());
+        }
+
+        bool matches(char const * begin, char const * end) const
+        {
+            return begin != end && std::all_of(begin, end, [this](char c) { return contains(c); });
+        }
+
+      private:
+        bool table[256];
+    };
+
+    /**
+     * The matchers below are equivalent to regular expressions that were run for every record. They are written
+     * by hand because boost::regex has a significant cost per match, even with such simple patterns. The
+     * character classes only use ASCII, like a regex with the "C" locale.
+     */
+
+    /**
+     * Equivalent to the regex `[ACGTN]+`, case insensitive
+     */
+    inline bool is_bases(std::string const & s)
+    {
+        static CharClass const bases{[](unsigned char c) {
+            return std::string{"ACGTNacgtn"}.find(static_cast<char>(c)) != std::string::npos;
+        }};
+        return bases.matches(s);
+    }
+
+    /**
+     * Equivalent to the regex `<([a-zA-Z0-9:_]+)>`, like the symbolic alleles <DEL> or <DUP:TANDEM>
+     */
+    inline bool is_symbolic_allele(std::string const & s)
+    {
+        static CharClass const id_chars{[](unsigned char c) {
+            return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == ':' || c == '_';
+        }};
+        return s.size() > 2 && s.front() == '<' && s.back() == '>'
+               && id_chars.matches(s.data() + 1, s.data() + s.size() - 1);
+    }
+
+    /**
+     * ID of an allele accepted by is_symbolic_allele, without the angle brackets
+     */
+    inline std::string symbolic_allele_id(std::string const & s)
+    {
+        return s.substr(1, s.size() - 2);
+    }
+
+    /**
+     * Equivalent to the regex `((?![,;=])[[:print:]])+`: printable characters except the separators of INFO
+     */
+    inline bool is_printable_without_separators(std::string const & s)
+    {
+        static CharClass const printable{[](unsigned char c) {
+            return c >= ' ' && c <= '~' && c != ',' && c != ';' && c != '=';
+        }};
+        return printable.matches(s);
+    }
+
+    /**
+     * Equivalent to the regex `([0-9]+[MIDNSHPX])+`, a CIGAR string as defined by the SAM specification
+     */
+    inline bool is_cigar(std::string const & s)
+    {
+        static CharClass const operations{[](unsigned char c) {
+            return std::string{"MIDNSHPX"}.find(static_cast<char>(c)) != std::string::npos;
+        }};
+
+        size_t i = 0;
+        while (i < s.size()) {
+            size_t digits = 0;
+            while (i < s.size() && s[i] >= '0' && s[i] <= '9') {
+                ++i;
+                ++digits;
+            }
+            if (digits == 0 || i == s.size() || !operations.contains(s[i])) {
+                return false;
+            }
+            ++i;
+        }
+        return !s.empty();
+    }
+  }
+}
+
+#endif // VCF_FIELD_MATCHERS_HPP
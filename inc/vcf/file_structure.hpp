@@ -19,25 +19,36 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <map>
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <boost/variant.hpp>
 
 #include "util/stream_utils.hpp"
+#include "vcf/contig_table.hpp"
 #include "vcf/error.hpp"
+#include "vcf/sample_index.hpp"
 #include "vcf/string_constants.hpp"
 
 namespace ebi
 {
+  namespace util
+  {
+    class WorkerPool;
+  }
+
   namespace vcf
   {
     struct Source;
     struct MetaEntry;
     struct Record;
+    class Profile;
     
     typedef std::multimap<std::string, MetaEntry>::iterator meta_iterator;
 
@@ -57,6 +68,17 @@ namespace ebi
         v43 
     };
     
+    /**
+     * Checks of a record on its own that Record::validate can run, besides the syntax of its line that the parser
+     * always checks
+     */
+    enum RecordChecks
+    {
+        RECORD_CHECK_FIELDS     = 0x01,     /**< The columns from CHROM to FORMAT */
+        RECORD_CHECK_SAMPLES    = 0x02,     /**< Each sample, against the FORMAT column and the meta section */
+        RECORD_CHECK_ALL        = RECORD_CHECK_FIELDS | RECORD_CHECK_SAMPLES,
+    };
+
     enum class RecordType
     {
         SNV,
@@ -67,156 +89,6 @@ namespace ebi
         NO_VARIATION
     };
 
-    const std::map<std::string, std::pair<std::string, std::string>> info_v41_v42 = {
-            { AA, { STRING, "1" } },
-            { AC, { INTEGER, A } },
-            { AF, { FLOAT, A } },
-            { AN, { INTEGER, "1" } },
-            { BKPTID, { STRING, UNKNOWN_CARDINALITY } },
-            { BQ, { FLOAT, "1" } },
-            { CICN, { INTEGER, "2" } },
-            { CICNADJ, { INTEGER, UNKNOWN_CARDINALITY } },
-            { CIEND, { INTEGER, "2" } },
-            { CIGAR, { STRING, A } },
-            { CILEN, { INTEGER, "2" } },
-            { CIPOS, { INTEGER, "2" } },
-            { CN, { INTEGER, "1" } },
-            { CNADJ, { INTEGER, UNKNOWN_CARDINALITY } },
-            { DB, { FLAG, "0" } },
-            { DBRIPID, { STRING, "1" } },
-            { DBVARID, { STRING, "1" } },
-            { DGVID, { STRING, "1" } },
-            { DP, { INTEGER, "1" } },
-            { DPADJ, { INTEGER, UNKNOWN_CARDINALITY } },
-            { END, { INTEGER, "1" } },
-            { EVENT, { STRING, "1" } },
-            { HOMLEN, { INTEGER, UNKNOWN_CARDINALITY } },
-            { HOMSEQ, { STRING, UNKNOWN_CARDINALITY } },
-            { H2, { FLAG, "0" } },
-            { H3, { FLAG, "0" } },
-            { IMPRECISE, { FLAG, "0" } },
-            { MATEID, { STRING, UNKNOWN_CARDINALITY } },
-            { MEINFO, { STRING, "4" } },
-            { METRANS, { STRING, "4" } },
-            { MQ, { MISSING_VALUE, "1" } },
-            { MQ0, { INTEGER, "1" } },
-            { NOVEL, { FLAG, "0" } },
-            { NS, { INTEGER, "1" } },
-            { PARID, { STRING, "1" } },
-            // TODO : SB metadata Type and Number is "."
-            { SOMATIC, { FLAG, "0" } },
-            { SVLEN, { INTEGER, UNKNOWN_CARDINALITY } },
-            { SVTYPE, { STRING, "1" } },
-            { VALIDATED, { FLAG, "0" } },
-            { THOUSAND_G, { FLAG, "0" } }
-    };
-
-    const std::map<std::string, std::pair<std::string, std::string>> info_v43 = {
-            { AA, { STRING, "1" } },
-            { AC, { INTEGER, A } },
-            { AD, { INTEGER, R } },
-            { ADF, { INTEGER, R } },
-            { ADR, { INTEGER, R } },
-            { AF, { FLOAT, A } },
-            { AN, { INTEGER, "1" } },
-            { BKPTID, { STRING, UNKNOWN_CARDINALITY } },
-            { BQ, { FLOAT, "1" } },
-            { CICN, { INTEGER, "2" } },
-            { CICNADJ, { INTEGER, UNKNOWN_CARDINALITY } },
-            { CIEND, { INTEGER, "2" } },
-            { CIGAR, { STRING, A } },
-            { CILEN, { INTEGER, "2" } },
-            { CIPOS, { INTEGER, "2" } },
-            { CN, { INTEGER, "1" } },
-            { CNADJ, { INTEGER, UNKNOWN_CARDINALITY } },
-            { DB, { FLAG, "0" } },
-            { DBRIPID, { STRING, "1" } },
-            { DBVARID, { STRING, "1" } },
-            { DGVID, { STRING, "1" } },
-            { DP, { INTEGER, "1" } },
-            { DPADJ, { INTEGER, UNKNOWN_CARDINALITY } },
-            { END, { INTEGER, "1" } },
-            { EVENT, { STRING, "1" } },
-            { HOMLEN, { INTEGER, UNKNOWN_CARDINALITY } },
-            { HOMSEQ, { STRING, UNKNOWN_CARDINALITY } },
-            { H2, { FLAG, "0" } },
-            { H3, { FLAG, "0" } },
-            { IMPRECISE, { FLAG, "0" } },
-            { MATEID, { STRING, UNKNOWN_CARDINALITY } },
-            { MEINFO, { STRING, "4" } },
-            { METRANS, { STRING, "4" } },
-            { MQ, { MISSING_VALUE, "1" } },
-            { MQ0, { INTEGER, "1" } },
-            { NOVEL, { FLAG, "0" } },
-            { NS, { INTEGER, "1" } },
-            { PARID, { STRING, "1" } },
-            // TODO : SB metadata Type and Number is "."
-            { SOMATIC, { FLAG, "0" } },
-            { SVLEN, { INTEGER, UNKNOWN_CARDINALITY } },
-            { SVTYPE, { STRING, "1" } },
-            { VALIDATED, { FLAG, "0" } },
-            { THOUSAND_G, { FLAG, "0" } }
-    };
-
-    const std::map<std::string, std::pair<std::string, std::string>> format_v41_v42 = {
-            { AHAP, { INTEGER, "1" } },
-            { CN, { INTEGER, "1" } },
-            { CNL, { FLOAT, UNKNOWN_CARDINALITY } },
-            { CNQ, { FLOAT, "1" } },
-            { DP, { INTEGER, "1" } },
-            { EC, { INTEGER, A } },
-            { FT, { STRING, "1" } },
-            { GL, { FLOAT, G } },
-            { GLE, { STRING, G } },
-            { GP, { FLOAT, G } },
-            { GQ, { INTEGER, "1" } },
-            { GT, { STRING, "1" } },
-            { HAP, { INTEGER, "1" } },
-            { HQ, { INTEGER, "2" } },
-            { MQ, { INTEGER, "1" } },
-            { NQ, { INTEGER, "1" } },
-            { PL, { INTEGER, G } },
-            { PQ, { INTEGER, "1" } },
-            { PS, { INTEGER, "1" } }
-    };
-
-    const std::map<std::string, std::pair<std::string, std::string>> format_v43 = {
-            { AD, { INTEGER, R } },
-            { ADF, { INTEGER, R } },
-            { ADR, { INTEGER, R } },
-            { AHAP, { INTEGER, "1" } },
-            { CN, { INTEGER, "1" } },
-            { CNL, { FLOAT, G } },
-            { CNP, { FLOAT, G } },
-            { CNQ, { FLOAT, "1" } },
-            { DP, { INTEGER, "1" } },
-            { EC, { INTEGER, A } },
-            { FT, { STRING, "1" } },
-            { GL, { FLOAT, G } },
-            { GP, { FLOAT, G } },
-            { GQ, { INTEGER, "1" } },
-            { GT, { STRING, "1" } },
-            { HAP, { INTEGER, "1" } },
-            { HQ, { INTEGER, "2" } },
-            { MQ, { INTEGER, "1" } },
-            { NQ, { INTEGER, "1" } },
-            { PL, { INTEGER, G } },
-            { PQ, { INTEGER, "1" } },
-            { PS, { INTEGER, "1" } }
-    };
-
-    inline std::string const &get_predefined_type(
-            std::map<std::string, std::pair<std::string, std::string>>::const_iterator const &predefined_tag)
-    {
-        return predefined_tag->second.first;
-    }
-
-    inline std::string const &get_predefined_number(
-            std::map<std::string, std::pair<std::string, std::string>>::const_iterator const &predefined_tag)
-    {
-        return predefined_tag->second.second;
-    }
-
     struct MetaEntry
     {
         enum class Structure { NoValue, PlainValue, KeyValue };
@@ -237,12 +109,12 @@ namespace ebi
         
         MetaEntry(size_t line,
                   std::string const & id,
-                  std::string const & plain_value,
+                  std::string plain_value,
                   std::shared_ptr<Source> source);
         
         MetaEntry(size_t line,
                   std::string const & id,
-                  std::map<std::string, std::string> const & key_values,
+                  std::map<std::string, std::string> key_values,
                   std::shared_ptr<Source> source);
         
         bool operator==(MetaEntry const &) const;
@@ -260,6 +132,420 @@ namespace ebi
         void check_value();
     };
     
+    /**
+     * Properties of a meta entry that are used to validate the body. Number and Type are empty if the entry
+     * doesn't specify them.
+     */
+    struct FieldDescriptor
+    {
+        std::string id;
+        std::string number;
+        std::string type;
+    };
+
+    /**
+     * Index of the key-value meta entries by type and ID, to avoid scanning the meta section for every record.
+     * When several entries have the same type and ID, the first one is used, like in a scan of the meta section.
+     */
+    class HeaderSchema
+    {
+      public:
+        void build(std::multimap<std::string, MetaEntry> const & meta_entries);
+
+        /**
+         * @return the entry of the given type (INFO, FORMAT, FILTER, contig...) and ID, or nullptr if not found
+         */
+        FieldDescriptor const * find(std::string const & meta_type, std::string const & id) const;
+
+      private:
+        std::unordered_map<std::string, std::unordered_map<std::string, FieldDescriptor>> m_entries;
+    };
+
+    /**
+     * Number of values of a field, parsed from its Number once instead of for every value checked
+     */
+    struct Cardinality
+    {
+        enum class Kind : unsigned char
+        {
+            FIXED,      /**< A non-negative number, in `value` */
+            A,          /**< One value per alternate allele */
+            R,          /**< One value per allele, the reference included */
+            G,          /**< One value per possible genotype */
+            UNKNOWN,    /**< "." */
+            INVALID
+        };
+
+        Kind kind;
+        long value;
+
+        /**
+         * @param number one of ["A", "R", "G", ".", <non-negative number>], anything else is INVALID
+         */
+        static Cardinality parse(std::string const & number);
+    };
+
+    /**
+     * Type of the values of a tag predefined by the specification
+     */
+    enum class PredefinedType : unsigned char
+    {
+        INTEGER,
+        FLOAT,
+        FLAG,
+        STRING,
+        ANY         /**< "." in the specification, any Type is accepted */
+    };
+
+    /**
+     * @return the Type of a meta entry that matches the predefined one, or "." for ANY
+     */
+    inline std::string const & type_name(PredefinedType type)
+    {
+        switch (type) {
+            case PredefinedType::INTEGER:
+                return INTEGER;
+            case PredefinedType::FLOAT:
+                return FLOAT;
+            case PredefinedType::FLAG:
+                return FLAG;
+            case PredefinedType::STRING:
+                return STRING;
+            default:
+                return MISSING_VALUE;
+        }
+    }
+
+    /**
+     * Type and Number of an INFO or FORMAT tag predefined by the specification
+     */
+    struct PredefinedTag
+    {
+        char const * id;
+        size_t id_size;
+        PredefinedType type;
+        char const * number;        /**< As written in the Number of a meta entry */
+        Cardinality cardinality;    /**< The Number, parsed */
+    };
+
+    /**
+     * Slots of the hash table of a PredefinedTagTable, which must be more than twice its tags for a seed without
+     * collisions to be easy to find
+     */
+    size_t const predefined_tag_slots = 256;
+
+    /**
+     * Slot without a tag
+     */
+    unsigned char const no_predefined_tag = 255;
+
+    /**
+     * Predefined tags of a version, with a perfect hash table built at compile time: every tag has a slot of its
+     * own, so a lookup hashes the ID once and compares it only with the tag in its slot. The table is constant,
+     * so it doesn't allocate nor run anything at startup.
+     */
+    struct PredefinedTagTable
+    {
+        PredefinedTag const * tags;
+        size_t size;
+        uint32_t seed;
+        unsigned char slots[predefined_tag_slots];  /**< Index of the tag hashed to each slot, or no_predefined_tag */
+
+        /**
+         * @return the tag with the given ID, or nullptr if it is not predefined
+         */
+        PredefinedTag const * find(std::string const & id) const;
+
+        PredefinedTag const * begin() const { return tags; }
+        PredefinedTag const * end() const { return tags + size; }
+    };
+
+    namespace detail
+    {
+      /**
+       * FNV-1a hash of an ID, starting from the seed instead of the usual offset basis, reduced to a slot
+       */
+      constexpr size_t predefined_tag_slot(char const * id, size_t size, uint32_t hash)
+      {
+          return size == 0 ? hash % predefined_tag_slots
+                           : predefined_tag_slot(id + 1, size - 1,
+                                                 (hash ^ static_cast<unsigned char>(*id)) * uint32_t{16777619});
+      }
+
+      constexpr long parse_fixed_number(char const * number, long value)
+      {
+          return *number == '\0' ? value : parse_fixed_number(number + 1, value * 10 + (*number - '0'));
+      }
+
+      template <size_t N>
+      constexpr PredefinedTag predefined_tag(char const (&id)[N], PredefinedType type, char const * number)
+      {
+          return PredefinedTag{id, N - 1, type, number,
+                  number[0] == 'A' ? Cardinality{Cardinality::Kind::A, 0}
+                  : number[0] == 'R' ? Cardinality{Cardinality::Kind::R, 0}
+                  : number[0] == 'G' ? Cardinality{Cardinality::Kind::G, 0}
+                  : number[0] == '.' ? Cardinality{Cardinality::Kind::UNKNOWN, 0}
+                  : Cardinality{Cardinality::Kind::FIXED, parse_fixed_number(number, 0)}};
+      }
+
+      /**
+       * Index of the first tag from `i` whose ID is hashed to `slot`
+       */
+      constexpr unsigned char tag_in_slot(PredefinedTag const * tags, size_t size, uint32_t seed, size_t slot,
+                                          size_t i)
+      {
+          return i == size ? no_predefined_tag
+                 : predefined_tag_slot(tags[i].id, tags[i].id_size, seed) == slot ? static_cast<unsigned char>(i)
+                 : tag_in_slot(tags, size, seed, slot, i + 1);
+      }
+
+      template <size_t... I> struct Slots { };
+      template <size_t N, size_t... I> struct MakeSlots : MakeSlots<N - 1, N - 1, I...> { };
+      template <size_t... I> struct MakeSlots<0, I...> : Slots<I...> { };
+
+      template <size_t N, size_t... I>
+      constexpr PredefinedTagTable predefined_tag_table(PredefinedTag const (&tags)[N], uint32_t seed, Slots<I...>)
+      {
+          return PredefinedTagTable{tags, N, seed, {tag_in_slot(tags, N, seed, I, 0)...}};
+      }
+
+      /**
+       * Whether the tags from `i` are the ones in their slots, which they aren't if they collide with a previous tag
+       */
+      constexpr bool has_slots_from(PredefinedTagTable const & table, size_t i)
+      {
+          return i == table.size
+                 || (table.slots[predefined_tag_slot(table.tags[i].id, table.tags[i].id_size, table.seed)] == i
+                     && has_slots_from(table, i + 1));
+      }
+    }
+
+    /**
+     * @param seed of the hash, chosen so that no tags collide
+     */
+    template <size_t N>
+    constexpr PredefinedTagTable predefined_tag_table(PredefinedTag const (&tags)[N], uint32_t seed)
+    {
+        static_assert(N < no_predefined_tag, "Too many predefined tags for the index of a slot");
+        return detail::predefined_tag_table(tags, seed, detail::MakeSlots<predefined_tag_slots>{});
+    }
+
+    /**
+     * Whether every tag has a slot of its own
+     */
+    constexpr bool is_perfect(PredefinedTagTable const & table)
+    {
+        return detail::has_slots_from(table, 0);
+    }
+
+    inline PredefinedTag const * PredefinedTagTable::find(std::string const & id) const
+    {
+        unsigned char slot = slots[detail::predefined_tag_slot(id.data(), id.size(), seed)];
+        if (slot == no_predefined_tag) {
+            return nullptr;
+        }
+        PredefinedTag const & tag = tags[slot];
+        bool found = tag.id_size == id.size() && std::memcmp(tag.id, id.data(), id.size()) == 0;
+        return found ? &tag : nullptr;
+    }
+
+    // The tables are sorted by ID, so they are listed in the same order as std::map used to
+    constexpr PredefinedTag info_v41_v42_tags[] = {
+            detail::predefined_tag("1000G", PredefinedType::FLAG, "0"),
+            detail::predefined_tag("AA", PredefinedType::STRING, "1"),
+            detail::predefined_tag("AC", PredefinedType::INTEGER, "A"),
+            detail::predefined_tag("AF", PredefinedType::FLOAT, "A"),
+            detail::predefined_tag("AN", PredefinedType::INTEGER, "1"),
+            detail::predefined_tag("BKPTID", PredefinedType::STRING, "."),
+            detail::predefined_tag("BQ", PredefinedType::FLOAT, "1"),
+            detail::predefined_tag("CICN", PredefinedType::INTEGER, "2"),
+            detail::predefined_tag("CICNADJ", PredefinedType::INTEGER, "."),
+            detail::predefined_tag("CIEND", PredefinedType::INTEGER, "2"),
+            detail::predefined_tag("CIGAR", PredefinedType::STRING, "A"),
+            detail::predefined_tag("CILEN", PredefinedType::INTEGER, "2"),
+            detail::predefined_tag("CIPOS", PredefinedType::INTEGER, "2"),
+            detail::predefined_tag("CN", PredefinedType::INTEGER, "1"),
+            detail::predefined_tag("CNADJ", PredefinedType::INTEGER, "."),
+            detail::predefined_tag("DB", PredefinedType::FLAG, "0"),
+            detail::predefined_tag("DBRIPID", PredefinedType::STRING, "1"),
+            detail::predefined_tag("DBVARID", PredefinedType::STRING, "1"),
+            detail::predefined_tag("DGVID", PredefinedType::STRING, "1"),
+            detail::predefined_tag("DP", PredefinedType::INTEGER, "1"),
+            detail::predefined_tag("DPADJ", PredefinedType::INTEGER, "."),
+            detail::predefined_tag("END", PredefinedType::INTEGER, "1"),
+            detail::predefined_tag("EVENT", PredefinedType::STRING, "1"),
+            detail::predefined_tag("H2", PredefinedType::FLAG, "0"),
+            detail::predefined_tag("H3", PredefinedType::FLAG, "0"),
+            detail::predefined_tag("HOMLEN", PredefinedType::INTEGER, "."),
+            detail::predefined_tag("HOMSEQ", PredefinedType::STRING, "."),
+            detail::predefined_tag("IMPRECISE", PredefinedType::FLAG, "0"),
+            detail::predefined_tag("MATEID", PredefinedType::STRING, "."),
+            detail::predefined_tag("MEINFO", PredefinedType::STRING, "4"),
+            detail::predefined_tag("METRANS", PredefinedType::STRING, "4"),
+            detail::predefined_tag("MQ", PredefinedType::ANY, "1"),
+            detail::predefined_tag("MQ0", PredefinedType::INTEGER, "1"),
+            detail::predefined_tag("NOVEL", PredefinedType::FLAG, "0"),
+            detail::predefined_tag("NS", PredefinedType::INTEGER, "1"),
+            detail::predefined_tag("PARID", PredefinedType::STRING, "1"),
+            // TODO : SB metadata Type and Number is "."
+            detail::predefined_tag("SOMATIC", PredefinedType::FLAG, "0"),
+            detail::predefined_tag("SVLEN", PredefinedType::INTEGER, "."),
+            detail::predefined_tag("SVTYPE", PredefinedType::STRING, "1"),
+            detail::predefined_tag("VALIDATED", PredefinedType::FLAG, "0"),
+    };
+
+    constexpr PredefinedTag info_v43_tags[] = {
+            detail::predefined_tag("1000G", PredefinedType::FLAG, "0"),
+            detail::predefined_tag("AA", PredefinedType::STRING, "1"),
+            detail::predefined_tag("AC", PredefinedType::INTEGER, "A"),
+            detail::predefined_tag("AD", PredefinedType::INTEGER, "R"),
+            detail::predefined_tag("ADF", PredefinedType::INTEGER, "R"),
+            detail::predefined_tag("ADR", PredefinedType::INTEGER, "R"),
+            detail::predefined_tag("AF", PredefinedType::FLOAT, "A"),
+            detail::predefined_tag("AN", PredefinedType::INTEGER, "1"),
+            detail::predefined_tag("BKPTID", PredefinedType::STRING, "."),
+            detail::predefined_tag("BQ", PredefinedType::FLOAT, "1"),
+            detail::predefined_tag("CICN", PredefinedType::INTEGER, "2"),
+            detail::predefined_tag("CICNADJ", PredefinedType::INTEGER, "."),
+            detail::predefined_tag("CIEND", PredefinedType::INTEGER, "2"),
+            detail::predefined_tag("CIGAR", PredefinedType::STRING, "A"),
+            detail::predefined_tag("CILEN", PredefinedType::INTEGER, "2"),
+            detail::predefined_tag("CIPOS", PredefinedType::INTEGER, "2"),
+            detail::predefined_tag("CN", PredefinedType::INTEGER, "1"),
+            detail::predefined_tag("CNADJ", PredefinedType::INTEGER, "."),
+            detail::predefined_tag("DB", PredefinedType::FLAG, "0"),
+            detail::predefined_tag("DBRIPID", PredefinedType::STRING, "1"),
+            detail::predefined_tag("DBVARID", PredefinedType::STRING, "1"),
+            detail::predefined_tag("DGVID", PredefinedType::STRING, "1"),
+            detail::predefined_tag("DP", PredefinedType::INTEGER, "1"),
+            detail::predefined_tag("DPADJ", PredefinedType::INTEGER, "."),
+            detail::predefined_tag("END", PredefinedType::INTEGER, "1"),
+            detail::predefined_tag("EVENT", PredefinedType::STRING, "1"),
+            detail::predefined_tag("H2", PredefinedType::FLAG, "0"),
+            detail::predefined_tag("H3", PredefinedType::FLAG, "0"),
+            detail::predefined_tag("HOMLEN", PredefinedType::INTEGER, "."),
+            detail::predefined_tag("HOMSEQ", PredefinedType::STRING, "."),
+            detail::predefined_tag("IMPRECISE", PredefinedType::FLAG, "0"),
+            detail::predefined_tag("MATEID", PredefinedType::STRING, "."),
+            detail::predefined_tag("MEINFO", PredefinedType::STRING, "4"),
+            detail::predefined_tag("METRANS", PredefinedType::STRING, "4"),
+            detail::predefined_tag("MQ", PredefinedType::ANY, "1"),
+            detail::predefined_tag("MQ0", PredefinedType::INTEGER, "1"),
+            detail::predefined_tag("NOVEL", PredefinedType::FLAG, "0"),
+            detail::predefined_tag("NS", PredefinedType::INTEGER, "1"),
+            detail::predefined_tag("PARID", PredefinedType::STRING, "1"),
+            // TODO : SB metadata Type and Number is "."
+            detail::predefined_tag("SOMATIC", PredefinedType::FLAG, "0"),
+            detail::predefined_tag("SVLEN", PredefinedType::INTEGER, "."),
+            detail::predefined_tag("SVTYPE", PredefinedType::STRING, "1"),
+            detail::predefined_tag("VALIDATED", PredefinedType::FLAG, "0"),
+    };
+
+    constexpr PredefinedTag format_v41_v42_tags[] = {
+            detail::predefined_tag("AHAP", PredefinedType::INTEGER, "1"),
+            detail::predefined_tag("CN", PredefinedType::INTEGER, "1"),
+            detail::predefined_tag("CNL", PredefinedType::FLOAT, "."),
+            detail::predefined_tag("CNQ", PredefinedType::FLOAT, "1"),
+            detail::predefined_tag("DP", PredefinedType::INTEGER, "1"),
+            detail::predefined_tag("EC", PredefinedType::INTEGER, "A"),
+            detail::predefined_tag("FT", PredefinedType::STRING, "1"),
+            detail::predefined_tag("GL", PredefinedType::FLOAT, "G"),
+            detail::predefined_tag("GLE", PredefinedType::STRING, "G"),
+            detail::predefined_tag("GP", PredefinedType::FLOAT, "G"),
+            detail::predefined_tag("GQ", PredefinedType::INTEGER, "1"),
+            detail::predefined_tag("GT", PredefinedType::STRING, "1"),
+            detail::predefined_tag("HAP", PredefinedType::INTEGER, "1"),
+            detail::predefined_tag("HQ", PredefinedType::INTEGER, "2"),
+            detail::predefined_tag("MQ", PredefinedType::INTEGER, "1"),
+            detail::predefined_tag("NQ", PredefinedType::INTEGER, "1"),
+            detail::predefined_tag("PL", PredefinedType::INTEGER, "G"),
+            detail::predefined_tag("PQ", PredefinedType::INTEGER, "1"),
+            detail::predefined_tag("PS", PredefinedType::INTEGER, "1"),
+    };
+
+    constexpr PredefinedTag format_v43_tags[] = {
+            detail::predefined_tag("AD", PredefinedType::INTEGER, "R"),
+            detail::predefined_tag("ADF", PredefinedType::INTEGER, "R"),
+            detail::predefined_tag("ADR", PredefinedType::INTEGER, "R"),
+            detail::predefined_tag("AHAP", PredefinedType::INTEGER, "1"),
+            detail::predefined_tag("CN", PredefinedType::INTEGER, "1"),
+            detail::predefined_tag("CNL", PredefinedType::FLOAT, "G"),
+            detail::predefined_tag("CNP", PredefinedType::FLOAT, "G"),
+            detail::predefined_tag("CNQ", PredefinedType::FLOAT, "1"),
+            detail::predefined_tag("DP", PredefinedType::INTEGER, "1"),
+            detail::predefined_tag("EC", PredefinedType::INTEGER, "A"),
+            detail::predefined_tag("FT", PredefinedType::STRING, "1"),
+            detail::predefined_tag("GL", PredefinedType::FLOAT, "G"),
+            detail::predefined_tag("GP", PredefinedType::FLOAT, "G"),
+            detail::predefined_tag("GQ", PredefinedType::INTEGER, "1"),
+            detail::predefined_tag("GT", PredefinedType::STRING, "1"),
+            detail::predefined_tag("HAP", PredefinedType::INTEGER, "1"),
+            detail::predefined_tag("HQ", PredefinedType::INTEGER, "2"),
+            detail::predefined_tag("MQ", PredefinedType::INTEGER, "1"),
+            detail::predefined_tag("NQ", PredefinedType::INTEGER, "1"),
+            detail::predefined_tag("PL", PredefinedType::INTEGER, "G"),
+            detail::predefined_tag("PQ", PredefinedType::INTEGER, "1"),
+            detail::predefined_tag("PS", PredefinedType::INTEGER, "1"),
+    };
+
+    constexpr PredefinedTagTable info_v41_v42 = predefined_tag_table(info_v41_v42_tags, 2166136324u);
+    constexpr PredefinedTagTable info_v43 = predefined_tag_table(info_v43_tags, 2166136324u);
+    constexpr PredefinedTagTable format_v41_v42 = predefined_tag_table(format_v41_v42_tags, 2166136262u);
+    constexpr PredefinedTagTable format_v43 = predefined_tag_table(format_v43_tags, 2166136264u);
+
+    // If a tag is added and these fail, look for a seed with which it doesn't collide with the others
+    static_assert(is_perfect(info_v41_v42), "Predefined INFO v4.1/v4.2 tags collide in the hash table");
+    static_assert(is_perfect(info_v43), "Predefined INFO v4.3 tags collide in the hash table");
+    static_assert(is_perfect(format_v41_v42), "Predefined FORMAT v4.1/v4.2 tags collide in the hash table");
+    static_assert(is_perfect(format_v43), "Predefined FORMAT v4.3 tags collide in the hash table");
+
+    /**
+     * Number of possible genotypes with the alleles of a record, which is the cardinality of Number=G. It is the
+     * `ploidy`-combination with repetition of the alleles, ((alleles + ploidy - 1) choose ploidy): with 1 reference
+     * and 2 alternate alleles, and ploidy 2, it's (3 + 2 - 1 choose 2) = 6: 00, 01, 11, 02, 12, 22.
+     *
+     * The counts are memoized by ploidy, because it is the same for most samples of a record, and forgotten when
+     * the number of alleles changes. Like a SampleIndex, one table can be used for all the samples of a file.
+     */
+    class GenotypeCounts
+    {
+      public:
+        GenotypeCounts();
+
+        long count(size_t alternate_alleles, size_t ploidy);
+
+        /**
+         * Computes a count without memoizing it
+         */
+        static long compute(size_t alternate_alleles, size_t ploidy);
+
+      private:
+        static size_t const max_memoized_ploidy = 64;
+
+        size_t alternate_alleles;
+        std::vector<long> counts;   /**< By ploidy, -1 if not computed yet */
+    };
+
+    /**
+     * Meta information of the fields listed in a FORMAT column. The same FORMAT is usually shared by most records
+     * of a file, so it is resolved once and reused.
+     */
+    struct FormatLayout
+    {
+        /** Description of each field in the meta section, or nullptr if not described there */
+        std::vector<FieldDescriptor const *> fields;
+
+        /** Type and Number of each field that is not described in the meta section but predefined by the
+         * specification, or nullptr */
+        std::vector<PredefinedTag const *> predefined;
+
+        /** Number of each field, from its description or its predefined one, or UNKNOWN if it has neither */
+        std::vector<Cardinality> cardinalities;
+
+        /** Position of GT in the FORMAT column, or -1 if not present */
+        long gt_index;
+    };
+
     struct Source 
     {
         std::string name;           /**< Name of the source to interact with (file, stdin...) */
@@ -274,7 +560,39 @@ namespace ebi
                Version version,
                std::multimap<std::string, MetaEntry> const & meta_entries = {},
                std::vector<std::string> const & samples_names = {});
-        
+
+        /**
+         * Copies the contents of the source, but not its schema and layouts, which are rebuilt when needed
+         */
+        Source(Source const & other);
+        Source & operator=(Source const & other);
+
+        /**
+         * Copy of the source for parsing body lines only. It has no meta entries, and shares the schema of this
+         * one instead, so it is cheap to make even after a meta section of hundreds of thousands of lines.
+         */
+        std::shared_ptr<Source> body_source();
+
+        /**
+         * Index of meta_entries. It is built the first time it is needed after the meta section is complete, and
+         * rebuilt if more entries are added later.
+         */
+        HeaderSchema const & schema();
+
+        /**
+         * Meta information of a FORMAT column, resolved with schema() and cached until the schema is rebuilt
+         */
+        FormatLayout const & format_layout(std::vector<std::string> const & format);
+
+      private:
+        void share_schema(Source const & other);
+
+        std::shared_ptr<HeaderSchema const> m_schema;
+        std::unordered_map<std::string, FormatLayout> m_format_layouts;   /**< Keyed by FORMAT column */
+        std::string m_format_key;
+        size_t m_schema_entries;    /**< Number of meta entries that were indexed in m_schema */
+        bool m_schema_built;
+        bool m_schema_shared;       /**< If m_schema indexes the entries of the source this one was copied from */
     };
     
     struct Record 
@@ -282,6 +600,7 @@ namespace ebi
         size_t line;
 
         std::string chromosome;
+        ContigId contig;    /**< Interned chromosome */
         size_t position;
         std::vector<std::string> ids;
 
@@ -296,7 +615,16 @@ namespace ebi
 
         std::vector<std::string> samples;
 
-        std::shared_ptr<Source> source;
+        /**
+         * Samples as they were read from the line, separated by tabs, when the parser leaves them unsplit because
+         * no check needs their fields. Then `samples` is empty until split_samples is called.
+         */
+        std::string unsplit_samples;
+
+        /**
+         * Not owned: the source must outlive the records read from it
+         */
+        Source * source;
 
         Record(size_t line,
                 std::string const & chromosome,
@@ -309,7 +637,106 @@ namespace ebi
                 std::multimap<std::string, std::string> const & info,
                 std::vector<std::string> const & format,
                 std::vector<std::string> const & samples,
-                std::shared_ptr<Source> source);
+                std::shared_ptr<Source> const & source);
+
+        /**
+         * Empty record, to be filled with assign
+         */
+        Record();
+
+        /**
+         * Replaces the contents of the record and validates them like the constructor does. The strings and
+         * vectors of the previous contents are reused, so a parser can fill the same record for every line.
+         *
+         * @throw BodySectionError (or a subtype), leaving the record in an unspecified state
+         */
+        void assign(size_t line,
+                    std::string const & chromosome,
+                    size_t position,
+                    std::vector<std::string> const & ids,
+                    std::string const & reference_allele,
+                    std::vector<std::string> const & alternate_alleles,
+                    float quality,
+                    std::vector<std::string> const & filters,
+                    std::multimap<std::string, std::string> const & info,
+                    std::vector<std::string> const & format,
+                    std::vector<std::string> const & samples,
+                    Source * source);
+
+        /**
+         * Replaces the contents of the record like assign, but doesn't validate them until check is called. The INFO
+         * map is taken by value, so a parser that doesn't need it anymore can move it in, long values included.
+         */
+        void assign_unchecked(size_t line,
+                              std::string const & chromosome,
+                              size_t position,
+                              std::vector<std::string> const & ids,
+                              std::string const & reference_allele,
+                              std::vector<std::string> const & alternate_alleles,
+                              float quality,
+                              std::vector<std::string> const & filters,
+                              std::multimap<std::string, std::string> info,
+                              std::vector<std::string> const & format,
+                              std::vector<std::string> const & samples,
+                              Source * source);
+
+        /**
+         * Validates the contents of the record on its own, without comparing it to other records
+         *
+         * @throw BodySectionError (or a subtype)
+         */
+        void check();
+
+        /**
+         * Same as check, with the layout of the FORMAT column already resolved by the source. It doesn't modify
+         * the source, so several records of the same source can be checked in parallel.
+         *
+         * If `workers` is given and the record has at least parallel_samples_threshold samples, they are split
+         * between the workers, which must not be running another batch. The error thrown is the same.
+         */
+        void check(FormatLayout const & layout, util::WorkerPool * workers = nullptr);
+
+        /**
+         * Same as check, but the error is returned instead of thrown, so validating lots of invalid records
+         * doesn't unwind the stack for each one
+         *
+         * @return the first error found, owned by the caller, or nullptr if the record is valid
+         */
+        Error * validate();
+
+        /**
+         * Same as validate, and if a `profile` is given, the time of each check is added to it. Only the groups
+         * of RecordChecks set in `checks` are run.
+         */
+        Error * validate(FormatLayout const & layout, util::WorkerPool * workers = nullptr,
+                         Profile * profile = nullptr, unsigned checks = RECORD_CHECK_ALL);
+
+        /**
+         * Number of samples, whether they are split or not
+         */
+        size_t n_samples() const;
+
+        /**
+         * Splits unsplit_samples into `samples`, if it was set, so the fields of each sample can be read
+         */
+        void split_samples();
+
+        /**
+         * Whether the record is a gVCF reference block: a region without variants, with <*> or <NON_REF> as its
+         * only alternate allele and its last position in INFO END
+         */
+        bool is_reference_block() const;
+
+        /**
+         * Number of samples from which it pays off to check them in several threads
+         */
+        static size_t const parallel_samples_threshold;
+
+        /**
+         * Length from which an INFO value, like a sequence, is checked one value at a time instead of being split
+         * into copies of all of them
+         */
+        static size_t const long_info_value_size;
         
         bool operator==(Record const &) const;
 
@@ -318,55 +745,62 @@ namespace ebi
     private:
         
         void set_types();
+
+        /**
+         * Runs the checks of validate, each one measured with ProfilePolicy::measure
+         */
+        template <typename ProfilePolicy>
+        Error * run_checks(FormatLayout const & layout, util::WorkerPool * workers, Profile * profile,
+                           unsigned checks) const;
         
         /**
          * Checks that chromosome does not contain colons or white-spaces
          * 
-         * @throw ChromosomeBodyError
+         * @return ChromosomeBodyError, or nullptr if the check passes
          */
-        void check_chromosome() const;
+        Error * check_chromosome() const;
 
         /**
          * Checks that chromosome does not contain any colons
          * 
-         * @throw ChromosomeBodyError
+         * @return ChromosomeBodyError, or nullptr if the check passes
          */
-        void check_chromosome_no_colons() const;
+        Error * check_chromosome_no_colons() const;
 
         /**
          * Checks that chromosome does not contain any white-spaces
          * 
-         * @throw ChromosomeBodyError
+         * @return ChromosomeBodyError, or nullptr if the check passes
          */
-        void check_chromosome_no_whitespaces() const;
+        Error * check_chromosome_no_whitespaces() const;
 
         /**
          * Checks that IDs are alphanumeric and do not contain duplicate values
          * 
-         * @throw IdBodyError
+         * @return IdBodyError, or nullptr if the check passes
          */
-        void check_ids() const;
+        Error * check_ids() const;
         
         /**
          * Checks that ID contains no semicolons or white-spaces
          * 
-         * @throw IdBodyError
+         * @return IdBodyError, or nullptr if the check passes
          */
-        void check_ids_no_semicolons_whitespaces() const;
+        Error * check_ids_no_semicolons_whitespaces() const;
 
         /**
          * Checks that ID contains no duplicate values in the same line
          * 
-         * @throw IdBodyError
+         * @return IdBodyError, or nullptr if the check passes
          */
-        void check_ids_no_duplicates() const;
+        Error * check_ids_no_duplicates() const;
 
         /**
          * Checks the structure of an alternate allele and its accordance to the meta section
          * 
-         * @throw AlternateAllelesBodyError
+         * @return AlternateAllelesBodyError, or nullptr if the check passes
          */
-        void check_alternate_alleles() const;
+        Error * check_alternate_alleles() const;
         
         /**
          * Checks the structure of an alternate allele against the reference:
@@ -374,100 +808,112 @@ namespace ebi
          * - Is not the same as the reference
          * - Shares the first nucleotide with the reference (does not apply to SV, break-ends and custom ALTs)
          * 
-         * @throw AlternateAllelesBodyError
+         * @return AlternateAllelesBodyError, or nullptr if the check passes
          */
-        void check_alternate_allele_structure(std::string const & alternate, RecordType type) const;
+        Error * check_alternate_allele_structure(std::string const & alternate, RecordType type) const;
         
         /**
          * Check that alternates of the form <SOME_ALT> begin with DEL, INS, DUP, INV or CNV
          * 
-         * @throw AlternateAllelesBodyError
+         * @return AlternateAllelesBodyError, or nullptr if the check passes
          */
-        void check_alternate_allele_symbolic_prefix(std::string const & alternate) const;
+        Error * check_alternate_allele_symbolic_prefix(std::string const & alternate) const;
         
         /**
          * Checks that quality is zero or greater
          * 
-         * @throw QualityBodyError
+         * @return QualityBodyError, or nullptr if the check passes
          */
-        void check_quality() const;
+        Error * check_quality() const;
         
         /**
          * Checks that all the filters are listed in the meta section, do not contain duplicates and are non-zero
          * 
-         * @throw FilterBodyError
+         * @return FilterBodyError, or nullptr if the check passes
          */
-        void check_filter() const;
+        Error * check_filter() const;
         
         /**
          * Checks that FILTER contains no duplicate failed filters in the same line
          * 
-         * @throw FilterBodyError
+         * @return FilterBodyError, or nullptr if the check passes
          */
-        void check_filter_no_duplicates() const;
+        Error * check_filter_no_duplicates() const;
 
         /**
          * Check that FILTER values are non-zero, as 0 is reserved and must not be used
          *
-         * @throw FilterBodyError
+         * @return FilterBodyError, or nullptr if the check passes
          */
-        void check_filter_not_zero() const;
+        Error * check_filter_not_zero() const;
 
         /**
          * Checks that all the INFO fields are listed in the meta section, their number and 
          * type match those specifications, and contain no duplicates
          * 
-         * @throw InfoBodyError
+         * @return InfoBodyError, or nullptr if the check passes
          */
-        void check_info() const;
+        Error * check_info() const;
 
         /**
          * Checks that INFO contains no duplicate keys in the same line
          * 
-         * @throw InfoBodyError
+         * @return InfoBodyError, or nullptr if the check passes
+         */
+        Error * check_info_no_duplicates() const;
+
+        /**
+         * Same checks as check_info for a single field with a long value, which is walked instead of copied
+         *
+         * @return InfoBodyError, or nullptr if the check passes
          */
-        void check_info_no_duplicates() const;
+        Error * check_long_info_field(std::string const & key, std::string const & value) const;
 
        /**
          * Checks that format starts with GT and has no duplicate fields
          * 
-         * @throw FormatBodyError
+         * @return FormatBodyError, or nullptr if the check passes
          */
-        void check_format() const;
+        Error * check_format() const;
 
         /**
          * Checks that GT is the first field in the FORMAT column
          * 
-         * @throw FormatBodyError
+         * @return FormatBodyError, or nullptr if the check passes
          */
-        void check_format_GT() const;
+        Error * check_format_GT() const;
 
         /**
          * Checks that format has no duplicate fields in the same line
          * 
-         * @throw FormatBodyError
+         * @return FormatBodyError, or nullptr if the check passes
          */
-        void check_format_no_duplicates() const;
+        Error * check_format_no_duplicates() const;
 
         /**
          * Checks that INFO predefined tags are consistent with the specification
+         *
+         * @return Error with the part of the message to add to the caller's one, or nullptr
          */
-        void check_predefined_tag_info(std::string const &field_key, std::vector<std::string> const &values,
-                                       std::map<std::string, std::pair<std::string, std::string>> const &tags) const;
+        Error * check_predefined_tag_info(std::string const &field_key, std::vector<std::string> const &values,
+                                          PredefinedTagTable const &tags) const;
 
         /**
          * Checks that FORMAT predefined tags are consistent with the specification
+         *
+         * @return Error with the part of the message to add to the caller's one, or nullptr
          */
-        void check_predefined_tag_format(std::string const &field_key, std::vector<std::string> const &values,
-                                         std::map<std::string, std::pair<std::string, std::string>> const &tags,
-                                         size_t ploidy) const;
+        Error * check_predefined_tag_format(std::string const &field_key, SampleIndex const &index, size_t subfield,
+                                            PredefinedTag const &tag,
+                                            Cardinality const &cardinality, size_t ploidy,
+                                            GenotypeCounts &counts) const;
         /**
          * Strict validation of predefined INFO tags
          *
-         * @throw InfoBodyError
+         * @return InfoBodyError, or nullptr if the check passes
          */
-        void strict_validation_info_predefined_tags(std::string const & field_key, std::string const & field_value,
-                                                    std::vector<std::string> const & values) const;
+        Error * strict_validation_info_predefined_tags(std::string const & field_key, std::string const & field_value,
+                                                       std::vector<std::string> const & values) const;
 
         /**
          * Returns true if an alternate allele is not symbolic
@@ -480,141 +926,159 @@ namespace ebi
          * - Their allele indexes are not greater than the total number of alleles
          * - The number and type of the fields match the FORMAT meta information
          * 
-         * @throw SamplesBodyError
+         * @return SamplesBodyError, or nullptr if the check passes
          */
-        void check_samples() const;
+        Error * check_samples(FormatLayout const & layout, util::WorkerPool * workers) const;
 
         /**
-         * Checks that the number of samples matches those listed in the header line
-         * 
-         * @throw SamplesBodyError
-         */
-        void check_samples_count() const;
-
-        /**
-         * Returns a vector of MetaEntry objects in the same order as they are displayed in the samples
+         * Runs check_sample for ranges of samples in parallel, returning the error of the first failing sample
+         *
+         * @return SamplesBodyError or SamplesFieldBodyError, or nullptr if the check passes
          */
-        std::vector<MetaEntry> get_meta_entry_objects() const;
+        Error * check_samples_in_parallel(FormatLayout const & layout, util::WorkerPool & workers) const;
 
         /**
-         * Returns the ploidy of the GT sample field
+         * Checks that the number of samples matches those listed in the header line
+         * 
+         * @return SamplesBodyError, or nullptr if the check passes
          */
-        size_t get_ploidy_from_GT(std::string const & sample) const;
+        Error * check_samples_count() const;
 
         /**
-         * Checks the sample contents and accordance to the meta section
+         * Checks the sample contents and accordance to the meta section, decoding its GT subfield into `genotype`
          * 
-         * @throw SamplesBodyError
-         * @throw SamplesFieldBodyError
+         * @return SamplesBodyError or SamplesFieldBodyError, or nullptr if the check passes
          */
-        void check_sample(size_t i, std::vector<MetaEntry> const & format_meta) const;
+        Error * check_sample(size_t i, SampleIndex const & index, Genotype & genotype, GenotypeCounts & counts,
+                             FormatLayout const & layout) const;
 
         /**
          * Checks that the number of subfields in the sample is not greater than the number in the FORMAT column
          * 
-         * @throw SamplesBodyError
+         * @return SamplesBodyError, or nullptr if the check passes
          */
-        void check_sample_subfields_count(size_t i, std::vector<std::string> const & subfields) const;
+        Error * check_sample_subfields_count(size_t i, size_t n_subfields) const;
 
         /**
-         * Checks that the cardinality and type of the fields in the sample match the FORMAT meta information
+         * Checks that the cardinality and type of the fields in the sample match the FORMAT meta information,
+         * with the ploidy of its GT subfield, if any
          * 
-         * @throw SamplesFieldBodyError
+         * @return SamplesFieldBodyError, or nullptr if the check passes
          */
-        void check_sample_subfields_cardinality_type(size_t i, std::vector<std::string> const & subfields, std::vector<MetaEntry> const & format_meta) const;
+        Error * check_sample_subfields_cardinality_type(size_t i, SampleIndex const & index, size_t ploidy,
+                                                        GenotypeCounts & counts, FormatLayout const & layout) const;
 
         /**
          * Strict validation of predefined FORMAT tags
          *
-         * @throw SamplesFieldBodyError
+         * @return SamplesFieldBodyError, or nullptr if the check passes
          */
-        void strict_validation_format_predefined_tags(size_t i, std::string const & field_key, std::string const & field_value,
-                                                      std::vector<std::string> const & values) const;
+        Error * strict_validation_format_predefined_tags(size_t i, std::string const & field_key, std::string const & field_value,
+                                                         std::vector<std::string> const & values) const;
 
         /**
          * Check that the allele indexes in a sample are not greater than the total number of alleles
          * 
-         * @throw SamplesFieldBodyError
+         * @return SamplesFieldBodyError, or nullptr if the check passes
          */
-        void check_sample_alleles(std::vector<std::string> const & subfields) const;
+        Error * check_sample_alleles(Genotype const & genotype) const;
 
         /**
          * Checks that the allele index in a sample is an integer number
          * 
-         * @throw SamplesFieldBodyError
+         * @return SamplesFieldBodyError, or nullptr if the check passes
          */        
-        void check_sample_alleles_is_integer(std::string const & allele, long ploidy) const;
+        Error * check_sample_alleles_is_integer(Genotype const & genotype, Genotype::Allele const & allele,
+                                                long ploidy) const;
 
         /**
          * Checks that the allele index is in range
          * 
-         * @throw SamplesFieldBodyError
+         * @return SamplesFieldBodyError, or nullptr if the check passes
          */
-        void check_sample_alleles_range(std::string const & allele, long ploidy) const;
+        Error * check_sample_alleles_range(Genotype::Allele const & allele, long ploidy) const;
 
         /**
-         * Checks that a list contains no duplicates
-         *
-         * @throw Error
+         * Returns true if a list contains some value more than once
          */
-        void check_no_duplicates(std::vector<std::string> const & values) const;
+        bool has_duplicates(std::vector<std::string> const & values) const;
 
         /**
-         * returns the expected number of elements, given a string code
-         * @param number one of ["A", "R", "G", ".", number], where
-         *  - "A" is the amount of alleles,
-         *  - "R" the amount of reference (1) plus alleles (A)
-         *  - "G" is `ploidy`-combination with repetition: ((R + ploidy -1) choose ploidy)
-         *  (e.g. with 1 reference, 2 alternate alleles (3 total alleles) and ploidy 2, it's 3 + 2 -1 choose 2, which is 6: 00, 01, 11, 02, 12, 22)
-         *  - "." means unknown number of elements
-         *  - number is a positive number [0, +inf)
-         * @param alternate_allele_number the number of alternate alleles
+         * Returns the expected number of values of a field, or -1 if it is unknown
+         *
          * @param ploidy is the number of copies of a chromosome in a sample, so a given genotype in said chromosome needs `ploidy` alleles to be completely specified
-         * @param expected_cardinality return by reference [0, +inf) for valid numbers. -1 if unknown number.
-         * @throw std::invalid_argument if it's not a number
-         * @throw std::out_of_range if it's out of range.
-         * @return bool: whether the number was valid or not
          */
-        bool is_valid_cardinality(std::string const &number, size_t alternate_allele_number, size_t ploidy,
-                                  long &expected_cardinality) const;
+        long expected_cardinality(Cardinality const & cardinality, size_t ploidy, GenotypeCounts & counts) const;
 
         /**
          * Checks that the values match either their type specified in the meta or the VCF specification for predefined tags not in meta
+         *
+         * @param message set to the reason of the mismatch, if there is one to add to the error message
          */
-        void check_value_type(std::string const & type, std::string const & value, std::string & message) const;
+        bool is_value_of_type(std::string const & type, std::string const & value, std::string & message) const;
 
         /**
          * Checks that every field in INFO column matches the Number specification in the meta
          * Or if it is not present in the meta and is a predefined tag, check that it matches the VCF specification
          * 
-         * @throw std::invalid_argument
+         * @return Error with the part of the message to add to the caller's one, or nullptr
          */
-        void check_info_field_cardinality(std::vector<std::string> const &values, std::string const &number) const;
+        Error * check_info_field_cardinality(std::vector<std::string> const &values, std::string const &number) const;
+        Error * check_info_field_cardinality(std::vector<std::string> const &values, std::string const &number,
+                                             Cardinality const &cardinality) const;
+        Error * check_info_field_cardinality(size_t n_values, std::string const &number,
+                                             Cardinality const &cardinality) const;
 
         /**
          * Checks that every field in a sample matches the Number specification in the meta
          * Or if it is not present in the meta and is a predefined tag, check that it matches the VCF specification
          * 
-         * @throw std::invalid_argument
+         * @return Error with the part of the message to add to the caller's one, or nullptr
+         */
+        Error * check_sample_field_cardinality(std::vector<std::string> const &values, std::string const &number,
+                                               size_t ploidy, long &expected_cardinality) const;
+        Error * check_sample_field_cardinality(size_t n_values, std::string const &number,
+                                               size_t ploidy, long &expected_cardinality) const;
+
+        /**
+         * Like check_sample_field_cardinality, with the Number already parsed and the counts of genotypes of the
+         * samples checked before
          */
-        void check_sample_field_cardinality(std::vector<std::string> const &values, std::string const &number,
-                                            size_t ploidy, long &expected_cardinality) const;
+        Error * check_sample_field_cardinality(size_t n_values, std::string const &number,
+                                               Cardinality const &cardinality, size_t ploidy, GenotypeCounts &counts,
+                                               long &expected_cardinality) const;
         
         /**
          * Checks that every field in a column matches the Type specification in the meta
          * Or if it is not present in the meta and is a predefined tag, check that it matches the VCF specification
          *
-         * @throw std::invalid_argument
+         * @return Error with the part of the message to add to the caller's one, or nullptr
+         */
+        Error * check_field_type(std::vector<std::string> const & values,
+                                 std::string const & type) const;
+
+        /**
+         * Checks the Type of the values of a sample subfield. Values whose class already proves their type, like
+         * an integer in a Float field, are accepted without being parsed.
+         *
+         * @return Error with the part of the message to add to the caller's one, or nullptr
+         */
+        Error * check_field_type(SampleIndex const & index, size_t subfield, std::string const & type) const;
+
+        /**
+         * Checks a single value, as check_field_type does
+         *
+         * @return Error with the part of the message to add to the caller's one, or nullptr
          */
-        void check_field_type(std::vector<std::string> const & values,
-                              std::string const & type) const;
+        Error * check_field_value_type(std::string const & type, std::string const & value) const;
 
         /**
          * Checks that predefined tags with Type Integer have non-negative values
          *
-         * @throw std::invalid_argument
+         * @return Error with the part of the message to add to the caller's one, or nullptr
          */
-        void check_field_integer_range(std::string const & field, std::vector<std::string> const & value) const;
+        Error * check_field_integer_range(std::string const & field, std::vector<std::string> const & value) const;
+        Error * check_field_integer_range(std::string const & field, SampleIndex const & index, size_t subfield) const;
     };
 
     std::ostream &operator<<(std::ostream &os, const Record &record);
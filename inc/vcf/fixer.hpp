@@ -21,6 +21,8 @@
 #include <set>
 #include <iostream>
 #include <algorithm>
+#include <string>
+#include <utility>
 
 #include "util/stream_utils.hpp"
 #include "util/string_utils.hpp"
@@ -30,25 +32,57 @@ namespace ebi
 {
   namespace vcf
   {
+    /**
+     * Writes the lines with errors fixed.
+     *
+     * The errors of a line are fixed together: the line is split in columns once, the first time a fix needs
+     * them, each error modifies the columns it concerns, and the columns are joined and written once. A line
+     * without any fixable error is copied as it is.
+     */
     class Fixer : public ErrorVisitor {
       public:
         Fixer(std::ostream &output)
-                : line_number{0}, line{nullptr}, output(output), ignored_errors{0} { }
+                : line_number{0}, line{nullptr}, split{false}, removed{false}, output(output), ignored_errors{0} { }
         
         virtual ~Fixer() { }
 
         void fix(size_t line_number, std::vector<char> &line, Error &error);
 
+        /**
+         * Fixes all the errors of a line, in the order they are given, and writes it once. Once an error removes
+         * the line, the following ones are not looked at.
+         */
+        void fix(size_t line_number, std::vector<char> &line, std::vector<Error *> const &errors);
+
         size_t get_ignored_errors();
 
       private:
         size_t line_number;
         std::vector<char> *line;
+        std::vector<std::string> columns;   ///< of the line being fixed, without the end of line, if split
+        std::string eol;
+        bool split;
+        bool removed;
         std::ostream &output;
         size_t ignored_errors;
 
         void ignore_error();
 
+        /**
+         * Splits the line in columns by tabs, unless a previous fix of the same line did it
+         */
+        std::vector<std::string> & line_columns();
+
+        /**
+         * The line with the fixes applied so far, including its end of line
+         */
+        std::string current_line() const;
+
+        /**
+         * Writes the line with all its fixes, or nothing if it was removed
+         */
+        void write_line();
+
         virtual void visit(Error &error) override;
         virtual void visit(MetaSectionError &error) override;
         virtual void visit(HeaderSectionError &error) override;
@@ -113,11 +147,11 @@ namespace ebi
 
         /**
          * Removes any duplicate fields in a column.
-         * @param the column string
+         * @param the column string, modified in place
          * @param the separator used for splitting the column
          * @return the number of duplicate fields removed
          */
-        size_t remove_duplicate_strings(const std::string &column,
+        size_t remove_duplicate_strings(std::string &column,
                                         const std::string &separator);
 
         /**
@@ -125,13 +159,13 @@ namespace ebi
          * Explanation of the fix:
          * - Remove all fields for a duplicate key if the corresponding values differ
          * - Else if all the values are the same for that key, keep one pair & remove the rest
-         * @param the column string
+         * @param the column string, modified in place
          * @param the separator used for splitting the column
          * @param the separator used to split the key value pair
          * @param the empty value to be used if we end up removing all pairs
          * @return the number of duplicate fields removed
          */
-        size_t remove_duplicate_key_value_pairs(const std::string &column,
+        size_t remove_duplicate_key_value_pairs(std::string &column,
                                                 const std::string &separator,
                                                 const std::string &key_value_separator,
                                                 const std::string &empty_value);
@@ -141,10 +175,12 @@ namespace ebi
          * Explanation of the fix:
          * - Remove all FORMAT fields for which one or more of the samples contain duplicate values (within the sample field itself)
          * - Else if all the values match in a sample, and this happens for all the samples, keep the first occurrence in each sample and discard the rest
-         * @param the complete error string
+         * @param first iterator to the FORMAT column string
+         * @param last iterator past the last sample column
          * @return the number of duplicate format fields (with corresponding samples if present) removed
          */
-        size_t remove_duplicate_format_sample_pairs(const std::string &string_line);
+        size_t remove_duplicate_format_sample_pairs(std::vector<std::string>::iterator first,
+                                                    std::vector<std::string>::iterator last);
 
         /*
          * Returns all the fields to remove from the FORMAT column and corresponding ones in sample columns, for duplicate values error.
@@ -174,31 +210,31 @@ namespace ebi
                            std::vector<std::string>::iterator last,
                            SamplesFieldBodyError &error);
 
-        size_t remove_fields(const std::string &line,
+        size_t remove_fields(std::string &line,
                              const std::string &separators,
                              std::function<bool(const std::string &column, size_t index)> condition_to_remove);
 
         /**
-         * Don't write to output the columns in `line` that satisfy the `condition_to_remove`.
-         * @param line: some of its columns will not be written into output
+         * Removes the columns in `line` that satisfy the `condition_to_remove`.
+         * @param line: some of its columns will be removed
          * @param separators to be used to split `line`
          * @param empty_column in case all the columns were remove, write an especial empty column
          * @param condition_to_remove return true if the column has to be removed. can decide using the column and its index
          * @return amount of columns removed
          */
-        size_t remove_fields(const std::string &line,
+        size_t remove_fields(std::string &line,
                              const std::string &separators,
                              const std::string &empty_column,
                              std::function<bool(const std::string &column, size_t index)> condition_to_remove);
 
         /**
-         * Write to output the `expected_field` in place of the erroneous one.
+         * Puts the `expected_field` in place of the erroneous one.
          * @param line: its incorrect column will be replaced by the correct one
          * @param separators to be used to split `line`
          * @param expected_field to replace the incorrect one
          * @param condition_to_replace return true if the column is to be replaced with the `expected_field`
          */
-        size_t replace_fields(const std::string &line,
+        size_t replace_fields(std::string &line,
                               const std::string &separators,
                               const std::string &expected_field,
                               std::function<bool(const std::string &column, size_t index)> condition_to_replace);
@@ -214,58 +250,16 @@ namespace ebi
         size_t split_and_find(const std::string &line, const std::string &separator, const std::string &value);
 
         /**
-         * Splits a line and allows to rewrite one of the columns, copying the other columns into "output".
-         * @param column_index: index to the column to modify
-         * @param line: whole line that will be split
-         * @param separator: will be used to split the line
-         * @param fix_function: takes a string, which is the column to fix. `fix_function` must write to
-         * the member "output". `fix_function` will be called once
-         * @return the number of times `fix_function` was called, that should be 1 if ranges were valid
-         */
-        size_t fix_column(size_t column_index,
-                        const std::string &line,
-                        const std::string &separator,
-                        std::function<void(std::string &column)> fix_function);
-
-        /**
-         * Splits a line and allows to rewrite one of the columns, copying the other columns into "output".
-         * @param column_index: index to the column to modify
-         * @param column_index_last: NON-INCLUSIVE index. points to the column after the last column to modify.
-         * To write all the remaining columns, pass -1.
-         * @param line: whole line that will be split
-         * @param separator: will be used to split the line
-         * @param fix_function: takes a string, which is the column to fix. `fix_function` must write to the member
-         * "output". `fix_function` will be called (column_index_last - column_index) times
-         * (or less if the range is invalid)
-         * @return the number of times `fix_function` was called, that should be (column_index_last - column_index)
-         * if ranges were valid
-         */
-        size_t fix_foreach_column(size_t column_index,
-                        long column_index_last,
-                        const std::string &line,
-                        const std::string &separator,
-                        std::function<void(std::string &column)> fix_function);
-
-        /**
-         * Splits a line and allows to rewrite one of the columns, copying the other columns into "output".
+         * Range of the columns of the line to fix, splitting it if needed.
          * If column_index* specify an empty range or a past-the-end range, a std::out_of_range is thrown without
-         * writing anything.
-         * @param column_index: index to the column to modify
+         * modifying anything.
+         * @param column_index: index to the first column to modify
          * @param column_index_last: NON-INCLUSIVE index. points to the column after the last column to modify.
-         * to write all the remaining columns, pass -1
-         * @param line: whole line that will be split
-         * @param separator: will be used to split the line
-         * @param fix_function: takes a range [first, last)  of strings, which is the column to fix. `fix_function` must
-         * write to the member "output". `fix_function` will be called once
-         * @return the number of columns passed to `fix_function`, that should be (column_index_last - column_index)
-         * if ranges were valid
+         * to fix all the remaining columns, pass -1
+         * @return iterators to the first column and past the last one
          */
-        size_t fix_columns(size_t column_index,
-                        long column_index_last,
-                        const std::string &line,
-                        const std::string &separator,
-                        std::function<void(std::vector<std::string>::iterator begin,
-                                           std::vector<std::string>::iterator end)> fix_function);
+        std::pair<std::vector<std::string>::iterator, std::vector<std::string>::iterator>
+        columns_to_fix(size_t column_index, long column_index_last);
     };
   }
 }
@@ -0,0 +1,210 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef VCF_HASH_RECORD_CACHE_HPP
+#define VCF_HASH_RECORD_CACHE_HPP
+
+#include <cstdint>
+#include <deque>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+
+#include "duplicate_filter.hpp"
+#include "error.hpp"
+#include "external_record_cache.hpp"
+#include "file_structure.hpp"
+#include "normalizer.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+
+    /**
+     * Alternative to RecordCache that finds the duplicates of a Record with a hash of its RecordCores, and forgets
+     * them in the order they were checked.
+     *
+     * The variants are kept in a FIFO queue of `capacity` elements, indexed by a 64-bit hash of their interned
+     * contig, position, reference and alternate allele. Only the variants with the same hash are fully compared, so
+     * checking a new one usually takes no string comparisons at all. A new variant is hashed and compared as ranges
+     * of the alleles of its Record, and its alleles are copied just once, into the RecordCore that is kept.
+     *
+     * The duplicates are reported like RecordCache does, but the variants forgotten are not the same: this cache
+     * forgets the oldest ones, while RecordCache forgets the smallest, comparing the contigs by name. Even in a
+     * sorted input, the contigs are rarely in alphabetical order (2 comes before 10), so when the capacity is
+     * reached RecordCache may forget the variants of the contig being read instead of those of the previous one.
+     * Both caches only hold the same variants if their capacity is unlimited.
+     *
+     * The gVCF reference blocks (see Record::is_reference_block), which are most of the lines of a gVCF, are not
+     * normalized nor queued: only those that start where the last one started are kept, apart from the variants,
+     * however many they are, and a block is compared with them and with the variants of the same hash. A block
+     * that starts before the last one, in an unsorted input, is checked like any other variant.
+     */
+    class HashRecordCache
+    {
+      public:
+        static size_t const default_capacity = 1000;
+
+        /**
+         * Creates a cache that can hold at most default_capacity entries.
+         */
+        HashRecordCache() : HashRecordCache{default_capacity} { }
+
+        /**
+         * @param capacity: maximum amount of RecordCores that this instance can hold at any time.
+         * A value of 0 disables the limit, thus storing every RecordCore received. Use with caution.
+         */
+        HashRecordCache(size_t capacity);
+
+        HashRecordCache(HashRecordCache const & other);
+
+        HashRecordCache & operator=(HashRecordCache const & other);
+
+        /**
+         * For a given Record, returns a vector of errors for the variants that are duplicated, following the rules
+         * of RecordCache::check_duplicates.
+         */
+        std::vector<std::unique_ptr<Error>> check_duplicates(const Record &record);
+
+        /**
+         * Gives every variant checked from now on to `runs` instead of holding it, so no duplicates are returned
+         * while checking, and they are all found by ExternalRecordCache::find_duplicates at the end. Only valid
+         * before checking any variant.
+         */
+        void spill_to(std::shared_ptr<ExternalRecordCache> runs);
+
+        /**
+         * Adds the variants forgotten from now on to `filter`, and checks there the ones not found in the cache, so
+         * their duplicates further away are found by DuplicateFilter::find_duplicates at the end. Only valid before
+         * checking any variant.
+         */
+        void filter_forgotten(std::shared_ptr<DuplicateFilter> filter);
+
+        /**
+         * Whether no variant has been checked by this cache (even if it was later removed)
+         */
+        bool empty() const;
+
+        /**
+         * Approximate bytes taken by the variants held, not counting alleles too long to be stored inline
+         */
+        size_t allocated_bytes() const;
+
+        /**
+         * Smallest line of the variants held, which may still be reported as duplicated by a later one. If there
+         * are none, the maximum size_t.
+         */
+        size_t first_line() const;
+
+        /**
+         * Whether all the variants that this cache holds are smaller than those ever checked by `later`. In that
+         * case, `later` would have found the same duplicates if it had started with the contents of this cache.
+         */
+        bool precedes(HashRecordCache const & later) const;
+
+        /**
+         * Adds the variants held by a cache that checked the records following the ones checked by this one, as if
+         * this cache had checked them all. The cache must precede `later`.
+         */
+        void append(HashRecordCache const & later);
+
+        /**
+         * Writes the capacity and the variants held, so a cache can continue from them in another process, where
+         * the contigs may have other ids
+         */
+        void save(std::ostream & output) const;
+
+        /**
+         * Replaces the capacity and the variants held with those written by save
+         *
+         * @throw std::runtime_error if the input is not like save writes it
+         */
+        void load(std::istream & input);
+
+      private:
+        struct Entry
+        {
+            uint64_t hash;
+            RecordCore record_core;
+        };
+
+        /**
+         * A reference block that starts at the contig and position of the blocks held
+         */
+        struct ReferenceBlock
+        {
+            size_t line;
+            std::string reference_allele;
+            std::string alternate_allele;
+        };
+
+        std::vector<std::unique_ptr<Error>> check_reference_block(Record const & record);
+
+        /**
+         * Counts the variants held that are the same as `allele`, and keeps the smallest line among them
+         */
+        size_t count_matches(Record const & record, NormalizedAllele const & allele, uint64_t hash,
+                             size_t & first_line) const;
+
+        /**
+         * Whether some reference blocks are held, and they are in the contig of `record`
+         */
+        bool same_block_contig(Record const & record) const;
+
+        std::vector<RecordCore> block_cores() const;
+
+        static uint64_t hash_of(Record const & record, NormalizedAllele const & allele);
+
+        static uint64_t hash_of(ContigId contig, std::string const & chromosome, size_t position,
+                                char const * reference, size_t reference_length,
+                                char const * alternate, size_t alternate_length);
+
+        Entry const & entry(uint64_t sequence) const;
+
+        void insert(uint64_t hash, RecordCore record_core);
+
+        /**
+         * Puts the last `count` entries in the order of their RecordCores
+         */
+        void sort_newest(size_t count);
+
+        /**
+         * Forgets the oldest variants until there are at most `capacity`, unless unlimited is true
+         */
+        void shrink_to_fit();
+
+        size_t capacity;    ///< max amount of RecordCores that the cache can hold
+        bool unlimited;     ///< if true, the queue is not capped and will not erase any RecordCore
+        std::deque<Entry> entries;  ///< from the oldest to the newest
+        uint64_t first_sequence;    ///< of the oldest entry; each one gets the next number when inserted
+        std::unordered_multimap<uint64_t, uint64_t> sequences_by_hash;
+        std::unique_ptr<RecordCore> smallest;  ///< smallest RecordCore ever checked, even if erased since
+        std::vector<NormalizedAllele> alleles;  ///< reused to normalize every record
+        std::shared_ptr<ExternalRecordCache> spilled;  ///< if set, gets every variant instead
+        std::shared_ptr<DuplicateFilter> filter;        ///< if set, gets the variants forgotten
+        std::vector<ReferenceBlock> blocks;     ///< reference blocks starting where the last one checked started
+        std::string blocks_chromosome;
+        ContigId blocks_contig;
+        size_t blocks_position;
+    };
+  }
+}
+
+#endif // VCF_HASH_RECORD_CACHE_HPP
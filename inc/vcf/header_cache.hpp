@@ -0,0 +1,112 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VCF_HEADER_CACHE_HPP
+#define VCF_HEADER_CACHE_HPP
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "vcf/error.hpp"
+#include "vcf/report_writer.hpp"
+#include "vcf/validator.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    /**
+     * Header of a file that was validated without errors: its text, and a parser that parsed it, from which
+     * the parsers of the body of any file with the same header are created.
+     */
+    struct CachedHeader
+    {
+        std::string text;           /**< Meta section and header line, byte by byte */
+        ValidationLevel level;
+        bool profiled;              /**< Whether the parser measures its checks, which makes it of another type */
+
+        /** Parsed the header and ran the checks of the meta section, only used to create body parsers */
+        std::shared_ptr<ParserImpl const> parser;
+
+        /** Reported for the header, all of them warnings */
+        std::vector<std::unique_ptr<Error>> warnings;
+
+        /**
+         * Writes a copy of the warnings of the header to the outputs, like the validation of the header does
+         */
+        void report(std::vector<std::unique_ptr<ReportWriter>> & outputs) const;
+    };
+
+    /**
+     * Headers validated before, addressed by their content, so the files of a batch that share the same meta
+     * section (the shards of a file, or the files of each sample of a cohort) only parse and check it once.
+     *
+     * The headers are indexed by a 64-bit hash of their bytes, and only those with the same hash are compared in
+     * full. At most `capacity` headers are kept, forgetting the oldest first. The cache is shared by the jobs of a
+     * batch, so every method is thread-safe; a CachedHeader is never modified once added, and its parser is only
+     * used through body_parser, so it can be read by several jobs at the same time.
+     */
+    class HeaderCache
+    {
+      public:
+        static size_t const default_capacity = 64;
+
+        explicit HeaderCache(size_t capacity = default_capacity);
+
+        /**
+         * FNV-1a of the bytes of a header
+         */
+        static uint64_t digest(char const * begin, char const * end);
+
+        /**
+         * The header with the same text, validated at the same level, or nullptr if there is none
+         */
+        std::shared_ptr<CachedHeader const> find(char const * begin, char const * end, ValidationLevel level,
+                                                 bool profiled);
+
+        /**
+         * Keeps a header, unless an equal one was added meanwhile by another job
+         */
+        void add(std::shared_ptr<CachedHeader const> header);
+
+        size_t size() const;
+
+        /**
+         * Number of calls to find that returned a header, and that returned nullptr
+         */
+        size_t hits() const;
+        size_t misses() const;
+
+      private:
+        std::shared_ptr<CachedHeader const> find_locked(uint64_t hash, char const * begin, char const * end,
+                                                        ValidationLevel level, bool profiled) const;
+
+        size_t capacity;
+        std::unordered_multimap<uint64_t, std::shared_ptr<CachedHeader const>> headers;
+        std::deque<std::pair<uint64_t, CachedHeader const *>> added;    /**< Oldest first, to forget them */
+        size_t n_hits;
+        size_t n_misses;
+        mutable std::mutex mutex;
+    };
+  }
+}
+
+#endif // VCF_HEADER_CACHE_HPP
@@ -0,0 +1,41 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VCF_LINE_SCANNER_HPP
+#define VCF_LINE_SCANNER_HPP
+
+namespace ebi
+{
+  namespace vcf
+  {
+
+    /**
+     * Checks quickly whether the body line starting at `begin` is one that the state machines of every version
+     * accept without any error, so that validating only the syntax can skip it.
+     *
+     * Only the most usual shape of each column is recognized: a chromosome without '<' '>', simple numbers,
+     * alleles made of bases, '*' or a symbolic <ID>, and any printable text in ID, FILTER, INFO values and samples
+     * where the grammars allow it. Anything else, like breakends, Inf/NaN or spaces, is left to the state machine,
+     * even if it is valid, and so are the lines that don't end before `end`.
+     *
+     * @return the beginning of the next line, or nullptr if the line must be parsed
+     */
+    char const * skip_valid_body_line(char const * begin, char const * end);
+
+  }
+}
+
+#endif // VCF_LINE_SCANNER_HPP
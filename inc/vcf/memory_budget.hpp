@@ -0,0 +1,141 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VCF_MEMORY_BUDGET_HPP
+#define VCF_MEMORY_BUDGET_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <ostream>
+#include <string>
+
+namespace ebi
+{
+  namespace vcf
+  {
+
+    /**
+     * Parts of a validation whose memory depends on the input or on the options
+     */
+    enum class MemoryArea : size_t
+    {
+        input_buffers,      /**< Blocks read ahead and decompressed */
+        header,             /**< Meta entries and sample names */
+        line_buffers,       /**< Tokens of the longest line */
+        record_cache,       /**< Variants kept to find duplicates */
+        pending_records,    /**< Records queued to be checked by several threads */
+        parsed_reports,     /**< Errors and warnings of a block, before they are written */
+        queued_reports      /**< Errors and warnings waiting to be written by a report thread */
+    };
+
+    size_t const n_memory_areas = static_cast<size_t>(MemoryArea::queued_reports) + 1;
+
+    /**
+     * Sizes of the buffers and caches of a validation, and the most memory each area has used.
+     *
+     * By default, the sizes are the usual ones and nothing is limited. With a limit, the input is read in smaller
+     * blocks, the report threads queue fewer errors, and the cache for duplicates keeps fewer variants (so a
+     * duplicate further away may not be found), until the estimated total fits.
+     *
+     * The high-water marks are estimates of the bytes of each area, raised by the validation while it runs. It can
+     * be shared by several threads.
+     */
+    class MemoryBudget
+    {
+      public:
+        /**
+         * Memory taken by the program and the structures that don't depend on the input
+         */
+        static size_t const base_memory = 16 * 1024 * 1024;
+
+        /**
+         * Smallest limit that can be met
+         */
+        static size_t const min_limit = 32 * 1024 * 1024;
+
+        /**
+         * Approximate bytes of a variant in the cache for duplicates, and of a queued error
+         */
+        static size_t const cached_variant_size = 192;
+        static size_t const queued_error_size = 320;
+
+        /**
+         * The usual sizes, with no limit
+         */
+        MemoryBudget();
+
+        /**
+         * Sizes that fit in `limit` bytes, validating with `threads` threads and writing `outputs` reports
+         *
+         * @throw std::invalid_argument if the limit is smaller than min_limit
+         */
+        MemoryBudget(size_t limit, size_t threads, size_t outputs);
+
+        MemoryBudget(MemoryBudget const &) = delete;
+        MemoryBudget & operator=(MemoryBudget const &) = delete;
+
+        size_t limit;                   /**< 0 if there is none */
+        size_t block_size;
+        size_t read_ahead_buffers;
+        size_t record_cache_capacity;
+        size_t max_queued_errors;       /**< Per report */
+
+        /**
+         * If not empty, every variant is kept to find all the duplicates exactly, instead of only the last
+         * record_cache_capacity: they are sorted in runs of sorted_run_capacity written to temporary files in this
+         * directory, and merged at the end
+         */
+        std::string spill_directory;
+        size_t sorted_run_capacity;
+
+        /**
+         * If not 0, the variants forgotten by the cache for duplicates are added to a Bloom filter sized for this
+         * many, with that false positive rate, so their duplicates further away are also found at the end
+         */
+        size_t filtered_variants;
+        double false_positive_rate;
+
+        /**
+         * Whether some duplicates are only found once the whole input has been read
+         */
+        bool finds_duplicates_at_end() const;
+
+        /**
+         * Raises the high-water mark of an area to `bytes`, if it was lower
+         */
+        void record(MemoryArea area, size_t bytes);
+
+        size_t high_water_mark(MemoryArea area) const;
+
+        /**
+         * Writes the high-water mark of each area, and the peak resident memory of the process
+         */
+        void write(std::ostream & output) const;
+
+        /**
+         * Most resident memory ever used by this process, in bytes
+         */
+        static size_t peak_rss();
+
+      private:
+        std::array<std::atomic<size_t>, n_memory_areas> high_water_marks;
+    };
+
+  }
+}
+
+#endif // VCF_MEMORY_BUDGET_HPP
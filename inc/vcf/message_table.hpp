@@ -0,0 +1,62 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VCF_MESSAGE_TABLE_HPP
+#define VCF_MESSAGE_TABLE_HPP
+
+#include <cstddef>
+#include <deque>
+#include <string>
+#include <unordered_map>
+
+namespace ebi
+{
+  namespace vcf
+  {
+    /**
+     * Identifier of a message in a MessageTable: equal messages get the same id, so errors can be grouped by an
+     * integer instead of comparing their texts
+     */
+    using MessageId = size_t;
+
+    /**
+     * Messages of the types of error seen by a report. Each report has its own table, so it is not shared between
+     * threads and it is released with the report. It only keeps the messages without values (see
+     * Error::type_message), so it doesn't grow with the number of errors.
+     */
+    class MessageTable
+    {
+      public:
+        /**
+         * Adds the message to the table if it was not there yet
+         *
+         * @return id of the message
+         */
+        MessageId intern(std::string const & message);
+
+        /**
+         * @return text of a message returned by intern
+         */
+        std::string const & text(MessageId id) const;
+
+      private:
+        std::unordered_map<std::string, MessageId> ids;
+        std::deque<std::string> texts;    // a deque doesn't move its elements, so the texts can be returned by reference
+    };
+  }
+}
+
+#endif // VCF_MESSAGE_TABLE_HPP
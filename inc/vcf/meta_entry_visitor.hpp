@@ -30,7 +30,7 @@ namespace ebi
   {
     class MetaEntryVisitor : public boost::static_visitor<>
     {
-        MetaEntry entry;
+        MetaEntry const & entry;
 
     public:
         MetaEntryVisitor(MetaEntry const & entry);
@@ -53,7 +53,7 @@ namespace ebi
         void check_info_type(std::string const & type_field) const;
         void check_predefined_tag(std::string const & tag_field, std::string const & meta_entry_property,
                                   std::map<std::string, std::string> & meta_entry,
-                                  std::map<std::string, std::pair<std::string, std::string>> const & predefined_meta_entries) const;
+                                  PredefinedTagTable const & predefined_meta_entries) const;
         void check_sample(std::map<std::string, std::string> & value) const;
     };
 
@@ -29,13 +29,15 @@ namespace ebi
     {
         size_t line;
         std::string chromosome;
+        ContigId contig;    /**< Interned chromosome, if known */
         size_t position;
         std::string reference_allele;
         std::string alternate_allele;
         
         RecordCore(size_t line, const std::string &chromosome, size_t position, 
-                   const std::string &reference_allele, const std::string &alternate_alleles) 
-            : line(line), chromosome(chromosome), position(position), 
+                   const std::string &reference_allele, const std::string &alternate_alleles,
+                   ContigId contig = unknown_contig)
+            : line(line), chromosome(chromosome), contig(contig), position(position),
               reference_allele(reference_allele), alternate_allele(alternate_alleles)
         { }
         
@@ -49,10 +51,45 @@ namespace ebi
         
         /**
          * Equality test without taking into account the line number; only chromosome, position, reference and alternate.
+         * The chromosomes are compared by their ids if both are known.
          */
         bool operator==(const RecordCore &other) const;
     };
     std::ostream &operator<<(std::ostream &os, const RecordCore &record);
+
+    /**
+     * One variant of a normalized record, as ranges of its alleles instead of copies of them.
+     */
+    struct NormalizedAllele
+    {
+        size_t position;            /**< Corrected position */
+        size_t alternate_index;     /**< Index of the alternate in Record::alternate_alleles */
+        size_t reference_begin;
+        size_t reference_length;
+        size_t alternate_begin;
+        size_t alternate_length;
+    };
+
+    /**
+     * Same normalization as `normalize(record)`, written into `alleles`, which is cleared first. The buffer can be
+     * reused for every record, so that normalizing doesn't allocate memory once it is big enough.
+     */
+    void normalize_alleles(const Record &record, std::vector<NormalizedAllele> &alleles);
+
+    /**
+     * Same normalization as `normalize_right_alignment(record)`, written into `alleles`, which is cleared first.
+     */
+    void normalize_alleles_right_alignment(const Record &record, std::vector<NormalizedAllele> &alleles);
+
+    /**
+     * Copies the trimmed alleles of a variant of `record` into a RecordCore
+     */
+    RecordCore make_record_core(const Record &record, const NormalizedAllele &allele);
+
+    /**
+     * Same test as RecordCore::operator==, without building a RecordCore for the variant of `record`
+     */
+    bool same_variant(const RecordCore &record_core, const Record &record, const NormalizedAllele &allele);
     
     /**
      * normalizes a record and returns a vector of RecordCores.
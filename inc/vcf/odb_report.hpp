@@ -33,17 +33,27 @@ namespace ebi
 {
   namespace vcf
   {
+    /**
+     * Report stored in a SQLite database.
+     *
+     * The errors are inserted in transactions of `transaction_size` rows, through a single connection set up for
+     * a fast bulk ingest: no synchronous writes and the rollback journal kept in memory. A report that could not be
+     * finished is not worth recovering, the validation can be run again. The indexes used by the readers are
+     * created by flush, when all the rows are already there.
+     */
     class OdbReportRW : public ReportWriter, public ReportReader
     {
       public:
+        static size_t const default_transaction_size = 1000000;
 
-        OdbReportRW(const std::string &db_name);
+        OdbReportRW(const std::string &db_name, size_t transaction_size = default_transaction_size);
         virtual ~OdbReportRW();
         void flush();   // before reading, make sure you destroy or flush the writer OdbReportRW
 
         // ReportWriter implementation
         virtual void write_error(Error &error) override;
         virtual void write_warning(Error &error) override;
+        virtual void write_batch(std::vector<ReportedError> const & batch) override;
         virtual void write_message(const std::string &report_result) override;
 
         // ReportReader implementation
@@ -57,11 +67,15 @@ namespace ebi
       private:
         std::string db_name;
         std::unique_ptr<odb::core::database> db;
+        odb::core::connection_ptr ingest_connection;    // only while writing, it keeps the same prepared statements
         odb::core::transaction transaction;
         size_t current_transaction_size;
         const size_t transaction_size;
 
         void write(Error &error);
+        void start_ingest();
+        void commit_batch();
+        void finish_ingest();
         void for_each(std::function<void(std::shared_ptr<Error>)> user_function, odb::query<Error> query);
         size_t count(odb::query<ErrorCount> query);
     };
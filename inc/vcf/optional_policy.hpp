@@ -19,6 +19,7 @@
 
 #include "file_structure.hpp"
 #include "parsing_state.hpp"
+#include "profile_policy.hpp"
 #include "record.hpp"
 #include "error.hpp"
 
@@ -33,38 +34,47 @@ namespace ebi
     class IgnoreOptionalPolicy
     {
       public:
-        void optional_check_meta_section(ParsingState const & state) const {}
-        void optional_check_body_entry(ParsingState & state, Record & record) {}
-        void optional_check_body_section(ParsingState const & state) const {}
+        Error * optional_check_meta_section(ParsingState const & state) const { return nullptr; }
+        Error * optional_check_body_entry(ParsingState & state, Record const & record) { return nullptr; }
+        Error * optional_check_body_section(ParsingState const & state) const { return nullptr; }
     };
     
     /**
      * Validation policy that runs optional and context-based validations
+     *
+     * Each check returns the first warning found, owned by the caller, or nullptr if there is none. If the state has
+     * a profile, the time of each check is added to it.
      */
     class ValidateOptionalPolicy
     {
       public:
-        void optional_check_meta_section(ParsingState const & state) const;
-        void optional_check_body_entry(ParsingState & state, Record const & record) ;//const;
-        void optional_check_body_section(ParsingState const & state) const;
+        Error * optional_check_meta_section(ParsingState const & state) const;
+        Error * optional_check_body_entry(ParsingState & state, Record const & record) ;//const;
+        Error * optional_check_body_section(ParsingState const & state) const;
 
       private:
-        void check_body_entry_position_zero(ParsingState & state, Record const & record) const;
-        void check_body_entry_id_commas(ParsingState & state, Record const & record) const;
-        void check_body_entry_reference_alternate_matching(ParsingState & state, Record const & record);
-        void check_body_entry_alt_gvcf_gt_value(ParsingState & state, Record const & record) const;
-        bool sample_has_reference_in_all_alleles(std::string const & sample) const;
-        void check_body_entry_info_gvcf_end(ParsingState & state, Record const & record) const;
-        void check_body_entry_info_imprecise(ParsingState & state, Record const & record) const;
-        void check_body_entry_info_other_tag(ParsingState & state, std::multimap<std::string, std::string> const & info,
-                                             std::string const & tag) const;
-        void check_body_entry_info_svlen(ParsingState & state, Record const & record) const;
-        void check_body_entry_info_confidence_interval(ParsingState & state, Record const & record) const;
-        void check_contig_meta(ParsingState & state, Record const & record) const;
-        void check_alternate_allele_meta(ParsingState & state, Record const & record) const;
-        void check_filter_meta(ParsingState & state, Record const & record) const;
-        void check_info_meta(ParsingState & state, Record const & record) const;
-        void check_format_meta(ParsingState & state, Record const & record) const;
+        /**
+         * Runs the checks of optional_check_body_entry, each one measured with ProfilePolicy::measure
+         */
+        template <typename ProfilePolicy>
+        Error * run_body_entry_checks(ParsingState & state, Record const & record);
+
+        Error * check_meta_section_reference(ParsingState const & state) const;
+        Error * check_body_entry_position_zero(ParsingState & state, Record const & record) const;
+        Error * check_body_entry_id_commas(ParsingState & state, Record const & record) const;
+        Error * check_body_entry_reference_alternate_matching(ParsingState & state, Record const & record);
+        Error * check_body_entry_alt_gvcf_gt_value(ParsingState & state, Record const & record) const;
+        Error * check_body_entry_info_gvcf_end(ParsingState & state, Record const & record) const;
+        Error * check_body_entry_info_imprecise(ParsingState & state, Record const & record) const;
+        Error * check_body_entry_info_other_tag(ParsingState & state, std::multimap<std::string, std::string> const & info,
+                                                std::string const & tag) const;
+        Error * check_body_entry_info_svlen(ParsingState & state, Record const & record) const;
+        Error * check_body_entry_info_confidence_interval(ParsingState & state, Record const & record) const;
+        Error * check_contig_meta(ParsingState & state, Record const & record) const;
+        Error * check_alternate_allele_meta(ParsingState & state, Record const & record) const;
+        Error * check_filter_meta(ParsingState & state, Record const & record) const;
+        Error * check_info_meta(ParsingState & state, Record const & record) const;
+        Error * check_format_meta(ParsingState & state, Record const & record) const;
     };
     
   }
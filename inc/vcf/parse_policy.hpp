@@ -17,12 +17,14 @@
 #ifndef VCF_PARSE_POLICY_HPP
 #define VCF_PARSE_POLICY_HPP
 
+#include <array>
 #include <map>
 #include <string>
 #include <vector>
 
 #include "parsing_state.hpp"
 #include "file_structure.hpp"
+#include "line_scanner.hpp"
 #include "util/string_utils.hpp"
 #include "error.hpp"
 
@@ -37,46 +39,94 @@ namespace ebi
     class IgnoreParsePolicy
     {
       public:
-        void handle_token_begin(ParsingState const & state) {}
-        void handle_token_char(ParsingState const & state, char c) {}
+        void handle_buffer_begin(ParsingState const & state, char const * p) {}
+        void handle_buffer_end(ParsingState const & state, char const * pe) {}
+
+        void handle_token_begin(ParsingState const & state, char const * p) {}
+        void handle_token_char(ParsingState const & state, char const * p) {}
         void handle_token_end(ParsingState const & state) {}
-        void handle_token_end(ParsingState const & state, std::string token) {}
-        void handle_newline(ParsingState const & state) {}
+        void handle_token_end(ParsingState const & state, char const * token) {}
+        void handle_newline(ParsingState const & state, char const * p) {}
         
         void handle_fileformat(ParsingState const & state) {}
         
         void handle_meta_typeid(ParsingState const & state) {}
-        void handle_meta_typeid(ParsingState const & state, std::string type_id) {}
+        void handle_meta_typeid(ParsingState const & state, char const * type_id) {}
         void handle_meta_line(ParsingState const & state) {}
         
         void handle_sample_name(ParsingState const & state) {}
         void handle_header_line(ParsingState const & state) {}
         
         void handle_column_end(ParsingState const & state, size_t n_columns) {}
-        void handle_body_line(ParsingState & state) {}
+        Error * handle_body_line(ParsingState & state) { return nullptr; }
+        Error * handle_checked_record(ParsingState & state, Record const & record) { return nullptr; }
         
         std::string current_token() const { return ""; }
         
         std::vector<std::string> column_tokens(std::string const & column) const { return {}; }
+
+        size_t line_buffers_size() const { return 0; }
+        size_t header_size() const { return 0; }
+
+        /**
+         * The body lines that are certainly valid don't need to be parsed, as nothing is kept from them. Only
+         * called at the beginning of a body line.
+         *
+         * @return the beginning of the first line to parse
+         */
+        static bool const skips_valid_lines = true;
+        char const * skip_valid_lines(ParsingState & state, char const * p, char const * pe)
+        {
+            for (char const * next = skip_valid_body_line(p, pe); next != nullptr; next = skip_valid_body_line(p, pe)) {
+                ++state.n_lines;
+                p = next;
+            }
+            return p;
+        }
     };
 
     /**
      * Parsing policy that stores the parsed tokens for more thorough validations or future usage
+     *
+     * Tokens are stored as positions in the line being parsed, and are only copied into strings when a
+     * MetaEntry or Record is built. The part of the line that was read in a previous buffer is copied when
+     * that buffer ends, so tokens can span several buffers.
      */
     class StoreParsePolicy
     {
       public:
+        StoreParsePolicy();
+
+        void handle_buffer_begin(ParsingState const & state, char const * p);
+        void handle_buffer_end(ParsingState const & state, char const * pe);
+
+        void handle_token_begin(ParsingState const & state, char const * p);
+
+        /**
+         * Called for every character of every token, so the usual case of a token that is a contiguous part of
+         * the line is inlined
+         */
+        void handle_token_char(ParsingState const & state, char const * p)
+        {
+            if (!m_current_token.owned && line_offset(p) == m_current_token.offset + m_current_token.size) {
+                ++m_current_token.size;
+                return;
+            }
+            append_token_char(p);
+        }
 
-        void handle_token_begin(ParsingState const & state);
-        void handle_token_char(ParsingState const & state, char c);
         void handle_token_end(ParsingState const & state);
-        void handle_token_end(ParsingState const & state, std::string token);
-        void handle_newline(ParsingState const & state);
+
+        /**
+         * Stores a token implied by the grammar, like the keys of the meta entries that must be in order
+         */
+        void handle_token_end(ParsingState const & state, char const * token);
+        void handle_newline(ParsingState const & state, char const * p);
         
         void handle_fileformat(ParsingState & state);
         
         void handle_meta_typeid(ParsingState const & state);
-        void handle_meta_typeid(ParsingState const & state, std::string type_id);
+        void handle_meta_typeid(ParsingState const & state, char const * type_id);
         void handle_meta_line(ParsingState & state);
         
         
@@ -84,20 +134,151 @@ namespace ebi
         void handle_header_line(ParsingState & state);
         
         void handle_column_end(ParsingState const & state, size_t n_columns);
-        void handle_body_line(ParsingState & state);
+
+        /**
+         * Builds the record of the body line and validates it, unless it's queued to be checked later
+         *
+         * @return the first error of the line, owned by the caller, or nullptr if there are none
+         */
+        Error * handle_body_line(ParsingState & state);
+
+        /**
+         * Checks a pending record against the previous ones, once Record::check has passed
+         *
+         * @return the error found, owned by the caller, or nullptr
+         */
+        Error * handle_checked_record(ParsingState & state, Record const & record);
         
         std::string current_token() const;
         
         std::vector<std::string> column_tokens(std::string const & column) const;
 
+        /**
+         * Bytes reserved for the tokens of a line, which grow to fit the longest line parsed
+         */
+        size_t line_buffers_size() const;
+
+        /**
+         * Approximate bytes of the meta entries and sample names stored
+         */
+        size_t header_size() const;
+
+        /**
+         * Every line is parsed, because its tokens are needed
+         */
+        static bool const skips_valid_lines = false;
+        char const * skip_valid_lines(ParsingState & state, char const * p, char const * pe);
+
       private:
 
-        void check_sorted(ParsingState &state, size_t position);
+        /**
+         * Position of a token in the current line, or in m_owned_chars if it is not a contiguous part of the line
+         */
+        struct TokenView
+        {
+            size_t offset;
+            size_t size;
+            bool owned;
+        };
+
+        /**
+         * Range of tokens in m_line_tokens
+         */
+        struct TokenRange
+        {
+            size_t begin;
+            size_t end;
+        };
+
+        /**
+         * Columns before the samples, numbered from 1 like ParsingState::n_columns
+         */
+        enum Column : size_t
+        {
+            CHROM_COLUMN = 1, POS_COLUMN, ID_COLUMN, REF_COLUMN, ALT_COLUMN,
+            QUAL_COLUMN, FILTER_COLUMN, INFO_COLUMN, FORMAT_COLUMN
+        };
+
+        static size_t const n_fixed_columns = FORMAT_COLUMN;
+
+        /**
+         * Length from which the buffers of a line are released after parsing it, instead of reused for the next
+         */
+        static size_t const long_line_size;
+
+        Error * check_sorted(ParsingState &state, ContigId contig, std::string const & chromosome, size_t position);
+
+        size_t line_offset(char const * p) const
+        {
+            return m_line_carry.size() + static_cast<size_t>(p - m_buffer_begin);
+        }
+
+        /**
+         * Adds a character to the current token, copying it to m_owned_chars if it wasn't already
+         */
+        void append_token_char(char const * p);
+
+        TokenRange grouped_tokens() const;
+
+        std::string token_string(TokenView const & token) const;
+        void token_string(TokenView const & token, std::string & token_chars) const;
+
+        /**
+         * Offset in the token of the first `c` at or after `from`, or the size of the token if there is none
+         */
+        size_t token_find(TokenView const & token, char c, size_t from) const;
+
+        /**
+         * Part of a token, from `begin` to `end` relative to its start
+         */
+        static TokenView sub_token(TokenView const & token, size_t begin, size_t end)
+        {
+            return TokenView{token.offset + begin, end - begin, token.owned};
+        }
+
+        /**
+         * Frees the buffers grown by a long line, so that they don't stay allocated for the rest of the file
+         */
+        void release_line_buffers();
+
+        std::vector<std::string> token_strings(TokenRange range) const;
+        void token_strings(TokenRange range, std::vector<std::string> & strings) const;
+
+        /**
+         * First token of a column, or an empty string if the column has no tokens
+         */
+        void column_token(size_t column, std::string & token_chars) const;
+
+        std::vector<std::string> column_strings(size_t column) const;
+        void column_strings(size_t column, std::vector<std::string> & strings) const;
+
+        std::vector<std::string> sample_strings() const;
+        void sample_strings(std::vector<std::string> & samples) const;
+
+        /**
+         * Copies the samples of the line as a single string, separated by tabs like they were read
+         */
+        void unsplit_sample_string(std::string & samples) const;
+
+        /**
+         * Start of the current buffer, or of the current line if it began in the current buffer
+         */
+        char const * m_buffer_begin;
+
+        /**
+         * Part of the current line contained in previous buffers
+         */
+        std::string m_line_carry;
+
+        /**
+         * Characters of the tokens that are not a contiguous part of the input
+         */
+        std::string m_owned_chars;
 
         /**
          * Token being currently parsed
          */
-        std::string m_current_token;
+        TokenView m_current_token;
         
         /**
          * Token that acts as type ID for the whole line, like ALT/FILTER in meta entries
@@ -105,37 +286,45 @@ namespace ebi
         std::string m_line_typeid;
         
         /**
-         * Tokens that must be grouped, like all key-value pairs in the INFO column
+         * All the tokens read in a line. It acts as an arena that is reset, and not freed, with every new line
          */
-        std::vector<std::string> m_grouped_tokens;
-        
+        std::vector<TokenView> m_line_tokens;
+
         /**
-         * Tokens read in a line and grouped by an ID
+         * First token of the group being read, like all key-value pairs in the INFO column
          */
-        std::map<std::string, std::vector<std::string>> m_line_tokens;
+        size_t m_group_begin;
 
         /**
-         * Tool to check that the chromosomes (and contigs) are contiguous.
-         * 
-         * Map keys are contig names, and the values flag whether they have been "fully read". Values mean the following:
-         * - Not found in the map: This contig has not appeared yet.
-         * - False: This contig has been found but not all its records have been listed yet.
-         * - True: Previously read records belonged to this contig and a record of another contig has been already found, 
-         *         so the former is considered "fully read".
-         * 
-         * For a contig block to be contiguous, no record should be found that belongs to a "fully read" contig.
+         * Tokens of each column before the samples, indexed by column number minus one
          */
-        std::map<std::string, bool> finished_contigs;
-        
+        std::array<TokenRange, n_fixed_columns> m_columns;
+
         /**
-         * Contig name previously read.
+         * Samples are stored as a single token each
          */
-        std::string previous_contig;
+        std::vector<TokenView> m_sample_tokens;
 
         /**
-         * Position previously read within a contig.
+         * Copies of the tokens of the last body line. They are overwritten with every line, so once they have grown
+         * enough, building a record doesn't allocate strings
          */
-        size_t previous_position;
+        struct RecordFields
+        {
+            std::string chromosome;
+            std::string position;
+            std::vector<std::string> ids;
+            std::string reference;
+            std::vector<std::string> alternates;
+            std::string quality;
+            std::vector<std::string> filters;
+            std::vector<std::string> format;
+            std::vector<std::string> samples;
+        };
+
+        RecordFields m_record_fields;
+
+        size_t m_header_size;
     };
       
   }
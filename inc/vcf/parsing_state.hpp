@@ -17,19 +17,140 @@
 #ifndef VCF_PARSING_STATE_HPP
 #define VCF_PARSING_STATE_HPP
 
+#include <functional>
 #include <map>
+#include <cstdint>
 #include <memory>
 #include <stdexcept>
 #include <string>
 #include <vector>
 #include "file_structure.hpp"
 #include "error.hpp"
+#include "error_type_counts.hpp"
 #include "normalizer.hpp"
 
 namespace ebi
 {
+  namespace util
+  {
+    class WorkerPool;
+  }
+
   namespace vcf
   {
+
+    /**
+     * Order of the records read so far, to check that the chromosomes (and contigs) are contiguous and sorted
+     */
+    struct RecordOrder
+    {
+        /**
+         * Whether a contig has been "fully read":
+         * - UNSEEN: This contig has not appeared yet.
+         * - READING: This contig has been found but not all its records have been listed yet.
+         * - FINISHED: Previously read records belonged to this contig and a record of another contig has been already
+         *             found, so the former is considered "fully read".
+         *
+         * For a contig block to be contiguous, no record should be found that belongs to a "fully read" contig.
+         */
+        enum class ContigStatus : unsigned char { UNSEEN, READING, FINISHED };
+
+        /**
+         * Status of each contig, indexed by its id; those beyond the end are UNSEEN
+         */
+        std::vector<ContigStatus> contig_status;
+
+        /**
+         * Number of contigs that are not UNSEEN
+         */
+        size_t seen_contigs;
+
+        /**
+         * Contig previously read, the only one that can be READING.
+         */
+        ContigId previous_contig;
+
+        /**
+         * Position previously read within a contig.
+         */
+        size_t previous_position;
+
+        /**
+         * Contig and position of the first record, to join the order of parts of a file read separately
+         */
+        ContigId first_contig;
+        size_t first_position;
+
+        RecordOrder();
+
+        ContigStatus status(ContigId contig) const;
+
+        void set_status(ContigId contig, ContigStatus status);
+    };
+
+    /**
+     * Chooses the records that get every check, when only some of them are validated in depth to triage a file
+     * quickly. The others only get their syntax, order and duplicates checked. The choice depends on the line of each
+     * record alone, so it is the same however the body is split between parsers.
+     */
+    class RecordSampling
+    {
+      public:
+        /**
+         * Every record
+         */
+        RecordSampling();
+
+        /**
+         * One of every `period` records: those whose line is a multiple of it
+         */
+        static RecordSampling every(size_t period);
+
+        /**
+         * Roughly a `fraction` of the records, spread at random; the same ones with the same seed
+         */
+        static RecordSampling random(double fraction, uint64_t seed = 0);
+
+        bool selects(size_t line) const
+        {
+            return period != 0 ? line % period == 0 : mix(line ^ seed) < threshold;
+        }
+
+        bool selects_all() const;
+
+        /**
+         * Expected fraction of the records selected
+         */
+        double rate() const;
+
+        /**
+         * Which records are selected, like "1 of every 10 records", for the reports
+         */
+        std::string description() const;
+
+      private:
+        static uint64_t mix(uint64_t value)
+        {
+            value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+            return value ^ (value >> 31);
+        }
+
+        size_t period;          /**< 0 if selected at random */
+        uint64_t threshold;     /**< Of the mixed line, below which a random record is selected */
+        uint64_t seed;
+        double fraction;
+    };
+
+    /**
+     * Body line whose record is checked later, in a batch with the following ones
+     */
+    struct PendingRecord
+    {
+        std::unique_ptr<Record> record;
+        FormatLayout const * layout;
+        Error * error;      /**< Thrown by Record::check, owned until it is reported */
+    };
     
     struct ParsingState
     {
@@ -42,19 +163,110 @@ namespace ebi
         
         std::shared_ptr<Source> source;
         std::unique_ptr<Record> record;
+        std::unique_ptr<Record> recycled;
         std::vector<std::unique_ptr<Error>> errors;
         std::vector<std::unique_ptr<Error>> warnings;
 
-        std::multimap<std::string, std::string> defined_metadata;
+        // Value of n_lines when each error and warning was reported, to keep the report order of the file
+        std::vector<size_t> error_lines_read;
+        std::vector<size_t> warning_lines_read;
+
+        /**
+         * Whether each contig, indexed by its id, has a ##contig meta entry; the rest may be missing
+         */
+        std::vector<bool> described_contigs;
+
+        RecordOrder record_order;
+
+        /**
+         * Records that get every check, the rest only get those that compare them with the others
+         */
+        RecordSampling record_sampling;
+
+        /**
+         * When set, the records are not checked as soon as they are read, but queued in pending_records to be
+         * checked by these threads. Not owned.
+         */
+        util::WorkerPool * workers;
+
+        /**
+         * Only the first n_pending_records are queued, the rest are kept to reuse their memory
+         */
+        std::vector<PendingRecord> pending_records;
+        size_t n_pending_records;
+
+        /**
+         * If set, called with every record that passes its own checks, before comparing it with the previous ones
+         */
+        std::function<void(Record const &)> record_listener;
+
+        /**
+         * If set, the time of each step of the validation is added to it. Not owned.
+         */
+        Profile * profile;
+
+        /**
+         * Most errors and warnings of each type (see ErrorTypeCounts) that are kept, if the reports would drop the
+         * rest, or 0 to keep all of them. Those beyond it are freed as soon as they are reported and only counted
+         * in n_omitted_errors and n_omitted_warnings, until the next clear.
+         */
+        size_t max_reports_per_type;
+        ErrorTypeCounts reports_per_type;
+        size_t n_omitted_errors;
+        size_t n_omitted_warnings;
 
         ParsingState(std::shared_ptr<Source> source);
         virtual ~ParsingState() = default;
 
+        /**
+         * Groups of RecordChecks that Record::validate runs on each record, as the record policy of the parser says
+         */
+        virtual unsigned record_checks() const { return RECORD_CHECK_ALL; }
+
+        /**
+         * Same as record_checks for the record of a line, or none if it isn't in the record_sampling
+         */
+        unsigned record_checks_at(size_t line) const
+        {
+            return record_sampling.selects(line) ? record_checks() : 0;
+        }
+
         void set_version(Version version);
         
-        void add_meta(MetaEntry const & meta);
+        void add_meta(MetaEntry meta);
 
         void set_record(std::unique_ptr<Record> record);
+
+        /**
+         * Returns a record to be reassigned with the next body line, reusing the memory of the previous ones.
+         * The current record is discarded. Once reassigned, it becomes the current record with use_recycled_record.
+         */
+        Record & recycled_record();
+        void use_recycled_record();
+
+        /**
+         * Queues a record to be assigned with the current body line and checked later with check_pending_records
+         */
+        PendingRecord & add_pending_record();
+
+        /**
+         * Runs Record::check for every pending record with the workers, keeping the first error of each one.
+         * The records with many samples are checked one at a time, splitting their samples between the workers.
+         * The records are not removed from the queue, that's done when the results are reported.
+         */
+        void check_pending_records();
+
+        /**
+         * Sorts the errors and warnings by the line being read when they were reported, keeping the order of
+         * those reported in the same line. Only needed if some were reported out of order, like those of pending
+         * records.
+         */
+        void sort_reports();
+
+        /**
+         * Keep an error or warning to be reported, or just count it if there are max_reports_per_type of its type
+         * already
+         */
         void add_error(std::unique_ptr<Error> error);
         void add_warning(std::unique_ptr<Error> error);
         void clear();
@@ -62,10 +274,9 @@ namespace ebi
         std::vector<std::string> const & samples() const;
         
         void set_samples(std::vector<std::string> & samples);
-        
-        bool is_well_defined_meta(std::string const & meta_type, std::string const & id) const;
-        
-        void add_well_defined_meta(std::string const & meta_type, std::string const & id);
+
+      private:
+        bool keeps_report(Severity severity, Error const & error);
     };
   }
 }
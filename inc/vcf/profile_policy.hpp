@@ -0,0 +1,166 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VCF_PROFILE_POLICY_HPP
+#define VCF_PROFILE_POLICY_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+
+namespace ebi
+{
+  namespace vcf
+  {
+
+    /**
+     * Steps of the validation that are measured by a profile
+     */
+    enum class ProfiledStep : size_t
+    {
+        parsing,
+
+        check_chromosome,
+        check_ids,
+        check_alternate_alleles,
+        check_quality,
+        check_filter,
+        check_info,
+        check_format,
+        check_samples,
+
+        check_duplicates,
+
+        optional_check_meta_section,
+        check_body_entry_position_zero,
+        check_body_entry_id_commas,
+        check_body_entry_reference_alternate_matching,
+        check_body_entry_alt_gvcf_gt_value,
+        check_body_entry_info_gvcf_end,
+        check_body_entry_info_imprecise,
+        check_body_entry_info_svlen,
+        check_body_entry_info_confidence_interval,
+        check_contig_meta,
+        check_alternate_allele_meta,
+        check_filter_meta,
+        check_info_meta,
+        check_format_meta,
+
+        report_writing
+    };
+
+    size_t const n_profiled_steps = static_cast<size_t>(ProfiledStep::report_writing) + 1;
+
+    /**
+     * Cumulative time and number of calls of each step of a validation. It can be shared by all the threads of
+     * the validation, the time of the steps run by several threads is the sum of all of them.
+     *
+     * The parsing time excludes the steps measured while parsing in the same thread, so no time is counted twice.
+     */
+    class Profile
+    {
+      public:
+        Profile();
+
+        void add(ProfiledStep step, std::chrono::steady_clock::duration time);
+
+        uint64_t calls(ProfiledStep step) const;
+
+        std::chrono::nanoseconds time(ProfiledStep step) const;
+
+        /**
+         * Writes a table of the steps that were run, from the slowest to the fastest
+         */
+        void write(std::ostream & output) const;
+
+        /**
+         * Time added to any profile by the calling thread
+         */
+        static std::chrono::steady_clock::duration thread_time();
+
+      private:
+        std::array<std::atomic<uint64_t>, n_profiled_steps> m_nanoseconds;
+        std::array<std::atomic<uint64_t>, n_profiled_steps> m_calls;
+    };
+
+    /**
+     * Adds to a step of a profile the time between its construction and its destruction
+     */
+    class ProfileTimer
+    {
+      public:
+        ProfileTimer(Profile & profile, ProfiledStep step);
+        ~ProfileTimer();
+
+      private:
+        Profile & m_profile;
+        ProfiledStep m_step;
+        std::chrono::steady_clock::time_point m_start;
+    };
+
+    /**
+     * Profiling policy that measures nothing, so it compiles away
+     */
+    class IgnoreProfilePolicy
+    {
+      public:
+        struct ParsingTimer
+        {
+            ParsingTimer(Profile * profile) {}
+        };
+
+        template <typename Step>
+        static auto measure(Profile * profile, ProfiledStep step, Step run_step) -> decltype(run_step())
+        {
+            return run_step();
+        }
+    };
+
+    /**
+     * Profiling policy that measures every step in a profile, which must be provided
+     */
+    class MeasureProfilePolicy
+    {
+      public:
+        /**
+         * Adds to the parsing step the time of parsing a buffer, minus the steps measured meanwhile
+         */
+        class ParsingTimer
+        {
+          public:
+            ParsingTimer(Profile * profile);
+            ~ParsingTimer();
+
+          private:
+            Profile & m_profile;
+            std::chrono::steady_clock::time_point m_start;
+            std::chrono::steady_clock::duration m_measured_before;
+        };
+
+        template <typename Step>
+        static auto measure(Profile * profile, ProfiledStep step, Step run_step) -> decltype(run_step())
+        {
+            ProfileTimer timer{*profile, step};
+            return run_step();
+        }
+    };
+
+  }
+}
+
+#endif // VCF_PROFILE_POLICY_HPP
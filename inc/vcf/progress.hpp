@@ -0,0 +1,123 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VCF_PROGRESS_HPP
+#define VCF_PROGRESS_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+
+namespace ebi
+{
+  namespace vcf
+  {
+    class Parser;
+
+    /**
+     * How far a validation has gone
+     */
+    struct Progress
+    {
+        size_t lines;                   /**< Complete lines parsed */
+        uint64_t bytes;                 /**< Bytes parsed, once decompressed */
+        uint64_t input_bytes;           /**< Bytes read from the input, compressed or not */
+        uint64_t input_size;            /**< Size of the whole input, or 0 if unknown (like a pipe) */
+        std::string contig;             /**< Chromosome of the last record parsed, empty if unknown */
+        size_t position;                /**< Position of the last record parsed */
+        size_t errors;
+        size_t warnings;
+        std::chrono::steady_clock::duration elapsed;
+        bool finished;
+
+        double megabytes_per_second() const;
+
+        bool has_eta() const;
+
+        /**
+         * Estimated time until the end of the input, assuming the rest is read at the same speed. Only meaningful
+         * if has_eta().
+         */
+        std::chrono::seconds eta() const;
+    };
+
+    /**
+     * Writes the progress in a single line, to be logged
+     */
+    std::ostream & operator<<(std::ostream & output, Progress const & progress);
+
+    /**
+     * Keeps the progress of a validation, and passes it to a callback at most once every `interval`, and once more
+     * when the validation finishes.
+     *
+     * The validation updates it after parsing each block of the input, which is when the interval is checked, so
+     * it costs nothing per line. The lack of calls for much longer than the interval means the validation is
+     * stuck, for instance waiting for the input.
+     */
+    class ProgressMonitor
+    {
+      public:
+        using Callback = std::function<void(Progress const & progress)>;
+
+        ProgressMonitor(Callback callback, std::chrono::steady_clock::duration interval = std::chrono::seconds{60});
+
+        /**
+         * Size of the input (the compressed size if it is compressed), to estimate the time left. It is set
+         * automatically when validating a file mapped in memory.
+         */
+        void set_input_size(uint64_t size);
+
+        /**
+         * Counts the bytes read from the input; it can be called from any thread
+         */
+        void add_input_bytes(size_t bytes);
+
+        /**
+         * Counts a block of `bytes` just parsed by `parser`, with its reports, and calls the callback if the
+         * interval has passed since the last call
+         */
+        void add_parsed(Parser const & parser, size_t bytes);
+
+        /**
+         * Counts the reports of the end of the input, and calls the callback with the final progress
+         */
+        void finish(Parser const & parser);
+
+        /**
+         * Calls the callback with the final progress, when the validation stops before the end of the input
+         */
+        void finish();
+
+        Progress const & progress() const;
+
+      private:
+        void update(Parser const & parser, size_t bytes);
+        void notify();
+
+        Callback callback;
+        std::chrono::steady_clock::duration interval;
+        std::chrono::steady_clock::time_point start;
+        std::chrono::steady_clock::time_point next_call;
+        std::atomic<uint64_t> input_bytes;
+        Progress current;
+    };
+  }
+}
+
+#endif // VCF_PROGRESS_HPP
@@ -21,7 +21,6 @@
 
 #include <boost/algorithm/string/predicate.hpp>
 #include <boost/math/special_functions/binomial.hpp>
-#include <boost/regex.hpp>
 
 #include "util/string_utils.hpp"
 
@@ -18,8 +18,12 @@
 #define VCF_RECORD_CACHE_HPP
 
 
+#include <algorithm>
+#include <limits>
+#include <memory>
 #include <set>
-#include <sstream>
+#include <string>
+#include "allocation_stats.hpp"
 #include "normalizer.hpp"
 #include "file_structure.hpp"
 
@@ -49,6 +53,21 @@ namespace ebi
          */
         RecordCache(size_t capacity) : capacity{capacity}, unlimited{capacity == 0} { }
 
+        RecordCache(RecordCache const & other)
+        : cache{other.cache}, capacity{other.capacity}, unlimited{other.unlimited},
+          smallest{other.smallest ? new RecordCore{*other.smallest} : nullptr}
+        {
+        }
+
+        RecordCache & operator=(RecordCache const & other)
+        {
+            cache = other.cache;
+            capacity = other.capacity;
+            unlimited = other.unlimited;
+            smallest.reset(other.smallest ? new RecordCore{*other.smallest} : nullptr);
+            return *this;
+        }
+
         /**
          * For a given Record, returns a vector of RecordCores that are duplicates.
          *
@@ -62,6 +81,7 @@ namespace ebi
          */
         std::vector<std::unique_ptr<Error>> check_duplicates(const Record &record)
         {
+            AllocationScope allocation_scope{AllocationStage::record_cache};
             auto record_cores = normalize(record);
             std::vector<std::unique_ptr<Error>> duplicates{};
 
@@ -73,9 +93,9 @@ namespace ebi
                     // no matches found
                 } else {
                     // one or more matches found
-                    std::stringstream ss;
-                    ss << "Duplicated variant " << record_core.chromosome << ":" << record_core.position << ":"
-                    << record_core.reference_allele << ">" << record_core.alternate_allele << " found";
+                    std::string message = "Duplicated variant " + record_core.chromosome + ":"
+                                          + std::to_string(record_core.position) + ":" + record_core.reference_allele
+                                          + ">" + record_core.alternate_allele + " found";
 
                     std::string duplicate_variant_lines = "It occurs in lines " + std::to_string(range.first->line)
                                                           + " and " + std::to_string(record_core.line);
@@ -83,13 +103,16 @@ namespace ebi
 
                     if (++range.first == range.second) {
                         // if only one match, return an extra error for the first occurrence
-                        duplicates.emplace_back(new DuplicationError{first_occurence_line, ss.str()});
+                        duplicates.emplace_back(new DuplicationError{first_occurence_line, message});
                     }
 
-                    duplicates.emplace_back(new DuplicationError{record_core.line, ss.str(), duplicate_variant_lines});
+                    duplicates.emplace_back(new DuplicationError{record_core.line, message, duplicate_variant_lines});
                 }
 
                 cache.insert(range.second, record_core);
+                if (!smallest || record_core < *smallest) {
+                    smallest.reset(new RecordCore{record_core});
+                }
             }
 
             shrink_to_fit();
@@ -99,6 +122,51 @@ namespace ebi
         /**
          * reduce cache size to this->capacity unless this->unlimited is true
          */
+        /**
+         * Whether no variant has been checked by this cache (even if it was later removed)
+         */
+        bool empty() const
+        {
+            return !smallest;
+        }
+
+        /**
+         * Smallest line of the variants held, which may still be reported as duplicated by a later one. If there
+         * are none, the maximum size_t.
+         */
+        size_t first_line() const
+        {
+            size_t line = std::numeric_limits<size_t>::max();
+            for (auto & record_core : cache) {
+                line = std::min(line, record_core.line);
+            }
+            return line;
+        }
+
+        /**
+         * Whether all the variants that this cache holds are smaller than those ever checked by `later`. In that
+         * case, `later` would have found the same duplicates if it had started with the contents of this cache.
+         */
+        bool precedes(RecordCache const & later) const
+        {
+            return cache.empty() || later.empty() || *cache.rbegin() < *later.smallest;
+        }
+
+        /**
+         * Adds the variants held by a cache that checked the records following the ones checked by this one, as if
+         * this cache had checked them all. The cache must precede `later`.
+         */
+        void append(RecordCache const & later)
+        {
+            for (auto & record_core : later.cache) {
+                cache.insert(cache.end(), record_core);
+            }
+            if (!smallest || (later.smallest && *later.smallest < *smallest)) {
+                smallest.reset(later.smallest ? new RecordCore{*later.smallest} : nullptr);
+            }
+            shrink_to_fit();
+        }
+
         void shrink_to_fit()
         {
             if (not unlimited) {
@@ -117,6 +185,7 @@ namespace ebi
         std::multiset<RecordCore> cache;
         size_t capacity;    ///< max amount of RecordCores that the cache can hold
         bool unlimited; ///< if true, the set is not capped and will not erase any RecordCore
+        std::unique_ptr<RecordCore> smallest;  ///< smallest RecordCore ever checked, even if erased since
     };
   }
 }
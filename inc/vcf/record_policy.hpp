@@ -0,0 +1,59 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VCF_RECORD_POLICY_HPP
+#define VCF_RECORD_POLICY_HPP
+
+#include "file_structure.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+
+    /**
+     * Record policy that checks every field of each record on its own
+     */
+    class ValidateRecordPolicy
+    {
+      public:
+        static unsigned const checks = RECORD_CHECK_ALL;
+    };
+
+    /**
+     * Record policy that checks the columns from CHROM to FORMAT of each record, but not its samples, which take
+     * most of the time of the files with many of them
+     */
+    class ValidateFieldsRecordPolicy
+    {
+      public:
+        static unsigned const checks = RECORD_CHECK_FIELDS;
+    };
+
+    /**
+     * Record policy that only relies on the syntax of each record, checked by the parser. The records may still be
+     * compared with each other, if the parse policy stores them.
+     */
+    class IgnoreRecordPolicy
+    {
+      public:
+        static unsigned const checks = 0;
+    };
+
+  }
+}
+
+#endif // VCF_RECORD_POLICY_HPP
@@ -0,0 +1,263 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VCF_REGION_INDEX_HPP
+#define VCF_REGION_INDEX_HPP
+
+#include <cstdint>
+#include <istream>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "util/bgzf_block_reader.hpp"
+#include "util/bgzf_range_reader.hpp"
+#include "util/block_reader.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+
+    /**
+     * Interval of a contig, 0-based and half-open like in BED files
+     */
+    struct Region
+    {
+        std::string contig;
+        uint64_t begin;
+        uint64_t end;
+    };
+
+    uint64_t const max_region_end = uint64_t{1} << 62;
+
+    /**
+     * Parses a region written like in samtools and tabix: "chr", "chr:start" or "chr:start-end", with 1-based
+     * inclusive positions that may have thousands separators
+     *
+     * @throw std::invalid_argument if the positions are not numbers or the region is empty
+     */
+    Region parse_region(std::string const & text);
+
+    /**
+     * Reads the regions of a BED file, skipping empty, comment, "track" and "browser" lines
+     *
+     * @throw std::invalid_argument if a line doesn't have a contig, a start and an end
+     */
+    std::vector<Region> read_bed_regions(std::istream & input);
+
+    /**
+     * Index of a BGZF file sorted by position, in the tabix (.tbi) or CSI (.csi) format. See the specifications in
+     * https://samtools.github.io/hts-specs/tabix.pdf and https://samtools.github.io/hts-specs/CSIv1.pdf
+     */
+    class RegionIndex
+    {
+      public:
+        using Chunk = std::pair<util::VirtualOffset, util::VirtualOffset>;
+
+        /**
+         * Reads an index, of either format
+         *
+         * @throw std::runtime_error if the file can't be read or is not an index
+         */
+        explicit RegionIndex(std::string const & path);
+
+        /**
+         * Chunks of the indexed file that may have records overlapping any of the regions, sorted and merged so
+         * each record is read once. They may also have records around the regions.
+         */
+        std::vector<Chunk> chunks(std::vector<Region> const & regions) const;
+
+        /**
+         * Virtual offsets where the index says a record starts, sorted and without repetitions: the bounds of the
+         * chunks of every bin, and the first record of each window or bin. An index older than its file may point
+         * anywhere, so the callers should check there is a line start before splitting there.
+         */
+        std::vector<util::VirtualOffset> record_offsets() const;
+
+        /**
+         * Path of the index of a file: its name with the .tbi extension, or else with .csi
+         *
+         * @return empty if there's none
+         */
+        static std::string find(std::string const & path);
+
+      private:
+        struct Reference
+        {
+            std::map<uint32_t, std::vector<Chunk>> bins;
+            std::map<uint32_t, util::VirtualOffset> bin_offsets;    /**< CSI: first record of each bin */
+            std::vector<util::VirtualOffset> linear_index;          /**< Tabix: first record of each window */
+        };
+
+        /**
+         * Offset of the first record that may overlap a position, so the chunks ending before can be skipped
+         */
+        util::VirtualOffset min_offset(Reference const & reference, uint64_t position) const;
+
+        void read_tabix(std::vector<char> const & bytes);
+        void read_csi(std::vector<char> const & bytes);
+        void read_names(char const * names, size_t size);
+
+        int min_shift;
+        int depth;
+        std::map<std::string, size_t> reference_ids;
+        std::vector<Reference> references;
+    };
+
+    /**
+     * Reads the records of a BGZF file that overlap some regions, seeking to them with its index.
+     *
+     * A record overlaps a region if the bases of its reference allele do, or if its INFO END does. The records are
+     * provided in the order of the file, each one once even if it overlaps several regions.
+     */
+    class RegionBlockReader : public util::BlockReader
+    {
+      public:
+        RegionBlockReader(util::Block compressed,
+                          RegionIndex const & index,
+                          std::vector<Region> const & regions,
+                          size_t block_size = util::default_block_size);
+
+        /**
+         * Whether a record overlaps the regions. A record whose position can't be read overlaps them if its contig
+         * does, so the parser can report its errors.
+         */
+        bool overlaps(char const * begin, char const * end) const;
+
+      protected:
+        bool next_block(util::Block & block) override;
+
+      private:
+        void add_line(char const * begin, char const * end);
+
+        util::BgzfRangeReader ranges;
+        std::map<std::string, std::vector<std::pair<uint64_t, uint64_t>>> intervals;  /**< Sorted and merged */
+        size_t block_size;
+        std::vector<char> partial_line;
+        std::vector<char> buffer;
+    };
+
+    /**
+     * Builds the tabix or CSI index of a BGZF file from its lines, as they are read to validate it, so it doesn't
+     * have to be read again by tabix.
+     *
+     * Like tabix, it needs the records of each contig to be together and sorted by position. If they are not, or a
+     * record has no position, the index can't be built, and `failure` says why.
+     */
+    class RegionIndexBuilder
+    {
+      public:
+        enum class Format { TABIX, CSI };
+
+        explicit RegionIndexBuilder(Format format);
+
+        /**
+         * Adds a line of the file, without its newline, which starts and ends in those virtual offsets. The header
+         * lines are only counted.
+         */
+        void add_line(char const * begin, char const * end, util::VirtualOffset line_begin,
+                      util::VirtualOffset line_end);
+
+        /**
+         * Marks the whole file as read, which the index needs to be written
+         */
+        void finish();
+
+        /**
+         * Marks the file as impossible to index for a reason other than its records, like not being BGZF
+         */
+        void fail(std::string const & reason);
+
+        /**
+         * Why the index can't be written, or empty if it can
+         */
+        std::string failure() const;
+
+        /**
+         * Writes the index, compressed with BGZF like tabix does
+         *
+         * @throw std::runtime_error if it can't be written, or if `failure` is not empty
+         */
+        void write(std::string const & path) const;
+
+        /**
+         * Extension of the files of an index format: .tbi or .csi
+         */
+        static std::string extension(Format format);
+
+      private:
+        using Chunk = RegionIndex::Chunk;
+
+        struct Reference
+        {
+            std::string name;
+            std::map<uint32_t, std::vector<Chunk>> bins;
+            std::vector<util::VirtualOffset> linear_index;  /**< First record of each window, if any overlaps it */
+            Chunk records;
+            uint64_t n_records;
+        };
+
+        void add_record(std::string const & contig, uint64_t begin, uint64_t end, util::VirtualOffset line_begin,
+                        util::VirtualOffset line_end);
+
+        /**
+         * Adds the records in the bin of the last one to that bin, as a chunk
+         */
+        void end_chunk();
+
+        void write_header(std::ostream & output) const;
+
+        Format format;
+        int min_shift;
+        int depth;
+        std::map<std::string, size_t> reference_ids;
+        std::vector<Reference> references;
+
+        uint64_t previous_begin;
+        uint32_t chunk_bin;
+        Chunk chunk;
+
+        size_t n_lines;
+        bool finished;
+        std::string error;
+    };
+
+    /**
+     * Passes on the blocks of a BGZF file as they are decompressed, adding its lines to an index. The index is
+     * finished when the end of the file is read.
+     */
+    class IndexingBlockReader : public util::BlockReader
+    {
+      public:
+        IndexingBlockReader(util::BgzfBlockReader & input, RegionIndexBuilder & index);
+
+      protected:
+        bool next_block(util::Block & block) override;
+
+      private:
+        util::BgzfBlockReader & input;
+        RegionIndexBuilder & index;
+        std::vector<char> partial_line;
+        util::VirtualOffset partial_line_begin;
+        util::VirtualOffset input_end;
+    };
+
+  }
+}
+
+#endif // VCF_REGION_INDEX_HPP
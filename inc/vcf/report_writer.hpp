@@ -18,15 +18,33 @@
 #define VCF_REPORT_WRITER_HPP
 
 #include <fstream>
+#include <istream>
+#include <memory>
 #include <string>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
+#include <boost/filesystem.hpp>
+
+#include "util/stream_utils.hpp"
 #include "vcf/error.hpp"
+#include "vcf/error_type_counts.hpp"
+#include "vcf/profile_policy.hpp"
 
 namespace ebi
 {
   namespace vcf
   {
+    /**
+     * An error or a warning, in a batch of them
+     */
+    struct ReportedError
+    {
+        Severity severity;
+        Error * error;
+    };
+
     class ReportWriter
     {
         public:
@@ -35,15 +53,85 @@ namespace ebi
             virtual void write_warning(Error &error) = 0;
             virtual void write_message(const std::string &report_result) = 0;
 
+            /**
+             * Writes the errors and warnings of a batch in order. By default each one is written on its own, and the
+             * writers that can write many at once more cheaply override it.
+             */
+            virtual void write_batch(std::vector<ReportedError> const & batch)
+            {
+                for (auto & reported : batch) {
+                    if (reported.severity == Severity::ERROR) {
+                        write_error(*reported.error);
+                    } else {
+                        write_warning(*reported.error);
+                    }
+                }
+            }
+
             virtual std::string get_filename() = 0;
+
+            /**
+             * Whether the writer ignores any further error, so the validation could stop if all the writers do
+             */
+            virtual bool is_full() const { return false; }
+
+            /**
+             * Most errors and warnings of each type (see ErrorTypeCounts) that the writer keeps, so the parser can
+             * drop the rest as soon as they are found, or 0 if it keeps all of them
+             */
+            virtual size_t max_errors_per_type() const { return 0; }
+
+            /**
+             * Counts errors and warnings left out before reaching the writer, because it would not keep them
+             */
+            virtual void omit(size_t reports) {}
+
+            /**
+             * Flushes what was written so far, and writes what the report needs to continue it when a validation
+             * is resumed from a checkpoint. By default a report can't be continued.
+             *
+             * @throw std::runtime_error if the report can't be continued or flushed
+             */
+            virtual void save_checkpoint(std::ostream &checkpoint)
+            {
+                throw std::runtime_error{"The report " + get_filename() + " can't be resumed from a checkpoint"};
+            }
+
+            /**
+             * Continues the report from the state written by save_checkpoint, discarding whatever was written
+             * after it. Called before writing anything else.
+             *
+             * @throw std::runtime_error if the report can't be continued
+             */
+            virtual void load_checkpoint(std::istream &checkpoint)
+            {
+                throw std::runtime_error{"The report " + get_filename() + " can't be resumed from a checkpoint"};
+            }
     };
 
+    /**
+     * Cuts a report file to the size it had at a checkpoint, so it can be continued from there
+     *
+     * @throw std::runtime_error if the file is shorter
+     */
+    inline void truncate_report(std::string const & file_name, uint64_t size)
+    {
+        if (boost::filesystem::file_size(file_name) < size) {
+            throw std::runtime_error{"The report " + file_name + " is shorter than at the checkpoint"};
+        }
+        boost::filesystem::resize_file(file_name, size);
+    }
+
     class FileReportWriter : public ReportWriter
     {
         public:
-            FileReportWriter(std::string filename) : file_name(filename)
+            /**
+             * @param resume: whether to keep the contents of the file, to continue it from a checkpoint
+             */
+            FileReportWriter(std::string filename, bool resume = false) : file_buffer(1024 * 1024), file_name(filename)
             {
-                file.open(filename, std::ios::out);
+                file.rdbuf()->pubsetbuf(file_buffer.data(), file_buffer.size());
+                file.open(filename, resume ? std::ios::in | std::ios::out : std::ios::out);
             }
 
             ~FileReportWriter()
@@ -53,12 +141,12 @@ namespace ebi
 
             virtual void write_error(Error &error) override
             {
-                file << error.what() << std::endl;
+                file << error.what() << '\n';
             }
 
             virtual void write_warning(Error &error) override
             {
-                file << error.what() << " (warning)" << std::endl;
+                file << error.what() << " (warning)\n";
             }
 
             virtual void write_message(const std::string &report_result) override
@@ -66,15 +154,223 @@ namespace ebi
                 file << report_result << std::endl;
             }
 
+            virtual void write_batch(std::vector<ReportedError> const & batch) override
+            {
+                for (auto & reported : batch) {
+                    file << reported.error->what() << (reported.severity == Severity::ERROR ? "\n" : " (warning)\n");
+                }
+            }
+
             virtual std::string get_filename() override
             {
                 return file_name;
             }
 
+            virtual void save_checkpoint(std::ostream &checkpoint) override
+            {
+                if (!file.flush()) {
+                    throw std::runtime_error{"Couldn't write the report " + file_name};
+                }
+                util::write_number(checkpoint, static_cast<uint64_t>(file.tellp()));
+            }
+
+            virtual void load_checkpoint(std::istream &checkpoint) override
+            {
+                uint64_t size = util::read_number(checkpoint);
+                truncate_report(file_name, size);
+                file.seekp(size);
+            }
+
         private:
+            std::vector<char> file_buffer;  // the lines are only flushed when it's full, or at the end
             std::ofstream file;
             std::string file_name;
     };
+
+    /**
+     * Writes to another report only the first errors and warnings of each type, and only up to a total; the rest
+     * are just counted. The types are those of ErrorTypeCounts: severity, class and message without values.
+     *
+     * A limit of 0 means no limit.
+     */
+    class LimitedReportWriter : public ReportWriter
+    {
+        public:
+            LimitedReportWriter(std::unique_ptr<ReportWriter> output, size_t max_errors_per_type, size_t max_errors)
+            : output{std::move(output)}, max_per_type{max_errors_per_type}, max_errors{max_errors},
+              written{0}, omitted{0}
+            {
+            }
+
+            virtual void write_error(Error &error) override
+            {
+                if (accept(Severity::ERROR, error)) {
+                    output->write_error(error);
+                }
+            }
+
+            virtual void write_warning(Error &error) override
+            {
+                if (accept(Severity::WARNING, error)) {
+                    output->write_warning(error);
+                }
+            }
+
+            virtual void write_batch(std::vector<ReportedError> const & batch) override
+            {
+                accepted.clear();
+                for (auto & reported : batch) {
+                    if (accept(reported.severity, *reported.error)) {
+                        accepted.push_back(reported);
+                    }
+                }
+                if (!accepted.empty()) {
+                    output->write_batch(accepted);
+                }
+            }
+
+            virtual void write_message(const std::string &report_result) override
+            {
+                if (omitted != 0) {
+                    output->write_message(std::to_string(omitted) + " more errors and warnings were found but not "
+                                          "written, because of the limits of the report");
+                }
+                output->write_message(report_result);
+            }
+
+            virtual std::string get_filename() override
+            {
+                return output->get_filename();
+            }
+
+            virtual bool is_full() const override
+            {
+                return max_errors != 0 && written >= max_errors;
+            }
+
+            virtual size_t max_errors_per_type() const override
+            {
+                return max_per_type;
+            }
+
+            virtual void omit(size_t reports) override
+            {
+                omitted += reports;
+            }
+
+            size_t omitted_errors() const
+            {
+                return omitted;
+            }
+
+            virtual void save_checkpoint(std::ostream &checkpoint) override
+            {
+                util::write_number(checkpoint, written);
+                util::write_number(checkpoint, omitted);
+                written_per_type.save(checkpoint);
+                output->save_checkpoint(checkpoint);
+            }
+
+            virtual void load_checkpoint(std::istream &checkpoint) override
+            {
+                written = util::read_number(checkpoint);
+                omitted = util::read_number(checkpoint);
+                written_per_type.load(checkpoint);
+                output->load_checkpoint(checkpoint);
+            }
+
+        private:
+            bool accept(Severity severity, Error &error)
+            {
+                if (is_full()) {
+                    ++omitted;
+                    return false;
+                }
+                if (max_per_type != 0 && !written_per_type.add(severity, error, max_per_type)) {
+                    ++omitted;
+                    return false;
+                }
+                ++written;
+                return true;
+            }
+
+            std::unique_ptr<ReportWriter> output;
+            size_t max_per_type;
+            size_t max_errors;
+            size_t written;
+            size_t omitted;
+            ErrorTypeCounts written_per_type;
+            std::vector<ReportedError> accepted;    // reused to filter every batch
+    };
+
+    /**
+     * Writes to another report, adding the time it takes to the report writing step of a profile
+     */
+    class ProfiledReportWriter : public ReportWriter
+    {
+        public:
+            ProfiledReportWriter(std::unique_ptr<ReportWriter> output, Profile & profile)
+            : output{std::move(output)}, profile(profile)
+            {
+            }
+
+            virtual void write_error(Error &error) override
+            {
+                ProfileTimer timer{profile, ProfiledStep::report_writing};
+                output->write_error(error);
+            }
+
+            virtual void write_warning(Error &error) override
+            {
+                ProfileTimer timer{profile, ProfiledStep::report_writing};
+                output->write_warning(error);
+            }
+
+            virtual void write_batch(std::vector<ReportedError> const & batch) override
+            {
+                ProfileTimer timer{profile, ProfiledStep::report_writing};
+                output->write_batch(batch);
+            }
+
+            virtual void write_message(const std::string &report_result) override
+            {
+                output->write_message(report_result);
+            }
+
+            virtual std::string get_filename() override
+            {
+                return output->get_filename();
+            }
+
+            virtual bool is_full() const override
+            {
+                return output->is_full();
+            }
+
+            virtual size_t max_errors_per_type() const override
+            {
+                return output->max_errors_per_type();
+            }
+
+            virtual void omit(size_t reports) override
+            {
+                output->omit(reports);
+            }
+
+            virtual void save_checkpoint(std::ostream &checkpoint) override
+            {
+                output->save_checkpoint(checkpoint);
+            }
+
+            virtual void load_checkpoint(std::istream &checkpoint) override
+            {
+                output->load_checkpoint(checkpoint);
+            }
+
+        private:
+            std::unique_ptr<ReportWriter> output;
+            Profile & profile;
+    };
   }
 }
 
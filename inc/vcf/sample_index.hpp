@@ -0,0 +1,143 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VCF_SAMPLE_INDEX_HPP
+#define VCF_SAMPLE_INDEX_HPP
+
+#include <string>
+#include <vector>
+
+namespace ebi
+{
+  namespace vcf
+  {
+    /**
+     * Shape of a value, enough to validate most of them without parsing
+     */
+    enum class ValueClass : unsigned char
+    {
+        MISSING,    /**< A single dot */
+        INTEGER,    /**< An optional sign and up to 9 digits, so it fits in an int */
+        DECIMAL,    /**< An optional sign and up to 30 digits with a decimal point: a float without exponent */
+        OTHER
+    };
+
+    /**
+     * Positions of the colon-separated subfields of a sample, and of the comma-separated values of each subfield.
+     *
+     * The delimiters of the whole sample are found in a single vectorized pass, without copying any substring.
+     * The split follows the rules of util::string_split, so checks on the index behave exactly like checks on
+     * split strings: the first character of a string is never a delimiter, and a trailing delimiter doesn't add
+     * an empty part.
+     *
+     * The vectors are reused by every call to build, so one index can be used for all the samples of a file.
+     */
+    struct SampleIndex
+    {
+        struct Value
+        {
+            size_t begin;
+            size_t end;
+            ValueClass value_class;
+        };
+
+        struct Subfield
+        {
+            size_t begin;
+            size_t end;
+            size_t first_value;     /**< Index in `values` */
+            size_t n_values;
+        };
+
+        std::string const * sample;
+        std::vector<Subfield> subfields;
+        std::vector<Value> values;
+
+        SampleIndex();
+
+        void build(std::string const & sample);
+
+        std::string subfield_string(size_t i) const;
+
+        std::string value_string(Value const & value) const;
+
+        std::vector<std::string> value_strings(Subfield const & subfield) const;
+
+      private:
+        void add_value(size_t begin, size_t end);
+
+        std::vector<size_t> delimiters;
+    };
+
+    /**
+     * Alleles of the GT subfield of a sample, decoded in a single pass for all the checks that need them.
+     *
+     * The alleles are split by '/' and '|' following the rules of util::string_split, like the checks on split
+     * strings, while the ploidy counts every separator, so "0/" has one allele and ploidy 2.
+     *
+     * The vector is reused by every call to decode, so one genotype can be used for all the samples of a file.
+     */
+    struct Genotype
+    {
+        enum class AlleleClass : unsigned char
+        {
+            INDEX,      /**< Only digits */
+            MISSING,    /**< A single dot */
+            EMPTY,
+            OTHER
+        };
+
+        struct Allele
+        {
+            size_t begin;
+            size_t end;
+            AlleleClass allele_class;
+            size_t index;   /**< If it is an INDEX, saturated at the maximum size_t */
+            bool phased;    /**< Whether it follows a '|' */
+        };
+
+        std::string const * sample;
+        std::vector<Allele> alleles;
+        size_t ploidy;
+
+        Genotype();
+
+        /**
+         * Decodes the GT subfield in [begin, end) of a sample
+         */
+        void decode(std::string const & sample, size_t begin, size_t end);
+
+        /**
+         * Decodes the GT subfield of a sample that starts with it, up to its first colon
+         */
+        void decode(std::string const & sample);
+
+        /**
+         * Whether every allele is written as "0"
+         */
+        bool is_all_reference() const;
+
+        std::string allele_string(Allele const & allele) const;
+    };
+
+    /**
+     * Finds the positions of all the colons and commas in [begin, end), appending them to `positions`
+     */
+    void find_sample_delimiters(char const * begin, char const * end, std::vector<size_t> & positions);
+  }
+}
+
+#endif // VCF_SAMPLE_INDEX_HPP
@@ -0,0 +1,117 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef VCF_STREAM_VALIDATOR_HPP
+#define VCF_STREAM_VALIDATOR_HPP
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "vcf/error.hpp"
+#include "vcf/file_structure.hpp"
+#include "vcf/report_writer.hpp"
+#include "vcf/validator.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    /**
+     * Validates a VCF that arrives in pieces, such as the bytes received from the network, and delivers the errors
+     * and the records through callbacks as soon as they are found. This is the entry point for programs that embed
+     * the validator instead of running it on files.
+     *
+     * The pieces may be split anywhere, even in the middle of a line. The version is detected from the first line,
+     * and the stream must not be compressed. With the stop level, the validation ends at the first error, and the
+     * rest of the stream is ignored.
+     *
+     * The same instance can validate several streams one after another: reset() starts a new one, keeping the
+     * callbacks.
+     */
+    class StreamValidator
+    {
+      public:
+        /**
+         * Receives each error or warning, in the order of the stream. The error is only valid during the call;
+         * clone it to keep it.
+         */
+        using ErrorCallback = std::function<void(Severity severity, Error const & error)>;
+
+        /**
+         * Receives each record that passes its own checks, before it is compared with the previous ones. The
+         * records are not built with the error level, and with the order and records levels their samples are
+         * left unsplit, see Record::split_samples. The record is only valid during the call.
+         */
+        using RecordCallback = std::function<void(Record const & record)>;
+
+        /**
+         * @param source_name used in the reports, like a file name
+         */
+        StreamValidator(ValidationLevel level = ValidationLevel::warning, std::string const & source_name = "stream");
+
+        StreamValidator(StreamValidator const &) = delete;
+        StreamValidator & operator=(StreamValidator const &) = delete;
+
+        void on_error(ErrorCallback callback);
+
+        void on_record(RecordCallback callback);
+
+        /**
+         * Validates the next `size` bytes of the stream
+         *
+         * @throw std::invalid_argument if the stream is compressed
+         */
+        void push(char const * data, size_t size);
+
+        /**
+         * Ends the stream, validating its last line even if it has no newline
+         *
+         * @return whether the whole stream is valid
+         */
+        bool finish();
+
+        /**
+         * Whether no error has been found so far
+         */
+        bool is_valid() const;
+
+        /**
+         * Starts validating a new stream
+         */
+        void reset();
+
+      private:
+        bool start_parser();
+        void parse(char const * begin, char const * end);
+
+        ValidationLevel level;
+        std::string source_name;
+        ErrorCallback error_callback;
+        RecordCallback record_callback;
+
+        std::vector<std::unique_ptr<ReportWriter>> outputs;     // forwarding to error_callback
+        std::unique_ptr<Parser> parser;     // built when the first line is complete
+        std::vector<char> first_line;
+        bool stopped;
+        bool valid;
+    };
+  }
+}
+
+#endif // VCF_STREAM_VALIDATOR_HPP
@@ -36,16 +36,45 @@ namespace ebi
     const char ERROR[] = "error";
     const char ERRORS[] = "errors";
     const char STOP[] = "stop";
+    const char ORDER[] = "order";
+    const char RECORDS[] = "records";
+    const char TRIAGE[] = "triage";
     const char HELP[] = "help";
     const char VERSION[] = "version";
     const char LEVEL[] = "level";
     const char DATABASE[] = "database";
     const char TEXT[] = "text";
     const char SUMMARY[] = "summary";
+    const char BINARY[] = "binary";
     const char INPUT[] = "input";
     const char OUTPUT[] = "output";
     const char OUTDIR[] = "outdir";
     const char REPORT[] = "report";
+    const char THREADS[] = "threads";
+    const char CONNECTIONS[] = "connections";
+    const char MAX_ERRORS[] = "max-errors";
+    const char MAX_ERRORS_PER_TYPE[] = "max-errors-per-type";
+    const char FIX[] = "fix";
+    const char MANIFEST[] = "manifest";
+    const char JOBS[] = "jobs";
+    const char PROFILE[] = "profile";
+    const char STATS[] = "stats";
+    const char TRACE[] = "trace";
+    const char PROGRESS[] = "progress";
+    const char MEMORY_LIMIT[] = "memory-limit";
+    const char REGION[] = "region";
+    const char REGIONS_FILE[] = "regions-file";
+    const char CHECKPOINT[] = "checkpoint";
+    const char RESUME[] = "resume";
+    const char INCREMENTAL[] = "incremental";
+    const char EXACT_DUPLICATES[] = "exact-duplicates";
+    const char DUPLICATE_FILTER[] = "duplicate-filter";
+    const char FALSE_POSITIVE_RATE[] = "false-positive-rate";
+    const char TRIAGE_FRACTION[] = "triage-fraction";
+    const char TRIAGE_EVERY[] = "triage-every";
+    const char WRITE_INDEX[] = "write-index";
+    const char BGZIP[] = "bgzip";
+    const char COMPRESSION_LEVEL[] = "compression-level";
     const char HELP_OPTION[] = "help,h";
     const char VERSION_OPTION[] = "version,v";
     const char INPUT_OPTION[] = "input,i";
@@ -54,6 +83,12 @@ namespace ebi
     const char REPORT_OPTION[] = "report,r";
     const char OUTDIR_OPTION[] = "outdir,o";
     const char OUTPUT_OPTION[] = "output,o";
+    const char THREADS_OPTION[] = "threads,t";
+    const char MAX_ERRORS_OPTION[] = "max-errors";
+    const char MAX_ERRORS_PER_TYPE_OPTION[] = "max-errors-per-type";
+    const char FIX_OPTION[] = "fix,f";
+    const char MANIFEST_OPTION[] = "manifest,m";
+    const char JOBS_OPTION[] = "jobs,j";
 
     // fields
     const std::string ID = "ID";
@@ -104,6 +139,7 @@ namespace ebi
 
     // ALT for gVCF
     const std::string GVCF_NON_VARIANT_ALLELE = "<*>";
+    const std::string GVCF_NON_REF_ALLELE = "<NON_REF>";    /**< Written instead of <*> by GATK */
 
     // INFO predefined tags
     const std::string AA = "AA";
@@ -179,6 +215,17 @@ namespace ebi
     const std::string TAR_Z = ".Z";
     const std::string ZIP = ".zip";
 
+    // Extensions of the compressed formats that can be validated
+    const std::string GZ = ".gz";
+    const std::string BGZ = ".bgz";
+
+    // Extension of the binary format that can be validated
+    const std::string BCF = ".bcf";
+
+    // Formats of the indexes written with --write-index
+    const std::string TBI = "tbi";
+    const std::string CSI = "csi";
+
   }
 }
 
@@ -17,7 +17,11 @@
 #ifndef VCF_SUMMARY_REPORT_WRITER_HPP
 #define VCF_SUMMARY_REPORT_WRITER_HPP
 
-#include <map>
+#include <algorithm>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 #include "report_writer.hpp"
 
 namespace ebi
@@ -41,24 +45,96 @@ namespace ebi
      * be printed again.
      *
      * The summary displays the count(number of times it occurs) of the error, and the line number of its first
-     * occurrence. We distinguish between different types of errors based on their simple error message (which contains
-     * no details). The `error_order` basically maintains the order in which these errors appear for the first time.
+     * occurrence. We distinguish between different types of errors based on their severity and their simple error
+     * message (which contains no details nor values, see Error::type_message), using its id in the table of the
+     * tracker, so each error is counted with a single hash lookup.
+     * The `error_order` basically maintains the order in which these errors appear for the first time.
      */
     class SummaryTracker
     {
       public:
-        std::map<std::string, ErrorSummary> error_summary_report;
-        std::vector<std::string> error_order;
+        using Key = std::pair<Severity, MessageId>;
 
-        void add_to_summary(std::string const & error_message, size_t error_line)
+        struct KeyHash
         {
-            if (error_summary_report.find(error_message) == error_summary_report.end()) {
-                error_order.push_back(error_message);
-                error_summary_report[error_message] = ErrorSummary{1, error_line};
+            size_t operator()(Key const & key) const
+            {
+                return std::hash<size_t>{}(key.second * 2 + static_cast<size_t>(key.first));
+            }
+        };
+
+        MessageTable messages;
+        std::unordered_map<Key, ErrorSummary, KeyHash> error_summary_report;
+        std::vector<Key> error_order;
+
+        Key key_of(Severity severity, std::string const & type_message)
+        {
+            return Key{severity, messages.intern(type_message)};
+        }
+
+        void add_to_summary(Severity severity, std::string const & type_message, size_t error_line)
+        {
+            Key key = key_of(severity, type_message);
+            auto inserted = error_summary_report.emplace(key, ErrorSummary{1, error_line});
+            if (inserted.second) {
+                error_order.push_back(key);
             } else {
-                error_summary_report[error_message].occurrences++;
+                inserted.first->second.occurrences++;
             }
         }
+
+        /**
+         * Same as adding them one by one, but the consecutive errors of the same type are counted with a single
+         * lookup, as it is common to find the same error in many lines
+         */
+        void add_to_summary(std::vector<ReportedError> const & batch)
+        {
+            size_t i = 0;
+            while (i < batch.size()) {
+                std::string const & type_message = batch[i].error->type_message();
+                size_t run_end = i + 1;
+                while (run_end < batch.size() && batch[run_end].severity == batch[i].severity
+                       && batch[run_end].error->type_message() == type_message) {
+                    ++run_end;
+                }
+                Key key = key_of(batch[i].severity, type_message);
+                auto inserted = error_summary_report.emplace(key, ErrorSummary{run_end - i, batch[i].error->line});
+                if (inserted.second) {
+                    error_order.push_back(key);
+                } else {
+                    inserted.first->second.occurrences += run_end - i;
+                }
+                i = run_end;
+            }
+        }
+
+        /**
+         * Adds the errors counted by another tracker, such as one that summarized another part of the same input.
+         * The types of error are then ordered by the line of their first occurrence, and those first found in the
+         * same line keep the order of this tracker and then of `other`, so the result doesn't depend on which
+         * tracker finished first.
+         */
+        void merge(SummaryTracker const & other)
+        {
+            for (auto & other_key : other.error_order) {
+                ErrorSummary const & other_summary = other.error_summary_report.at(other_key);
+                Key key = key_of(other_key.first, other.messages.text(other_key.second));
+                auto inserted = error_summary_report.emplace(key, other_summary);
+                if (inserted.second) {
+                    error_order.push_back(key);
+                } else {
+                    ErrorSummary & summary = inserted.first->second;
+                    summary.occurrences += other_summary.occurrences;
+                    summary.first_occurrence_line = std::min(summary.first_occurrence_line,
+                                                             other_summary.first_occurrence_line);
+                }
+            }
+
+            std::stable_sort(error_order.begin(), error_order.end(), [this](Key const & a, Key const & b) {
+                return error_summary_report.at(a).first_occurrence_line
+                       < error_summary_report.at(b).first_occurrence_line;
+            });
+        }
    };
 
     /**
@@ -80,12 +156,17 @@ namespace ebi
 
         virtual void write_error(Error &error) override
         {
-            summary.add_to_summary("Error: " + error.message, error.line);
+            summary.add_to_summary(Severity::ERROR, error.type_message(), error.line);
         }
 
         virtual void write_warning(Error &error) override
         {
-            summary.add_to_summary("Warning: " + error.message, error.line);
+            summary.add_to_summary(Severity::WARNING, error.type_message(), error.line);
+        }
+
+        virtual void write_batch(std::vector<ReportedError> const & batch) override
+        {
+            summary.add_to_summary(batch);
         }
 
         virtual void write_message(const std::string &report_result) override
@@ -98,6 +179,34 @@ namespace ebi
             return file_name;
         }
 
+        /**
+         * The summary is only written at the end, so its checkpoint is the count of each type
+         */
+        virtual void save_checkpoint(std::ostream &checkpoint) override
+        {
+            util::write_number(checkpoint, summary.error_order.size());
+            for (auto & key : summary.error_order) {
+                ErrorSummary const & error_summary = summary.error_summary_report[key];
+                util::write_number(checkpoint, static_cast<uint64_t>(key.first));
+                util::write_string(checkpoint, summary.messages.text(key.second));
+                util::write_number(checkpoint, error_summary.occurrences);
+                util::write_number(checkpoint, error_summary.first_occurrence_line);
+            }
+        }
+
+        virtual void load_checkpoint(std::istream &checkpoint) override
+        {
+            summary = SummaryTracker{};
+            for (size_t types = util::read_number(checkpoint); types != 0; --types) {
+                auto severity = static_cast<Severity>(util::read_number(checkpoint));
+                SummaryTracker::Key key = summary.key_of(severity, util::read_string(checkpoint));
+                size_t occurrences = util::read_number(checkpoint);
+                size_t first_occurrence_line = util::read_number(checkpoint);
+                summary.error_summary_report[key] = ErrorSummary{occurrences, first_occurrence_line};
+                summary.error_order.push_back(key);
+            }
+        }
+
       private:
         SummaryTracker summary;
         std::string report_result;
@@ -108,9 +217,11 @@ namespace ebi
         {
             file << report_result << std::endl;
 
-            for (auto & error_message : summary.error_order) {
-                file << error_message << ". This occurs " << summary.error_summary_report[error_message].occurrences
-                     << " time(s), first time in line " << summary.error_summary_report[error_message].first_occurrence_line << "." << std::endl;
+            for (auto & key : summary.error_order) {
+                ErrorSummary const & error_summary = summary.error_summary_report[key];
+                file << (key.first == Severity::ERROR ? "Error: " : "Warning: ") << summary.messages.text(key.second)
+                     << ". This occurs " << error_summary.occurrences
+                     << " time(s), first time in line " << error_summary.first_occurrence_line << "." << std::endl;
             }
         }
     };
@@ -34,8 +34,15 @@
 #include "optional_policy.hpp"
 #include "parse_policy.hpp"
 #include "parsing_state.hpp"
-#include "record_cache.hpp"
+#include "profile_policy.hpp"
+#include "progress.hpp"
+#include "record_policy.hpp"
+#include "region_index.hpp"
+#include "hash_record_cache.hpp"
+#include "memory_budget.hpp"
+#include "util/block_reader.hpp"
 #include "util/string_utils.hpp"
+#include "util/worker_pool.hpp"
 #include "vcf/report_writer.hpp"
 
 
@@ -44,8 +51,27 @@ namespace ebi
   namespace vcf
   {
 
+    namespace debugulator
+    {
+      class StreamingFixer;
+    }
+
+    class Checkpoints;
+    class HeaderCache;
+    class IncrementalState;
+
     size_t const default_line_buffer_size = 64 * 1024;
-    enum class ValidationLevel { error, warning, stop };
+    /**
+     * What is checked and reported, each level validating with one of the configurations below:
+     * - error: only the syntax, QuickValidatorCfg.
+     * - warning: everything, FullValidatorCfg.
+     * - stop: everything until the first error, ReaderCfg.
+     * - order: the syntax, the order of the records and the duplicated variants, OrderValidatorCfg.
+     * - records: the same and the fields of each record but its samples, RecordsValidatorCfg.
+     * - triage: everything on a sample of the records, and their syntax, order and duplicates on all of them,
+     *   FullValidatorCfg with a RecordSampling.
+     */
+    enum class ValidationLevel { error, warning, stop, order, records, triage };
 
     // Only check syntax
     struct QuickValidatorCfg
@@ -53,6 +79,8 @@ namespace ebi
       using ParsePolicy = IgnoreParsePolicy;
       using ErrorPolicy = ReportErrorPolicy;
       using OptionalPolicy = IgnoreOptionalPolicy;
+      using ProfilePolicy = IgnoreProfilePolicy;
+      using RecordPolicy = IgnoreRecordPolicy;
     };
 
     // Check both syntax and semantics
@@ -61,6 +89,8 @@ namespace ebi
       using ParsePolicy = StoreParsePolicy;
       using ErrorPolicy = ReportErrorPolicy;
       using OptionalPolicy = ValidateOptionalPolicy;
+      using ProfilePolicy = IgnoreProfilePolicy;
+      using RecordPolicy = ValidateRecordPolicy;
     };
 
     // Read the file for processing, assuming it is correct
@@ -69,6 +99,50 @@ namespace ebi
       using ParsePolicy = StoreParsePolicy;
       using ErrorPolicy = AbortErrorPolicy;
       using OptionalPolicy = ValidateOptionalPolicy;
+      using ProfilePolicy = IgnoreProfilePolicy;
+      using RecordPolicy = ValidateRecordPolicy;
+    };
+
+    // Check syntax, and that the records are sorted and not duplicated, without checking their fields
+    struct OrderValidatorCfg
+    {
+      using ParsePolicy = StoreParsePolicy;
+      using ErrorPolicy = ReportErrorPolicy;
+      using OptionalPolicy = IgnoreOptionalPolicy;
+      using ProfilePolicy = IgnoreProfilePolicy;
+      using RecordPolicy = IgnoreRecordPolicy;
+    };
+
+    // Same as the above, also checking the fields of each record except its samples, without warnings
+    struct RecordsValidatorCfg : OrderValidatorCfg
+    {
+      using RecordPolicy = ValidateFieldsRecordPolicy;
+    };
+
+    // Same as the above, measuring the time of each step in the profile of the parser
+    struct ProfiledQuickValidatorCfg : QuickValidatorCfg
+    {
+      using ProfilePolicy = MeasureProfilePolicy;
+    };
+
+    struct ProfiledFullValidatorCfg : FullValidatorCfg
+    {
+      using ProfilePolicy = MeasureProfilePolicy;
+    };
+
+    struct ProfiledReaderCfg : ReaderCfg
+    {
+      using ProfilePolicy = MeasureProfilePolicy;
+    };
+
+    struct ProfiledOrderValidatorCfg : OrderValidatorCfg
+    {
+      using ProfilePolicy = MeasureProfilePolicy;
+    };
+
+    struct ProfiledRecordsValidatorCfg : RecordsValidatorCfg
+    {
+      using ProfilePolicy = MeasureProfilePolicy;
     };
 
     class Parser
@@ -79,11 +153,49 @@ namespace ebi
         virtual void parse(std::string const & text) = 0;
         virtual void parse(std::vector<char> const & text) = 0;
 
+        /**
+         * Parses a buffer that may contain any number of lines, the last one possibly incomplete
+         */
+        virtual void parse(char const * begin, char const * end) = 0;
+
         virtual void end() = 0;
 
         virtual bool is_valid() const = 0;
         virtual const std::vector<std::unique_ptr<Error>> & errors() const = 0;
         virtual const std::vector<std::unique_ptr<Error>> & warnings() const = 0;
+
+        /**
+         * Line being read when each error (or warning) was reported. Unlike Error::line, this always increases,
+         * so the reports of a buffer with several lines can be written in the same order as if it was parsed
+         * line by line
+         */
+        virtual const std::vector<size_t> & error_lines_read() const = 0;
+        virtual const std::vector<size_t> & warning_lines_read() const = 0;
+
+        /**
+         * Errors (or warnings) found but left out of errors(), because the reports already had as many of their
+         * type as they write (see ParsingState::max_reports_per_type)
+         */
+        virtual size_t omitted_errors() const = 0;
+        virtual size_t omitted_warnings() const = 0;
+
+        /**
+         * First line that may still get reports when more input is parsed: the one being read, or an earlier
+         * variant that a later one may duplicate. The reports of the lines before it are final.
+         */
+        virtual size_t first_unfinished_line() const = 0;
+
+        /**
+         * Number of complete lines parsed so far, to report the progress
+         */
+        virtual size_t lines_read() const = 0;
+
+        /**
+         * Chromosome and position of the last record parsed, to report the progress. The chromosome is
+         * unknown_contig if no record was stored, as happens with the error level.
+         */
+        virtual ContigId last_contig() const = 0;
+        virtual size_t last_position() const = 0;
     };
     
     class ParserImpl
@@ -96,21 +208,180 @@ namespace ebi
 
         void parse(std::string const & text) override;
         void parse(std::vector<char> const & text) override;
+        void parse(char const * begin, char const * end) override;
 
         void end() override;
 
         bool is_valid() const override;
         const std::vector<std::unique_ptr<Error>> & errors() const override;
         const std::vector<std::unique_ptr<Error>> & warnings() const override;
+        const std::vector<size_t> & error_lines_read() const override;
+        const std::vector<size_t> & warning_lines_read() const override;
+        size_t omitted_errors() const override;
+        size_t omitted_warnings() const override;
+        size_t first_unfinished_line() const override;
+        size_t lines_read() const override;
+        ContigId last_contig() const override;
+        size_t last_position() const override;
+
+        /**
+         * Checks each record on its own with `threads` threads, including the one parsing. The checks that
+         * compare a record with the previous ones, and the reports, still follow the order of the file.
+         *
+         * Only valid for parsers that report all the errors, because a parser that aborts on the first error
+         * would first find the syntax errors of the lines that follow a pending record.
+         */
+        void set_check_threads(size_t threads);
+
+        /**
+         * Creates a parser of the same type for the body lines starting at `first_line`, so they can be parsed
+         * in another thread while this one parses the previous lines. The new parser gets a copy of the source.
+         *
+         * If `continues` is true, it also starts with the state of this parser, so its reports are final. If not,
+         * it knows nothing about the previous records, and its reports are only valid if append_body accepts them.
+         */
+        std::unique_ptr<ParserImpl> body_parser(size_t first_line, bool continues) const;
+
+        /**
+         * Parses a range of complete lines of the body; the end of the input is parsed later by calling end()
+         */
+        void parse_body(char const * begin, char const * end);
+
+        /**
+         * Continues this parser with the state of one created with body_parser, that parsed the following lines.
+         *
+         * @return false, without changing anything, if the reports of `next` could be different had it parsed the
+         * same lines right after this one: a contig of this part repeated there, a position out of order across
+         * both, or variants that may be duplicated across both. Those lines must be parsed again by a parser that
+         * continues this one.
+         */
+        bool append_body(ParserImpl const & next);
+
+        /**
+         * Writes what this parser knows of the body, after parsing a whole number of lines: the state machine, the
+         * line number, whether the input is valid so far, the order of the contigs and the variants kept to find
+         * duplicates. The meta entries and the samples are not written, they are known again by parsing the header.
+         */
+        void save_body_state(std::ostream & output) const;
+
+        /**
+         * Continues the parsing with the state written by save_body_state. The parser must have just parsed the
+         * header of the same input, to know its meta entries and samples.
+         *
+         * @throw std::runtime_error if the input is not like save_body_state writes it
+         */
+        void load_body_state(std::istream & input);
 
+        /**
+         * Whether the state machine found an error it can't recover from, so the rest of the input is ignored
+         */
+        bool has_stopped() const;
+
+        /**
+         * Runs the checks of the meta section, for a binary input whose header text has just been parsed. A text
+         * input runs them when its body begins.
+         */
+        virtual void end_decoded_header() = 0;
+
+        /**
+         * Checks the record assigned to recycled_record, decoded from a binary input, as if its body line had just
+         * been parsed: on its own, then against the previous records, and with the optional checks
+         */
+        virtual void parse_decoded_record() = 0;
+
+        /**
+         * Reports an error found decoding a binary input, owned by the parser from now on
+         */
+        virtual void handle_decoding_error(Error * error) = 0;
+
+        /**
+         * Ends a binary input whose records were checked with parse_decoded_record, instead of end()
+         */
+        void end_decoded_records();
+
+        /**
+         * Keeps at most `capacity` variants to find duplicates, or all of them if 0. Only valid before parsing.
+         */
+        void set_record_cache_capacity(size_t capacity);
+
+        /**
+         * Sizes the cache for duplicates like the budget says, or finds them all by sorting the variants in its
+         * spill directory, if it has one, reporting them at the end. With a Bloom filter of the forgotten variants,
+         * their duplicates are also reported at the end. Only valid before parsing, and the body can't be split
+         * with body_parser if some duplicates are reported at the end.
+         */
+        void apply_memory_budget(MemoryBudget const & memory);
+
+        /**
+         * Raises the high-water marks of the memory used by this parser so far
+         */
+        void record_memory(MemoryBudget & memory) const;
        
       protected:
         virtual void parse_buffer(char const * p, char const * pe, char const * eof) = 0;
 
         /**
-         * Previously seen records
+         * Reports the results of the pending records, and runs the checks that depend on the previous records
+         */
+        virtual void report_pending_records() = 0;
+
+        /**
+         * New parser of the same type, ready to parse a body line
+         */
+        virtual ParserImpl * new_body_parser(std::shared_ptr<Source> source) const = 0;
+
+        /**
+         * Bytes taken by the tokens of the longest line parsed, and by the header
+         */
+        virtual size_t line_buffers_size() const = 0;
+        virtual size_t header_size() const = 0;
+
+        /**
+         * Whether the parse policy skips the body lines it knows to be valid, and skips them if the state machine
+         * is at the beginning of a body line
+         *
+         * @return the beginning of the first line the state machine must parse
+         */
+        virtual bool skips_valid_lines() const = 0;
+        virtual char const * skip_valid_lines(char const * p, char const * pe) = 0;
+
+        /**
+         * Implementation of parse_decoded_record with the policies of a parser
+         */
+        template <typename ParsePolicy, typename ErrorPolicy, typename OptionalPolicy, typename ProfilePolicy>
+        void check_decoded_record(ParsePolicy & parse_policy, ErrorPolicy & error_policy,
+                                  OptionalPolicy & optional_policy);
+
+        /**
+         * Previously seen records, the last ones read if its capacity is limited
+         */
+        HashRecordCache previous_records;
+
+      private:
+        /**
+         * Parses and reports the pending records in slices of the buffer, so they don't accumulate
+         */
+        void parse_in_slices(char const * begin, char const * end, char const * eof);
+
+        void parse_range(char const * begin, char const * end, char const * eof);
+
+        /**
+         * Parses line by line, so the lines known to be valid are skipped instead of parsed
          */
-        RecordCache previous_records;
+        void parse_skipping_valid_lines(char const * begin, char const * end, char const * eof);
+
+        /**
+         * Reports the duplicates that are only found once every variant has been read, if any
+         */
+        void report_duplicates_at_end();
+
+        std::unique_ptr<util::WorkerPool> check_workers;
+        size_t record_cache_capacity;
+        std::shared_ptr<ExternalRecordCache> spilled_records;   /**< Also held by previous_records, if set */
+        std::shared_ptr<DuplicateFilter> forgotten_records;     /**< Also held by previous_records, if set */
+
+        bool continues_previous;    /**< Created by body_parser to continue another one */
+        int first_state;            /**< Of the state machine, when created by body_parser */
     };
     
     template <typename Configuration>
@@ -124,11 +395,42 @@ namespace ebi
         using ParsePolicy = typename Configuration::ParsePolicy;
         using ErrorPolicy = typename Configuration::ErrorPolicy;
         using OptionalPolicy = typename Configuration::OptionalPolicy;
+        using ProfilePolicy = typename Configuration::ProfilePolicy;
+        using RecordPolicy = typename Configuration::RecordPolicy;
 
         ParserImpl_v41(std::shared_ptr<Source> source);
 
+        unsigned record_checks() const override
+        {
+            return RecordPolicy::checks;
+        }
+
+        void end_decoded_header() override
+        {
+            Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+            if (warning != nullptr) {
+                ErrorPolicy::handle_warning(*this, warning);
+            }
+        }
+
+        void parse_decoded_record() override
+        {
+            check_decoded_record<ParsePolicy, ErrorPolicy, OptionalPolicy, ProfilePolicy>(*this, *this, *this);
+        }
+
+        void handle_decoding_error(Error * error) override
+        {
+            ErrorPolicy::handle_error(*this, error);
+        }
+
       private:
         void parse_buffer(char const * p, char const * pe, char const * eof);
+        void report_pending_records();
+        ParserImpl * new_body_parser(std::shared_ptr<Source> source) const;
+        size_t line_buffers_size() const;
+        size_t header_size() const;
+        bool skips_valid_lines() const;
+        char const * skip_valid_lines(char const * p, char const * pe);
     };
 
     template <typename Configuration>
@@ -142,11 +444,42 @@ namespace ebi
         using ParsePolicy = typename Configuration::ParsePolicy;
         using ErrorPolicy = typename Configuration::ErrorPolicy;
         using OptionalPolicy = typename Configuration::OptionalPolicy;
+        using ProfilePolicy = typename Configuration::ProfilePolicy;
+        using RecordPolicy = typename Configuration::RecordPolicy;
 
         ParserImpl_v42(std::shared_ptr<Source> source);
 
+        unsigned record_checks() const override
+        {
+            return RecordPolicy::checks;
+        }
+
+        void end_decoded_header() override
+        {
+            Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+            if (warning != nullptr) {
+                ErrorPolicy::handle_warning(*this, warning);
+            }
+        }
+
+        void parse_decoded_record() override
+        {
+            check_decoded_record<ParsePolicy, ErrorPolicy, OptionalPolicy, ProfilePolicy>(*this, *this, *this);
+        }
+
+        void handle_decoding_error(Error * error) override
+        {
+            ErrorPolicy::handle_error(*this, error);
+        }
+
       private:
         void parse_buffer(char const * p, char const * pe, char const * eof);
+        void report_pending_records();
+        ParserImpl * new_body_parser(std::shared_ptr<Source> source) const;
+        size_t line_buffers_size() const;
+        size_t header_size() const;
+        bool skips_valid_lines() const;
+        char const * skip_valid_lines(char const * p, char const * pe);
     };
 
     template <typename Configuration>
@@ -160,30 +493,280 @@ namespace ebi
         using ParsePolicy = typename Configuration::ParsePolicy;
         using ErrorPolicy = typename Configuration::ErrorPolicy;
         using OptionalPolicy = typename Configuration::OptionalPolicy;
+        using ProfilePolicy = typename Configuration::ProfilePolicy;
+        using RecordPolicy = typename Configuration::RecordPolicy;
 
         ParserImpl_v43(std::shared_ptr<Source> source);
 
+        unsigned record_checks() const override
+        {
+            return RecordPolicy::checks;
+        }
+
+        void end_decoded_header() override
+        {
+            Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+            if (warning != nullptr) {
+                ErrorPolicy::handle_warning(*this, warning);
+            }
+        }
+
+        void parse_decoded_record() override
+        {
+            check_decoded_record<ParsePolicy, ErrorPolicy, OptionalPolicy, ProfilePolicy>(*this, *this, *this);
+        }
+
+        void handle_decoding_error(Error * error) override
+        {
+            ErrorPolicy::handle_error(*this, error);
+        }
+
       private:
         void parse_buffer(char const * p, char const * pe, char const * eof);
+        void report_pending_records();
+        ParserImpl * new_body_parser(std::shared_ptr<Source> source) const;
+        size_t line_buffers_size() const;
+        size_t header_size() const;
+        bool skips_valid_lines() const;
+        char const * skip_valid_lines(char const * p, char const * pe);
     };
 
+    template <typename ParsePolicy, typename ErrorPolicy, typename OptionalPolicy, typename ProfilePolicy>
+    void ParserImpl::check_decoded_record(ParsePolicy & parse_policy, ErrorPolicy & error_policy,
+                                          OptionalPolicy & optional_policy)
+    {
+        // like a body line that is not stored, a record is only checked by the decoder at this level
+        if (ParsePolicy::skips_valid_lines) {
+            return;
+        }
+
+        Record & decoded = *recycled;
+        Error * error = decoded.validate(source->format_layout(decoded.format), nullptr, profile,
+                                         record_checks_at(decoded.line));
+        if (error == nullptr) {
+            use_recycled_record();
+            error = parse_policy.handle_checked_record(*this, *record);
+        }
+        if (error != nullptr) {
+            error_policy.handle_error(*this, error);
+            return;
+        }
+
+        auto duplicated_errors = ProfilePolicy::measure(profile, ProfiledStep::check_duplicates, [this] {
+            return previous_records.check_duplicates(*record);
+        });
+        for (auto & error_ptr : duplicated_errors) {
+            error_policy.handle_error(*this, error_ptr.release());
+        }
+
+        Error * warning = optional_policy.optional_check_body_entry(*this, *record);
+        if (warning != nullptr) {
+            error_policy.handle_warning(*this, warning);
+        }
+    }
+
     // Predefined aliases for common uses of the parser
     using QuickValidator_v41 = ParserImpl_v41<QuickValidatorCfg>;
     using FullValidator_v41 = ParserImpl_v41<FullValidatorCfg>;
     using Reader_v41 = ParserImpl_v41<ReaderCfg>;
+    using OrderValidator_v41 = ParserImpl_v41<OrderValidatorCfg>;
+    using RecordsValidator_v41 = ParserImpl_v41<RecordsValidatorCfg>;
     
     using QuickValidator_v42 = ParserImpl_v42<QuickValidatorCfg>;
     using FullValidator_v42 = ParserImpl_v42<FullValidatorCfg>;
     using Reader_v42 = ParserImpl_v42<ReaderCfg>;
+    using OrderValidator_v42 = ParserImpl_v42<OrderValidatorCfg>;
+    using RecordsValidator_v42 = ParserImpl_v42<RecordsValidatorCfg>;
     
     using QuickValidator_v43 = ParserImpl_v43<QuickValidatorCfg>;
     using FullValidator_v43 = ParserImpl_v43<FullValidatorCfg>;
     using Reader_v43 = ParserImpl_v43<ReaderCfg>;
-
+    using OrderValidator_v43 = ParserImpl_v43<OrderValidatorCfg>;
+    using RecordsValidator_v43 = ParserImpl_v43<RecordsValidatorCfg>;
+
+    using ProfiledQuickValidator_v41 = ParserImpl_v41<ProfiledQuickValidatorCfg>;
+    using ProfiledFullValidator_v41 = ParserImpl_v41<ProfiledFullValidatorCfg>;
+    using ProfiledReader_v41 = ParserImpl_v41<ProfiledReaderCfg>;
+    using ProfiledOrderValidator_v41 = ParserImpl_v41<ProfiledOrderValidatorCfg>;
+    using ProfiledRecordsValidator_v41 = ParserImpl_v41<ProfiledRecordsValidatorCfg>;
+
+    using ProfiledQuickValidator_v42 = ParserImpl_v42<ProfiledQuickValidatorCfg>;
+    using ProfiledFullValidator_v42 = ParserImpl_v42<ProfiledFullValidatorCfg>;
+    using ProfiledReader_v42 = ParserImpl_v42<ProfiledReaderCfg>;
+    using ProfiledOrderValidator_v42 = ParserImpl_v42<ProfiledOrderValidatorCfg>;
+    using ProfiledRecordsValidator_v42 = ParserImpl_v42<ProfiledRecordsValidatorCfg>;
+
+    using ProfiledQuickValidator_v43 = ParserImpl_v43<ProfiledQuickValidatorCfg>;
+    using ProfiledFullValidator_v43 = ParserImpl_v43<ProfiledFullValidatorCfg>;
+    using ProfiledReader_v43 = ParserImpl_v43<ProfiledReaderCfg>;
+    using ProfiledOrderValidator_v43 = ParserImpl_v43<ProfiledOrderValidatorCfg>;
+    using ProfiledRecordsValidator_v43 = ParserImpl_v43<ProfiledRecordsValidatorCfg>;
+
+    // The parsers are instantiated for the configurations above in validator_detail_v4*.cpp, generated by ragel
+    // from vcf_v4*.ragel, so the state machines are only compiled there
+    extern template class ParserImpl_v41<QuickValidatorCfg>;
+    extern template class ParserImpl_v41<FullValidatorCfg>;
+    extern template class ParserImpl_v41<ReaderCfg>;
+    extern template class ParserImpl_v41<ProfiledQuickValidatorCfg>;
+    extern template class ParserImpl_v41<ProfiledFullValidatorCfg>;
+    extern template class ParserImpl_v41<ProfiledReaderCfg>;
+    extern template class ParserImpl_v41<OrderValidatorCfg>;
+    extern template class ParserImpl_v41<RecordsValidatorCfg>;
+    extern template class ParserImpl_v41<ProfiledOrderValidatorCfg>;
+    extern template class ParserImpl_v41<ProfiledRecordsValidatorCfg>;
+
+    extern template class ParserImpl_v42<QuickValidatorCfg>;
+    extern template class ParserImpl_v42<FullValidatorCfg>;
+    extern template class ParserImpl_v42<ReaderCfg>;
+    extern template class ParserImpl_v42<ProfiledQuickValidatorCfg>;
+    extern template class ParserImpl_v42<ProfiledFullValidatorCfg>;
+    extern template class ParserImpl_v42<ProfiledReaderCfg>;
+    extern template class ParserImpl_v42<OrderValidatorCfg>;
+    extern template class ParserImpl_v42<RecordsValidatorCfg>;
+    extern template class ParserImpl_v42<ProfiledOrderValidatorCfg>;
+    extern template class ParserImpl_v42<ProfiledRecordsValidatorCfg>;
+
+    extern template class ParserImpl_v43<QuickValidatorCfg>;
+    extern template class ParserImpl_v43<FullValidatorCfg>;
+    extern template class ParserImpl_v43<ReaderCfg>;
+    extern template class ParserImpl_v43<ProfiledQuickValidatorCfg>;
+    extern template class ParserImpl_v43<ProfiledFullValidatorCfg>;
+    extern template class ParserImpl_v43<ProfiledReaderCfg>;
+    extern template class ParserImpl_v43<OrderValidatorCfg>;
+    extern template class ParserImpl_v43<RecordsValidatorCfg>;
+    extern template class ParserImpl_v43<ProfiledOrderValidatorCfg>;
+    extern template class ParserImpl_v43<ProfiledRecordsValidatorCfg>;
+
+    /**
+     * Validates a plain, gzipped or BGZF input. BGZF blocks are decompressed with `threads` threads, and with the
+     * warning level the records are checked with as many.
+     *
+     * If a `fixer` is provided, it gets the input and its errors, and the whole input is read even if the outputs
+     * are full. The caller finishes it after the validation.
+     *
+     * If a `profile` is provided, the time of parsing and of each check is added to it. The time of writing the
+     * reports is only measured if the outputs are wrapped in a ProfiledReportWriter.
+     *
+     * If a `progress` monitor is provided, it is updated after parsing each block, and finished at the end.
+     *
+     * If a `memory` budget is provided, the input buffers and the cache for duplicates take the sizes it sets, and
+     * the memory of each area is recorded in it. The reports are not resized, that's up to the caller.
+     *
+     * With the triage level, only the records chosen by the `sampling` get every check, the rest only get their
+     * syntax, order and duplicates checked. The other levels ignore it.
+     *
+     * If an `index_builder` is provided, the lines of a BGZF input are added to it as they are decompressed, which
+     * is done by the BGZF reader even with a single thread. Other inputs are marked as impossible to index in it.
+     */
     bool is_valid_vcf_file(std::istream &input,
                            const std::string &sourceName,
                            ValidationLevel validationLevel,
-                           std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs);
+                           std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                           size_t threads = 1,
+                           debugulator::StreamingFixer * fixer = nullptr,
+                           Profile * profile = nullptr,
+                           ProgressMonitor * progress = nullptr,
+                           MemoryBudget * memory = nullptr,
+                           RecordSampling const & sampling = RecordSampling{},
+                           RegionIndexBuilder * index_builder = nullptr);
+
+    bool is_valid_vcf_file(util::BlockReader &input,
+                           const std::string &sourceName,
+                           ValidationLevel validationLevel,
+                           std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                           size_t threads = 1,
+                           debugulator::StreamingFixer * fixer = nullptr,
+                           Profile * profile = nullptr,
+                           ProgressMonitor * progress = nullptr,
+                           MemoryBudget * memory = nullptr,
+                           RecordSampling const & sampling = RecordSampling{},
+                           RegionIndexBuilder * index_builder = nullptr);
+
+    /**
+     * Validates a file mapped in memory. With several threads and the warning level, the body of a plain file is
+     * split in chunks that are validated in parallel, while reporting the same as a single thread.
+     *
+     * If a cache of `headers` is provided, the header of a plain file that was validated before at the same level
+     * is not parsed again: its warnings are reported again, and only the body is parsed. A header without errors
+     * that was not in the cache is added to it. The warnings of the header are reported before those of the first
+     * record even if both are of the same line, and the cache is not used if the input is fixed.
+     */
+    bool is_valid_vcf_file(util::MappedFileBlockReader &input,
+                           const std::string &sourceName,
+                           ValidationLevel validationLevel,
+                           std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                           size_t threads = 1,
+                           debugulator::StreamingFixer * fixer = nullptr,
+                           Profile * profile = nullptr,
+                           ProgressMonitor * progress = nullptr,
+                           MemoryBudget * memory = nullptr,
+                           RecordSampling const & sampling = RecordSampling{},
+                           HeaderCache * headers = nullptr,
+                           RegionIndexBuilder * index_builder = nullptr);
+
+    /**
+     * Validates the header of a BGZF file and its records that overlap some regions, decompressing only the blocks
+     * that its index points to.
+     *
+     * The checks that need the rest of the file are scoped to those records: the order of the contigs and
+     * positions, and the duplicated variants, are only checked among them. The line numbers of the reports count
+     * the header and then only those records.
+     */
+    bool is_valid_vcf_regions(util::MappedFileBlockReader &input,
+                              const std::string &sourceName,
+                              std::vector<Region> const & regions,
+                              RegionIndex const & index,
+                              ValidationLevel validationLevel,
+                              std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                              size_t threads = 1,
+                              Profile * profile = nullptr,
+                              ProgressMonitor * progress = nullptr,
+                              MemoryBudget * memory = nullptr,
+                              RecordSampling const & sampling = RecordSampling{});
+
+    /**
+     * Validates a whole BGZF file with several threads, splitting its body where its index says a record starts,
+     * so no compressed block has to be read twice to find the lines. Each chunk is decompressed and parsed by its
+     * own parser, created from the one of the header; their reports, the order of the records and the duplicates
+     * across chunks are merged in the order of the file, so they are the same as in a single pass.
+     *
+     * Files that are not BGZF, or whose body can't be split at that level (see is_valid_vcf_file), are validated
+     * in a single pass.
+     */
+    bool is_valid_vcf_indexed(util::MappedFileBlockReader &input,
+                              const std::string &sourceName,
+                              RegionIndex const & index,
+                              ValidationLevel validationLevel,
+                              std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                              size_t threads,
+                              Profile * profile = nullptr,
+                              ProgressMonitor * progress = nullptr,
+                              MemoryBudget * memory = nullptr,
+                              RecordSampling const & sampling = RecordSampling{});
+
+    /**
+     * Validates a plain or BGZF file mapped in memory, writing checkpoints from which the validation can be resumed
+     * if it is interrupted. If a checkpoint was loaded, the validation resumes from it: the header is parsed again
+     * without reporting it, and the reports continue where they were.
+     *
+     * With an incremental state, the state of the parser at the end of the input is written to it, and if one was
+     * loaded and the input only grew since then, only the lines after it are validated, as if the validation had
+     * continued.
+     *
+     * Either `checkpoints` or `incremental` may be null. The body is parsed by a single thread, which may check the
+     * records with more. The checkpoint is removed once the validation is finished.
+     */
+    bool is_valid_vcf_file_with_checkpoints(util::MappedFileBlockReader &input,
+                                            const std::string &sourceName,
+                                            ValidationLevel validationLevel,
+                                            std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                                            Checkpoints * checkpoints,
+                                            IncrementalState * incremental,
+                                            size_t threads = 1,
+                                            Profile * profile = nullptr,
+                                            ProgressMonitor * progress = nullptr,
+                                            MemoryBudget * memory = nullptr,
+                                            RecordSampling const & sampling = RecordSampling{});
 
     bool is_compressed_file(const std::string &source,
                             const std::vector<char> &line);
@@ -195,8 +778,4 @@ namespace ebi
   }
 }
 
-#include "validator_detail_v41.hpp"
-#include "validator_detail_v42.hpp"
-#include "validator_detail_v43.hpp"
-
 #endif // VCF_VALIDATOR_HPP
@@ -15,12 +15,17 @@
  */
 
 #include <fstream>
+#include <memory>
 #include <string>
 
+#include <boost/filesystem/operations.hpp>
 #include <boost/program_options.hpp>
 
 #include "cmake_config.hpp"
+#include "util/bgzf_writer.hpp"
+#include "util/block_reader.hpp"
 #include "util/logger.hpp"
+#include "vcf/binary_report.hpp"
 #include "vcf/odb_report.hpp"
 #include "vcf/string_constants.hpp"
 #include "vcf/debugulator.hpp"
@@ -45,9 +50,12 @@ namespace
               (ebi::vcf::HELP_OPTION, "Display this help")
               (ebi::vcf::VERSION_OPTION, "Display version of the debugulator")
               (ebi::vcf::INPUT_OPTION, po::value<std::string>()->default_value(ebi::vcf::STDIN), "Path to the input VCF file, or stdin")
-              (ebi::vcf::ERRORS_OPTION, po::value<std::string>(), "Path to the errors report from the input VCF file")
+              (ebi::vcf::ERRORS_OPTION, po::value<std::string>(), "Path to the errors report from the input VCF file, in database or binary format")
               (ebi::vcf::LEVEL_OPTION, po::value<std::string>()->default_value(ebi::vcf::WARNING), "Validation level (error, warning, stop)")
               (ebi::vcf::OUTPUT_OPTION, po::value<std::string>()->default_value(ebi::vcf::STDOUT), "Write to a file or stdout")
+              (ebi::vcf::BGZIP, "Compress the output as BGZF, with the same bytes as bgzip, so it can be indexed with tabix")
+              (ebi::vcf::COMPRESSION_LEVEL, po::value<int>()->default_value(-1), "Compression level of --bgzip, from 0 to 9, or -1 for the default of zlib")
+              (ebi::vcf::THREADS_OPTION, po::value<size_t>()->default_value(1), "Number of threads to compress the output with --bgzip")
       ;
 
       return description;
@@ -72,6 +80,19 @@ namespace
           return 1;
       }
 
+      int compression_level = vm[ebi::vcf::COMPRESSION_LEVEL].as<int>();
+      if (compression_level < -1 || compression_level > 9) {
+          std::cout << desc << std::endl;
+          BOOST_LOG_TRIVIAL(error) << "Please choose a compression level from -1 to 9";
+          return 1;
+      }
+
+      if (vm[ebi::vcf::THREADS].as<size_t>() == 0) {
+          std::cout << desc << std::endl;
+          BOOST_LOG_TRIVIAL(error) << "Please use at least one thread";
+          return 1;
+      }
+
       if (!vm.count(ebi::vcf::ERRORS)) {
           std::cout << desc << std::endl;
           BOOST_LOG_TRIVIAL(error) << "Please specify the path to the errors report (--errors)";
@@ -124,12 +145,41 @@ int main(int argc, char **argv)
             BOOST_LOG_TRIVIAL(info) << "Writing to standard output...";
         }
 
-        ebi::vcf::OdbReportRW errorDAO{errors};
+        std::unique_ptr<ebi::vcf::ReportReader> errorDAO;
+        if (ebi::vcf::binary_report::is_binary_report(errors)) {
+            errorDAO.reset(new ebi::vcf::BinaryReportReader{errors});
+        } else {
+            errorDAO.reset(new ebi::vcf::OdbReportRW{errors});
+        }
 
         auto &input_stream = input_path == ebi::vcf::STDIN ? std::cin : input_file;
-        auto &output_stream = output_path == ebi::vcf::STDOUT ? std::cout : output_file;
+        auto &plain_output = output_path == ebi::vcf::STDOUT ? std::cout : output_file;
+
+        // the fixed text is compressed on its way out, instead of in another pass over the file
+        std::unique_ptr<ebi::util::BgzfStreamBuffer> compressor;
+        std::unique_ptr<std::ostream> compressed_output;
+        if (vm.count(ebi::vcf::BGZIP)) {
+            compressor.reset(new ebi::util::BgzfStreamBuffer{plain_output, vm[ebi::vcf::THREADS].as<size_t>(),
+                                                             vm[ebi::vcf::COMPRESSION_LEVEL].as<int>()});
+            compressed_output.reset(new std::ostream{compressor.get()});
+        }
+        auto &output_stream = compressor ? *compressed_output : plain_output;
+
+        if (input_path != ebi::vcf::STDIN && boost::filesystem::is_regular_file(input_path)) {
+            // regular files are mapped in memory, so the lines without errors are copied straight from the mapping
+            input_file.close();
+            ebi::util::MappedFileBlockReader reader{input_path};
+            ebi::vcf::debugulator::fix_vcf_file(reader, *errorDAO, output_stream);
+        } else {
+            ebi::vcf::debugulator::fix_vcf_file(input_stream, *errorDAO, output_stream);
+        }
 
-        ebi::vcf::debugulator::fix_vcf_file(input_stream, errorDAO, output_stream);
+        if (compressor) {
+            if (!output_stream) {
+                throw std::runtime_error{"Couldn't compress the output"};
+            }
+            compressor->close();
+        }
 
         return 0;
 
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 #include <memory>
@@ -22,18 +23,34 @@
 #include <stdexcept>
 #include <chrono>
 #include <iomanip>
+#include <sstream>
 
 #include <boost/program_options.hpp>
 #include <boost/filesystem/operations.hpp>
 
 #include "cmake_config.hpp"
+#include "util/block_reader.hpp"
 #include "util/logger.hpp"
+#include "util/trace.hpp"
+#include "util/worker_pool.hpp"
+#include "vcf/allocation_stats.hpp"
+#include "vcf/async_report_writer.hpp"
+#include "vcf/binary_report.hpp"
+#include "vcf/checkpoint.hpp"
+#include "vcf/debugulator.hpp"
 #include "vcf/file_structure.hpp"
+#include "vcf/header_cache.hpp"
+#include "vcf/memory_budget.hpp"
+#include "vcf/region_index.hpp"
 #include "vcf/validator.hpp"
 #include "vcf/report_writer.hpp"
 #include "vcf/odb_report.hpp"
 #include "vcf/summary_report_writer.hpp"
 
+#ifdef VCF_REMOTE_INPUT
+#include "util/http_range_source.hpp"
+#endif
+
 namespace
 {
     namespace po = boost::program_options;
@@ -48,15 +65,70 @@ namespace
         description.add_options()
             (ebi::vcf::HELP_OPTION, "Display this help")
             (ebi::vcf::VERSION_OPTION, "Display version of the validator")
-            (ebi::vcf::INPUT_OPTION, po::value<std::string>()->default_value(ebi::vcf::STDIN), "Path to the input VCF file, or stdin")
-            (ebi::vcf::LEVEL_OPTION, po::value<std::string>()->default_value(ebi::vcf::WARNING), "Validation level (error, warning, stop)")
-            (ebi::vcf::REPORT_OPTION, po::value<std::string>()->default_value(ebi::vcf::SUMMARY), "Comma separated values for types of reports (summary, text, database)")
+            (ebi::vcf::INPUT_OPTION, po::value<std::vector<std::string>>()->multitoken()->default_value({ebi::vcf::STDIN}, ebi::vcf::STDIN), "Paths to the input VCF files, or stdin. With the REMOTE_INPUT option of CMake, they can also be http://, https:// or s3:// URLs")
+            (ebi::vcf::MANIFEST_OPTION, po::value<std::string>(), "Path to a file listing the input VCF files, one per line")
+            (ebi::vcf::JOBS_OPTION, po::value<size_t>()->default_value(1), "Number of input files validated at the same time")
+            (ebi::vcf::LEVEL_OPTION, po::value<std::string>()->default_value(ebi::vcf::WARNING), "Validation level: error (syntax), warning (everything), stop (everything until the first error), order (syntax, order and duplicates), records (order, duplicates and the fields of each record but its samples, no warnings) or triage (order and duplicates of every record, everything else on a sample of them, see --triage-fraction)")
+            (ebi::vcf::REPORT_OPTION, po::value<std::string>()->default_value(ebi::vcf::SUMMARY), "Comma separated values for types of reports (summary, text, database, binary)")
             (ebi::vcf::OUTDIR_OPTION, po::value<std::string>()->default_value(""), "Directory for the output")
+            (ebi::vcf::THREADS_OPTION, po::value<size_t>()->default_value(1), "Number of threads to decompress BGZF input and check records")
+            (ebi::vcf::CONNECTIONS, po::value<size_t>()->default_value(4), "Number of range requests at the same time to read each http://, https:// or s3:// input")
+            (ebi::vcf::MAX_ERRORS_PER_TYPE_OPTION, po::value<size_t>()->default_value(0), "Maximum number of errors of each type written to the text and database reports, 0 for no limit")
+            (ebi::vcf::MAX_ERRORS_OPTION, po::value<size_t>()->default_value(0), "Maximum number of errors written to the text and database reports, 0 for no limit")
+            (ebi::vcf::FIX_OPTION, po::value<std::string>(), "Path to write a copy of the input with the errors fixed like the debugulator does, in the same pass")
+            (ebi::vcf::PROFILE, "Measure the time and calls of parsing, of each check and of writing the reports, and log them ranked at the end")
+            (ebi::vcf::STATS, "Count the heap allocations of each stage of the validation, and log them per record at the end. Only available if built with the ALLOCATION_STATS option of CMake")
+            (ebi::vcf::TRACE, po::value<std::string>(), "Path to write a timeline of the reading, decompression, parsing, checks and reports of every thread, in the trace-event JSON format of Chrome and Perfetto")
+            (ebi::vcf::PROGRESS, po::value<size_t>()->default_value(0)->implicit_value(60), "Log the progress of the validation every this many seconds (60 if no value is given), 0 for never")
+            (ebi::vcf::MEMORY_LIMIT, po::value<std::string>(), "Memory limit shared by the jobs, like 512M or 2G: the buffers and caches are sized to fit in it, and the memory used is logged at the end")
+            (ebi::vcf::REGION, po::value<std::vector<std::string>>()->composing(), "Only validate the header and the records overlapping this region, like chr1:1000-2000; can be repeated. The input must be BGZF with a tabix or CSI index")
+            (ebi::vcf::REGIONS_FILE, po::value<std::string>(), "Like --region, with the regions of a BED file")
+            (ebi::vcf::CHECKPOINT, po::value<size_t>()->default_value(0)->implicit_value(600), "Write a checkpoint of the validation every this many seconds (600 if no value is given) next to the reports, to resume it if it is interrupted; 0 for never")
+            (ebi::vcf::RESUME, "Resume the validation from its checkpoint, if there is one, continuing its reports")
+            (ebi::vcf::EXACT_DUPLICATES, po::value<std::string>()->implicit_value(""), "Find every duplicated variant, not only those close to each other, sorting all the variants in temporary files in this directory (the temporary directory of the system if no value is given); they are reported at the end")
+            (ebi::vcf::DUPLICATE_FILTER, po::value<size_t>(), "Also find the duplicates of the variants too far away to be compared, with a Bloom filter sized for this many variants; they are reported at the end")
+            (ebi::vcf::FALSE_POSITIVE_RATE, po::value<double>()->default_value(0.01), "False positive rate of the filter of --duplicate-filter, whose suspects are then checked exactly")
+            (ebi::vcf::INCREMENTAL, po::value<std::string>(), "Path to the state of the validation of a growing file: only the lines appended since it was written are validated, and it is updated")
+            (ebi::vcf::TRIAGE_FRACTION, po::value<double>()->default_value(0.1), "Fraction of the records fully checked by the triage level, chosen at random but the same in every run")
+            (ebi::vcf::TRIAGE_EVERY, po::value<size_t>(), "Fully check 1 of every this many records in the triage level, instead of a random fraction")
+            (ebi::vcf::WRITE_INDEX, po::value<std::string>()->implicit_value(ebi::vcf::TBI), "Write a tabix (tbi, if no value is given) or CSI (csi) index of each BGZF input next to its reports, built while validating it; it is only written if its records are sorted")
         ;
 
         return description;
     }
 
+    /**
+     * Whether an input is read from the network instead of from a file
+     */
+    bool is_remote(std::string const & path)
+    {
+        for (char const * scheme : {"http://", "https://", "s3://"}) {
+            if (path.compare(0, std::char_traits<char>::length(scheme), scheme) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Number of bytes of a size like 512M, with an optional K, M or G suffix
+     */
+    size_t parse_size(std::string const & size)
+    {
+        size_t digits;
+        size_t value = std::stoull(size, &digits);
+        std::string suffix = size.substr(digits);
+        if (suffix.empty()) {
+            return value;
+        }
+        std::string const units = "KMG";
+        size_t exponent = units.find(static_cast<char>(toupper(suffix[0])));
+        if (suffix.size() > 2 || exponent == std::string::npos) {
+            throw std::invalid_argument{"Unknown suffix of the size " + size};
+        }
+        return value << (10 * (exponent + 1));
+    }
+
     int check_command_line_options(po::variables_map const & vm, po::options_description const & desc)
     {
         if (vm.count(ebi::vcf::HELP)) {
@@ -70,15 +142,241 @@ namespace
         }
 
         std::string level = vm[ebi::vcf::LEVEL].as<std::string>();
-        if (level != ebi::vcf::ERROR && level != ebi::vcf::WARNING && level != ebi::vcf::STOP) {
+        if (level != ebi::vcf::ERROR && level != ebi::vcf::WARNING && level != ebi::vcf::STOP
+                && level != ebi::vcf::ORDER && level != ebi::vcf::RECORDS && level != ebi::vcf::TRIAGE) {
             std::cout << desc << std::endl;
             BOOST_LOG_TRIVIAL(error) << "Please choose one of the accepted validation levels";
             return 1;
         }
 
+        if (vm.count(ebi::vcf::FIX) && level == ebi::vcf::STOP) {
+            std::cout << desc << std::endl;
+            BOOST_LOG_TRIVIAL(error) << "Please choose a level other than stop to fix the input";
+            return 1;
+        }
+
+        if (vm.count(ebi::vcf::FIX) && (vm.count(ebi::vcf::REGION) || vm.count(ebi::vcf::REGIONS_FILE))) {
+            std::cout << desc << std::endl;
+            BOOST_LOG_TRIVIAL(error) << "Please fix the whole input, not only some regions";
+            return 1;
+        }
+
+        bool checkpoints = vm[ebi::vcf::CHECKPOINT].as<size_t>() != 0 || vm.count(ebi::vcf::RESUME);
+        if (checkpoints && (vm.count(ebi::vcf::FIX) || vm.count(ebi::vcf::REGION) || vm.count(ebi::vcf::REGIONS_FILE))) {
+            std::cout << desc << std::endl;
+            BOOST_LOG_TRIVIAL(error) << "Please validate the whole input without fixing it to use checkpoints";
+            return 1;
+        }
+
+        if (vm.count(ebi::vcf::INCREMENTAL)
+                && (vm.count(ebi::vcf::FIX) || vm.count(ebi::vcf::REGION) || vm.count(ebi::vcf::REGIONS_FILE))) {
+            std::cout << desc << std::endl;
+            BOOST_LOG_TRIVIAL(error) << "Please validate the whole input without fixing it to validate it incrementally";
+            return 1;
+        }
+
+        if (checkpoints && vm[ebi::vcf::REPORT].as<std::string>().find(ebi::vcf::DATABASE) != std::string::npos) {
+            std::cout << desc << std::endl;
+            BOOST_LOG_TRIVIAL(error) << "The database report can't be resumed from a checkpoint, please use the binary one";
+            return 1;
+        }
+
+        if (vm.count(ebi::vcf::EXACT_DUPLICATES) && (checkpoints || vm.count(ebi::vcf::INCREMENTAL) || vm.count(ebi::vcf::FIX))) {
+            std::cout << desc << std::endl;
+            BOOST_LOG_TRIVIAL(error) << "The exact duplicates are only found at the end, please validate the whole input at once without fixing it";
+            return 1;
+        }
+
+        if (vm.count(ebi::vcf::DUPLICATE_FILTER) && (vm.count(ebi::vcf::EXACT_DUPLICATES) || checkpoints || vm.count(ebi::vcf::INCREMENTAL) || vm.count(ebi::vcf::FIX))) {
+            std::cout << desc << std::endl;
+            BOOST_LOG_TRIVIAL(error) << "The duplicates found by the filter are only reported at the end, please validate the whole input at once without fixing it or finding the exact duplicates";
+            return 1;
+        }
+
+        if (vm.count(ebi::vcf::DUPLICATE_FILTER)) {
+            double rate = vm[ebi::vcf::FALSE_POSITIVE_RATE].as<double>();
+            if (!(rate > 0 && rate < 1)) {
+                std::cout << desc << std::endl;
+                BOOST_LOG_TRIVIAL(error) << "Please use a false positive rate between 0 and 1";
+                return 1;
+            }
+        }
+
+        double triage_fraction = vm[ebi::vcf::TRIAGE_FRACTION].as<double>();
+        if (!(triage_fraction > 0 && triage_fraction <= 1)
+                || (vm.count(ebi::vcf::TRIAGE_EVERY) && vm[ebi::vcf::TRIAGE_EVERY].as<size_t>() == 0)) {
+            std::cout << desc << std::endl;
+            BOOST_LOG_TRIVIAL(error) << "Please triage a fraction of the records greater than 0 and at most 1, or 1 of every at least 1 records";
+            return 1;
+        }
+
+        if (vm.count(ebi::vcf::WRITE_INDEX)) {
+            auto format = vm[ebi::vcf::WRITE_INDEX].as<std::string>();
+            if (format != ebi::vcf::TBI && format != ebi::vcf::CSI) {
+                std::cout << desc << std::endl;
+                BOOST_LOG_TRIVIAL(error) << "Please write the index in the tbi or csi format";
+                return 1;
+            }
+        }
+
+        if (vm.count(ebi::vcf::STATS) && !ebi::vcf::AllocationStats::is_available()) {
+            std::cout << desc << std::endl;
+            BOOST_LOG_TRIVIAL(error) << "Please build the validator with the ALLOCATION_STATS option of CMake to count the allocations";
+            return 1;
+        }
+
+        if (vm[ebi::vcf::THREADS].as<size_t>() == 0) {
+            std::cout << desc << std::endl;
+            BOOST_LOG_TRIVIAL(error) << "Please use at least one thread";
+            return 1;
+        }
+
+        if (vm[ebi::vcf::JOBS].as<size_t>() == 0) {
+            std::cout << desc << std::endl;
+            BOOST_LOG_TRIVIAL(error) << "Please use at least one job";
+            return 1;
+        }
+
+        if (vm.count(ebi::vcf::MEMORY_LIMIT)) {
+            try {
+                parse_size(vm[ebi::vcf::MEMORY_LIMIT].as<std::string>());
+            } catch (std::invalid_argument const & ex) {
+                std::cout << desc << std::endl;
+                BOOST_LOG_TRIVIAL(error) << "Please write the memory limit as a number of bytes with a K, M or G suffix";
+                return 1;
+            }
+        }
+
         return 0;
     }
 
+    /**
+     * The files given with --input, or else the ones listed in the manifest. Empty lines and lines starting with
+     * '#' in the manifest are skipped.
+     */
+    std::vector<std::string> get_inputs(po::variables_map const & vm)
+    {
+        std::vector<std::string> inputs;
+        if (vm.count(ebi::vcf::MANIFEST) && vm[ebi::vcf::INPUT].defaulted()) {
+            auto manifest_path = vm[ebi::vcf::MANIFEST].as<std::string>();
+            std::ifstream manifest{manifest_path};
+            if (!manifest) {
+                throw std::runtime_error{"Couldn't open file " + manifest_path};
+            }
+            std::string line;
+            while (std::getline(manifest, line)) {
+                if (!line.empty() && line.back() == '\r') {
+                    line.pop_back();
+                }
+                if (!line.empty() && line[0] != '#') {
+                    inputs.push_back(line);
+                }
+            }
+        } else {
+            inputs = vm[ebi::vcf::INPUT].as<std::vector<std::string>>();
+        }
+        return inputs;
+    }
+
+    int check_input_list(po::variables_map const & vm, std::vector<std::string> const & inputs,
+                         po::options_description const & desc)
+    {
+        if (vm.count(ebi::vcf::MANIFEST) && !vm[ebi::vcf::INPUT].defaulted()) {
+            std::cout << desc << std::endl;
+            BOOST_LOG_TRIVIAL(error) << "Please provide the input files either with --input or with --manifest";
+            return 1;
+        }
+
+        if (inputs.empty()) {
+            BOOST_LOG_TRIVIAL(error) << "The manifest doesn't list any input file";
+            return 1;
+        }
+
+        bool regions = vm.count(ebi::vcf::REGION) || vm.count(ebi::vcf::REGIONS_FILE);
+        if (regions && std::find(inputs.begin(), inputs.end(), ebi::vcf::STDIN) != inputs.end()) {
+            std::cout << desc << std::endl;
+            BOOST_LOG_TRIVIAL(error) << "The regions can only be validated in an indexed file, not in the standard input";
+            return 1;
+        }
+
+        bool checkpoints = vm[ebi::vcf::CHECKPOINT].as<size_t>() != 0 || vm.count(ebi::vcf::RESUME);
+        if (checkpoints && std::find(inputs.begin(), inputs.end(), ebi::vcf::STDIN) != inputs.end()) {
+            std::cout << desc << std::endl;
+            BOOST_LOG_TRIVIAL(error) << "Only files can be validated with checkpoints, not the standard input";
+            return 1;
+        }
+
+        if (vm.count(ebi::vcf::INCREMENTAL)
+                && (inputs.size() > 1 || std::find(inputs.begin(), inputs.end(), ebi::vcf::STDIN) != inputs.end())) {
+            std::cout << desc << std::endl;
+            BOOST_LOG_TRIVIAL(error) << "Please validate a single file, not the standard input, incrementally";
+            return 1;
+        }
+
+        if (vm.count(ebi::vcf::WRITE_INDEX)
+                && (regions || checkpoints || vm.count(ebi::vcf::INCREMENTAL)
+                    || std::find(inputs.begin(), inputs.end(), ebi::vcf::STDIN) != inputs.end())) {
+            std::cout << desc << std::endl;
+            BOOST_LOG_TRIVIAL(error) << "An index can only be written for a whole file, not the standard input, "
+                                     << "validated without regions, checkpoints or an incremental state";
+            return 1;
+        }
+
+        bool remote = std::any_of(inputs.begin(), inputs.end(), is_remote);
+        if (remote && (regions || checkpoints || vm.count(ebi::vcf::INCREMENTAL))) {
+            std::cout << desc << std::endl;
+            BOOST_LOG_TRIVIAL(error) << "A remote input can only be validated whole, without regions, checkpoints or "
+                                     << "an incremental state";
+            return 1;
+        }
+
+        bool bcf = std::any_of(inputs.begin(), inputs.end(), [](std::string const & input) {
+            return boost::filesystem::path{input}.extension().string() == ebi::vcf::BCF;
+        });
+        if (bcf && (regions || checkpoints || vm.count(ebi::vcf::INCREMENTAL) || vm.count(ebi::vcf::FIX))) {
+            std::cout << desc << std::endl;
+            BOOST_LOG_TRIVIAL(error) << "A BCF input can only be validated whole and without fixing it";
+            return 1;
+        }
+
+        if (inputs.size() > 1) {
+            if (std::find(inputs.begin(), inputs.end(), ebi::vcf::STDIN) != inputs.end()) {
+                std::cout << desc << std::endl;
+                BOOST_LOG_TRIVIAL(error) << "The standard input can't be validated along with other inputs";
+                return 1;
+            }
+            if (vm.count(ebi::vcf::FIX)) {
+                std::cout << desc << std::endl;
+                BOOST_LOG_TRIVIAL(error) << "Please fix the input files one at a time";
+                return 1;
+            }
+        }
+        return 0;
+    }
+
+    /**
+     * The regions given with --region and in the BED file of --regions-file, if any
+     */
+    std::vector<ebi::vcf::Region> get_regions(po::variables_map const & vm)
+    {
+        std::vector<ebi::vcf::Region> regions;
+        if (vm.count(ebi::vcf::REGION)) {
+            for (auto & region : vm[ebi::vcf::REGION].as<std::vector<std::string>>()) {
+                regions.push_back(ebi::vcf::parse_region(region));
+            }
+        }
+        if (vm.count(ebi::vcf::REGIONS_FILE)) {
+            auto bed_path = vm[ebi::vcf::REGIONS_FILE].as<std::string>();
+            std::ifstream bed{bed_path};
+            if (!bed) {
+                throw std::runtime_error{"Couldn't open file " + bed_path};
+            }
+            auto bed_regions = ebi::vcf::read_bed_regions(bed);
+            regions.insert(regions.end(), bed_regions.begin(), bed_regions.end());
+        }
+        return regions;
+    }
+
     ebi::vcf::ValidationLevel get_validation_level(std::string const & level_str)
     {
         if (level_str == ebi::vcf::ERROR) {
@@ -87,15 +385,36 @@ namespace
             return ebi::vcf::ValidationLevel::warning;
         } else if (level_str == ebi::vcf::STOP) {
             return ebi::vcf::ValidationLevel::stop;
+        } else if (level_str == ebi::vcf::ORDER) {
+            return ebi::vcf::ValidationLevel::order;
+        } else if (level_str == ebi::vcf::RECORDS) {
+            return ebi::vcf::ValidationLevel::records;
+        } else if (level_str == ebi::vcf::TRIAGE) {
+            return ebi::vcf::ValidationLevel::triage;
         }
 
         throw std::invalid_argument{"Please choose one of the accepted validation levels"};
     }
 
+    /**
+     * Records fully checked by the triage level, every record in the other levels
+     */
+    ebi::vcf::RecordSampling get_record_sampling(po::variables_map const & vm, ebi::vcf::ValidationLevel level)
+    {
+        if (level != ebi::vcf::ValidationLevel::triage) {
+            return ebi::vcf::RecordSampling{};
+        }
+        if (vm.count(ebi::vcf::TRIAGE_EVERY)) {
+            return ebi::vcf::RecordSampling::every(vm[ebi::vcf::TRIAGE_EVERY].as<size_t>());
+        }
+        return ebi::vcf::RecordSampling::random(vm[ebi::vcf::TRIAGE_FRACTION].as<double>());
+    }
+
     std::string get_output_path(const std::string &outdir, const std::string &file_path)
     {
         if (outdir == "") {
-            return file_path;
+            // the reports of a remote input are written in the current directory
+            return is_remote(file_path) ? boost::filesystem::path{file_path}.filename().string() : file_path;
         }
         
         boost::filesystem::path file_boost_path{file_path};
@@ -109,7 +428,16 @@ namespace
         return outdir_boost_path.string();
     }
 
-    std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> get_outputs(std::string const &output_str, std::string const &input) {
+    /**
+     * Reports of the types listed in `output_str`, named after the input and the time. When resuming from a
+     * checkpoint, `resumed_files` are the files of the reports to continue instead.
+     */
+    std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> get_outputs(std::string const &output_str,
+                                                                     std::string const &input,
+                                                                     size_t max_errors_per_type,
+                                                                     size_t max_errors,
+                                                                     ebi::vcf::MemoryBudget & memory,
+                                                                     std::vector<std::string> const &resumed_files) {
         std::vector<std::string> outs;
         ebi::util::string_split(output_str, ",", outs);
         size_t initial_size = outs.size();
@@ -125,22 +453,46 @@ namespace
 
         auto epoch = std::chrono::system_clock::now().time_since_epoch();
         auto timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(epoch).count();
-        for (auto out : outs) {
-            if (out == ebi::vcf::DATABASE || out == ebi::vcf::TEXT || out == ebi::vcf::SUMMARY) {
-                std::string filetype = (out == ebi::vcf::DATABASE ? "db" : "txt");
+        bool resume = !resumed_files.empty();
+        if (resume && resumed_files.size() != outs.size()) {
+            throw std::runtime_error{"Please request the same reports as when the checkpoint was written"};
+        }
+        for (size_t i = 0; i < outs.size(); ++i) {
+            auto & out = outs[i];
+            if (out == ebi::vcf::DATABASE || out == ebi::vcf::TEXT || out == ebi::vcf::SUMMARY || out == ebi::vcf::BINARY) {
+                std::string filetype = (out == ebi::vcf::DATABASE ? "db" : out == ebi::vcf::BINARY ? "bin" : "txt");
                 std::string errortype = (out == ebi::vcf::SUMMARY) ? "errors_summary" : "errors";
                 std::string filename = input + "." + errortype + "." + std::to_string(timestamp) + "." + filetype;
-                boost::filesystem::path file{filename};
-                if (boost::filesystem::exists(file)) {
+                if (resume) {
+                    filename = resumed_files[i];
+                    std::string prefix = input + "." + errortype + ".";
+                    std::string suffix = "." + filetype;
+                    if (filename.compare(0, prefix.size(), prefix) != 0 || filename.size() < prefix.size() + suffix.size()
+                            || filename.compare(filename.size() - suffix.size(), suffix.size(), suffix) != 0) {
+                        throw std::runtime_error{"Please request the same reports as when the checkpoint was written"};
+                    }
+                } else if (boost::filesystem::exists(boost::filesystem::path{filename})) {
                     throw std::runtime_error{"Report file already exists on " + filename + ", please delete it or rename it"};
                 }
+                std::unique_ptr<ebi::vcf::ReportWriter> output;
                 if (out == ebi::vcf::DATABASE) {
-                    outputs.emplace_back(new ebi::vcf::OdbReportRW(filename));
+                    output.reset(new ebi::vcf::OdbReportRW(filename));
                 } else if (out == ebi::vcf::TEXT) {
-                    outputs.emplace_back(new ebi::vcf::FileReportWriter(filename));
+                    output.reset(new ebi::vcf::FileReportWriter(filename, resume));
+                } else if (out == ebi::vcf::BINARY) {
+                    output.reset(new ebi::vcf::BinaryReportWriter(filename, resume));
                 } else {
-                    outputs.emplace_back(new ebi::vcf::SummaryReportWriter(filename));
+                    output.reset(new ebi::vcf::SummaryReportWriter(filename));
                 }
+
+                // the reports are written by their own threads, and limited before being queued
+                output.reset(new ebi::vcf::AsyncReportWriter(std::move(output), memory.max_queued_errors, &memory));
+
+                // the summary always counts every error, it only writes one line per type anyway
+                if (out != ebi::vcf::SUMMARY && (max_errors_per_type != 0 || max_errors != 0)) {
+                    output.reset(new ebi::vcf::LimitedReportWriter(std::move(output), max_errors_per_type, max_errors));
+                }
+                outputs.push_back(std::move(output));
             } else {
                 throw std::invalid_argument{"Please use only valid report types"};
             }
@@ -149,6 +501,280 @@ namespace
         return outputs;
     }
 
+    /**
+     * Logs the allocations counted since the beginning of the validation, of all the inputs, if they were requested
+     */
+    void log_allocation_stats(po::variables_map const & vm)
+    {
+        if (vm.count(ebi::vcf::STATS)) {
+            std::ostringstream table;
+            ebi::vcf::AllocationStats::write(table);
+            BOOST_LOG_TRIVIAL(info) << "Heap allocations of the validation by stage:\n" << table.str();
+        }
+    }
+
+    /**
+     * Writes the timeline recorded since the beginning of the validation, of all the inputs, if it was requested
+     */
+    void write_trace(po::variables_map const & vm)
+    {
+        if (vm.count(ebi::vcf::TRACE)) {
+            ebi::util::Trace::stop();
+            std::string path = vm[ebi::vcf::TRACE].as<std::string>();
+            std::ofstream trace{path};
+            ebi::util::Trace::write(trace);
+            if (!trace) {
+                BOOST_LOG_TRIVIAL(error) << "Couldn't write the trace " << path;
+            } else {
+                BOOST_LOG_TRIVIAL(info) << "Trace written to : " << path;
+            }
+        }
+    }
+
+    /**
+     * Outcome of validating one input
+     */
+    enum class InputResult { VALID, NOT_VALID, FAILED };
+
+    /**
+     * Validates one input. The `headers` validated before, if any, are shared by the jobs of a batch.
+     */
+    InputResult validate_input(std::string const & path, po::variables_map const & vm,
+                               ebi::vcf::HeaderCache * headers = nullptr)
+    {
+        try {
+            auto level = vm[ebi::vcf::LEVEL].as<std::string>();
+            ebi::vcf::ValidationLevel validationLevel = get_validation_level(level);
+            ebi::vcf::RecordSampling sampling = get_record_sampling(vm, validationLevel);
+            auto outdir = get_output_path(vm[ebi::vcf::OUTDIR].as<std::string>(), path);
+            auto threads = vm[ebi::vcf::THREADS].as<size_t>();
+
+            // the jobs validate at the same time, so each one gets its part of the limit
+            std::unique_ptr<ebi::vcf::MemoryBudget> memory{new ebi::vcf::MemoryBudget{}};
+            size_t memory_limit = vm.count(ebi::vcf::MEMORY_LIMIT) ? parse_size(vm[ebi::vcf::MEMORY_LIMIT].as<std::string>()) : 0;
+            if (memory_limit != 0) {
+                auto report = vm[ebi::vcf::REPORT].as<std::string>();
+                size_t n_reports = std::count(report.begin(), report.end(), ',') + 1;
+                memory.reset(new ebi::vcf::MemoryBudget{memory_limit / vm[ebi::vcf::JOBS].as<size_t>(), threads,
+                                                        n_reports});
+            }
+
+            if (vm.count(ebi::vcf::EXACT_DUPLICATES)) {
+                auto directory = vm[ebi::vcf::EXACT_DUPLICATES].as<std::string>();
+                memory->spill_directory = directory.empty() ? boost::filesystem::temp_directory_path().string()
+                                                            : directory;
+            }
+            if (vm.count(ebi::vcf::DUPLICATE_FILTER)) {
+                memory->filtered_variants = vm[ebi::vcf::DUPLICATE_FILTER].as<size_t>();
+                memory->false_positive_rate = vm[ebi::vcf::FALSE_POSITIVE_RATE].as<double>();
+            }
+
+            // the checkpoint is next to the reports, which are continued when resuming from it
+            std::unique_ptr<ebi::vcf::Checkpoints> checkpoints;
+            auto checkpoint_seconds = vm[ebi::vcf::CHECKPOINT].as<size_t>();
+            if (checkpoint_seconds != 0 || vm.count(ebi::vcf::RESUME)) {
+                auto interval = checkpoint_seconds != 0 ? std::chrono::steady_clock::duration{std::chrono::seconds{checkpoint_seconds}}
+                                                        : std::chrono::steady_clock::duration::max();
+                checkpoints.reset(new ebi::vcf::Checkpoints{outdir + ".checkpoint", interval});
+                if (vm.count(ebi::vcf::RESUME) && boost::filesystem::exists(checkpoints->get_path())) {
+                    checkpoints->load();
+                } else if (vm.count(ebi::vcf::RESUME)) {
+                    BOOST_LOG_TRIVIAL(info) << "There is no checkpoint " << checkpoints->get_path()
+                                            << ", validating " << path << " from the beginning";
+                }
+            }
+
+            // the state of a growing file is kept between validations, wherever it was asked for
+            std::unique_ptr<ebi::vcf::IncrementalState> incremental;
+            if (vm.count(ebi::vcf::INCREMENTAL)) {
+                incremental.reset(new ebi::vcf::IncrementalState{vm[ebi::vcf::INCREMENTAL].as<std::string>()});
+                if (boost::filesystem::exists(incremental->get_path())) {
+                    incremental->load();
+                }
+            }
+
+            auto outputs = get_outputs(vm[ebi::vcf::REPORT].as<std::string>(), outdir,
+                                       vm[ebi::vcf::MAX_ERRORS_PER_TYPE].as<size_t>(),
+                                       vm[ebi::vcf::MAX_ERRORS].as<size_t>(), *memory,
+                                       checkpoints && checkpoints->is_resuming() ? checkpoints->report_files()
+                                                                                 : std::vector<std::string>{});
+            bool is_valid;
+
+            std::unique_ptr<ebi::vcf::Profile> profile;
+            if (vm.count(ebi::vcf::PROFILE)) {
+                profile.reset(new ebi::vcf::Profile{});
+                for (auto & output : outputs) {
+                    output.reset(new ebi::vcf::ProfiledReportWriter(std::move(output), *profile));
+                }
+            }
+
+            std::unique_ptr<ebi::vcf::ProgressMonitor> progress;
+            auto progress_seconds = vm[ebi::vcf::PROGRESS].as<size_t>();
+            if (progress_seconds != 0) {
+                progress.reset(new ebi::vcf::ProgressMonitor{[path](ebi::vcf::Progress const & current) {
+                    BOOST_LOG_TRIVIAL(info) << "Progress of " << path << ": " << current;
+                }, std::chrono::seconds{progress_seconds}});
+            }
+
+            std::ofstream fixed_file;
+            std::unique_ptr<ebi::vcf::debugulator::StreamingFixer> fixer;
+            if (vm.count(ebi::vcf::FIX)) {
+                auto fixed_path = vm[ebi::vcf::FIX].as<std::string>();
+                fixed_file.open(fixed_path);
+                if (!fixed_file) {
+                    throw std::runtime_error{"Couldn't open file " + fixed_path};
+                }
+                fixer.reset(new ebi::vcf::debugulator::StreamingFixer{fixed_file});
+            }
+
+            // the index is built from the lines as they are read, and written next to the reports
+            std::unique_ptr<ebi::vcf::RegionIndexBuilder> index_builder;
+            std::string written_index_path;
+            if (vm.count(ebi::vcf::WRITE_INDEX)) {
+                auto format = vm[ebi::vcf::WRITE_INDEX].as<std::string>() == ebi::vcf::CSI
+                              ? ebi::vcf::RegionIndexBuilder::Format::CSI
+                              : ebi::vcf::RegionIndexBuilder::Format::TABIX;
+                index_builder.reset(new ebi::vcf::RegionIndexBuilder{format});
+                written_index_path = outdir + ebi::vcf::RegionIndexBuilder::extension(format);
+            }
+
+            if (vm.count(ebi::vcf::REGION) || vm.count(ebi::vcf::REGIONS_FILE)) {
+                auto regions = get_regions(vm);
+                std::string index_path = ebi::vcf::RegionIndex::find(path);
+                if (index_path.empty()) {
+                    throw std::runtime_error{"Couldn't find the index " + path + ".tbi or " + path
+                                             + ".csi, please create it with tabix"};
+                }
+                BOOST_LOG_TRIVIAL(info) << "Reading " << regions.size() << " regions from input file " << path
+                                        << " with the index " << index_path << "...";
+                BOOST_LOG_TRIVIAL(info) << "The order and the duplicates of the records are only checked among those "
+                                        << "in the regions, and the line numbers count only them after the header";
+                ebi::vcf::RegionIndex index{index_path};
+                ebi::util::MappedFileBlockReader reader{path};
+                is_valid = ebi::vcf::is_valid_vcf_regions(reader, path, regions, index, validationLevel, outputs,
+                                                          threads, profile.get(), progress.get(), memory.get(),
+                                                          sampling);
+            } else if (checkpoints || incremental) {
+                if (!boost::filesystem::is_regular_file(path)) {
+                    throw std::runtime_error{"Only regular files can be validated with checkpoints or incrementally, not "
+                                             + path};
+                }
+                if (checkpoints) {
+                    BOOST_LOG_TRIVIAL(info) << "Reading from input file " << path << ", with checkpoints in "
+                                            << checkpoints->get_path() << "...";
+                } else {
+                    BOOST_LOG_TRIVIAL(info) << "Reading from input file " << path << ", with the incremental state "
+                                            << incremental->get_path() << "...";
+                }
+                ebi::util::MappedFileBlockReader reader{path};
+                is_valid = ebi::vcf::is_valid_vcf_file_with_checkpoints(reader, path, validationLevel, outputs,
+                                                                        checkpoints.get(), incremental.get(), threads,
+                                                                        profile.get(), progress.get(), memory.get(),
+                                                                        sampling);
+            } else if (is_remote(path)) {
+#ifdef VCF_REMOTE_INPUT
+                auto connections = vm[ebi::vcf::CONNECTIONS].as<size_t>();
+                BOOST_LOG_TRIVIAL(info) << "Reading from " << path << " with " << connections << " connections...";
+                ebi::util::HttpRangeSource source{path};
+                ebi::util::RangeRequestBlockReader reader{source, connections, memory->block_size};
+                is_valid = ebi::vcf::is_valid_vcf_file(reader, path, validationLevel, outputs, threads, fixer.get(),
+                                                       profile.get(), progress.get(), memory.get(), sampling,
+                                                       index_builder.get());
+#else
+                throw std::invalid_argument{"Please build with the REMOTE_INPUT option of CMake to read " + path};
+#endif
+            } else if (path == ebi::vcf::STDIN) {
+                BOOST_LOG_TRIVIAL(info) << "Reading from standard input...";
+                is_valid = ebi::vcf::is_valid_vcf_file(std::cin, path, validationLevel, outputs, threads, fixer.get(),
+                                                       profile.get(), progress.get(), memory.get(),
+                                                       sampling);
+            } else {
+                BOOST_LOG_TRIVIAL(info) << "Reading from input file " << path << "...";
+                std::ifstream input{path};
+                if (!input) {
+                    throw std::runtime_error{"Couldn't open file " + path};
+                } else if (boost::filesystem::is_regular_file(path) && memory->limit == 0) {
+                    // regular files are mapped in memory instead of copied through the stream, unless the memory
+                    // is limited, because the pages read count as resident memory until the kernel drops them
+                    input.close();
+                    ebi::util::MappedFileBlockReader reader{path};
+
+                    // a compressed file is split where its index says a record starts, if it has one and it is not
+                    // being replaced
+                    std::string index_path = threads > 1 && !fixer && !index_builder
+                                             ? ebi::vcf::RegionIndex::find(path) : "";
+                    if (!index_path.empty()) {
+                        BOOST_LOG_TRIVIAL(info) << "Splitting the input file with the index " << index_path;
+                        ebi::vcf::RegionIndex index{index_path};
+                        is_valid = ebi::vcf::is_valid_vcf_indexed(reader, path, index, validationLevel, outputs,
+                                                                  threads, profile.get(), progress.get(),
+                                                                  memory.get(), sampling);
+                    } else {
+                        is_valid = ebi::vcf::is_valid_vcf_file(reader, path, validationLevel, outputs, threads,
+                                                               fixer.get(), profile.get(), progress.get(),
+                                                               memory.get(), sampling, headers, index_builder.get());
+                    }
+                } else {
+                    is_valid = ebi::vcf::is_valid_vcf_file(input, path, validationLevel, outputs, threads,
+                                                           fixer.get(), profile.get(), progress.get(), memory.get(),
+                                                           sampling, index_builder.get());
+                }
+            }
+
+            if (fixer) {
+                fixer->finish();
+                BOOST_LOG_TRIVIAL(info) << "Fixed file written to : " << vm[ebi::vcf::FIX].as<std::string>();
+            }
+
+            if (index_builder) {
+                std::string failure = index_builder->failure();
+                if (failure.empty()) {
+                    index_builder->write(written_index_path);
+                    BOOST_LOG_TRIVIAL(info) << "Index written to : " << written_index_path;
+                } else {
+                    BOOST_LOG_TRIVIAL(warning) << "The index of " << path << " was not written because " << failure;
+                }
+            }
+
+            std::string report_result = "According to the VCF specification, the input file is " + std::string(is_valid ? "" : "not ") + "valid";
+            if (validationLevel == ebi::vcf::ValidationLevel::triage) {
+                report_result += " (triage: only " + sampling.description() + " fully checked)";
+            }
+            for (auto & output : outputs) {
+                BOOST_LOG_TRIVIAL(info) << "Report written to : " << output->get_filename();
+                output->write_message(report_result);
+            }
+            BOOST_LOG_TRIVIAL(info) << report_result;
+
+            if (profile) {
+                std::ostringstream table;
+                profile->write(table);
+                BOOST_LOG_TRIVIAL(info) << "Profile of the validation of " << path << ":\n" << table.str();
+            }
+
+            if (memory->limit != 0) {
+                std::ostringstream table;
+                memory->write(table);
+                BOOST_LOG_TRIVIAL(info) << "Memory used by the validation of " << path << ":\n" << table.str();
+                if (ebi::vcf::MemoryBudget::peak_rss() > memory_limit) {
+                    BOOST_LOG_TRIVIAL(warning) << "The validator used more memory than the limit, "
+                                               << "probably because of very long lines or a large header";
+                }
+            }
+            return is_valid ? InputResult::VALID : InputResult::NOT_VALID;
+
+        } catch (std::invalid_argument const & ex) {
+            BOOST_LOG_TRIVIAL(error) << ex.what();
+            return InputResult::FAILED;
+        } catch (std::runtime_error const & ex) {
+            BOOST_LOG_TRIVIAL(error) << "The input file is not valid: " << ex.what();
+            return InputResult::FAILED;
+        } catch (std::exception const &ex) {
+            BOOST_LOG_TRIVIAL(error) << ex.what();
+            return InputResult::FAILED;
+        }
+    }
+
 }
 
 int main(int argc, char** argv)
@@ -164,44 +790,53 @@ int main(int argc, char** argv)
     if (check_options < 0) { return 0; }
     if (check_options > 0) { return check_options; }
 
-    bool is_valid;
-
+    std::vector<std::string> inputs;
     try {
-        auto path = vm[ebi::vcf::INPUT].as<std::string>();
-        auto level = vm[ebi::vcf::LEVEL].as<std::string>();
-        ebi::vcf::ValidationLevel validationLevel = get_validation_level(level);
-        auto outdir = get_output_path(vm[ebi::vcf::OUTDIR].as<std::string>(), path);
-        auto outputs = get_outputs(vm[ebi::vcf::REPORT].as<std::string>(), outdir);
-
-        if (path == ebi::vcf::STDIN) {
-            BOOST_LOG_TRIVIAL(info) << "Reading from standard input...";
-            is_valid = ebi::vcf::is_valid_vcf_file(std::cin, path, validationLevel, outputs);
-        } else {
-            BOOST_LOG_TRIVIAL(info) << "Reading from input file...";
-            std::ifstream input{path};
-            if (!input) {
-                throw std::runtime_error{"Couldn't open file " + path};
-            } else {
-                is_valid = ebi::vcf::is_valid_vcf_file(input, path, validationLevel, outputs);
-            }
-        }
-
-        std::string report_result = "According to the VCF specification, the input file is " + std::string(is_valid ? "" : "not ") + "valid";
-        for (auto & output : outputs) {
-            BOOST_LOG_TRIVIAL(info) << "Report written to : " << output->get_filename();
-            output->write_message(report_result);
-        }
-        BOOST_LOG_TRIVIAL(info) << report_result;
-        return !is_valid; // A valid file returns an exit code 0
-
-    } catch (std::invalid_argument const & ex) {
-        BOOST_LOG_TRIVIAL(error) << ex.what();
-        return 1;
+        inputs = get_inputs(vm);
     } catch (std::runtime_error const & ex) {
-        BOOST_LOG_TRIVIAL(error) << "The input file is not valid: " << ex.what();
-        return 1;
-    } catch (std::exception const &ex) {
         BOOST_LOG_TRIVIAL(error) << ex.what();
         return 1;
     }
+    int check_inputs = check_input_list(vm, inputs, desc);
+    if (check_inputs != 0) { return check_inputs; }
+
+    if (vm.count(ebi::vcf::STATS)) {
+        ebi::vcf::AllocationStats::start();
+    }
+    if (vm.count(ebi::vcf::TRACE)) {
+        ebi::util::Trace::start();
+        ebi::util::Trace::name_thread("main");
+    }
+
+    if (inputs.size() == 1) {
+        InputResult result = validate_input(inputs[0], vm);
+        log_allocation_stats(vm);
+        write_trace(vm);
+        return result != InputResult::VALID; // A valid file returns an exit code 0
+    }
+
+    // every file is validated on its own, with its own parsers and reports, by the next free job; only the headers
+    // already validated are shared, so the files with the same header just parse their bodies
+    std::vector<InputResult> results(inputs.size());
+    ebi::vcf::HeaderCache headers;
+    ebi::util::WorkerPool jobs{std::min(vm[ebi::vcf::JOBS].as<size_t>(), inputs.size())};
+    jobs.run(inputs.size(), [&](size_t i) {
+        results[i] = validate_input(inputs[i], vm, &headers);
+    });
+
+    size_t valid = 0;
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        std::string result = results[i] == InputResult::VALID ? "valid"
+                           : results[i] == InputResult::NOT_VALID ? "not valid" : "could not be validated";
+        BOOST_LOG_TRIVIAL(info) << inputs[i] << ": " << result;
+        valid += results[i] == InputResult::VALID;
+    }
+    BOOST_LOG_TRIVIAL(info) << valid << " of " << inputs.size() << " input files are valid";
+    if (headers.hits() != 0) {
+        BOOST_LOG_TRIVIAL(info) << headers.hits() << " input files had the same header as another one, "
+                                << "only their bodies were parsed";
+    }
+    log_allocation_stats(vm);
+    write_trace(vm);
+    return valid != inputs.size();
 }
@@ -15,6 +15,7 @@
  */
 
 #include "vcf/error_policy.hpp"
+#include "vcf/error_thrower.hpp"
 
 namespace ebi
 {
@@ -23,7 +24,7 @@ namespace ebi
     void AbortErrorPolicy::handle_error(ParsingState &state, Error *error)
     {
         state.m_is_valid = false;
-        throw;
+        throw_error(error);
     }
     void AbortErrorPolicy::handle_warning(ParsingState &state, Error *error)
     {
@@ -0,0 +1,185 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <iomanip>
+#include <new>
+
+#include "vcf/allocation_stats.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+
+    namespace
+    {
+      char const * const stage_names[n_allocation_stages] = {
+          "other",
+          "reading",
+          "parsing",
+          "records",
+          "checks",
+          "normalization",
+          "record cache",
+          "errors",
+          "reporting",
+      };
+
+      // static storage, so they are zero before any allocation, even those of the static initialization
+      std::atomic<bool> counting;
+      std::array<std::atomic<uint64_t>, n_allocation_stages> allocation_counts;
+      std::array<std::atomic<uint64_t>, n_allocation_stages> byte_counts;
+      std::atomic<uint64_t> record_count;
+    }
+
+#ifdef VCF_ALLOCATION_STATS
+    thread_local AllocationStage AllocationScope::current = AllocationStage::other;
+
+    namespace
+    {
+      void * counted_allocation(size_t size)
+      {
+          if (counting.load(std::memory_order_relaxed)) {
+              auto stage = static_cast<size_t>(AllocationScope::current_stage());
+              allocation_counts[stage].fetch_add(1, std::memory_order_relaxed);
+              byte_counts[stage].fetch_add(size, std::memory_order_relaxed);
+          }
+
+          void * memory;
+          while ((memory = std::malloc(size != 0 ? size : 1)) == nullptr) {
+              std::new_handler handler = std::get_new_handler();
+              if (handler == nullptr) {
+                  throw std::bad_alloc{};
+              }
+              handler();
+          }
+          return memory;
+      }
+    }
+#endif
+
+    bool AllocationStats::is_available()
+    {
+#ifdef VCF_ALLOCATION_STATS
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    void AllocationStats::start()
+    {
+        counting = true;
+    }
+
+    uint64_t AllocationStats::allocations(AllocationStage stage)
+    {
+        return allocation_counts[static_cast<size_t>(stage)];
+    }
+
+    uint64_t AllocationStats::bytes(AllocationStage stage)
+    {
+        return byte_counts[static_cast<size_t>(stage)];
+    }
+
+    uint64_t AllocationStats::records()
+    {
+        return record_count;
+    }
+
+    void AllocationStats::count_record()
+    {
+        record_count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void AllocationStats::write(std::ostream & output)
+    {
+        uint64_t total_allocations = 0;
+        uint64_t total_bytes = 0;
+        uint64_t n_records = records();
+
+        auto flags = output.flags();
+        output << std::left << std::setw(24) << "stage" << std::right << std::setw(16) << "allocations"
+               << std::setw(16) << "bytes" << std::setw(16) << "allocs/record" << std::setw(16) << "bytes/record"
+               << '\n';
+        output << std::fixed << std::setprecision(2);
+        auto write_row = [&](char const * name, uint64_t allocations, uint64_t bytes) {
+            output << std::left << std::setw(24) << name << std::right << std::setw(16) << allocations
+                   << std::setw(16) << bytes
+                   << std::setw(16) << (n_records != 0 ? double(allocations) / n_records : 0)
+                   << std::setw(16) << (n_records != 0 ? double(bytes) / n_records : 0) << '\n';
+        };
+        for (size_t i = 0; i < n_allocation_stages; ++i) {
+            uint64_t allocations = allocation_counts[i];
+            uint64_t bytes = byte_counts[i];
+            total_allocations += allocations;
+            total_bytes += bytes;
+            if (allocations != 0) {
+                write_row(stage_names[i], allocations, bytes);
+            }
+        }
+        write_row("total", total_allocations, total_bytes);
+        output << n_records << " records\n";
+        output.flags(flags);
+    }
+
+  }
+}
+
+#ifdef VCF_ALLOCATION_STATS
+
+void * operator new(size_t size)
+{
+    return ebi::vcf::counted_allocation(size);
+}
+
+void * operator new[](size_t size)
+{
+    return ebi::vcf::counted_allocation(size);
+}
+
+void * operator new(size_t size, std::nothrow_t const &) noexcept
+{
+    try {
+        return ebi::vcf::counted_allocation(size);
+    } catch (std::bad_alloc const &) {
+        return nullptr;
+    }
+}
+
+void * operator new[](size_t size, std::nothrow_t const &) noexcept
+{
+    try {
+        return ebi::vcf::counted_allocation(size);
+    } catch (std::bad_alloc const &) {
+        return nullptr;
+    }
+}
+
+void operator delete(void * memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void * memory) noexcept
+{
+    std::free(memory);
+}
+
+#endif
@@ -0,0 +1,203 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+#include <boost/log/trivial.hpp>
+
+#include "util/trace.hpp"
+#include "vcf/allocation_stats.hpp"
+#include "vcf/async_report_writer.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+
+    size_t const AsyncReportWriter::default_max_queued_errors;
+
+    AsyncReportWriter::AsyncReportWriter(std::unique_ptr<ReportWriter> output, size_t max_queued_errors,
+                                         MemoryBudget * memory)
+    : output{std::move(output)}, file_name{this->output->get_filename()},
+      max_queued_errors{std::max(max_queued_errors, size_t{1})}, memory{memory}, queued_errors{0}, closed{false},
+      error{}
+    {
+        worker = std::thread{&AsyncReportWriter::work, this};
+    }
+
+    AsyncReportWriter::~AsyncReportWriter()
+    {
+        try {
+            close();
+        } catch (Error * e) {
+            BOOST_LOG_TRIVIAL(error) << "Couldn't write the report " << file_name << ": " << e->what();
+            delete e;
+        } catch (std::exception const & e) {
+            BOOST_LOG_TRIVIAL(error) << "Couldn't write the report " << file_name << ": " << e.what();
+        } catch (...) {
+            BOOST_LOG_TRIVIAL(error) << "Couldn't write the report " << file_name;
+        }
+    }
+
+    void AsyncReportWriter::write_error(Error &error)
+    {
+        write_batch({ReportedError{Severity::ERROR, &error}});
+    }
+
+    void AsyncReportWriter::write_warning(Error &error)
+    {
+        write_batch({ReportedError{Severity::WARNING, &error}});
+    }
+
+    void AsyncReportWriter::write_batch(std::vector<ReportedError> const & batch)
+    {
+        if (batch.empty()) {
+            return;
+        }
+        Item item{{}, {}, false, ""};
+        item.errors.reserve(batch.size());
+        item.batch.reserve(batch.size());
+        for (auto & reported : batch) {
+            item.errors.emplace_back(reported.error->clone());
+            item.batch.push_back(ReportedError{reported.severity, item.errors.back().get()});
+        }
+        push(std::move(item), batch.size());
+    }
+
+    void AsyncReportWriter::write_message(const std::string &report_result)
+    {
+        push(Item{{}, {}, true, report_result}, 1);
+    }
+
+    std::string AsyncReportWriter::get_filename()
+    {
+        return file_name;
+    }
+
+    void AsyncReportWriter::save_checkpoint(std::ostream &checkpoint)
+    {
+        wait_until_written();
+        output->save_checkpoint(checkpoint);
+    }
+
+    void AsyncReportWriter::load_checkpoint(std::istream &checkpoint)
+    {
+        output->load_checkpoint(checkpoint);
+    }
+
+    void AsyncReportWriter::close()
+    {
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            if (closed) {
+                return;
+            }
+            closed = true;
+        }
+        item_available.notify_one();
+        worker.join();
+
+        if (error) {
+            std::exception_ptr output_error = error;
+            error = nullptr;
+            std::rethrow_exception(output_error);
+        }
+    }
+
+    void AsyncReportWriter::push(Item item, size_t size)
+    {
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            // a batch bigger than the whole queue is accepted once the queue is empty
+            space_available.wait(lock, [&] {
+                return error || queued_errors == 0 || queued_errors + size <= max_queued_errors;
+            });
+            if (error) {
+                std::exception_ptr output_error = error;
+                error = nullptr;
+                std::rethrow_exception(output_error);
+            }
+            if (closed) {
+                throw std::logic_error{"Can't write to the closed report " + file_name};
+            }
+            queue.push_back(std::move(item));
+            queued_errors += size;
+            util::Trace::counter("queued errors", static_cast<int64_t>(queued_errors));
+            if (memory != nullptr) {
+                memory->record(MemoryArea::queued_reports, queued_errors * MemoryBudget::queued_error_size);
+            }
+        }
+        item_available.notify_one();
+    }
+
+    void AsyncReportWriter::wait_until_written()
+    {
+        std::unique_lock<std::mutex> lock{mutex};
+        space_available.wait(lock, [this] { return error || queued_errors == 0; });
+        if (error) {
+            std::exception_ptr output_error = error;
+            error = nullptr;
+            std::rethrow_exception(output_error);
+        }
+    }
+
+    void AsyncReportWriter::work()
+    {
+        AllocationScope allocation_scope{AllocationStage::reporting};
+        util::Trace::name_thread("report writer");
+        bool failed = false;
+        while (true) {
+            Item item;
+            {
+                std::unique_lock<std::mutex> lock{mutex};
+                item_available.wait(lock, [this] { return !queue.empty() || closed; });
+                if (queue.empty()) {
+                    return;
+                }
+                item = std::move(queue.front());
+                queue.pop_front();
+            }
+
+            // after a failure the rest is discarded, the report is already incomplete
+            if (!failed) {
+                util::TraceSpan span{"reporting", "write reports", "errors",
+                                     static_cast<int64_t>(item.is_message ? 1 : item.batch.size())};
+                try {
+                    if (item.is_message) {
+                        output->write_message(item.message);
+                    } else {
+                        output->write_batch(item.batch);
+                    }
+                } catch (...) {
+                    failed = true;
+                    std::lock_guard<std::mutex> lock{mutex};
+                    error = std::current_exception();
+                }
+            }
+
+            {
+                std::lock_guard<std::mutex> lock{mutex};
+                queued_errors -= item.is_message ? 1 : item.batch.size();
+                util::Trace::counter("queued errors", static_cast<int64_t>(queued_errors));
+            }
+            space_available.notify_all();
+        }
+    }
+  }
+}
@@ -0,0 +1,666 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <set>
+#include <stdexcept>
+
+#include "util/string_utils.hpp"
+#include "vcf/bcf_parser.hpp"
+#include "vcf/string_constants.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+
+    namespace
+    {
+      /**
+       * Types of the typed values, in the low 4 bits of their descriptor
+       */
+      enum TypeCode : uint8_t
+      {
+          missing_type = 0, int8_type = 1, int16_type = 2, int32_type = 3, float_type = 5, char_type = 7
+      };
+
+      uint32_t const float_missing = 0x7F800001;
+      uint32_t const float_end_of_vector = 0x7F800002;
+
+      /**
+       * Little-endian numbers, whatever the byte order of the machine
+       */
+      uint32_t read_uint32(char const * bytes)
+      {
+          auto b = reinterpret_cast<unsigned char const *>(bytes);
+          return b[0] | (uint32_t{b[1]} << 8) | (uint32_t{b[2]} << 16) | (uint32_t{b[3]} << 24);
+      }
+
+      int32_t read_int(uint8_t type, char const * bytes)
+      {
+          auto b = reinterpret_cast<unsigned char const *>(bytes);
+          switch (type) {
+          case int8_type:
+              return static_cast<int8_t>(b[0]);
+          case int16_type:
+              return static_cast<int16_t>(b[0] | (b[1] << 8));
+          default:
+              return static_cast<int32_t>(read_uint32(bytes));
+          }
+      }
+
+      size_t type_size(uint8_t type)
+      {
+          switch (type) {
+          case missing_type:
+              return 0;
+          case int8_type:
+          case char_type:
+              return 1;
+          case int16_type:
+              return 2;
+          case int32_type:
+          case float_type:
+              return 4;
+          default:
+              throw std::runtime_error{"unknown type " + std::to_string(type)};
+          }
+      }
+
+      /**
+       * Smallest value of each integer type means missing, and the next one, the end of a shorter vector
+       */
+      int32_t int_missing(uint8_t type)
+      {
+          return type == int8_type ? std::numeric_limits<int8_t>::min()
+                 : type == int16_type ? std::numeric_limits<int16_t>::min() : std::numeric_limits<int32_t>::min();
+      }
+
+      /**
+       * Values of a typed field, or of one sample of a FORMAT field
+       */
+      struct TypedValues
+      {
+          uint8_t type;
+          size_t count;
+          char const * data;
+      };
+
+      /**
+       * Reads the typed values of a section of a record, checking that they are inside it
+       */
+      class Cursor
+      {
+        public:
+          Cursor(char const * begin, char const * end) : p{begin}, end{end} { }
+
+          char const * take(size_t size)
+          {
+              if (static_cast<size_t>(end - p) < size) {
+                  throw std::runtime_error{"it is shorter than its fields"};
+              }
+              char const * bytes = p;
+              p += size;
+              return bytes;
+          }
+
+          uint32_t uint32()
+          {
+              return read_uint32(take(4));
+          }
+
+          /**
+           * Type and count of the next typed values, without taking the values themselves
+           */
+          TypedValues descriptor()
+          {
+              auto byte = static_cast<unsigned char>(*take(1));
+              TypedValues values{static_cast<uint8_t>(byte & 0x0F), static_cast<size_t>(byte >> 4), nullptr};
+              type_size(values.type);
+              if (values.count == 15) {
+                  int32_t count = typed_int();
+                  if (count < 0) {
+                      throw std::runtime_error{"a negative number of values"};
+                  }
+                  values.count = static_cast<size_t>(count);
+              }
+              return values;
+          }
+
+          TypedValues typed()
+          {
+              TypedValues values = descriptor();
+              values.data = take(values.count * type_size(values.type));
+              return values;
+          }
+
+          int32_t typed_int()
+          {
+              TypedValues value = typed();
+              if (value.count != 1 || value.type == missing_type || value.type == float_type
+                      || value.type == char_type) {
+                  throw std::runtime_error{"a typed integer expected"};
+              }
+              return read_int(value.type, value.data);
+          }
+
+          bool at_end() const
+          {
+              return p == end;
+          }
+
+        private:
+          char const * p;
+          char const * end;
+      };
+
+      void append_string(std::string & text, char const * chars, size_t size)
+      {
+          // the strings are padded with NULs up to the size of the longest one
+          text.append(chars, std::find(chars, chars + size, '\0'));
+      }
+
+      void append_float(std::string & text, char const * bytes)
+      {
+          float value;
+          uint32_t bits = read_uint32(bytes);
+          std::memcpy(&value, &bits, sizeof value);
+          char formatted[32];
+          text.append(formatted, std::snprintf(formatted, sizeof formatted, "%g", value));
+      }
+
+      /**
+       * Appends `count` values of a type like they are written in a VCF line: separated by commas, with missing
+       * values as dots and without the padding at the end of a shorter vector
+       */
+      void append_values(std::string & text, uint8_t type, char const * data, size_t count)
+      {
+          if (type == char_type) {
+              append_string(text, data, count);
+              return;
+          }
+          size_t size = type_size(type);
+          for (size_t i = 0; i < count; ++i) {
+              char const * bytes = data + i * size;
+              if (type == float_type) {
+                  uint32_t bits = read_uint32(bytes);
+                  if (bits == float_end_of_vector) {
+                      break;
+                  }
+                  if (i != 0) {
+                      text += ',';
+                  }
+                  if (bits == float_missing) {
+                      text += MISSING_VALUE;
+                  } else {
+                      append_float(text, bytes);
+                  }
+              } else {
+                  int32_t value = read_int(type, bytes);
+                  if (value == int_missing(type) + 1) {
+                      break;
+                  }
+                  if (i != 0) {
+                      text += ',';
+                  }
+                  if (value == int_missing(type)) {
+                      text += MISSING_VALUE;
+                  } else {
+                      text += std::to_string(value);
+                  }
+              }
+          }
+      }
+
+      /**
+       * Appends a genotype, whose values are the allele indexes plus one (0 if missing), shifted one bit to the
+       * left to make room for whether each allele is phased with the previous one
+       */
+      void append_genotype(std::string & text, uint8_t type, char const * data, size_t count)
+      {
+          if (type == char_type || type == float_type) {
+              throw std::runtime_error{"the genotypes are not integers"};
+          }
+          size_t size = type_size(type);
+          for (size_t i = 0; i < count; ++i) {
+              int32_t value = read_int(type, data + i * size);
+              if (value == int_missing(type) + 1) {
+                  break;
+              }
+              if (value == int_missing(type)) {
+                  text += MISSING_VALUE;
+                  break;
+              }
+              if (i != 0) {
+                  text += (value & 1) ? '|' : '/';
+              }
+              int32_t allele = (value >> 1) - 1;
+              if (allele < 0) {
+                  text += MISSING_VALUE;
+              } else {
+                  text += std::to_string(allele);
+              }
+          }
+      }
+
+      std::string const & lookup(std::vector<std::string> const & dictionary, int32_t index,
+                                 std::string const & description)
+      {
+          if (index < 0 || static_cast<size_t>(index) >= dictionary.size() || dictionary[index].empty()) {
+              throw std::runtime_error{description + " " + std::to_string(index) + " is not in the header"};
+          }
+          return dictionary[index];
+      }
+
+      /**
+       * Puts an ID in a dictionary: at its IDX, if the meta entry has one, or at the end if it is not there yet
+       */
+      void add_to_dictionary(std::vector<std::string> & dictionary, std::string const & id, long index)
+      {
+          if (index >= 0) {
+              if (dictionary.size() <= static_cast<size_t>(index)) {
+                  dictionary.resize(index + 1);
+              }
+              dictionary[index] = id;
+          } else if (std::find(dictionary.begin(), dictionary.end(), id) == dictionary.end()) {
+              dictionary.push_back(id);
+          }
+      }
+
+      /**
+       * Value of a key in the <Key=value,...> of a meta line, or an empty string if it is not there
+       */
+      std::string meta_value(std::string const & line, size_t begin, std::string const & key)
+      {
+          bool quoted = false;
+          size_t field = begin;
+          for (size_t i = begin; i <= line.size(); ++i) {
+              char c = i < line.size() ? line[i] : ',';
+              if (c == '"' && (i == 0 || line[i - 1] != '\\')) {
+                  quoted = !quoted;
+              } else if (!quoted && (c == ',' || c == '>')) {
+                  if (line.compare(field, key.size() + 1, key + "=") == 0) {
+                      return line.substr(field + key.size() + 1, i - field - key.size() - 1);
+                  }
+                  field = i + 1;
+                  if (c == '>') {
+                      break;
+                  }
+              }
+          }
+          return "";
+      }
+    }
+
+    bool is_bcf(char const * begin, char const * end)
+    {
+        return end - begin >= 4 && std::memcmp(begin, "BCF\2", 4) == 0;
+    }
+
+    BcfParser::BcfParser(std::unique_ptr<ParserImpl> text_parser)
+    : text{std::move(text_parser)}, section{Section::prefix}, section_size{bcf_prefix_size}, shared_size{0},
+      n_samples{0}
+    {
+    }
+
+    void BcfParser::parse(std::string const & text)
+    {
+        parse(text.data(), text.data() + text.size());
+    }
+
+    void BcfParser::parse(std::vector<char> const & text)
+    {
+        parse(text.data(), text.data() + text.size());
+    }
+
+    void BcfParser::parse(char const * begin, char const * end)
+    {
+        text->clear();
+        char const * p = begin;
+        char const * bytes;
+        while (section != Section::stopped && next_bytes(p, end, section_size, bytes)) {
+            switch (section) {
+            case Section::prefix:
+                decode_prefix(bytes);
+                break;
+            case Section::header:
+                decode_header(bytes);
+                break;
+            case Section::lengths:
+                shared_size = read_uint32(bytes);
+                section_size = shared_size + read_uint32(bytes + 4);
+                section = Section::record;
+                break;
+            case Section::record:
+                decode_record(bytes, bytes + shared_size);
+                if (section == Section::record) {
+                    section = Section::lengths;
+                    section_size = 8;
+                }
+                break;
+            case Section::stopped:
+                break;
+            }
+            pending.clear();
+        }
+    }
+
+    bool BcfParser::next_bytes(char const *& p, char const * end, size_t size, char const *& bytes)
+    {
+        if (pending.empty() && static_cast<size_t>(end - p) >= size) {
+            bytes = p;
+            p += size;
+            return true;
+        }
+        size_t copied = std::min(size - pending.size(), static_cast<size_t>(end - p));
+        pending.insert(pending.end(), p, p + copied);
+        p += copied;
+        if (pending.size() < size) {
+            return false;
+        }
+        bytes = pending.data();
+        return true;
+    }
+
+    void BcfParser::decode_prefix(char const * bytes)
+    {
+        if (!is_bcf(bytes, bytes + bcf_prefix_size) || (bytes[4] != 1 && bytes[4] != 2)) {
+            stop("The input is not BCF version 2.1 or 2.2");
+            return;
+        }
+        section = Section::header;
+        section_size = read_uint32(bytes + 5);
+    }
+
+    void BcfParser::decode_header(char const * bytes)
+    {
+        // the text ends with a NUL, and may be padded with more
+        std::string header{bytes, std::find(bytes, bytes + section_size, '\0')};
+        text->parse(header);
+        if (text->has_stopped()) {
+            // the header errors were reported, and nothing else can be checked
+            section = Section::stopped;
+            return;
+        }
+
+        // a wrong header line already ran the checks of the meta section
+        bool header_line_error = false;
+        for (auto & error : text->errors()) {
+            header_line_error = header_line_error || dynamic_cast<HeaderSectionError *>(error.get()) != nullptr;
+        }
+        if (!header_line_error) {
+            text->end_decoded_header();
+        }
+
+        read_dictionaries(header);
+        n_samples = text->samples().size();
+        section = Section::lengths;
+        section_size = 8;
+    }
+
+    void BcfParser::read_dictionaries(std::string const & header)
+    {
+        contigs.clear();
+        flags.clear();
+        // PASS is always the first string, even if it is not described
+        dictionary.assign(1, PASS);
+
+        std::vector<std::string> lines;
+        util::string_split(header, "\n", lines);
+        for (auto & line : lines) {
+            size_t open = line.find("=<");
+            if (line.compare(0, 2, "##") != 0 || open == std::string::npos) {
+                continue;
+            }
+            std::string type = line.substr(2, open - 2);
+            std::string id = meta_value(line, open + 2, ID);
+            if (id.empty()) {
+                continue;
+            }
+            std::string idx = meta_value(line, open + 2, "IDX");
+            long index = idx.empty() ? -1 : std::strtol(idx.c_str(), nullptr, 10);
+            if (type == CONTIG) {
+                add_to_dictionary(contigs, id, index);
+            } else if (type == FILTER || type == INFO || type == FORMAT) {
+                add_to_dictionary(dictionary, id, index);
+                if (type == INFO && meta_value(line, open + 2, TYPE) == FLAG) {
+                    flags.insert(id);
+                }
+            }
+        }
+    }
+
+    void BcfParser::decode_record(char const * shared, char const * individual)
+    {
+        size_t line = text->n_lines;
+        try {
+            Cursor site{shared, individual};
+            std::string const & chromosome = lookup(contigs, static_cast<int32_t>(site.uint32()), "The contig");
+            int32_t position = static_cast<int32_t>(site.uint32());
+            site.uint32();  // the length of the reference, known from it
+            uint32_t quality_bits = site.uint32();
+            uint32_t n_allele_info = site.uint32();
+            uint32_t n_fmt_sample = site.uint32();
+            size_t n_info = n_allele_info & 0xFFFF;
+            size_t n_allele = n_allele_info >> 16;
+            size_t n_format = n_fmt_sample >> 24;
+            size_t n_record_samples = n_fmt_sample & 0xFFFFFF;
+            if (n_format != 0 && n_record_samples != n_samples) {
+                throw std::runtime_error{"it has " + std::to_string(n_record_samples) + " samples and the header "
+                                         + std::to_string(n_samples)};
+            }
+
+            fields.chromosome = chromosome;
+
+            TypedValues ids = site.typed();
+            fields.value.clear();
+            append_values(fields.value, ids.type, ids.data, ids.count);
+            fields.ids.clear();
+            if (fields.value.empty()) {
+                fields.ids.push_back(MISSING_VALUE);
+            } else {
+                util::string_split(fields.value, ";", fields.ids);
+            }
+
+            fields.reference.clear();
+            fields.alternates.clear();
+            for (size_t i = 0; i < n_allele; ++i) {
+                TypedValues allele = site.typed();
+                if (i != 0) {
+                    fields.alternates.emplace_back();
+                }
+                std::string & target = i == 0 ? fields.reference : fields.alternates.back();
+                append_values(target, allele.type, allele.data, allele.count);
+            }
+            if (fields.alternates.empty()) {
+                fields.alternates.push_back(MISSING_VALUE);
+            }
+
+            TypedValues filters = site.typed();
+            fields.filters.clear();
+            for (size_t i = 0; i < filters.count && filters.type != missing_type; ++i) {
+                fields.filters.push_back(lookup(dictionary, read_int(filters.type, filters.data
+                                                                                  + i * type_size(filters.type)),
+                                                "The filter"));
+            }
+            if (fields.filters.empty()) {
+                fields.filters.push_back(MISSING_VALUE);
+            }
+
+            fields.info.clear();
+            for (size_t i = 0; i < n_info; ++i) {
+                std::string const & key = lookup(dictionary, site.typed_int(), "The INFO key");
+                TypedValues value = site.typed();
+                fields.value.clear();
+                // a flag has no value, or is encoded as the integer 1
+                if (value.type != missing_type && flags.count(key) == 0) {
+                    append_values(fields.value, value.type, value.data, value.count);
+                }
+                fields.info.emplace(key, fields.value);
+            }
+            if (!site.at_end()) {
+                throw std::runtime_error{"it has more shared data than its fields"};
+            }
+
+            Cursor samples{individual, individual + (section_size - shared_size)};
+            fields.format.clear();
+            fields.samples.assign(n_format != 0 ? n_record_samples : 0, "");
+            for (size_t i = 0; i < n_format; ++i) {
+                std::string const & key = lookup(dictionary, samples.typed_int(), "The FORMAT key");
+                fields.format.push_back(key);
+                TypedValues values = samples.descriptor();
+                size_t size = values.count * type_size(values.type);
+                char const * data = samples.take(size * n_record_samples);
+                for (size_t sample = 0; sample < n_record_samples; ++sample) {
+                    std::string & sample_text = fields.samples[sample];
+                    if (i != 0) {
+                        sample_text += ':';
+                    }
+                    size_t written = sample_text.size();
+                    if (key == GT) {
+                        append_genotype(sample_text, values.type, data + sample * size, values.count);
+                    } else {
+                        append_values(sample_text, values.type, data + sample * size, values.count);
+                    }
+                    if (sample_text.size() == written) {
+                        sample_text += MISSING_VALUE;
+                    }
+                }
+            }
+            if (!samples.at_end()) {
+                throw std::runtime_error{"it has more sample data than its fields"};
+            }
+
+            float quality = 0;
+            if (quality_bits != float_missing) {
+                std::memcpy(&quality, &quality_bits, sizeof quality);
+            }
+
+            Record & record = text->recycled_record();
+            record.assign_unchecked(line,
+                                    fields.chromosome,
+                                    static_cast<size_t>(position) + 1,
+                                    fields.ids,
+                                    fields.reference,
+                                    fields.alternates,
+                                    quality,
+                                    fields.filters,
+                                    fields.info,
+                                    fields.format,
+                                    fields.samples,
+                                    text->source.get());
+        } catch (std::runtime_error const & error) {
+            stop(std::string{"The BCF record is not valid: "} + error.what());
+            return;
+        }
+
+        text->parse_decoded_record();
+        ++text->n_lines;
+    }
+
+    void BcfParser::stop(std::string const & message)
+    {
+        section = Section::stopped;
+        text->handle_decoding_error(new BodySectionError{text->n_lines, message});
+    }
+
+    void BcfParser::end()
+    {
+        if (section == Section::prefix || section == Section::header) {
+            text->clear();
+            stop("The BCF input ends before its header does");
+            return;
+        }
+        bool truncated = section == Section::record || !pending.empty();
+        if (section == Section::stopped) {
+            text->clear();
+        } else {
+            text->end_decoded_records();
+        }
+        if (truncated) {
+            stop("The BCF input ends in the middle of a record");
+        }
+    }
+
+    bool BcfParser::is_valid() const
+    {
+        return text->is_valid();
+    }
+
+    const std::vector<std::unique_ptr<Error>> & BcfParser::errors() const
+    {
+        return text->errors();
+    }
+
+    const std::vector<std::unique_ptr<Error>> & BcfParser::warnings() const
+    {
+        return text->warnings();
+    }
+
+    const std::vector<size_t> & BcfParser::error_lines_read() const
+    {
+        return text->error_lines_read();
+    }
+
+    const std::vector<size_t> & BcfParser::warning_lines_read() const
+    {
+        return text->warning_lines_read();
+    }
+
+    size_t BcfParser::omitted_errors() const
+    {
+        return text->omitted_errors();
+    }
+
+    size_t BcfParser::omitted_warnings() const
+    {
+        return text->omitted_warnings();
+    }
+
+    size_t BcfParser::first_unfinished_line() const
+    {
+        return text->first_unfinished_line();
+    }
+
+    size_t BcfParser::lines_read() const
+    {
+        return text->lines_read();
+    }
+
+    ContigId BcfParser::last_contig() const
+    {
+        return text->last_contig();
+    }
+
+    size_t BcfParser::last_position() const
+    {
+        return text->last_position();
+    }
+
+    ParserImpl & BcfParser::text_parser()
+    {
+        return *text;
+    }
+
+    ParserImpl const & BcfParser::text_parser() const
+    {
+        return *text;
+    }
+  }
+}
@@ -0,0 +1,470 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <algorithm>
+#include <cstring>
+#include <initializer_list>
+#include <stdexcept>
+
+#include "vcf/binary_report.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    namespace
+    {
+      enum class ErrorType : uint8_t
+      {
+          ERROR, META_SECTION, HEADER_SECTION, BODY_SECTION, NO_META_DEFINITION, FILEFORMAT, CHROMOSOME, POSITION,
+          ID, REFERENCE_ALLELE, ALTERNATE_ALLELES, QUALITY, FILTER, INFO, FORMAT, SAMPLES, SAMPLES_FIELD,
+          NORMALIZATION, DUPLICATION
+      };
+
+      std::string const no_value;
+
+      /**
+       * Fields of an error that are not in the base class, and the type needed to create it again
+       */
+      class FieldsVisitor : public ErrorVisitor
+      {
+        public:
+          ErrorType type = ErrorType::ERROR;
+          ErrorFix error_fix = ErrorFix::IRRECOVERABLE_VALUE;
+          std::string const * field = &no_value;
+          std::string const * expected_value = &no_value;
+          long field_cardinality = -1;
+
+          virtual void visit(Error &error) override { type = ErrorType::ERROR; }
+          virtual void visit(MetaSectionError &error) override { meta(ErrorType::META_SECTION, error); }
+          virtual void visit(HeaderSectionError &error) override { type = ErrorType::HEADER_SECTION; }
+          virtual void visit(BodySectionError &error) override { type = ErrorType::BODY_SECTION; }
+          virtual void visit(NoMetaDefinitionError &error) override { type = ErrorType::NO_META_DEFINITION; }
+          virtual void visit(FileformatError &error) override { meta(ErrorType::FILEFORMAT, error); }
+          virtual void visit(ChromosomeBodyError &error) override { type = ErrorType::CHROMOSOME; }
+          virtual void visit(PositionBodyError &error) override { type = ErrorType::POSITION; }
+          virtual void visit(IdBodyError &error) override
+          {
+              type = ErrorType::ID;
+              error_fix = error.error_fix;
+          }
+          virtual void visit(ReferenceAlleleBodyError &error) override { type = ErrorType::REFERENCE_ALLELE; }
+          virtual void visit(AlternateAllelesBodyError &error) override { type = ErrorType::ALTERNATE_ALLELES; }
+          virtual void visit(QualityBodyError &error) override { type = ErrorType::QUALITY; }
+          virtual void visit(FilterBodyError &error) override
+          {
+              type = ErrorType::FILTER;
+              error_fix = error.error_fix;
+              field = &error.field;
+          }
+          virtual void visit(InfoBodyError &error) override
+          {
+              type = ErrorType::INFO;
+              error_fix = error.error_fix;
+              field = &error.field;
+              expected_value = &error.expected_value;
+          }
+          virtual void visit(FormatBodyError &error) override
+          {
+              type = ErrorType::FORMAT;
+              error_fix = error.error_fix;
+          }
+          virtual void visit(SamplesBodyError &error) override { type = ErrorType::SAMPLES; }
+          virtual void visit(SamplesFieldBodyError &error) override
+          {
+              type = ErrorType::SAMPLES_FIELD;
+              field = &error.field;
+              field_cardinality = error.field_cardinality;
+          }
+          virtual void visit(NormalizationError &error) override { type = ErrorType::NORMALIZATION; }
+          virtual void visit(DuplicationError &error) override { type = ErrorType::DUPLICATION; }
+
+        private:
+          void meta(ErrorType meta_type, MetaSectionError &error)
+          {
+              type = meta_type;
+              error_fix = error.error_fix;
+              field = &error.value;
+              expected_value = &error.expected_value;
+          }
+      };
+
+      template <typename T>
+      void append(std::string & buffer, T value)
+      {
+          buffer.append(reinterpret_cast<char const *>(&value), sizeof(value));
+      }
+
+      void append_string(std::string & buffer, std::string const & value)
+      {
+          append(buffer, static_cast<uint32_t>(value.size()));
+          buffer.append(value);
+      }
+
+      /**
+       * Reads the fields of a record in place, checking that they don't go beyond its end
+       */
+      class RecordCursor
+      {
+        public:
+          RecordCursor(char const * begin, char const * end) : position{begin}, end{end} { }
+
+          template <typename T>
+          T read()
+          {
+              T value;
+              check(sizeof(value));
+              std::memcpy(&value, position, sizeof(value));
+              position += sizeof(value);
+              return value;
+          }
+
+          std::string read_string()
+          {
+              uint32_t size = read<uint32_t>();
+              check(size);
+              std::string value{position, size};
+              position += size;
+              return value;
+          }
+
+        private:
+          void check(size_t size) const
+          {
+              if (static_cast<size_t>(end - position) < size) {
+                  throw std::runtime_error{"The binary report is corrupted"};
+              }
+          }
+
+          char const * position;
+          char const * end;
+      };
+
+      Error * decode(char const * begin, char const * end)
+      {
+          RecordCursor cursor{begin, end};
+          auto type = static_cast<ErrorType>(cursor.read<uint8_t>());
+          auto severity = static_cast<Severity>(cursor.read<uint8_t>());
+          auto error_fix = static_cast<ErrorFix>(cursor.read<uint8_t>());
+          size_t line = cursor.read<uint64_t>();
+          long field_cardinality = cursor.read<int64_t>();
+          std::string message = cursor.read_string();
+          std::string detailed_message = cursor.read_string();
+          std::string field = cursor.read_string();
+          std::string expected_value = cursor.read_string();
+
+          Error * error;
+          switch (type) {
+              case ErrorType::ERROR:
+                  error = new Error{line, message, detailed_message};
+                  break;
+              case ErrorType::META_SECTION:
+                  error = new MetaSectionError{line, message, error_fix, field, expected_value};
+                  break;
+              case ErrorType::HEADER_SECTION:
+                  error = new HeaderSectionError{line, message, detailed_message};
+                  break;
+              case ErrorType::BODY_SECTION:
+                  error = new BodySectionError{line, message, detailed_message};
+                  break;
+              case ErrorType::NO_META_DEFINITION:
+                  error = new NoMetaDefinitionError{line, message};
+                  break;
+              case ErrorType::FILEFORMAT:
+                  error = new FileformatError{line, message, error_fix, field, expected_value};
+                  break;
+              case ErrorType::CHROMOSOME:
+                  error = new ChromosomeBodyError{line, message, detailed_message};
+                  break;
+              case ErrorType::POSITION:
+                  error = new PositionBodyError{line, message, detailed_message};
+                  break;
+              case ErrorType::ID:
+                  error = new IdBodyError{line, message, error_fix};
+                  break;
+              case ErrorType::REFERENCE_ALLELE:
+                  error = new ReferenceAlleleBodyError{line, message, detailed_message};
+                  break;
+              case ErrorType::ALTERNATE_ALLELES:
+                  error = new AlternateAllelesBodyError{line, message, detailed_message};
+                  break;
+              case ErrorType::QUALITY:
+                  error = new QualityBodyError{line, message, detailed_message};
+                  break;
+              case ErrorType::FILTER:
+                  error = new FilterBodyError{line, message, error_fix, field};
+                  break;
+              case ErrorType::INFO:
+                  error = new InfoBodyError{line, message, detailed_message, error_fix, field, expected_value};
+                  break;
+              case ErrorType::FORMAT:
+                  error = new FormatBodyError{line, message, error_fix};
+                  break;
+              case ErrorType::SAMPLES:
+                  error = new SamplesBodyError{line, message, detailed_message};
+                  break;
+              case ErrorType::SAMPLES_FIELD:
+                  error = new SamplesFieldBodyError{line, message, detailed_message, field, field_cardinality};
+                  break;
+              case ErrorType::NORMALIZATION:
+                  error = new NormalizationError{line, message, detailed_message};
+                  break;
+              case ErrorType::DUPLICATION:
+                  error = new DuplicationError{line, message, detailed_message};
+                  break;
+              default:
+                  throw std::runtime_error{"The binary report is corrupted"};
+          }
+          error->severity = severity;
+          return error;
+      }
+
+      size_t const record_size_bytes = sizeof(uint32_t);
+      size_t const severity_position = record_size_bytes + 1;   // after the size and the error type
+      size_t const line_position = severity_position + 2;       // after the severity and the fix
+    }
+
+    namespace binary_report
+    {
+      bool is_binary_report(std::string const & path)
+      {
+          std::ifstream input{path, std::ios::binary};
+          std::string start(sizeof(magic) - 1, '\0');
+          return input.read(&start[0], start.size()) && start == magic;
+      }
+    }
+
+    BinaryReportWriter::BinaryReportWriter(std::string const & filename, bool resume)
+    : file_name{filename}, file_buffer(1024 * 1024), offset{0}, errors{0, 0, 0, true}, warnings{0, 0, 0, true}
+    {
+        file.rdbuf()->pubsetbuf(file_buffer.data(), file_buffer.size());
+        file.open(filename, resume ? std::ios::in | std::ios::out | std::ios::binary
+                                   : std::ios::out | std::ios::binary);
+        if (!file) {
+            throw std::runtime_error{"Can't open the binary report " + filename};
+        }
+        if (resume) {
+            return;     // the header is already there, and the offset is loaded from the checkpoint
+        }
+
+        file.write(binary_report::magic, sizeof(binary_report::magic) - 1);
+        file.write(reinterpret_cast<char const *>(&binary_report::byte_order_mark), sizeof(binary_report::byte_order_mark));
+        offset = binary_report::header_size;
+    }
+
+    BinaryReportWriter::~BinaryReportWriter()
+    {
+        close();
+    }
+
+    void BinaryReportWriter::write_error(Error &error)
+    {
+        write(error, Severity::ERROR, errors);
+    }
+
+    void BinaryReportWriter::write_warning(Error &error)
+    {
+        write(error, Severity::WARNING, warnings);
+    }
+
+    void BinaryReportWriter::write_batch(std::vector<ReportedError> const & batch)
+    {
+        for (auto & reported : batch) {
+            if (reported.severity == Severity::ERROR) {
+                write(*reported.error, Severity::ERROR, errors);
+            } else {
+                write(*reported.error, Severity::WARNING, warnings);
+            }
+        }
+    }
+
+    void BinaryReportWriter::write_message(const std::string &report_result)
+    {
+        // do nothing
+    }
+
+    std::string BinaryReportWriter::get_filename()
+    {
+        return file_name;
+    }
+
+    void BinaryReportWriter::save_checkpoint(std::ostream &checkpoint)
+    {
+        if (!file.flush()) {
+            throw std::runtime_error{"Couldn't write the binary report " + file_name};
+        }
+        util::write_number(checkpoint, offset);
+        for (SeverityCount const * severity_count : {&errors, &warnings}) {
+            util::write_number(checkpoint, severity_count->count);
+            util::write_number(checkpoint, severity_count->first_offset);
+            util::write_number(checkpoint, severity_count->last_line);
+            util::write_number(checkpoint, severity_count->sorted);
+        }
+    }
+
+    void BinaryReportWriter::load_checkpoint(std::istream &checkpoint)
+    {
+        offset = util::read_number(checkpoint);
+        for (SeverityCount * severity_count : {&errors, &warnings}) {
+            severity_count->count = util::read_number(checkpoint);
+            severity_count->first_offset = util::read_number(checkpoint);
+            severity_count->last_line = util::read_number(checkpoint);
+            severity_count->sorted = util::read_number(checkpoint) != 0;
+        }
+        truncate_report(file_name, offset);
+        file.seekp(offset);
+    }
+
+    void BinaryReportWriter::write(Error &error, Severity severity, SeverityCount & severity_count)
+    {
+        FieldsVisitor fields;
+        error.apply_visitor(fields);
+
+        record.clear();
+        append(record, static_cast<uint8_t>(fields.type));
+        append(record, static_cast<uint8_t>(severity));
+        append(record, static_cast<uint8_t>(fields.error_fix));
+        append(record, static_cast<uint64_t>(error.line));
+        append(record, static_cast<int64_t>(fields.field_cardinality));
+        append_string(record, error.message);
+        append_string(record, error.detailed_message);
+        append_string(record, *fields.field);
+        append_string(record, *fields.expected_value);
+
+        uint32_t size = static_cast<uint32_t>(record.size());
+        file.write(reinterpret_cast<char const *>(&size), sizeof(size));
+        file.write(record.data(), record.size());
+
+        if (severity_count.count == 0) {
+            severity_count.first_offset = offset;
+        } else if (error.line < severity_count.last_line) {
+            severity_count.sorted = false;
+        }
+        severity_count.last_line = error.line;
+        ++severity_count.count;
+        offset += sizeof(size) + size;
+    }
+
+    void BinaryReportWriter::close()
+    {
+        if (!file.is_open()) {
+            return;
+        }
+
+        uint64_t footer[] = {errors.count, errors.first_offset, errors.sorted,
+                             warnings.count, warnings.first_offset, warnings.sorted,
+                             offset};
+        file.write(reinterpret_cast<char const *>(footer), sizeof(footer));
+        file.close();
+    }
+
+    BinaryReportReader::BinaryReportReader(std::string const & filename)
+    {
+        try {
+            file.open(filename);
+        } catch (std::exception const & e) {
+            throw std::runtime_error{"Can't open the binary report " + filename + ": " + e.what()};
+        }
+
+        char const * data = file.data();
+        if (file.size() < binary_report::header_size + binary_report::footer_size
+                || !std::equal(binary_report::magic, binary_report::magic + sizeof(binary_report::magic) - 1, data)) {
+            throw std::runtime_error{filename + " is not a binary report"};
+        }
+
+        uint32_t byte_order_mark;
+        std::memcpy(&byte_order_mark, data + sizeof(binary_report::magic) - 1, sizeof(byte_order_mark));
+        if (byte_order_mark != binary_report::byte_order_mark) {
+            throw std::runtime_error{"The binary report " + filename + " was written with another byte order"};
+        }
+
+        uint64_t footer[7];
+        std::memcpy(footer, data + file.size() - binary_report::footer_size, sizeof(footer));
+        errors = SeverityIndex{footer[0], footer[1], footer[2] != 0};
+        warnings = SeverityIndex{footer[3], footer[4], footer[5] != 0};
+        records_end = footer[6];
+        if (records_end != file.size() - binary_report::footer_size) {
+            throw std::runtime_error{"The binary report " + filename + " is corrupted"};
+        }
+    }
+
+    size_t BinaryReportReader::count_errors()
+    {
+        return errors.count;
+    }
+
+    void BinaryReportReader::for_each_error(std::function<void(std::shared_ptr<Error>)> user_function)
+    {
+        for_each(errors, Severity::ERROR, user_function);
+    }
+
+    size_t BinaryReportReader::count_warnings()
+    {
+        return warnings.count;
+    }
+
+    void BinaryReportReader::for_each_warning(std::function<void(std::shared_ptr<Error>)> user_function)
+    {
+        for_each(warnings, Severity::WARNING, user_function);
+    }
+
+    void BinaryReportReader::for_each(SeverityIndex const & index,
+                                      Severity severity,
+                                      std::function<void(std::shared_ptr<Error>)> const & user_function)
+    {
+        char const * data = file.data();
+        std::vector<std::pair<uint64_t, uint64_t>> unsorted;    // line and offset of each record
+        uint64_t found = 0;
+
+        for (uint64_t offset = index.first_offset; found < index.count; ) {
+            if (offset + line_position + sizeof(uint64_t) > records_end) {
+                throw std::runtime_error{"The binary report is corrupted"};
+            }
+            uint32_t size;
+            std::memcpy(&size, data + offset, sizeof(size));
+            uint64_t next = offset + record_size_bytes + size;
+            if (next > records_end) {
+                throw std::runtime_error{"The binary report is corrupted"};
+            }
+
+            if (static_cast<Severity>(data[offset + severity_position]) == severity) {
+                ++found;
+                if (index.sorted) {
+                    user_function(std::shared_ptr<Error>{decode(data + offset + record_size_bytes, data + next)});
+                } else {
+                    uint64_t line;
+                    std::memcpy(&line, data + offset + line_position, sizeof(line));
+                    unsorted.emplace_back(line, offset);
+                }
+            }
+            offset = next;
+        }
+
+        // a few errors are reported after the line they belong to, like the first occurrence of a duplicate
+        std::stable_sort(unsorted.begin(), unsorted.end(),
+                         [](std::pair<uint64_t, uint64_t> const & a, std::pair<uint64_t, uint64_t> const & b) {
+                             return a.first < b.first;
+                         });
+        for (auto & record : unsorted) {
+            uint32_t size;
+            std::memcpy(&size, data + record.second, sizeof(size));
+            char const * begin = data + record.second + record_size_bytes;
+            user_function(std::shared_ptr<Error>{decode(begin, begin + size)});
+        }
+    }
+  }
+}
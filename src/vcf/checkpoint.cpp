@@ -0,0 +1,249 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+
+#include <boost/filesystem.hpp>
+#include <zlib.h>
+
+#include "util/stream_utils.hpp"
+#include "vcf/checkpoint.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+
+    namespace
+    {
+      std::string const magic = "vcf-validator checkpoint 3";
+      std::string const incremental_magic = "vcf-validator incremental state 2";
+
+      std::string read_file(std::string const & path, std::string const & description)
+      {
+          std::ifstream file{path, std::ios::binary};
+          if (!file) {
+              throw std::runtime_error{"Couldn't open the " + description + " " + path};
+          }
+          std::ostringstream contents;
+          contents << file.rdbuf();
+          return contents.str();
+      }
+
+      /**
+       * Writes to a temporary file that then replaces `path`, so an interruption leaves the previous contents intact
+       */
+      void replace_file(std::string const & path, std::string const & contents)
+      {
+          std::string temporary_path = path + ".tmp";
+          {
+              std::ofstream file{temporary_path, std::ios::out | std::ios::binary};
+              util::writeline(file, contents);
+              if (!file.flush()) {
+                  throw std::runtime_error{"Couldn't write " + temporary_path};
+              }
+          }
+          boost::filesystem::rename(temporary_path, path);
+      }
+
+      /**
+       * Checksum of the last bytes of the first `size` of the input
+       */
+      uint64_t tail_checksum(util::Block input, uint64_t size)
+      {
+          size_t tail = static_cast<size_t>(std::min<uint64_t>(size, IncrementalState::tail_size));
+          return crc32(0, reinterpret_cast<Bytef const *>(input.data + size - tail), tail);
+      }
+    }
+
+    Checkpoints::Checkpoints(std::string const & path, std::chrono::steady_clock::duration interval)
+    : path{path}, interval{interval}, last_written{std::chrono::steady_clock::now()}, loaded{false}, input_size{0},
+      level{0}, input_offset{0}
+    {
+    }
+
+    void Checkpoints::load()
+    {
+        state.str(read_file(path, "checkpoint"));
+
+        try {
+            if (util::read_string(state) != magic) {
+                throw std::runtime_error{"it was written by another version of the validator"};
+            }
+            input_size = util::read_number(state);
+            level = util::read_number(state);
+            input_offset = util::read_number(state);
+            reports.clear();
+            for (size_t count = util::read_number(state); count != 0; --count) {
+                reports.push_back(util::read_string(state));
+            }
+        } catch (std::runtime_error const & error) {
+            throw std::runtime_error{"The checkpoint " + path + " is not valid: " + error.what()};
+        }
+        loaded = true;
+    }
+
+    bool Checkpoints::is_resuming() const
+    {
+        return loaded;
+    }
+
+    std::vector<std::string> const & Checkpoints::report_files() const
+    {
+        return reports;
+    }
+
+    uint64_t Checkpoints::restore(uint64_t input_size,
+                                  ValidationLevel level,
+                                  ParserImpl & parser,
+                                  std::vector<std::unique_ptr<ReportWriter>> & outputs)
+    {
+        if (input_size != this->input_size) {
+            throw std::runtime_error{"The checkpoint " + path + " was written validating an input of another size"};
+        }
+        if (static_cast<uint64_t>(level) != this->level) {
+            throw std::runtime_error{"The checkpoint " + path + " was written validating at another level"};
+        }
+        bool same_reports = outputs.size() == reports.size();
+        for (size_t i = 0; same_reports && i < outputs.size(); ++i) {
+            same_reports = outputs[i]->get_filename() == reports[i];
+        }
+        if (!same_reports) {
+            throw std::runtime_error{"The checkpoint " + path + " was written with other reports"};
+        }
+
+        try {
+            for (auto & output : outputs) {
+                output->load_checkpoint(state);
+            }
+            parser.load_body_state(state);
+        } catch (std::runtime_error const & error) {
+            throw std::runtime_error{"The checkpoint " + path + " is not valid: " + error.what()};
+        }
+        last_written = std::chrono::steady_clock::now();
+        return input_offset;
+    }
+
+    bool Checkpoints::is_due() const
+    {
+        return std::chrono::steady_clock::now() - last_written >= interval;
+    }
+
+    void Checkpoints::write(uint64_t input_size,
+                            uint64_t input_offset,
+                            ValidationLevel level,
+                            ParserImpl const & parser,
+                            std::vector<std::unique_ptr<ReportWriter>> & outputs)
+    {
+        // the reports are flushed before the checkpoint replaces the previous one, which is then already behind them
+        std::ostringstream checkpoint;
+        util::write_string(checkpoint, magic);
+        util::write_number(checkpoint, input_size);
+        util::write_number(checkpoint, static_cast<uint64_t>(level));
+        util::write_number(checkpoint, input_offset);
+        util::write_number(checkpoint, outputs.size());
+        for (auto & output : outputs) {
+            util::write_string(checkpoint, output->get_filename());
+        }
+        for (auto & output : outputs) {
+            output->save_checkpoint(checkpoint);
+        }
+        parser.save_body_state(checkpoint);
+
+        replace_file(path, checkpoint.str());
+        last_written = std::chrono::steady_clock::now();
+    }
+
+    void Checkpoints::remove()
+    {
+        boost::filesystem::remove(path);
+    }
+
+    std::string const & Checkpoints::get_path() const
+    {
+        return path;
+    }
+
+    size_t const IncrementalState::tail_size;
+
+    IncrementalState::IncrementalState(std::string const & path)
+    : path{path}, loaded{false}, input_size{0}, tail_checksum{0}, level{0}, input_offset{0}
+    {
+    }
+
+    void IncrementalState::load()
+    {
+        state.str(read_file(path, "incremental state"));
+        try {
+            if (util::read_string(state) != incremental_magic) {
+                throw std::runtime_error{"it was written by another version of the validator"};
+            }
+            input_size = util::read_number(state);
+            tail_checksum = util::read_number(state);
+            level = util::read_number(state);
+            input_offset = util::read_number(state);
+        } catch (std::runtime_error const & error) {
+            throw std::runtime_error{"The incremental state " + path + " is not valid: " + error.what()};
+        }
+        loaded = true;
+    }
+
+    bool IncrementalState::is_continuing() const
+    {
+        return loaded;
+    }
+
+    bool IncrementalState::matches(util::Block input, ValidationLevel level) const
+    {
+        return input.size >= input_size
+                && vcf::tail_checksum(input, input_size) == tail_checksum
+                && static_cast<uint64_t>(level) == this->level;
+    }
+
+    uint64_t IncrementalState::restore(ParserImpl & parser)
+    {
+        try {
+            parser.load_body_state(state);
+        } catch (std::runtime_error const & error) {
+            throw std::runtime_error{"The incremental state " + path + " is not valid: " + error.what()};
+        }
+        return input_offset;
+    }
+
+    void IncrementalState::write(util::Block input,
+                                 uint64_t input_offset,
+                                 ValidationLevel level,
+                                 ParserImpl const & parser)
+    {
+        std::ostringstream contents;
+        util::write_string(contents, incremental_magic);
+        util::write_number(contents, input.size);
+        util::write_number(contents, vcf::tail_checksum(input, input.size));
+        util::write_number(contents, static_cast<uint64_t>(level));
+        util::write_number(contents, input_offset);
+        parser.save_body_state(contents);
+        replace_file(path, contents.str());
+    }
+
+    std::string const & IncrementalState::get_path() const
+    {
+        return path;
+    }
+
+  }
+}
@@ -0,0 +1,62 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+#include "vcf/contig_table.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    namespace
+    {
+      struct ContigTable
+      {
+          std::mutex mutex;
+          std::unordered_map<std::string, ContigId> ids;
+          std::deque<std::string> names;    // a deque doesn't move its elements, so the names can be returned by reference
+      };
+
+      ContigTable & contig_table()
+      {
+          static ContigTable table;
+          return table;
+      }
+    }
+
+    ContigId intern_contig(std::string const & name)
+    {
+        ContigTable & table = contig_table();
+        std::lock_guard<std::mutex> lock{table.mutex};
+        auto inserted = table.ids.emplace(name, table.names.size());
+        if (inserted.second) {
+            table.names.push_back(name);
+        }
+        return inserted.first->second;
+    }
+
+    std::string const & contig_name(ContigId id)
+    {
+        ContigTable & table = contig_table();
+        std::lock_guard<std::mutex> lock{table.mutex};
+        return table.names.at(id);
+    }
+  }
+}
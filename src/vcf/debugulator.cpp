@@ -14,6 +14,10 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
 #include "util/logger.hpp"
 #include "vcf/debugulator.hpp"
 
@@ -26,6 +30,14 @@ namespace ebi
       size_t fix_vcf_file(std::istream &input,
                           ebi::vcf::ReportReader &errorDAO,
                           std::ostream &output)
+      {
+          util::StreamBlockReader reader{input};
+          return fix_vcf_file(reader, errorDAO, output);
+      }
+
+      size_t fix_vcf_file(util::BlockReader &input,
+                          ebi::vcf::ReportReader &errorDAO,
+                          std::ostream &output)
       {
           std::vector<char> line;
           line.reserve(default_line_buffer_size);
@@ -41,32 +53,43 @@ namespace ebi
 
           ebi::vcf::Fixer fixer{output};
 
+          // the errors of the line read are fixed together, when the first error of another line comes
+          std::vector<std::shared_ptr<ebi::vcf::Error>> line_errors;
+          std::vector<ebi::vcf::Error *> line_error_pointers;
+          auto fix_line = [&]() {
+              line_error_pointers.clear();
+              for (auto & line_error : line_errors) {
+                  line_error_pointers.push_back(line_error.get());
+              }
+              fixer.fix(current_line, line, line_error_pointers);
+              errors_fixed += line_errors.size();
+              line_errors.clear();
+          };
+
           errorDAO.for_each_error([&](std::shared_ptr<ebi::vcf::Error> error) {
               size_t line_index = error->line;
-              while (current_line < line_index) {
+              if (current_line < line_index) {
+                  if (!line_errors.empty()) {
+                      fix_line();
+                  }
 
-                  // advance input
-                  if (ebi::util::readline(input, line).size() == 0) {
+                  // advance input: copy the lines before the one with the error, which is read to be fixed
+                  size_t lines_to_copy = line_index - current_line - 1;
+                  if (input.copy_lines(lines_to_copy, output) != lines_to_copy || input.readline(line).size() == 0) {
                       throw std::runtime_error("The file was shorter than expected, only "
                                                        + std::to_string(errors_fixed) + "/" + std::to_string(errors)
                                                        + " error reports were processed");
                   }
-                  current_line++;
-                  if (current_line == line_index) {
-                      break;
-                  }
-                  ebi::util::writeline(output, line);
+                  current_line = line_index;
               }
-              fixer.fix(line_index, line, *error);
-              ++errors_fixed;
+              line_errors.push_back(std::move(error));
           });
+          if (!line_errors.empty()) {
+              fix_line();
+          }
 
           // advance input from the last error to the end of input
-          while (ebi::util::readline(input, line).size() != 0) {
-              for (auto c : line) {
-                  output << c;
-              }
-          }
+          input.copy_rest(output);
 
           size_t ignored_errors = fixer.get_ignored_errors();
           if (ignored_errors != 0) {
@@ -75,6 +98,99 @@ namespace ebi
 
           return ignored_errors;
       }
+
+      StreamingFixer::StreamingFixer(std::ostream &output, size_t max_held_size)
+              : output(output), fixer{output}, max_held_size{max_held_size},
+                line_starts{0}, first_held_line{1}, late_errors{0}
+      {
+          line.reserve(default_line_buffer_size);
+      }
+
+      void StreamingFixer::add_input(char const * begin, char const * end)
+      {
+          size_t offset = held.size();
+          held.insert(held.end(), begin, end);
+          for (char const * p = std::find(begin, end, '\n'); p != end; p = std::find(p + 1, end, '\n')) {
+              line_starts.push_back(offset + static_cast<size_t>(p - begin) + 1);
+          }
+
+          if (held.size() > max_held_size && line_starts.size() > 1) {
+              BOOST_LOG_TRIVIAL(warning) << "The input is too unsorted to hold every line until its duplicates are "
+                                            "found, some of them may not be removed from the fixed file";
+              write_until(first_held_line + line_starts.size() - 1);
+          }
+      }
+
+      void StreamingFixer::add_error(Error const &error)
+      {
+          if (error.line < first_held_line) {
+              ++late_errors;
+          } else {
+              errors.emplace(error.line, std::unique_ptr<Error>{error.clone()});
+          }
+      }
+
+      void StreamingFixer::write_until(size_t line_number)
+      {
+          // the last line held may be incomplete, so it's kept until finish even if it has all its reports
+          size_t complete_lines = line_starts.size() - 1;
+          if (line_number <= first_held_line || complete_lines == 0) {
+              return;
+          }
+          size_t lines = std::min(line_number - first_held_line, complete_lines);
+
+          // the lines without errors are copied in blocks
+          size_t written = 0;
+          auto error = errors.begin();
+          while (error != errors.end() && error->first < first_held_line + lines) {
+              size_t i = error->first - first_held_line;
+              output.write(held.data() + written, line_starts[i] - written);
+              auto last_error = errors.upper_bound(error->first);
+              write_line(error->first, held.data() + line_starts[i], held.data() + line_starts[i + 1],
+                         error, last_error);
+              written = line_starts[i + 1];
+              error = last_error;
+          }
+          output.write(held.data() + written, line_starts[lines] - written);
+          errors.erase(errors.begin(), error);
+
+          size_t written_size = line_starts[lines];
+          held.erase(held.begin(), held.begin() + written_size);
+          line_starts.erase(line_starts.begin(), line_starts.begin() + lines);
+          for (auto & line_start : line_starts) {
+              line_start -= written_size;
+          }
+          first_held_line += lines;
+      }
+
+      void StreamingFixer::write_line(size_t line_number, char const * begin, char const * end,
+                                      LineErrors::iterator first_error, LineErrors::iterator last_error)
+      {
+          line.assign(begin, end);
+          line_errors.clear();
+          for (auto error = first_error; error != last_error; ++error) {
+              line_errors.push_back(error->second.get());
+          }
+          fixer.fix(line_number, line, line_errors);
+      }
+
+      size_t StreamingFixer::finish()
+      {
+          if (line_starts.back() != held.size()) {
+              line_starts.push_back(held.size());     // the last line doesn't end in a newline
+          }
+          write_until(std::numeric_limits<size_t>::max());
+
+          if (late_errors != 0) {
+              BOOST_LOG_TRIVIAL(warning) << "There were " << late_errors << " errors reported after their line was "
+                                            "written, that couldn't be fixed";
+          }
+          size_t ignored_errors = fixer.get_ignored_errors() + late_errors;
+          if (ignored_errors != 0) {
+              BOOST_LOG_TRIVIAL(info) << "There were " << ignored_errors << " errors that couldn't be automatically fixed";
+          }
+          return ignored_errors;
+      }
     }
   }
 }
@@ -0,0 +1,198 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <set>
+#include <stdexcept>
+
+#include <boost/filesystem.hpp>
+
+#include "util/stream_utils.hpp"
+#include "vcf/duplicate_filter.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+
+    constexpr double DuplicateFilter::default_false_positive_rate;
+
+    namespace
+    {
+      /**
+       * Second hash for the double hashing of the bits of a variant, odd so it goes through all of them
+       */
+      uint64_t step_of(uint64_t hash)
+      {
+          hash ^= hash >> 33;
+          hash *= 0xff51afd7ed558ccdULL;
+          hash ^= hash >> 33;
+          return hash | 1;
+      }
+    }
+
+    DuplicateFilter::DuplicateFilter(std::string const & directory,
+                                     size_t expected_variants,
+                                     double false_positive_rate)
+    : first{std::numeric_limits<size_t>::max()}
+    {
+        if (!(false_positive_rate > 0 && false_positive_rate < 1)) {
+            throw std::invalid_argument{"The false positive rate of the filter of duplicates must be between 0 and 1"};
+        }
+
+        // the usual optimal sizes: -n ln(p) / ln(2)^2 bits, and ln(2) bits per variant set by as many hashes
+        double variants = static_cast<double>(std::max(expected_variants, size_t{1}));
+        double optimal_bits = -variants * std::log(false_positive_rate) / (std::log(2.0) * std::log(2.0));
+        size_t words = std::max(size_t{1}, static_cast<size_t>(std::ceil(optimal_bits / 64)));
+        bits.assign(words, 0);
+        hashes = std::max(size_t{1}, static_cast<size_t>(std::round(words * 64 / variants * std::log(2.0))));
+
+        boost::filesystem::path pattern{directory};
+        pattern /= "vcf_validator_forgotten_%%%%-%%%%-%%%%-%%%%.variants";
+        path = boost::filesystem::unique_path(pattern).string();
+        forgotten.open(path, std::ios::out | std::ios::binary);
+        if (!forgotten) {
+            throw std::runtime_error{"Couldn't create the file of forgotten variants " + path};
+        }
+    }
+
+    DuplicateFilter::~DuplicateFilter()
+    {
+        forgotten.close();
+        boost::system::error_code ignored;
+        boost::filesystem::remove(path, ignored);
+    }
+
+    void DuplicateFilter::forget(RecordCore const & record_core, uint64_t hash)
+    {
+        uint64_t step = step_of(hash);
+        size_t size = bits.size() * 64;
+        for (size_t i = 0; i < hashes; ++i) {
+            uint64_t bit = (hash + i * step) % size;
+            bits[bit / 64] |= uint64_t{1} << (bit % 64);
+        }
+
+        util::write_number(forgotten, record_core.line);
+        util::write_string(forgotten, record_core.chromosome);
+        util::write_number(forgotten, record_core.position);
+        util::write_string(forgotten, record_core.reference_allele);
+        util::write_string(forgotten, record_core.alternate_allele);
+        first = std::min(first, record_core.line);
+    }
+
+    bool DuplicateFilter::may_contain(uint64_t hash) const
+    {
+        uint64_t step = step_of(hash);
+        size_t size = bits.size() * 64;
+        for (size_t i = 0; i < hashes; ++i) {
+            uint64_t bit = (hash + i * step) % size;
+            if ((bits[bit / 64] & (uint64_t{1} << (bit % 64))) == 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void DuplicateFilter::check(RecordCore const & record_core, uint64_t hash)
+    {
+        if (first != std::numeric_limits<size_t>::max() && may_contain(hash)) {
+            suspects.push_back(record_core);
+        }
+    }
+
+    std::vector<std::unique_ptr<Error>> DuplicateFilter::find_duplicates()
+    {
+        std::vector<std::unique_ptr<Error>> duplicates;
+        if (suspects.empty()) {
+            return duplicates;
+        }
+        if (!forgotten.flush()) {
+            throw std::runtime_error{"Couldn't write the forgotten variants " + path};
+        }
+
+        // line of the first forgotten occurrence of each suspect, if any
+        std::map<RecordCore, size_t> first_occurrences;
+        for (auto & suspect : suspects) {
+            first_occurrences.emplace(suspect, std::numeric_limits<size_t>::max());
+        }
+        std::ifstream input{path, std::ios::binary};
+        try {
+            while (input.peek() != std::char_traits<char>::eof()) {
+                size_t line = util::read_number(input);
+                std::string chromosome = util::read_string(input);
+                size_t position = util::read_number(input);
+                std::string reference_allele = util::read_string(input);
+                RecordCore record_core{line, chromosome, position, reference_allele, util::read_string(input)};
+                auto occurrence = first_occurrences.find(record_core);
+                if (occurrence != first_occurrences.end()) {
+                    occurrence->second = std::min(occurrence->second, line);
+                }
+            }
+        } catch (std::runtime_error const & error) {
+            throw std::runtime_error{"Couldn't read the forgotten variants " + path + ": " + error.what()};
+        }
+
+        std::set<RecordCore> reported;
+        for (auto & suspect : suspects) {
+            size_t first_occurence_line = first_occurrences[suspect];
+            if (first_occurence_line >= suspect.line) {
+                // a false positive of the filter
+                continue;
+            }
+
+            std::string message = "Duplicated variant " + suspect.chromosome + ":" + std::to_string(suspect.position)
+                                  + ":" + suspect.reference_allele + ">" + suspect.alternate_allele + " found";
+            std::string duplicate_variant_lines = "It occurs in lines " + std::to_string(first_occurence_line)
+                                                  + " and " + std::to_string(suspect.line);
+            if (reported.insert(suspect).second) {
+                // like the cache, an extra error for the first occurrence
+                duplicates.emplace_back(new DuplicationError{first_occurence_line, message});
+            }
+            duplicates.emplace_back(new DuplicationError{suspect.line, message, duplicate_variant_lines});
+        }
+        suspects.clear();
+        return duplicates;
+    }
+
+    size_t DuplicateFilter::first_line() const
+    {
+        return first;
+    }
+
+    size_t DuplicateFilter::allocated_bytes() const
+    {
+        return bits.size() * sizeof(uint64_t) + suspects.capacity() * sizeof(RecordCore);
+    }
+
+    size_t DuplicateFilter::bit_count() const
+    {
+        return bits.size() * 64;
+    }
+
+    size_t DuplicateFilter::hash_count() const
+    {
+        return hashes;
+    }
+
+    size_t DuplicateFilter::suspect_count() const
+    {
+        return suspects.size();
+    }
+  }
+}
@@ -0,0 +1,59 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "vcf/error_thrower.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+
+    namespace
+    {
+      class ThrowingVisitor : public ErrorVisitor
+      {
+        public:
+          virtual void visit(Error &error) override { throw &error; }
+          virtual void visit(MetaSectionError &error) override { throw &error; }
+          virtual void visit(HeaderSectionError &error) override { throw &error; }
+          virtual void visit(BodySectionError &error) override { throw &error; }
+          virtual void visit(NoMetaDefinitionError &error) override { throw &error; }
+          virtual void visit(FileformatError &error) override { throw &error; }
+          virtual void visit(ChromosomeBodyError &error) override { throw &error; }
+          virtual void visit(PositionBodyError &error) override { throw &error; }
+          virtual void visit(IdBodyError &error) override { throw &error; }
+          virtual void visit(ReferenceAlleleBodyError &error) override { throw &error; }
+          virtual void visit(AlternateAllelesBodyError &error) override { throw &error; }
+          virtual void visit(QualityBodyError &error) override { throw &error; }
+          virtual void visit(FilterBodyError &error) override { throw &error; }
+          virtual void visit(InfoBodyError &error) override { throw &error; }
+          virtual void visit(FormatBodyError &error) override { throw &error; }
+          virtual void visit(SamplesBodyError &error) override { throw &error; }
+          virtual void visit(SamplesFieldBodyError &error) override { throw &error; }
+          virtual void visit(NormalizationError &error) override { throw &error; }
+          virtual void visit(DuplicationError &error) override { throw &error; }
+      };
+    }
+
+    void throw_error(Error * error)
+    {
+        ThrowingVisitor visitor;
+        error->apply_visitor(visitor);
+        throw error;    // not reached, every visit throws
+    }
+
+  }
+}
@@ -0,0 +1,73 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <typeinfo>
+
+#include "util/stream_utils.hpp"
+#include "vcf/error_type_counts.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    bool ErrorTypeCounts::add(Severity severity, Error const & error, size_t max)
+    {
+        size_t & count = counts[Type{severity, class_id(error), messages.intern(error.type_message())}];
+        if (count >= max) {
+            return false;
+        }
+        ++count;
+        return true;
+    }
+
+    void ErrorTypeCounts::clear()
+    {
+        counts.clear();
+    }
+
+    void ErrorTypeCounts::save(std::ostream & checkpoint) const
+    {
+        util::write_number(checkpoint, counts.size());
+        for (auto & type : counts) {
+            util::write_number(checkpoint, static_cast<uint64_t>(std::get<0>(type.first)));
+            util::write_string(checkpoint, messages.text(std::get<1>(type.first)));
+            util::write_string(checkpoint, messages.text(std::get<2>(type.first)));
+            util::write_number(checkpoint, type.second);
+        }
+    }
+
+    void ErrorTypeCounts::load(std::istream & checkpoint)
+    {
+        counts.clear();
+        for (size_t types = util::read_number(checkpoint); types != 0; --types) {
+            auto severity = static_cast<Severity>(util::read_number(checkpoint));
+            MessageId error_class = messages.intern(util::read_string(checkpoint));
+            MessageId message = messages.intern(util::read_string(checkpoint));
+            counts[Type{severity, error_class, message}] = util::read_number(checkpoint);
+        }
+    }
+
+    MessageId ErrorTypeCounts::class_id(Error const & error)
+    {
+        std::type_index error_class{typeid(error)};
+        auto found = class_ids.find(error_class);
+        if (found == class_ids.end()) {
+            found = class_ids.emplace(error_class, messages.intern(error_class.name())).first;
+        }
+        return found->second;
+    }
+  }
+}
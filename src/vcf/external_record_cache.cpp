@@ -0,0 +1,314 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+
+#include <boost/filesystem.hpp>
+
+#include "util/stream_utils.hpp"
+#include "vcf/external_record_cache.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+
+    size_t const ExternalRecordCache::default_run_capacity;
+    size_t const ExternalRecordCache::max_merged_runs;
+
+    namespace
+    {
+      /**
+       * Duplicates of a variant, found as its occurrences come in the order they were read
+       */
+      struct DuplicateReport
+      {
+          size_t line_read;   ///< line being read when an unlimited RecordCache would have reported it
+          size_t allele;
+          std::unique_ptr<Error> error;
+      };
+    }
+
+    ExternalRecordCache::ExternalRecordCache(std::string const & directory, size_t run_capacity)
+    : directory{directory}, run_capacity{std::max(run_capacity, size_t{1})},
+      first{std::numeric_limits<size_t>::max()}
+    {
+    }
+
+    ExternalRecordCache::~ExternalRecordCache()
+    {
+        for (auto & run : runs) {
+            boost::system::error_code ignored;
+            boost::filesystem::remove(run, ignored);
+        }
+    }
+
+    void ExternalRecordCache::add(Record const & record, std::vector<NormalizedAllele> const & alleles)
+    {
+        for (size_t i = 0; i < alleles.size(); ++i) {
+            variants.push_back(Variant{make_record_core(record, alleles[i]), i});
+        }
+        if (first == std::numeric_limits<size_t>::max() && !alleles.empty()) {
+            first = record.line;
+        }
+        if (variants.size() >= run_capacity) {
+            write_run();
+        }
+    }
+
+    size_t ExternalRecordCache::first_line() const
+    {
+        return first;
+    }
+
+    size_t ExternalRecordCache::allocated_bytes() const
+    {
+        return variants.capacity() * sizeof(Variant);
+    }
+
+    size_t ExternalRecordCache::written_runs() const
+    {
+        return runs.size();
+    }
+
+    bool ExternalRecordCache::read_order(Variant const & a, Variant const & b)
+    {
+        if (a.record_core < b.record_core) {
+            return true;
+        }
+        if (b.record_core < a.record_core) {
+            return false;
+        }
+        if (a.record_core.line != b.record_core.line) {
+            return a.record_core.line < b.record_core.line;
+        }
+        return a.allele < b.allele;
+    }
+
+    namespace
+    {
+      void write_variant(std::ostream & output, RecordCore const & record_core, size_t allele)
+      {
+          util::write_number(output, record_core.line);
+          util::write_number(output, allele);
+          util::write_string(output, record_core.chromosome);
+          util::write_number(output, record_core.position);
+          util::write_string(output, record_core.reference_allele);
+          util::write_string(output, record_core.alternate_allele);
+      }
+
+      /**
+       * Run being merged, with the variant it is at
+       */
+      struct RunReader
+      {
+          std::ifstream file;
+          size_t remaining;
+          RecordCore record_core;
+          size_t allele;
+
+          explicit RunReader(std::string const & path)
+          : file{path, std::ios::binary}, remaining{0}, record_core{0, "", 0, "", ""}, allele{0}
+          {
+              if (!file) {
+                  throw std::runtime_error{"Couldn't open the sorted variants " + path};
+              }
+              remaining = util::read_number(file);
+          }
+
+          bool next()
+          {
+              if (remaining == 0) {
+                  return false;
+              }
+              --remaining;
+              record_core.line = util::read_number(file);
+              allele = util::read_number(file);
+              record_core.chromosome = util::read_string(file);
+              record_core.position = util::read_number(file);
+              record_core.reference_allele = util::read_string(file);
+              record_core.alternate_allele = util::read_string(file);
+              return true;
+          }
+      };
+    }
+
+    std::string ExternalRecordCache::new_run_path() const
+    {
+        boost::filesystem::path pattern{directory};
+        pattern /= "vcf_validator_variants_%%%%-%%%%-%%%%-%%%%.run";
+        return boost::filesystem::unique_path(pattern).string();
+    }
+
+    void ExternalRecordCache::write_run()
+    {
+        std::sort(variants.begin(), variants.end(), read_order);
+        std::string path = new_run_path();
+        std::ofstream file{path, std::ios::out | std::ios::binary};
+        runs.push_back(path);
+        util::write_number(file, variants.size());
+        for (auto & variant : variants) {
+            write_variant(file, variant.record_core, variant.allele);
+        }
+        if (!file.flush()) {
+            throw std::runtime_error{"Couldn't write the sorted variants " + path};
+        }
+        variants.clear();
+    }
+
+    namespace
+    {
+      /**
+       * Reads the sorted runs at the same time, giving each variant to `consume` in the order of all of them
+       */
+      void merge(std::vector<std::string> const & paths,
+                 std::function<void(RecordCore const &, size_t)> const & consume)
+      {
+          std::vector<std::unique_ptr<RunReader>> readers;
+          for (auto & path : paths) {
+              readers.emplace_back(new RunReader{path});
+          }
+
+          auto comes_later = [&readers](size_t a, size_t b) {
+              RecordCore const & first = readers[a]->record_core;
+              RecordCore const & second = readers[b]->record_core;
+              if (first < second || second < first) {
+                  return second < first;
+              }
+              if (first.line != second.line) {
+                  return first.line > second.line;
+              }
+              return readers[a]->allele > readers[b]->allele;
+          };
+          std::priority_queue<size_t, std::vector<size_t>, decltype(comes_later)> next{comes_later};
+          for (size_t i = 0; i < readers.size(); ++i) {
+              if (readers[i]->next()) {
+                  next.push(i);
+              }
+          }
+          while (!next.empty()) {
+              size_t i = next.top();
+              next.pop();
+              consume(readers[i]->record_core, readers[i]->allele);
+              if (readers[i]->next()) {
+                  next.push(i);
+              }
+          }
+      }
+    }
+
+    std::string ExternalRecordCache::merge_runs(std::vector<std::string> const & merged)
+    {
+        size_t count = 0;
+        for (auto & path : merged) {
+            std::ifstream file{path, std::ios::binary};
+            count += util::read_number(file);
+        }
+
+        std::string path = new_run_path();
+        std::ofstream file{path, std::ios::out | std::ios::binary};
+        runs.push_back(path);
+        util::write_number(file, count);
+        merge(merged, [&file](RecordCore const & record_core, size_t allele) {
+            write_variant(file, record_core, allele);
+        });
+        if (!file.flush()) {
+            throw std::runtime_error{"Couldn't write the sorted variants " + path};
+        }
+        for (auto & merged_path : merged) {
+            boost::filesystem::remove(merged_path);
+        }
+        return path;
+    }
+
+    std::vector<std::unique_ptr<Error>> ExternalRecordCache::find_duplicates()
+    {
+        std::vector<DuplicateReport> reports;
+        std::unique_ptr<RecordCore> first_occurrence;
+        size_t occurrences = 0;
+
+        // the same errors RecordCache reports with every variant held, as each occurrence comes
+        auto check = [&](RecordCore const & record_core, size_t allele) {
+            if (first_occurrence && !(*first_occurrence < record_core) && !(record_core < *first_occurrence)) {
+                ++occurrences;
+            } else {
+                first_occurrence.reset(new RecordCore{record_core});
+                occurrences = 1;
+                return;
+            }
+
+            std::string message = "Duplicated variant " + record_core.chromosome + ":"
+                                  + std::to_string(record_core.position) + ":" + record_core.reference_allele
+                                  + ">" + record_core.alternate_allele + " found";
+            size_t first_occurence_line = first_occurrence->line;
+            std::string duplicate_variant_lines = "It occurs in lines " + std::to_string(first_occurence_line)
+                                                  + " and " + std::to_string(record_core.line);
+            if (occurrences == 2) {
+                // if only one match, return an extra error for the first occurrence
+                reports.push_back(DuplicateReport{record_core.line, allele,
+                                                  std::unique_ptr<Error>{new DuplicationError{first_occurence_line,
+                                                                                              message}}});
+            }
+            reports.push_back(DuplicateReport{record_core.line, allele,
+                                              std::unique_ptr<Error>{new DuplicationError{record_core.line, message,
+                                                                                          duplicate_variant_lines}}});
+        };
+
+        if (runs.empty()) {
+            std::sort(variants.begin(), variants.end(), read_order);
+            for (auto & variant : variants) {
+                check(variant.record_core, variant.allele);
+            }
+        } else {
+            if (!variants.empty()) {
+                write_run();
+            }
+            // the oldest runs are merged first, so each variant is written again about once per pass
+            std::deque<std::string> pending{runs.begin(), runs.end()};
+            while (pending.size() > max_merged_runs) {
+                std::vector<std::string> merged{pending.begin(), pending.begin() + max_merged_runs};
+                pending.erase(pending.begin(), pending.begin() + max_merged_runs);
+                pending.push_back(merge_runs(merged));
+            }
+            merge(std::vector<std::string>{pending.begin(), pending.end()}, check);
+        }
+
+        for (auto & run : runs) {
+            boost::system::error_code ignored;
+            boost::filesystem::remove(run, ignored);
+        }
+        runs.clear();
+        variants.clear();
+        variants.shrink_to_fit();
+        first = std::numeric_limits<size_t>::max();
+
+        std::stable_sort(reports.begin(), reports.end(), [](DuplicateReport const & a, DuplicateReport const & b) {
+            return a.line_read != b.line_read ? a.line_read < b.line_read : a.allele < b.allele;
+        });
+        std::vector<std::unique_ptr<Error>> errors;
+        for (auto & report : reports) {
+            errors.push_back(std::move(report.error));
+        }
+        return errors;
+    }
+  }
+}
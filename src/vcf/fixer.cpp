@@ -15,6 +15,7 @@
  */
 
 #include "util/logger.hpp"
+#include "util/string_utils.hpp"
 #include "vcf/fixer.hpp"
 #include "vcf/string_constants.hpp"
 
@@ -22,12 +23,40 @@ namespace ebi
 {
   namespace vcf
   {
+    namespace
+    {
+      std::string join(std::vector<std::string> const &parts, std::string const &separator)
+      {
+          std::string joined;
+          for (size_t i = 0; i < parts.size(); ++i) {
+              if (i != 0) {
+                  joined += separator;
+              }
+              joined += parts[i];
+          }
+          return joined;
+      }
+    }
 
     void Fixer::fix(size_t line_number, std::vector<char> &line, Error &error)
+    {
+        std::vector<Error *> errors{&error};
+        fix(line_number, line, errors);
+    }
+
+    void Fixer::fix(size_t line_number, std::vector<char> &line, std::vector<Error *> const &errors)
     {
         this->line_number = line_number;
         this->line = &line; // this will be valid until this function returns
-        error.apply_visitor(*this);
+        split = false;
+        removed = false;
+        for (Error * error : errors) {
+            if (removed) {
+                break;
+            }
+            error->apply_visitor(*this);
+        }
+        write_line();
         this->line = nullptr;
     }
 
@@ -38,10 +67,47 @@ namespace ebi
 
     void Fixer::ignore_error()
     {
-        util::writeline(output, *line);
         ignored_errors++;        
     }
 
+    std::vector<std::string> & Fixer::line_columns()
+    {
+        if (!split) {
+            util::string_split(std::string{line->begin(), line->end()}, "\t", columns);
+            if (columns.empty()) {
+                columns.emplace_back();
+            }
+            eol = util::remove_end_of_line(columns.back());
+            split = true;
+        }
+        return columns;
+    }
+
+    std::string Fixer::current_line() const
+    {
+        if (!split) {
+            return {line->begin(), line->end()};
+        }
+        std::string joined = columns.front();
+        for (size_t i = 1; i < columns.size(); ++i) {
+            joined += "\t" + columns[i];
+        }
+        return joined + eol;
+    }
+
+    void Fixer::write_line()
+    {
+        if (removed) {
+            return;
+        }
+        if (!split) {
+            util::writeline(output, *line);
+            return;
+        }
+        util::print_container(output, columns, "", "\t", "");
+        output << eol;
+    }
+
     void Fixer::visit(Error &error)
     {
         ignore_error();
@@ -52,7 +118,7 @@ namespace ebi
         if (error.error_fix == ErrorFix::IRRECOVERABLE_VALUE) {
             ignore_error();
         } else if (error.error_fix == ErrorFix::RECOVERABLE_VALUE) {
-            std::string string_line = {line->begin(), line->end()};
+            std::string string_line = current_line();
 
             // fixing meta header definition of INFO and FORMAT, the error.value is either Type or Number
             size_t meta_error_field_start_index = string_line.find(error.value + "=");
@@ -61,7 +127,8 @@ namespace ebi
             BOOST_LOG_TRIVIAL(debug) << "Line " << error.line << ": Fixing incorrect predefined tag meta definition " << error.value;
 
             std::string fixed_meta_header_line = string_line.substr(0, meta_error_field_start_index) + error.value + "=" + error.expected_value + string_line.substr(meta_error_field_end_index);
-            util::writeline(output, fixed_meta_header_line);
+            line->assign(fixed_meta_header_line.begin(), fixed_meta_header_line.end());
+            split = false;
         }
     }
 
@@ -100,11 +167,8 @@ namespace ebi
         if (error.error_fix == ErrorFix::DUPLICATE_VALUES) {
             BOOST_LOG_TRIVIAL(debug) << "Line " << error.line << ": Fixing duplicate ID fields";
             const size_t id_column_index = 2;
-            std::string string_line = {line->begin(), line->end()};
-
-            fix_column(id_column_index, string_line, "\t", [&](std::string &id_column) {
-                remove_duplicate_strings(id_column, ";");
-            });
+            std::string &id_column = *columns_to_fix(id_column_index, id_column_index + 1).first;
+            remove_duplicate_strings(id_column, ";");
         } else {
             ignore_error();
         }
@@ -133,57 +197,51 @@ namespace ebi
         }
 
         const size_t filter_column_index = 6;
-        std::string string_line = {line->begin(), line->end()};
-
-        fix_column(filter_column_index, string_line, "\t", [&](std::string &filter_column) {
-            if (error.error_fix == ErrorFix::IRRECOVERABLE_VALUE && error.field == "0") {
-                BOOST_LOG_TRIVIAL(debug) << "Line " << error.line << ": Fixing invalid FILTER field " << error.field;
-                const std::string empty_filter_column = MISSING_VALUE;
-                auto condition_to_remove_filter_field = [&](const std::string &filter_subfield, size_t index) -> bool {
-                    return filter_subfield == error.field;
-                };
-
-                remove_fields(filter_column, ";", empty_filter_column, condition_to_remove_filter_field);
-            } else if (error.error_fix == ErrorFix::DUPLICATE_VALUES) {
-                BOOST_LOG_TRIVIAL(debug) << "Line " << error.line << ": Fixing duplicate FILTER fields";
-                remove_duplicate_strings(filter_column, ";");
-            }
-        });
+        std::string &filter_column = *columns_to_fix(filter_column_index, filter_column_index + 1).first;
+
+        if (error.error_fix == ErrorFix::IRRECOVERABLE_VALUE && error.field == "0") {
+            BOOST_LOG_TRIVIAL(debug) << "Line " << error.line << ": Fixing invalid FILTER field " << error.field;
+            const std::string empty_filter_column = MISSING_VALUE;
+            auto condition_to_remove_filter_field = [&](const std::string &filter_subfield, size_t index) -> bool {
+                return filter_subfield == error.field;
+            };
+
+            remove_fields(filter_column, ";", empty_filter_column, condition_to_remove_filter_field);
+        } else if (error.error_fix == ErrorFix::DUPLICATE_VALUES) {
+            BOOST_LOG_TRIVIAL(debug) << "Line " << error.line << ": Fixing duplicate FILTER fields";
+            remove_duplicate_strings(filter_column, ";");
+        }
     }
 
     void Fixer::visit(InfoBodyError &error)
     {
         const size_t info_column_index = 7;
-        std::string string_line = {line->begin(), line->end()};
+        std::string &info_column = *columns_to_fix(info_column_index, info_column_index + 1).first;
+        const std::string empty_info_column = MISSING_VALUE;
 
-        fix_column(info_column_index, string_line, "\t", [&](std::string &info_column) {
-            const std::string empty_info_column = MISSING_VALUE;
-
-            auto condition_to_modify_info_field = [&](const std::string &info_subfield, size_t index) -> bool {
-                std::vector<std::string> key_value;
-                util::string_split(info_subfield, "=", key_value);
-                return key_value[0] == error.field;
-            };
+        auto condition_to_modify_info_field = [&](const std::string &info_subfield, size_t index) -> bool {
+            return *util::split_view(info_subfield, "=").begin() == error.field.c_str();
+        };
 
-            if (error.error_fix == ErrorFix::DUPLICATE_VALUES) {
-                BOOST_LOG_TRIVIAL(debug) << "Line " << error.line << ": Fixing duplicate INFO fields";
-                remove_duplicate_key_value_pairs(info_column, ";", "=", empty_info_column);
-            } else if (error.error_fix == ErrorFix::RECOVERABLE_VALUE) {
-                BOOST_LOG_TRIVIAL(debug) << "Line " << error.line << ": Fixing invalid INFO field " << error.field;
-                replace_fields(info_column, ";", error.field + "=" + error.expected_value, condition_to_modify_info_field);
-            } else if (error.error_fix == ErrorFix::IRRECOVERABLE_VALUE) {
-                BOOST_LOG_TRIVIAL(debug) << "Line " << error.line << ": Removing invalid INFO field " << error.field;
-                remove_fields(info_column, ";", empty_info_column, condition_to_modify_info_field);
-            }
-        });
+        if (error.error_fix == ErrorFix::DUPLICATE_VALUES) {
+            BOOST_LOG_TRIVIAL(debug) << "Line " << error.line << ": Fixing duplicate INFO fields";
+            remove_duplicate_key_value_pairs(info_column, ";", "=", empty_info_column);
+        } else if (error.error_fix == ErrorFix::RECOVERABLE_VALUE) {
+            BOOST_LOG_TRIVIAL(debug) << "Line " << error.line << ": Fixing invalid INFO field " << error.field;
+            replace_fields(info_column, ";", error.field + "=" + error.expected_value, condition_to_modify_info_field);
+        } else if (error.error_fix == ErrorFix::IRRECOVERABLE_VALUE) {
+            BOOST_LOG_TRIVIAL(debug) << "Line " << error.line << ": Removing invalid INFO field " << error.field;
+            remove_fields(info_column, ";", empty_info_column, condition_to_modify_info_field);
+        }
     }
 
     void Fixer::visit(FormatBodyError &error)
     {
         if (error.error_fix == ErrorFix::DUPLICATE_VALUES) {
             BOOST_LOG_TRIVIAL(debug) << "Line " << error.line << ": Fixing duplicate FORMAT fields";
-            std::string string_line = {line->begin(), line->end()};
-            remove_duplicate_format_sample_pairs(string_line);
+            const size_t format_column_index = 8;
+            auto range = columns_to_fix(format_column_index, -1);
+            remove_duplicate_format_sample_pairs(range.first, range.second);
         } else {
             ignore_error();
         }
@@ -200,31 +258,28 @@ namespace ebi
 
         const size_t format_column_index = 8;
         // size_t first_samples_column_index = 9;
-        std::string string_line = {line->begin(), line->end()};
 
-        size_t fixed_samples;
         std::string message;
+        std::pair<std::vector<std::string>::iterator, std::vector<std::string>::iterator> range;
         try {
-            using iter = std::vector<std::string>::iterator;
-            fixed_samples = fix_columns(format_column_index, -1, string_line, "\t", [&](iter first, iter last) {
-                if (error.field == GT) {
-                    fix_format_gt(first, last, error);
-                } else {
-                    remove_format(first, last, error);
-                }
-            });
+            range = columns_to_fix(format_column_index, -1);
         } catch (std::out_of_range bad_range) {
             // there were not enough columns. maybe an aggregate vcf without genotypes?
-            fixed_samples = 0;
             message = bad_range.what();
         }
 
-        if (fixed_samples <= 1) {   // 1 because we started counting since the FORMAT column
+        if (message.size() > 0 || range.second - range.first <= 1) {   // 1 because we started counting since the FORMAT column
             BOOST_LOG_TRIVIAL(warning) << "Line " << error.line << ": Tried to fix field " << error.field
                                        << " in the samples column, but sample columns are not present. " << message;
             ignore_error();
             return;
         }
+
+        if (error.field == GT) {
+            fix_format_gt(range.first, range.second, error);
+        } else {
+            remove_format(range.first, range.second, error);
+        }
     }
 
     void Fixer::visit(NormalizationError &error)
@@ -234,11 +289,13 @@ namespace ebi
 
     void Fixer::visit(DuplicationError &error)
     {
+        std::string string_line = current_line();
         BOOST_LOG_TRIVIAL(debug) << "Line " << line_number << ": Fixing duplicate: removing variant: "
-                                 << std::string{line->begin(), line->end()-1};
+                                 << string_line.substr(0, string_line.size() - 1);
+        removed = true;
     }
 
-    size_t Fixer::remove_duplicate_strings(const std::string &column,
+    size_t Fixer::remove_duplicate_strings(std::string &column,
                                            const std::string &separator)
     {
         std::set<std::string> already_present;
@@ -249,7 +306,7 @@ namespace ebi
         return remove_fields(column, separator, is_value_duplicated);
     }
 
-    size_t Fixer::remove_duplicate_key_value_pairs(const std::string &column,
+    size_t Fixer::remove_duplicate_key_value_pairs(std::string &column,
                                                    const std::string &separator,
                                                    const std::string &key_value_separator,
                                                    const std::string &empty_value)
@@ -261,9 +318,9 @@ namespace ebi
         std::vector<std::string> fields;
         util::string_split(column, separator.c_str(), fields);
 
+        std::vector<std::string> subfields;
         for (auto & field : fields) {
-            std::vector<std::string> subfields;
-            util::string_split(field, key_value_separator.c_str(), subfields);
+            util::string_split_into(field, key_value_separator.c_str(), subfields);
             auto first_key_iterator = first_key_occurrence.find(subfields[0]);
             if (first_key_iterator == first_key_occurrence.end()) {
                 ordered_keys.push_back(subfields[0]);
@@ -285,74 +342,71 @@ namespace ebi
         }
 
         if (fixed_column.size() == 0) {       // all the fields were removed
-            output << empty_value;
+            column = empty_value;
         } else {
-            util::print_container(output, fixed_column, "", separator, "");
+            column = join(fixed_column, separator);
         }
 
         return num_removed_duplicates;
     }
 
-    size_t Fixer::remove_duplicate_format_sample_pairs(const std::string &string_line) {
-        const size_t format_column_index = 8;
+    size_t Fixer::remove_duplicate_format_sample_pairs(std::vector<std::string>::iterator first,
+                                                       std::vector<std::string>::iterator last)
+    {
         size_t num_removed_duplicates = 0;
-
-        using iter = std::vector<std::string>::iterator;
-        fix_columns(format_column_index, -1, string_line, "\t", [&](iter first, iter last) {
-            std::map<std::string, std::vector<size_t>> format_fields_indexes;
-            std::vector<std::string> ordered_fields;
-            std::vector<std::string> format_keys;
-            util::string_split(*first, ":", format_keys);
-
-            for (size_t i = 0; i < format_keys.size(); i++) {
-                format_fields_indexes[format_keys[i]].push_back(i);
-                if (format_fields_indexes[format_keys[i]].size() == 1) {
-                    ordered_fields.push_back(format_keys[i]);
-                }
+        std::map<std::string, std::vector<size_t>> format_fields_indexes;
+        std::vector<std::string> ordered_fields;
+        std::vector<std::string> format_keys;
+        util::string_split(*first, ":", format_keys);
+
+        for (size_t i = 0; i < format_keys.size(); i++) {
+            format_fields_indexes[format_keys[i]].push_back(i);
+            if (format_fields_indexes[format_keys[i]].size() == 1) {
+                ordered_fields.push_back(format_keys[i]);
             }
+        }
+
+        std::vector<std::vector<std::string>> samples;
+        for (auto it = first + 1; it != last; it++) {
+            samples.emplace_back();
+            util::string_split(*it, ":", samples.back());
+        }
+
+        std::set<std::string> fields_to_remove = get_format_fields_to_remove(format_fields_indexes, samples);
 
-            std::vector<std::vector<std::string>> samples;
-            for (auto it = first + 1; it != last; it++) {
-                std::vector<std::string> sample_fields;
-                util::string_split(*it, ":", sample_fields);
-                samples.push_back(sample_fields);
+        std::vector<std::string> fixed_format;
+        for (auto & ordered_field : ordered_fields) {
+            if (fields_to_remove.find(ordered_field) == fields_to_remove.end()) {
+                // keep first occurrence, discard the rest if present
+                fixed_format.push_back(ordered_field);
+            } else {
+                num_removed_duplicates++;
             }
+        }
 
-            std::set<std::string> fields_to_remove = get_format_fields_to_remove(format_fields_indexes, samples);
+        if (fixed_format.empty()) {
+            throw std::runtime_error("Could not fix FORMAT duplicate fields: All fields had to be removed, but missing value is not permitted");
+        }
+        *first = join(fixed_format, ":");
 
-            std::vector<std::string> fixed_format;
+        auto sample_column = first + 1;
+        for (auto & sample : samples) {
+            std::vector<std::string> fixed_sample;
             for (auto & ordered_field : ordered_fields) {
                 if (fields_to_remove.find(ordered_field) == fields_to_remove.end()) {
                     // keep first occurrence, discard the rest if present
-                    fixed_format.push_back(ordered_field);
-                } else {
-                    num_removed_duplicates++;
-                }
-            }
-
-            if (fixed_format.empty()) {
-                throw std::runtime_error("Could not fix FORMAT duplicate fields: All fields had to be removed, but missing value is not permitted");
-            }
-            util::print_container(output, fixed_format, "", ":","");
-
-            for (auto sample : samples) {
-                std::vector<std::string> fixed_sample;
-                for (auto & ordered_field : ordered_fields) {
-                    if (fields_to_remove.find(ordered_field) == fields_to_remove.end()) {
-                        // keep first occurrence, discard the rest if present
-                        if (sample.size() > format_fields_indexes[ordered_field][0]) {
-                            fixed_sample.push_back(sample[format_fields_indexes[ordered_field][0]]);
-                        }
+                    if (sample.size() > format_fields_indexes[ordered_field][0]) {
+                        fixed_sample.push_back(sample[format_fields_indexes[ordered_field][0]]);
                     }
                 }
-                output << "\t";
-                if (fixed_sample.empty()) {
-                    output << MISSING_VALUE;         // all the sample fields were removed, so write missing value to output
-                } else {
-                    util::print_container(output, fixed_sample, "", ":", "");
-                }
             }
-        });
+            if (fixed_sample.empty()) {
+                *sample_column = MISSING_VALUE;         // all the sample fields were removed, so write missing value
+            } else {
+                *sample_column = join(fixed_sample, ":");
+            }
+            ++sample_column;
+        }
 
         return num_removed_duplicates;
     }
@@ -395,23 +449,19 @@ namespace ebi
             BOOST_LOG_TRIVIAL(warning) << "Line " << error.line << ": Tried to fix field \"" << error.field
                                        << "\" but it was not present in the FORMAT column \"" << *first << "\"";
             ignored_errors++;
-            util::print_container(output, std::vector<std::string>{first, last}, "", "\t", "");
             return;
         }
 
-        // write the FORMAT column
-        output << *first;
-
         // `cardinality` should be -1 if the cardinality is unknown, and any positive number otherwise
         // so, if unknown, put 1, so that a single "." is written
         size_t repeat = error.field_cardinality <= -1 ? 1 : static_cast<size_t>(error.field_cardinality);
+        std::string missing_genotype = join(std::vector<std::string>(repeat, std::string(1, empty_subfield)),
+                                            subfield_separator);
 
         // now `it` will point to each SAMPLE column
         for (auto it = ++first; it != last; ++it) {
-            output << "\t";
-            fix_column(gt_column_index, *it, field_separator, [&](std::string wrong_subfield) {
-                util::print_container(output, std::string(repeat, empty_subfield), "", subfield_separator, "");
-            });
+            size_t gt_end = std::min(it->find(field_separator), it->size());
+            it->replace(0, gt_end, missing_genotype);
         }
     }
 
@@ -434,13 +484,11 @@ namespace ebi
             BOOST_LOG_TRIVIAL(warning) << "Line " << error.line << ": Tried to fix field \"" << error.field
                                        << "\" but it was not present in the FORMAT column \"" << *first << "\"";
             ignored_errors++;
-            util::print_container(output, std::vector<std::string>{++first, last}, "\t", "\t", "");
             return;
         }
 
         // remove from the samples columns
         for (++first; first != last; ++first) {
-            output << "\t";
             removed = remove_fields(*first, field_separator, [&](const std::string &field, size_t index) {
                 return index == field_index;
             });
@@ -448,52 +496,38 @@ namespace ebi
                 BOOST_LOG_TRIVIAL(warning) << "Tried to remove field with index " << field_index << " in \"" << *first
                                            << "\" but couldn't do it, this is likely to happen in all samples";
                 ignored_errors++;
-                // copy the rest of samples, as we already copied one and don't want to repeat the log for everyone
-                util::print_container(output, std::vector<std::string>{++first, last}, "\t", "\t", "");
+                // keep the rest of samples, as we don't want to repeat the log for everyone
                 return;
             }
         }
     }
 
-    size_t Fixer::remove_fields(const std::string &line,
+    size_t Fixer::remove_fields(std::string &line,
                                 const std::string &separators,
                                 std::function<bool(const std::string &column, size_t index)> condition_to_remove)
     {
         return remove_fields(line, separators, "", condition_to_remove);
     }
 
-    size_t Fixer::remove_fields(const std::string &line,
+    size_t Fixer::remove_fields(std::string &line,
                                 const std::string &separators,
                                 const std::string &empty_column,
                                 std::function<bool(const std::string &column, size_t index)> condition_to_remove)
     {
         std::vector<std::string> columns;
         util::string_split(line, separators.c_str(), columns);
-        size_t written = 0;
 
-        if (columns.size() > 0) {
-            size_t j = 0;
+        std::vector<std::string> kept;
+        for (size_t j = 0; j < columns.size(); ++j) {
             if (not condition_to_remove(columns[j], j)) {
-                written++;
-                output << columns[j];
-            }
-            for (j = 1; j < columns.size(); ++j) {
-                if (not condition_to_remove(columns[j], j)) {
-                    if (written > 0) {
-                        output << separators;
-                    }
-                    written++;
-                    output << columns[j];
-                }
+                kept.push_back(std::move(columns[j]));
             }
         }
-        if (written == 0) {
-            output << empty_column;
-        }
-        return columns.size() - written;
+        line = kept.empty() ? empty_column : join(kept, separators);
+        return columns.size() - kept.size();
     }
 
-    size_t Fixer::replace_fields(const std::string &line,
+    size_t Fixer::replace_fields(std::string &line,
                                  const std::string &separators,
                                  const std::string &expected_field,
                                  std::function<bool(const std::string &column, size_t index)> condition_to_replace)
@@ -505,14 +539,10 @@ namespace ebi
         for (size_t j = 0; j < columns.size(); ++j) {
             if (condition_to_replace(columns[j], j)) {
                 num_replaced_columns++;
-                output << expected_field;
-            } else {
-                output << columns[j];
-            }
-            if (j < columns.size() - 1) {
-                output << separators;
+                columns[j] = expected_field;
             }
         }
+        line = join(columns, separators);
 
         return num_replaced_columns;
     }
@@ -525,45 +555,12 @@ namespace ebi
         return found == columns.end()? line.npos : found - columns.begin();
     }
 
-    size_t Fixer::fix_column(size_t column_index,
-                             const std::string &line,
-                             const std::string &separator,
-                             std::function<void(std::string &column)> fix_function)
-    {
-        using iter = std::vector<std::string>::iterator;
-        return fix_columns(column_index, column_index + 1, line, separator, [fix_function](iter first, iter last) {
-            for (auto it = first; it != last; ++it) {
-                fix_function(*it);
-            }
-        });
-    }
-
-    size_t Fixer::fix_foreach_column(size_t column_index,
-                                     long column_index_last,
-                                     const std::string &line,
-                                     const std::string &separator,
-                                     std::function<void(std::string &column)> fix_function)
-    {
-        using iter = std::vector<std::string>::iterator;
-        return fix_columns(column_index, column_index_last, line, separator, [fix_function](iter first, iter last) {
-            fix_function(*first);
-        });
-    }
-
-    size_t Fixer::fix_columns(size_t column_index,
-                              long column_index_last,
-                              const std::string &line,
-                              const std::string &separator,
-                              std::function<void(std::vector<std::string>::iterator begin,
-                                                 std::vector<std::string>::iterator end)> fix_function)
+    std::pair<std::vector<std::string>::iterator, std::vector<std::string>::iterator>
+    Fixer::columns_to_fix(size_t column_index, long column_index_last)
     {
-        std::vector<std::string> columns;
-        util::string_split(line, separator.c_str(), columns);
-
-        //remove (and add it later) the newline so that the `fix_function` doesn't have to deal with it.
-        std::string eol = util::remove_end_of_line(columns.back());
+        std::vector<std::string> & columns = line_columns();
 
-        // check ranges. don't allow an empty range, the fix_function should be called at least once
+        // check ranges. don't allow an empty range, the fix should modify at least one column
         size_t column_index_last_unsigned;
         if (column_index_last < 0) {
             column_index_last_unsigned = columns.size();
@@ -572,32 +569,19 @@ namespace ebi
         }
 
         if (column_index >= columns.size()) {
-            std::string message{"fix_columns requires a non-empty range: asked to fix columns["};
+            std::string message{"columns_to_fix requires a non-empty range: asked to fix columns["};
             message += std::to_string(column_index) + "] (0-based index) but there are only "
-                    + std::to_string(columns.size()) + " columns: \"" + line + "\"";
+                    + std::to_string(columns.size()) + " columns: \"" + current_line() + "\"";
             throw std::out_of_range{message};
         }
         if (column_index_last_unsigned > columns.size()) {
-            std::string message{"fix_columns: asked to fix until past-the end, until (non-including) columns["};
+            std::string message{"columns_to_fix: asked to fix until past-the end, until (non-including) columns["};
             message += std::to_string(column_index_last_unsigned) + "] (0-based index) but there are only "
-                    + std::to_string(columns.size()) + " columns: \"" + line + "\"";
+                    + std::to_string(columns.size()) + " columns: \"" + current_line() + "\"";
             throw std::out_of_range{message};
         }
 
-        // write before, call fix_function, write after
-        for (size_t i = 0; i < column_index; ++i) {
-            output << columns[i] << separator;
-        }
-
-        fix_function(columns.begin() + column_index, columns.begin() + column_index_last_unsigned);
-
-        for (size_t i = column_index_last_unsigned; i < columns.size(); ++i) {
-            output << separator << columns[i];
-        }
-
-        output << eol;
-
-        return column_index_last_unsigned - column_index;
+        return {columns.begin() + column_index, columns.begin() + column_index_last_unsigned};
     }
   }
 }
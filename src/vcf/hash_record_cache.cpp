@@ -0,0 +1,451 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <tuple>
+
+#include "util/stream_utils.hpp"
+#include "vcf/allocation_stats.hpp"
+#include "vcf/hash_record_cache.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+
+    size_t const HashRecordCache::default_capacity;
+
+    namespace
+    {
+      uint64_t combine(uint64_t seed, uint64_t value)
+      {
+          return seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+      }
+
+      /**
+       * FNV-1a of a range of characters, so the trimmed alleles can be hashed where they are
+       */
+      uint64_t hash_chars(char const * chars, size_t length)
+      {
+          uint64_t hash = 0xcbf29ce484222325ULL;
+          for (size_t i = 0; i < length; ++i) {
+              hash = (hash ^ static_cast<unsigned char>(chars[i])) * 0x100000001b3ULL;
+          }
+          return hash;
+      }
+
+      void add_duplication_errors(std::vector<std::unique_ptr<Error>> & duplicates, RecordCore const & record_core,
+                                  size_t matches, size_t first_occurence_line)
+      {
+          std::string message = "Duplicated variant " + record_core.chromosome + ":"
+                                + std::to_string(record_core.position) + ":" + record_core.reference_allele
+                                + ">" + record_core.alternate_allele + " found";
+
+          std::string duplicate_variant_lines = "It occurs in lines " + std::to_string(first_occurence_line)
+                                                + " and " + std::to_string(record_core.line);
+
+          if (matches == 1) {
+              // if only one match, return an extra error for the first occurrence
+              duplicates.emplace_back(new DuplicationError{first_occurence_line, message});
+          }
+
+          duplicates.emplace_back(new DuplicationError{record_core.line, message, duplicate_variant_lines});
+      }
+    }
+
+    HashRecordCache::HashRecordCache(size_t capacity)
+    : capacity{capacity}, unlimited{capacity == 0}, first_sequence{0}, blocks_contig{unknown_contig},
+      blocks_position{0}
+    {
+    }
+
+    HashRecordCache::HashRecordCache(HashRecordCache const & other)
+    : capacity{other.capacity}, unlimited{other.unlimited}, entries{other.entries},
+      first_sequence{other.first_sequence}, sequences_by_hash{other.sequences_by_hash},
+      smallest{other.smallest ? new RecordCore{*other.smallest} : nullptr}, spilled{other.spilled},
+      filter{other.filter}, blocks{other.blocks}, blocks_chromosome{other.blocks_chromosome},
+      blocks_contig{other.blocks_contig}, blocks_position{other.blocks_position}
+    {
+    }
+
+    HashRecordCache & HashRecordCache::operator=(HashRecordCache const & other)
+    {
+        capacity = other.capacity;
+        unlimited = other.unlimited;
+        entries = other.entries;
+        first_sequence = other.first_sequence;
+        sequences_by_hash = other.sequences_by_hash;
+        smallest.reset(other.smallest ? new RecordCore{*other.smallest} : nullptr);
+        spilled = other.spilled;
+        filter = other.filter;
+        blocks = other.blocks;
+        blocks_chromosome = other.blocks_chromosome;
+        blocks_contig = other.blocks_contig;
+        blocks_position = other.blocks_position;
+        return *this;
+    }
+
+    std::vector<std::unique_ptr<Error>> HashRecordCache::check_duplicates(const Record &record)
+    {
+        AllocationScope allocation_scope{AllocationStage::record_cache};
+        if (record.is_reference_block()) {
+            if (record.source != nullptr) {
+                record.source->input_format |= InputFormat::VCF_FILE_GVCF;
+            }
+            bool unsorted = same_block_contig(record) && record.position < blocks_position;
+            if (!spilled && !filter && !unsorted) {
+                return check_reference_block(record);
+            }
+        }
+
+        normalize_alleles(record, alleles);
+        std::vector<std::unique_ptr<Error>> duplicates{};
+        if (spilled) {
+            spilled->add(record, alleles);
+            return duplicates;
+        }
+
+        for (NormalizedAllele &allele : alleles) {
+            uint64_t hash = hash_of(record, allele);
+            size_t first_occurence_line = 0;
+            size_t matches = count_matches(record, allele, hash, first_occurence_line);
+
+            RecordCore record_core = make_record_core(record, allele);
+            if (matches != 0) {
+                add_duplication_errors(duplicates, record_core, matches, first_occurence_line);
+            } else if (filter) {
+                filter->check(record_core, hash);
+            }
+
+            if (!smallest || record_core < *smallest) {
+                smallest.reset(new RecordCore{record_core});
+            }
+            insert(hash, std::move(record_core));
+        }
+
+        // like RecordCache, all the variants of a record are compared with the same entries, and the smallest ones
+        // are forgotten first: the order of a sorted input
+        sort_newest(alleles.size());
+        shrink_to_fit();
+        return duplicates;
+    }
+
+    std::vector<std::unique_ptr<Error>> HashRecordCache::check_reference_block(Record const & record)
+    {
+        std::string const & reference = record.reference_allele;
+        std::string const & alternate = record.alternate_alleles[0];
+
+        // a symbolic allele shares no bases with the reference, so normalizing would leave the block as it is
+        NormalizedAllele allele{record.position, 0, 0, reference.size(), 0, alternate.size()};
+        if (!same_block_contig(record) || record.position != blocks_position) {
+            blocks.clear();
+            blocks_chromosome = record.chromosome;
+            blocks_contig = record.contig;
+            blocks_position = record.position;
+        }
+
+        std::vector<std::unique_ptr<Error>> duplicates{};
+        size_t first_occurence_line = 0;
+        size_t matches = count_matches(record, allele, hash_of(record, allele), first_occurence_line);
+        if (matches != 0) {
+            add_duplication_errors(duplicates, make_record_core(record, allele), matches, first_occurence_line);
+        }
+
+        if (!smallest || std::tie(record.chromosome, record.position, reference, alternate)
+                         < std::tie(smallest->chromosome, smallest->position, smallest->reference_allele,
+                                    smallest->alternate_allele)) {
+            smallest.reset(new RecordCore{make_record_core(record, allele)});
+        }
+        blocks.push_back(ReferenceBlock{record.line, reference, alternate});
+        return duplicates;
+    }
+
+    size_t HashRecordCache::count_matches(Record const & record, NormalizedAllele const & allele, uint64_t hash,
+                                          size_t & first_line) const
+    {
+        // the hash may collide, so the variants are compared in full
+        size_t matches = 0;
+        auto range = sequences_by_hash.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it) {
+            RecordCore const & held = entry(it->second).record_core;
+            if (same_variant(held, record, allele)) {
+                first_line = matches == 0 ? held.line : std::min(first_line, held.line);
+                ++matches;
+            }
+        }
+
+        if (same_block_contig(record) && allele.position == blocks_position) {
+            std::string const & alternate = record.alternate_alleles[allele.alternate_index];
+            for (auto & block : blocks) {
+                if (block.reference_allele.compare(0, std::string::npos, record.reference_allele,
+                                                   allele.reference_begin, allele.reference_length) == 0
+                        && block.alternate_allele.compare(0, std::string::npos, alternate,
+                                                          allele.alternate_begin, allele.alternate_length) == 0) {
+                    first_line = matches == 0 ? block.line : std::min(first_line, block.line);
+                    ++matches;
+                }
+            }
+        }
+        return matches;
+    }
+
+    bool HashRecordCache::same_block_contig(Record const & record) const
+    {
+        if (blocks.empty()) {
+            return false;
+        }
+        return record.contig != unknown_contig && blocks_contig != unknown_contig ?
+               record.contig == blocks_contig : record.chromosome == blocks_chromosome;
+    }
+
+    std::vector<RecordCore> HashRecordCache::block_cores() const
+    {
+        std::vector<RecordCore> cores;
+        for (auto & block : blocks) {
+            cores.emplace_back(block.line, blocks_chromosome, blocks_position, block.reference_allele,
+                               block.alternate_allele, blocks_contig);
+        }
+        return cores;
+    }
+
+    void HashRecordCache::spill_to(std::shared_ptr<ExternalRecordCache> runs)
+    {
+        spilled = std::move(runs);
+    }
+
+    void HashRecordCache::filter_forgotten(std::shared_ptr<DuplicateFilter> filter)
+    {
+        this->filter = std::move(filter);
+    }
+
+    bool HashRecordCache::empty() const
+    {
+        return !smallest;
+    }
+
+    size_t HashRecordCache::allocated_bytes() const
+    {
+        if (spilled) {
+            return spilled->allocated_bytes();
+        }
+
+        // each entry is also a node of sequences_by_hash, with its key, value and links
+        size_t const node_size = 2 * sizeof(uint64_t) + 2 * sizeof(void *);
+        return entries.size() * (sizeof(Entry) + node_size) + blocks.capacity() * sizeof(ReferenceBlock)
+               + (filter ? filter->allocated_bytes() : 0);
+    }
+
+    size_t HashRecordCache::first_line() const
+    {
+        if (spilled) {
+            return spilled->first_line();
+        }
+        size_t line = filter ? filter->first_line() : std::numeric_limits<size_t>::max();
+        for (auto & held : entries) {
+            line = std::min(line, held.record_core.line);
+        }
+        for (auto & block : blocks) {
+            line = std::min(line, block.line);
+        }
+        return line;
+    }
+
+    bool HashRecordCache::precedes(HashRecordCache const & later) const
+    {
+        if ((entries.empty() && blocks.empty()) || later.empty()) {
+            return true;
+        }
+        std::vector<RecordCore> held_blocks = block_cores();
+        RecordCore const * largest = entries.empty() ? &held_blocks.front() : &entries.front().record_core;
+        for (auto & held : entries) {
+            if (*largest < held.record_core) {
+                largest = &held.record_core;
+            }
+        }
+        for (auto & held : held_blocks) {
+            if (*largest < held) {
+                largest = &held;
+            }
+        }
+        return *largest < *later.smallest;
+    }
+
+    void HashRecordCache::append(HashRecordCache const & later)
+    {
+        for (auto & held : later.entries) {
+            insert(held.hash, held.record_core);
+        }
+        if (!later.blocks.empty()) {
+            bool same_start = !blocks.empty() && blocks_position == later.blocks_position
+                              && blocks_chromosome == later.blocks_chromosome;
+            if (!same_start) {
+                blocks.clear();
+                blocks_chromosome = later.blocks_chromosome;
+                blocks_contig = later.blocks_contig;
+                blocks_position = later.blocks_position;
+            }
+            blocks.insert(blocks.end(), later.blocks.begin(), later.blocks.end());
+        }
+        if (!smallest || (later.smallest && *later.smallest < *smallest)) {
+            smallest.reset(later.smallest ? new RecordCore{*later.smallest} : nullptr);
+        }
+        shrink_to_fit();
+    }
+
+    namespace
+    {
+      void write_record_core(std::ostream & output, RecordCore const & record_core)
+      {
+          util::write_number(output, record_core.line);
+          util::write_string(output, record_core.chromosome);
+          util::write_number(output, record_core.contig != unknown_contig);
+          util::write_number(output, record_core.position);
+          util::write_string(output, record_core.reference_allele);
+          util::write_string(output, record_core.alternate_allele);
+      }
+
+      /**
+       * Reads a RecordCore written by write_record_core, interning its contig again if it was
+       */
+      RecordCore read_record_core(std::istream & input)
+      {
+          size_t line = util::read_number(input);
+          std::string chromosome = util::read_string(input);
+          ContigId contig = util::read_number(input) != 0 ? intern_contig(chromosome) : unknown_contig;
+          size_t position = util::read_number(input);
+          std::string reference_allele = util::read_string(input);
+          return RecordCore{line, chromosome, position, reference_allele, util::read_string(input), contig};
+      }
+    }
+
+    void HashRecordCache::save(std::ostream & output) const
+    {
+        util::write_number(output, unlimited ? 0 : capacity);
+        util::write_number(output, entries.size());
+        for (auto & held : entries) {
+            write_record_core(output, held.record_core);
+        }
+        util::write_number(output, smallest != nullptr);
+        if (smallest) {
+            write_record_core(output, *smallest);
+        }
+        util::write_number(output, blocks.size());
+        for (auto & block : block_cores()) {
+            write_record_core(output, block);
+        }
+    }
+
+    void HashRecordCache::load(std::istream & input)
+    {
+        *this = HashRecordCache{util::read_number(input)};
+        for (size_t count = util::read_number(input); count != 0; --count) {
+            RecordCore record_core = read_record_core(input);
+            uint64_t hash = hash_of(record_core.contig, record_core.chromosome, record_core.position,
+                                    record_core.reference_allele.data(), record_core.reference_allele.size(),
+                                    record_core.alternate_allele.data(), record_core.alternate_allele.size());
+            insert(hash, std::move(record_core));
+        }
+        if (util::read_number(input) != 0) {
+            smallest.reset(new RecordCore{read_record_core(input)});
+        }
+        for (size_t count = util::read_number(input); count != 0; --count) {
+            RecordCore block = read_record_core(input);
+            blocks_chromosome = block.chromosome;
+            blocks_contig = block.contig;
+            blocks_position = block.position;
+            blocks.push_back(ReferenceBlock{block.line, block.reference_allele, block.alternate_allele});
+        }
+    }
+
+    uint64_t HashRecordCache::hash_of(Record const & record, NormalizedAllele const & allele)
+    {
+        std::string const & alternate = record.alternate_alleles[allele.alternate_index];
+        return hash_of(record.contig, record.chromosome, allele.position,
+                       record.reference_allele.data() + allele.reference_begin, allele.reference_length,
+                       alternate.data() + allele.alternate_begin, allele.alternate_length);
+    }
+
+    uint64_t HashRecordCache::hash_of(ContigId contig, std::string const & chromosome, size_t position,
+                                      char const * reference, size_t reference_length,
+                                      char const * alternate, size_t alternate_length)
+    {
+        uint64_t hash = contig != unknown_contig ? contig : hash_chars(chromosome.data(), chromosome.size());
+        hash = combine(hash, position);
+        hash = combine(hash, hash_chars(reference, reference_length));
+        return combine(hash, hash_chars(alternate, alternate_length));
+    }
+
+    HashRecordCache::Entry const & HashRecordCache::entry(uint64_t sequence) const
+    {
+        return entries[sequence - first_sequence];
+    }
+
+    void HashRecordCache::insert(uint64_t hash, RecordCore record_core)
+    {
+        sequences_by_hash.emplace(hash, first_sequence + entries.size());
+        entries.push_back(Entry{hash, std::move(record_core)});
+    }
+
+    void HashRecordCache::sort_newest(size_t count)
+    {
+        if (count < 2) {
+            return;
+        }
+        uint64_t first_newest = first_sequence + entries.size() - count;
+        for (uint64_t sequence = first_newest; sequence < first_newest + count; ++sequence) {
+            auto range = sequences_by_hash.equal_range(entry(sequence).hash);
+            for (auto it = range.first; it != range.second; ++it) {
+                if (it->second == sequence) {
+                    sequences_by_hash.erase(it);
+                    break;
+                }
+            }
+        }
+
+        auto newest = entries.end() - static_cast<std::ptrdiff_t>(count);
+        std::stable_sort(newest, entries.end(), [](Entry const & a, Entry const & b) {
+            return a.record_core < b.record_core;
+        });
+        for (uint64_t sequence = first_newest; sequence < first_newest + count; ++sequence) {
+            sequences_by_hash.emplace(entry(sequence).hash, sequence);
+        }
+    }
+
+    void HashRecordCache::shrink_to_fit()
+    {
+        if (unlimited) {
+            return;
+        }
+        while (entries.size() > capacity) {
+            auto range = sequences_by_hash.equal_range(entries.front().hash);
+            for (auto it = range.first; it != range.second; ++it) {
+                if (it->second == first_sequence) {
+                    sequences_by_hash.erase(it);
+                    break;
+                }
+            }
+            if (filter) {
+                filter->forget(entries.front().record_core, entries.front().hash);
+            }
+            entries.pop_front();
+            ++first_sequence;
+        }
+    }
+  }
+}
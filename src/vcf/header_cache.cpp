@@ -0,0 +1,128 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+
+#include "vcf/header_cache.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    size_t const HeaderCache::default_capacity;
+
+    void CachedHeader::report(std::vector<std::unique_ptr<ReportWriter>> & outputs) const
+    {
+        if (warnings.empty()) {
+            return;
+        }
+
+        // the outputs may keep or modify what they are given, and other jobs report the same warnings
+        std::vector<std::unique_ptr<Error>> copies;
+        std::vector<ReportedError> batch;
+        copies.reserve(warnings.size());
+        batch.reserve(warnings.size());
+        for (auto & warning : warnings) {
+            copies.emplace_back(warning->clone());
+            batch.push_back(ReportedError{Severity::WARNING, copies.back().get()});
+        }
+        for (auto & output : outputs) {
+            output->write_batch(batch);
+        }
+    }
+
+    HeaderCache::HeaderCache(size_t capacity)
+    : capacity{std::max(capacity, size_t{1})}, n_hits{0}, n_misses{0}
+    {
+    }
+
+    uint64_t HeaderCache::digest(char const * begin, char const * end)
+    {
+        uint64_t hash = 0xcbf29ce484222325ULL;
+        for (char const * p = begin; p != end; ++p) {
+            hash = (hash ^ static_cast<unsigned char>(*p)) * 0x100000001b3ULL;
+        }
+        return hash;
+    }
+
+    std::shared_ptr<CachedHeader const> HeaderCache::find(char const * begin, char const * end,
+                                                          ValidationLevel level, bool profiled)
+    {
+        uint64_t hash = digest(begin, end);
+        std::lock_guard<std::mutex> lock{mutex};
+        std::shared_ptr<CachedHeader const> header = find_locked(hash, begin, end, level, profiled);
+        ++(header ? n_hits : n_misses);
+        return header;
+    }
+
+    void HeaderCache::add(std::shared_ptr<CachedHeader const> header)
+    {
+        char const * begin = header->text.data();
+        char const * end = begin + header->text.size();
+        uint64_t hash = digest(begin, end);
+        std::lock_guard<std::mutex> lock{mutex};
+        if (find_locked(hash, begin, end, header->level, header->profiled)) {
+            return;
+        }
+
+        if (added.size() == capacity) {
+            auto oldest = headers.equal_range(added.front().first);
+            for (auto it = oldest.first; it != oldest.second; ++it) {
+                if (it->second.get() == added.front().second) {
+                    headers.erase(it);
+                    break;
+                }
+            }
+            added.pop_front();
+        }
+        added.emplace_back(hash, header.get());
+        headers.emplace(hash, std::move(header));
+    }
+
+    size_t HeaderCache::size() const
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        return headers.size();
+    }
+
+    size_t HeaderCache::hits() const
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        return n_hits;
+    }
+
+    size_t HeaderCache::misses() const
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        return n_misses;
+    }
+
+    std::shared_ptr<CachedHeader const> HeaderCache::find_locked(uint64_t hash, char const * begin, char const * end,
+                                                                 ValidationLevel level, bool profiled) const
+    {
+        size_t size = static_cast<size_t>(end - begin);
+        auto candidates = headers.equal_range(hash);
+        for (auto it = candidates.first; it != candidates.second; ++it) {
+            CachedHeader const & header = *it->second;
+            if (header.level == level && header.profiled == profiled && header.text.size() == size
+                    && std::equal(begin, end, header.text.begin())) {
+                return it->second;
+            }
+        }
+        return nullptr;
+    }
+  }
+}
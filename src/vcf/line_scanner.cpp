@@ -0,0 +1,310 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstdint>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "vcf/line_scanner.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+
+    namespace
+    {
+      enum CharClass : uint8_t
+      {
+          alnum_chars = 1,
+          alpha_chars = 2,
+          digit_chars = 4,
+          base_chars = 8,
+          chromosome_chars = 16,    /**< Alphanumeric, '_', '.' and '-' */
+          info_key_chars = 32,      /**< Letters, digits, '_' and '.' */
+          text_chars = 64,          /**< Printable but space and ';', like IDs, filters and INFO values */
+          graph_chars = 128,        /**< Printable but space */
+      };
+
+      struct CharClasses
+      {
+          uint8_t classes[256];
+
+          CharClasses() : classes{}
+          {
+              for (int c = 0x21; c < 0x7f; ++c) {
+                  bool digit = c >= '0' && c <= '9';
+                  bool alpha = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+                  classes[c] |= graph_chars;
+                  classes[c] |= c != ';' ? text_chars : 0;
+                  classes[c] |= alpha ? alpha_chars : 0;
+                  classes[c] |= digit ? digit_chars : 0;
+                  classes[c] |= alpha || digit ? alnum_chars : 0;
+                  classes[c] |= alpha || digit || c == '_' || c == '.' || c == '-' ? chromosome_chars : 0;
+                  classes[c] |= alpha || digit || c == '_' || c == '.' ? info_key_chars : 0;
+              }
+              for (char c : {'A', 'C', 'G', 'T', 'N', 'a', 'c', 'g', 't', 'n'}) {
+                  classes[static_cast<unsigned char>(c)] |= base_chars;
+              }
+          }
+      };
+
+      CharClasses const char_classes;
+
+      inline bool is(char c, uint8_t chars)
+      {
+          return (char_classes.classes[static_cast<unsigned char>(c)] & chars) != 0;
+      }
+
+      /**
+       * Skips a run of characters of a class, and tells whether it wasn't empty
+       */
+      inline bool skip_run(char const * & p, char const * end, uint8_t chars)
+      {
+          char const * begin = p;
+          while (p != end && is(*p, chars)) {
+              ++p;
+          }
+          return p != begin;
+      }
+
+      inline bool skip_char(char const * & p, char const * end, char c)
+      {
+          if (p == end || *p != c) {
+              return false;
+          }
+          ++p;
+          return true;
+      }
+
+      /**
+       * Skips a column with a single dot
+       */
+      inline bool skip_missing(char const * & p, char const * end)
+      {
+          if (end - p < 2 || p[0] != '.' || (p[1] != '\t' && p[1] != '\n' && p[1] != '\r')) {
+              return false;
+          }
+          ++p;
+          return true;
+      }
+
+      /**
+       * Skips a run of text with at least one alphanumeric character, other than `excluded`
+       */
+      inline bool skip_identifier(char const * & p, char const * end, uint8_t chars, char const * excluded)
+      {
+          bool alnum = false;
+          for (; p != end && is(*p, chars); ++p) {
+              for (char const * c = excluded; *c != '\0'; ++c) {
+                  if (*p == *c) {
+                      return alnum;
+                  }
+              }
+              alnum = alnum || is(*p, alnum_chars);
+          }
+          return alnum;
+      }
+
+      bool skip_chromosome(char const * & p, char const * end)
+      {
+          if (p == end || !is(*p, alnum_chars)) {
+              return false;
+          }
+          ++p;
+          skip_run(p, end, chromosome_chars);
+          return true;
+      }
+
+      bool skip_ids(char const * & p, char const * end)
+      {
+          do {
+              if (!skip_run(p, end, text_chars)) {
+                  return false;
+              }
+          } while (skip_char(p, end, ';'));
+          return true;
+      }
+
+      bool skip_alternates(char const * & p, char const * end)
+      {
+          if (skip_missing(p, end)) {
+              return true;
+          }
+          do {
+              if (skip_char(p, end, '<')) {
+                  if (!skip_identifier(p, end, graph_chars, ",<>") || !skip_char(p, end, '>')) {
+                      return false;
+                  }
+              } else if (!skip_char(p, end, '*') && !skip_run(p, end, base_chars)) {
+                  return false;
+              }
+          } while (skip_char(p, end, ','));
+          return true;
+      }
+
+      bool skip_quality(char const * & p, char const * end)
+      {
+          if (skip_missing(p, end)) {
+              return true;
+          }
+          skip_char(p, end, '+') || skip_char(p, end, '-');
+          if (!skip_run(p, end, digit_chars)) {
+              return false;
+          }
+          if (skip_char(p, end, '.') && !skip_run(p, end, digit_chars)) {
+              return false;
+          }
+          if (skip_char(p, end, 'e') || skip_char(p, end, 'E')) {
+              skip_char(p, end, '+') || skip_char(p, end, '-');
+              return skip_run(p, end, digit_chars);
+          }
+          return true;
+      }
+
+      bool skip_filters(char const * & p, char const * end)
+      {
+          if (skip_missing(p, end)) {
+              return true;
+          }
+          do {
+              if (!skip_identifier(p, end, text_chars, "")) {
+                  return false;
+              }
+          } while (skip_char(p, end, ';'));
+          return true;
+      }
+
+      bool skip_info(char const * & p, char const * end)
+      {
+          if (skip_missing(p, end)) {
+              return true;
+          }
+          do {
+              if (end - p >= 5 && std::equal(p, p + 5, "1000G")) {
+                  p += 5;
+              } else if (p != end && (is(*p, alpha_chars) || *p == '_')) {
+                  skip_run(p, end, info_key_chars);
+              } else {
+                  return false;
+              }
+              if (skip_char(p, end, '=') && !skip_run(p, end, text_chars)) {
+                  return false;
+              }
+          } while (skip_char(p, end, ';'));
+          return true;
+      }
+
+      bool skip_format(char const * & p, char const * end)
+      {
+          do {
+              if (p == end || !is(*p, alpha_chars)) {
+                  return false;
+              }
+              skip_run(p, end, alnum_chars);
+          } while (skip_char(p, end, ':'));
+          return true;
+      }
+
+      /**
+       * Skips the samples until the end of the line: printable text split by tabs and colons, with no empty field
+       */
+      bool skip_samples(char const * & p, char const * end)
+      {
+          bool previous_separator = true;     // the tab before the first sample
+
+#ifdef __SSE2__
+          // 16 bytes at a time, with a bit per byte for the separators, the printable bytes and the line breaks
+          __m128i const tab = _mm_set1_epi8('\t');
+          __m128i const colon = _mm_set1_epi8(':');
+          __m128i const line_feed = _mm_set1_epi8('\n');
+          __m128i const carriage_return = _mm_set1_epi8('\r');
+          __m128i const space = _mm_set1_epi8(' ');
+          __m128i const del = _mm_set1_epi8(0x7f);
+
+          while (end - p >= 16) {
+              __m128i block = _mm_loadu_si128(reinterpret_cast<__m128i const *>(p));
+              unsigned separators = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(block, tab),
+                                                                   _mm_cmpeq_epi8(block, colon)));
+              unsigned printable = _mm_movemask_epi8(_mm_and_si128(_mm_cmpgt_epi8(block, space),
+                                                                   _mm_cmplt_epi8(block, del)));
+              unsigned line_breaks = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(block, line_feed),
+                                                                    _mm_cmpeq_epi8(block, carriage_return)));
+
+              unsigned line = line_breaks != 0 ? (line_breaks & (0u - line_breaks)) - 1 : 0xffff;
+              unsigned empty_fields = separators & ((separators << 1) | (previous_separator ? 1 : 0));
+              if (((~(printable | separators) | empty_fields) & line) != 0) {
+                  return false;
+              }
+              if (line_breaks != 0) {
+                  int length = __builtin_ctz(line_breaks);
+                  if (length != 0) {
+                      previous_separator = (separators >> (length - 1)) & 1;
+                  }
+                  p += length;
+                  return !previous_separator;
+              }
+              previous_separator = (separators >> 15) & 1;
+              p += 16;
+          }
+#endif
+
+          for (; p != end && *p != '\n' && *p != '\r'; ++p) {
+              bool separator = *p == '\t' || *p == ':';
+              if (separator ? previous_separator : !is(*p, graph_chars)) {
+                  return false;
+              }
+              previous_separator = separator;
+          }
+          return p != end && !previous_separator;
+      }
+
+      char const * skip_line_break(char const * p, char const * end)
+      {
+          if (p != end && *p == '\n') {
+              return p + 1;
+          }
+          if (end - p >= 2 && p[0] == '\r' && p[1] == '\n') {
+              return p + 2;
+          }
+          return nullptr;
+      }
+    }
+
+    char const * skip_valid_body_line(char const * begin, char const * end)
+    {
+        char const * p = begin;
+        bool valid = skip_chromosome(p, end) && skip_char(p, end, '\t')
+                     && skip_run(p, end, digit_chars) && skip_char(p, end, '\t')
+                     && skip_ids(p, end) && skip_char(p, end, '\t')
+                     && skip_run(p, end, base_chars) && skip_char(p, end, '\t')
+                     && skip_alternates(p, end) && skip_char(p, end, '\t')
+                     && skip_quality(p, end) && skip_char(p, end, '\t')
+                     && skip_filters(p, end) && skip_char(p, end, '\t')
+                     && skip_info(p, end);
+
+        // the FORMAT column can only come with at least one sample
+        if (valid && skip_char(p, end, '\t')) {
+            valid = skip_format(p, end) && skip_char(p, end, '\t') && skip_samples(p, end);
+        }
+        return valid ? skip_line_break(p, end) : nullptr;
+    }
+
+  }
+}
@@ -0,0 +1,143 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <iomanip>
+#include <vector>
+
+#include "vcf/profile_policy.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+
+    namespace
+    {
+      char const * const step_names[n_profiled_steps] = {
+          "parsing",
+          "Record::check_chromosome",
+          "Record::check_ids",
+          "Record::check_alternate_alleles",
+          "Record::check_quality",
+          "Record::check_filter",
+          "Record::check_info",
+          "Record::check_format",
+          "Record::check_samples",
+          "RecordCache::check_duplicates",
+          "ValidateOptionalPolicy::optional_check_meta_section",
+          "ValidateOptionalPolicy::check_body_entry_position_zero",
+          "ValidateOptionalPolicy::check_body_entry_id_commas",
+          "ValidateOptionalPolicy::check_body_entry_reference_alternate_matching",
+          "ValidateOptionalPolicy::check_body_entry_alt_gvcf_gt_value",
+          "ValidateOptionalPolicy::check_body_entry_info_gvcf_end",
+          "ValidateOptionalPolicy::check_body_entry_info_imprecise",
+          "ValidateOptionalPolicy::check_body_entry_info_svlen",
+          "ValidateOptionalPolicy::check_body_entry_info_confidence_interval",
+          "ValidateOptionalPolicy::check_contig_meta",
+          "ValidateOptionalPolicy::check_alternate_allele_meta",
+          "ValidateOptionalPolicy::check_filter_meta",
+          "ValidateOptionalPolicy::check_info_meta",
+          "ValidateOptionalPolicy::check_format_meta",
+          "report writing",
+      };
+
+      thread_local std::chrono::steady_clock::duration::rep thread_measured = 0;
+    }
+
+    Profile::Profile()
+    {
+        for (size_t i = 0; i < n_profiled_steps; ++i) {
+            m_nanoseconds[i] = 0;
+            m_calls[i] = 0;
+        }
+    }
+
+    void Profile::add(ProfiledStep step, std::chrono::steady_clock::duration time)
+    {
+        auto i = static_cast<size_t>(step);
+        m_nanoseconds[i] += std::chrono::duration_cast<std::chrono::nanoseconds>(time).count();
+        ++m_calls[i];
+        thread_measured += time.count();
+    }
+
+    uint64_t Profile::calls(ProfiledStep step) const
+    {
+        return m_calls[static_cast<size_t>(step)];
+    }
+
+    std::chrono::nanoseconds Profile::time(ProfiledStep step) const
+    {
+        return std::chrono::nanoseconds{m_nanoseconds[static_cast<size_t>(step)]};
+    }
+
+    void Profile::write(std::ostream & output) const
+    {
+        std::vector<size_t> steps;
+        uint64_t total = 0;
+        for (size_t i = 0; i < n_profiled_steps; ++i) {
+            if (m_calls[i] != 0) {
+                steps.push_back(i);
+                total += m_nanoseconds[i];
+            }
+        }
+        std::stable_sort(steps.begin(), steps.end(), [this](size_t a, size_t b) {
+            return m_nanoseconds[a] > m_nanoseconds[b];
+        });
+
+        auto flags = output.flags();
+        output << std::left << std::setw(72) << "step" << std::right << std::setw(14) << "calls"
+               << std::setw(12) << "seconds" << std::setw(8) << "%" << std::setw(12) << "ns/call" << '\n';
+        output << std::fixed;
+        for (size_t i : steps) {
+            uint64_t nanoseconds = m_nanoseconds[i];
+            output << std::left << std::setw(72) << step_names[i] << std::right << std::setw(14) << m_calls[i]
+                   << std::setw(12) << std::setprecision(3) << nanoseconds / 1e9
+                   << std::setw(8) << std::setprecision(1) << (total != 0 ? 100.0 * nanoseconds / total : 0)
+                   << std::setw(12) << std::setprecision(0) << double(nanoseconds) / m_calls[i] << '\n';
+        }
+        output.flags(flags);
+    }
+
+    std::chrono::steady_clock::duration Profile::thread_time()
+    {
+        return std::chrono::steady_clock::duration{thread_measured};
+    }
+
+    ProfileTimer::ProfileTimer(Profile & profile, ProfiledStep step)
+    : m_profile(profile), m_step{step}, m_start{std::chrono::steady_clock::now()}
+    {
+    }
+
+    ProfileTimer::~ProfileTimer()
+    {
+        m_profile.add(m_step, std::chrono::steady_clock::now() - m_start);
+    }
+
+    MeasureProfilePolicy::ParsingTimer::ParsingTimer(Profile * profile)
+    : m_profile(*profile), m_start{std::chrono::steady_clock::now()}, m_measured_before{Profile::thread_time()}
+    {
+    }
+
+    MeasureProfilePolicy::ParsingTimer::~ParsingTimer()
+    {
+        auto elapsed = std::chrono::steady_clock::now() - m_start;
+        auto measured = Profile::thread_time() - m_measured_before;
+        m_profile.add(ProfiledStep::parsing, elapsed - std::min(measured, elapsed));
+    }
+
+  }
+}
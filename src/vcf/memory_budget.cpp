@@ -0,0 +1,156 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <iomanip>
+#include <stdexcept>
+#include <string>
+
+#include <sys/resource.h>
+
+#include "util/block_reader.hpp"
+#include "util/read_ahead_block_reader.hpp"
+#include "vcf/async_report_writer.hpp"
+#include "vcf/duplicate_filter.hpp"
+#include "vcf/external_record_cache.hpp"
+#include "vcf/hash_record_cache.hpp"
+#include "vcf/memory_budget.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+
+    size_t const MemoryBudget::base_memory;
+    size_t const MemoryBudget::min_limit;
+    size_t const MemoryBudget::cached_variant_size;
+    size_t const MemoryBudget::queued_error_size;
+
+    namespace
+    {
+      size_t const min_block_size = 256 * 1024;
+
+      char const * const area_names[n_memory_areas] = {
+          "input buffers",
+          "header",
+          "line buffers",
+          "cache for duplicates",
+          "pending records",
+          "reports of a block",
+          "queued reports",
+      };
+
+      double megabytes(size_t bytes)
+      {
+          return bytes / (1024.0 * 1024.0);
+      }
+    }
+
+    MemoryBudget::MemoryBudget()
+    : limit{0}, block_size{util::default_block_size}, read_ahead_buffers{util::default_read_ahead_buffers},
+      record_cache_capacity{HashRecordCache::default_capacity},
+      max_queued_errors{AsyncReportWriter::default_max_queued_errors},
+      sorted_run_capacity{ExternalRecordCache::default_run_capacity}, filtered_variants{0},
+      false_positive_rate{DuplicateFilter::default_false_positive_rate}
+    {
+        for (auto & mark : high_water_marks) {
+            mark = 0;
+        }
+    }
+
+    MemoryBudget::MemoryBudget(size_t limit, size_t threads, size_t outputs) : MemoryBudget{}
+    {
+        if (limit < min_limit) {
+            throw std::invalid_argument{"The memory limit must be at least " + std::to_string(min_limit / 1024 / 1024)
+                                        + " MB"};
+        }
+        this->limit = limit;
+        size_t available = limit - base_memory;
+
+        // a quarter for the input: the blocks read ahead, the one decompressed and the one being parsed, and the
+        // BGZF blocks inflated by each thread
+        size_t bgzf_blocks = threads > 1 ? 8 * threads * 64 * 1024 : 0;
+        size_t input_share = available / 4 > bgzf_blocks ? available / 4 - bgzf_blocks : 0;
+        block_size = std::min(block_size, input_share / (read_ahead_buffers + 2));
+        if (block_size < min_block_size) {
+            read_ahead_buffers = 2;
+            block_size = std::max(min_block_size, input_share / (read_ahead_buffers + 2));
+        }
+
+        // another quarter for the errors queued by the report threads
+        size_t reports_share = available / 4;
+        max_queued_errors = std::min(max_queued_errors,
+                                     std::max(size_t{1}, reports_share / std::max(outputs, size_t{1})
+                                                         / queued_error_size));
+
+        // an eighth for the cache for duplicates, or the variants sorted before writing them; the rest is left for
+        // the header, the lines and the records, whose size only depends on the input
+        size_t cache_share = available / 8;
+        record_cache_capacity = std::min(record_cache_capacity,
+                                         std::max(size_t{1}, cache_share / cached_variant_size));
+        sorted_run_capacity = std::min(sorted_run_capacity, std::max(size_t{1}, cache_share / cached_variant_size));
+    }
+
+    bool MemoryBudget::finds_duplicates_at_end() const
+    {
+        return !spill_directory.empty() || filtered_variants != 0;
+    }
+
+    void MemoryBudget::record(MemoryArea area, size_t bytes)
+    {
+        auto & mark = high_water_marks[static_cast<size_t>(area)];
+        size_t previous = mark;
+        while (previous < bytes && !mark.compare_exchange_weak(previous, bytes)) {
+        }
+    }
+
+    size_t MemoryBudget::high_water_mark(MemoryArea area) const
+    {
+        return high_water_marks[static_cast<size_t>(area)];
+    }
+
+    void MemoryBudget::write(std::ostream & output) const
+    {
+        auto flags = output.flags();
+        output << std::fixed << std::setprecision(1);
+        for (size_t i = 0; i < n_memory_areas; ++i) {
+            output << std::left << std::setw(24) << area_names[i] << std::right << std::setw(10)
+                   << megabytes(high_water_marks[i]) << " MB\n";
+        }
+        output << std::left << std::setw(24) << "peak resident memory" << std::right << std::setw(10)
+               << megabytes(peak_rss()) << " MB";
+        if (limit != 0) {
+            output << " (limit " << megabytes(limit) << " MB)";
+        }
+        output << '\n';
+        output.flags(flags);
+    }
+
+    size_t MemoryBudget::peak_rss()
+    {
+        rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) != 0) {
+            return 0;
+        }
+#ifdef __APPLE__
+        return static_cast<size_t>(usage.ru_maxrss);            // bytes
+#else
+        return static_cast<size_t>(usage.ru_maxrss) * 1024;     // kilobytes
+#endif
+    }
+
+  }
+}
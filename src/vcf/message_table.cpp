@@ -0,0 +1,37 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "vcf/message_table.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    MessageId MessageTable::intern(std::string const & message)
+    {
+        auto inserted = ids.emplace(message, texts.size());
+        if (inserted.second) {
+            texts.push_back(message);
+        }
+        return inserted.first->second;
+    }
+
+    std::string const & MessageTable::text(MessageId id) const
+    {
+        return texts.at(id);
+    }
+  }
+}
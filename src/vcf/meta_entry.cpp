@@ -29,24 +29,24 @@ namespace ebi
     MetaEntry::MetaEntry(size_t line,
                          std::string const & id,
                          std::shared_ptr<Source> source)
-    : line{line}, id{id}, structure{Structure::NoValue}, source{source}
+    : line{line}, id{id}, structure{Structure::NoValue}, source{std::move(source)}
     {
     }
         
     MetaEntry::MetaEntry(size_t line,
                          std::string const & id,
-                         std::string const & plain_value,
+                         std::string plain_value,
                          std::shared_ptr<Source> source)
-    : line{line}, id{id}, structure{Structure::PlainValue}, value{plain_value}, source{source}
+    : line{line}, id{id}, structure{Structure::PlainValue}, value{std::move(plain_value)}, source{std::move(source)}
     {
         check_value();
     }
 
     MetaEntry::MetaEntry(size_t line,
                          std::string const & id,
-                         std::map<std::string, std::string> const & key_values,
+                         std::map<std::string, std::string> key_values,
                          std::shared_ptr<Source> source)
-    : line{line}, id{id}, structure{Structure::KeyValue}, value{key_values}, source{source}
+    : line{line}, id{id}, structure{Structure::KeyValue}, value{std::move(key_values)}, source{std::move(source)}
     {
         check_value();
     }
@@ -69,7 +69,7 @@ namespace ebi
 
     void MetaEntry::check_value()
     {
-        MetaEntryVisitor visitor = MetaEntryVisitor { *this }; 
+        MetaEntryVisitor visitor{*this};
         boost::apply_visitor(visitor, value);
     }
      
@@ -239,13 +239,12 @@ namespace ebi
 
     void MetaEntryVisitor::check_predefined_tag(std::string const & tag_field, std::string const & meta_entry_property,
                                                 std::map<std::string, std::string> & meta_entry,
-                                                std::map<std::string, std::pair<std::string, std::string>> const & predefined_meta_entries) const
+                                                PredefinedTagTable const & predefined_meta_entries) const
     {
-        auto iterator = predefined_meta_entries.find(meta_entry[ID]);
-        if (iterator != predefined_meta_entries.end()) {
+        PredefinedTag const * tag = predefined_meta_entries.find(meta_entry[ID]);
+        if (tag != nullptr) {
             // Determine the required value of the key based on whether we are checking for Type or Number
-            std::string predefined_value = (meta_entry_property == TYPE ? get_predefined_type(iterator)
-                                                                        : get_predefined_number(iterator));
+            std::string predefined_value = (meta_entry_property == TYPE ? type_name(tag->type) : tag->number);
             // If the required value is a "." (dot), do nothing
             // Or if the required value does not match the value provided in the vcf file, throw an error
             if (predefined_value != MISSING_VALUE && predefined_value != meta_entry[meta_entry_property]) {
@@ -15,6 +15,9 @@
  */
 
 
+#include <algorithm>
+
+#include "vcf/allocation_stats.hpp"
 #include "vcf/normalizer.hpp"
 #include "util/string_utils.hpp"
 
@@ -44,7 +47,9 @@ namespace ebi
 
     bool RecordCore::operator==(const RecordCore &other) const
     {
-        return chromosome == other.chromosome
+        bool same_contig = contig != unknown_contig && other.contig != unknown_contig ?
+                           contig == other.contig : chromosome == other.chromosome;
+        return same_contig
                && position == other.position
                && reference_allele == other.reference_allele
                && alternate_allele == other.alternate_allele;
@@ -60,127 +65,136 @@ namespace ebi
         return os;
     }
     
-    //result is undefined if passed container.rend()
-    template <class ReverseIterator>
-    typename ReverseIterator::iterator_type make_forward(ReverseIterator rit)
+    namespace
     {
-        return --(rit.base()); // move result of .base() back by one.
+      void check_alleles(const Record &record, const std::string &reference, const std::string &alternate)
+      {
+          if (alternate.size() < 1) {
+              throw new NormalizationError{record.line, "Alternate should not be empty"};
+          }
+          if (reference.size() < 1) {
+              throw new NormalizationError{record.line, "Reference should not be empty"};
+          }
+          if (reference == alternate) {
+              throw new NormalizationError{record.line, "Reference and alternate should not be identical"};
+          }
+      }
+
+      /**
+       * Length of the common prefix of [a, a + a_length) and [b, b + b_length)
+       */
+      size_t count_leading(const char *a, size_t a_length, const char *b, size_t b_length)
+      {
+          size_t count = 0;
+          size_t limit = std::min(a_length, b_length);
+          while (count < limit && a[count] == b[count]) {
+              ++count;
+          }
+          return count;
+      }
+
+      /**
+       * Length of the common suffix of [a, a + a_length) and [b, b + b_length)
+       */
+      size_t count_trailing(const char *a, size_t a_length, const char *b, size_t b_length)
+      {
+          size_t count = 0;
+          size_t limit = std::min(a_length, b_length);
+          while (count < limit && a[a_length - 1 - count] == b[b_length - 1 - count]) {
+              ++count;
+          }
+          return count;
+      }
+
+      NormalizedAllele trim(const Record &record, size_t alternate_index, size_t leading, size_t trailing)
+      {
+          const std::string &alternate = record.alternate_alleles[alternate_index];
+          return NormalizedAllele{record.position + leading, alternate_index,
+                                  leading, record.reference_allele.size() - leading - trailing,
+                                  leading, alternate.size() - leading - trailing};
+      }
+
+      std::vector<RecordCore> make_record_cores(const Record &record, const std::vector<NormalizedAllele> &alleles)
+      {
+          std::vector<RecordCore> records;
+          for (auto &allele : alleles) {
+              records.push_back(make_record_core(record, allele));
+          }
+          return records;
+      }
     }
-    
-    template <class ReverseIterator>
-    typename ReverseIterator::iterator_type make_forward_and_advance(ReverseIterator rit)
+
+    void normalize_alleles(const Record &record, std::vector<NormalizedAllele> &alleles)
     {
-        return rit.base();  // base iterator was already pointing to the next element
-    }
+        AllocationScope allocation_scope{AllocationStage::normalization};
+        alleles.clear();
+        const std::string &reference = record.reference_allele;
 
+        // This index is necessary for getting the samples where the mutated allele is present
+        for (size_t i = 0; i < record.alternate_alleles.size(); i++) {
+            const std::string &alternate = record.alternate_alleles[i];
+            check_alleles(record, reference, alternate);
+
+            // trim the trailing matching bases first, and then the leading ones of what is left
+            size_t trailing = count_trailing(reference.data(), reference.size(), alternate.data(), alternate.size());
+            size_t leading = count_leading(reference.data(), reference.size() - trailing,
+                                           alternate.data(), alternate.size() - trailing);
+            alleles.push_back(trim(record, i, leading, trailing));
+        }
+    }
 
-    std::vector<RecordCore> normalize(const Record &record/* , ParsingState?*/)
+    void normalize_alleles_right_alignment(const Record &record, std::vector<NormalizedAllele> &alleles)
     {
-        std::vector<RecordCore> records;
+        alleles.clear();
+        const std::string &reference = record.reference_allele;
 
         // This index is necessary for getting the samples where the mutated allele is present
         for (size_t i = 0; i < record.alternate_alleles.size(); i++) {
-            std::string alternate = record.alternate_alleles[i];
-            std::string reference = record.reference_allele;
-            size_t position = record.position;
-
-            size_t corrected_position;
-            std::string corrected_alternate;
-            std::string corrected_reference;
-
-            // assertions / preconditions
-            if (alternate.size() < 1) {
-                throw new NormalizationError{record.line, "Alternate should not be empty"};
-            }
-            if (reference.size() < 1) {
-                throw new NormalizationError{record.line, "Reference should not be empty"};
-            }
-            if (reference == alternate) {
-                throw new NormalizationError{record.line, "Reference and alternate should not be identical"};
-            }
-
-            // count trailing matching bases using mismatch with reverse iterators
-            // the result are reverse_iterators, which later must be made forward iterators
-            std::pair<std::string::reverse_iterator, std::string::reverse_iterator> trail_mismatch_reverse =
-                    util::mismatch(reference.rbegin(), reference.rend(),
-                                   alternate.rbegin(), alternate.rend());
-            // trail_match_* point to the first match of the trailing bases. These will be the "end" in
-            // the .assign [start, end) below. "advance" because trail_mismatch_* were pointing to the last MISmatch
-            std::string::iterator trail_match_ref = make_forward_and_advance(trail_mismatch_reverse.first);
-            std::string::iterator trail_match_alt = make_forward_and_advance(trail_mismatch_reverse.second);
-
-
-            // these will point to the first leading mismatch. These will be the "start" in the .assign [start, end)
-            std::pair<std::string::iterator, std::string::iterator> lead_mismatch_indices =
-                    util::mismatch(reference.begin(), trail_match_ref,
-                                   alternate.begin(), trail_match_alt);
-
-
-            // using the previous iterators, assign only [first_mismatch, last_mismatch+1)
-            corrected_reference.assign(lead_mismatch_indices.first, trail_match_ref);
-            corrected_alternate.assign(lead_mismatch_indices.second, trail_match_alt);
-            corrected_position = position + (lead_mismatch_indices.first - reference.begin());
-
-            records.emplace_back(record.line, record.chromosome, corrected_position,
-                                 corrected_reference, corrected_alternate);
+            const std::string &alternate = record.alternate_alleles[i];
+            check_alleles(record, reference, alternate);
+
+            // trim the leading matching bases first, and then the trailing ones of what is left
+            size_t leading = count_leading(reference.data(), reference.size(), alternate.data(), alternate.size());
+            size_t trailing = count_trailing(reference.data() + leading, reference.size() - leading,
+                                             alternate.data() + leading, alternate.size() - leading);
+            alleles.push_back(trim(record, i, leading, trailing));
         }
+    }
 
-        return records;
+    std::vector<RecordCore> normalize(const Record &record/* , ParsingState?*/)
+    {
+        std::vector<NormalizedAllele> alleles;
+        normalize_alleles(record, alleles);
+        return make_record_cores(record, alleles);
     }
-    
+
     std::vector<RecordCore> normalize_right_alignment(const Record &record/* , ParsingState?*/)
     {
-        std::vector<RecordCore> records;
+        std::vector<NormalizedAllele> alleles;
+        normalize_alleles_right_alignment(record, alleles);
+        return make_record_cores(record, alleles);
+    }
 
-        // This index is necessary for getting the samples where the mutated allele is present
-        for (size_t i = 0; i < record.alternate_alleles.size(); i++) {
-            std::string alternate = record.alternate_alleles[i];
-            std::string reference = record.reference_allele;
-            size_t position = record.position;
-
-            size_t corrected_position;
-            std::string corrected_alternate;
-            std::string corrected_reference;
-
-            // assertions / preconditions
-            if (alternate.size() < 1) {
-                throw new NormalizationError{record.line, "Alternate should not be empty"};
-            }
-            if (reference.size() < 1) {
-                throw new NormalizationError{record.line, "Reference should not be empty"};
-            }
-            if (reference == alternate) {
-                throw new NormalizationError{record.line, "Reference and alternate should not be identical"};
-            }
-
-            // count leading matching bases using mismatch with forward iterators
-            // these will point to the first leading mismatch. These will be the "start" in the .assign [start, end)
-            std::pair<std::string::iterator, std::string::iterator> lead_mismatch_indices =
-                    util::mismatch(reference.begin(), reference.end(),
-                                   alternate.begin(), alternate.end());
-
-
-            // count trailing matching bases using mismatch with reverse iterators
-            // the result are reverse_iterators, which later must be made forward iterators
-            std::pair<std::string::reverse_iterator, std::string::reverse_iterator> trail_mismatch_reverse =
-                    util::mismatch(reference.rbegin(), std::string::reverse_iterator(lead_mismatch_indices.first),
-                                   alternate.rbegin(), std::string::reverse_iterator(lead_mismatch_indices.second));
-            // trail_match_* point to the first match of the trailing bases. These will be the "end" in the .assign
-            // [start, end) below. "advance" because trail_mismatch_reverse.* were pointing to the last MISmatch
-            std::string::iterator trail_match_ref = make_forward_and_advance(trail_mismatch_reverse.first);
-            std::string::iterator trail_match_alt = make_forward_and_advance(trail_mismatch_reverse.second);
-
-
-            // using the previous iterators, assign only [first_mismatch, last_mismatch+1)
-            corrected_reference.assign(lead_mismatch_indices.first, trail_match_ref);
-            corrected_alternate.assign(lead_mismatch_indices.second, trail_match_alt);
-            corrected_position = position + (lead_mismatch_indices.first - reference.begin());
-
-            records.emplace_back(record.line, record.chromosome, corrected_position,
-                                 corrected_reference, corrected_alternate);
-        }
+    RecordCore make_record_core(const Record &record, const NormalizedAllele &allele)
+    {
+        return RecordCore{record.line, record.chromosome, allele.position,
+                          record.reference_allele.substr(allele.reference_begin, allele.reference_length),
+                          record.alternate_alleles[allele.alternate_index].substr(allele.alternate_begin,
+                                                                                  allele.alternate_length),
+                          record.contig};
+    }
 
-        return records;
+    bool same_variant(const RecordCore &record_core, const Record &record, const NormalizedAllele &allele)
+    {
+        bool same_contig = record_core.contig != unknown_contig && record.contig != unknown_contig ?
+                           record_core.contig == record.contig : record_core.chromosome == record.chromosome;
+        return same_contig
+               && record_core.position == allele.position
+               && record_core.reference_allele.compare(0, std::string::npos, record.reference_allele,
+                                                       allele.reference_begin, allele.reference_length) == 0
+               && record_core.alternate_allele.compare(0, std::string::npos,
+                                                       record.alternate_alleles[allele.alternate_index],
+                                                       allele.alternate_begin, allele.alternate_length) == 0;
     }
   }
 }
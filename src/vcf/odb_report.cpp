@@ -21,8 +21,8 @@ namespace ebi
 {
   namespace vcf
   {
-    OdbReportRW::OdbReportRW(const std::string &db_name) : db_name(db_name), current_transaction_size{0},
-                                                           transaction_size{1000000}
+    OdbReportRW::OdbReportRW(const std::string &db_name, size_t transaction_size)
+            : db_name(db_name), current_transaction_size{0}, transaction_size{transaction_size}
     {
         try {
             boost::filesystem::path db_file{db_name};
@@ -68,16 +68,40 @@ namespace ebi
     }
 
     void OdbReportRW::flush()
+    {
+        commit_batch();
+        finish_ingest();
+    }
+
+    void OdbReportRW::start_ingest()
+    {
+        ingest_connection = db->connection();
+        ingest_connection->execute("PRAGMA journal_mode=MEMORY");
+        ingest_connection->execute("PRAGMA synchronous=OFF");
+    }
+
+    void OdbReportRW::commit_batch()
     {
         // possible recovery can be done here, ODB rollbacks automatically on error, and throws.
         if (transaction.has_current()) {
             transaction.commit();
         }
+        current_transaction_size = 0;
+    }
 
-        {
-            odb::core::connection_ptr c{db->connection()};
-            c->execute("PRAGMA shrink_memory");
+    void OdbReportRW::finish_ingest()
+    {
+        if (!ingest_connection) {
+            return;
         }
+
+        // a single index serves both the counts by severity and the reads ordered by line
+        ingest_connection->execute("CREATE INDEX IF NOT EXISTS \"Error_severity_line_i\" ON \"Error\" "
+                                   "(\"severity\", \"line\")");
+        ingest_connection->execute("PRAGMA synchronous=FULL");
+        ingest_connection->execute("PRAGMA journal_mode=DELETE");
+        ingest_connection->execute("PRAGMA shrink_memory");
+        ingest_connection.reset();
     }
 
     // ReportWriter implementation
@@ -91,6 +115,13 @@ namespace ebi
         error.severity = Severity::WARNING;
         write(error);
     }
+    void OdbReportRW::write_batch(std::vector<ReportedError> const & batch)
+    {
+        for (auto & reported : batch) {
+            reported.error->severity = reported.severity;
+            write(*reported.error);
+        }
+    }
     void OdbReportRW::write_message(const std::string &report_result)
     {
         // do nothing
@@ -99,17 +130,17 @@ namespace ebi
     void OdbReportRW::write(Error &error)
     {
         if (current_transaction_size == 0) {
-            // start transaction
-            transaction.reset(db->begin());
+            if (!ingest_connection) {
+                start_ingest();
+            }
+            transaction.reset(ingest_connection->begin());
         }
 
         db->persist(error);
 
         ++current_transaction_size;
         if (current_transaction_size == transaction_size) {
-            // commit transaction
-            flush();
-            current_transaction_size = 0;
+            commit_batch();
         }
     }
 
@@ -141,7 +172,7 @@ namespace ebi
             transaction.reset(db->begin());
 //        size_t count = db->execute("SELECT COUNT(*) FROM Error");
             count = db->query_value<ErrorCount>(query);
-            flush();
+            transaction.commit();
         }
         return count.count;
     }
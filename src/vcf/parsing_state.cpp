@@ -14,6 +14,13 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <sstream>
+
+#include "util/trace.hpp"
+#include "util/worker_pool.hpp"
 #include "vcf/parsing_state.hpp"
 
 namespace ebi
@@ -21,11 +28,89 @@ namespace ebi
   namespace vcf
   {
 
+    RecordOrder::RecordOrder()
+    : contig_status{}, seen_contigs{0}, previous_contig{unknown_contig}, previous_position{0},
+      first_contig{unknown_contig}, first_position{0}
+    {
+    }
+
+    RecordOrder::ContigStatus RecordOrder::status(ContigId contig) const
+    {
+        return contig < contig_status.size() ? contig_status[contig] : ContigStatus::UNSEEN;
+    }
+
+    void RecordOrder::set_status(ContigId contig, ContigStatus status)
+    {
+        if (contig >= contig_status.size()) {
+            contig_status.resize(contig + 1, ContigStatus::UNSEEN);
+        }
+        if (contig_status[contig] == ContigStatus::UNSEEN && status != ContigStatus::UNSEEN) {
+            ++seen_contigs;
+        }
+        contig_status[contig] = status;
+    }
+
+    RecordSampling::RecordSampling()
+    : period{1}, threshold{0}, seed{0}, fraction{1}
+    {
+    }
+
+    RecordSampling RecordSampling::every(size_t period)
+    {
+        if (period == 0) {
+            throw std::invalid_argument{"The records must be sampled with a period of at least 1"};
+        }
+        RecordSampling sampling;
+        sampling.period = period;
+        sampling.fraction = 1.0 / period;
+        return sampling;
+    }
+
+    RecordSampling RecordSampling::random(double fraction, uint64_t seed)
+    {
+        if (!(fraction > 0 && fraction <= 1)) {
+            throw std::invalid_argument{"The fraction of records sampled must be greater than 0 and at most 1"};
+        }
+        RecordSampling sampling;
+        if (fraction < 1) {
+            sampling.period = 0;
+            sampling.threshold = static_cast<uint64_t>(std::ldexp(fraction, 64));
+            sampling.seed = seed;
+            sampling.fraction = fraction;
+        }
+        return sampling;
+    }
+
+    bool RecordSampling::selects_all() const
+    {
+        return period == 1;
+    }
+
+    double RecordSampling::rate() const
+    {
+        return fraction;
+    }
+
+    std::string RecordSampling::description() const
+    {
+        if (period == 1) {
+            return "every record";
+        }
+        if (period != 0) {
+            return "1 of every " + std::to_string(period) + " records";
+        }
+        std::ostringstream percentage;
+        percentage << fraction * 100 << "% of the records, chosen at random";
+        return percentage.str();
+    }
+
     ParsingState::ParsingState(std::shared_ptr<Source> source)
     : n_lines{1}, n_columns{1}, n_batches{0}, cs{0}, m_is_valid{true}, 
-      source{source}, record{},
-      errors{}, warnings{},
-      defined_metadata{}
+      source{source}, record{}, recycled{},
+      errors{}, warnings{}, error_lines_read{}, warning_lines_read{},
+      described_contigs{}, record_order{}, record_sampling{}, workers{nullptr}, pending_records{}, n_pending_records{0},
+      record_listener{}, profile{nullptr}, max_reports_per_type{0}, reports_per_type{}, n_omitted_errors{0},
+      n_omitted_warnings{0}
     {
     }
 
@@ -34,9 +119,19 @@ namespace ebi
         source->version = version;
     }
     
-    void ParsingState::add_meta(MetaEntry const & meta)
+    void ParsingState::add_meta(MetaEntry meta)
     {
-        source->meta_entries.emplace(meta.id, meta);
+        std::string id = meta.id;
+        auto & entry = source->meta_entries.emplace(std::move(id), std::move(meta))->second;
+
+        if (entry.id == CONTIG && entry.structure == MetaEntry::Structure::KeyValue) {
+            // the contigs of the header get their ids before those only found in the records
+            auto & key_values = boost::get<std::map<std::string, std::string>>(entry.value);
+            auto id = key_values.find(ID);
+            if (id != key_values.end()) {
+                intern_contig(id->second);
+            }
+        }
     }
     
     void ParsingState::set_record(std::unique_ptr<Record> record)
@@ -44,21 +139,126 @@ namespace ebi
         this->record = std::move(record);
     }
 
+    Record & ParsingState::recycled_record()
+    {
+        if (record) {
+            recycled = std::move(record);
+        } else if (!recycled) {
+            recycled.reset(new Record{});
+        }
+        return *recycled;
+    }
+
+    void ParsingState::use_recycled_record()
+    {
+        record = std::move(recycled);
+    }
+
+    PendingRecord & ParsingState::add_pending_record()
+    {
+        if (n_pending_records == pending_records.size()) {
+            pending_records.push_back(PendingRecord{std::unique_ptr<Record>{new Record{}}, nullptr, nullptr});
+        }
+        PendingRecord & pending = pending_records[n_pending_records++];
+        pending.layout = nullptr;
+        pending.error = nullptr;
+        return pending;
+    }
+
+    void ParsingState::check_pending_records()
+    {
+        util::TraceSpan span{"checks", "check records", "records", static_cast<int64_t>(n_pending_records)};
+        auto is_wide = [this](size_t i) {
+            return pending_records[i].record->samples.size() >= Record::parallel_samples_threshold;
+        };
+
+        workers->run(n_pending_records, [&](size_t i) {
+            PendingRecord & pending = pending_records[i];
+            if (is_wide(i)) {
+                return;
+            }
+            pending.error = pending.record->validate(*pending.layout, nullptr, profile,
+                                                     record_checks_at(pending.record->line));
+        });
+
+        // a few huge lines would keep a single thread busy, so their samples are split between the workers
+        for (size_t i = 0; i < n_pending_records; ++i) {
+            PendingRecord & pending = pending_records[i];
+            if (!is_wide(i)) {
+                continue;
+            }
+            pending.error = pending.record->validate(*pending.layout, workers, profile,
+                                                     record_checks_at(pending.record->line));
+        }
+    }
+
+    namespace
+    {
+      void sort_by_line(std::vector<std::unique_ptr<Error>> & reports, std::vector<size_t> & lines)
+      {
+          if (std::is_sorted(lines.begin(), lines.end())) {
+              return;
+          }
+
+          std::vector<size_t> order(lines.size());
+          std::iota(order.begin(), order.end(), 0);
+          std::stable_sort(order.begin(), order.end(), [&lines](size_t a, size_t b) { return lines[a] < lines[b]; });
+
+          std::vector<std::unique_ptr<Error>> sorted_reports;
+          std::vector<size_t> sorted_lines;
+          for (size_t i : order) {
+              sorted_reports.push_back(std::move(reports[i]));
+              sorted_lines.push_back(lines[i]);
+          }
+          reports.swap(sorted_reports);
+          lines.swap(sorted_lines);
+      }
+    }
+
+    void ParsingState::sort_reports()
+    {
+        sort_by_line(errors, error_lines_read);
+        sort_by_line(warnings, warning_lines_read);
+    }
+
+    bool ParsingState::keeps_report(Severity severity, Error const & error)
+    {
+        // the errors of pending records are reported out of order, so the first ones of a type are not known yet
+        return max_reports_per_type == 0 || workers != nullptr
+               || reports_per_type.add(severity, error, max_reports_per_type);
+    }
+
     void ParsingState::add_error(std::unique_ptr<Error> error)
     {
+        if (!keeps_report(Severity::ERROR, *error)) {
+            ++n_omitted_errors;
+            return;
+        }
         errors.push_back(std::move(error));
+        error_lines_read.push_back(n_lines);
     }
 
     void ParsingState::add_warning(std::unique_ptr<Error> error)
     {
+        if (!keeps_report(Severity::WARNING, *error)) {
+            ++n_omitted_warnings;
+            return;
+        }
         warnings.push_back(std::move(error));
+        warning_lines_read.push_back(n_lines);
     }
 
     void ParsingState::clear()
     {
-        record.reset();
+        if (record) {
+            recycled = std::move(record);
+        }
         errors.clear();
         warnings.clear();
+        error_lines_read.clear();
+        warning_lines_read.clear();
+        n_omitted_errors = 0;
+        n_omitted_warnings = 0;
     }
 
     std::vector<std::string> const & ParsingState::samples() const
@@ -70,22 +270,5 @@ namespace ebi
     {
         source->samples_names = samples;
     }
-    
-    bool ParsingState::is_well_defined_meta(std::string const & meta_type, std::string const & id) const
-    {
-        typedef std::multimap<std::string,std::string>::const_iterator iter;
-        std::pair<iter, iter> range = defined_metadata.equal_range(meta_type);
-        for (auto & current = range.first; current != range.second; ++current) {
-            if (current->second == id) {
-                return true;
-            }
-        }
-        return false;
-    }
-    
-    void ParsingState::add_well_defined_meta(std::string const & meta_type, std::string const & id)
-    {
-        defined_metadata.emplace(meta_type, id);
-    }
   }
 }
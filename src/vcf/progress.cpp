@@ -0,0 +1,137 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <iomanip>
+
+#include "vcf/contig_table.hpp"
+#include "vcf/progress.hpp"
+#include "vcf/validator.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+
+    double Progress::megabytes_per_second() const
+    {
+        double seconds = std::chrono::duration<double>(elapsed).count();
+        return seconds > 0 ? bytes / 1e6 / seconds : 0;
+    }
+
+    bool Progress::has_eta() const
+    {
+        return input_size != 0 && input_bytes != 0 && !finished;
+    }
+
+    std::chrono::seconds Progress::eta() const
+    {
+        uint64_t left = input_size > input_bytes ? input_size - input_bytes : 0;
+        double seconds = std::chrono::duration<double>(elapsed).count() * left / input_bytes;
+        return std::chrono::seconds{static_cast<std::chrono::seconds::rep>(seconds)};
+    }
+
+    std::ostream & operator<<(std::ostream & output, Progress const & progress)
+    {
+        auto flags = output.flags();
+        output << std::fixed << std::setprecision(1);
+        output << (progress.finished ? "finished, " : "") << progress.lines << " lines, "
+               << progress.bytes / 1e6 << " MB";
+        if (progress.input_size != 0) {
+            output << " (" << 100.0 * progress.input_bytes / progress.input_size << "% of the input)";
+        }
+        if (!progress.contig.empty()) {
+            output << ", at " << progress.contig << ":" << progress.position;
+        }
+        output << ", " << progress.megabytes_per_second() << " MB/s, " << progress.errors << " errors, "
+               << progress.warnings << " warnings";
+        if (progress.has_eta()) {
+            auto seconds = progress.eta().count();
+            output << ", ETA " << seconds / 3600 << ":" << std::setfill('0') << std::setw(2) << seconds / 60 % 60
+                   << ":" << std::setw(2) << seconds % 60 << std::setfill(' ');
+        }
+        output.flags(flags);
+        return output;
+    }
+
+    ProgressMonitor::ProgressMonitor(Callback callback, std::chrono::steady_clock::duration interval)
+    : callback(std::move(callback)), interval{interval}, start{std::chrono::steady_clock::now()},
+      next_call{start + interval}, input_bytes{0}, current{0, 0, 0, 0, "", 0, 0, 0, {}, false}
+    {
+    }
+
+    void ProgressMonitor::set_input_size(uint64_t size)
+    {
+        current.input_size = size;
+    }
+
+    void ProgressMonitor::add_input_bytes(size_t bytes)
+    {
+        input_bytes += bytes;
+    }
+
+    void ProgressMonitor::add_parsed(Parser const & parser, size_t bytes)
+    {
+        update(parser, bytes);
+        if (current.elapsed >= next_call - start) {
+            notify();
+        }
+    }
+
+    void ProgressMonitor::finish(Parser const & parser)
+    {
+        update(parser, 0);
+        current.finished = true;
+        notify();
+    }
+
+    void ProgressMonitor::finish()
+    {
+        current.input_bytes = input_bytes;
+        current.elapsed = std::chrono::steady_clock::now() - start;
+        current.finished = true;
+        notify();
+    }
+
+    Progress const & ProgressMonitor::progress() const
+    {
+        return current;
+    }
+
+    void ProgressMonitor::update(Parser const & parser, size_t bytes)
+    {
+        current.lines = parser.lines_read();
+        current.bytes += bytes;
+        current.input_bytes = input_bytes;
+        current.errors += parser.errors().size() + parser.omitted_errors();
+        current.warnings += parser.warnings().size() + parser.omitted_warnings();
+        ContigId contig = parser.last_contig();
+        if (contig != unknown_contig) {
+            current.contig = contig_name(contig);
+            current.position = parser.last_position();
+        }
+        current.elapsed = std::chrono::steady_clock::now() - start;
+    }
+
+    void ProgressMonitor::notify()
+    {
+        next_call = start + current.elapsed + interval;
+        if (callback) {
+            callback(current);
+        }
+    }
+
+  }
+}
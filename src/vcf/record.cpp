@@ -14,14 +14,24 @@
  * limitations under the License.
  */
 
+#include <atomic>
 #include <functional>
+#include <iterator>
+#include <set>
 #include <unordered_set>
 #include <iostream>
 
 #include "util/algo_utils.hpp"
 #include "util/logger.hpp"
+#include "util/number_utils.hpp"
+#include "util/worker_pool.hpp"
+#include "vcf/allocation_stats.hpp"
+#include "vcf/error_thrower.hpp"
+#include "vcf/field_matchers.hpp"
 #include "vcf/file_structure.hpp"
+#include "vcf/profile_policy.hpp"
 #include "vcf/record.hpp"
+#include "vcf/sample_index.hpp"
 
 namespace ebi
 {
@@ -39,30 +49,176 @@ namespace ebi
             std::multimap<std::string, std::string> const & info,
             std::vector<std::string> const & format,
             std::vector<std::string> const & samples,
-            std::shared_ptr<Source> source)
-    : line(line),
-        chromosome{chromosome},
-        position{position},
-        ids{ids},
-        reference_allele{reference_allele}, 
-        alternate_alleles{alternate_alleles}, 
-        types{},
-        quality{quality}, 
-        filters{filters}, 
-        info{info}, 
-        format{format}, 
-        samples{samples},
-        source{source}
+            std::shared_ptr<Source> const & source)
+    : Record{}
     {
+        assign(line, chromosome, position, ids, reference_allele, alternate_alleles, quality, filters, info, format,
+               samples, source.get());
+    }
+
+    Record::Record()
+    : line{0}, contig{unknown_contig}, position{0}, quality{0}, source{nullptr}
+    {
+    }
+
+    void Record::assign(size_t const line,
+            std::string const & chromosome,
+            size_t const position,
+            std::vector<std::string> const & ids,
+            std::string const & reference_allele,
+            std::vector<std::string> const & alternate_alleles,
+            float const quality,
+            std::vector<std::string> const & filters,
+            std::multimap<std::string, std::string> const & info,
+            std::vector<std::string> const & format,
+            std::vector<std::string> const & samples,
+            Source * source)
+    {
+        assign_unchecked(line, chromosome, position, ids, reference_allele, alternate_alleles, quality, filters, info,
+                         format, samples, source);
+        check();
+    }
+
+    void Record::assign_unchecked(size_t const line,
+            std::string const & chromosome,
+            size_t const position,
+            std::vector<std::string> const & ids,
+            std::string const & reference_allele,
+            std::vector<std::string> const & alternate_alleles,
+            float const quality,
+            std::vector<std::string> const & filters,
+            std::multimap<std::string, std::string> info,
+            std::vector<std::string> const & format,
+            std::vector<std::string> const & samples,
+            Source * source)
+    {
+        this->line = line;
+        if (this->contig == unknown_contig || this->chromosome != chromosome) {
+            // a reused record usually continues the same contig, which doesn't need to be looked up again
+            this->chromosome = chromosome;
+            this->contig = intern_contig(chromosome);
+        }
+        this->position = position;
+        this->ids = ids;
+        this->reference_allele = reference_allele;
+        this->alternate_alleles = alternate_alleles;
+        this->quality = quality;
+        this->filters = filters;
+        this->info = std::move(info);
+        this->format = format;
+        this->samples = samples;
+        this->unsplit_samples.clear();
+        this->source = source;
+    }
+
+    void Record::check()
+    {
+        check(source->format_layout(format));
+    }
+
+    void Record::check(FormatLayout const & layout, util::WorkerPool * workers)
+    {
+        Error * error = validate(layout, workers);
+        if (error != nullptr) {
+            throw_error(error);
+        }
+    }
+
+    Error * Record::validate()
+    {
+        return validate(source->format_layout(format));
+    }
+
+    size_t const Record::parallel_samples_threshold = 4096;
+    size_t const Record::long_info_value_size = 64 * 1024;
+
+    Error * Record::validate(FormatLayout const & layout, util::WorkerPool * workers, Profile * profile,
+                             unsigned checks)
+    {
+        AllocationScope allocation_scope{AllocationStage::checks};
         set_types();
-        check_chromosome();
-        check_ids();
-        check_alternate_alleles();
-        check_quality();
-        check_filter();
-        check_info();
-        check_format();
-        check_samples();
+        if (checks & RECORD_CHECK_SAMPLES) {
+            split_samples();
+        }
+
+        // the profile is only looked at once per record, the checks themselves are not measured otherwise
+        if (profile != nullptr) {
+            return run_checks<MeasureProfilePolicy>(layout, workers, profile, checks);
+        }
+        return run_checks<IgnoreProfilePolicy>(layout, workers, profile, checks);
+    }
+
+    template <typename ProfilePolicy>
+    Error * Record::run_checks(FormatLayout const & layout, util::WorkerPool * workers, Profile * profile,
+                               unsigned checks) const
+    {
+        Error * error = nullptr;
+        if (checks & RECORD_CHECK_FIELDS) {
+            error = ProfilePolicy::measure(profile, ProfiledStep::check_chromosome,
+                                           [this] { return check_chromosome(); });
+            if (error == nullptr) {
+                error = ProfilePolicy::measure(profile, ProfiledStep::check_ids, [this] { return check_ids(); });
+            }
+            if (error == nullptr) {
+                error = ProfilePolicy::measure(profile, ProfiledStep::check_alternate_alleles,
+                                               [this] { return check_alternate_alleles(); });
+            }
+            if (error == nullptr) {
+                error = ProfilePolicy::measure(profile, ProfiledStep::check_quality,
+                                               [this] { return check_quality(); });
+            }
+            if (error == nullptr) {
+                error = ProfilePolicy::measure(profile, ProfiledStep::check_filter,
+                                               [this] { return check_filter(); });
+            }
+            if (error == nullptr) {
+                error = ProfilePolicy::measure(profile, ProfiledStep::check_info, [this] { return check_info(); });
+            }
+            if (error == nullptr) {
+                error = ProfilePolicy::measure(profile, ProfiledStep::check_format,
+                                               [this] { return check_format(); });
+            }
+        }
+        if (error == nullptr && (checks & RECORD_CHECK_SAMPLES)) {
+            // the predefined tags of each sample are too quick to measure one by one, they are part of this step
+            error = ProfilePolicy::measure(profile, ProfiledStep::check_samples,
+                                           [&] { return check_samples(layout, workers); });
+        } else if (error == nullptr && (checks & RECORD_CHECK_FIELDS)) {
+            // the fields of the samples are not looked at, but they must still be as many as in the header
+            error = ProfilePolicy::measure(profile, ProfiledStep::check_samples,
+                                           [this] { return check_samples_count(); });
+        }
+        return error;
+    }
+
+    size_t Record::n_samples() const
+    {
+        if (unsplit_samples.empty()) {
+            return samples.size();
+        }
+        return static_cast<size_t>(std::count(unsplit_samples.begin(), unsplit_samples.end(), '\t')) + 1;
+    }
+
+    void Record::split_samples()
+    {
+        if (unsplit_samples.empty()) {
+            return;
+        }
+        samples.resize(n_samples());
+        size_t begin = 0;
+        for (auto & sample : samples) {
+            size_t end = std::min(unsplit_samples.find('\t', begin), unsplit_samples.size());
+            sample.assign(unsplit_samples, begin, end - begin);
+            begin = end + 1;
+        }
+        unsplit_samples.clear();
+    }
+
+    bool Record::is_reference_block() const
+    {
+        return alternate_alleles.size() == 1
+               && (alternate_alleles[0] == GVCF_NON_VARIANT_ALLELE || alternate_alleles[0] == GVCF_NON_REF_ALLELE)
+               && info.find(END) != info.end();
     }
 
     bool Record::operator==(Record const & other) const
@@ -76,7 +232,8 @@ namespace ebi
                 filters == other.filters &&
                 info == other.info &&
                 format == other.format &&
-                samples == other.samples;
+                samples == other.samples &&
+                unsplit_samples == other.unsplit_samples;
     }
 
     bool Record::operator!=(Record const & other) const
@@ -86,6 +243,7 @@ namespace ebi
 
     void Record::set_types()
     {
+        types.clear();
         for (auto & alternate : alternate_alleles) {
             if (alternate == MISSING_VALUE || alternate == GVCF_NON_VARIANT_ALLELE) {
                 types.push_back(RecordType::NO_VARIATION);
@@ -102,81 +260,86 @@ namespace ebi
         }
     }
     
-    void Record::check_chromosome() const
+    Error * Record::check_chromosome() const
     {
-        check_chromosome_no_colons();
-        check_chromosome_no_whitespaces();
+        Error * error = check_chromosome_no_colons();
+        if (error == nullptr) { error = check_chromosome_no_whitespaces(); }
+        return error;
     }
 
-    void Record::check_chromosome_no_colons() const
+    Error * Record::check_chromosome_no_colons() const
     {
         if (chromosome.find(':') != std::string::npos) {
-            throw new ChromosomeBodyError{line, "Chromosome must not contain colons"};
+            return new ChromosomeBodyError{line, "Chromosome must not contain colons"};
         }
+        return nullptr;
     }
 
-    void Record::check_chromosome_no_whitespaces() const
+    Error * Record::check_chromosome_no_whitespaces() const
     {
         if (chromosome.find(' ') != std::string::npos) {
-            throw new ChromosomeBodyError{line, "Chromosome must not contain white-spaces"};
+            return new ChromosomeBodyError{line, "Chromosome must not contain white-spaces"};
         }
+        return nullptr;
     }
 
-    void Record::check_ids() const
+    Error * Record::check_ids() const
     {
         if (ids.size() == 1 && ids[0] == MISSING_VALUE) {
-            return; // No need to check if no IDs are provided
+            return nullptr; // No need to check if no IDs are provided
         }
         
-        check_ids_no_semicolons_whitespaces();
-        check_ids_no_duplicates();
+        Error * error = check_ids_no_semicolons_whitespaces();
+        if (error == nullptr) { error = check_ids_no_duplicates(); }
+        return error;
     }
 
-    void Record::check_ids_no_semicolons_whitespaces() const
+    Error * Record::check_ids_no_semicolons_whitespaces() const
     {
         for (auto & id : ids) {
             if (util::contains_if(id, [](char c) { return c == ' ' || c == ';'; })) {
-                throw new IdBodyError{line, "ID must not contain semicolons or whitespaces"};
+                return new IdBodyError{line, "ID must not contain semicolons or whitespaces"};
             }
         }
+        return nullptr;
     }
 
-    void Record::check_ids_no_duplicates() const
+    Error * Record::check_ids_no_duplicates() const
     {
-        if (source->version == Version::v43) {
-            try {
-                check_no_duplicates(ids);
-            } catch (const std::invalid_argument &ex) {
-                throw new IdBodyError{line, "ID must not have duplicate values", ErrorFix::DUPLICATE_VALUES};
-            }
+        if (source->version == Version::v43 && has_duplicates(ids)) {
+            return new IdBodyError{line, "ID must not have duplicate values", ErrorFix::DUPLICATE_VALUES};
         }
+        return nullptr;
     }
 
-    void Record::check_alternate_alleles() const
+    Error * Record::check_alternate_alleles() const
     {        
         for (size_t i = 0 ; i < alternate_alleles.size(); ++i) {
             auto & alternate = alternate_alleles[i];
             auto & type = types[i];
             
-            check_alternate_allele_structure(alternate, type);
-            check_alternate_allele_symbolic_prefix(alternate);
+            Error * error = check_alternate_allele_structure(alternate, type);
+            if (error == nullptr) { error = check_alternate_allele_symbolic_prefix(alternate); }
+            if (error != nullptr) {
+                return error;
+            }
         }
-        
+        return nullptr;
     }
     
-    void Record::check_alternate_allele_structure(std::string const & alternate, RecordType type) const
+    Error * Record::check_alternate_allele_structure(std::string const & alternate, RecordType type) const
     {
         switch (type) {
             case RecordType::NO_VARIATION:
                 if (alternate == MISSING_VALUE && alternate_alleles.size() > 1) {
-                    throw new AlternateAllelesBodyError{line,
+                    return new AlternateAllelesBodyError{line,
                             "The no-alternate alleles symbol (dot) can not be combined with others"};
                 }
                 break;
             case RecordType::SNV:
             case RecordType::MNV:
                 if (alternate == reference_allele) {
-                    throw new AlternateAllelesBodyError{line, "Reference and alternate alleles must not be the same"};
+                    return new AlternateAllelesBodyError{line, "Reference and alternate alleles must not be the same"};
                 }
             case RecordType::INDEL:
                 // Nothing to check
@@ -186,205 +349,269 @@ namespace ebi
                 // Custom ALTs (STRUCTURAL) and break-ends (STRUCTURAL_BREAKEND) can't be checked against the reference
                 break;
         }
-        
+        return nullptr;
     }
     
-    void Record::check_alternate_allele_symbolic_prefix(std::string const & alternate) const
+    Error * Record::check_alternate_allele_symbolic_prefix(std::string const & alternate) const
     {
-        static boost::regex square_brackets_regex("<([a-zA-Z0-9:_]+)>");
-        boost::cmatch pieces_match;
-
-        if (alternate[0] == '<' && boost::regex_match(alternate.c_str(), pieces_match, square_brackets_regex)) {
-            std::string alt_id = pieces_match[1];
+        if (alternate[0] == '<' && is_symbolic_allele(alternate)) {
+            std::string alt_id = symbolic_allele_id(alternate);
             if (!boost::starts_with(alt_id, DEL) && 
                 !boost::starts_with(alt_id, INS) && 
                 !boost::starts_with(alt_id, DUP) && 
                 !boost::starts_with(alt_id, INV) && 
                 !boost::starts_with(alt_id, CNV)) {
-                throw new AlternateAllelesBodyError{line,
+                return new AlternateAllelesBodyError{line,
                         "Alternate ID is not prefixed by DEL/INS/DUP/INV/CNV and suffixed by ':' and a text sequence"};
             }
         }
+        return nullptr;
     }
-    void Record::check_quality() const
+    Error * Record::check_quality() const
     {
         if (quality < 0) {
-            throw new QualityBodyError{line, "Quality is not equal or greater than zero"};
+            return new QualityBodyError{line, "Quality is not equal or greater than zero"};
         }
+        return nullptr;
     }
     
-    void Record::check_filter() const
+    Error * Record::check_filter() const
     {
-        check_filter_no_duplicates();
-        check_filter_not_zero();
+        Error * error = check_filter_no_duplicates();
+        if (error == nullptr) { error = check_filter_not_zero(); }
+        return error;
     }
 
-    void Record::check_filter_no_duplicates() const
+    Error * Record::check_filter_no_duplicates() const
     {
-        if (source->version == Version::v43) {
-            try {
-                check_no_duplicates(filters);
-            } catch (const std::invalid_argument &ex) {
-                throw new FilterBodyError{line, "FILTER must not have duplicate filters", ErrorFix::DUPLICATE_VALUES};
-            }
+        if (source->version == Version::v43 && has_duplicates(filters)) {
+            return new FilterBodyError{line, "FILTER must not have duplicate filters", ErrorFix::DUPLICATE_VALUES};
         }
+        return nullptr;
     }
 
-    void Record::check_filter_not_zero() const
+    Error * Record::check_filter_not_zero() const
     {
         for (auto & filter : filters) {
             if (filter == "0") {
-                throw new FilterBodyError{line, "FILTER string must not be 0 (reserved value)", ErrorFix::IRRECOVERABLE_VALUE, filter};
+                return new FilterBodyError{line, "FILTER string must not be 0 (reserved value)", ErrorFix::IRRECOVERABLE_VALUE, filter};
             }
         }
+        return nullptr;
     }
 
-    void Record::check_info() const
+    Error * Record::check_info() const
     {
-        check_info_no_duplicates();
+        Error * duplicates = check_info_no_duplicates();
+        if (duplicates != nullptr) {
+            return duplicates;
+        }
 
-        typedef std::multimap<std::string, MetaEntry>::iterator iter;
-        std::pair<iter, iter> range = source->meta_entries.equal_range(INFO);
-        std::vector<std::string> values;
+        HeaderSchema const & schema = source->schema();
+        // reused by every record checked in the same thread
+        thread_local std::vector<std::string> values;
 
         // Check that INFO fields listed in the meta section
         // match the Number and Type specified in there
         for (auto & field : info) {
             if (field.first == MISSING_VALUE) { continue; } // No need to check missing data
 
-            util::string_split(field.second, ",", values);
-            bool found_in_meta = false;
-            for (iter current = range.first; current != range.second; ++current) {
-                auto & key_values = boost::get<std::map < std::string, std::string >> ((current->second).value);
-                if (key_values[ID] == field.first) {
-                    found_in_meta = true;
-                    try {
-                        check_info_field_cardinality(values, key_values[NUMBER]);
-                        check_field_type(values, key_values[TYPE]);
-                    } catch (std::shared_ptr<Error> ex) {
-                        std::string message = "INFO " + key_values[ID] + " does not match the meta" + ex->message;
-                        throw new InfoBodyError{line, message, key_values[ID] + "=" + field.second,
-                                ErrorFix::IRRECOVERABLE_VALUE, key_values[ID]};
-                    }
-
-                    break;
+            // SVLEN is compared value by value with the alleles, but is never that long
+            if (field.second.size() >= long_info_value_size && field.first != SVLEN) {
+                Error * error = check_long_info_field(field.first, field.second);
+                if (error != nullptr) {
+                    return error;
                 }
+                continue;
             }
 
-            if (!found_in_meta) {
-                try {
-                    if (source->version == Version::v41 || source->version == Version::v42) {
-                        check_predefined_tag_info(field.first, values, info_v41_v42);
-                    } else {
-                        check_predefined_tag_info(field.first, values, info_v43);
-                    }
-                } catch (std::shared_ptr<Error> ex) {
-                    throw new InfoBodyError{line, "INFO " + ex->message, field.first + "=" + field.second, ErrorFix::IRRECOVERABLE_VALUE, field.first};
+            util::string_split_into(field.second, ",", values);
+            FieldDescriptor const * meta = schema.find(INFO, field.first);
+            if (meta != nullptr) {
+                std::unique_ptr<Error> ex{check_info_field_cardinality(values, meta->number)};
+                if (!ex) { ex.reset(check_field_type(values, meta->type)); }
+                if (ex) {
+                    std::string message = "INFO " + meta->id + " does not match the meta" + ex->message;
+                    return new InfoBodyError{line, message, meta->id + "=" + field.second,
+                            ErrorFix::IRRECOVERABLE_VALUE, meta->id};
+                }
+            } else {
+                std::unique_ptr<Error> ex;
+                if (source->version == Version::v41 || source->version == Version::v42) {
+                    ex.reset(check_predefined_tag_info(field.first, values, info_v41_v42));
+                } else {
+                    ex.reset(check_predefined_tag_info(field.first, values, info_v43));
+                }
+                if (ex) {
+                    return new InfoBodyError{line, "INFO " + ex->message, field.first + "=" + field.second, ErrorFix::IRRECOVERABLE_VALUE, field.first};
                 }
             }
 
-            strict_validation_info_predefined_tags(field.first, field.second, values);
+            Error * error = strict_validation_info_predefined_tags(field.first, field.second, values);
+            if (error != nullptr) {
+                return error;
+            }
        }
+       return nullptr;
     }
     
-    void Record::check_info_no_duplicates() const
+    Error * Record::check_info_no_duplicates() const
     {
         if (source->version == Version::v43 && info.size() > 1) {
             for (auto & in : info) {
                 if (info.count(in.first) > 1) {
-                    throw new InfoBodyError{line, "INFO must not have duplicate keys", "", ErrorFix::DUPLICATE_VALUES};
+                    return new InfoBodyError{line, "INFO must not have duplicate keys", "", ErrorFix::DUPLICATE_VALUES};
                 }
             }
         }
+        return nullptr;
+    }
+
+    Error * Record::check_long_info_field(std::string const & key, std::string const & value) const
+    {
+        util::SplitRange pieces = util::split_view(value, ",");
+        size_t n_values = static_cast<size_t>(std::distance(pieces.begin(), pieces.end()));
+
+        // the checks and messages are the same as those of check_info and check_predefined_tag_info
+        FieldDescriptor const * meta = source->schema().find(INFO, key);
+        PredefinedTag const * tag = nullptr;
+        if (meta == nullptr) {
+            bool is_v41_v42 = source->version == Version::v41 || source->version == Version::v42;
+            tag = (is_v41_v42 ? info_v41_v42 : info_v43).find(key);
+        }
+        auto mismatch = [&](Error * cause) -> Error * {
+            std::unique_ptr<Error> ex{cause};
+            std::string message = meta != nullptr ? "INFO " + meta->id + " does not match the meta" + ex->message
+                                                  : "INFO " + key + " does not match the" + ex->message;
+            return new InfoBodyError{line, message, key + "=" + value, ErrorFix::IRRECOVERABLE_VALUE, key};
+        };
+
+        std::string const * type = nullptr;
+        Error * cardinality = nullptr;
+        if (meta != nullptr) {
+            type = &meta->type;
+            cardinality = check_info_field_cardinality(n_values, meta->number, Cardinality::parse(meta->number));
+        } else if (tag != nullptr) {
+            type = &type_name(tag->type);
+            cardinality = check_info_field_cardinality(n_values, tag->number, tag->cardinality);
+        }
+        if (cardinality != nullptr) {
+            return mismatch(cardinality);
+        }
+
+        // each check walks the values copying one at a time, and a String, like a sequence, is not walked at all
+        std::vector<std::string> values(1);
+        auto check_each_value = [&](std::function<Error * ()> const & check) -> Error * {
+            for (util::StringPiece const & piece : pieces) {
+                values[0].assign(piece.begin, piece.end);
+                Error * error = check();
+                if (error != nullptr) {
+                    return error;
+                }
+            }
+            return nullptr;
+        };
+        if (type != nullptr && *type != STRING) {
+            Error * error = check_each_value([&] { return check_field_type(values, *type); });
+            if (error != nullptr) {
+                return mismatch(error);
+            }
+        }
+        if (tag != nullptr && tag->type == PredefinedType::INTEGER) {
+            std::unique_ptr<Error> ex{check_each_value([&] { return check_field_integer_range(key, values); })};
+            if (ex) {
+                return new InfoBodyError{line, "INFO " + ex->message, key + "=" + value,
+                                         ErrorFix::IRRECOVERABLE_VALUE, key};
+            }
+        }
+        if (key == AF || key == CIGAR) {
+            return check_each_value([&] { return strict_validation_info_predefined_tags(key, value, values); });
+        }
+        return strict_validation_info_predefined_tags(key, value, {});
     }
 
-    void Record::check_format() const
+    Error * Record::check_format() const
     {
         if (format.size() == 0) {
-            return; // Nothing to check
+            return nullptr; // Nothing to check
         }
         
-        check_format_GT();
-        check_format_no_duplicates();
+        Error * error = check_format_GT();
+        if (error == nullptr) { error = check_format_no_duplicates(); }
+        return error;
     }
 
-    void Record::check_format_GT() const
+    Error * Record::check_format_GT() const
     {
         if (util::contains(format, GT) && format[0] != GT) {
-            throw new FormatBodyError{line, "GT must be the first field in the FORMAT column"};
+            return new FormatBodyError{line, "GT must be the first field in the FORMAT column"};
         }
+        return nullptr;
     }
 
-    void Record::check_format_no_duplicates() const
+    Error * Record::check_format_no_duplicates() const
     {
-        if (source->version == Version::v43) {
-            try {
-                check_no_duplicates(format);
-            } catch (const std::invalid_argument &ex) {
-                throw new FormatBodyError{line, "FORMAT must not have duplicate fields", ErrorFix::DUPLICATE_VALUES};
-            }
+        if (source->version == Version::v43 && has_duplicates(format)) {
+            return new FormatBodyError{line, "FORMAT must not have duplicate fields", ErrorFix::DUPLICATE_VALUES};
         }
+        return nullptr;
     }
 
-    void Record::check_predefined_tag_info(std::string const & field_key, std::vector<std::string> const & values,
-                                           std::map<std::string, std::pair<std::string, std::string>> const & tags
-                                          ) const
+    Error * Record::check_predefined_tag_info(std::string const & field_key, std::vector<std::string> const & values,
+                                              PredefinedTagTable const & tags) const
     {
-        auto iterator = tags.find(field_key);
-        if (iterator != tags.end()) {
-            try {
-                check_info_field_cardinality(values, get_predefined_number(iterator));
-                check_field_type(values, get_predefined_type(iterator));
-            } catch (std::shared_ptr<Error> ex) {
-                raise(std::make_shared<Error>(line, field_key + " does not match the" + ex->message));
+        PredefinedTag const * tag = tags.find(field_key);
+        if (tag != nullptr) {
+            std::unique_ptr<Error> ex{check_info_field_cardinality(values, tag->number, tag->cardinality)};
+            if (!ex) { ex.reset(check_field_type(values, type_name(tag->type))); }
+            if (ex) {
+                return new Error{line, field_key + " does not match the" + ex->message};
             }
-            if (get_predefined_type(iterator) == INTEGER) {
-                check_field_integer_range(field_key, values);
+            if (tag->type == PredefinedType::INTEGER) {
+                return check_field_integer_range(field_key, values);
             }
         }
+        return nullptr;
     }
 
-    void Record::check_predefined_tag_format(std::string const &field_key, std::vector<std::string> const &values,
-                                             std::map<std::string, std::pair<std::string, std::string>> const &tags,
-                                             size_t ploidy) const
+    Error * Record::check_predefined_tag_format(std::string const &field_key, SampleIndex const &index, size_t subfield,
+                                                PredefinedTag const &tag,
+                                                Cardinality const &cardinality, size_t ploidy,
+                                                GenotypeCounts &counts) const
     {
-        auto iterator = tags.find(field_key);
-        if (iterator != tags.end()) {
-            try {
-                long cardinality;
-                check_sample_field_cardinality(values, get_predefined_number(iterator), ploidy, cardinality);
-                check_field_type(values, get_predefined_type(iterator));
-            } catch (std::shared_ptr<Error> ex) {
-                raise(std::make_shared<Error>(line, field_key + " does not match the" + ex->message,
-                                              ex->detailed_message));
-            }
-            if (get_predefined_type(iterator) == INTEGER) {
-                check_field_integer_range(field_key, values);
-            }
+        long expected_cardinality;
+        std::unique_ptr<Error> ex{check_sample_field_cardinality(index.subfields[subfield].n_values, tag.number,
+                                                                 cardinality, ploidy, counts, expected_cardinality)};
+        if (!ex) { ex.reset(check_field_type(index, subfield, type_name(tag.type))); }
+        if (ex) {
+            return new Error{line, field_key + " does not match the" + ex->message, ex->detailed_message};
+        }
+        if (tag.type == PredefinedType::INTEGER) {
+            return check_field_integer_range(field_key, index, subfield);
         }
+        return nullptr;
     }
 
-    void Record::strict_validation_info_predefined_tags(std::string const & field_key, std::string const & field_value,
-                                                        std::vector<std::string> const & values) const
+    Error * Record::strict_validation_info_predefined_tags(std::string const & field_key, std::string const & field_value,
+                                                           std::vector<std::string> const & values) const
     {
         if (field_key == AA) {
-            static boost::regex aa_regex("((?![,;=])[[:print:]])+");
-            if (!boost::regex_match(field_value, aa_regex)) {
-                throw new InfoBodyError{line, "INFO AA value is not a single dot or a string of bases", "AA=" + field_value,
+            if (!is_printable_without_separators(field_value)) {
+                return new InfoBodyError{line, "INFO AA value is not a single dot or a string of bases", "AA=" + field_value,
                         ErrorFix::IRRECOVERABLE_VALUE, field_key};
             }
         } else if (field_key == AF) {
             for (auto & value : values) {
-                if (std::stold(value) < 0 || std::stold(value) > 1) {
-                    throw new InfoBodyError{line, "INFO AF value does not lie in the interval [0,1]", "AA=" + field_value,
+                long double number;
+                if (util::parse_long_double(value, number) && (number < 0 || number > 1)) {
+                    return new InfoBodyError{line, "INFO AF value does not lie in the interval [0,1]", "AA=" + field_value,
                             ErrorFix::IRRECOVERABLE_VALUE, field_key};
                 }
             }
         } else if (field_key == CIGAR) {
-            static boost::regex cigar_string("([0-9]+[MIDNSHPX])+");
             for (auto & value : values) {
-                if (!boost::regex_match(value, cigar_string)) {
-                    throw new InfoBodyError{line, "INFO CIGAR value is not an alphanumeric string compliant with the SAM specification",
+                if (!is_cigar(value)) {
+                    return new InfoBodyError{line, "INFO CIGAR value is not an alphanumeric string compliant with the SAM specification",
                             "CIGAR=" + field_value, ErrorFix::IRRECOVERABLE_VALUE, field_key};
                 }
             }
@@ -393,7 +620,7 @@ namespace ebi
             if (it != info.end() && it->second == "0") {
                 auto expected = std::to_string(position + reference_allele.length() - 1);
                 if (field_value != expected) {
-                    throw new InfoBodyError{line, "INFO END value must be equal to \"POS + length of REF - 1\" for a "
+                    return new InfoBodyError{line, "INFO END value must be equal to \"POS + length of REF - 1\" for a "
                             "precise variant (where IMPRECISE is set to 0)",
                             "END=" + field_value + ", expected value=" + expected,
                             ErrorFix::RECOVERABLE_VALUE, field_key, expected};
@@ -404,21 +631,23 @@ namespace ebi
                 if (check_alt_not_symbolic(i)) {
                     std::string expected = std::to_string(static_cast<long>(alternate_alleles[i].size()) - static_cast<long>(reference_allele.size()));
                     if (values[i] != expected) {
-                        throw new InfoBodyError{line, "INFO SVLEN must be equal to \"length of ALT - length of REF\" for "
+                        return new InfoBodyError{line, "INFO SVLEN must be equal to \"length of ALT - length of REF\" for "
                                 "non-symbolic alternate alleles", "SVLEN=" + field_value + ", expected value=" + expected,
                                 ErrorFix::RECOVERABLE_VALUE, field_key, expected};
                     }
                 } else {
                     std::string first_field = alternate_alleles[i].substr(0, 4);
                     if (first_field == "<" + INS || first_field == "<" + DUP) {
-                        if (std::stoi(values[i]) < 0) {
-                            throw new InfoBodyError{line, "INFO SVLEN must be a positive integer for longer ALT alleles", "SVLEN="
+                        int length;
+                        if (util::parse_int(values[i], length) && length < 0) {
+                            return new InfoBodyError{line, "INFO SVLEN must be a positive integer for longer ALT alleles", "SVLEN="
                                     + field_value + ", ALT allele=" + first_field.substr(1, 3),
                                     ErrorFix::IRRECOVERABLE_VALUE, field_key};
                         }
                     } else if (first_field == "<" + DEL) {
-                        if (std::stoi(values[i]) > 0) {
-                            throw new InfoBodyError{line, "INFO SVLEN must be a negative integer for shorter ALT alleles"
+                        int length;
+                        if (util::parse_int(values[i], length) && length > 0) {
+                            return new InfoBodyError{line, "INFO SVLEN must be a negative integer for shorter ALT alleles"
                                     + first_field.substr(1,3), "SVLEN=" + field_value + ", ALT allele=" + first_field.substr(1, 3),
                                     ErrorFix::IRRECOVERABLE_VALUE, field_key};
                         }
@@ -426,267 +655,346 @@ namespace ebi
                 }
             }
         }
+        return nullptr;
     }
 
     bool Record::check_alt_not_symbolic(size_t allele_index) const
     {
-        static boost::regex non_symbolic_alt_regex("[ACGTN]+", boost::regex::icase);
-        return boost::regex_match(alternate_alleles[allele_index], non_symbolic_alt_regex);
+        return is_bases(alternate_alleles[allele_index]);
     }
 
-    void Record::check_samples() const
+    Error * Record::check_samples(FormatLayout const & layout, util::WorkerPool * workers) const
     {
-        check_samples_count();
+        Error * count = check_samples_count();
+        if (count != nullptr) {
+            return count;
+        }
         
         if (samples.size() == 0) {
-            return; // Nothing to check if no samples are listed in the file
+            return nullptr; // Nothing to check if no samples are listed in the file
+        }
+
+        if (workers != nullptr && workers->size() > 1 && samples.size() >= parallel_samples_threshold) {
+            return check_samples_in_parallel(layout, *workers);
         }
         
-        std::vector<MetaEntry> format_meta = get_meta_entry_objects();
+        SampleIndex index;
+        Genotype genotype;
+        GenotypeCounts counts;
 
         for (size_t i = 0; i < samples.size(); ++i) {
-            check_sample(i, format_meta);
+            index.build(samples[i]);
+            Error * error = check_sample(i, index, genotype, counts, layout);
+            if (error != nullptr) {
+                return error;
+            }
         }
+        return nullptr;
     }
     
-    void Record::check_samples_count() const
-    {
-        if (samples.size() != source->samples_names.size()) {
-            throw new SamplesBodyError{line, "The number of samples must match those listed in the header line"};
-        }
-    }
-
-    std::vector<MetaEntry> Record::get_meta_entry_objects() const
+    Error * Record::check_samples_in_parallel(FormatLayout const & layout, util::WorkerPool & workers) const
     {
-        typedef std::multimap<std::string, MetaEntry>::iterator iter;
-        std::pair<iter, iter> range = source->meta_entries.equal_range(FORMAT);
-        std::vector<MetaEntry> format_meta;
-
-        for (auto & fm : format) {
-            bool found_in_header = false;
-            
-            for (iter current = range.first; current != range.second; ++current) {
-                auto & key_values = boost::get<std::map<std::string, std::string>>((current->second).value);
-
-                if (key_values[ID] == fm) {
-                    format_meta.push_back(current->second);
-                    found_in_header = true;
-                    break;
+        // several ranges per thread, so the threads that finish early take more of them
+        size_t n_ranges = std::min(workers.size() * 4, samples.size());
+        std::vector<std::unique_ptr<Error>> errors(n_ranges);
+        std::atomic<size_t> first_failed{n_ranges};
+
+        workers.run(n_ranges, [&](size_t range) {
+            SampleIndex index;
+            Genotype genotype;
+            GenotypeCounts counts;
+            size_t end = samples.size() * (range + 1) / n_ranges;
+            for (size_t i = samples.size() * range / n_ranges; i < end; ++i) {
+                if (range > first_failed) {
+                    return;     // a previous range failed, so this one's error would not be reported
+                }
+                index.build(samples[i]);
+                Error * error = check_sample(i, index, genotype, counts, layout);
+                if (error != nullptr) {
+                    errors[range].reset(error);
+                    size_t failed = first_failed;
+                    while (range < failed && !first_failed.compare_exchange_weak(failed, range)) {
+                    }
+                    return;
                 }
             }
-            
-            if (!found_in_header) {
-                // If not found in header, a null-value meta entry must be created to make sizes match
-                format_meta.push_back(MetaEntry{line, "", source});
+        });
+
+        for (auto & error : errors) {
+            if (error) {
+                return error.release();
             }
         }
-
-        return format_meta;
+        return nullptr;
     }
 
-    size_t Record::get_ploidy_from_GT(std::string const & sample) const
+    Error * Record::check_samples_count() const
     {
-        if (format[0] == GT) {
-            std::string::size_type pos = sample.find(':');
-            std::string GT_subfield = sample;
-            if (pos != std::string::npos) {
-                GT_subfield = sample.substr(0, pos);
-            }
-            return 1 + count_if(GT_subfield.begin(), GT_subfield.end(), [](char c) { return c == '/' || c == '|'; });
-        } else {
-            BOOST_LOG_TRIVIAL(error) << "Cannot fetch ploidy from GT as GT is not present in the FORMAT";
-            return 0;
+        if (n_samples() != source->samples_names.size()) {
+            return new SamplesBodyError{line, "The number of samples must match those listed in the header line"};
         }
+        return nullptr;
     }
 
-    void Record::check_sample(size_t i, std::vector<MetaEntry> const & format_meta) const
+    Error * Record::check_sample(size_t i, SampleIndex const & index, Genotype & genotype, GenotypeCounts & counts,
+                                 FormatLayout const & layout) const
     {
-        std::vector<std::string> subfields;
-        util::string_split(samples[i], ":", subfields);
-        
-        check_sample_subfields_count(i, subfields);
+        Error * error = check_sample_subfields_count(i, index.subfields.size());
 
         // If the first format field is not a GT, then no alleles need to be checked
-        if (format[0] == GT) {
-            check_sample_alleles(subfields);
+        size_t ploidy = 2;  // diploidy is assumed if no GT present. spec: v4.3 at 1.6.2 Genotype fields, GL, applies to FORMAT fields with Number=G
+        if (error == nullptr && layout.gt_index == 0 && !index.subfields.empty()) {
+            genotype.decode(samples[i], index.subfields[0].begin, index.subfields[0].end);
+            ploidy = genotype.ploidy;
+            error = check_sample_alleles(genotype);
         }
 
-        check_sample_subfields_cardinality_type(i, subfields, format_meta);
+        if (error == nullptr) { error = check_sample_subfields_cardinality_type(i, index, ploidy, counts, layout); }
+        return error;
     }
 
-    void Record::check_sample_subfields_count(size_t i, std::vector<std::string> const & subfields) const
+    Error * Record::check_sample_subfields_count(size_t i, size_t n_subfields) const
     {
-        if (subfields.size() > format.size()) {
-            throw new SamplesBodyError{line, "Sample #" + std::to_string(i + 1) +
-                    " has more fields than specified in the FORMAT column"};
+        if (n_subfields > format.size()) {
+            return new SamplesBodyError{line, "Sample #" + std::to_string(i + 1) +
+                    " has more fields than specified in the FORMAT column", "",
+                    "Sample has more fields than specified in the FORMAT column"};
         }
+        return nullptr;
     }
 
-    void Record::check_sample_subfields_cardinality_type(size_t i, std::vector<std::string> const & subfields,
-                                                         std::vector<MetaEntry> const & format_meta) const
+    Error * Record::check_sample_subfields_cardinality_type(size_t i, SampleIndex const & index, size_t ploidy,
+                                                            GenotypeCounts & counts, FormatLayout const & layout) const
     {
-        std::vector<std::string> values;
-        size_t ploidy = 2;  // diploidy is assumed if no GT present. spec: v4.3 at 1.6.2 Genotype fields, GL, applies to FORMAT fields with Number=G
-        if (format[0] == GT) {
-            ploidy = get_ploidy_from_GT(samples[i]);
-        }
+        for (size_t j = 0; j < index.subfields.size(); ++j) {
+            FieldDescriptor const * meta = layout.fields[j];
 
-        for (size_t j = 0; j < subfields.size(); ++j) {
-            MetaEntry meta = format_meta[j];
-            const std::string & subfield = subfields[j];
-            util::string_split(subfield, ",", values);
-
-            if (meta.is_defined_in_header()) {
-                auto &meta_entry_properties = boost::get<std::map<std::string, std::string>>(meta.value);
+            if (meta != nullptr) {
                 long expected_cardinality;
 
-                try {
-                    check_sample_field_cardinality(values, meta_entry_properties[NUMBER], ploidy, expected_cardinality);
-                    check_field_type(values, meta_entry_properties[TYPE]);
-                } catch (std::shared_ptr<Error> ex) {
+                std::unique_ptr<Error> ex{check_sample_field_cardinality(index.subfields[j].n_values, meta->number,
+                                                                         layout.cardinalities[j], ploidy, counts,
+                                                                         expected_cardinality)};
+                if (!ex) { ex.reset(check_field_type(index, j, meta->type)); }
+                if (ex) {
                     std::string message = "Sample #" + std::to_string(i + 1) + " does not match the meta" + ex->message;
-                    std::string detailed_message = meta_entry_properties[ID] + "=" + subfield + ex->detailed_message;
-                    throw new SamplesFieldBodyError{line, message, detailed_message, meta_entry_properties[ID],
-                                                    expected_cardinality};
+                    std::string detailed_message = meta->id + "=" + index.subfield_string(j) + ex->detailed_message;
+                    return new SamplesFieldBodyError{line, message, detailed_message, meta->id,
+                                                     expected_cardinality, "Sample does not match the meta" + ex->message};
                 }
-            } else {
-                try {
-                    if (source->version == Version::v41 || source->version == Version::v42) {
-                        check_predefined_tag_format(format[j], values, format_v41_v42, ploidy);
-                    } else {
-                        check_predefined_tag_format(format[j], values, format_v43, ploidy);
-                    }
-                } catch (std::shared_ptr<Error> ex) {
-                    throw new SamplesFieldBodyError{line, "Sample #" + std::to_string(i + 1) + ", " + ex->message,
-                                                    format[j] + "=" + subfield, format[j]};
+            } else if (layout.predefined[j] != nullptr) {
+                std::unique_ptr<Error> ex{check_predefined_tag_format(format[j], index, j, *layout.predefined[j],
+                                                                      layout.cardinalities[j], ploidy, counts)};
+                if (ex) {
+                    return new SamplesFieldBodyError{line, "Sample #" + std::to_string(i + 1) + ", " + ex->message,
+                                                     format[j] + "=" + index.subfield_string(j), format[j], -1,
+                                                     "Sample, " + ex->message};
                 }
             }
 
-            strict_validation_format_predefined_tags(i, format[j], subfield, values);
+            if (format[j] == GP || format[j] == CNP) {
+                Error * error = strict_validation_format_predefined_tags(i, format[j], index.subfield_string(j),
+                                                                         index.value_strings(index.subfields[j]));
+                if (error != nullptr) {
+                    return error;
+                }
+            }
         }
+        return nullptr;
     }
 
-    void Record::strict_validation_format_predefined_tags(size_t i, std::string const & field_key, std::string const & field_value,
-                                                          std::vector<std::string> const & values) const
+    Error * Record::strict_validation_format_predefined_tags(size_t i, std::string const & field_key, std::string const & field_value,
+                                                             std::vector<std::string> const & values) const
     {
         std::string message = "Sample #" + std::to_string(i + 1) + ", " + field_key + "=" + field_value + " value";
         if (field_key == GP || (field_key == CNP && source->version == Version::v43)) {
             for (auto & value : values) {
-                if (std::stold(value) < 0 || std::stold(value) > 1) {
-                    throw new SamplesFieldBodyError{line, message + " does not lie in the interval [0,1]", "", field_key};
+                long double number;
+                if (util::parse_long_double(value, number) && (number < 0 || number > 1)) {
+                    return new SamplesFieldBodyError{line, message + " does not lie in the interval [0,1]", "", field_key, -1,
+                                                     "Sample, " + field_key + " value does not lie in the interval [0,1]"};
                 }
             }
         }
+        return nullptr;
     }
 
-    void Record::check_sample_alleles(std::vector<std::string> const & subfields) const
+    Error * Record::check_sample_alleles(Genotype const & genotype) const
     {
-        std::vector<std::string> alleles;
-        util::string_split(subfields[0], "|/", alleles);
-        long ploidy = alleles.size();
-        for (auto & allele : alleles) {
-            if (allele == "") {
-                throw new SamplesFieldBodyError{line, "Allele index must not be empty", "", GT, ploidy};
+        long ploidy = genotype.alleles.size();
+        for (auto & allele : genotype.alleles) {
+            if (allele.allele_class == Genotype::AlleleClass::EMPTY) {
+                return new SamplesFieldBodyError{line, "Allele index must not be empty", "", GT, ploidy};
             }
 
-            if (allele == MISSING_VALUE) { continue; } // No need to check missing alleles
+            if (allele.allele_class == Genotype::AlleleClass::MISSING) { continue; } // No need to check missing alleles
 
-            check_sample_alleles_is_integer(allele, ploidy);
-
-            check_sample_alleles_range(allele, ploidy);
+            Error * error = check_sample_alleles_is_integer(genotype, allele, ploidy);
+            if (error == nullptr) { error = check_sample_alleles_range(allele, ploidy); }
+            if (error != nullptr) {
+                return error;
+            }
         }
+        return nullptr;
     }
 
-    void Record::check_sample_alleles_is_integer(std::string const & allele, long ploidy) const
+    Error * Record::check_sample_alleles_is_integer(Genotype const & genotype, Genotype::Allele const & allele,
+                                                    long ploidy) const
     {
-        if (util::contains_if_not(allele, isdigit)) {
-            throw new SamplesFieldBodyError{line, "Allele must be a non-negative integer number",
-                                            "Index=" + allele, GT, ploidy};
+        if (allele.allele_class != Genotype::AlleleClass::INDEX) {
+            return new SamplesFieldBodyError{line, "Allele must be a non-negative integer number",
+                                             "Index=" + genotype.allele_string(allele), GT, ploidy};
         }
+        return nullptr;
     }
 
-    void Record::check_sample_alleles_range(std::string const & allele, long ploidy) const
+    Error * Record::check_sample_alleles_range(Genotype::Allele const & allele, long ploidy) const
     {
-        size_t num_allele = std::stoi(allele);
+        size_t num_allele = allele.index;
         if (num_allele > alternate_alleles.size()) {
-            throw new SamplesFieldBodyError{line,
-                                            "Allele is greater than the maximum allowed",
-                                            "Index=" + std::to_string(num_allele) + ", maximum allowed=" + std::to_string(alternate_alleles.size()),
-                                            GT, ploidy};
+            return new SamplesFieldBodyError{line,
+                                             "Allele is greater than the maximum allowed",
+                                             "Index=" + std::to_string(num_allele) + ", maximum allowed=" + std::to_string(alternate_alleles.size()),
+                                             GT, ploidy};
         }
+        return nullptr;
     }
 
-    void Record::check_no_duplicates(std::vector<std::string> const & values) const
+    bool Record::has_duplicates(std::vector<std::string> const & values) const
     {
         if (values.size() > 1) {
             std::set<std::string> counter(values.begin(), values.end());
-            if (values.size() > counter.size()) {
-                throw std::invalid_argument("Duplicate fields");
-            }
+            return values.size() > counter.size();
         }
+        return false;
     }
 
-    bool Record::is_valid_cardinality(std::string const &number, size_t alternate_allele_number, size_t ploidy,
-                                      long &expected_cardinality) const
+    Cardinality Cardinality::parse(std::string const & number)
     {
-        bool valid = true;
-
         if (number == A) {
-            // ...the number of alternate alleles
-            expected_cardinality = alternate_allele_number;
+            return Cardinality{Kind::A, 0};
         } else if (number == R) {
-            // ...the number of alternate alleles + reference
-            expected_cardinality = alternate_allele_number + 1;
+            return Cardinality{Kind::R, 0};
         } else if (number == G) {
-            // ...the number of possible genotypes
-            // The binomial coefficient is calculated considering the ploidy of the sample
-            expected_cardinality = boost::math::binomial_coefficient<float>(alternate_alleles.size() + ploidy, ploidy);
+            return Cardinality{Kind::G, 0};
         } else if (number == UNKNOWN_CARDINALITY) {
+            return Cardinality{Kind::UNKNOWN, 0};
+        }
+        // ...specified as a number in range [0, +MAX_INT]
+        int value;
+        if (util::parse_int(number, value) && value >= 0) {
+            return Cardinality{Kind::FIXED, value};
+        }
+        return Cardinality{Kind::INVALID, 0};
+    }
+
+    GenotypeCounts::GenotypeCounts()
+    : alternate_alleles{0}
+    {
+    }
+
+    long GenotypeCounts::count(size_t alternate_alleles, size_t ploidy)
+    {
+        if (ploidy >= max_memoized_ploidy) {
+            return compute(alternate_alleles, ploidy);
+        }
+        if (alternate_alleles != this->alternate_alleles) {
+            this->alternate_alleles = alternate_alleles;
+            counts.clear();
+        }
+        if (counts.size() <= ploidy) {
+            counts.resize(ploidy + 1, -1);
+        }
+        if (counts[ploidy] == -1) {
+            counts[ploidy] = compute(alternate_alleles, ploidy);
+        }
+        return counts[ploidy];
+    }
+
+    long GenotypeCounts::compute(size_t alternate_alleles, size_t ploidy)
+    {
+        return boost::math::binomial_coefficient<float>(alternate_alleles + ploidy, ploidy);
+    }
+
+    long Record::expected_cardinality(Cardinality const & cardinality, size_t ploidy, GenotypeCounts & counts) const
+    {
+        switch (cardinality.kind) {
+        case Cardinality::Kind::FIXED:
+            return cardinality.value;
+        case Cardinality::Kind::A:
+            // ...the number of alternate alleles
+            return alternate_alleles.size();
+        case Cardinality::Kind::R:
+            // ...the number of alternate alleles + reference
+            return alternate_alleles.size() + 1;
+        case Cardinality::Kind::G:
+            // ...the number of possible genotypes, considering the ploidy of the sample
+            return counts.count(alternate_alleles.size(), ploidy);
+        default:
             // ...it is unspecified
-            expected_cardinality = -1;
-        } else {
-            // ...specified as a number in range [0, +MAX_LONG)
-            try {
-                expected_cardinality = stoi(number);
-                if (expected_cardinality < 0) {
-                    expected_cardinality = -1;
-                    valid = false;
-                }
-            } catch (...) {
-                expected_cardinality = -1;
-                valid = false;
-            }
+            return -1;
         }
-        return valid;
     }
 
-    void Record::check_info_field_cardinality(std::vector<std::string> const &values, std::string const &number) const
+    Error * Record::check_info_field_cardinality(std::vector<std::string> const &values, std::string const &number) const
     {
-        if (number != G) {
-            long cardinality;
+        return check_info_field_cardinality(values, number, Cardinality::parse(number));
+    }
+
+    Error * Record::check_info_field_cardinality(std::vector<std::string> const &values, std::string const &number,
+                                                 Cardinality const &cardinality) const
+    {
+        return check_info_field_cardinality(values.size(), number, cardinality);
+    }
+
+    Error * Record::check_info_field_cardinality(size_t n_values, std::string const &number,
+                                                 Cardinality const &cardinality) const
+    {
+        if (cardinality.kind != Cardinality::Kind::G) {
+            long expected_cardinality;
             size_t ploidy = 0;
-            check_sample_field_cardinality(values, number, ploidy, cardinality);
+            GenotypeCounts counts;
+            return check_sample_field_cardinality(n_values, number, cardinality, ploidy, counts,
+                                                  expected_cardinality);
         } else {
             // this case is not well defined, we just skip this check and allow any cardinality
             // for further discussion see https://github.com/samtools/hts-specs/issues/272
+            return nullptr;
         }
     }
 
-    void Record::check_sample_field_cardinality(std::vector<std::string> const &values, std::string const &number,
-                                                size_t ploidy, long &expected_cardinality) const
+    Error * Record::check_sample_field_cardinality(std::vector<std::string> const &values, std::string const &number,
+                                                   size_t ploidy, long &expected_cardinality) const
+    {
+        return check_sample_field_cardinality(values.size(), number, ploidy, expected_cardinality);
+    }
+
+    Error * Record::check_sample_field_cardinality(size_t n_values, std::string const &number,
+                                                   size_t ploidy, long &expected_cardinality) const
+    {
+        GenotypeCounts counts;
+        return check_sample_field_cardinality(n_values, number, Cardinality::parse(number), ploidy, counts,
+                                              expected_cardinality);
+    }
+
+    Error * Record::check_sample_field_cardinality(size_t n_values, std::string const &number,
+                                                   Cardinality const &cardinality, size_t ploidy,
+                                                   GenotypeCounts &counts, long &expected_cardinality) const
     {
-        if (not is_valid_cardinality(number, alternate_alleles.size(), ploidy, expected_cardinality)) {
-            raise(std::make_shared<Error>(line, " meta specification Number=" + number
-                    + " is not one of [A, R, G, ., <non-negative number>]"));
+        if (cardinality.kind == Cardinality::Kind::INVALID) {
+            expected_cardinality = -1;
+            return new Error{line, " meta specification Number=" + number
+                    + " is not one of [A, R, G, ., <non-negative number>]"};
         }
+        expected_cardinality = this->expected_cardinality(cardinality, ploidy, counts);
 
         bool number_matches = true;
         if (expected_cardinality > 0) {
             // The number of values must match the expected cardinality
-            number_matches = (values.size() == static_cast<size_t>(expected_cardinality));
+            number_matches = (n_values == static_cast<size_t>(expected_cardinality));
         } else if (expected_cardinality == 0) {
             // There will be one empty value that needs to be specifically checked
-            number_matches = values.size() == 0 || values.size() == 1;
+            number_matches = n_values == 0 || n_values == 1;
         } else {
             // if number=".", then `expected_cardinality` was set to -1, and it should always match, letting `number_matches` as true
         }
@@ -695,79 +1003,146 @@ namespace ebi
             std::string message = " specification Number=" + number + " (expected "
                     + std::to_string(expected_cardinality) + " value(s))";
             std::string detailed_message;
-            if (number == G) {
+            if (cardinality.kind == Cardinality::Kind::G) {
                 detailed_message = ". It must derive its number of values from the ploidy of GT (if present), or "
-                        "assume diploidy. Contains " + std::to_string(values.size()) + " value(s), expected "
+                        "assume diploidy. Contains " + std::to_string(n_values) + " value(s), expected "
                         + std::to_string(expected_cardinality) + " (derived from ploidy " + std::to_string(ploidy)
                         + ")";
             }
-            raise(std::make_shared<Error>(line, message, detailed_message));
+            return new Error{line, message, detailed_message};
         }
+        return nullptr;
     }
 
-    void Record::check_value_type(std::string const & type, std::string const & value, std::string & message) const {
+    bool Record::is_value_of_type(std::string const & type, std::string const & value, std::string & message) const {
+        // a value that is not a number, or out of range, is not of a numeric type
         if (type == INTEGER) {
             // ...try to cast to int
-            std::stoi(value);
+            int integer_value;
+            float float_value;
+            if (!util::parse_int(value, integer_value) || !util::parse_float(value, float_value)) {
+                return false;
+            }
             // ...and also check it's not a float
-            if (std::fmod(std::stof(value), 1) != 0) {
+            if (std::fmod(float_value, 1) != 0) {
                 message = " (an integer must not contain decimal digits)";
-                throw std::invalid_argument(message);
+                return false;
             }
         } else if (type == FLOAT) {
             // ...try to cast to float
-            try {
-                std::stof(value);
-            } catch (std::out_of_range) {
-                // It maybe a subnormal number
-                std::stold(value);
+            float float_value;
+            long double long_double_value;
+            if (!util::parse_float(value, float_value) && !util::parse_long_double(value, long_double_value)) {
+                // It is not even a subnormal number
+                return false;
             }
         } else if (type == FLAG) {
-            int numeric_value = std::stoi(value);
+            int numeric_value;
+            if (!util::parse_int(value, numeric_value)) {
+                return false;
+            }
             if (value.size() > 1 || (numeric_value != 0 && numeric_value != 1)) {
                 message = " (a flag value must be \"0, 1 or none\")";
-                throw std::invalid_argument(message);
+                return false;
             }
             // If no flag is provided then there is nothing to check
         } else if (type == CHARACTER) {
             // ...check the length is 1
             if (value.size() > 1) {
                 message = " (there can be only one character)";
-                throw std::invalid_argument(message);
+                return false;
             }
         } else if (type == STRING) {
             // ...do nothing, it is guaranteed it will be a string
         }
+        return true;
     }
 
-    void Record::check_field_type(std::vector<std::string> const & values,
-                                  std::string const & type) const
+    Error * Record::check_field_type(std::vector<std::string> const & values,
+                                     std::string const & type) const
     {
         // To check the field type...
         for (auto & value : values) {
             if (value == MISSING_VALUE) { continue; }
 
-            std::string message;
-            try {
-                check_value_type(type, value, message);
-            } catch (const std::exception &typeError) {
-                raise(std::make_shared<Error>(line, " specification Type=" + type + message));
+            Error * error = check_field_value_type(type, value);
+            if (error != nullptr) {
+                return error;
+            }
+        }
+        return nullptr;
+    }
+
+    Error * Record::check_field_type(SampleIndex const & index, size_t subfield, std::string const & type) const
+    {
+        bool accepts_integers = type == INTEGER || type == FLOAT;
+        bool accepts_decimals = type == FLOAT;
+        auto & current = index.subfields[subfield];
+
+        for (size_t i = current.first_value; i < current.first_value + current.n_values; ++i) {
+            auto & value = index.values[i];
+            switch (value.value_class) {
+                case ValueClass::MISSING:
+                    continue;
+                case ValueClass::INTEGER:
+                    if (accepts_integers) { continue; }
+                    break;
+                case ValueClass::DECIMAL:
+                    if (accepts_decimals) { continue; }
+                    break;
+                case ValueClass::OTHER:
+                    break;
+            }
+            // the shape of the value is not enough, parse it
+            Error * error = check_field_value_type(type, index.value_string(value));
+            if (error != nullptr) {
+                return error;
             }
         }
+        return nullptr;
     }
 
-    void Record::check_field_integer_range(std::string const & field, std::vector<std::string> const & values) const {
+    Error * Record::check_field_value_type(std::string const & type, std::string const & value) const
+    {
+        std::string message;
+        if (!is_value_of_type(type, value, message)) {
+            return new Error{line, " specification Type=" + type + message};
+        }
+        return nullptr;
+    }
+
+    Error * Record::check_field_integer_range(std::string const & field, std::vector<std::string> const & values) const {
         if (field == SVLEN || field == CIPOS || field == CIEND || field == CILEN || field == CICN || field == CICNADJ) {
             // to ignore predefined tag fields which permit negative integral values
-            return;
+            return nullptr;
         }
         for (auto & value : values) {
             if (value == MISSING_VALUE) { continue; }
 
-            if (std::stoi(value) < 0) {
-                raise(std::make_shared<Error>(line, field + " value must be a non-negative integer number"));
+            int number;
+            if (util::parse_int(value, number) && number < 0) {
+                return new Error{line, field + " value must be a non-negative integer number"};
+            }
+        }
+        return nullptr;
+    }
+
+    Error * Record::check_field_integer_range(std::string const & field, SampleIndex const & index, size_t subfield) const
+    {
+        auto & current = index.subfields[subfield];
+        for (size_t i = current.first_value; i < current.first_value + current.n_values; ++i) {
+            auto & value = index.values[i];
+            if (value.value_class == ValueClass::MISSING) { continue; }
+
+            if (value.value_class == ValueClass::INTEGER && (*index.sample)[value.begin] != '-') {
+                continue;   // non-negative by construction
+            }
+            Error * error = check_field_integer_range(field, std::vector<std::string>{index.value_string(value)});
+            if (error != nullptr) {
+                return error;
             }
         }
+        return nullptr;
     }
 
     bool is_record_subfield_in_header(std::string const & field_value,
@@ -0,0 +1,875 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#include <boost/filesystem.hpp>
+
+#include "util/bgzf_writer.hpp"
+#include "util/gzip_block_reader.hpp"
+#include "vcf/region_index.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+
+    namespace
+    {
+      /**
+       * Parses a position that may have thousands separators
+       */
+      uint64_t parse_position(std::string const & text, std::string const & region)
+      {
+          std::string digits;
+          for (char c : text) {
+              if (c >= '0' && c <= '9') {
+                  digits += c;
+              } else if (c != ',') {
+                  throw std::invalid_argument{"The region " + region + " doesn't have valid positions"};
+              }
+          }
+          if (digits.empty() || digits.size() > 18) {
+              throw std::invalid_argument{"The region " + region + " doesn't have valid positions"};
+          }
+          return std::stoull(digits);
+      }
+
+      /**
+       * Reads the little-endian integers of an index, checking it is not truncated
+       */
+      struct IndexBytes
+      {
+          char const * p;
+          char const * end;
+
+          uint64_t read(size_t size)
+          {
+              if (static_cast<size_t>(end - p) < size) {
+                  throw std::runtime_error{"The index is truncated"};
+              }
+              uint64_t value = 0;
+              for (size_t i = 0; i < size; ++i) {
+                  value |= static_cast<uint64_t>(static_cast<unsigned char>(p[i])) << (8 * i);
+              }
+              p += size;
+              return value;
+          }
+
+          uint32_t read_uint32() { return static_cast<uint32_t>(read(4)); }
+          uint64_t read_uint64() { return read(8); }
+
+          int32_t read_count()
+          {
+              int32_t count = static_cast<int32_t>(read_uint32());
+              if (count < 0) {
+                  throw std::runtime_error{"The index has a negative count"};
+              }
+              return count;
+          }
+
+          /**
+           * Count of items that take at least `item_size` bytes each, checked against the bytes left
+           */
+          int32_t read_count(size_t item_size)
+          {
+              int32_t count = read_count();
+              if (static_cast<size_t>(end - p) / item_size < static_cast<size_t>(count)) {
+                  throw std::runtime_error{"The index is truncated"};
+              }
+              return count;
+          }
+
+          char const * skip(size_t size)
+          {
+              if (static_cast<size_t>(end - p) < size) {
+                  throw std::runtime_error{"The index is truncated"};
+              }
+              char const * skipped = p;
+              p += size;
+              return skipped;
+          }
+      };
+
+      std::vector<RegionIndex::Chunk> read_chunks(IndexBytes & bytes)
+      {
+          int32_t n_chunks = bytes.read_count();
+          std::vector<RegionIndex::Chunk> chunks;
+          for (int32_t i = 0; i < n_chunks; ++i) {
+              util::VirtualOffset begin = bytes.read_uint64();
+              util::VirtualOffset end = bytes.read_uint64();
+              chunks.emplace_back(begin, end);
+          }
+          return chunks;
+      }
+
+      /**
+       * Bins that overlap [begin, end) in every level, like reg2bins in the CSI specification
+       */
+      std::vector<uint32_t> overlapping_bins(uint64_t begin, uint64_t end, int min_shift, int depth)
+      {
+          std::vector<uint32_t> bins;
+          --end;
+          for (int level = 0; level <= depth; ++level) {
+              uint32_t first_bin = ((uint32_t{1} << (3 * level)) - 1) / 7;
+              int shift = min_shift + 3 * (depth - level);
+              for (uint64_t bin = first_bin + (begin >> shift); bin <= first_bin + (end >> shift); ++bin) {
+                  bins.push_back(static_cast<uint32_t>(bin));
+              }
+          }
+          return bins;
+      }
+
+      /**
+       * Position of the tab that ends the column starting at `p`, or `end`
+       */
+      char const * column_end(char const * p, char const * end)
+      {
+          char const * tab = static_cast<char const *>(std::memchr(p, '\t', end - p));
+          return tab != nullptr ? tab : end;
+      }
+
+      /**
+       * Reads the digits at the beginning of [p, end)
+       * @return the end of the digits, or nullptr if there are none
+       */
+      char const * read_number(char const * p, char const * end, uint64_t & number)
+      {
+          number = 0;
+          char const * begin = p;
+          for (; p != end && *p >= '0' && *p <= '9' && p - begin < 18; ++p) {
+              number = number * 10 + (*p - '0');
+          }
+          return p != begin ? p : nullptr;
+      }
+
+      /**
+       * Reads the bases of a record, 0-based and half-open: from its position to the end of its reference allele,
+       * or to its INFO END if it is further
+       * @return false if the record has no position or reference allele
+       */
+      bool read_record_interval(char const * begin, char const * end, uint64_t & record_begin,
+                                uint64_t & record_end)
+      {
+          // the columns of the position, reference allele and INFO
+          char const * columns[8];
+          char const * p = begin;
+          for (size_t i = 0; i < 8; ++i) {
+              columns[i] = p;
+              p = column_end(p, end);
+              if (p == end && i < 3) {
+                  return false;
+              }
+              p = p != end ? p + 1 : end;
+          }
+          uint64_t position;
+          if (read_number(columns[1], end, position) != column_end(columns[1], end)) {
+              return false;
+          }
+          record_begin = position != 0 ? position - 1 : 0;
+          record_end = record_begin + std::max<uint64_t>(column_end(columns[3], end) - columns[3], 1);
+
+          // INFO END is the last position of a structural variant or a reference block
+          std::string const end_key = "END=";
+          char const * info = columns[7];
+          char const * info_end = column_end(info, end);
+          for (char const * key = info; key < info_end; ) {
+              char const * key_end = std::find(key, info_end, ';');
+              uint64_t end_position;
+              if (static_cast<size_t>(key_end - key) > end_key.size()
+                      && std::equal(end_key.begin(), end_key.end(), key)
+                      && read_number(key + end_key.size(), key_end, end_position) != nullptr) {
+                  record_end = std::max(record_end, end_position);
+              }
+              key = key_end + 1;
+          }
+          return true;
+      }
+
+      uint32_t first_bin(int level)
+      {
+          return ((uint32_t{1} << (3 * level)) - 1) / 7;
+      }
+
+      /**
+       * Smallest bin that contains [begin, end), like reg2bin in the CSI specification
+       */
+      uint32_t bin_of(uint64_t begin, uint64_t end, int min_shift, int depth)
+      {
+          --end;
+          for (int level = depth; level > 0; --level) {
+              int shift = min_shift + 3 * (depth - level);
+              if (begin >> shift == end >> shift) {
+                  return first_bin(level) + static_cast<uint32_t>(begin >> shift);
+              }
+          }
+          return 0;
+      }
+
+      /**
+       * Window of the linear index where a bin begins
+       */
+      size_t first_window(uint32_t bin, int depth)
+      {
+          int level = 0;
+          while (level < depth && bin >= first_bin(level + 1)) {
+              ++level;
+          }
+          return static_cast<size_t>(bin - first_bin(level)) << (3 * (depth - level));
+      }
+
+      void write_number(std::ostream & output, uint64_t value, size_t size)
+      {
+          char bytes[8];
+          for (size_t i = 0; i < size; ++i) {
+              bytes[i] = static_cast<char>((value >> (8 * i)) & 0xff);
+          }
+          output.write(bytes, size);
+      }
+
+      util::VirtualOffset const no_offset = ~util::VirtualOffset{0};
+    }
+
+    Region parse_region(std::string const & text)
+    {
+        Region region{text, 0, max_region_end};
+
+        // a colon can be part of a contig name, so it only starts the positions if they follow
+        size_t colon = text.rfind(':');
+        if (colon != std::string::npos && colon != 0 && colon + 1 != text.size()
+                && text.find_first_not_of("0123456789,-", colon + 1) == std::string::npos) {
+            region.contig = text.substr(0, colon);
+            std::string positions = text.substr(colon + 1);
+            size_t dash = positions.find('-');
+            uint64_t start = parse_position(positions.substr(0, dash), text);
+            if (dash != std::string::npos && dash + 1 != positions.size()) {
+                region.end = parse_position(positions.substr(dash + 1), text);
+            }
+            if (start == 0 || region.end < start) {
+                throw std::invalid_argument{"The region " + text + " is empty"};
+            }
+            region.begin = start - 1;
+        }
+        if (region.contig.empty()) {
+            throw std::invalid_argument{"The region " + text + " doesn't have a contig"};
+        }
+        return region;
+    }
+
+    std::vector<Region> read_bed_regions(std::istream & input)
+    {
+        std::vector<Region> regions;
+        std::string line;
+        for (size_t line_number = 1; std::getline(input, line); ++line_number) {
+            if (!line.empty() && line.back() == '\r') {
+                line.pop_back();
+            }
+            if (line.empty() || line[0] == '#' || line.compare(0, 5, "track") == 0
+                    || line.compare(0, 7, "browser") == 0) {
+                continue;
+            }
+
+            std::istringstream columns{line};
+            Region region;
+            if (!(columns >> region.contig >> region.begin >> region.end) || region.end < region.begin) {
+                throw std::invalid_argument{"Line " + std::to_string(line_number)
+                                            + " of the BED file doesn't have a contig, a start and an end"};
+            }
+            // an empty interval marks the point between two bases, like an insertion
+            region.end = std::max(region.end, region.begin + 1);
+            regions.push_back(region);
+        }
+        return regions;
+    }
+
+    RegionIndex::RegionIndex(std::string const & path) : min_shift{14}, depth{5}
+    {
+        std::ifstream file{path, std::ios::binary};
+        if (!file) {
+            throw std::runtime_error{"Couldn't open the index " + path};
+        }
+
+        // both formats are compressed with BGZF
+        util::StreamBlockReader compressed{file};
+        util::GzipBlockReader reader{compressed};
+        std::vector<char> bytes;
+        util::Block block;
+        while (reader.read(block)) {
+            bytes.insert(bytes.end(), block.data, block.data + block.size);
+        }
+
+        try {
+            if (bytes.size() >= 4 && std::equal(bytes.begin(), bytes.begin() + 4, "TBI\1")) {
+                read_tabix(bytes);
+            } else if (bytes.size() >= 4 && std::equal(bytes.begin(), bytes.begin() + 4, "CSI\1")) {
+                read_csi(bytes);
+            } else {
+                throw std::runtime_error{"it is not a tabix or CSI index"};
+            }
+        } catch (std::runtime_error const & ex) {
+            throw std::runtime_error{"Couldn't read the index " + path + ": " + ex.what()};
+        }
+    }
+
+    void RegionIndex::read_tabix(std::vector<char> const & bytes)
+    {
+        IndexBytes index{bytes.data() + 4, bytes.data() + bytes.size()};
+        int32_t n_references = index.read_count();
+        index.skip(6 * 4);      // format, columns of the contig and positions, comment character and skipped lines
+        int32_t names_size = index.read_count();
+        read_names(index.skip(names_size), names_size);
+
+        // every contig has a name, and at least the counts of its bins and windows
+        size_t const min_reference_size = 2 * 4;
+        if (static_cast<size_t>(n_references) > reference_ids.size()
+                || static_cast<size_t>(index.end - index.p) / min_reference_size < static_cast<size_t>(n_references)) {
+            throw std::runtime_error{"The index is truncated"};
+        }
+        references.resize(n_references);
+        for (auto & reference : references) {
+            int32_t n_bins = index.read_count();
+            for (int32_t i = 0; i < n_bins; ++i) {
+                uint32_t bin = index.read_uint32();
+                reference.bins[bin] = read_chunks(index);
+            }
+            int32_t n_windows = index.read_count();
+            for (int32_t i = 0; i < n_windows; ++i) {
+                reference.linear_index.push_back(index.read_uint64());
+            }
+        }
+    }
+
+    void RegionIndex::read_csi(std::vector<char> const & bytes)
+    {
+        IndexBytes index{bytes.data() + 4, bytes.data() + bytes.size()};
+        min_shift = static_cast<int>(index.read_count());
+        depth = static_cast<int>(index.read_count());
+        if (min_shift + 3 * depth > 62) {
+            throw std::runtime_error{"the bins are too large"};
+        }
+
+        // the contig names are in the same header as tabix, which VCF indexes keep in the auxiliary data
+        int32_t aux_size = index.read_count();
+        IndexBytes aux{index.skip(aux_size), index.p};
+        if (aux_size < 7 * 4) {
+            throw std::runtime_error{"it doesn't have the names of the contigs"};
+        }
+        aux.skip(6 * 4);
+        int32_t names_size = aux.read_count();
+        read_names(aux.skip(names_size), names_size);
+
+        // every contig has at least the count of its bins
+        references.resize(index.read_count(4));
+        for (auto & reference : references) {
+            int32_t n_bins = index.read_count();
+            for (int32_t i = 0; i < n_bins; ++i) {
+                uint32_t bin = index.read_uint32();
+                reference.bin_offsets[bin] = index.read_uint64();
+                reference.bins[bin] = read_chunks(index);
+            }
+        }
+    }
+
+    void RegionIndex::read_names(char const * names, size_t size)
+    {
+        char const * end = names + size;
+        while (names != end) {
+            char const * name_end = std::find(names, end, '\0');
+            reference_ids.emplace(std::string{names, name_end}, reference_ids.size());
+            names = name_end != end ? name_end + 1 : end;
+        }
+    }
+
+    std::vector<RegionIndex::Chunk> RegionIndex::chunks(std::vector<Region> const & regions) const
+    {
+        std::vector<Chunk> chunks;
+        uint64_t max_end = uint64_t{1} << (min_shift + 3 * depth);
+
+        for (auto & region : regions) {
+            auto id = reference_ids.find(region.contig);
+            if (id == reference_ids.end() || id->second >= references.size()) {
+                continue;   // no records in that contig
+            }
+            uint64_t end = std::min(region.end, max_end);
+            if (region.begin >= end) {
+                continue;
+            }
+
+            Reference const & reference = references[id->second];
+            util::VirtualOffset first = min_offset(reference, region.begin);
+            for (uint32_t bin : overlapping_bins(region.begin, end, min_shift, depth)) {
+                auto bin_chunks = reference.bins.find(bin);
+                if (bin_chunks == reference.bins.end()) {
+                    continue;
+                }
+                for (auto & chunk : bin_chunks->second) {
+                    if (chunk.second > first) {
+                        chunks.push_back(chunk);
+                    }
+                }
+            }
+        }
+
+        // the chunks that overlap, or share a compressed block, are read at once
+        std::sort(chunks.begin(), chunks.end());
+        std::vector<Chunk> merged;
+        for (auto & chunk : chunks) {
+            if (!merged.empty() && (chunk.first >> 16) <= (merged.back().second >> 16)) {
+                merged.back().second = std::max(merged.back().second, chunk.second);
+            } else {
+                merged.push_back(chunk);
+            }
+        }
+        return merged;
+    }
+
+    std::vector<util::VirtualOffset> RegionIndex::record_offsets() const
+    {
+        // the pseudo-bin after the last one keeps the number of records instead of chunks
+        uint32_t pseudo_bin = ((uint32_t{1} << (3 * (depth + 1))) - 1) / 7 + 1;
+
+        std::vector<util::VirtualOffset> offsets;
+        for (auto & reference : references) {
+            for (auto & bin : reference.bins) {
+                if (bin.first >= pseudo_bin) {
+                    continue;
+                }
+                for (auto & chunk : bin.second) {
+                    offsets.push_back(chunk.first);
+                    offsets.push_back(chunk.second);
+                }
+                auto bin_offset = reference.bin_offsets.find(bin.first);
+                if (bin_offset != reference.bin_offsets.end()) {
+                    offsets.push_back(bin_offset->second);
+                }
+            }
+            offsets.insert(offsets.end(), reference.linear_index.begin(), reference.linear_index.end());
+        }
+        std::sort(offsets.begin(), offsets.end());
+        offsets.erase(std::unique(offsets.begin(), offsets.end()), offsets.end());
+        return offsets;
+    }
+
+    util::VirtualOffset RegionIndex::min_offset(Reference const & reference, uint64_t position) const
+    {
+        if (!reference.linear_index.empty()) {
+            size_t window = static_cast<size_t>(position >> min_shift);
+            return window < reference.linear_index.size() ? reference.linear_index[window] : 0;
+        }
+
+        // the smallest bin with records that contains the position
+        uint32_t bin = ((uint32_t{1} << (3 * depth)) - 1) / 7 + static_cast<uint32_t>(position >> min_shift);
+        while (true) {
+            auto offset = reference.bin_offsets.find(bin);
+            if (offset != reference.bin_offsets.end()) {
+                return offset->second;
+            }
+            if (bin == 0) {
+                return 0;
+            }
+            bin = (bin - 1) >> 3;
+        }
+    }
+
+    std::string RegionIndex::find(std::string const & path)
+    {
+        for (std::string extension : {".tbi", ".csi"}) {
+            if (boost::filesystem::exists(path + extension)) {
+                return path + extension;
+            }
+        }
+        return "";
+    }
+
+    RegionBlockReader::RegionBlockReader(util::Block compressed,
+                                         RegionIndex const & index,
+                                         std::vector<Region> const & regions,
+                                         size_t block_size)
+    : ranges{compressed, index.chunks(regions)}, block_size{block_size}
+    {
+        for (auto & region : regions) {
+            intervals[region.contig].emplace_back(region.begin, region.end);
+        }
+        for (auto & contig : intervals) {
+            auto & contig_intervals = contig.second;
+            std::sort(contig_intervals.begin(), contig_intervals.end());
+            std::vector<std::pair<uint64_t, uint64_t>> merged;
+            for (auto & interval : contig_intervals) {
+                if (!merged.empty() && interval.first <= merged.back().second) {
+                    merged.back().second = std::max(merged.back().second, interval.second);
+                } else {
+                    merged.push_back(interval);
+                }
+            }
+            contig_intervals.swap(merged);
+        }
+    }
+
+    bool RegionBlockReader::overlaps(char const * begin, char const * end) const
+    {
+        char const * contig_end = column_end(begin, end);
+        auto contig = intervals.find(std::string{begin, contig_end});
+        if (contig == intervals.end()) {
+            return false;
+        }
+
+        // a malformed record is left to the parser
+        uint64_t record_begin;
+        uint64_t record_end;
+        if (!read_record_interval(begin, end, record_begin, record_end)) {
+            return true;
+        }
+
+        // the intervals are merged, so their ends are sorted too
+        auto & contig_intervals = contig->second;
+        auto interval = std::upper_bound(contig_intervals.begin(), contig_intervals.end(), record_begin,
+                                         [](uint64_t position, std::pair<uint64_t, uint64_t> const & interval) {
+                                             return position < interval.second;
+                                         });
+        return interval != contig_intervals.end() && interval->first < record_end;
+    }
+
+    bool RegionBlockReader::next_block(util::Block & block)
+    {
+        buffer.clear();
+        util::Block range;
+        while (buffer.size() < block_size) {
+            if (!ranges.read(range)) {
+                // the last line of the file may have no newline
+                if (!partial_line.empty()) {
+                    add_line(partial_line.data(), partial_line.data() + partial_line.size());
+                    partial_line.clear();
+                }
+                break;
+            }
+
+            char const * p = range.data;
+            char const * range_end = range.data + range.size;
+            while (p != range_end) {
+                char const * newline = static_cast<char const *>(std::memchr(p, '\n', range_end - p));
+                if (newline == nullptr) {
+                    partial_line.insert(partial_line.end(), p, range_end);
+                    break;
+                }
+                if (partial_line.empty()) {
+                    add_line(p, newline + 1);
+                } else {
+                    partial_line.insert(partial_line.end(), p, newline + 1);
+                    add_line(partial_line.data(), partial_line.data() + partial_line.size());
+                    partial_line.clear();
+                }
+                p = newline + 1;
+            }
+        }
+
+        block = util::Block{buffer.data(), buffer.size()};
+        return !buffer.empty();
+    }
+
+    void RegionBlockReader::add_line(char const * begin, char const * end)
+    {
+        if (overlaps(begin, end)) {
+            buffer.insert(buffer.end(), begin, end);
+        }
+    }
+
+    RegionIndexBuilder::RegionIndexBuilder(Format format)
+    : format{format}, min_shift{14}, depth{format == Format::TABIX ? 5 : 6}, previous_begin{0}, chunk_bin{0},
+      chunk{0, 0}, n_lines{0}, finished{false}
+    {
+    }
+
+    void RegionIndexBuilder::add_line(char const * begin, char const * end, util::VirtualOffset line_begin,
+                                      util::VirtualOffset line_end)
+    {
+        ++n_lines;
+        if (!error.empty() || begin == end || *begin == '#') {
+            return;
+        }
+
+        uint64_t record_begin;
+        uint64_t record_end;
+        if (!read_record_interval(begin, end, record_begin, record_end)) {
+            fail("the line " + std::to_string(n_lines) + " has no position");
+            return;
+        }
+        add_record(std::string{begin, column_end(begin, end)}, record_begin, record_end, line_begin, line_end);
+    }
+
+    void RegionIndexBuilder::add_record(std::string const & contig, uint64_t begin, uint64_t end,
+                                        util::VirtualOffset line_begin, util::VirtualOffset line_end)
+    {
+        if (end > uint64_t{1} << (min_shift + 3 * depth)) {
+            fail("the record in the line " + std::to_string(n_lines) + " ends after the last position of a "
+                 + (format == Format::TABIX ? "tabix index, please write a CSI one" : "CSI index"));
+            return;
+        }
+
+        if (references.empty() || references.back().name != contig) {
+            if (reference_ids.count(contig) != 0) {
+                fail("the records of the contig " + contig + " are not together, the line "
+                     + std::to_string(n_lines) + " is after others");
+                return;
+            }
+            if (!references.empty()) {
+                end_chunk();
+            }
+            reference_ids.emplace(contig, references.size());
+            references.push_back(Reference{contig, {}, {}, Chunk{line_begin, line_end}, 0});
+            previous_begin = 0;
+        } else if (begin < previous_begin) {
+            fail("the contig " + contig + " is not sorted by position, the line " + std::to_string(n_lines)
+                 + " is before the previous one");
+            return;
+        }
+
+        Reference & reference = references.back();
+        previous_begin = begin;
+        reference.records.second = line_end;
+        ++reference.n_records;
+
+        // consecutive records of the same bin are a single chunk
+        uint32_t bin = bin_of(begin, end, min_shift, depth);
+        if (reference.n_records == 1 || bin != chunk_bin) {
+            if (reference.n_records != 1) {
+                end_chunk();
+            }
+            chunk_bin = bin;
+            chunk = Chunk{line_begin, line_end};
+        } else {
+            chunk.second = line_end;
+        }
+
+        // the windows of the record that no previous record overlaps start with it
+        size_t last_window = static_cast<size_t>((end - 1) >> min_shift);
+        if (reference.linear_index.size() <= last_window) {
+            reference.linear_index.resize(last_window + 1, no_offset);
+        }
+        for (size_t window = static_cast<size_t>(begin >> min_shift); window <= last_window; ++window) {
+            if (reference.linear_index[window] == no_offset) {
+                reference.linear_index[window] = line_begin;
+            }
+        }
+    }
+
+    void RegionIndexBuilder::end_chunk()
+    {
+        // the chunks that share a compressed block are read at once anyway
+        std::vector<Chunk> & chunks = references.back().bins[chunk_bin];
+        if (!chunks.empty() && (chunks.back().second >> 16) == (chunk.first >> 16)) {
+            chunks.back().second = chunk.second;
+        } else {
+            chunks.push_back(chunk);
+        }
+    }
+
+    void RegionIndexBuilder::finish()
+    {
+        if (finished) {
+            return;
+        }
+        finished = true;
+        if (!error.empty()) {
+            return;
+        }
+        if (!references.empty()) {
+            end_chunk();
+        }
+
+        // the windows before the first record start with it, and those without records with the previous one
+        for (auto & reference : references) {
+            util::VirtualOffset previous = reference.records.first;
+            for (auto & offset : reference.linear_index) {
+                if (offset == no_offset) {
+                    offset = previous;
+                }
+                previous = offset;
+            }
+        }
+    }
+
+    void RegionIndexBuilder::fail(std::string const & reason)
+    {
+        if (error.empty()) {
+            error = reason;
+        }
+    }
+
+    std::string RegionIndexBuilder::failure() const
+    {
+        if (error.empty() && !finished) {
+            return "the validation stopped before the end of the file";
+        }
+        return error;
+    }
+
+    void RegionIndexBuilder::write(std::string const & path) const
+    {
+        std::string reason = failure();
+        if (!reason.empty()) {
+            throw std::runtime_error{"Couldn't write the index " + path + ": " + reason};
+        }
+
+        // the pseudo-bin after the last one keeps the offsets of all the records and how many there are
+        uint32_t pseudo_bin = first_bin(depth + 1) + 1;
+
+        // a temporary file replaces the index, so it is not left half-written
+        std::string temporary_path = path + ".tmp";
+        {
+            std::ofstream file{temporary_path, std::ios::out | std::ios::binary};
+            if (!file) {
+                throw std::runtime_error{"Couldn't write the index " + temporary_path};
+            }
+            util::BgzfStreamBuffer compressor{file, 1};
+            std::ostream output{&compressor};
+
+            if (format == Format::TABIX) {
+                output.write("TBI\1", 4);
+                write_number(output, references.size(), 4);
+                write_header(output);
+            } else {
+                // the tabix header keeps the names of the contigs in the auxiliary data
+                std::ostringstream header;
+                write_header(header);
+                output.write("CSI\1", 4);
+                write_number(output, static_cast<uint64_t>(min_shift), 4);
+                write_number(output, static_cast<uint64_t>(depth), 4);
+                write_number(output, header.str().size(), 4);
+                output << header.str();
+                write_number(output, references.size(), 4);
+            }
+
+            for (auto & reference : references) {
+                write_number(output, reference.bins.size() + 1, 4);
+                for (auto & bin : reference.bins) {
+                    write_number(output, bin.first, 4);
+                    if (format == Format::CSI) {
+                        size_t window = first_window(bin.first, depth);
+                        write_number(output, window < reference.linear_index.size()
+                                             ? reference.linear_index[window] : 0, 8);
+                    }
+                    write_number(output, bin.second.size(), 4);
+                    for (auto & bin_chunk : bin.second) {
+                        write_number(output, bin_chunk.first, 8);
+                        write_number(output, bin_chunk.second, 8);
+                    }
+                }
+
+                write_number(output, pseudo_bin, 4);
+                if (format == Format::CSI) {
+                    write_number(output, 0, 8);
+                }
+                write_number(output, 2, 4);
+                write_number(output, reference.records.first, 8);
+                write_number(output, reference.records.second, 8);
+                write_number(output, reference.n_records, 8);
+                write_number(output, 0, 8);
+
+                if (format == Format::TABIX) {
+                    write_number(output, reference.linear_index.size(), 4);
+                    for (auto offset : reference.linear_index) {
+                        write_number(output, offset, 8);
+                    }
+                }
+            }
+            write_number(output, 0, 8);     // records without a position
+
+            compressor.close();
+            if (!file.flush()) {
+                throw std::runtime_error{"Couldn't write the index " + temporary_path};
+            }
+        }
+        boost::filesystem::rename(temporary_path, path);
+    }
+
+    void RegionIndexBuilder::write_header(std::ostream & output) const
+    {
+        size_t names_size = 0;
+        for (auto & reference : references) {
+            names_size += reference.name.size() + 1;
+        }
+
+        // VCF format, columns of the contig, start and end (none), comment character and skipped lines
+        uint32_t const fields[] = {2, 1, 2, 0, '#', 0};
+        for (uint32_t field : fields) {
+            write_number(output, field, 4);
+        }
+        write_number(output, names_size, 4);
+        for (auto & reference : references) {
+            output.write(reference.name.c_str(), reference.name.size() + 1);
+        }
+    }
+
+    std::string RegionIndexBuilder::extension(Format format)
+    {
+        return format == Format::TABIX ? ".tbi" : ".csi";
+    }
+
+    IndexingBlockReader::IndexingBlockReader(util::BgzfBlockReader & input, RegionIndexBuilder & index)
+    : input(input), index(index), partial_line_begin{0}, input_end{0}
+    {
+    }
+
+    bool IndexingBlockReader::next_block(util::Block & block)
+    {
+        if (!input.read(block)) {
+            // the last line of the file may have no newline
+            if (!partial_line.empty()) {
+                index.add_line(partial_line.data(), partial_line.data() + partial_line.size(), partial_line_begin,
+                               input_end);
+                partial_line.clear();
+            }
+            index.finish();
+            return false;
+        }
+
+        util::VirtualOffset block_begin = input.block_offset() << 16;
+        input_end = input.next_block_offset() << 16;
+        char const * p = block.data;
+        char const * block_end = block.data + block.size;
+        while (p != block_end) {
+            char const * newline = static_cast<char const *>(std::memchr(p, '\n', block_end - p));
+            if (newline == nullptr) {
+                if (partial_line.empty()) {
+                    partial_line_begin = block_begin | static_cast<util::VirtualOffset>(p - block.data);
+                }
+                partial_line.insert(partial_line.end(), p, block_end);
+                break;
+            }
+
+            // the end of a whole block doesn't fit in 16 bits, but it is also the beginning of the next one
+            util::VirtualOffset line_end = newline + 1 == block_end
+                                           ? input_end
+                                           : block_begin | static_cast<util::VirtualOffset>(newline + 1 - block.data);
+            if (partial_line.empty()) {
+                index.add_line(p, newline, block_begin | static_cast<util::VirtualOffset>(p - block.data), line_end);
+            } else {
+                partial_line.insert(partial_line.end(), p, newline);
+                index.add_line(partial_line.data(), partial_line.data() + partial_line.size(), partial_line_begin,
+                               line_end);
+                partial_line.clear();
+            }
+            p = newline + 1;
+        }
+        return true;
+    }
+
+  }
+}
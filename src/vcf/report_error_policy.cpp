@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include "vcf/allocation_stats.hpp"
 #include "vcf/error_policy.hpp"
 
 namespace ebi
@@ -22,12 +23,14 @@ namespace ebi
   {
     void ReportErrorPolicy::handle_error(ParsingState &state, Error *error)
     {
+        AllocationScope allocation_scope{AllocationStage::errors};
         state.m_is_valid = false;
         state.add_error(std::unique_ptr<Error>(error));
     }
 
     void ReportErrorPolicy::handle_warning(ParsingState &state, Error *error)
     {
+        AllocationScope allocation_scope{AllocationStage::errors};
         state.add_warning(std::unique_ptr<Error>(error));
     }
   }
@@ -0,0 +1,244 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <limits>
+
+#include "vcf/sample_index.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+
+    namespace
+    {
+      bool is_digit(char c)
+      {
+          return c >= '0' && c <= '9';
+      }
+
+      ValueClass classify(char const * begin, char const * end)
+      {
+          if (end - begin == 1 && *begin == '.') {
+              return ValueClass::MISSING;
+          }
+
+          char const * p = begin;
+          if (p != end && (*p == '+' || *p == '-')) {
+              ++p;
+          }
+          size_t integer_digits = 0;
+          for (; p != end && is_digit(*p); ++p) {
+              ++integer_digits;
+          }
+          if (p == end) {
+              if (integer_digits == 0) {
+                  return ValueClass::OTHER;
+              }
+              return integer_digits <= 9 ? ValueClass::INTEGER
+                                         : integer_digits <= 30 ? ValueClass::DECIMAL : ValueClass::OTHER;
+          }
+
+          if (*p != '.') {
+              return ValueClass::OTHER;
+          }
+          ++p;
+          size_t fraction_digits = 0;
+          for (; p != end && is_digit(*p); ++p) {
+              ++fraction_digits;
+          }
+          size_t digits = integer_digits + fraction_digits;
+          return p == end && digits != 0 && digits <= 30 ? ValueClass::DECIMAL : ValueClass::OTHER;
+      }
+    }
+
+    void find_sample_delimiters(char const * begin, char const * end, std::vector<size_t> & positions)
+    {
+        char const * p = begin;
+#if defined(__SSE2__)
+        // compare 16 characters at a time, and extract the positions of the matches from a bit mask
+        __m128i const colon = _mm_set1_epi8(':');
+        __m128i const comma = _mm_set1_epi8(',');
+        for (; end - p >= 16; p += 16) {
+            __m128i chunk = _mm_loadu_si128(reinterpret_cast<__m128i const *>(p));
+            unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(
+                    _mm_or_si128(_mm_cmpeq_epi8(chunk, colon), _mm_cmpeq_epi8(chunk, comma))));
+            while (mask != 0) {
+                positions.push_back(static_cast<size_t>(p - begin) + __builtin_ctz(mask));
+                mask &= mask - 1;
+            }
+        }
+#endif
+        for (; p < end; ++p) {
+            if (*p == ':' || *p == ',') {
+                positions.push_back(static_cast<size_t>(p - begin));
+            }
+        }
+    }
+
+    SampleIndex::SampleIndex()
+    : sample{nullptr}
+    {
+    }
+
+    void SampleIndex::build(std::string const & sample)
+    {
+        this->sample = &sample;
+        subfields.clear();
+        values.clear();
+        delimiters.clear();
+
+        if (sample.empty()) {
+            return;
+        }
+        find_sample_delimiters(sample.data(), sample.data() + sample.size(), delimiters);
+
+        size_t subfield_begin = 0;
+        size_t value_begin = 0;
+        size_t first_value = 0;
+        for (size_t position : delimiters) {
+            if (sample[position] == ':') {
+                if (position == 0) {
+                    continue;   // the first character of the sample is not a delimiter
+                }
+                if (value_begin < position) {
+                    add_value(value_begin, position);
+                }
+                subfields.push_back(Subfield{subfield_begin, position, first_value, values.size() - first_value});
+                subfield_begin = value_begin = position + 1;
+                first_value = values.size();
+            } else if (position != subfield_begin) {
+                // the first character of a subfield is not a delimiter either
+                add_value(value_begin, position);
+                value_begin = position + 1;
+            }
+        }
+
+        if (subfield_begin < sample.size()) {
+            if (value_begin < sample.size()) {
+                add_value(value_begin, sample.size());
+            }
+            subfields.push_back(Subfield{subfield_begin, sample.size(), first_value, values.size() - first_value});
+        }
+    }
+
+    std::string SampleIndex::subfield_string(size_t i) const
+    {
+        return sample->substr(subfields[i].begin, subfields[i].end - subfields[i].begin);
+    }
+
+    std::string SampleIndex::value_string(Value const & value) const
+    {
+        return sample->substr(value.begin, value.end - value.begin);
+    }
+
+    std::vector<std::string> SampleIndex::value_strings(Subfield const & subfield) const
+    {
+        std::vector<std::string> strings;
+        for (size_t i = subfield.first_value; i < subfield.first_value + subfield.n_values; ++i) {
+            strings.push_back(value_string(values[i]));
+        }
+        return strings;
+    }
+
+    void SampleIndex::add_value(size_t begin, size_t end)
+    {
+        char const * data = sample->data();
+        values.push_back(Value{begin, end, classify(data + begin, data + end)});
+    }
+
+    Genotype::Genotype()
+    : sample{nullptr}, ploidy{0}
+    {
+    }
+
+    void Genotype::decode(std::string const & sample, size_t begin, size_t end)
+    {
+        this->sample = &sample;
+        alleles.clear();
+        ploidy = 1;
+
+        size_t allele_begin = begin;
+        bool phased = false;
+        for (size_t p = begin; p <= end; ++p) {
+            bool separator = p < end && (sample[p] == '/' || sample[p] == '|');
+            if (separator && p == begin) {
+                ++ploidy;
+                continue;   // the first character of the subfield doesn't split an allele
+            }
+            if (!separator && p < end) {
+                continue;
+            }
+            if (separator) {
+                ++ploidy;
+            } else if (allele_begin == end) {
+                break;      // a trailing separator doesn't add an empty allele
+            }
+
+            Allele allele{allele_begin, p, AlleleClass::OTHER, 0, phased};
+            if (allele_begin == p) {
+                allele.allele_class = AlleleClass::EMPTY;
+            } else if (p - allele_begin == 1 && sample[allele_begin] == '.') {
+                allele.allele_class = AlleleClass::MISSING;
+            } else {
+                size_t index = 0;
+                size_t q = allele_begin;
+                for (; q < p && is_digit(sample[q]); ++q) {
+                    size_t digit = static_cast<size_t>(sample[q] - '0');
+                    index = index > (std::numeric_limits<size_t>::max() - digit) / 10
+                            ? std::numeric_limits<size_t>::max() : index * 10 + digit;
+                }
+                if (q == p) {
+                    allele.allele_class = AlleleClass::INDEX;
+                    allele.index = index;
+                }
+            }
+            alleles.push_back(allele);
+
+            if (separator) {
+                phased = sample[p] == '|';
+                allele_begin = p + 1;
+            }
+        }
+    }
+
+    void Genotype::decode(std::string const & sample)
+    {
+        size_t colon = sample.find(':');
+        decode(sample, 0, colon == std::string::npos ? sample.size() : colon);
+    }
+
+    bool Genotype::is_all_reference() const
+    {
+        for (auto & allele : alleles) {
+            if (allele.end - allele.begin != 1 || (*sample)[allele.begin] != '0') {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    std::string Genotype::allele_string(Allele const & allele) const
+    {
+        return sample->substr(allele.begin, allele.end - allele.begin);
+    }
+
+  }
+}
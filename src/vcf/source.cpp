@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 
+#include <iterator>
+
 #include "vcf/file_structure.hpp"
 
 namespace ebi
@@ -30,10 +32,157 @@ namespace ebi
       input_format{input_format},
       version{version},
       meta_entries{meta_entries},
-      samples_names{samples_names}
+      samples_names{samples_names},
+      m_schema{},
+      m_format_layouts{},
+      m_format_key{},
+      m_schema_entries{0},
+      m_schema_built{false},
+      m_schema_shared{false}
     {
         
     }
 
+    Source::Source(Source const & other)
+    : Source{other.name, other.input_format, other.version, other.meta_entries, other.samples_names}
+    {
+        share_schema(other);
+    }
+
+    Source & Source::operator=(Source const & other)
+    {
+        name = other.name;
+        input_format = other.input_format;
+        version = other.version;
+        meta_entries = other.meta_entries;
+        samples_names = other.samples_names;
+        m_format_layouts.clear();
+        m_schema_built = false;
+        m_schema_shared = false;
+        share_schema(other);
+        return *this;
+    }
+
+    std::shared_ptr<Source> Source::body_source()
+    {
+        schema();
+        std::shared_ptr<Source> body{new Source{name, input_format, version, {}, samples_names}};
+        body->m_schema = m_schema;
+        body->m_schema_built = true;
+        body->m_schema_shared = true;
+        return body;
+    }
+
+    void Source::share_schema(Source const & other)
+    {
+        // a copy of a body source has no entries to build its own schema from
+        if (other.m_schema_shared) {
+            m_schema = other.m_schema;
+            m_schema_built = true;
+            m_schema_shared = true;
+        }
+    }
+
+    HeaderSchema const & Source::schema()
+    {
+        if (!m_schema_shared && (!m_schema_built || m_schema_entries != meta_entries.size())) {
+            std::shared_ptr<HeaderSchema> schema = std::make_shared<HeaderSchema>();
+            schema->build(meta_entries);
+            // the previous schema may still be shared with body sources, which keep it
+            m_schema = schema;
+            m_format_layouts.clear();   // they point to the previous schema
+            m_schema_entries = meta_entries.size();
+            m_schema_built = true;
+        }
+        return *m_schema;
+    }
+
+    FormatLayout const & Source::format_layout(std::vector<std::string> const & format)
+    {
+        HeaderSchema const & header_schema = schema();
+
+        // FORMAT fields can't contain colons, so the original column is a unique key
+        m_format_key.clear();
+        for (auto & field : format) {
+            m_format_key += field;
+            m_format_key += ':';
+        }
+
+        auto cached = m_format_layouts.find(m_format_key);
+        if (cached != m_format_layouts.end()) {
+            return cached->second;
+        }
+
+        auto & predefined_tags = (version == Version::v41 || version == Version::v42) ? format_v41_v42 : format_v43;
+        FormatLayout layout{{}, {}, {}, -1};
+        for (size_t i = 0; i < format.size(); ++i) {
+            FieldDescriptor const * meta = header_schema.find(FORMAT, format[i]);
+            layout.fields.push_back(meta);
+
+            auto tag = predefined_tags.find(format[i]);
+            layout.predefined.push_back(meta == nullptr ? tag : nullptr);
+
+            if (meta != nullptr) {
+                layout.cardinalities.push_back(Cardinality::parse(meta->number));
+            } else if (layout.predefined.back() != nullptr) {
+                layout.cardinalities.push_back(layout.predefined.back()->cardinality);
+            } else {
+                layout.cardinalities.push_back(Cardinality{Cardinality::Kind::UNKNOWN, 0});
+            }
+
+            if (format[i] == GT && layout.gt_index == -1) {
+                layout.gt_index = static_cast<long>(i);
+            }
+        }
+
+        return m_format_layouts.emplace(m_format_key, std::move(layout)).first->second;
+    }
+
+    void HeaderSchema::build(std::multimap<std::string, MetaEntry> const & meta_entries)
+    {
+        m_entries.clear();
+        for (auto entry = meta_entries.begin(); entry != meta_entries.end(); ) {
+            // the entries of a type are contiguous, so its index is looked up and sized once
+            auto type_begin = entry;
+            auto type_end = meta_entries.upper_bound(entry->first);
+            std::unordered_map<std::string, FieldDescriptor> * entries = nullptr;
+
+            for (; entry != type_end; ++entry) {
+                if (entry->second.structure != MetaEntry::Structure::KeyValue) {
+                    continue;
+                }
+
+                auto & key_values = boost::get<std::map<std::string, std::string>>(entry->second.value);
+                auto id = key_values.find(ID);
+                if (id == key_values.end()) {
+                    continue;
+                }
+
+                auto number = key_values.find(NUMBER);
+                auto type = key_values.find(TYPE);
+                if (entries == nullptr) {
+                    entries = &m_entries[entry->first];
+                    entries->reserve(std::distance(type_begin, type_end));
+                }
+                // emplace doesn't replace an entry with the same ID, so the first definition is kept
+                entries->emplace(id->second, FieldDescriptor{
+                        id->second,
+                        number != key_values.end() ? number->second : "",
+                        type != key_values.end() ? type->second : ""
+                });
+            }
+        }
+    }
+
+    FieldDescriptor const * HeaderSchema::find(std::string const & meta_type, std::string const & id) const
+    {
+        auto entries = m_entries.find(meta_type);
+        if (entries == m_entries.end()) {
+            return nullptr;
+        }
+        auto descriptor = entries->second.find(id);
+        return descriptor != entries->second.end() ? &descriptor->second : nullptr;
+    }
+
   }
 }
@@ -14,49 +14,91 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+
+#include "util/number_utils.hpp"
+#include "util/string_utils.hpp"
+#include "vcf/allocation_stats.hpp"
 #include "vcf/parse_policy.hpp"
 
 namespace ebi
 {
   namespace vcf
   {
+    size_t const StoreParsePolicy::long_line_size = 64 * 1024 * 1024;
+
+    StoreParsePolicy::StoreParsePolicy()
+    : m_buffer_begin{nullptr}, m_current_token{0, 0, false}, m_group_begin{0}, m_header_size{0}
+    {
+        m_columns.fill(TokenRange{0, 0});
+    }
+
+    void StoreParsePolicy::handle_buffer_begin(ParsingState const & state, char const * p)
+    {
+        m_buffer_begin = p;
+    }
 
-    void StoreParsePolicy::handle_token_begin(ParsingState const & state)
+    void StoreParsePolicy::handle_buffer_end(ParsingState const & state, char const * pe)
     {
-        m_current_token = std::string{};
+        // the buffer may be released after this, keep the unfinished line
+        m_line_carry.append(m_buffer_begin, pe);
+        m_buffer_begin = pe;
     }
 
-    void StoreParsePolicy::handle_token_char(ParsingState const & state, char c)
+    void StoreParsePolicy::handle_token_begin(ParsingState const & state, char const * p)
     {
-        m_current_token.push_back(c);
+        m_current_token = TokenView{line_offset(p), 0, false};
+    }
+
+    void StoreParsePolicy::append_token_char(char const * p)
+    {
+        if (not m_current_token.owned) {
+            // some characters were skipped, so the token is not a contiguous part of the line anymore
+            size_t owned_offset = m_owned_chars.size();
+            m_owned_chars += token_string(m_current_token);
+            m_current_token = TokenView{owned_offset, m_current_token.size, true};
+        }
+        m_owned_chars.push_back(*p);
+        ++m_current_token.size;
     }
 
     void StoreParsePolicy::handle_token_end(ParsingState const & state) 
     {
-        m_grouped_tokens.push_back(m_current_token);
+        m_line_tokens.push_back(m_current_token);
     }
     
-    void StoreParsePolicy::handle_token_end(ParsingState const & state, std::string token) 
+    void StoreParsePolicy::handle_token_end(ParsingState const & state, char const * token)
     {
-        m_grouped_tokens.push_back(token);
+        size_t owned_offset = m_owned_chars.size();
+        m_owned_chars += token;
+        m_line_tokens.push_back(TokenView{owned_offset, m_owned_chars.size() - owned_offset, true});
     }
     
-    void StoreParsePolicy::handle_newline(ParsingState const & state) 
+    void StoreParsePolicy::handle_newline(ParsingState const & state, char const * p)
     {
-        m_current_token.clear();
-        m_grouped_tokens.clear();
+        if (line_offset(p) > long_line_size) {
+            release_line_buffers();
+        }
+        m_buffer_begin = p + 1;
+        m_line_carry.clear();
+        m_owned_chars.clear();
+        m_current_token = TokenView{0, 0, false};
         m_line_tokens.clear();
+        m_group_begin = 0;
+        m_columns.fill(TokenRange{0, 0});
+        m_sample_tokens.clear();
     }
 
     void StoreParsePolicy::handle_fileformat(ParsingState & state)
     {
         Version fileformat_version = Version::v41;
+        std::string current_token = token_string(m_current_token);
 
-        if (m_current_token == VCF_V41) {
+        if (current_token == VCF_V41) {
             fileformat_version = Version::v41;
-        } else if (m_current_token == VCF_V42) {
+        } else if (current_token == VCF_V42) {
             fileformat_version = Version::v42;
-        } else if (m_current_token == VCF_V43) {
+        } else if (current_token == VCF_V43) {
             fileformat_version = Version::v43;
         } else {
             throw new FileformatError{state.n_lines, "Not allowed VCF fileformat version"};
@@ -71,10 +113,10 @@ namespace ebi
 
     void StoreParsePolicy::handle_meta_typeid(ParsingState const & state)
     {
-        m_line_typeid = m_current_token;
+        m_line_typeid = token_string(m_current_token);
     }
 
-    void StoreParsePolicy::handle_meta_typeid(ParsingState const & state, std::string type_id) 
+    void StoreParsePolicy::handle_meta_typeid(ParsingState const & state, char const * type_id)
     {
         m_line_typeid = type_id;
     }
@@ -82,21 +124,27 @@ namespace ebi
     
     void StoreParsePolicy::handle_meta_line(ParsingState & state)
     {
-        // Put together m_line_typeid and m_grouped_tokens in a single MetaEntry object
+        // Put together m_line_typeid and the grouped tokens in a single MetaEntry object
         // Add MetaEntry to Source
+        TokenRange group = grouped_tokens();
+        size_t group_size = group.end - group.begin;
+        for (size_t i = group.begin; i < group.end; ++i) {
+            m_header_size += sizeof(std::string) + m_line_tokens[i].size;
+        }
 
+        // the tokens are copied straight into the entry, which is moved into the source without further copies
         if (m_line_typeid == "") { // Plain value
-            state.add_meta(MetaEntry{state.n_lines, m_grouped_tokens[0], state.source});
+            state.add_meta(MetaEntry{state.n_lines, token_string(m_line_tokens[group.begin]), state.source});
 
-        } else if (m_grouped_tokens.size() == 1) { // TypeID=value
-            state.add_meta(MetaEntry{state.n_lines, m_line_typeid, m_grouped_tokens[0], state.source});
+        } else if (group_size == 1) { // TypeID=value
+            state.add_meta(MetaEntry{state.n_lines, m_line_typeid, token_string(m_line_tokens[group.begin]), state.source});
 
-        } else if (m_grouped_tokens.size() % 2 == 0) { // TypeID=<Key-value pairs>
+        } else if (group_size % 2 == 0) { // TypeID=<Key-value pairs>
             auto key_values = std::map<std::string, std::string>{};
-            for (size_t i = 0; i < m_grouped_tokens.size(); i += 2) {
-                key_values[m_grouped_tokens[i]] = m_grouped_tokens[i+1];
+            for (size_t i = group.begin; i < group.end; i += 2) {
+                key_values[token_string(m_line_tokens[i])] = token_string(m_line_tokens[i+1]);
             }
-            state.add_meta(MetaEntry{state.n_lines, m_line_typeid, key_values, state.source});
+            state.add_meta(MetaEntry{state.n_lines, m_line_typeid, std::move(key_values), state.source});
 
         } else {
             throw new MetaSectionError{state.n_lines, "Meta line description is not a value, nor a TypeID=value, nor a TypeID=<Key-value pairs>"};
@@ -106,156 +154,353 @@ namespace ebi
 
     void StoreParsePolicy::handle_sample_name(ParsingState const & state)
     {
-        m_grouped_tokens.push_back(m_current_token);
+        m_line_tokens.push_back(m_current_token);
     }
 
     void StoreParsePolicy::handle_header_line(ParsingState & state)
     {
-        state.set_samples(m_grouped_tokens);
+        std::vector<std::string> samples = token_strings(grouped_tokens());
+        for (auto & sample : samples) {
+            m_header_size += sizeof(std::string) + sample.size();
+        }
+        state.set_samples(samples);
     }
 
 
     void StoreParsePolicy::handle_column_end(ParsingState const & state, size_t n_columns) 
     {
-        switch(n_columns) {
-            case 1:
-                m_line_tokens[CHROM] = m_grouped_tokens;
-                break;
-            case 2:
-                m_line_tokens[POS] = m_grouped_tokens;
-                break;
-            case 3:
-                m_line_tokens[ID] = m_grouped_tokens;
-                break;
-            case 4:
-                m_line_tokens[REF] = m_grouped_tokens;
-                break;
-            case 5:
-                m_line_tokens[ALT] = m_grouped_tokens;
-                break;
-            case 6:
-                m_line_tokens[QUAL] = m_grouped_tokens;
-                break;
-            case 7:
-                m_line_tokens[FILTER] = m_grouped_tokens;
-                break;
-            case 8:
-                m_line_tokens[INFO] = m_grouped_tokens;
-                break;
-            case 9:
-                m_line_tokens[FORMAT] = m_grouped_tokens;
-                break;
-            default:
-                // Collection of samples
-                if (m_line_tokens.find(SAMPLES) == m_line_tokens.end()) {
-                    m_line_tokens[SAMPLES] = std::vector<std::string>{};
-                }
-                // Samples are stored as a single string
-                m_line_tokens[SAMPLES].push_back(m_grouped_tokens[0]);
-        }
-        m_grouped_tokens = std::vector<std::string>{};
-    }
-
-    void StoreParsePolicy::handle_body_line(ParsingState & state)
-    {
-        size_t position;
-        try {
-            // Transform the position token into a size_t
-            position = static_cast<size_t>(std::stoi(m_line_tokens[POS][0]));
-        } catch (std::invalid_argument ex) {
-            throw new PositionBodyError{state.n_lines};
+        if (n_columns <= n_fixed_columns) {
+            m_columns[n_columns - 1] = grouped_tokens();
+        } else {
+            // Samples are stored as a single string
+            m_sample_tokens.push_back(m_group_begin < m_line_tokens.size() ?
+                                      m_line_tokens[m_group_begin] : TokenView{0, 0, true});
+        }
+        m_group_begin = m_line_tokens.size();
+    }
+
+    Error * StoreParsePolicy::handle_body_line(ParsingState & state)
+    {
+        AllocationScope allocation_scope{AllocationStage::records};
+        AllocationStats::add_record();
+
+        // The record outlives the input buffer, so its fields are copied here, into strings reused for every line
+        RecordFields & fields = m_record_fields;
+        column_token(CHROM_COLUMN, fields.chromosome);
+
+        // Transform the position token into a size_t
+        int position_value;
+        column_token(POS_COLUMN, fields.position);
+        if (!util::parse_int(fields.position, position_value)) {
+            return new PositionBodyError{state.n_lines};
         }
+        size_t position = static_cast<size_t>(position_value);
 
         // Transform all the quality tokens into floating point numbers
         float quality = 0;
-        if (m_line_tokens[QUAL][0] != MISSING_VALUE) {
-            try {
-                quality = std::stof(m_line_tokens[QUAL][0]);
-            } catch (std::invalid_argument ex) {
-                throw new QualityBodyError{state.n_lines};
-            }
+        column_token(QUAL_COLUMN, fields.quality);
+        if (fields.quality != MISSING_VALUE && !util::parse_float(fields.quality, quality)) {
+            return new QualityBodyError{state.n_lines};
         }
 
-        // Split the info tokens by the equals (=) symbol
+        // Split the info tokens by the equals (=) symbol, straight from the line, so that a long value is only
+        // copied once, into the map that is then moved into the record. Like util::split_view, the first character
+        // is never a delimiter, and the value ends at the next one
         std::multimap<std::string, std::string> info;
-        for (auto &field : m_line_tokens[INFO]) {
-            std::vector<std::string> subfields;
-            util::string_split(field, "=", subfields);
-            if (subfields.size() > 1) {
-                info.emplace(subfields[0], subfields[1]);
-            } else {
-                info.emplace(subfields[0], "");
-            }
+        TokenRange info_tokens = m_columns[INFO_COLUMN - 1];
+        for (size_t i = info_tokens.begin; i < info_tokens.end; ++i) {
+            TokenView const & field = m_line_tokens[i];
+            size_t equals = field.size != 0 ? token_find(field, '=', 1) : 0;
+            size_t value_end = equals < field.size ? token_find(field, '=', equals + 1) : equals;
+            info.emplace(token_string(sub_token(field, 0, equals)),
+                         equals < field.size ? token_string(sub_token(field, equals + 1, value_end)) : std::string{});
         }
 
-        // Format and samples are optional
-        auto format = m_line_tokens.find(FORMAT) != m_line_tokens.end() ?
-                      m_line_tokens[FORMAT] : std::vector<std::string>{};
-        auto samples = m_line_tokens.find(SAMPLES) != m_line_tokens.end() ?
-                       m_line_tokens[SAMPLES] : std::vector<std::string>{};
+        column_strings(ID_COLUMN, fields.ids);
+        column_token(REF_COLUMN, fields.reference);
+        column_strings(ALT_COLUMN, fields.alternates);
+        column_strings(FILTER_COLUMN, fields.filters);
 
-        state.set_record(std::unique_ptr<Record>{new Record{
+        // Format and samples are optional, and the samples are only split if their fields are checked
+        column_strings(FORMAT_COLUMN, fields.format);
+        unsigned checks = state.record_checks_at(state.n_lines);
+        bool split_samples = checks & RECORD_CHECK_SAMPLES;
+        if (split_samples) {
+            sample_strings(fields.samples);
+        } else {
+            fields.samples.clear();
+        }
+
+        // with workers, the record is checked later in parallel with others, see ParsingState::check_pending_records
+        PendingRecord * pending = state.workers != nullptr ? &state.add_pending_record() : nullptr;
+        Record & record = pending != nullptr ? *pending->record : state.recycled_record();
+        record.assign_unchecked(
                 state.n_lines,
-                m_line_tokens[CHROM][0],
+                fields.chromosome,
                 position,
-                m_line_tokens[ID],
-                m_line_tokens[REF][0],
-                m_line_tokens[ALT],
+                fields.ids,
+                fields.reference,
+                fields.alternates,
                 quality,
-                m_line_tokens[FILTER],
-                info,
-                format,
-                samples,
-                state.source
-        }});
+                fields.filters,
+                std::move(info),
+                fields.format,
+                fields.samples,
+                state.source.get());
+        if (!split_samples) {
+            unsplit_sample_string(record.unsplit_samples);
+        }
 
-        check_sorted(state, position);
+        if (pending != nullptr) {
+            pending->layout = &state.source->format_layout(record.format);
+            return nullptr;
+        }
+
+        Error * error = record.validate(state.source->format_layout(record.format), nullptr, state.profile, checks);
+        if (error != nullptr) {
+            return error;
+        }
+        if (state.record_listener) {
+            state.record_listener(record);
+        }
+        state.use_recycled_record();
+        return check_sorted(state, record.contig, fields.chromosome, position);
+    }
+
+    Error * StoreParsePolicy::handle_checked_record(ParsingState & state, Record const & record)
+    {
+        if (state.record_listener) {
+            state.record_listener(record);
+        }
+        return check_sorted(state, record.contig, record.chromosome, record.position);
     }
     
     std::string StoreParsePolicy::current_token() const
     {
-        return m_current_token;
+        return token_string(m_current_token);
     }
 
     std::vector<std::string> StoreParsePolicy::column_tokens(std::string const & column) const
     {
-        try {
-            return m_line_tokens.at(column);
-        } catch (std::out_of_range) {
-            return {};
+        std::string const column_names[n_fixed_columns] = { CHROM, POS, ID, REF, ALT, QUAL, FILTER, INFO, FORMAT };
+        for (size_t i = 0; i < n_fixed_columns; ++i) {
+            if (column == column_names[i]) {
+                return column_strings(i + 1);
+            }
+        }
+        if (column == SAMPLES) {
+            return sample_strings();
+        }
+        return {};
+    }
+
+    size_t StoreParsePolicy::line_buffers_size() const
+    {
+        size_t size = m_line_carry.capacity() + m_owned_chars.capacity()
+                      + (m_line_tokens.capacity() + m_sample_tokens.capacity()) * sizeof(TokenView);
+
+        // the copies of the samples take about as much as the line
+        size += m_record_fields.samples.capacity() * sizeof(std::string);
+        for (auto & sample : m_record_fields.samples) {
+            size += sample.capacity();
+        }
+        return size;
+    }
+
+    size_t StoreParsePolicy::header_size() const
+    {
+        return m_header_size;
+    }
+
+    char const * StoreParsePolicy::skip_valid_lines(ParsingState & state, char const * p, char const * pe)
+    {
+        return p;
+    }
+
+    std::string StoreParsePolicy::token_string(TokenView const & token) const
+    {
+        std::string token_chars;
+        token_string(token, token_chars);
+        return token_chars;
+    }
+
+    void StoreParsePolicy::token_string(TokenView const & token, std::string & token_chars) const
+    {
+        if (token.owned) {
+            token_chars.assign(m_owned_chars, token.offset, token.size);
+            return;
+        }
+
+        // the token may start in a previous buffer and end in the current one
+        token_chars.clear();
+        size_t token_end = token.offset + token.size;
+        size_t carry_size = m_line_carry.size();
+        if (token.offset < carry_size) {
+            token_chars.append(m_line_carry, token.offset, std::min(token_end, carry_size) - token.offset);
+        }
+        if (token_end > carry_size) {
+            size_t start = std::max(token.offset, carry_size);
+            token_chars.append(m_buffer_begin + (start - carry_size), token_end - start);
+        }
+    }
+
+    size_t StoreParsePolicy::token_find(TokenView const & token, char c, size_t from) const
+    {
+        if (token.owned) {
+            char const * begin = m_owned_chars.data() + token.offset;
+            return static_cast<size_t>(std::find(begin + from, begin + token.size, c) - begin);
+        }
+
+        // like token_string, look in the previous buffers and then in the current one
+        size_t token_end = token.offset + token.size;
+        size_t carry_size = m_line_carry.size();
+        size_t offset = token.offset + from;
+        if (offset < carry_size) {
+            char const * carry_end = m_line_carry.data() + std::min(token_end, carry_size);
+            char const * found = std::find(m_line_carry.data() + offset, carry_end, c);
+            if (found != carry_end) {
+                return static_cast<size_t>(found - m_line_carry.data()) - token.offset;
+            }
+            offset = carry_size;
+        }
+        if (offset < token_end) {
+            char const * buffer_end = m_buffer_begin + (token_end - carry_size);
+            char const * found = std::find(m_buffer_begin + (offset - carry_size), buffer_end, c);
+            if (found != buffer_end) {
+                return carry_size + static_cast<size_t>(found - m_buffer_begin) - token.offset;
+            }
+        }
+        return token.size;
+    }
+
+    std::vector<std::string> StoreParsePolicy::token_strings(TokenRange range) const
+    {
+        std::vector<std::string> strings;
+        token_strings(range, strings);
+        return strings;
+    }
+
+    void StoreParsePolicy::token_strings(TokenRange range, std::vector<std::string> & strings) const
+    {
+        strings.resize(range.end - range.begin);
+        for (size_t i = range.begin; i < range.end; ++i) {
+            token_string(m_line_tokens[i], strings[i - range.begin]);
+        }
+    }
+
+    StoreParsePolicy::TokenRange StoreParsePolicy::grouped_tokens() const
+    {
+        return TokenRange{m_group_begin, m_line_tokens.size()};
+    }
+
+    void StoreParsePolicy::column_token(size_t column, std::string & token_chars) const
+    {
+        TokenRange range = m_columns[column - 1];
+        if (range.begin < range.end) {
+            token_string(m_line_tokens[range.begin], token_chars);
+        } else {
+            token_chars.clear();
+        }
+    }
+
+    std::vector<std::string> StoreParsePolicy::column_strings(size_t column) const
+    {
+        return token_strings(m_columns[column - 1]);
+    }
+
+    void StoreParsePolicy::column_strings(size_t column, std::vector<std::string> & strings) const
+    {
+        token_strings(m_columns[column - 1], strings);
+    }
+
+    std::vector<std::string> StoreParsePolicy::sample_strings() const
+    {
+        std::vector<std::string> samples;
+        sample_strings(samples);
+        return samples;
+    }
+
+    void StoreParsePolicy::sample_strings(std::vector<std::string> & samples) const
+    {
+        samples.resize(m_sample_tokens.size());
+        for (size_t i = 0; i < m_sample_tokens.size(); ++i) {
+            token_string(m_sample_tokens[i], samples[i]);
+        }
+    }
+
+    void StoreParsePolicy::unsplit_sample_string(std::string & samples) const
+    {
+        samples.clear();
+        if (m_sample_tokens.empty()) {
+            return;
+        }
+
+        // the samples are usually a contiguous part of the line, tabs included
+        bool contiguous = std::none_of(m_sample_tokens.begin(), m_sample_tokens.end(),
+                                       [](TokenView const & token) { return token.owned; });
+        if (contiguous) {
+            TokenView const & first = m_sample_tokens.front();
+            TokenView const & last = m_sample_tokens.back();
+            token_string(TokenView{first.offset, last.offset + last.size - first.offset, false}, samples);
+            return;
+        }
+
+        std::string sample;
+        for (size_t i = 0; i < m_sample_tokens.size(); ++i) {
+            token_string(m_sample_tokens[i], sample);
+            if (i != 0) {
+                samples += '\t';
+            }
+            samples += sample;
         }
     }
 
-    void StoreParsePolicy::check_sorted(ParsingState &state, size_t position)
+    void StoreParsePolicy::release_line_buffers()
     {
-        // check contigs are contiguous
-        auto iterator = finished_contigs.find(m_line_tokens[CHROM][0]);
-        bool contig_not_found = iterator == finished_contigs.end();
-        bool contig_already_finished = iterator->second;
-        if (contig_not_found) {
-            // contig not found in the map: finishing the previous contig, and starting a new one
-            if (finished_contigs.size() != 0) {
+        std::string{}.swap(m_line_carry);
+        std::string{}.swap(m_owned_chars);
+        std::vector<TokenView>{}.swap(m_line_tokens);
+        std::vector<TokenView>{}.swap(m_sample_tokens);
+        m_record_fields = RecordFields{};
+    }
+
+    Error * StoreParsePolicy::check_sorted(ParsingState &state,
+                                           ContigId contig,
+                                           std::string const & chromosome,
+                                           size_t position)
+    {
+        using ContigStatus = RecordOrder::ContigStatus;
+        RecordOrder & order = state.record_order;
+
+        // check contigs are contiguous; only the contig of the previous record can be being read, so the others are
+        // only looked up when the contig changes
+        if (order.seen_contigs == 0 || contig != order.previous_contig) {
+            if (order.status(contig) == ContigStatus::FINISHED) {
+                return new BodySectionError{state.n_lines, "Variant is not contiguous to the rest of the contig",
+                                            "Position of variant " + chromosome + " : " + std::to_string(position)};
+            }
+
+            // contig not found: finishing the previous contig, and starting a new one
+            if (order.seen_contigs != 0) {
                 // with the first contig there's no previous contig
-                finished_contigs[previous_contig] = true;
+                order.set_status(order.previous_contig, ContigStatus::FINISHED);
+            } else {
+                order.first_contig = contig;
+                order.first_position = position;
             }
-            finished_contigs[m_line_tokens[CHROM][0]] = false;
-            previous_contig = m_line_tokens[CHROM][0];
-            previous_position = 0;  // position sorting is reset
-        } else if (contig_already_finished) {
-            std::stringstream ss, ss_detail;
-            ss << "Variant is not contiguous to the rest of the contig";
-            ss_detail << "Position of variant " << m_line_tokens[CHROM][0] << " : " << position;
-            throw new BodySectionError{state.n_lines, ss.str(), ss_detail.str()};
+            order.set_status(contig, ContigStatus::READING);
+            order.previous_contig = contig;
+            order.previous_position = 0;  // position sorting is reset
         }
 
         // check all positions are sorted within a contig
-        if (position < previous_position) {
-            std::stringstream ss, ss_detail;
-            ss << "Contig is not sorted by position";
-            ss_detail << "Contig " << m_line_tokens[CHROM][0] << " position " << position << " found after " << previous_position;
-            throw new PositionBodyError{state.n_lines, ss.str(), ss_detail.str()};
+        if (position < order.previous_position) {
+            return new PositionBodyError{state.n_lines, "Contig is not sorted by position",
+                                         "Contig " + chromosome + " position " + std::to_string(position)
+                                         + " found after " + std::to_string(order.previous_position)};
         }
-        previous_position = position;
+        order.previous_position = position;
+        return nullptr;
     }
   }
 }
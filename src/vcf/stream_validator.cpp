@@ -0,0 +1,192 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "vcf/stream_validator.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    std::unique_ptr<Parser> build_parser(std::string const &path,
+                                         ValidationLevel level,
+                                         Version version,
+                                         unsigned input_format,
+                                         size_t threads,
+                                         Profile * profile,
+                                         RecordSampling const & sampling);
+
+    bool read_fileformat(const std::vector<char> &line,
+                         const std::string &fileName,
+                         std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                         Version &version);
+
+    void parse_and_report(char const * begin,
+                          char const * end,
+                          ebi::vcf::Parser &validator,
+                          std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                          debugulator::StreamingFixer * fixer);
+
+    void write_errors(const Parser &validator, const std::vector<std::unique_ptr<ReportWriter>> &outputs);
+
+    namespace
+    {
+      /**
+       * Delivers the reports to the error callback of a StreamValidator, which may be changed at any time
+       */
+      class CallbackReportWriter : public ReportWriter
+      {
+        public:
+          CallbackReportWriter(StreamValidator::ErrorCallback const & callback) : callback(callback) { }
+
+          virtual void write_error(Error &error) override
+          {
+              if (callback) {
+                  callback(Severity::ERROR, error);
+              }
+          }
+
+          virtual void write_warning(Error &error) override
+          {
+              if (callback) {
+                  callback(Severity::WARNING, error);
+              }
+          }
+
+          virtual void write_message(const std::string &report_result) override
+          {
+              // do nothing
+          }
+
+          virtual std::string get_filename() override
+          {
+              return "";
+          }
+
+        private:
+          StreamValidator::ErrorCallback const & callback;
+      };
+    }
+
+    StreamValidator::StreamValidator(ValidationLevel level, std::string const & source_name)
+    : level{level}, source_name{source_name}, stopped{false}, valid{true}
+    {
+        outputs.emplace_back(new CallbackReportWriter{error_callback});
+    }
+
+    void StreamValidator::on_error(ErrorCallback callback)
+    {
+        error_callback = std::move(callback);
+    }
+
+    void StreamValidator::on_record(RecordCallback callback)
+    {
+        record_callback = std::move(callback);
+    }
+
+    void StreamValidator::push(char const * data, size_t size)
+    {
+        char const * end = data + size;
+        if (stopped) {
+            return;
+        }
+        if (parser) {
+            parse(data, end);
+            return;
+        }
+
+        // the version of the parser is only known once the first line is complete
+        char const * newline = std::find(data, end, '\n');
+        char const * first_line_end = newline == end ? end : newline + 1;
+        first_line.insert(first_line.end(), data, first_line_end);
+        if (newline == end || !start_parser()) {
+            return;
+        }
+        parse(first_line.data(), first_line.data() + first_line.size());
+        parse(first_line_end, end);
+    }
+
+    bool StreamValidator::finish()
+    {
+        if (!stopped && !parser && start_parser()) {
+            parse(first_line.data(), first_line.data() + first_line.size());
+        }
+        if (!stopped && parser) {
+            try {
+                parser->end();
+                write_errors(*parser, outputs);
+            } catch (Error * error) {
+                outputs[0]->write_error(*error);
+                delete error;
+                valid = false;
+            }
+            valid = valid && parser->is_valid();
+        }
+        stopped = true;
+        return valid;
+    }
+
+    bool StreamValidator::is_valid() const
+    {
+        return valid && (!parser || parser->is_valid());
+    }
+
+    void StreamValidator::reset()
+    {
+        parser.reset();
+        first_line.clear();
+        stopped = false;
+        valid = true;
+    }
+
+    bool StreamValidator::start_parser()
+    {
+        Version version;
+        if (!read_fileformat(first_line, source_name, outputs, version)) {
+            stopped = true;
+            valid = false;
+            return false;
+        }
+
+        parser = build_parser(source_name, level, version, InputFormat::VCF_FILE_VCF, 1, nullptr, RecordSampling{});
+        auto parser_impl = dynamic_cast<ParserImpl *>(parser.get());
+        if (parser_impl != nullptr) {
+            parser_impl->record_listener = [this](Record const & record) {
+                if (record_callback) {
+                    record_callback(record);
+                }
+            };
+        }
+        return true;
+    }
+
+    void StreamValidator::parse(char const * begin, char const * end)
+    {
+        try {
+            parse_and_report(begin, end, *parser, outputs, nullptr);
+        } catch (Error * error) {
+            // with the stop level, the first error is thrown and ends the validation
+            outputs[0]->write_error(*error);
+            delete error;
+            stopped = true;
+            valid = false;
+        }
+    }
+  }
+}
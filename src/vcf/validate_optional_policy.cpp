@@ -14,7 +14,13 @@
  * limitations under the License.
  */
 
+#include <iterator>
+
 #include "util/algo_utils.hpp"
+#include "util/number_utils.hpp"
+#include "util/string_utils.hpp"
+#include "vcf/allocation_stats.hpp"
+#include "vcf/field_matchers.hpp"
 #include "vcf/optional_policy.hpp"
 
 namespace ebi
@@ -22,293 +28,352 @@ namespace ebi
   namespace vcf
   {
     
-    void ValidateOptionalPolicy::optional_check_meta_section(ParsingState const & state) const
+    Error * ValidateOptionalPolicy::optional_check_meta_section(ParsingState const & state) const
+    {
+        if (state.profile != nullptr) {
+            return MeasureProfilePolicy::measure(state.profile, ProfiledStep::optional_check_meta_section,
+                                                 [&] { return check_meta_section_reference(state); });
+        }
+        return check_meta_section_reference(state);
+    }
+
+    Error * ValidateOptionalPolicy::check_meta_section_reference(ParsingState const & state) const
     {
         if (state.source->meta_entries.find(REFERENCE) == state.source->meta_entries.end()) {
-            throw new MetaSectionError{state.n_lines, "A valid 'reference' entry is not listed in the meta section"};
+            return new MetaSectionError{state.n_lines, "A valid 'reference' entry is not listed in the meta section"};
         }
+        return nullptr;
     }
     
-    void ValidateOptionalPolicy::optional_check_body_entry(ParsingState & state, Record const & record) //const
+    Error * ValidateOptionalPolicy::optional_check_body_entry(ParsingState & state, Record const & record) //const
+    {
+        // like the checks of the record on its own, these are skipped for the records left out of a triage
+        if (!state.record_sampling.selects(record.line)) {
+            return nullptr;
+        }
+        AllocationScope allocation_scope{AllocationStage::checks};
+        if (state.profile != nullptr) {
+            return run_body_entry_checks<MeasureProfilePolicy>(state, record);
+        }
+        return run_body_entry_checks<IgnoreProfilePolicy>(state, record);
+    }
+
+    template <typename ProfilePolicy>
+    Error * ValidateOptionalPolicy::run_body_entry_checks(ParsingState & state, Record const & record)
     {
         // Position zero should only be used for telomeres
-        check_body_entry_position_zero(state, record);
+        Error * warning = ProfilePolicy::measure(state.profile, ProfiledStep::check_body_entry_position_zero,
+                                                 [&] { return check_body_entry_position_zero(state, record); });
         
         // The standard separator is semi-colon, commas are accepted but most probably a mistake
-        check_body_entry_id_commas(state, record);
+        if (warning == nullptr) {
+            warning = ProfilePolicy::measure(state.profile, ProfiledStep::check_body_entry_id_commas,
+                                             [&] { return check_body_entry_id_commas(state, record); });
+        }
         
         // Reference and alternate alleles in indels should share the first nucleotide
-        check_body_entry_reference_alternate_matching(state, record);
+        if (warning == nullptr) {
+            warning = ProfilePolicy::measure(state.profile, ProfiledStep::check_body_entry_reference_alternate_matching,
+                                             [&] {
+                                                 return check_body_entry_reference_alternate_matching(state, record);
+                                             });
+        }
 
         // 0/0 genotypes should be present when ALT is <*>, as it is supposed to be a reference region
-        check_body_entry_alt_gvcf_gt_value(state, record);
+        if (warning == nullptr) {
+            warning = ProfilePolicy::measure(state.profile, ProfiledStep::check_body_entry_alt_gvcf_gt_value,
+                                             [&] { return check_body_entry_alt_gvcf_gt_value(state, record); });
+        }
 
         // gVCF fields should provide END, as <*> is supposed to represent a region
-        check_body_entry_info_gvcf_end(state, record);
+        if (warning == nullptr) {
+            warning = ProfilePolicy::measure(state.profile, ProfiledStep::check_body_entry_info_gvcf_end,
+                                             [&] { return check_body_entry_info_gvcf_end(state, record); });
+        }
 
         // If a variant is flagged as precise, then it should not contain imprecise variant fields like CIPOS or CIEND
-        check_body_entry_info_imprecise(state, record);
+        if (warning == nullptr) {
+            warning = ProfilePolicy::measure(state.profile, ProfiledStep::check_body_entry_info_imprecise,
+                                             [&] { return check_body_entry_info_imprecise(state, record); });
+        }
 
         // The number of values in SVLEN should match the number of alternate alleles
-        check_body_entry_info_svlen(state, record);
+        if (warning == nullptr) {
+            warning = ProfilePolicy::measure(state.profile, ProfiledStep::check_body_entry_info_svlen,
+                                             [&] { return check_body_entry_info_svlen(state, record); });
+        }
 
         // Confidence interval tags should have first value <=0 and second value >= 0
-        check_body_entry_info_confidence_interval(state, record);
+        if (warning == nullptr) {
+            warning = ProfilePolicy::measure(state.profile, ProfiledStep::check_body_entry_info_confidence_interval,
+                                             [&] { return check_body_entry_info_confidence_interval(state, record); });
+        }
 
         /*
-         * Once some meta-data is marked as in/correct there is no need again, so all the following have been 
-         * optimised using a map for correctly defined meta-data and another one for incorrectly defined.
+         * The IDs are looked up in the schema of the source, which indexes the meta section by type and ID in hash
+         * tables, so these checks cost a few lookups per record however large the meta section is
          */
         
         // The chromosome/contig should be described in the meta section
-        check_contig_meta(state, record);
+        if (warning == nullptr) {
+            warning = ProfilePolicy::measure(state.profile, ProfiledStep::check_contig_meta,
+                                             [&] { return check_contig_meta(state, record); });
+        }
         
         // Alternate alleles of the form <SOME_ALT> should be described in the meta section
-        check_alternate_allele_meta(state, record);
+        if (warning == nullptr) {
+            warning = ProfilePolicy::measure(state.profile, ProfiledStep::check_alternate_allele_meta,
+                                             [&] { return check_alternate_allele_meta(state, record); });
+        }
         
         // Filters should be described in the meta section
-        check_filter_meta(state, record);
+        if (warning == nullptr) {
+            warning = ProfilePolicy::measure(state.profile, ProfiledStep::check_filter_meta,
+                                             [&] { return check_filter_meta(state, record); });
+        }
         
         // Info fields should be described in the meta section
-        check_info_meta(state, record);
+        if (warning == nullptr) {
+            warning = ProfilePolicy::measure(state.profile, ProfiledStep::check_info_meta,
+                                             [&] { return check_info_meta(state, record); });
+        }
         
         // Format fields should be described in the meta section
-        check_format_meta(state, record);
+        if (warning == nullptr) {
+            warning = ProfilePolicy::measure(state.profile, ProfiledStep::check_format_meta,
+                                             [&] { return check_format_meta(state, record); });
+        }
+
+        return warning;
     }
     
-    void ValidateOptionalPolicy::optional_check_body_section(ParsingState const & state) const
+    Error * ValidateOptionalPolicy::optional_check_body_section(ParsingState const & state) const
     {
+        return nullptr;
     }
 
-    void ValidateOptionalPolicy::check_body_entry_position_zero(ParsingState & state, Record const & record) const
+    Error * ValidateOptionalPolicy::check_body_entry_position_zero(ParsingState & state, Record const & record) const
     {
         if (record.position == 0) {
-            throw new PositionBodyError{state.n_lines,
+            return new PositionBodyError{state.n_lines,
                     "Position zero should only be used to reference a telomere"};
         }
+        return nullptr;
     }
     
-    void ValidateOptionalPolicy::check_body_entry_id_commas(ParsingState & state, Record const & record) const
+    Error * ValidateOptionalPolicy::check_body_entry_id_commas(ParsingState & state, Record const & record) const
     {
         for (auto & id : record.ids) {
             if (util::contains(id, ',')) {
-                throw new IdBodyError{state.n_lines,
+                return new IdBodyError{state.n_lines,
                         "Comma found in the ID column; if used as separator, please replace it with semi-colon"};
             }
         }
+        return nullptr;
     }
     
-    void ValidateOptionalPolicy::check_body_entry_reference_alternate_matching(ParsingState & state, Record const & record)
+    Error * ValidateOptionalPolicy::check_body_entry_reference_alternate_matching(ParsingState & state, Record const & record)
     {
         for (size_t i = 0; i < record.alternate_alleles.size(); ++i) {
             auto & alternate = record.alternate_alleles[i];
             auto type = record.types[i];
 
             if (type == RecordType::INDEL && alternate[0] != record.reference_allele[0]) {
-                throw new ReferenceAlleleBodyError{state.n_lines,
+                return new ReferenceAlleleBodyError{state.n_lines,
                         "Reference and alternate alleles do not share the first nucleotide"};
             }
         }
+        return nullptr;
     }
 
-    void ValidateOptionalPolicy::check_body_entry_alt_gvcf_gt_value(ParsingState & state, Record const & record) const
+    Error * ValidateOptionalPolicy::check_body_entry_alt_gvcf_gt_value(ParsingState & state, Record const & record) const
     {
         if (util::contains(record.alternate_alleles, GVCF_NON_VARIANT_ALLELE) && record.format[0] == vcf::GT) {
+            Genotype genotype;
             for (auto & sample : record.samples) {
-                if (sample_has_reference_in_all_alleles(sample)) {
-                    return;
+                genotype.decode(sample);
+                if (genotype.is_all_reference()) {
+                    return nullptr;
                 }
             }
-            throw new AlternateAllelesBodyError{state.n_lines,
+            return new AlternateAllelesBodyError{state.n_lines,
                     "At least one sample should report a genotype with all reference alleles, when ALT is " + GVCF_NON_VARIANT_ALLELE
                     + " as it is supposed to be a reference region"};
         }
+        return nullptr;
     }
 
-    bool ValidateOptionalPolicy::sample_has_reference_in_all_alleles(std::string const & sample) const
-    {
-        std::string gt_subfield = sample.substr(0, sample.find(':'));
-        std::vector<std::string> alleles;
-        util::string_split(gt_subfield, "/|", alleles);
-        for (auto & allele : alleles) {
-            if (allele != "0") {
-                return false;
-            }
-        }
-        return true;
-    }
-
-    void ValidateOptionalPolicy::check_body_entry_info_gvcf_end(ParsingState & state, Record const & record) const
+    Error * ValidateOptionalPolicy::check_body_entry_info_gvcf_end(ParsingState & state, Record const & record) const
     {
         if (util::contains(record.alternate_alleles, GVCF_NON_VARIANT_ALLELE)
             && record.info.find(END) == record.info.end()) {
-            throw new InfoBodyError{state.n_lines,
+            return new InfoBodyError{state.n_lines,
                     "INFO END should be provided when ALT is " + GVCF_NON_VARIANT_ALLELE
                     + " as it is supposed to be a region"};
         }
+        return nullptr;
     }
 
-    void ValidateOptionalPolicy::check_body_entry_info_imprecise(ParsingState & state, Record const & record) const
+    Error * ValidateOptionalPolicy::check_body_entry_info_imprecise(ParsingState & state, Record const & record) const
     {
         auto it = record.info.find(IMPRECISE);
         if (it != record.info.end() && it->second == "0") {
-            check_body_entry_info_other_tag(state, record.info, CIPOS);
-            check_body_entry_info_other_tag(state, record.info, CIEND);
+            Error * warning = check_body_entry_info_other_tag(state, record.info, CIPOS);
+            if (warning == nullptr) { warning = check_body_entry_info_other_tag(state, record.info, CIEND); }
+            return warning;
         }
+        return nullptr;
     }
 
-    void ValidateOptionalPolicy::check_body_entry_info_other_tag(ParsingState & state, std::multimap<std::string, std::string> const & info,
+    Error * ValidateOptionalPolicy::check_body_entry_info_other_tag(ParsingState & state, std::multimap<std::string, std::string> const & info,
                                                                  std::string const & tag) const
     {
         auto it = info.find(tag);
         if (it != info.end()) {
-            throw new InfoBodyError{state.n_lines,
+            return new InfoBodyError{state.n_lines,
                     "INFO " + tag + " tag should not be defined for a precise variant"};
         }
+        return nullptr;
     }
 
-    void ValidateOptionalPolicy::check_body_entry_info_svlen(ParsingState & state, Record const & record) const
+    Error * ValidateOptionalPolicy::check_body_entry_info_svlen(ParsingState & state, Record const & record) const
     {
         auto it = record.info.find(SVLEN);
         if (it != record.info.end()) {
-            std::vector<std::string> values;
-            util::string_split(it->second, ",", values);
-            if (values.size() != record.alternate_alleles.size()) {
-                throw new InfoBodyError{state.n_lines,
+            auto values = util::split_view(it->second, ",");
+            size_t n_values = std::distance(values.begin(), values.end());
+            if (n_values != record.alternate_alleles.size()) {
+                return new InfoBodyError{state.n_lines,
                         "INFO SVLEN should have same number of values as ALT ", "Expected " + std::to_string(record.alternate_alleles.size())
-                        + ", found " + std::to_string(values.size())};
+                        + ", found " + std::to_string(n_values)};
             }
         }
+        return nullptr;
     }
 
-    void ValidateOptionalPolicy::check_body_entry_info_confidence_interval(ParsingState & state, Record const & record) const
+    Error * ValidateOptionalPolicy::check_body_entry_info_confidence_interval(ParsingState & state, Record const & record) const
     {
-        std::vector<std::string> confidence_interval_tags = { CICN, CICNADJ, CIEND, CILEN, CIPOS };
-        for (auto & confidence_interval_tag : confidence_interval_tags) {
-            auto it = record.info.find(confidence_interval_tag);
+        // pointers to the constants, so the tags are not copied for every record
+        for (std::string const * confidence_interval_tag : { &CICN, &CICNADJ, &CIEND, &CILEN, &CIPOS }) {
+            auto it = record.info.find(*confidence_interval_tag);
             if (it != record.info.end()) {
-                std::vector<std::string> values;
-                util::string_split(it->second, ",", values);
-                if (std::stoi(values[0]) > 0 || std::stoi(values[1]) < 0) {
-                    throw new InfoBodyError{state.n_lines,
-                            "INFO " + confidence_interval_tag +
+                auto values = util::split_view(it->second, ",");
+                auto first = values.begin();
+                auto second = first != values.end() ? std::next(first) : first;
+                int lower;
+                int upper;
+                if (second != values.end() && util::parse_int(first->begin, first->end, lower)
+                        && util::parse_int(second->begin, second->end, upper) && (lower > 0 || upper < 0)) {
+                    return new InfoBodyError{state.n_lines,
+                            "INFO " + *confidence_interval_tag +
                             " is a confidence interval tag, which should have first value <= 0 and second value >= 0"};
                 }
             }
         }
+        return nullptr;
     }
     
-    void ValidateOptionalPolicy::check_contig_meta(ParsingState & state, Record const & record) const
+    Error * ValidateOptionalPolicy::check_contig_meta(ParsingState & state, Record const & record) const
     {
         // The associated 'contig' meta entry should exist (notify only once)
-        std::string current_chromosome = record.chromosome;
+        std::string const & current_chromosome = record.chromosome;
+        auto & described_contigs = state.described_contigs;
 
-        if (state.is_well_defined_meta(CONTIG, current_chromosome)) {
-            return; // Check only once
+        if (record.contig < described_contigs.size() && described_contigs[record.contig]) {
+            return nullptr; // Check only once
         }
         
-        std::pair<meta_iterator, meta_iterator> range = state.source->meta_entries.equal_range(CONTIG);
+        HeaderSchema const & schema = state.source->schema();
 
-        if (is_record_subfield_in_header(current_chromosome, range.first, range.second)) {
-            state.add_well_defined_meta(CONTIG, current_chromosome);
+        if (schema.find(CONTIG, current_chromosome) != nullptr) {
+            if (record.contig != unknown_contig) {
+                if (record.contig >= described_contigs.size()) {
+                    described_contigs.resize(record.contig + 1, false);
+                }
+                described_contigs[record.contig] = true;
+            }
         } else {
-            throw new NoMetaDefinitionError{
+            return new NoMetaDefinitionError{
                     state.n_lines,
-                    "Chromosome/contig '" + current_chromosome + "' is not described in a 'contig' meta description"
+                    "Chromosome/contig '" + current_chromosome + "' is not described in a 'contig' meta description",
+                    "Chromosome/contig is not described in a 'contig' meta description"
             };
         }
+        return nullptr;
     }
     
-    void ValidateOptionalPolicy::check_alternate_allele_meta(ParsingState & state, Record const & record) const
+    Error * ValidateOptionalPolicy::check_alternate_allele_meta(ParsingState & state, Record const & record) const
     {
-        static boost::regex square_brackets_regex("<([a-zA-Z0-9:_]+)>");
-        std::pair<meta_iterator, meta_iterator> range = state.source->meta_entries.equal_range(ALT);
-        boost::cmatch pieces_match;
+        HeaderSchema const & schema = state.source->schema();
         
         for (auto & alternate : record.alternate_alleles) {
             // Check alternate ID is present in meta-entry (only applies to the form <SOME_ALT_ID>)
-            if (alternate[0] == '<' && boost::regex_match(alternate.c_str(), pieces_match, square_brackets_regex)) {
-                std::string alt_id = pieces_match[1];
-                
-                if (state.is_well_defined_meta(ALT, alt_id)) {
-                    continue; // Check only once
-                }
+            if (alternate[0] == '<' && is_symbolic_allele(alternate)) {
+                std::string alt_id = symbolic_allele_id(alternate);
                 
-                if (is_record_subfield_in_header(alt_id, range.first, range.second)) {
-                    state.add_well_defined_meta(ALT, alt_id);
-                } else {
-                    throw new NoMetaDefinitionError{
+                if (schema.find(ALT, alt_id) == nullptr) {
+                    return new NoMetaDefinitionError{
                             state.n_lines,
-                            "Alternate '<" + alt_id + ">' is not listed in a valid meta-data ALT entry"
+                            "Alternate '<" + alt_id + ">' is not listed in a valid meta-data ALT entry",
+                            "Alternate is not listed in a valid meta-data ALT entry"
                     };
                 }
             }
         }
+        return nullptr;
     }
     
-    void ValidateOptionalPolicy::check_filter_meta(ParsingState & state, Record const & record) const
+    Error * ValidateOptionalPolicy::check_filter_meta(ParsingState & state, Record const & record) const
     {
-        std::pair<meta_iterator, meta_iterator> range = state.source->meta_entries.equal_range(FILTER);
+        HeaderSchema const & schema = state.source->schema();
         
         for (auto & filter : record.filters) {
             if (filter == PASS || filter == MISSING_VALUE) { continue; } // No need to check PASS or missing data
             
-            if (state.is_well_defined_meta(FILTER, filter)) {
-                continue; // Check only once
-            }
-            
-            if (is_record_subfield_in_header(filter, range.first, range.second)) {
-                state.add_well_defined_meta(FILTER, filter);
-            } else {
-                throw new NoMetaDefinitionError{
+            if (schema.find(FILTER, filter) == nullptr) {
+                return new NoMetaDefinitionError{
                         state.n_lines,
-                        "FILTER '" + filter + "' is not listed in a valid meta-data FILTER entry"
+                        "FILTER '" + filter + "' is not listed in a valid meta-data FILTER entry",
+                        "FILTER is not listed in a valid meta-data FILTER entry"
                 };
             }
         }
+        return nullptr;
     }
     
-    void ValidateOptionalPolicy::check_info_meta(ParsingState & state, Record const & record) const
+    Error * ValidateOptionalPolicy::check_info_meta(ParsingState & state, Record const & record) const
     {
-        std::pair<meta_iterator, meta_iterator> range = state.source->meta_entries.equal_range(INFO);
+        HeaderSchema const & schema = state.source->schema();
         
         for (auto & field : record.info) {
             auto & id = field.first;
             if (field.first == MISSING_VALUE) { continue; } // No need to check missing data
             
-            if (state.is_well_defined_meta(INFO, id)) {
-                continue; // Check only once
-            }
-            
-            if (is_record_subfield_in_header(id, range.first, range.second)) {
-                state.add_well_defined_meta(INFO, id);
-            } else {
-                throw new NoMetaDefinitionError{
+            if (schema.find(INFO, id) == nullptr) {
+                return new NoMetaDefinitionError{
                         state.n_lines,
-                        "INFO '" + id + "' is not listed in a valid meta-data INFO entry"
+                        "INFO '" + id + "' is not listed in a valid meta-data INFO entry",
+                        "INFO is not listed in a valid meta-data INFO entry"
                 };
             }
         }
+        return nullptr;
     }
     
-    void ValidateOptionalPolicy::check_format_meta(ParsingState & state, Record const & record) const
+    Error * ValidateOptionalPolicy::check_format_meta(ParsingState & state, Record const & record) const
     {
-        std::pair<meta_iterator, meta_iterator> range = state.source->meta_entries.equal_range(FORMAT);
+        HeaderSchema const & schema = state.source->schema();
         
         for (auto & fm : record.format) {
-            if (state.is_well_defined_meta(FORMAT, fm)) {
-                continue; // Check only once
-            }
-            
-            if (is_record_subfield_in_header(fm, range.first, range.second)) {
-                state.add_well_defined_meta(FORMAT, fm);
-            } else {
-                throw new NoMetaDefinitionError{
+            if (schema.find(FORMAT, fm) == nullptr) {
+                return new NoMetaDefinitionError{
                         state.n_lines,
-                        "FORMAT '" + fm + "' is not listed in a valid meta-data FORMAT entry"
+                        "FORMAT '" + fm + "' is not listed in a valid meta-data FORMAT entry",
+                        "FORMAT is not listed in a valid meta-data FORMAT entry"
                 };
             }
         }
+        return nullptr;
     }
   }
 }
@@ -14,6 +14,18 @@
  * limitations under the License.
  */
 
+#include <cstring>
+
+#include "util/bgzf_block_reader.hpp"
+#include "util/bgzf_range_reader.hpp"
+#include "util/gzip_block_reader.hpp"
+#include "util/read_ahead_block_reader.hpp"
+#include "util/trace.hpp"
+#include "vcf/allocation_stats.hpp"
+#include "vcf/bcf_parser.hpp"
+#include "vcf/checkpoint.hpp"
+#include "vcf/debugulator.hpp"
+#include "vcf/header_cache.hpp"
 #include "vcf/validator.hpp"
 
 namespace ebi
@@ -24,48 +36,372 @@ namespace ebi
 
     std::unique_ptr<Parser> build_parser(std::string const &path,
                                          ValidationLevel level,
-                                         Version version);
+                                         Version version,
+                                         unsigned input_format,
+                                         size_t threads,
+                                         Profile * profile,
+                                         RecordSampling const & sampling);
+
+    /**
+     * Parser of the levels that store every record and report all the errors: warning, order, records and triage
+     */
+    std::unique_ptr<ParserImpl> build_record_validator(std::string const &path,
+                                                       ValidationLevel level,
+                                                       Version version,
+                                                       unsigned input_format,
+                                                       Profile * profile,
+                                                       RecordSampling const & sampling);
+
+    bool read_fileformat(const std::vector<char> &line,
+                         const std::string &fileName,
+                         std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                         Version &version);
+
+    char const * find_body(char const * begin, char const * end);
+
+    std::vector<char const *> split_body(char const * begin, char const * end, size_t chunks);
+
+    bool validate_in_chunks(char const * begin,
+                            char const * body,
+                            char const * end,
+                            ebi::vcf::ParserImpl &validator,
+                            std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                            size_t threads,
+                            debugulator::StreamingFixer * fixer,
+                            ProgressMonitor * progress,
+                            MemoryBudget * memory);
+
+    /**
+     * Parser of the body of a plain file whose header spans from `begin` to `body`. If the header is in the cache,
+     * its warnings are reported again; if not, it is parsed and reported, and added to the cache.
+     *
+     * @return nullptr, without reporting anything, if the header has errors, so the file is validated as if there
+     * was no cache
+     */
+    std::unique_ptr<ParserImpl> cached_body_parser(char const * begin,
+                                                   char const * body,
+                                                   std::string const &sourceName,
+                                                   ValidationLevel validationLevel,
+                                                   std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                                                   HeaderCache &headers,
+                                                   Profile * profile,
+                                                   RecordSampling const & sampling);
+
+    /**
+     * Validates the body of a plain file with the parser of cached_body_parser, in chunks like
+     * validate_in_chunks if it stores every record and there are several threads
+     */
+    bool validate_body(char const * begin,
+                       char const * body,
+                       char const * end,
+                       ebi::vcf::ParserImpl &validator,
+                       bool checks_records,
+                       std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                       size_t threads,
+                       ProgressMonitor * progress,
+                       MemoryBudget * memory);
+
+    std::string uncompressed_name(std::string const &source);
 
     bool validate(const std::vector<char> &firstLine,
-                  std::istream &input,
+                  util::BlockReader &input,
                   ebi::vcf::Parser &validator,
-                  std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs);
+                  std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                  debugulator::StreamingFixer * fixer,
+                  ProgressMonitor * progress,
+                  MemoryBudget * memory);
+
+    void parse_and_report(char const * begin,
+                          char const * end,
+                          ebi::vcf::Parser &validator,
+                          std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                          debugulator::StreamingFixer * fixer);
 
     void compressed_file_warning(std::string const & file_extension);
 
     void write_errors(const Parser &validator, const std::vector<std::unique_ptr<ReportWriter>> &outputs);
 
+    void fix_errors(const Parser &validator,
+                    char const * begin,
+                    char const * end,
+                    size_t first_unfinished_line,
+                    debugulator::StreamingFixer &fixer);
+
+    bool can_stop_early(const Parser &validator, const std::vector<std::unique_ptr<ReportWriter>> &outputs);
+
     ParserImpl::ParserImpl(std::shared_ptr<Source> source)
-            : ParsingState{source}
+            : ParsingState{source}, record_cache_capacity{HashRecordCache::default_capacity},
+              continues_previous{false}, first_state{0}
     {
         
     }
 
     void ParserImpl::parse(std::vector<char> const & text)
     {
-        char const * p = &text[0];
-        char const * pe = &text[0] + text.size();
-        char const * eof = nullptr;
-
-        clear();
-        parse_buffer(p, pe, eof);
+        parse(text.data(), text.data() + text.size());
     }
 
     void ParserImpl::parse(std::string const & text)
     {
-        char const * p = text.data();
-        char const * pe = text.data() + text.size();
+        parse(text.data(), text.data() + text.size());
+    }
+
+    void ParserImpl::parse(char const * begin, char const * end)
+    {
         char const * eof = nullptr;
 
         clear();
-        parse_buffer(p, pe, eof);
+        parse_range(begin, end, eof);
     }
 
     void ParserImpl::end()
     {
         char const * empty = "";
         clear();
-        parse_buffer(empty, empty, empty);
+        parse_range(empty, empty, empty);
+        report_duplicates_at_end();
+    }
+
+    void ParserImpl::end_decoded_records()
+    {
+        // the state machine is still where the body begins, at its end it would check the meta section again
+        clear();
+        report_duplicates_at_end();
+    }
+
+    void ParserImpl::report_duplicates_at_end()
+    {
+        // every variant has been read, so the duplicates are known now
+        if (spilled_records) {
+            for (auto & error : spilled_records->find_duplicates()) {
+                m_is_valid = false;
+                add_error(std::move(error));
+            }
+        }
+        if (forgotten_records) {
+            for (auto & error : forgotten_records->find_duplicates()) {
+                m_is_valid = false;
+                add_error(std::move(error));
+            }
+        }
+    }
+
+    void ParserImpl::parse_body(char const * begin, char const * end)
+    {
+        clear();
+        parse_range(begin, end, nullptr);
+    }
+
+    void ParserImpl::parse_range(char const * begin, char const * end, char const * eof)
+    {
+        AllocationScope allocation_scope{AllocationStage::parsing};
+        util::TraceSpan span{"parsing", "parse", "bytes", end - begin};
+        if (check_workers) {
+            parse_in_slices(begin, end, eof);
+        } else if (skips_valid_lines()) {
+            parse_skipping_valid_lines(begin, end, eof);
+        } else {
+            parse_buffer(begin, end, eof);
+        }
+    }
+
+    void ParserImpl::parse_skipping_valid_lines(char const * begin, char const * end, char const * eof)
+    {
+        // the state machine parses each line that can't be skipped, and the lines after it are checked again
+        char const * p = begin;
+        do {
+            p = skip_valid_lines(p, end);
+            char const * line_end = static_cast<char const *>(std::memchr(p, '\n', end - p));
+            line_end = line_end != nullptr ? line_end + 1 : end;
+            parse_buffer(p, line_end, line_end == end ? eof : nullptr);
+            p = line_end;
+        } while (p != end && !has_stopped());
+    }
+
+    std::unique_ptr<ParserImpl> ParserImpl::body_parser(size_t first_line, bool continues) const
+    {
+        std::unique_ptr<ParserImpl> parser{new_body_parser(source->body_source())};
+        parser->n_lines = first_line;
+        parser->profile = profile;
+        parser->record_sampling = record_sampling;
+        parser->max_reports_per_type = max_reports_per_type;
+        parser->set_record_cache_capacity(record_cache_capacity);
+        if (continues) {
+            parser->cs = cs;
+            parser->record_order = record_order;
+            parser->previous_records = previous_records;
+            parser->continues_previous = true;
+        }
+        parser->first_state = parser->cs;
+        return parser;
+    }
+
+    bool ParserImpl::append_body(ParserImpl const & next)
+    {
+        // the state machine usually starts a body line in the same state, unless it stopped at some error
+        if (!next.continues_previous && cs != next.first_state) {
+            return false;
+        }
+
+        if (next.continues_previous) {
+            cs = next.cs;
+            n_lines = next.n_lines;
+            record_order = next.record_order;
+            previous_records = next.previous_records;
+            m_is_valid = m_is_valid && next.m_is_valid;
+            return true;
+        }
+
+        // the first contig of `next` may continue the last one of this parser, other contigs can't be repeated
+        using ContigStatus = RecordOrder::ContigStatus;
+        RecordOrder const & next_order = next.record_order;
+        for (ContigId contig = 0; contig < next_order.contig_status.size(); ++contig) {
+            if (next_order.status(contig) != ContigStatus::UNSEEN && record_order.status(contig) != ContigStatus::UNSEEN
+                    && (contig != record_order.previous_contig || contig != next_order.first_contig
+                        || next_order.first_position < record_order.previous_position)) {
+                return false;
+            }
+        }
+        if (!previous_records.precedes(next.previous_records)) {
+            return false;
+        }
+
+        cs = next.cs;
+        n_lines = next.n_lines;
+
+        if (next_order.seen_contigs != 0) {
+            if (record_order.seen_contigs == 0) {
+                record_order.first_contig = next_order.first_contig;
+                record_order.first_position = next_order.first_position;
+            } else if (next_order.first_contig != record_order.previous_contig) {
+                record_order.set_status(record_order.previous_contig, ContigStatus::FINISHED);
+            }
+            for (ContigId contig = 0; contig < next_order.contig_status.size(); ++contig) {
+                if (next_order.status(contig) != ContigStatus::UNSEEN) {
+                    record_order.set_status(contig, next_order.status(contig));
+                }
+            }
+            record_order.previous_contig = next_order.previous_contig;
+            record_order.previous_position = next_order.previous_position;
+        }
+        previous_records.append(next.previous_records);
+        m_is_valid = m_is_valid && next.m_is_valid;
+        return true;
+    }
+
+    void ParserImpl::save_body_state(std::ostream & output) const
+    {
+        using ContigStatus = RecordOrder::ContigStatus;
+
+        util::write_number(output, static_cast<uint64_t>(cs));
+        util::write_number(output, n_lines);
+        util::write_number(output, m_is_valid);
+
+        // the contigs are written by name, their ids depend on the order they were interned in
+        util::write_number(output, record_order.seen_contigs);
+        for (ContigId contig = 0; contig < record_order.contig_status.size(); ++contig) {
+            if (record_order.status(contig) != ContigStatus::UNSEEN) {
+                util::write_string(output, contig_name(contig));
+                util::write_number(output, static_cast<uint64_t>(record_order.status(contig)));
+            }
+        }
+        if (record_order.seen_contigs != 0) {
+            util::write_string(output, contig_name(record_order.previous_contig));
+            util::write_number(output, record_order.previous_position);
+            util::write_string(output, contig_name(record_order.first_contig));
+            util::write_number(output, record_order.first_position);
+        }
+
+        previous_records.save(output);
+    }
+
+    void ParserImpl::load_body_state(std::istream & input)
+    {
+        using ContigStatus = RecordOrder::ContigStatus;
+
+        cs = static_cast<int>(util::read_number(input));
+        n_lines = util::read_number(input);
+        m_is_valid = util::read_number(input) != 0;
+
+        record_order = RecordOrder{};
+        for (size_t contigs = util::read_number(input); contigs != 0; --contigs) {
+            ContigId contig = intern_contig(util::read_string(input));
+            record_order.set_status(contig, static_cast<ContigStatus>(util::read_number(input)));
+        }
+        if (record_order.seen_contigs != 0) {
+            record_order.previous_contig = intern_contig(util::read_string(input));
+            record_order.previous_position = util::read_number(input);
+            record_order.first_contig = intern_contig(util::read_string(input));
+            record_order.first_position = util::read_number(input);
+        }
+
+        previous_records.load(input);
+    }
+
+    void ParserImpl::set_check_threads(size_t threads)
+    {
+        if (threads > 1) {
+            check_workers.reset(new util::WorkerPool{threads});
+            workers = check_workers.get();
+        } else {
+            check_workers.reset();
+            workers = nullptr;
+        }
+    }
+
+    void ParserImpl::set_record_cache_capacity(size_t capacity)
+    {
+        record_cache_capacity = capacity;
+        previous_records = HashRecordCache{capacity};
+    }
+
+    void ParserImpl::apply_memory_budget(MemoryBudget const & memory)
+    {
+        set_record_cache_capacity(memory.record_cache_capacity);
+        if (!memory.spill_directory.empty()) {
+            spilled_records = std::make_shared<ExternalRecordCache>(memory.spill_directory,
+                                                                    memory.sorted_run_capacity);
+            previous_records.spill_to(spilled_records);
+        } else if (memory.filtered_variants != 0) {
+            forgotten_records = std::make_shared<DuplicateFilter>(boost::filesystem::temp_directory_path().string(),
+                                                                  memory.filtered_variants,
+                                                                  memory.false_positive_rate);
+            previous_records.filter_forgotten(forgotten_records);
+        }
+    }
+
+    void ParserImpl::record_memory(MemoryBudget & memory) const
+    {
+        memory.record(MemoryArea::header, header_size());
+        memory.record(MemoryArea::line_buffers, line_buffers_size());
+        memory.record(MemoryArea::record_cache, previous_records.allocated_bytes());
+
+        // each pending record is about as big as its line, at most the longest one
+        memory.record(MemoryArea::pending_records,
+                      pending_records.size() * (sizeof(PendingRecord) + sizeof(Record) + line_buffers_size()));
+        memory.record(MemoryArea::parsed_reports,
+                      (errors().size() + warnings().size()) * MemoryBudget::queued_error_size);
+    }
+
+    void ParserImpl::parse_in_slices(char const * begin, char const * end, char const * eof)
+    {
+        size_t const slice_size = 1024 * 1024;
+
+        // the parser keeps its state between slices, like it does between buffers, but they end with a line, so
+        // that a long line is not copied to be carried to the next slice
+        char const * slice_begin = begin;
+        do {
+            char const * slice_end = slice_begin + std::min(static_cast<size_t>(end - slice_begin), slice_size);
+            char const * newline = std::find(slice_end, end, '\n');
+            slice_end = newline != end ? newline + 1 : end;
+            parse_buffer(slice_begin, slice_end, slice_end == end ? eof : nullptr);
+            check_pending_records();
+            report_pending_records();
+            slice_begin = slice_end;
+        } while (slice_begin != end);
+
+        // the reports of the pending records were added after those of the lines that followed them
+        sort_reports();
     }
 
     bool ParserImpl::is_valid() const
@@ -73,6 +409,11 @@ namespace ebi
         return m_is_valid;
     }
 
+    bool ParserImpl::has_stopped() const
+    {
+        return cs == 0;     // the error state of every ragel machine
+    }
+
     const std::vector<std::unique_ptr<Error>> & ParserImpl::errors() const
     {
         return ParsingState::errors;
@@ -83,62 +424,791 @@ namespace ebi
         return ParsingState::warnings;
     }
 
-    std::unique_ptr<Parser> build_parser(std::string const & path, ValidationLevel level, Version version)
+    const std::vector<size_t> & ParserImpl::error_lines_read() const
+    {
+        return ParsingState::error_lines_read;
+    }
+
+    const std::vector<size_t> & ParserImpl::warning_lines_read() const
+    {
+        return ParsingState::warning_lines_read;
+    }
+
+    size_t ParserImpl::omitted_errors() const
+    {
+        return n_omitted_errors;
+    }
+
+    size_t ParserImpl::omitted_warnings() const
+    {
+        return n_omitted_warnings;
+    }
+
+    size_t ParserImpl::first_unfinished_line() const
+    {
+        if (has_stopped()) {
+            return std::numeric_limits<size_t>::max();
+        }
+        return std::min(n_lines, previous_records.first_line());
+    }
+
+    size_t ParserImpl::lines_read() const
+    {
+        return n_lines - 1;
+    }
+
+    ContigId ParserImpl::last_contig() const
+    {
+        return record_order.seen_contigs != 0 ? record_order.previous_contig : unknown_contig;
+    }
+
+    size_t ParserImpl::last_position() const
+    {
+        return record_order.previous_position;
+    }
+
+    namespace
+    {
+      /**
+       * New parser of type ParserType, or of ProfiledParserType measuring in `profile` if it is provided
+       */
+      template <typename ParserType, typename ProfiledParserType>
+      ParserImpl * new_parser(std::shared_ptr<Source> source, Profile * profile)
+      {
+          if (profile == nullptr) {
+              return new ParserType(source);
+          }
+          ParserImpl * parser = new ProfiledParserType(source);
+          parser->profile = profile;
+          return parser;
+      }
+
+      /**
+       * New parser of a version with a Configuration, or with its ProfiledConfiguration if `profile` is provided
+       */
+      template <typename Configuration, typename ProfiledConfiguration>
+      ParserImpl * new_parser(std::shared_ptr<Source> source, Version version, Profile * profile)
+      {
+          switch (version) {
+          case Version::v41:
+              return new_parser<ParserImpl_v41<Configuration>, ParserImpl_v41<ProfiledConfiguration>>(source,
+                                                                                                       profile);
+          case Version::v42:
+              return new_parser<ParserImpl_v42<Configuration>, ParserImpl_v42<ProfiledConfiguration>>(source,
+                                                                                                       profile);
+          case Version::v43:
+              return new_parser<ParserImpl_v43<Configuration>, ParserImpl_v43<ProfiledConfiguration>>(source,
+                                                                                                       profile);
+          default:
+              throw std::invalid_argument{"Please choose one of the accepted VCF fileformat versions"};
+          }
+      }
+
+      /**
+       * Reads the next block of the input, counting its allocations as those of reading
+       */
+      bool read_block(util::BlockReader & input, util::Block & block)
+      {
+          AllocationScope allocation_scope{AllocationStage::reading};
+          util::TraceSpan span{"reading", "read", "bytes"};
+          bool read = input.read(block);
+          span.set_arg(read ? static_cast<int64_t>(block.size) : 0);
+          return read;
+      }
+
+      /**
+       * Raises the high-water marks of the memory used by a parser, if a budget is provided
+       */
+      void record_memory(Parser const & validator, MemoryBudget * memory)
+      {
+          auto parser_impl = dynamic_cast<ParserImpl const *>(&validator);
+          auto bcf_parser = dynamic_cast<BcfParser const *>(&validator);
+          if (bcf_parser != nullptr) {
+              parser_impl = &bcf_parser->text_parser();
+          }
+          if (memory != nullptr && parser_impl != nullptr) {
+              parser_impl->record_memory(*memory);
+          }
+      }
+
+      /**
+       * Lets the parser drop the errors and warnings of each type beyond those that the outputs write, unless
+       * some output writes all of them or they are needed to fix the input
+       */
+      void limit_reports(Parser & validator, std::vector<std::unique_ptr<ReportWriter>> const & outputs,
+                         debugulator::StreamingFixer * fixer)
+      {
+          if (fixer != nullptr || outputs.empty()) {
+              return;
+          }
+          size_t max_reports_per_type = 0;
+          for (auto & output : outputs) {
+              if (output->max_errors_per_type() == 0) {
+                  return;
+              }
+              max_reports_per_type = std::max(max_reports_per_type, output->max_errors_per_type());
+          }
+          auto parser_impl = dynamic_cast<ParserImpl *>(&validator);
+          auto bcf_parser = dynamic_cast<BcfParser *>(&validator);
+          if (bcf_parser != nullptr) {
+              parser_impl = &bcf_parser->text_parser();
+          }
+          if (parser_impl != nullptr) {
+              parser_impl->max_reports_per_type = max_reports_per_type;
+          }
+      }
+
+      /**
+       * Forwards the blocks of another reader, adding their size to the input bytes of a progress monitor, if any
+       */
+      class ProgressBlockReader : public util::BlockReader
+      {
+        public:
+          ProgressBlockReader(util::BlockReader & input, ProgressMonitor * progress)
+          : input(input), progress{progress}
+          {
+          }
+
+          bool is_in_memory() const override
+          {
+              return input.is_in_memory();
+          }
+
+        protected:
+          bool next_block(util::Block & block) override
+          {
+              if (!read_block(input, block)) {
+                  return false;
+              }
+              if (progress != nullptr) {
+                  progress->add_input_bytes(block.size);
+              }
+              return true;
+          }
+
+        private:
+          util::BlockReader & input;
+          ProgressMonitor * progress;
+      };
+    }
+
+    std::unique_ptr<Parser> build_parser(std::string const & path,
+                                         ValidationLevel level,
+                                         Version version,
+                                         unsigned input_format,
+                                         size_t threads,
+                                         Profile * profile,
+                                         RecordSampling const & sampling)
     {
-        std::shared_ptr<Source> source = std::make_shared<Source>(path, InputFormat::VCF_FILE_VCF, version);
-        auto records = std::vector<Record>{};
+        std::shared_ptr<Source> source = std::make_shared<Source>(path, input_format, version);
 
         switch (level) {
         case ValidationLevel::error:
-            switch (version) {
-            case ebi::vcf::Version::v41:
-                return std::unique_ptr<ebi::vcf::Parser>(new ebi::vcf::QuickValidator_v41(source));
-            case ebi::vcf::Version::v42:
-                return std::unique_ptr<ebi::vcf::Parser>(new ebi::vcf::QuickValidator_v42(source));
-            case ebi::vcf::Version::v43:
-                return std::unique_ptr<ebi::vcf::Parser>(new ebi::vcf::QuickValidator_v43(source));
-            default:
-                throw std::invalid_argument{"Please choose one of the accepted VCF fileformat versions"};
-            }
+            return std::unique_ptr<ebi::vcf::Parser>(
+                    new_parser<QuickValidatorCfg, ProfiledQuickValidatorCfg>(source, version, profile));
 
         case ValidationLevel::warning:
-            switch (version) {
-            case ebi::vcf::Version::v41:
-                return std::unique_ptr<ebi::vcf::Parser>(new ebi::vcf::FullValidator_v41(source));
-            case ebi::vcf::Version::v42:
-                return std::unique_ptr<ebi::vcf::Parser>(new ebi::vcf::FullValidator_v42(source));
-            case ebi::vcf::Version::v43:
-                return std::unique_ptr<ebi::vcf::Parser>(new ebi::vcf::FullValidator_v43(source));
-            default:
-                throw std::invalid_argument{"Please choose one of the accepted VCF fileformat versions"};
-            }
+        case ValidationLevel::order:
+        case ValidationLevel::records:
+        case ValidationLevel::triage: {
+            std::unique_ptr<ParserImpl> validator = build_record_validator(path, level, version, input_format,
+                                                                           profile, sampling);
+            validator->set_check_threads(threads);
+            return std::unique_ptr<ebi::vcf::Parser>(std::move(validator));
+        }
 
         case ValidationLevel::stop:
-            switch (version) {
-            case ebi::vcf::Version::v41:
-                return std::unique_ptr<ebi::vcf::Parser>(new ebi::vcf::Reader_v41(source));
-            case ebi::vcf::Version::v42:
-                return std::unique_ptr<ebi::vcf::Parser>(new ebi::vcf::Reader_v42(source));
-            case ebi::vcf::Version::v43:
-                return std::unique_ptr<ebi::vcf::Parser>(new ebi::vcf::Reader_v43(source));
-            default:
-                throw std::invalid_argument{"Please choose one of the accepted VCF fileformat versions"};
-            }
+            return std::unique_ptr<ebi::vcf::Parser>(
+                    new_parser<ReaderCfg, ProfiledReaderCfg>(source, version, profile));
 
         default:
             throw std::invalid_argument{"Please choose one of the accepted validation levels"};
         }
     }
 
+    std::unique_ptr<ParserImpl> build_record_validator(std::string const & path,
+                                                       ValidationLevel level,
+                                                       Version version,
+                                                       unsigned input_format,
+                                                       Profile * profile,
+                                                       RecordSampling const & sampling)
+    {
+        std::shared_ptr<Source> source = std::make_shared<Source>(path, input_format, version);
+
+        switch (level) {
+        case ValidationLevel::warning:
+            return std::unique_ptr<ParserImpl>(
+                    new_parser<FullValidatorCfg, ProfiledFullValidatorCfg>(source, version, profile));
+        case ValidationLevel::triage: {
+            std::unique_ptr<ParserImpl> validator{
+                    new_parser<FullValidatorCfg, ProfiledFullValidatorCfg>(source, version, profile)};
+            validator->record_sampling = sampling;
+            return validator;
+        }
+        case ValidationLevel::order:
+            return std::unique_ptr<ParserImpl>(
+                    new_parser<OrderValidatorCfg, ProfiledOrderValidatorCfg>(source, version, profile));
+        case ValidationLevel::records:
+            return std::unique_ptr<ParserImpl>(
+                    new_parser<RecordsValidatorCfg, ProfiledRecordsValidatorCfg>(source, version, profile));
+        default:
+            throw std::invalid_argument{"Please choose a validation level that checks every record"};
+        }
+    }
+
     bool is_valid_vcf_file(std::istream &input,
                            const std::string &sourceName,
                            ValidationLevel validationLevel,
-                           std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs)
+                           std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                           size_t threads,
+                           debugulator::StreamingFixer * fixer,
+                           Profile * profile,
+                           ProgressMonitor * progress,
+                           MemoryBudget * memory,
+                           RecordSampling const & sampling,
+                           RegionIndexBuilder * index_builder)
+    {
+        util::StreamBlockReader reader{input, memory != nullptr ? memory->block_size : util::default_block_size};
+        return is_valid_vcf_file(reader, sourceName, validationLevel, outputs, threads, fixer, profile, progress,
+                                 memory, sampling, index_builder);
+    }
+
+    bool is_valid_vcf_file(util::BlockReader &input,
+                           const std::string &sourceName,
+                           ValidationLevel validationLevel,
+                           std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                           size_t threads,
+                           debugulator::StreamingFixer * fixer,
+                           Profile * profile,
+                           ProgressMonitor * progress,
+                           MemoryBudget * memory,
+                           RecordSampling const & sampling,
+                           RegionIndexBuilder * index_builder)
+    {
+        // the input is read from another thread while parsing, unless it is already in memory, counting what is
+        // read for the progress
+        ProgressBlockReader counted_input{input, progress};
+        size_t block_size = memory != nullptr ? memory->block_size : util::default_block_size;
+        size_t read_ahead_buffers = memory != nullptr ? memory->read_ahead_buffers : util::default_read_ahead_buffers;
+        util::ReadAheadBlockReader read_ahead{counted_input, read_ahead_buffers};
+        util::Block first_block;
+        util::BlockReader * reader = &read_ahead;
+        std::unique_ptr<util::BgzfBlockReader> bgzf_decompressor;
+        std::unique_ptr<util::BlockReader> decompressor;
+        std::string fileName = sourceName;
+        unsigned input_format = InputFormat::VCF_FILE_VCF;
+
+        // gzip and BGZF are decompressed while validating, other compression formats are rejected
+        if (read_ahead.peek(first_block) && util::is_gzip(first_block)) {
+            if (util::is_bgzf(first_block)) {
+                input_format |= InputFormat::VCF_FILE_BGZIP;
+                if (index_builder != nullptr) {
+                    // the index needs the offset of each compressed block, that only the BGZF reader knows
+                    bgzf_decompressor.reset(new util::BgzfBlockReader{read_ahead, threads});
+                    decompressor.reset(new IndexingBlockReader{*bgzf_decompressor, *index_builder});
+                } else if (threads > 1) {
+                    decompressor.reset(new util::BgzfBlockReader{read_ahead, threads});
+                } else {
+                    decompressor.reset(new util::GzipBlockReader{read_ahead, block_size});
+                }
+            } else {
+                input_format |= InputFormat::VCF_FILE_GZIP;
+                decompressor.reset(new util::GzipBlockReader{read_ahead, block_size});
+            }
+            reader = decompressor.get();
+            fileName = uncompressed_name(sourceName);
+        }
+        if (index_builder != nullptr && (input_format & InputFormat::VCF_FILE_BGZIP) == 0) {
+            index_builder->fail("it is not compressed with BGZF");
+        }
+
+        std::vector<char> line;
+        reader->readline(line);
+
+        // the fileformat line of a BCF input is the first one of its header text, after the binary prefix
+        bool bcf = is_bcf(line.data(), line.data() + line.size());
+        std::vector<char> more;
+        while (bcf && line.size() <= bcf_prefix_size && !reader->readline(more).empty()) {
+            line.insert(line.end(), more.begin(), more.end());
+        }
+        std::vector<char> fileformat_line{line.begin() + (bcf ? std::min(line.size(), bcf_prefix_size) : 0),
+                                          line.end()};
+        if (bcf) {
+            if (fixer != nullptr) {
+                throw std::invalid_argument{"A BCF input can't be fixed"};
+            }
+            input_format |= InputFormat::VCF_FILE_BCF;
+            if (index_builder != nullptr) {
+                index_builder->fail("the records of a BCF file are not lines of text");
+            }
+        }
+
+        ebi::vcf::Version version;
+        if (!read_fileformat(fileformat_line, fileName, outputs, version)) {
+            if (fixer != nullptr) {
+                // nothing else can be validated, so the input is written as is
+                util::Block block;
+                fixer->add_input(line.data(), line.data() + line.size());
+                while (reader->read(block)) {
+                    fixer->add_input(block.data, block.data + block.size);
+                }
+            }
+            return false;
+        }
+        std::unique_ptr<Parser> validator = build_parser(sourceName, validationLevel, version, input_format,
+                                                         bcf ? 1 : threads, profile, sampling);
+        auto parser_impl = dynamic_cast<ParserImpl *>(validator.get());
+        if (bcf) {
+            // the records are decoded and checked one at a time, instead of their lines
+            validator.reset(new BcfParser{std::unique_ptr<ParserImpl>{
+                    static_cast<ParserImpl *>(validator.release())}});
+        }
+        if (memory != nullptr && parser_impl != nullptr) {
+            // the blocks read ahead, the one decompressed and the one copied by the stream, if any
+            memory->record(MemoryArea::input_buffers, (read_ahead_buffers + 2) * block_size);
+            parser_impl->apply_memory_budget(*memory);
+        }
+        return validate(line, *reader, *validator, outputs, fixer, progress, memory);
+    }
+
+    bool is_valid_vcf_file(util::MappedFileBlockReader &input,
+                           const std::string &sourceName,
+                           ValidationLevel validationLevel,
+                           std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                           size_t threads,
+                           debugulator::StreamingFixer * fixer,
+                           Profile * profile,
+                           ProgressMonitor * progress,
+                           MemoryBudget * memory,
+                           RecordSampling const & sampling,
+                           HeaderCache * headers,
+                           RegionIndexBuilder * index_builder)
+    {
+        util::Block file = input.contents();
+        if (progress != nullptr) {
+            progress->set_input_size(file.size);
+        }
+        if (index_builder != nullptr && !util::is_bgzf(file)) {
+            index_builder->fail("it is not compressed with BGZF");
+        }
+        char const * begin = file.data;
+        char const * end = file.data + file.size;
+        char const * body = file.size != 0 ? find_body(begin, end) : end;
+
+        bool checks_records = validationLevel == ValidationLevel::warning || validationLevel == ValidationLevel::order
+                              || validationLevel == ValidationLevel::records
+                              || validationLevel == ValidationLevel::triage;
+
+        // the header of a plain file may have been validated before, as part of the same batch
+        if (headers != nullptr && fixer == nullptr && body != end && !util::is_gzip(file) && !is_bcf(begin, end)) {
+            std::unique_ptr<ParserImpl> validator = cached_body_parser(begin, body, sourceName, validationLevel,
+                                                                       outputs, *headers, profile, sampling);
+            if (validator) {
+                return validate_body(begin, body, end, *validator, checks_records, outputs, threads, progress,
+                                     memory);
+            }
+        }
+
+        // only the body of a plain file whose header could be found is split, at a level that stores every record,
+        // unless some duplicates are only found at the end
+        if (threads <= 1 || !checks_records || body == end || util::is_gzip(file)
+                || is_bcf(begin, end) || (memory != nullptr && memory->finds_duplicates_at_end())) {
+            return is_valid_vcf_file(static_cast<util::BlockReader &>(input), sourceName, validationLevel, outputs,
+                                     threads, fixer, profile, progress, memory, sampling, index_builder);
+        }
+
+        std::vector<char> line{begin, std::find(begin, end, '\n') + 1};
+        ebi::vcf::Version version;
+        if (!read_fileformat(line, sourceName, outputs, version)) {
+            if (fixer != nullptr) {
+                fixer->add_input(begin, end);
+            }
+            return false;
+        }
+        std::unique_ptr<ParserImpl> validator = build_record_validator(sourceName, validationLevel, version,
+                                                                       InputFormat::VCF_FILE_VCF, profile, sampling);
+        if (memory != nullptr) {
+            validator->apply_memory_budget(*memory);
+        }
+        return validate_in_chunks(begin, body, end, *validator, outputs, threads, fixer, progress, memory);
+    }
+
+    bool is_valid_vcf_regions(util::MappedFileBlockReader &input,
+                              const std::string &sourceName,
+                              std::vector<Region> const & regions,
+                              RegionIndex const & index,
+                              ValidationLevel validationLevel,
+                              std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                              size_t threads,
+                              Profile * profile,
+                              ProgressMonitor * progress,
+                              MemoryBudget * memory,
+                              RecordSampling const & sampling)
+    {
+        util::Block file = input.contents();
+        if (!util::is_bgzf(file)) {
+            throw std::invalid_argument{"Only the regions of a BGZF file can be validated"};
+        }
+        size_t block_size = memory != nullptr ? memory->block_size : util::default_block_size;
+
+        // the header is read from the beginning of the file, up to the line of the samples
+        util::GzipBlockReader decompressed{input, block_size};
+        std::vector<char> line;
+        decompressed.readline(line);
+        ebi::vcf::Version version;
+        if (!read_fileformat(line, uncompressed_name(sourceName), outputs, version)) {
+            return false;
+        }
+        std::vector<char> header;
+        while (!line.empty() && line[0] == '#') {
+            header.insert(header.end(), line.begin(), line.end());
+            if (line.size() < 2 || line[1] != '#') {
+                break;
+            }
+            decompressed.readline(line);
+        }
+
+        std::unique_ptr<Parser> validator = build_parser(sourceName, validationLevel, version,
+                                                         InputFormat::VCF_FILE_VCF | InputFormat::VCF_FILE_BGZIP,
+                                                         threads, profile, sampling);
+        auto parser_impl = dynamic_cast<ParserImpl *>(validator.get());
+        if (memory != nullptr && parser_impl != nullptr) {
+            memory->record(MemoryArea::input_buffers, 2 * block_size);
+            parser_impl->apply_memory_budget(*memory);
+        }
+        RegionBlockReader records{file, index, regions, block_size};
+        return validate(header, records, *validator, outputs, nullptr, progress, memory);
+    }
+
+    namespace
     {
+      /**
+       * Provides the rest of a plain file held in memory from an offset, telling the offset of any position in it
+       */
+      class PlainRangeReader : public util::BlockReader
+      {
+        public:
+          PlainRangeReader(util::Block file, uint64_t offset, size_t block_size)
+          : file(file), offset{std::min<uint64_t>(offset, file.size)}, block_size{block_size}
+          {
+          }
+
+          uint64_t offset_of(char const * position) const
+          {
+              return static_cast<uint64_t>(position - file.data);
+          }
+
+        protected:
+          bool next_block(util::Block & block) override
+          {
+              if (offset == file.size) {
+                  return false;
+              }
+              size_t read_bytes = std::min<uint64_t>(block_size, file.size - offset);
+              block = util::Block{file.data + offset, read_bytes};
+              offset += read_bytes;
+              return true;
+          }
+
+        private:
+          util::Block file;
+          uint64_t offset;
+          size_t block_size;
+      };
+
+      /**
+       * Last position of a block that starts a line, or nullptr if none does
+       */
+      char const * last_line_start(char const * begin, char const * end)
+      {
+          for (char const * p = end; p != begin; --p) {
+              if (p[-1] == '\n') {
+                  return p;
+              }
+          }
+          return nullptr;
+      }
+
+      /**
+       * Parses the rest of the input from `offset`, writing a checkpoint when it is due at the beginning of the last
+       * line of a block, once the header (its first `header_lines`) has been parsed, and the incremental state at
+       * the beginning of the last line of the input if it is after the header. Some checks of the header are only
+       * done when the body begins, so neither is taken before. `file_offset` converts an offset of the input to the bytes of
+       * the file before it, for the progress.
+       */
+      template <typename RangeReader, typename FileOffset>
+      bool validate_with_checkpoints(RangeReader & input,
+                                     util::Block file,
+                                     uint64_t offset,
+                                     size_t header_lines,
+                                     ValidationLevel level,
+                                     ParserImpl & validator,
+                                     std::vector<std::unique_ptr<ReportWriter>> & outputs,
+                                     Checkpoints * checkpoints,
+                                     IncrementalState * incremental,
+                                     FileOffset file_offset,
+                                     ProgressMonitor * progress,
+                                     MemoryBudget * memory)
+      {
+          limit_reports(validator, outputs, nullptr);
+
+          // the line that continues in the next block is parsed with it, so the parser is always at the beginning
+          // of a line between blocks, at `line_offset`
+          std::vector<char> partial_line;
+          uint64_t line_offset = offset;
+          util::Block block;
+          uint64_t read_bytes = 0;
+          while (read_block(input, block)) {
+              char const * begin = block.data;
+              char const * end = block.data + block.size;
+              char const * line_start = last_line_start(begin, end);
+              if (line_start == nullptr) {
+                  partial_line.insert(partial_line.end(), begin, end);
+              } else {
+                  if (!partial_line.empty()) {
+                      parse_and_report(partial_line.data(), partial_line.data() + partial_line.size(), validator,
+                                       outputs, nullptr);
+                  }
+                  parse_and_report(begin, line_start, validator, outputs, nullptr);
+                  partial_line.assign(line_start, end);
+                  line_offset = input.offset_of(line_start);
+                  if (checkpoints != nullptr && checkpoints->is_due() && !validator.has_stopped()
+                          && validator.n_lines > header_lines) {
+                      checkpoints->write(file.size, line_offset, level, validator, outputs);
+                  }
+              }
+              record_memory(validator, memory);
+              if (progress != nullptr) {
+                  uint64_t file_bytes = file_offset(input.offset_of(end));
+                  progress->add_input_bytes(file_bytes - read_bytes);
+                  progress->add_parsed(validator, block.size);
+                  read_bytes = file_bytes;
+              }
+              if (can_stop_early(validator, outputs)) {
+                  if (progress != nullptr) {
+                      progress->finish();
+                  }
+                  if (checkpoints != nullptr) {
+                      checkpoints->remove();
+                  }
+                  return false;
+              }
+          }
+
+          if (incremental != nullptr && !validator.has_stopped() && validator.n_lines > header_lines) {
+              incremental->write(file, line_offset, level, validator);
+          }
+          if (!partial_line.empty()) {
+              parse_and_report(partial_line.data(), partial_line.data() + partial_line.size(), validator, outputs,
+                               nullptr);
+          }
+          validator.end();
+          write_errors(validator, outputs);
+          record_memory(validator, memory);
+          if (progress != nullptr) {
+              progress->finish(validator);
+          }
+          if (checkpoints != nullptr) {
+              checkpoints->remove();
+          }
+          return validator.is_valid();
+      }
+    }
+
+    bool is_valid_vcf_file_with_checkpoints(util::MappedFileBlockReader &input,
+                                            const std::string &sourceName,
+                                            ValidationLevel validationLevel,
+                                            std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                                            Checkpoints * checkpoints,
+                                            IncrementalState * incremental,
+                                            size_t threads,
+                                            Profile * profile,
+                                            ProgressMonitor * progress,
+                                            MemoryBudget * memory,
+                                            RecordSampling const & sampling)
+    {
+        if (memory != nullptr && memory->finds_duplicates_at_end()) {
+            throw std::invalid_argument{"The validation can't be continued later if some duplicates are only found "
+                                        "at the end"};
+        }
+        util::Block file = input.contents();
+        bool bgzf = util::is_bgzf(file);
+        if (util::is_gzip(file) && !bgzf) {
+            throw std::invalid_argument{"Only plain and BGZF files can be validated with checkpoints, not other "
+                                        "gzip files"};
+        }
+        if (progress != nullptr) {
+            progress->set_input_size(file.size);
+        }
+        size_t block_size = memory != nullptr ? memory->block_size : util::default_block_size;
+
+        // the header is read first, to be parsed again without reporting it when resuming
+        util::BlockReader * reader = &input;
+        std::unique_ptr<util::BlockReader> decompressor;
+        if (bgzf) {
+            decompressor.reset(new util::GzipBlockReader{input, block_size});
+            reader = decompressor.get();
+        }
         std::vector<char> line;
-        ebi::util::readline(input, line);
+        reader->readline(line);
+        ebi::vcf::Version version;
+        if (!read_fileformat(line, bgzf ? uncompressed_name(sourceName) : sourceName, outputs, version)) {
+            if (checkpoints != nullptr) {
+                checkpoints->remove();
+            }
+            return false;
+        }
+        std::vector<char> header;
+        size_t header_lines = 0;
+        while (!line.empty() && line[0] == '#') {
+            header.insert(header.end(), line.begin(), line.end());
+            ++header_lines;
+            if (line.size() < 2 || line[1] != '#') {
+                break;
+            }
+            reader->readline(line);
+        }
+
+        unsigned input_format = InputFormat::VCF_FILE_VCF | (bgzf ? InputFormat::VCF_FILE_BGZIP : 0);
+        std::unique_ptr<Parser> parser = build_parser(sourceName, validationLevel, version, input_format, threads,
+                                                      profile, sampling);
+        auto & validator = dynamic_cast<ParserImpl &>(*parser);
+        if (memory != nullptr) {
+            memory->record(MemoryArea::input_buffers, 2 * block_size);
+            validator.apply_memory_budget(*memory);
+        }
+
+        // a checkpoint already continues the incremental state, if the validation was resumed from one
+        uint64_t offset = 0;
+        if (checkpoints != nullptr && checkpoints->is_resuming()) {
+            validator.parse(header);
+            offset = checkpoints->restore(file.size, validationLevel, validator, outputs);
+            BOOST_LOG_TRIVIAL(info) << "Resuming the validation of " << sourceName << " from line "
+                                    << validator.n_lines << ", with the checkpoint " << checkpoints->get_path();
+        } else if (incremental != nullptr && incremental->is_continuing()) {
+            if (incremental->matches(file, validationLevel)) {
+                validator.parse(header);
+                offset = incremental->restore(validator);
+                BOOST_LOG_TRIVIAL(info) << "Validating " << sourceName << " from line " << validator.n_lines
+                                        << ", after the lines validated with the incremental state "
+                                        << incremental->get_path();
+                if (!validator.is_valid()) {
+                    BOOST_LOG_TRIVIAL(info) << "The lines of " << sourceName << " validated before were not valid";
+                }
+            } else {
+                BOOST_LOG_TRIVIAL(warning) << "The beginning of " << sourceName << " or the validation level changed "
+                                           << "since the incremental state " << incremental->get_path()
+                                           << " was written, validating it from the beginning";
+            }
+        }
+
+        if (bgzf) {
+            util::BgzfRangeReader records{file, {{offset, static_cast<util::VirtualOffset>(file.size) << 16}}};
+            return validate_with_checkpoints(records, file, offset, header_lines, validationLevel, validator, outputs,
+                                             checkpoints, incremental,
+                                             [](uint64_t virtual_offset) { return virtual_offset >> 16; },
+                                             progress, memory);
+        }
+        PlainRangeReader records{file, offset, block_size};
+        return validate_with_checkpoints(records, file, offset, header_lines, validationLevel, validator, outputs,
+                                         checkpoints, incremental, [](uint64_t file_offset) { return file_offset; },
+                                         progress, memory);
+    }
+
+    std::unique_ptr<ParserImpl> cached_body_parser(char const * begin,
+                                                   char const * body,
+                                                   std::string const &sourceName,
+                                                   ValidationLevel validationLevel,
+                                                   std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                                                   HeaderCache &headers,
+                                                   Profile * profile,
+                                                   RecordSampling const & sampling)
+    {
+        std::shared_ptr<CachedHeader const> cached = headers.find(begin, body, validationLevel, profile != nullptr);
+        if (cached) {
+            cached->report(outputs);
+            std::unique_ptr<ParserImpl> validator = cached->parser->body_parser(cached->parser->n_lines, false);
+            validator->source->name = sourceName;
+            validator->profile = profile;
+            validator->record_sampling = sampling;
+            return validator;
+        }
+
+        // nothing is reported until the header is known to have no errors
+        std::vector<char> line{begin, std::find(begin, body, '\n') + 1};
+        std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> no_outputs;
         ebi::vcf::Version version;
-        if (ebi::vcf::is_compressed_file(sourceName, line)) {
+        if (!read_fileformat(line, sourceName, no_outputs, version)) {
+            return nullptr;
+        }
+        // the parser of the header is kept in the cache, so it doesn't get threads to check the records
+        std::unique_ptr<Parser> parser = build_parser(sourceName, validationLevel, version, InputFormat::VCF_FILE_VCF,
+                                                      1, profile, sampling);
+        std::shared_ptr<ParserImpl> header_parser{static_cast<ParserImpl *>(parser.release())};
+        try {
+            header_parser->parse(begin, body);
+        } catch (...) {
+            return nullptr;
+        }
+        if (!header_parser->errors().empty() || header_parser->has_stopped()) {
+            return nullptr;
+        }
+
+        // the checks of the meta section run now, instead of when the first record begins
+        header_parser->end_decoded_header();
+        write_errors(*header_parser, outputs);
+        std::unique_ptr<ParserImpl> validator = header_parser->body_parser(header_parser->n_lines, false);
+
+        std::shared_ptr<CachedHeader> header = std::make_shared<CachedHeader>();
+        header->text.assign(begin, body);
+        header->level = validationLevel;
+        header->profiled = profile != nullptr;
+        for (auto & warning : header_parser->warnings()) {
+            header->warnings.emplace_back(warning->clone());
+        }
+        header->parser = std::move(header_parser);
+        headers.add(std::move(header));
+        return validator;
+    }
+
+    bool validate_body(char const * begin,
+                       char const * body,
+                       char const * end,
+                       ebi::vcf::ParserImpl &validator,
+                       bool checks_records,
+                       std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                       size_t threads,
+                       ProgressMonitor * progress,
+                       MemoryBudget * memory)
+    {
+        // no record has been parsed yet, so the budget can still size the cache for duplicates
+        if (memory != nullptr) {
+            validator.apply_memory_budget(*memory);
+        }
+        if (progress != nullptr) {
+            progress->add_input_bytes(body - begin);
+            progress->add_parsed(validator, body - begin);
+        }
+
+        if (threads > 1 && checks_records && (memory == nullptr || !memory->finds_duplicates_at_end())) {
+            return validate_in_chunks(body, body, end, validator, outputs, threads, nullptr, progress, memory);
+        }
+        if (checks_records) {
+            validator.set_check_threads(threads);
+        }
+        size_t block_size = memory != nullptr ? memory->block_size : util::default_block_size;
+        PlainRangeReader records{util::Block{begin, static_cast<size_t>(end - begin)},
+                                 static_cast<uint64_t>(body - begin), block_size};
+        ProgressBlockReader counted_records{records, progress};
+        return validate(std::vector<char>{}, counted_records, validator, outputs, nullptr, progress, memory);
+    }
+
+    bool read_fileformat(const std::vector<char> &line,
+                         const std::string &fileName,
+                         std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                         Version &version)
+    {
+        if (ebi::vcf::is_compressed_file(fileName, line)) {
             throw std::invalid_argument{"Input file should not be compressed"};
         }
         try {
@@ -149,8 +1219,414 @@ namespace ebi
             }
             return false;
         }
-        std::unique_ptr<Parser> validator = build_parser(sourceName, validationLevel, version);
-        return validate(line, input, *validator, outputs);
+        return true;
+    }
+
+    char const * find_body(char const * begin, char const * end)
+    {
+        std::string const header_start = "#CHROM";
+        char const * line = begin;
+        while (line != end) {
+            char const * line_end = std::find(line, end, '\n');
+            if (line_end == end) {
+                return end;
+            }
+            if (line_end - line >= 2 && line[0] == '#' && line[1] == '#') {
+                line = line_end + 1;
+            } else if (static_cast<size_t>(line_end - line) >= header_start.size()
+                       && std::equal(header_start.begin(), header_start.end(), line)) {
+                return line_end + 1;
+            } else {
+                return end;
+            }
+        }
+        return end;
+    }
+
+    std::vector<char const *> split_body(char const * begin, char const * end, size_t chunks)
+    {
+        std::vector<char const *> bounds{begin};
+        size_t chunk_size = static_cast<size_t>(end - begin) / chunks + 1;
+
+        for (size_t i = 1; i < chunks; ++i) {
+            char const * p = std::max(begin + std::min(i * chunk_size, static_cast<size_t>(end - begin)),
+                                      bounds.back());
+
+            // after a non-empty line, the parser is always ready to read a record, whatever that line contained
+            while (p != end) {
+                p = std::find(p, end, '\n');
+                if (p == end) {
+                    break;
+                }
+                ++p;
+                char const * line_start = p - 1;
+                while (line_start != begin && line_start[-1] != '\n') {
+                    --line_start;
+                }
+                size_t line_size = static_cast<size_t>(p - 1 - line_start);
+                if (line_size > 1 || (line_size == 1 && *line_start != '\r')) {
+                    break;
+                }
+            }
+
+            if (p == end) {
+                break;
+            }
+            if (p != bounds.back()) {
+                bounds.push_back(p);
+            }
+        }
+
+        bounds.push_back(end);
+        return bounds;
+    }
+
+    namespace
+    {
+      /**
+       * Chunks of the body of a plain file mapped in memory, that begin at line starts
+       */
+      class PlainChunks
+      {
+        public:
+          explicit PlainChunks(std::vector<char const *> bounds) : bounds(std::move(bounds))
+          {
+          }
+
+          size_t size() const
+          {
+              return bounds.size() - 1;
+          }
+
+          util::Block load(size_t i, size_t)
+          {
+              return util::Block{bounds[i], input_size(i)};
+          }
+
+          size_t input_size(size_t i) const
+          {
+              return static_cast<size_t>(bounds[i + 1] - bounds[i]);
+          }
+
+        private:
+          std::vector<char const *> bounds;
+      };
+
+      /**
+       * Chunks of the body of a BGZF file, between virtual offsets of record starts. Each chunk of a wave is
+       * decompressed into its own buffer, or slot, so they can be loaded at the same time.
+       */
+      class BgzfChunks
+      {
+        public:
+          BgzfChunks(util::Block compressed, std::vector<util::VirtualOffset> bounds, size_t slots)
+          : compressed(compressed), bounds(std::move(bounds)), texts(slots)
+          {
+          }
+
+          size_t size() const
+          {
+              return bounds.size() - 1;
+          }
+
+          util::Block load(size_t i, size_t slot)
+          {
+              AllocationScope allocation_scope{AllocationStage::reading};
+              std::vector<char> & text = texts[slot];
+              text.clear();
+              util::BgzfRangeReader reader{compressed, {{bounds[i], bounds[i + 1]}}};
+              util::Block block;
+              while (reader.read(block)) {
+                  text.insert(text.end(), block.data, block.data + block.size);
+              }
+              return util::Block{text.data(), text.size()};
+          }
+
+          /**
+           * Compressed bytes of a chunk
+           */
+          size_t input_size(size_t i) const
+          {
+              return static_cast<size_t>((bounds[i + 1] >> 16) - (bounds[i] >> 16));
+          }
+
+          /**
+           * Bytes allocated for the decompressed chunks
+           */
+          size_t buffered() const
+          {
+              size_t bytes = 0;
+              for (auto & text : texts) {
+                  bytes += text.capacity();
+              }
+              return bytes;
+          }
+
+        private:
+          util::Block compressed;
+          std::vector<util::VirtualOffset> bounds;
+          std::vector<std::vector<char>> texts;
+      };
+
+      /**
+       * Validates the chunks of a body whose header has been parsed by `validator`. The chunks are loaded and
+       * parsed in waves of one per thread, so a huge file doesn't keep all the reports in memory; the first chunk
+       * is parsed by the validator itself, and the parsers of the others are appended to it in order.
+       */
+      template <typename Chunks>
+      bool validate_chunks(Chunks & chunks,
+                           ebi::vcf::ParserImpl &validator,
+                           std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                           size_t threads,
+                           debugulator::StreamingFixer * fixer,
+                           ProgressMonitor * progress,
+                           MemoryBudget * memory)
+      {
+          size_t n_chunks = chunks.size();
+          util::WorkerPool workers{threads};
+          std::vector<util::Block> texts;
+          std::vector<size_t> first_lines;
+          std::vector<std::unique_ptr<ParserImpl>> parsers;
+          size_t next_line = validator.n_lines;
+
+          for (size_t wave = 0; wave < n_chunks; wave += threads) {
+              size_t wave_size = std::min(threads, n_chunks - wave);
+              texts.assign(wave_size, util::Block{nullptr, 0});
+              first_lines.assign(wave_size, 0);
+              workers.run(wave_size, [&](size_t j) {
+                  util::TraceSpan span{"reading", "load chunk", "chunk", static_cast<int64_t>(wave + j)};
+                  texts[j] = chunks.load(wave + j, j);
+                  first_lines[j] = static_cast<size_t>(std::count(texts[j].data, texts[j].data + texts[j].size,
+                                                                  '\n'));
+              });
+
+              parsers.clear();
+              parsers.resize(wave_size);
+              for (size_t j = 0; j < wave_size; ++j) {
+                  size_t chunk_lines = first_lines[j];
+                  first_lines[j] = next_line;
+                  next_line += chunk_lines;
+                  if (wave + j != 0) {
+                      parsers[j] = validator.body_parser(first_lines[j], false);
+                  }
+              }
+
+              workers.run(wave_size, [&](size_t j) {
+                  ParserImpl & parser = wave + j == 0 ? validator : *parsers[j];
+                  parser.parse_body(texts[j].data, texts[j].data + texts[j].size);
+              });
+
+              for (size_t j = 0; j < wave_size; ++j) {
+                  size_t i = wave + j;
+                  char const * begin = texts[j].data;
+                  char const * end = texts[j].data + texts[j].size;
+                  util::TraceSpan span{"parsing", "merge chunk", "chunk", static_cast<int64_t>(i)};
+                  ParserImpl * reported = &validator;
+                  if (i == 0) {
+                      write_errors(validator, outputs);
+                  } else {
+                      if (!validator.append_body(*parsers[j])) {
+                          // the reports depend on the previous chunks, so it's parsed again knowing them
+                          parsers[j] = validator.body_parser(first_lines[j], true);
+                          parsers[j]->set_check_threads(threads);
+                          parsers[j]->parse_body(begin, end);
+                          validator.append_body(*parsers[j]);
+                      }
+                      write_errors(*parsers[j], outputs);
+                      reported = parsers[j].get();
+                  }
+                  if (fixer != nullptr) {
+                      fix_errors(*reported, begin, end, validator.first_unfinished_line(), *fixer);
+                  }
+                  record_memory(*reported, memory);
+                  if (progress != nullptr) {
+                      progress->add_input_bytes(chunks.input_size(i));
+                      progress->add_parsed(*reported, texts[j].size);
+                  }
+
+                  // like a single pass over the whole file, nothing is read after an unrecoverable error
+                  if (validator.has_stopped()) {
+                      if (fixer != nullptr) {
+                          for (size_t rest = i + 1; rest < n_chunks; ++rest) {
+                              util::Block text = chunks.load(rest, 0);
+                              fixer->add_input(text.data, text.data + text.size);
+                          }
+                      }
+                      if (progress != nullptr) {
+                          progress->finish();
+                      }
+                      return validator.is_valid();
+                  }
+                  if (fixer == nullptr && can_stop_early(validator, outputs)) {
+                      if (progress != nullptr) {
+                          progress->finish();
+                      }
+                      return false;
+                  }
+              }
+          }
+
+          // the end of the input is parsed by the parser of the last chunk, which may have an unfinished line
+          ParserImpl & last = n_chunks == 1 ? validator : *parsers.back();
+          last.end();
+          write_errors(last, outputs);
+          record_memory(last, memory);
+          if (progress != nullptr) {
+              progress->finish(last);
+          }
+          if (fixer != nullptr) {
+              char const * empty = "";
+              fix_errors(last, empty, empty, last.first_unfinished_line(), *fixer);
+          }
+          return validator.is_valid() && last.is_valid();
+      }
+
+      /**
+       * Whether a virtual offset of a BGZF file is the start of a line that follows a non-empty one, so the body
+       * can be split there like in split_body. The offsets at the start of a block are not checked, and rejected.
+       */
+      bool follows_line(util::Block compressed, util::VirtualOffset offset)
+      {
+          if ((offset & 0xffff) < 3) {
+              return false;
+          }
+          util::BgzfRangeReader reader{compressed, {{offset - 3, offset}}};
+          util::Block block;
+          if (!reader.read(block) || block.size != 3) {
+              return false;
+          }
+          char const * c = block.data;
+          return c[2] == '\n' && c[1] != '\n' && !(c[1] == '\r' && c[0] == '\n');
+      }
+    }
+
+    bool validate_in_chunks(char const * begin,
+                            char const * body,
+                            char const * end,
+                            ebi::vcf::ParserImpl &validator,
+                            std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                            size_t threads,
+                            debugulator::StreamingFixer * fixer,
+                            ProgressMonitor * progress,
+                            MemoryBudget * memory)
+    {
+        size_t const max_chunk_size = 64 * 1024 * 1024;
+        limit_reports(validator, outputs, fixer);
+
+        // the header is parsed first, the chunks of the body need its meta entries and samples
+        parse_and_report(begin, body, validator, outputs, fixer);
+        if (progress != nullptr) {
+            progress->add_input_bytes(body - begin);
+            progress->add_parsed(validator, body - begin);
+        }
+
+        size_t chunks = std::max(threads, static_cast<size_t>(end - body) / max_chunk_size + 1);
+        PlainChunks bounds{split_body(body, end, chunks)};
+        return validate_chunks(bounds, validator, outputs, threads, fixer, progress, memory);
+    }
+
+    bool is_valid_vcf_indexed(util::MappedFileBlockReader &input,
+                              const std::string &sourceName,
+                              RegionIndex const & index,
+                              ValidationLevel validationLevel,
+                              std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                              size_t threads,
+                              Profile * profile,
+                              ProgressMonitor * progress,
+                              MemoryBudget * memory,
+                              RecordSampling const & sampling)
+    {
+        // less than the chunks of a plain file, because each one is decompressed in memory
+        size_t const max_chunk_size = 8 * 1024 * 1024;
+
+        util::Block file = input.contents();
+        bool checks_records = validationLevel == ValidationLevel::warning || validationLevel == ValidationLevel::order
+                              || validationLevel == ValidationLevel::records
+                              || validationLevel == ValidationLevel::triage;
+        bool splits = threads > 1 && checks_records && util::is_bgzf(file)
+                      && (memory == nullptr || !memory->finds_duplicates_at_end());
+
+        // the header is read from the beginning of the file, up to the line of the samples
+        std::vector<char> header;
+        util::VirtualOffset body_offset = 0;
+        bool has_body = false;
+        if (splits) {
+            util::BgzfRangeReader decompressed{file, {{0, static_cast<util::VirtualOffset>(file.size) << 16}}};
+            util::Block block;
+            size_t scanned = 0;
+            while (read_block(decompressed, block)) {
+                size_t previous = header.size();
+                header.insert(header.end(), block.data, block.data + block.size);
+                char const * body = find_body(header.data(), header.data() + header.size());
+                if (body != header.data() + header.size()) {
+                    body_offset = decompressed.offset_of(block.data + (body - header.data() - previous));
+                    header.resize(static_cast<size_t>(body - header.data()));
+                    has_body = true;
+                    break;
+                }
+
+                // a line that doesn't start with '#' means there is no line of samples
+                auto not_header = [](char a, char b) { return a == '\n' && b != '#'; };
+                if (header.empty() || header[0] != '#'
+                        || std::adjacent_find(header.begin() + scanned, header.end(), not_header) != header.end()) {
+                    break;
+                }
+                scanned = header.size() - 1;
+            }
+        }
+        if (!has_body) {
+            return is_valid_vcf_file(static_cast<util::BlockReader &>(input), sourceName, validationLevel, outputs,
+                                     threads, nullptr, profile, progress, memory, sampling);
+        }
+
+        std::vector<char> line{header.begin(), std::find(header.begin(), header.end(), '\n') + 1};
+        ebi::vcf::Version version;
+        if (!read_fileformat(line, uncompressed_name(sourceName), outputs, version)) {
+            return false;
+        }
+        std::unique_ptr<ParserImpl> validator = build_record_validator(
+                sourceName, validationLevel, version, InputFormat::VCF_FILE_VCF | InputFormat::VCF_FILE_BGZIP,
+                profile, sampling);
+        if (memory != nullptr) {
+            validator->apply_memory_budget(*memory);
+        }
+
+        if (progress != nullptr) {
+            progress->set_input_size(file.size);
+        }
+        parse_and_report(header.data(), header.data() + header.size(), *validator, outputs, nullptr);
+        if (progress != nullptr) {
+            progress->add_input_bytes(body_offset >> 16);
+            progress->add_parsed(*validator, header.size());
+        }
+
+        // the body is split where the index says a record starts, in chunks of about the same compressed size
+        uint64_t body_size = file.size - (body_offset >> 16);
+        uint64_t chunk_size = body_size / std::max<uint64_t>(threads, body_size / max_chunk_size + 1) + 1;
+        std::vector<util::VirtualOffset> bounds{body_offset};
+        for (util::VirtualOffset offset : index.record_offsets()) {
+            if ((offset >> 16) >= (bounds.back() >> 16) + chunk_size && follows_line(file, offset)) {
+                bounds.push_back(offset);
+            }
+        }
+        bounds.push_back(static_cast<util::VirtualOffset>(file.size) << 16);
+
+        BgzfChunks chunks{file, std::move(bounds), threads};
+        bool is_valid = validate_chunks(chunks, *validator, outputs, threads, nullptr, progress, memory);
+        if (memory != nullptr) {
+            memory->record(MemoryArea::input_buffers, chunks.buffered());
+        }
+        return is_valid;
+    }
+
+    std::string uncompressed_name(std::string const &source)
+    {
+        boost::filesystem::path source_name(source);
+        std::string file_extension = source_name.extension().string();
+        if (file_extension == GZ || file_extension == BGZ) {
+            return source_name.replace_extension().string();
+        }
+        return source;
     }
 
     bool is_compressed_file(const std::string &source,
@@ -222,39 +1698,134 @@ namespace ebi
     }
 
     bool validate(const std::vector<char> &firstLine,
-                  std::istream &input,
+                  util::BlockReader &input,
                   ebi::vcf::Parser &validator,
-                  std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs)
+                  std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                  debugulator::StreamingFixer * fixer,
+                  ProgressMonitor * progress,
+                  MemoryBudget * memory)
     {
-        std::vector<char> line;
-        line.reserve(default_line_buffer_size);
+        util::Block block;
+        limit_reports(validator, outputs, fixer);
 
-        validator.parse(firstLine);
-        write_errors(validator, outputs);
+        parse_and_report(firstLine.data(), firstLine.data() + firstLine.size(), validator, outputs, fixer);
+        if (progress != nullptr) {
+            progress->add_parsed(validator, firstLine.size());
+        }
 
-        while (ebi::util::readline(input, line).size() != 0) {
-            validator.parse(line);
-            write_errors(validator, outputs);
+        // the blocks are not split by lines, the parser keeps its state between calls
+        while (read_block(input, block)) {
+            parse_and_report(block.data, block.data + block.size, validator, outputs, fixer);
+            record_memory(validator, memory);
+            if (progress != nullptr) {
+                progress->add_parsed(validator, block.size);
+            }
+            if (fixer == nullptr && can_stop_early(validator, outputs)) {
+                if (progress != nullptr) {
+                    progress->finish();
+                }
+                return false;
+            }
         }
 
         validator.end();
         write_errors(validator, outputs);
+        record_memory(validator, memory);
+        if (progress != nullptr) {
+            progress->finish(validator);
+        }
+        if (fixer != nullptr) {
+            char const * no_input = firstLine.data() + firstLine.size();
+            fix_errors(validator, no_input, no_input, validator.first_unfinished_line(), *fixer);
+        }
 
         return validator.is_valid();
     }
 
+    void parse_and_report(char const * begin,
+                          char const * end,
+                          ebi::vcf::Parser &validator,
+                          std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                          debugulator::StreamingFixer * fixer)
+    {
+        try {
+            validator.parse(begin, end);
+        } catch (...) {
+            // when aborting, report what was found in the buffer before the failing line
+            write_errors(validator, outputs);
+            throw;
+        }
+        write_errors(validator, outputs);
+        if (fixer != nullptr) {
+            fix_errors(validator, begin, end, validator.first_unfinished_line(), *fixer);
+        }
+    }
+
     void write_errors(const Parser &validator, const std::vector<std::unique_ptr<ReportWriter>> &outputs)
     {
-        for (auto &error : validator.errors()) {
+        AllocationScope allocation_scope{AllocationStage::reporting};
+        auto & errors = validator.errors();
+        auto & warnings = validator.warnings();
+        auto & error_lines = validator.error_lines_read();
+        auto & warning_lines = validator.warning_lines_read();
+        size_t omitted = validator.omitted_errors() + validator.omitted_warnings();
+        if (omitted != 0) {
             for (auto &output : outputs) {
-                output->write_error(*error);
+                output->omit(omitted);
             }
         }
-        for (auto &error : validator.warnings()) {
-            for (auto &output : outputs) {
-                output->write_warning(*error);
+        if (errors.empty() && warnings.empty()) {
+            return;
+        }
+
+        // for each line, its errors and then its warnings, delivered to each output in a single batch
+        std::vector<ReportedError> batch;
+        batch.reserve(errors.size() + warnings.size());
+        size_t i = 0, j = 0;
+        while (i < errors.size() || j < warnings.size()) {
+            if (j == warnings.size() || (i < errors.size() && error_lines[i] <= warning_lines[j])) {
+                batch.push_back(ReportedError{Severity::ERROR, errors[i].get()});
+                ++i;
+            } else {
+                batch.push_back(ReportedError{Severity::WARNING, warnings[j].get()});
+                ++j;
+            }
+        }
+
+        util::TraceSpan span{"reporting", "report", "errors", static_cast<int64_t>(batch.size())};
+        for (auto &output : outputs) {
+            output->write_batch(batch);
+        }
+    }
+
+    void fix_errors(const Parser &validator,
+                    char const * begin,
+                    char const * end,
+                    size_t first_unfinished_line,
+                    debugulator::StreamingFixer &fixer)
+    {
+        // the text goes first, an error may be in its last line
+        fixer.add_input(begin, end);
+        for (auto &error : validator.errors()) {
+            fixer.add_error(*error);
+        }
+        fixer.write_until(first_unfinished_line);
+    }
+
+    bool can_stop_early(const Parser &validator, const std::vector<std::unique_ptr<ReportWriter>> &outputs)
+    {
+        // once the file is known to be invalid, the rest of it is only worth reading for a report that wants more
+        if (validator.is_valid() || outputs.empty()) {
+            return false;
+        }
+        for (auto &output : outputs) {
+            if (!output->is_full()) {
+                return false;
             }
         }
+        BOOST_LOG_TRIVIAL(warning) << "The reports reached their maximum number of errors, the rest of the input "
+                                      "was not validated";
+        return true;
     }
   }
 }
@@ -16,14 +16,16 @@
  * limitations under the License.
  */
 
+#include "vcf/validator.hpp"
 
-#line 229 "src/vcf/vcf_v41.ragel"
+
+#line 231 "src/vcf/vcf_v41.ragel"
 
 
 namespace
 {
   
-#line 27 "inc/vcf/validator_detail_v41.hpp"
+#line 29 "src/vcf/validator_detail_v41.cpp"
 static const int vcf_v41_start = 1;
 static const int vcf_v41_first_final = 521;
 static const int vcf_v41_error = 0;
@@ -35,7 +37,7 @@ static const int vcf_v41_en_meta_section_skip = 519;
 static const int vcf_v41_en_body_section_skip = 520;
 
 
-#line 235 "src/vcf/vcf_v41.ragel"
+#line 237 "src/vcf/vcf_v41.ragel"
 
 }
 
@@ -49,20 +51,25 @@ namespace ebi
     : ParserImpl{source}
     {
       
-#line 53 "inc/vcf/validator_detail_v41.hpp"
+#line 55 "src/vcf/validator_detail_v41.cpp"
 	{
 	cs = vcf_v41_start;
 	}
 
-#line 249 "src/vcf/vcf_v41.ragel"
+#line 251 "src/vcf/vcf_v41.ragel"
 
     }
 
     template <typename Configuration>
     void ParserImpl_v41<Configuration>::parse_buffer(char const * p, char const * pe, char const * eof)
     {
-      
-#line 66 "inc/vcf/validator_detail_v41.hpp"
+      ParsePolicy::handle_buffer_begin(*this, p);
+
+      {
+        typename ProfilePolicy::ParsingTimer parsing_timer{profile};
+
+        
+#line 73 "src/vcf/validator_detail_v41.cpp"
 	{
 	if ( p == pe )
 		goto _test_eof;
@@ -73,943 +80,938 @@ case 1:
 		goto st2;
 	goto tr0;
 tr0:
-#line 60 "src/vcf/vcf.ragel"
+#line 56 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
         p--; {goto st519;}
     }
 	goto st0;
 tr14:
-#line 29 "src/vcf/vcf_v41.ragel"
+#line 31 "src/vcf/vcf_v41.ragel"
 	{
         ErrorPolicy::handle_error(*this,
                 new FileformatError{n_lines, "The fileformat declaration is not 'fileformat=VCFv4.1'"});
         p--; {goto st519;}
     }
-#line 60 "src/vcf/vcf.ragel"
+#line 56 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
         p--; {goto st519;}
     }
 	goto st0;
 tr24:
-#line 60 "src/vcf/vcf.ragel"
+#line 56 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
-#line 379 "src/vcf/vcf.ragel"
+#line 370 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
             "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st520;}
     }
-#line 78 "src/vcf/vcf.ragel"
+#line 73 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st520;}
     }
 	goto st0;
 tr26:
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
-#line 379 "src/vcf/vcf.ragel"
+#line 370 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
             "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st520;}
     }
-#line 78 "src/vcf/vcf.ragel"
+#line 73 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st520;}
     }
 	goto st0;
 tr29:
-#line 247 "src/vcf/vcf.ragel"
+#line 238 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
         p--; {goto st519;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 262 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
         p--; {goto st519;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st519;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st519;}
     }
-#line 259 "src/vcf/vcf.ragel"
+#line 250 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
         p--; {goto st519;}
     }
-#line 265 "src/vcf/vcf.ragel"
+#line 256 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
         p--; {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st519;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 290 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
         p--; {goto st519;}
     }
-#line 320 "src/vcf/vcf.ragel"
+#line 311 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	goto st0;
 tr39:
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	goto st0;
 tr125:
-#line 247 "src/vcf/vcf.ragel"
+#line 238 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	goto st0;
 tr133:
-#line 252 "src/vcf/vcf.ragel"
+#line 243 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines,
             "ALT metadata ID is not prefixed by DEL/INS/DUP/INV/CNV and suffixed by ':' and a text sequence"});
         p--; {goto st519;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 238 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	goto st0;
 tr152:
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st519;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 238 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	goto st0;
 tr162:
-#line 271 "src/vcf/vcf.ragel"
+#line 262 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
         p--; {goto st519;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	goto st0;
 tr165:
-#line 271 "src/vcf/vcf.ragel"
+#line 262 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	goto st0;
 tr175:
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st519;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 262 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	goto st0;
 tr194:
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st519;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 262 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	goto st0;
 tr204:
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	goto st0;
 tr214:
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st519;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	goto st0;
 tr227:
-#line 36 "src/vcf/vcf_v41.ragel"
+#line 38 "src/vcf/vcf_v41.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "FORMAT metadata Number is not a number, A, G or dot"});
         p--; {goto st519;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	goto st0;
 tr236:
-#line 293 "src/vcf/vcf.ragel"
+#line 284 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String"});
         p--; {goto st519;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	goto st0;
 tr253:
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st519;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	goto st0;
 tr264:
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	goto st0;
 tr273:
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st519;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	goto st0;
 tr286:
-#line 42 "src/vcf/vcf_v41.ragel"
+#line 44 "src/vcf/vcf_v41.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Number is not a number, A, G or dot"});
         p--; {goto st519;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	goto st0;
 tr295:
-#line 293 "src/vcf/vcf.ragel"
+#line 284 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String"});
         p--; {goto st519;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	goto st0;
 tr312:
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st519;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	goto st0;
 tr323:
-#line 299 "src/vcf/vcf.ragel"
+#line 290 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	goto st0;
 tr333:
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st519;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 290 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	goto st0;
 tr345:
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	goto st0;
 tr356:
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	goto st0;
 tr361:
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st519;}
     }
-#line 352 "src/vcf/vcf.ragel"
+#line 343 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)"});
         p--; {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	goto st0;
 tr363:
-#line 352 "src/vcf/vcf.ragel"
+#line 343 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)"});
         p--; {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	goto st0;
 tr373:
-#line 352 "src/vcf/vcf.ragel"
+#line 343 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)"});
         p--; {goto st519;}
     }
-#line 357 "src/vcf/vcf.ragel"
+#line 348 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)"});
         p--; {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	goto st0;
 tr376:
-#line 357 "src/vcf/vcf.ragel"
+#line 348 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)"});
         p--; {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	goto st0;
 tr386:
-#line 357 "src/vcf/vcf.ragel"
+#line 348 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)"});
         p--; {goto st519;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	goto st0;
 tr389:
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	goto st0;
 tr412:
-#line 259 "src/vcf/vcf.ragel"
+#line 250 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	goto st0;
 tr421:
-#line 373 "src/vcf/vcf.ragel"
+#line 364 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata URL is not valid"});
         p--; {goto st519;}
     }
-#line 259 "src/vcf/vcf.ragel"
+#line 250 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	goto st0;
 tr442:
-#line 265 "src/vcf/vcf.ragel"
+#line 256 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	goto st0;
 tr453:
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st519;}
     }
-#line 265 "src/vcf/vcf.ragel"
+#line 256 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	goto st0;
 tr491:
-#line 320 "src/vcf/vcf.ragel"
+#line 311 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	goto st0;
 tr503:
-#line 373 "src/vcf/vcf.ragel"
+#line 364 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata URL is not valid"});
         p--; {goto st519;}
     }
-#line 320 "src/vcf/vcf.ragel"
+#line 311 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	goto st0;
 tr526:
-#line 379 "src/vcf/vcf.ragel"
+#line 370 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
             "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st520;}
     }
-#line 78 "src/vcf/vcf.ragel"
+#line 73 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st520;}
     }
 	goto st0;
 tr566:
-#line 78 "src/vcf/vcf.ragel"
+#line 73 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st520;}
     }
 	goto st0;
 tr581:
-#line 396 "src/vcf/vcf.ragel"
+#line 386 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new ChromosomeBodyError{n_lines});
         p--; {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st520;}
     }
 	goto st0;
 tr584:
-#line 402 "src/vcf/vcf.ragel"
+#line 392 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new PositionBodyError{n_lines});
         p--; {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st520;}
     }
 	goto st0;
 tr588:
-#line 408 "src/vcf/vcf.ragel"
+#line 398 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new IdBodyError{n_lines});
         p--; {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st520;}
     }
 	goto st0;
 tr593:
-#line 414 "src/vcf/vcf.ragel"
+#line 404 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new ReferenceAlleleBodyError{n_lines});
         p--; {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st520;}
     }
 	goto st0;
 tr597:
-#line 420 "src/vcf/vcf.ragel"
+#line 410 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new AlternateAllelesBodyError{n_lines});
         p--; {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st520;}
     }
 	goto st0;
 tr606:
-#line 426 "src/vcf/vcf.ragel"
+#line 416 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new QualityBodyError{n_lines});
         p--; {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st520;}
     }
 	goto st0;
 tr617:
-#line 432 "src/vcf/vcf.ragel"
+#line 422 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FilterBodyError{n_lines});
         p--; {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st520;}
     }
 	goto st0;
 tr625:
-#line 443 "src/vcf/vcf.ragel"
+#line 433 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info key is not a sequence of alphanumeric and/or punctuation characters"});
         p--; {goto st520;}
     }
-#line 438 "src/vcf/vcf.ragel"
+#line 428 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
         p--; {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st520;}
     }
 	goto st0;
 tr629:
-#line 50 "src/vcf/vcf_v41.ragel"
+#line 52 "src/vcf/vcf_v41.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FormatBodyError{n_lines});
         p--; {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st520;}
     }
 	goto st0;
 tr634:
-#line 461 "src/vcf/vcf.ragel"
+#line 452 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " does not start with a valid genotype";
-        ErrorPolicy::handle_error(*this, new SamplesFieldBodyError{n_lines, message_stream.str(), "", "GT"});
+        ErrorPolicy::handle_error(*this, new SamplesFieldBodyError{n_lines, message_stream.str(), "", "GT", -1,
+                                                                   "Sample does not start with a valid genotype"});
         p--; {goto st520;}
     }
-#line 454 "src/vcf/vcf.ragel"
+#line 444 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " is not a valid string";
-        ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str()});
+        ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str(), "",
+                                                              "Sample is not a valid string"});
         p--; {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st520;}
     }
 	goto st0;
 tr642:
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st520;}
     }
 	goto st0;
 tr644:
-#line 454 "src/vcf/vcf.ragel"
+#line 444 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " is not a valid string";
-        ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str()});
+        ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str(), "",
+                                                              "Sample is not a valid string"});
         p--; {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st520;}
     }
 	goto st0;
 tr650:
-#line 448 "src/vcf/vcf.ragel"
+#line 438 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info field value is not a comma-separated list of valid strings (maybe it contains whitespaces?)"});
         p--; {goto st520;}
     }
-#line 438 "src/vcf/vcf.ragel"
+#line 428 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
         p--; {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st520;}
     }
 	goto st0;
 tr699:
-#line 78 "src/vcf/vcf.ragel"
+#line 73 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st520;}
     }
-#line 396 "src/vcf/vcf.ragel"
+#line 386 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new ChromosomeBodyError{n_lines});
         p--; {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st520;}
     }
 	goto st0;
 tr706:
-#line 438 "src/vcf/vcf.ragel"
+#line 428 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
         p--; {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st520;}
     }
 	goto st0;
-#line 1013 "inc/vcf/validator_detail_v41.hpp"
+#line 1015 "src/vcf/validator_detail_v41.cpp"
 st0:
 cs = 0;
 	goto _out;
@@ -1107,109 +1109,109 @@ case 14:
 tr15:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st15;
 st15:
 	if ( ++p == pe )
 		goto _test_eof15;
 case 15:
-#line 1122 "inc/vcf/validator_detail_v41.hpp"
+#line 1124 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 67 )
 		goto tr16;
 	goto tr14;
 tr16:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st16;
 st16:
 	if ( ++p == pe )
 		goto _test_eof16;
 case 16:
-#line 1136 "inc/vcf/validator_detail_v41.hpp"
+#line 1138 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 70 )
 		goto tr17;
 	goto tr14;
 tr17:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st17;
 st17:
 	if ( ++p == pe )
 		goto _test_eof17;
 case 17:
-#line 1150 "inc/vcf/validator_detail_v41.hpp"
+#line 1152 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 118 )
 		goto tr18;
 	goto tr14;
 tr18:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st18;
 st18:
 	if ( ++p == pe )
 		goto _test_eof18;
 case 18:
-#line 1164 "inc/vcf/validator_detail_v41.hpp"
+#line 1166 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 52 )
 		goto tr19;
 	goto tr14;
 tr19:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st19;
 st19:
 	if ( ++p == pe )
 		goto _test_eof19;
 case 19:
-#line 1178 "inc/vcf/validator_detail_v41.hpp"
+#line 1180 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 46 )
 		goto tr20;
 	goto tr14;
 tr20:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st20;
 st20:
 	if ( ++p == pe )
 		goto _test_eof20;
 case 20:
-#line 1192 "inc/vcf/validator_detail_v41.hpp"
+#line 1194 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 49 )
 		goto tr21;
 	goto tr14;
 tr21:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st21;
 st21:
 	if ( ++p == pe )
 		goto _test_eof21;
 case 21:
-#line 1206 "inc/vcf/validator_detail_v41.hpp"
+#line 1208 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 10: goto tr22;
 		case 13: goto tr23;
 	}
 	goto tr14;
 tr22:
-#line 99 "src/vcf/vcf.ragel"
+#line 93 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_fileformat(*this);
@@ -1220,20 +1222,16 @@ tr22:
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st22;
 st22:
 	if ( ++p == pe )
 		goto _test_eof22;
 case 22:
-#line 1237 "inc/vcf/validator_detail_v41.hpp"
+#line 1235 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 35 )
 		goto st23;
 	goto tr24;
@@ -1269,31 +1267,31 @@ case 24:
 tr30:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st25;
 tr40:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st25;
 st25:
 	if ( ++p == pe )
 		goto _test_eof25;
 case 25:
-#line 1290 "inc/vcf/validator_detail_v41.hpp"
+#line 1288 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 61 )
 		goto tr41;
 	if ( 32 <= (*p) && (*p) <= 126 )
 		goto tr40;
 	goto tr39;
 tr41:
-#line 188 "src/vcf/vcf.ragel"
+#line 182 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this);
     }
@@ -1302,7 +1300,7 @@ st26:
 	if ( ++p == pe )
 		goto _test_eof26;
 case 26:
-#line 1306 "inc/vcf/validator_detail_v41.hpp"
+#line 1304 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto st30;
 		case 60: goto st35;
@@ -1313,24 +1311,24 @@ case 26:
 tr42:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st27;
 tr47:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st27;
 st27:
 	if ( ++p == pe )
 		goto _test_eof27;
 case 27:
-#line 1334 "inc/vcf/validator_detail_v41.hpp"
+#line 1332 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 10: goto tr45;
 		case 13: goto tr46;
@@ -1343,7 +1341,7 @@ tr45:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 196 "src/vcf/vcf.ragel"
+#line 190 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_meta_line(*this);
@@ -1353,17 +1351,13 @@ tr45:
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st28;
 tr55:
-#line 196 "src/vcf/vcf.ragel"
+#line 190 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_meta_line(*this);
@@ -1373,20 +1367,16 @@ tr55:
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st28;
 st28:
 	if ( ++p == pe )
 		goto _test_eof28;
 case 28:
-#line 1390 "inc/vcf/validator_detail_v41.hpp"
+#line 1380 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 35 )
 		goto st23;
 	goto tr26;
@@ -1395,7 +1385,7 @@ tr46:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 196 "src/vcf/vcf.ragel"
+#line 190 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_meta_line(*this);
@@ -1405,17 +1395,13 @@ tr46:
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st29;
 tr56:
-#line 196 "src/vcf/vcf.ragel"
+#line 190 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_meta_line(*this);
@@ -1425,20 +1411,16 @@ tr56:
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st29;
 st29:
 	if ( ++p == pe )
 		goto _test_eof29;
 case 29:
-#line 1442 "inc/vcf/validator_detail_v41.hpp"
+#line 1424 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 10 )
 		goto st28;
 	goto tr39;
@@ -1456,24 +1438,24 @@ case 30:
 tr49:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st31;
 tr52:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st31;
 st31:
 	if ( ++p == pe )
 		goto _test_eof31;
 case 31:
-#line 1477 "inc/vcf/validator_detail_v41.hpp"
+#line 1459 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr53;
 		case 92: goto tr54;
@@ -1484,7 +1466,7 @@ case 31:
 tr50:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -1501,7 +1483,7 @@ st32:
 	if ( ++p == pe )
 		goto _test_eof32;
 case 32:
-#line 1505 "inc/vcf/validator_detail_v41.hpp"
+#line 1487 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -1510,24 +1492,24 @@ case 32:
 tr51:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st33;
 tr54:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st33;
 st33:
 	if ( ++p == pe )
 		goto _test_eof33;
 case 33:
-#line 1531 "inc/vcf/validator_detail_v41.hpp"
+#line 1513 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr57;
 		case 92: goto tr54;
@@ -1538,7 +1520,7 @@ case 33:
 tr57:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -1549,7 +1531,7 @@ st34:
 	if ( ++p == pe )
 		goto _test_eof34;
 case 34:
-#line 1553 "inc/vcf/validator_detail_v41.hpp"
+#line 1535 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -1593,24 +1575,24 @@ case 36:
 tr61:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st37;
 tr64:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st37;
 st37:
 	if ( ++p == pe )
 		goto _test_eof37;
 case 37:
-#line 1614 "inc/vcf/validator_detail_v41.hpp"
+#line 1596 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr65;
 		case 92: goto tr66;
@@ -1621,7 +1603,7 @@ case 37:
 tr62:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -1638,31 +1620,31 @@ st38:
 	if ( ++p == pe )
 		goto _test_eof38;
 case 38:
-#line 1642 "inc/vcf/validator_detail_v41.hpp"
+#line 1624 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 62 )
 		goto st32;
 	goto tr39;
 tr63:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st39;
 tr66:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st39;
 st39:
 	if ( ++p == pe )
 		goto _test_eof39;
 case 39:
-#line 1666 "inc/vcf/validator_detail_v41.hpp"
+#line 1648 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr68;
 		case 92: goto tr66;
@@ -1673,7 +1655,7 @@ case 39:
 tr68:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -1684,7 +1666,7 @@ st40:
 	if ( ++p == pe )
 		goto _test_eof40;
 case 40:
-#line 1688 "inc/vcf/validator_detail_v41.hpp"
+#line 1670 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr65;
 		case 62: goto tr69;
@@ -1696,14 +1678,14 @@ case 40:
 tr69:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st41;
 st41:
 	if ( ++p == pe )
 		goto _test_eof41;
 case 41:
-#line 1707 "inc/vcf/validator_detail_v41.hpp"
+#line 1689 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -1716,14 +1698,14 @@ case 41:
 tr59:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st42;
 st42:
 	if ( ++p == pe )
 		goto _test_eof42;
 case 42:
-#line 1727 "inc/vcf/validator_detail_v41.hpp"
+#line 1709 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 95 )
 		goto st42;
 	if ( (*p) < 48 ) {
@@ -1741,24 +1723,24 @@ case 42:
 tr60:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st43;
 tr71:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st43;
 st43:
 	if ( ++p == pe )
 		goto _test_eof43;
 case 43:
-#line 1762 "inc/vcf/validator_detail_v41.hpp"
+#line 1744 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr72;
 		case 95: goto tr71;
@@ -1776,7 +1758,7 @@ case 43:
 		goto tr71;
 	goto tr39;
 tr72:
-#line 192 "src/vcf/vcf.ragel"
+#line 186 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this);
     }
@@ -1785,7 +1767,7 @@ st44:
 	if ( ++p == pe )
 		goto _test_eof44;
 case 44:
-#line 1789 "inc/vcf/validator_detail_v41.hpp"
+#line 1771 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 34 )
 		goto st63;
 	if ( (*p) < 45 ) {
@@ -1800,24 +1782,24 @@ case 44:
 tr73:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st45;
 tr75:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st45;
 st45:
 	if ( ++p == pe )
 		goto _test_eof45;
 case 45:
-#line 1821 "inc/vcf/validator_detail_v41.hpp"
+#line 1803 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 44: goto tr76;
 		case 62: goto tr53;
@@ -1838,7 +1820,7 @@ st46:
 	if ( ++p == pe )
 		goto _test_eof46;
 case 46:
-#line 1842 "inc/vcf/validator_detail_v41.hpp"
+#line 1824 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 95 )
 		goto tr77;
 	if ( (*p) < 48 ) {
@@ -1856,14 +1838,14 @@ case 46:
 tr77:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st47;
 st47:
 	if ( ++p == pe )
 		goto _test_eof47;
 case 47:
-#line 1867 "inc/vcf/validator_detail_v41.hpp"
+#line 1849 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 95 )
 		goto st47;
 	if ( (*p) < 48 ) {
@@ -1881,24 +1863,24 @@ case 47:
 tr78:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st48;
 tr80:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st48;
 st48:
 	if ( ++p == pe )
 		goto _test_eof48;
 case 48:
-#line 1902 "inc/vcf/validator_detail_v41.hpp"
+#line 1884 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr81;
 		case 95: goto tr80;
@@ -1916,7 +1898,7 @@ case 48:
 		goto tr80;
 	goto tr39;
 tr81:
-#line 192 "src/vcf/vcf.ragel"
+#line 186 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this);
     }
@@ -1925,7 +1907,7 @@ st49:
 	if ( ++p == pe )
 		goto _test_eof49;
 case 49:
-#line 1929 "inc/vcf/validator_detail_v41.hpp"
+#line 1911 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 34 )
 		goto st50;
 	if ( (*p) < 45 ) {
@@ -1951,24 +1933,24 @@ case 50:
 tr83:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st51;
 tr86:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st51;
 st51:
 	if ( ++p == pe )
 		goto _test_eof51;
 case 51:
-#line 1972 "inc/vcf/validator_detail_v41.hpp"
+#line 1954 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 92: goto tr88;
@@ -1979,7 +1961,7 @@ case 51:
 tr84:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -1996,7 +1978,7 @@ st52:
 	if ( ++p == pe )
 		goto _test_eof52;
 case 52:
-#line 2000 "inc/vcf/validator_detail_v41.hpp"
+#line 1982 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 44: goto st46;
 		case 62: goto st32;
@@ -2005,24 +1987,24 @@ case 52:
 tr85:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st53;
 tr88:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st53;
 st53:
 	if ( ++p == pe )
 		goto _test_eof53;
 case 53:
-#line 2026 "inc/vcf/validator_detail_v41.hpp"
+#line 2008 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr90;
 		case 92: goto tr88;
@@ -2033,7 +2015,7 @@ case 53:
 tr90:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -2044,7 +2026,7 @@ st54:
 	if ( ++p == pe )
 		goto _test_eof54;
 case 54:
-#line 2048 "inc/vcf/validator_detail_v41.hpp"
+#line 2030 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 44: goto tr91;
@@ -2057,23 +2039,23 @@ case 54:
 tr105:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st55;
 tr91:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st55;
 tr102:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -2084,7 +2066,7 @@ st55:
 	if ( ++p == pe )
 		goto _test_eof55;
 case 55:
-#line 2088 "inc/vcf/validator_detail_v41.hpp"
+#line 2070 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 47: goto tr86;
@@ -2118,24 +2100,24 @@ case 55:
 tr93:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st56;
 tr95:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st56;
 st56:
 	if ( ++p == pe )
 		goto _test_eof56;
 case 56:
-#line 2139 "inc/vcf/validator_detail_v41.hpp"
+#line 2121 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 47: goto tr86;
@@ -2169,24 +2151,24 @@ case 56:
 tr94:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st57;
 tr96:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st57;
 st57:
 	if ( ++p == pe )
 		goto _test_eof57;
 case 57:
-#line 2190 "inc/vcf/validator_detail_v41.hpp"
+#line 2172 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 47: goto tr86;
@@ -2216,20 +2198,20 @@ case 57:
 		goto tr96;
 	goto tr39;
 tr97:
-#line 192 "src/vcf/vcf.ragel"
+#line 186 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st58;
 st58:
 	if ( ++p == pe )
 		goto _test_eof58;
 case 58:
-#line 2233 "inc/vcf/validator_detail_v41.hpp"
+#line 2215 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr99;
 		case 44: goto tr86;
@@ -2242,24 +2224,24 @@ case 58:
 tr101:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st59;
 tr98:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st59;
 st59:
 	if ( ++p == pe )
 		goto _test_eof59;
 case 59:
-#line 2263 "inc/vcf/validator_detail_v41.hpp"
+#line 2245 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 44: goto tr102;
@@ -2272,23 +2254,23 @@ case 59:
 tr106:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st60;
 tr92:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st60;
 tr103:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -2299,7 +2281,7 @@ st60:
 	if ( ++p == pe )
 		goto _test_eof60;
 case 60:
-#line 2303 "inc/vcf/validator_detail_v41.hpp"
+#line 2285 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -2312,24 +2294,24 @@ case 60:
 tr104:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st61;
 tr100:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st61;
 st61:
 	if ( ++p == pe )
 		goto _test_eof61;
 case 61:
-#line 2333 "inc/vcf/validator_detail_v41.hpp"
+#line 2315 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr90;
 		case 44: goto tr102;
@@ -2349,7 +2331,7 @@ st62:
 	if ( ++p == pe )
 		goto _test_eof62;
 case 62:
-#line 2353 "inc/vcf/validator_detail_v41.hpp"
+#line 2335 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr84;
 		case 44: goto tr105;
@@ -2373,24 +2355,24 @@ case 63:
 tr107:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st64;
 tr109:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st64;
 st64:
 	if ( ++p == pe )
 		goto _test_eof64;
 case 64:
-#line 2394 "inc/vcf/validator_detail_v41.hpp"
+#line 2376 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 92: goto tr110;
@@ -2401,24 +2383,24 @@ case 64:
 tr108:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st65;
 tr110:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st65;
 st65:
 	if ( ++p == pe )
 		goto _test_eof65;
 case 65:
-#line 2422 "inc/vcf/validator_detail_v41.hpp"
+#line 2404 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr111;
 		case 92: goto tr110;
@@ -2429,7 +2411,7 @@ case 65:
 tr111:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -2440,7 +2422,7 @@ st66:
 	if ( ++p == pe )
 		goto _test_eof66;
 case 66:
-#line 2444 "inc/vcf/validator_detail_v41.hpp"
+#line 2426 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 44: goto tr112;
@@ -2453,13 +2435,13 @@ case 66:
 tr112:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st67;
 tr122:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -2470,7 +2452,7 @@ st67:
 	if ( ++p == pe )
 		goto _test_eof67;
 case 67:
-#line 2474 "inc/vcf/validator_detail_v41.hpp"
+#line 2456 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 47: goto tr109;
@@ -2504,24 +2486,24 @@ case 67:
 tr116:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st68;
 tr114:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st68;
 st68:
 	if ( ++p == pe )
 		goto _test_eof68;
 case 68:
-#line 2525 "inc/vcf/validator_detail_v41.hpp"
+#line 2507 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 47: goto tr109;
@@ -2555,24 +2537,24 @@ case 68:
 tr117:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st69;
 tr115:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st69;
 st69:
 	if ( ++p == pe )
 		goto _test_eof69;
 case 69:
-#line 2576 "inc/vcf/validator_detail_v41.hpp"
+#line 2558 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 47: goto tr109;
@@ -2604,9 +2586,9 @@ case 69:
 tr118:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
-#line 192 "src/vcf/vcf.ragel"
+#line 186 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this);
     }
@@ -2615,7 +2597,7 @@ st70:
 	if ( ++p == pe )
 		goto _test_eof70;
 case 70:
-#line 2619 "inc/vcf/validator_detail_v41.hpp"
+#line 2601 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr99;
 		case 44: goto tr109;
@@ -2628,24 +2610,24 @@ case 70:
 tr121:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st71;
 tr119:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st71;
 st71:
 	if ( ++p == pe )
 		goto _test_eof71;
 case 71:
-#line 2649 "inc/vcf/validator_detail_v41.hpp"
+#line 2631 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 44: goto tr122;
@@ -2658,13 +2640,13 @@ case 71:
 tr113:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st72;
 tr123:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -2675,7 +2657,7 @@ st72:
 	if ( ++p == pe )
 		goto _test_eof72;
 case 72:
-#line 2679 "inc/vcf/validator_detail_v41.hpp"
+#line 2661 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -2688,24 +2670,24 @@ case 72:
 tr124:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st73;
 tr120:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st73;
 st73:
 	if ( ++p == pe )
 		goto _test_eof73;
 case 73:
-#line 2709 "inc/vcf/validator_detail_v41.hpp"
+#line 2691 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr111;
 		case 44: goto tr122;
@@ -2718,18 +2700,18 @@ case 73:
 tr31:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st74;
 st74:
 	if ( ++p == pe )
 		goto _test_eof74;
 case 74:
-#line 2733 "inc/vcf/validator_detail_v41.hpp"
+#line 2715 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 76: goto tr126;
@@ -2740,14 +2722,14 @@ case 74:
 tr126:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st75;
 st75:
 	if ( ++p == pe )
 		goto _test_eof75;
 case 75:
-#line 2751 "inc/vcf/validator_detail_v41.hpp"
+#line 2733 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 84: goto st76;
@@ -2765,7 +2747,7 @@ case 76:
 		goto tr40;
 	goto tr125;
 tr128:
-#line 108 "src/vcf/vcf.ragel"
+#line 102 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "ALT");
     }
@@ -2774,7 +2756,7 @@ st77:
 	if ( ++p == pe )
 		goto _test_eof77;
 case 77:
-#line 2778 "inc/vcf/validator_detail_v41.hpp"
+#line 2760 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 60 )
 		goto st78;
 	goto tr125;
@@ -2833,20 +2815,20 @@ case 81:
 		goto tr134;
 	goto tr133;
 tr134:
-#line 144 "src/vcf/vcf.ragel"
+#line 138 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st82;
 st82:
 	if ( ++p == pe )
 		goto _test_eof82;
 case 82:
-#line 2850 "inc/vcf/validator_detail_v41.hpp"
+#line 2832 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 61 )
 		goto st82;
 	if ( (*p) < 63 ) {
@@ -2879,28 +2861,28 @@ case 82:
 tr137:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st83;
 tr135:
-#line 144 "src/vcf/vcf.ragel"
+#line 138 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st83;
 st83:
 	if ( ++p == pe )
 		goto _test_eof83;
 case 83:
-#line 2904 "inc/vcf/validator_detail_v41.hpp"
+#line 2886 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 44: goto tr138;
 		case 61: goto tr137;
@@ -2921,7 +2903,7 @@ st84:
 	if ( ++p == pe )
 		goto _test_eof84;
 case 84:
-#line 2925 "inc/vcf/validator_detail_v41.hpp"
+#line 2907 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 68 )
 		goto st85;
 	goto tr125;
@@ -3010,7 +2992,7 @@ case 96:
 		goto tr151;
 	goto tr125;
 tr151:
-#line 156 "src/vcf/vcf.ragel"
+#line 150 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Description");
     }
@@ -3019,7 +3001,7 @@ st97:
 	if ( ++p == pe )
 		goto _test_eof97;
 case 97:
-#line 3023 "inc/vcf/validator_detail_v41.hpp"
+#line 3005 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr154;
 		case 92: goto tr155;
@@ -3030,24 +3012,24 @@ case 97:
 tr153:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st98;
 tr156:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st98;
 st98:
 	if ( ++p == pe )
 		goto _test_eof98;
 case 98:
-#line 3051 "inc/vcf/validator_detail_v41.hpp"
+#line 3033 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr157;
 		case 92: goto tr158;
@@ -3058,7 +3040,7 @@ case 98:
 tr154:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -3075,7 +3057,7 @@ st99:
 	if ( ++p == pe )
 		goto _test_eof99;
 case 99:
-#line 3079 "inc/vcf/validator_detail_v41.hpp"
+#line 3061 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 62 )
 		goto st100;
 	goto tr152;
@@ -3091,24 +3073,24 @@ case 100:
 tr155:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st101;
 tr158:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st101;
 st101:
 	if ( ++p == pe )
 		goto _test_eof101;
 case 101:
-#line 3112 "inc/vcf/validator_detail_v41.hpp"
+#line 3094 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr160;
 		case 92: goto tr158;
@@ -3119,7 +3101,7 @@ case 101:
 tr160:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -3130,7 +3112,7 @@ st102:
 	if ( ++p == pe )
 		goto _test_eof102;
 case 102:
-#line 3134 "inc/vcf/validator_detail_v41.hpp"
+#line 3116 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr157;
 		case 62: goto tr161;
@@ -3142,14 +3124,14 @@ case 102:
 tr161:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st103;
 st103:
 	if ( ++p == pe )
 		goto _test_eof103;
 case 103:
-#line 3153 "inc/vcf/validator_detail_v41.hpp"
+#line 3135 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -3162,18 +3144,18 @@ case 103:
 tr32:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st104;
 st104:
 	if ( ++p == pe )
 		goto _test_eof104;
 case 104:
-#line 3177 "inc/vcf/validator_detail_v41.hpp"
+#line 3159 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 73: goto tr163;
@@ -3185,14 +3167,14 @@ case 104:
 tr163:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st105;
 st105:
 	if ( ++p == pe )
 		goto _test_eof105;
 case 105:
-#line 3196 "inc/vcf/validator_detail_v41.hpp"
+#line 3178 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 76: goto tr166;
@@ -3203,14 +3185,14 @@ case 105:
 tr166:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st106;
 st106:
 	if ( ++p == pe )
 		goto _test_eof106;
 case 106:
-#line 3214 "inc/vcf/validator_detail_v41.hpp"
+#line 3196 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 84: goto tr167;
@@ -3221,14 +3203,14 @@ case 106:
 tr167:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st107;
 st107:
 	if ( ++p == pe )
 		goto _test_eof107;
 case 107:
-#line 3232 "inc/vcf/validator_detail_v41.hpp"
+#line 3214 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 69: goto tr168;
@@ -3239,14 +3221,14 @@ case 107:
 tr168:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st108;
 st108:
 	if ( ++p == pe )
 		goto _test_eof108;
 case 108:
-#line 3250 "inc/vcf/validator_detail_v41.hpp"
+#line 3232 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 82: goto st109;
@@ -3264,7 +3246,7 @@ case 109:
 		goto tr40;
 	goto tr165;
 tr170:
-#line 120 "src/vcf/vcf.ragel"
+#line 114 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "FILTER");
     }
@@ -3273,7 +3255,7 @@ st110:
 	if ( ++p == pe )
 		goto _test_eof110;
 case 110:
-#line 3277 "inc/vcf/validator_detail_v41.hpp"
+#line 3259 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 60 )
 		goto st111;
 	goto tr165;
@@ -3317,20 +3299,20 @@ case 114:
 		goto tr177;
 	goto tr175;
 tr176:
-#line 144 "src/vcf/vcf.ragel"
+#line 138 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st115;
 st115:
 	if ( ++p == pe )
 		goto _test_eof115;
 case 115:
-#line 3334 "inc/vcf/validator_detail_v41.hpp"
+#line 3316 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 95 )
 		goto st115;
 	if ( (*p) < 48 ) {
@@ -3348,28 +3330,28 @@ case 115:
 tr179:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st116;
 tr177:
-#line 144 "src/vcf/vcf.ragel"
+#line 138 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st116;
 st116:
 	if ( ++p == pe )
 		goto _test_eof116;
 case 116:
-#line 3373 "inc/vcf/validator_detail_v41.hpp"
+#line 3355 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 44: goto tr180;
 		case 95: goto tr179;
@@ -3396,7 +3378,7 @@ st117:
 	if ( ++p == pe )
 		goto _test_eof117;
 case 117:
-#line 3400 "inc/vcf/validator_detail_v41.hpp"
+#line 3382 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 68 )
 		goto st118;
 	goto tr165;
@@ -3485,7 +3467,7 @@ case 129:
 		goto tr193;
 	goto tr165;
 tr193:
-#line 156 "src/vcf/vcf.ragel"
+#line 150 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Description");
     }
@@ -3494,7 +3476,7 @@ st130:
 	if ( ++p == pe )
 		goto _test_eof130;
 case 130:
-#line 3498 "inc/vcf/validator_detail_v41.hpp"
+#line 3480 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr196;
 		case 92: goto tr197;
@@ -3505,24 +3487,24 @@ case 130:
 tr195:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st131;
 tr198:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st131;
 st131:
 	if ( ++p == pe )
 		goto _test_eof131;
 case 131:
-#line 3526 "inc/vcf/validator_detail_v41.hpp"
+#line 3508 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr199;
 		case 92: goto tr200;
@@ -3533,7 +3515,7 @@ case 131:
 tr196:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -3550,7 +3532,7 @@ st132:
 	if ( ++p == pe )
 		goto _test_eof132;
 case 132:
-#line 3554 "inc/vcf/validator_detail_v41.hpp"
+#line 3536 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 62 )
 		goto st133;
 	goto tr194;
@@ -3566,24 +3548,24 @@ case 133:
 tr197:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st134;
 tr200:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st134;
 st134:
 	if ( ++p == pe )
 		goto _test_eof134;
 case 134:
-#line 3587 "inc/vcf/validator_detail_v41.hpp"
+#line 3569 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr202;
 		case 92: goto tr200;
@@ -3594,7 +3576,7 @@ case 134:
 tr202:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -3605,7 +3587,7 @@ st135:
 	if ( ++p == pe )
 		goto _test_eof135;
 case 135:
-#line 3609 "inc/vcf/validator_detail_v41.hpp"
+#line 3591 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr199;
 		case 62: goto tr203;
@@ -3617,14 +3599,14 @@ case 135:
 tr203:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st136;
 st136:
 	if ( ++p == pe )
 		goto _test_eof136;
 case 136:
-#line 3628 "inc/vcf/validator_detail_v41.hpp"
+#line 3610 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -3637,14 +3619,14 @@ case 136:
 tr164:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st137;
 st137:
 	if ( ++p == pe )
 		goto _test_eof137;
 case 137:
-#line 3648 "inc/vcf/validator_detail_v41.hpp"
+#line 3630 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 82: goto tr205;
@@ -3655,14 +3637,14 @@ case 137:
 tr205:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st138;
 st138:
 	if ( ++p == pe )
 		goto _test_eof138;
 case 138:
-#line 3666 "inc/vcf/validator_detail_v41.hpp"
+#line 3648 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 77: goto tr206;
@@ -3673,14 +3655,14 @@ case 138:
 tr206:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st139;
 st139:
 	if ( ++p == pe )
 		goto _test_eof139;
 case 139:
-#line 3684 "inc/vcf/validator_detail_v41.hpp"
+#line 3666 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 65: goto tr207;
@@ -3691,14 +3673,14 @@ case 139:
 tr207:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st140;
 st140:
 	if ( ++p == pe )
 		goto _test_eof140;
 case 140:
-#line 3702 "inc/vcf/validator_detail_v41.hpp"
+#line 3684 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 84: goto st141;
@@ -3716,7 +3698,7 @@ case 141:
 		goto tr40;
 	goto tr204;
 tr209:
-#line 124 "src/vcf/vcf.ragel"
+#line 118 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "FORMAT");
     }
@@ -3725,7 +3707,7 @@ st142:
 	if ( ++p == pe )
 		goto _test_eof142;
 case 142:
-#line 3729 "inc/vcf/validator_detail_v41.hpp"
+#line 3711 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 60 )
 		goto st143;
 	goto tr204;
@@ -3769,20 +3751,20 @@ case 146:
 		goto tr216;
 	goto tr214;
 tr215:
-#line 144 "src/vcf/vcf.ragel"
+#line 138 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st147;
 st147:
 	if ( ++p == pe )
 		goto _test_eof147;
 case 147:
-#line 3786 "inc/vcf/validator_detail_v41.hpp"
+#line 3768 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 95 )
 		goto st147;
 	if ( (*p) < 48 ) {
@@ -3800,28 +3782,28 @@ case 147:
 tr218:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st148;
 tr216:
-#line 144 "src/vcf/vcf.ragel"
+#line 138 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st148;
 st148:
 	if ( ++p == pe )
 		goto _test_eof148;
 case 148:
-#line 3825 "inc/vcf/validator_detail_v41.hpp"
+#line 3807 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 44: goto tr219;
 		case 95: goto tr218;
@@ -3848,7 +3830,7 @@ st149:
 	if ( ++p == pe )
 		goto _test_eof149;
 case 149:
-#line 3852 "inc/vcf/validator_detail_v41.hpp"
+#line 3834 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 78 )
 		goto st150;
 	goto tr204;
@@ -3907,24 +3889,24 @@ case 156:
 		goto tr229;
 	goto tr227;
 tr228:
-#line 148 "src/vcf/vcf.ragel"
+#line 142 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Number");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st157;
 st157:
 	if ( ++p == pe )
 		goto _test_eof157;
 case 157:
-#line 3928 "inc/vcf/validator_detail_v41.hpp"
+#line 3910 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 44 )
 		goto tr230;
 	goto tr227;
@@ -3938,7 +3920,7 @@ st158:
 	if ( ++p == pe )
 		goto _test_eof158;
 case 158:
-#line 3942 "inc/vcf/validator_detail_v41.hpp"
+#line 3924 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 84 )
 		goto st159;
 	goto tr204;
@@ -3983,28 +3965,28 @@ case 163:
 tr239:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st164;
 tr237:
-#line 152 "src/vcf/vcf.ragel"
+#line 146 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Type");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st164;
 st164:
 	if ( ++p == pe )
 		goto _test_eof164;
 case 164:
-#line 4008 "inc/vcf/validator_detail_v41.hpp"
+#line 3990 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 44 )
 		goto tr238;
 	if ( (*p) > 90 ) {
@@ -4023,7 +4005,7 @@ st165:
 	if ( ++p == pe )
 		goto _test_eof165;
 case 165:
-#line 4027 "inc/vcf/validator_detail_v41.hpp"
+#line 4009 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 68 )
 		goto st166;
 	goto tr204;
@@ -4112,7 +4094,7 @@ case 177:
 		goto tr252;
 	goto tr204;
 tr252:
-#line 156 "src/vcf/vcf.ragel"
+#line 150 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Description");
     }
@@ -4121,7 +4103,7 @@ st178:
 	if ( ++p == pe )
 		goto _test_eof178;
 case 178:
-#line 4125 "inc/vcf/validator_detail_v41.hpp"
+#line 4107 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr255;
 		case 92: goto tr256;
@@ -4132,24 +4114,24 @@ case 178:
 tr254:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st179;
 tr257:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st179;
 st179:
 	if ( ++p == pe )
 		goto _test_eof179;
 case 179:
-#line 4153 "inc/vcf/validator_detail_v41.hpp"
+#line 4135 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr258;
 		case 92: goto tr259;
@@ -4160,7 +4142,7 @@ case 179:
 tr255:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -4177,7 +4159,7 @@ st180:
 	if ( ++p == pe )
 		goto _test_eof180;
 case 180:
-#line 4181 "inc/vcf/validator_detail_v41.hpp"
+#line 4163 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 62 )
 		goto st181;
 	goto tr253;
@@ -4193,24 +4175,24 @@ case 181:
 tr256:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st182;
 tr259:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st182;
 st182:
 	if ( ++p == pe )
 		goto _test_eof182;
 case 182:
-#line 4214 "inc/vcf/validator_detail_v41.hpp"
+#line 4196 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr261;
 		case 92: goto tr259;
@@ -4221,7 +4203,7 @@ case 182:
 tr261:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -4232,7 +4214,7 @@ st183:
 	if ( ++p == pe )
 		goto _test_eof183;
 case 183:
-#line 4236 "inc/vcf/validator_detail_v41.hpp"
+#line 4218 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr258;
 		case 62: goto tr262;
@@ -4244,14 +4226,14 @@ case 183:
 tr262:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st184;
 st184:
 	if ( ++p == pe )
 		goto _test_eof184;
 case 184:
-#line 4255 "inc/vcf/validator_detail_v41.hpp"
+#line 4237 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -4264,28 +4246,28 @@ case 184:
 tr263:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st185;
 tr229:
-#line 148 "src/vcf/vcf.ragel"
+#line 142 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Number");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st185;
 st185:
 	if ( ++p == pe )
 		goto _test_eof185;
 case 185:
-#line 4289 "inc/vcf/validator_detail_v41.hpp"
+#line 4271 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 44 )
 		goto tr230;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -4294,18 +4276,18 @@ case 185:
 tr33:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st186;
 st186:
 	if ( ++p == pe )
 		goto _test_eof186;
 case 186:
-#line 4309 "inc/vcf/validator_detail_v41.hpp"
+#line 4291 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 78: goto tr265;
@@ -4316,14 +4298,14 @@ case 186:
 tr265:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st187;
 st187:
 	if ( ++p == pe )
 		goto _test_eof187;
 case 187:
-#line 4327 "inc/vcf/validator_detail_v41.hpp"
+#line 4309 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 70: goto tr266;
@@ -4334,14 +4316,14 @@ case 187:
 tr266:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st188;
 st188:
 	if ( ++p == pe )
 		goto _test_eof188;
 case 188:
-#line 4345 "inc/vcf/validator_detail_v41.hpp"
+#line 4327 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 79: goto st189;
@@ -4359,7 +4341,7 @@ case 189:
 		goto tr40;
 	goto tr264;
 tr268:
-#line 128 "src/vcf/vcf.ragel"
+#line 122 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "INFO");
     }
@@ -4368,7 +4350,7 @@ st190:
 	if ( ++p == pe )
 		goto _test_eof190;
 case 190:
-#line 4372 "inc/vcf/validator_detail_v41.hpp"
+#line 4354 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 60 )
 		goto st191;
 	goto tr264;
@@ -4412,20 +4394,20 @@ case 194:
 		goto tr275;
 	goto tr273;
 tr274:
-#line 144 "src/vcf/vcf.ragel"
+#line 138 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st195;
 st195:
 	if ( ++p == pe )
 		goto _test_eof195;
 case 195:
-#line 4429 "inc/vcf/validator_detail_v41.hpp"
+#line 4411 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 95 )
 		goto st195;
 	if ( (*p) < 48 ) {
@@ -4443,28 +4425,28 @@ case 195:
 tr277:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st196;
 tr275:
-#line 144 "src/vcf/vcf.ragel"
+#line 138 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st196;
 st196:
 	if ( ++p == pe )
 		goto _test_eof196;
 case 196:
-#line 4468 "inc/vcf/validator_detail_v41.hpp"
+#line 4450 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 44: goto tr278;
 		case 95: goto tr277;
@@ -4491,7 +4473,7 @@ st197:
 	if ( ++p == pe )
 		goto _test_eof197;
 case 197:
-#line 4495 "inc/vcf/validator_detail_v41.hpp"
+#line 4477 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 78 )
 		goto st198;
 	goto tr264;
@@ -4550,24 +4532,24 @@ case 204:
 		goto tr288;
 	goto tr286;
 tr287:
-#line 148 "src/vcf/vcf.ragel"
+#line 142 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Number");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st205;
 st205:
 	if ( ++p == pe )
 		goto _test_eof205;
 case 205:
-#line 4571 "inc/vcf/validator_detail_v41.hpp"
+#line 4553 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 44 )
 		goto tr289;
 	goto tr286;
@@ -4581,7 +4563,7 @@ st206:
 	if ( ++p == pe )
 		goto _test_eof206;
 case 206:
-#line 4585 "inc/vcf/validator_detail_v41.hpp"
+#line 4567 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 84 )
 		goto st207;
 	goto tr264;
@@ -4626,28 +4608,28 @@ case 211:
 tr298:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st212;
 tr296:
-#line 152 "src/vcf/vcf.ragel"
+#line 146 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Type");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st212;
 st212:
 	if ( ++p == pe )
 		goto _test_eof212;
 case 212:
-#line 4651 "inc/vcf/validator_detail_v41.hpp"
+#line 4633 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 44 )
 		goto tr297;
 	if ( (*p) > 90 ) {
@@ -4666,7 +4648,7 @@ st213:
 	if ( ++p == pe )
 		goto _test_eof213;
 case 213:
-#line 4670 "inc/vcf/validator_detail_v41.hpp"
+#line 4652 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 68 )
 		goto st214;
 	goto tr264;
@@ -4755,7 +4737,7 @@ case 225:
 		goto tr311;
 	goto tr264;
 tr311:
-#line 156 "src/vcf/vcf.ragel"
+#line 150 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Description");
     }
@@ -4764,7 +4746,7 @@ st226:
 	if ( ++p == pe )
 		goto _test_eof226;
 case 226:
-#line 4768 "inc/vcf/validator_detail_v41.hpp"
+#line 4750 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr314;
 		case 92: goto tr315;
@@ -4775,24 +4757,24 @@ case 226:
 tr313:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st227;
 tr316:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st227;
 st227:
 	if ( ++p == pe )
 		goto _test_eof227;
 case 227:
-#line 4796 "inc/vcf/validator_detail_v41.hpp"
+#line 4778 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr317;
 		case 92: goto tr318;
@@ -4803,7 +4785,7 @@ case 227:
 tr314:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -4820,7 +4802,7 @@ st228:
 	if ( ++p == pe )
 		goto _test_eof228;
 case 228:
-#line 4824 "inc/vcf/validator_detail_v41.hpp"
+#line 4806 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 62 )
 		goto st229;
 	goto tr312;
@@ -4836,24 +4818,24 @@ case 229:
 tr315:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st230;
 tr318:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st230;
 st230:
 	if ( ++p == pe )
 		goto _test_eof230;
 case 230:
-#line 4857 "inc/vcf/validator_detail_v41.hpp"
+#line 4839 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr320;
 		case 92: goto tr318;
@@ -4864,7 +4846,7 @@ case 230:
 tr320:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -4875,7 +4857,7 @@ st231:
 	if ( ++p == pe )
 		goto _test_eof231;
 case 231:
-#line 4879 "inc/vcf/validator_detail_v41.hpp"
+#line 4861 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr317;
 		case 62: goto tr321;
@@ -4887,14 +4869,14 @@ case 231:
 tr321:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st232;
 st232:
 	if ( ++p == pe )
 		goto _test_eof232;
 case 232:
-#line 4898 "inc/vcf/validator_detail_v41.hpp"
+#line 4880 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -4907,28 +4889,28 @@ case 232:
 tr322:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st233;
 tr288:
-#line 148 "src/vcf/vcf.ragel"
+#line 142 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Number");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st233;
 st233:
 	if ( ++p == pe )
 		goto _test_eof233;
 case 233:
-#line 4932 "inc/vcf/validator_detail_v41.hpp"
+#line 4914 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 44 )
 		goto tr289;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -4937,18 +4919,18 @@ case 233:
 tr34:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st234;
 st234:
 	if ( ++p == pe )
 		goto _test_eof234;
 case 234:
-#line 4952 "inc/vcf/validator_detail_v41.hpp"
+#line 4934 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 69: goto tr324;
@@ -4959,14 +4941,14 @@ case 234:
 tr324:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st235;
 st235:
 	if ( ++p == pe )
 		goto _test_eof235;
 case 235:
-#line 4970 "inc/vcf/validator_detail_v41.hpp"
+#line 4952 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 68: goto tr325;
@@ -4977,14 +4959,14 @@ case 235:
 tr325:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st236;
 st236:
 	if ( ++p == pe )
 		goto _test_eof236;
 case 236:
-#line 4988 "inc/vcf/validator_detail_v41.hpp"
+#line 4970 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 73: goto tr326;
@@ -4995,14 +4977,14 @@ case 236:
 tr326:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st237;
 st237:
 	if ( ++p == pe )
 		goto _test_eof237;
 case 237:
-#line 5006 "inc/vcf/validator_detail_v41.hpp"
+#line 4988 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 71: goto tr327;
@@ -5013,14 +4995,14 @@ case 237:
 tr327:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st238;
 st238:
 	if ( ++p == pe )
 		goto _test_eof238;
 case 238:
-#line 5024 "inc/vcf/validator_detail_v41.hpp"
+#line 5006 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 82: goto tr328;
@@ -5031,14 +5013,14 @@ case 238:
 tr328:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st239;
 st239:
 	if ( ++p == pe )
 		goto _test_eof239;
 case 239:
-#line 5042 "inc/vcf/validator_detail_v41.hpp"
+#line 5024 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 69: goto tr329;
@@ -5049,14 +5031,14 @@ case 239:
 tr329:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st240;
 st240:
 	if ( ++p == pe )
 		goto _test_eof240;
 case 240:
-#line 5060 "inc/vcf/validator_detail_v41.hpp"
+#line 5042 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 69: goto st241;
@@ -5074,7 +5056,7 @@ case 241:
 		goto tr40;
 	goto tr323;
 tr331:
-#line 132 "src/vcf/vcf.ragel"
+#line 126 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "PEDIGREE");
     }
@@ -5083,7 +5065,7 @@ st242:
 	if ( ++p == pe )
 		goto _test_eof242;
 case 242:
-#line 5087 "inc/vcf/validator_detail_v41.hpp"
+#line 5069 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 60 )
 		goto st243;
 	goto tr323;
@@ -5097,7 +5079,7 @@ st243:
 	if ( ++p == pe )
 		goto _test_eof243;
 case 243:
-#line 5101 "inc/vcf/validator_detail_v41.hpp"
+#line 5083 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 95 )
 		goto tr334;
 	if ( (*p) < 48 ) {
@@ -5115,14 +5097,14 @@ case 243:
 tr334:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st244;
 st244:
 	if ( ++p == pe )
 		goto _test_eof244;
 case 244:
-#line 5126 "inc/vcf/validator_detail_v41.hpp"
+#line 5108 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 95 )
 		goto st244;
 	if ( (*p) < 48 ) {
@@ -5140,24 +5122,24 @@ case 244:
 tr335:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st245;
 tr337:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st245;
 st245:
 	if ( ++p == pe )
 		goto _test_eof245;
 case 245:
-#line 5161 "inc/vcf/validator_detail_v41.hpp"
+#line 5143 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr338;
 		case 95: goto tr337;
@@ -5184,7 +5166,7 @@ st246:
 	if ( ++p == pe )
 		goto _test_eof246;
 case 246:
-#line 5188 "inc/vcf/validator_detail_v41.hpp"
+#line 5170 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 95 )
 		goto tr339;
 	if ( (*p) < 48 ) {
@@ -5202,14 +5184,14 @@ case 246:
 tr339:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st247;
 st247:
 	if ( ++p == pe )
 		goto _test_eof247;
 case 247:
-#line 5213 "inc/vcf/validator_detail_v41.hpp"
+#line 5195 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 95 )
 		goto st247;
 	if ( (*p) < 48 ) {
@@ -5227,24 +5209,24 @@ case 247:
 tr340:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st248;
 tr342:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st248;
 st248:
 	if ( ++p == pe )
 		goto _test_eof248;
 case 248:
-#line 5248 "inc/vcf/validator_detail_v41.hpp"
+#line 5230 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 44: goto tr343;
 		case 62: goto tr344;
@@ -5272,7 +5254,7 @@ st249:
 	if ( ++p == pe )
 		goto _test_eof249;
 case 249:
-#line 5276 "inc/vcf/validator_detail_v41.hpp"
+#line 5258 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -5281,18 +5263,18 @@ case 249:
 tr35:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st250;
 st250:
 	if ( ++p == pe )
 		goto _test_eof250;
 case 250:
-#line 5296 "inc/vcf/validator_detail_v41.hpp"
+#line 5278 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 65: goto tr346;
@@ -5303,14 +5285,14 @@ case 250:
 tr346:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st251;
 st251:
 	if ( ++p == pe )
 		goto _test_eof251;
 case 251:
-#line 5314 "inc/vcf/validator_detail_v41.hpp"
+#line 5296 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 77: goto tr347;
@@ -5321,14 +5303,14 @@ case 251:
 tr347:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st252;
 st252:
 	if ( ++p == pe )
 		goto _test_eof252;
 case 252:
-#line 5332 "inc/vcf/validator_detail_v41.hpp"
+#line 5314 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 80: goto tr348;
@@ -5339,14 +5321,14 @@ case 252:
 tr348:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st253;
 st253:
 	if ( ++p == pe )
 		goto _test_eof253;
 case 253:
-#line 5350 "inc/vcf/validator_detail_v41.hpp"
+#line 5332 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 76: goto tr349;
@@ -5357,14 +5339,14 @@ case 253:
 tr349:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st254;
 st254:
 	if ( ++p == pe )
 		goto _test_eof254;
 case 254:
-#line 5368 "inc/vcf/validator_detail_v41.hpp"
+#line 5350 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 69: goto st255;
@@ -5382,7 +5364,7 @@ case 255:
 		goto tr40;
 	goto tr345;
 tr351:
-#line 140 "src/vcf/vcf.ragel"
+#line 134 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "SAMPLE");
     }
@@ -5391,7 +5373,7 @@ st256:
 	if ( ++p == pe )
 		goto _test_eof256;
 case 256:
-#line 5395 "inc/vcf/validator_detail_v41.hpp"
+#line 5377 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 60 )
 		goto st257;
 	goto tr345;
@@ -5435,20 +5417,20 @@ case 260:
 		goto tr358;
 	goto tr356;
 tr357:
-#line 144 "src/vcf/vcf.ragel"
+#line 138 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st261;
 st261:
 	if ( ++p == pe )
 		goto _test_eof261;
 case 261:
-#line 5452 "inc/vcf/validator_detail_v41.hpp"
+#line 5434 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 95 )
 		goto st261;
 	if ( (*p) < 48 ) {
@@ -5466,28 +5448,28 @@ case 261:
 tr360:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st262;
 tr358:
-#line 144 "src/vcf/vcf.ragel"
+#line 138 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st262;
 st262:
 	if ( ++p == pe )
 		goto _test_eof262;
 case 262:
-#line 5491 "inc/vcf/validator_detail_v41.hpp"
+#line 5473 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 44: goto tr362;
 		case 95: goto tr360;
@@ -5514,7 +5496,7 @@ st263:
 	if ( ++p == pe )
 		goto _test_eof263;
 case 263:
-#line 5518 "inc/vcf/validator_detail_v41.hpp"
+#line 5500 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 71 )
 		goto st264;
 	goto tr363;
@@ -5586,28 +5568,28 @@ case 271:
 tr374:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st272;
 tr372:
-#line 160 "src/vcf/vcf.ragel"
+#line 154 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Genomes");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st272;
 st272:
 	if ( ++p == pe )
 		goto _test_eof272;
 case 272:
-#line 5611 "inc/vcf/validator_detail_v41.hpp"
+#line 5593 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 44 )
 		goto tr375;
 	if ( (*p) < 35 ) {
@@ -5629,7 +5611,7 @@ st273:
 	if ( ++p == pe )
 		goto _test_eof273;
 case 273:
-#line 5633 "inc/vcf/validator_detail_v41.hpp"
+#line 5615 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 77 )
 		goto st274;
 	goto tr376;
@@ -5701,28 +5683,28 @@ case 281:
 tr387:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st282;
 tr385:
-#line 164 "src/vcf/vcf.ragel"
+#line 158 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Mixture");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st282;
 st282:
 	if ( ++p == pe )
 		goto _test_eof282;
 case 282:
-#line 5726 "inc/vcf/validator_detail_v41.hpp"
+#line 5708 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 44 )
 		goto tr388;
 	if ( (*p) < 35 ) {
@@ -5744,7 +5726,7 @@ st283:
 	if ( ++p == pe )
 		goto _test_eof283;
 case 283:
-#line 5748 "inc/vcf/validator_detail_v41.hpp"
+#line 5730 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 68 )
 		goto st284;
 	goto tr389;
@@ -5833,7 +5815,7 @@ case 295:
 		goto tr402;
 	goto tr389;
 tr402:
-#line 156 "src/vcf/vcf.ragel"
+#line 150 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Description");
     }
@@ -5842,7 +5824,7 @@ st296:
 	if ( ++p == pe )
 		goto _test_eof296;
 case 296:
-#line 5846 "inc/vcf/validator_detail_v41.hpp"
+#line 5828 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr404;
 		case 92: goto tr405;
@@ -5853,24 +5835,24 @@ case 296:
 tr403:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st297;
 tr406:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st297;
 st297:
 	if ( ++p == pe )
 		goto _test_eof297;
 case 297:
-#line 5874 "inc/vcf/validator_detail_v41.hpp"
+#line 5856 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr407;
 		case 92: goto tr408;
@@ -5881,7 +5863,7 @@ case 297:
 tr404:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -5898,7 +5880,7 @@ st298:
 	if ( ++p == pe )
 		goto _test_eof298;
 case 298:
-#line 5902 "inc/vcf/validator_detail_v41.hpp"
+#line 5884 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 62 )
 		goto st299;
 	goto tr389;
@@ -5914,24 +5896,24 @@ case 299:
 tr405:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st300;
 tr408:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st300;
 st300:
 	if ( ++p == pe )
 		goto _test_eof300;
 case 300:
-#line 5935 "inc/vcf/validator_detail_v41.hpp"
+#line 5917 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr410;
 		case 92: goto tr408;
@@ -5942,7 +5924,7 @@ case 300:
 tr410:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -5953,7 +5935,7 @@ st301:
 	if ( ++p == pe )
 		goto _test_eof301;
 case 301:
-#line 5957 "inc/vcf/validator_detail_v41.hpp"
+#line 5939 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr407;
 		case 62: goto tr411;
@@ -5965,14 +5947,14 @@ case 301:
 tr411:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st302;
 st302:
 	if ( ++p == pe )
 		goto _test_eof302;
 case 302:
-#line 5976 "inc/vcf/validator_detail_v41.hpp"
+#line 5958 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -5985,18 +5967,18 @@ case 302:
 tr36:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st303;
 st303:
 	if ( ++p == pe )
 		goto _test_eof303;
 case 303:
-#line 6000 "inc/vcf/validator_detail_v41.hpp"
+#line 5982 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 115: goto tr413;
@@ -6007,14 +5989,14 @@ case 303:
 tr413:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st304;
 st304:
 	if ( ++p == pe )
 		goto _test_eof304;
 case 304:
-#line 6018 "inc/vcf/validator_detail_v41.hpp"
+#line 6000 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 115: goto tr414;
@@ -6025,14 +6007,14 @@ case 304:
 tr414:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st305;
 st305:
 	if ( ++p == pe )
 		goto _test_eof305;
 case 305:
-#line 6036 "inc/vcf/validator_detail_v41.hpp"
+#line 6018 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 101: goto tr415;
@@ -6043,14 +6025,14 @@ case 305:
 tr415:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st306;
 st306:
 	if ( ++p == pe )
 		goto _test_eof306;
 case 306:
-#line 6054 "inc/vcf/validator_detail_v41.hpp"
+#line 6036 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 109: goto tr416;
@@ -6061,14 +6043,14 @@ case 306:
 tr416:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st307;
 st307:
 	if ( ++p == pe )
 		goto _test_eof307;
 case 307:
-#line 6072 "inc/vcf/validator_detail_v41.hpp"
+#line 6054 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 98: goto tr417;
@@ -6079,14 +6061,14 @@ case 307:
 tr417:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st308;
 st308:
 	if ( ++p == pe )
 		goto _test_eof308;
 case 308:
-#line 6090 "inc/vcf/validator_detail_v41.hpp"
+#line 6072 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 108: goto tr418;
@@ -6097,14 +6079,14 @@ case 308:
 tr418:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st309;
 st309:
 	if ( ++p == pe )
 		goto _test_eof309;
 case 309:
-#line 6108 "inc/vcf/validator_detail_v41.hpp"
+#line 6090 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 121: goto st310;
@@ -6122,7 +6104,7 @@ case 310:
 		goto tr40;
 	goto tr412;
 tr420:
-#line 112 "src/vcf/vcf.ragel"
+#line 106 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "assembly");
     }
@@ -6131,7 +6113,7 @@ st311:
 	if ( ++p == pe )
 		goto _test_eof311;
 case 311:
-#line 6135 "inc/vcf/validator_detail_v41.hpp"
+#line 6117 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) > 90 ) {
 		if ( 97 <= (*p) && (*p) <= 122 )
 			goto tr422;
@@ -6141,14 +6123,14 @@ case 311:
 tr422:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st312;
 st312:
 	if ( ++p == pe )
 		goto _test_eof312;
 case 312:
-#line 6152 "inc/vcf/validator_detail_v41.hpp"
+#line 6134 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 10: goto tr421;
 		case 13: goto tr424;
@@ -6161,20 +6143,16 @@ case 312:
 tr424:
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st313;
 st313:
 	if ( ++p == pe )
 		goto _test_eof313;
 case 313:
-#line 6178 "inc/vcf/validator_detail_v41.hpp"
+#line 6156 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 10: goto tr421;
 		case 13: goto tr424;
@@ -6262,29 +6240,25 @@ case 322:
 tr429:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st323;
 tr438:
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 196 "src/vcf/vcf.ragel"
+#line 190 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_meta_line(*this);
@@ -6297,7 +6271,7 @@ st323:
 	if ( ++p == pe )
 		goto _test_eof323;
 case 323:
-#line 6301 "inc/vcf/validator_detail_v41.hpp"
+#line 6275 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 10: goto tr45;
 		case 13: goto tr438;
@@ -6354,18 +6328,18 @@ case 329:
 tr37:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st330;
 st330:
 	if ( ++p == pe )
 		goto _test_eof330;
 case 330:
-#line 6369 "inc/vcf/validator_detail_v41.hpp"
+#line 6343 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 111: goto tr443;
@@ -6376,14 +6350,14 @@ case 330:
 tr443:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st331;
 st331:
 	if ( ++p == pe )
 		goto _test_eof331;
 case 331:
-#line 6387 "inc/vcf/validator_detail_v41.hpp"
+#line 6361 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 110: goto tr444;
@@ -6394,14 +6368,14 @@ case 331:
 tr444:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st332;
 st332:
 	if ( ++p == pe )
 		goto _test_eof332;
 case 332:
-#line 6405 "inc/vcf/validator_detail_v41.hpp"
+#line 6379 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 116: goto tr445;
@@ -6412,14 +6386,14 @@ case 332:
 tr445:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st333;
 st333:
 	if ( ++p == pe )
 		goto _test_eof333;
 case 333:
-#line 6423 "inc/vcf/validator_detail_v41.hpp"
+#line 6397 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 105: goto tr446;
@@ -6430,14 +6404,14 @@ case 333:
 tr446:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st334;
 st334:
 	if ( ++p == pe )
 		goto _test_eof334;
 case 334:
-#line 6441 "inc/vcf/validator_detail_v41.hpp"
+#line 6415 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 103: goto st335;
@@ -6455,7 +6429,7 @@ case 335:
 		goto tr40;
 	goto tr442;
 tr448:
-#line 116 "src/vcf/vcf.ragel"
+#line 110 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "contig");
     }
@@ -6464,7 +6438,7 @@ st336:
 	if ( ++p == pe )
 		goto _test_eof336;
 case 336:
-#line 6468 "inc/vcf/validator_detail_v41.hpp"
+#line 6442 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 60 )
 		goto st337;
 	goto tr442;
@@ -6505,28 +6479,28 @@ case 340:
 tr455:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st341;
 tr454:
-#line 144 "src/vcf/vcf.ragel"
+#line 138 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st341;
 st341:
 	if ( ++p == pe )
 		goto _test_eof341;
 case 341:
-#line 6530 "inc/vcf/validator_detail_v41.hpp"
+#line 6504 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 44: goto tr456;
 		case 59: goto tr455;
@@ -6548,7 +6522,7 @@ st342:
 	if ( ++p == pe )
 		goto _test_eof342;
 case 342:
-#line 6552 "inc/vcf/validator_detail_v41.hpp"
+#line 6526 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 95 )
 		goto tr458;
 	if ( (*p) < 48 ) {
@@ -6566,14 +6540,14 @@ case 342:
 tr458:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st343;
 st343:
 	if ( ++p == pe )
 		goto _test_eof343;
 case 343:
-#line 6577 "inc/vcf/validator_detail_v41.hpp"
+#line 6551 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 95 )
 		goto st343;
 	if ( (*p) < 48 ) {
@@ -6591,24 +6565,24 @@ case 343:
 tr459:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st344;
 tr461:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st344;
 st344:
 	if ( ++p == pe )
 		goto _test_eof344;
 case 344:
-#line 6612 "inc/vcf/validator_detail_v41.hpp"
+#line 6586 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr462;
 		case 95: goto tr461;
@@ -6635,7 +6609,7 @@ st345:
 	if ( ++p == pe )
 		goto _test_eof345;
 case 345:
-#line 6639 "inc/vcf/validator_detail_v41.hpp"
+#line 6613 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 34 )
 		goto st348;
 	if ( (*p) < 45 ) {
@@ -6650,24 +6624,24 @@ case 345:
 tr463:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st346;
 tr465:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st346;
 st346:
 	if ( ++p == pe )
 		goto _test_eof346;
 case 346:
-#line 6671 "inc/vcf/validator_detail_v41.hpp"
+#line 6645 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 44: goto tr456;
 		case 62: goto tr457;
@@ -6688,7 +6662,7 @@ st347:
 	if ( ++p == pe )
 		goto _test_eof347;
 case 347:
-#line 6692 "inc/vcf/validator_detail_v41.hpp"
+#line 6666 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -6708,24 +6682,24 @@ case 348:
 tr466:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st349;
 tr469:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st349;
 st349:
 	if ( ++p == pe )
 		goto _test_eof349;
 case 349:
-#line 6729 "inc/vcf/validator_detail_v41.hpp"
+#line 6703 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr470;
 		case 92: goto tr471;
@@ -6736,7 +6710,7 @@ case 349:
 tr467:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -6753,7 +6727,7 @@ st350:
 	if ( ++p == pe )
 		goto _test_eof350;
 case 350:
-#line 6757 "inc/vcf/validator_detail_v41.hpp"
+#line 6731 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 44: goto st342;
 		case 62: goto st347;
@@ -6762,24 +6736,24 @@ case 350:
 tr468:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st351;
 tr471:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st351;
 st351:
 	if ( ++p == pe )
 		goto _test_eof351;
 case 351:
-#line 6783 "inc/vcf/validator_detail_v41.hpp"
+#line 6757 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr474;
 		case 92: goto tr471;
@@ -6790,7 +6764,7 @@ case 351:
 tr474:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -6801,7 +6775,7 @@ st352:
 	if ( ++p == pe )
 		goto _test_eof352;
 case 352:
-#line 6805 "inc/vcf/validator_detail_v41.hpp"
+#line 6779 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr470;
 		case 44: goto tr475;
@@ -6814,23 +6788,23 @@ case 352:
 tr489:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st353;
 tr475:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st353;
 tr486:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -6841,7 +6815,7 @@ st353:
 	if ( ++p == pe )
 		goto _test_eof353;
 case 353:
-#line 6845 "inc/vcf/validator_detail_v41.hpp"
+#line 6819 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr470;
 		case 47: goto tr469;
@@ -6875,24 +6849,24 @@ case 353:
 tr477:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st354;
 tr479:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st354;
 st354:
 	if ( ++p == pe )
 		goto _test_eof354;
 case 354:
-#line 6896 "inc/vcf/validator_detail_v41.hpp"
+#line 6870 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr470;
 		case 47: goto tr469;
@@ -6926,24 +6900,24 @@ case 354:
 tr478:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st355;
 tr480:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st355;
 st355:
 	if ( ++p == pe )
 		goto _test_eof355;
 case 355:
-#line 6947 "inc/vcf/validator_detail_v41.hpp"
+#line 6921 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr470;
 		case 47: goto tr469;
@@ -6979,14 +6953,14 @@ tr481:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st356;
 st356:
 	if ( ++p == pe )
 		goto _test_eof356;
 case 356:
-#line 6990 "inc/vcf/validator_detail_v41.hpp"
+#line 6964 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr483;
 		case 44: goto tr469;
@@ -6999,24 +6973,24 @@ case 356:
 tr485:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st357;
 tr482:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st357;
 st357:
 	if ( ++p == pe )
 		goto _test_eof357;
 case 357:
-#line 7020 "inc/vcf/validator_detail_v41.hpp"
+#line 6994 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr470;
 		case 44: goto tr486;
@@ -7029,23 +7003,23 @@ case 357:
 tr490:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st358;
 tr476:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st358;
 tr487:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -7056,7 +7030,7 @@ st358:
 	if ( ++p == pe )
 		goto _test_eof358;
 case 358:
-#line 7060 "inc/vcf/validator_detail_v41.hpp"
+#line 7034 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -7069,24 +7043,24 @@ case 358:
 tr488:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st359;
 tr484:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st359;
 st359:
 	if ( ++p == pe )
 		goto _test_eof359;
 case 359:
-#line 7090 "inc/vcf/validator_detail_v41.hpp"
+#line 7064 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr474;
 		case 44: goto tr486;
@@ -7106,7 +7080,7 @@ st360:
 	if ( ++p == pe )
 		goto _test_eof360;
 case 360:
-#line 7110 "inc/vcf/validator_detail_v41.hpp"
+#line 7084 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 34: goto tr467;
 		case 44: goto tr489;
@@ -7119,18 +7093,18 @@ case 360:
 tr38:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st361;
 st361:
 	if ( ++p == pe )
 		goto _test_eof361;
 case 361:
-#line 7134 "inc/vcf/validator_detail_v41.hpp"
+#line 7108 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 101: goto tr492;
@@ -7141,14 +7115,14 @@ case 361:
 tr492:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st362;
 st362:
 	if ( ++p == pe )
 		goto _test_eof362;
 case 362:
-#line 7152 "inc/vcf/validator_detail_v41.hpp"
+#line 7126 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 100: goto tr493;
@@ -7159,14 +7133,14 @@ case 362:
 tr493:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st363;
 st363:
 	if ( ++p == pe )
 		goto _test_eof363;
 case 363:
-#line 7170 "inc/vcf/validator_detail_v41.hpp"
+#line 7144 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 105: goto tr494;
@@ -7177,14 +7151,14 @@ case 363:
 tr494:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st364;
 st364:
 	if ( ++p == pe )
 		goto _test_eof364;
 case 364:
-#line 7188 "inc/vcf/validator_detail_v41.hpp"
+#line 7162 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 103: goto tr495;
@@ -7195,14 +7169,14 @@ case 364:
 tr495:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st365;
 st365:
 	if ( ++p == pe )
 		goto _test_eof365;
 case 365:
-#line 7206 "inc/vcf/validator_detail_v41.hpp"
+#line 7180 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 114: goto tr496;
@@ -7213,14 +7187,14 @@ case 365:
 tr496:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st366;
 st366:
 	if ( ++p == pe )
 		goto _test_eof366;
 case 366:
-#line 7224 "inc/vcf/validator_detail_v41.hpp"
+#line 7198 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 101: goto tr497;
@@ -7231,14 +7205,14 @@ case 366:
 tr497:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st367;
 st367:
 	if ( ++p == pe )
 		goto _test_eof367;
 case 367:
-#line 7242 "inc/vcf/validator_detail_v41.hpp"
+#line 7216 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 101: goto tr498;
@@ -7249,14 +7223,14 @@ case 367:
 tr498:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st368;
 st368:
 	if ( ++p == pe )
 		goto _test_eof368;
 case 368:
-#line 7260 "inc/vcf/validator_detail_v41.hpp"
+#line 7234 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 68: goto tr499;
@@ -7267,14 +7241,14 @@ case 368:
 tr499:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st369;
 st369:
 	if ( ++p == pe )
 		goto _test_eof369;
 case 369:
-#line 7278 "inc/vcf/validator_detail_v41.hpp"
+#line 7252 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 66: goto st370;
@@ -7292,7 +7266,7 @@ case 370:
 		goto tr40;
 	goto tr491;
 tr501:
-#line 136 "src/vcf/vcf.ragel"
+#line 130 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "pedigreeDB");
     }
@@ -7301,7 +7275,7 @@ st371:
 	if ( ++p == pe )
 		goto _test_eof371;
 case 371:
-#line 7305 "inc/vcf/validator_detail_v41.hpp"
+#line 7279 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 60 )
 		goto st372;
 	goto tr491;
@@ -7318,14 +7292,14 @@ case 372:
 tr504:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st373;
 st373:
 	if ( ++p == pe )
 		goto _test_eof373;
 case 373:
-#line 7329 "inc/vcf/validator_detail_v41.hpp"
+#line 7303 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 10: goto tr503;
 		case 13: goto tr506;
@@ -7338,20 +7312,16 @@ case 373:
 tr506:
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st374;
 st374:
 	if ( ++p == pe )
 		goto _test_eof374;
 case 374:
-#line 7355 "inc/vcf/validator_detail_v41.hpp"
+#line 7325 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 10: goto tr503;
 		case 13: goto tr506;
@@ -7439,30 +7409,26 @@ case 383:
 tr511:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st384;
 tr520:
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st384;
 st384:
 	if ( ++p == pe )
 		goto _test_eof384;
 case 384:
-#line 7466 "inc/vcf/validator_detail_v41.hpp"
+#line 7432 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 10: goto tr503;
 		case 13: goto tr520;
@@ -7472,7 +7438,7 @@ case 384:
 tr521:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -7483,7 +7449,7 @@ st385:
 	if ( ++p == pe )
 		goto _test_eof385;
 case 385:
-#line 7487 "inc/vcf/validator_detail_v41.hpp"
+#line 7453 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr522;
@@ -7493,19 +7459,15 @@ case 385:
 tr522:
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
-#line 196 "src/vcf/vcf.ragel"
+#line 190 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_meta_line(*this);
@@ -7518,7 +7480,7 @@ st386:
 	if ( ++p == pe )
 		goto _test_eof386;
 case 386:
-#line 7522 "inc/vcf/validator_detail_v41.hpp"
+#line 7484 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 10: goto st28;
 		case 13: goto tr520;
@@ -7609,7 +7571,7 @@ case 397:
 		goto tr531;
 	goto tr526;
 tr531:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -7618,7 +7580,7 @@ st398:
 	if ( ++p == pe )
 		goto _test_eof398;
 case 398:
-#line 7622 "inc/vcf/validator_detail_v41.hpp"
+#line 7584 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 80 )
 		goto st399;
 	goto tr526;
@@ -7644,7 +7606,7 @@ case 401:
 		goto tr535;
 	goto tr526;
 tr535:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -7653,7 +7615,7 @@ st402:
 	if ( ++p == pe )
 		goto _test_eof402;
 case 402:
-#line 7657 "inc/vcf/validator_detail_v41.hpp"
+#line 7619 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 73 )
 		goto st403;
 	goto tr526;
@@ -7672,7 +7634,7 @@ case 404:
 		goto tr538;
 	goto tr526;
 tr538:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -7681,7 +7643,7 @@ st405:
 	if ( ++p == pe )
 		goto _test_eof405;
 case 405:
-#line 7685 "inc/vcf/validator_detail_v41.hpp"
+#line 7647 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 82 )
 		goto st406;
 	goto tr526;
@@ -7707,7 +7669,7 @@ case 408:
 		goto tr542;
 	goto tr526;
 tr542:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -7716,7 +7678,7 @@ st409:
 	if ( ++p == pe )
 		goto _test_eof409;
 case 409:
-#line 7720 "inc/vcf/validator_detail_v41.hpp"
+#line 7682 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 65 )
 		goto st410;
 	goto tr526;
@@ -7742,7 +7704,7 @@ case 412:
 		goto tr546;
 	goto tr526;
 tr546:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -7751,7 +7713,7 @@ st413:
 	if ( ++p == pe )
 		goto _test_eof413;
 case 413:
-#line 7755 "inc/vcf/validator_detail_v41.hpp"
+#line 7717 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 81 )
 		goto st414;
 	goto tr526;
@@ -7784,7 +7746,7 @@ case 417:
 		goto tr551;
 	goto tr526;
 tr551:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -7793,7 +7755,7 @@ st418:
 	if ( ++p == pe )
 		goto _test_eof418;
 case 418:
-#line 7797 "inc/vcf/validator_detail_v41.hpp"
+#line 7759 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 70 )
 		goto st419;
 	goto tr526;
@@ -7840,7 +7802,7 @@ case 424:
 		goto tr558;
 	goto tr526;
 tr558:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -7849,7 +7811,7 @@ st425:
 	if ( ++p == pe )
 		goto _test_eof425;
 case 425:
-#line 7853 "inc/vcf/validator_detail_v41.hpp"
+#line 7815 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 73 )
 		goto st426;
 	goto tr526;
@@ -7885,7 +7847,7 @@ case 429:
 	}
 	goto tr526;
 tr563:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -7894,7 +7856,7 @@ st430:
 	if ( ++p == pe )
 		goto _test_eof430;
 case 430:
-#line 7898 "inc/vcf/validator_detail_v41.hpp"
+#line 7860 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 70 )
 		goto st431;
 	goto tr566;
@@ -7941,17 +7903,17 @@ case 436:
 		goto tr573;
 	goto tr566;
 tr573:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
 	goto st437;
 tr575:
-#line 204 "src/vcf/vcf.ragel"
+#line 198 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_sample_name(*this);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -7960,31 +7922,31 @@ st437:
 	if ( ++p == pe )
 		goto _test_eof437;
 case 437:
-#line 7964 "inc/vcf/validator_detail_v41.hpp"
+#line 7926 "src/vcf/validator_detail_v41.cpp"
 	if ( 32 <= (*p) && (*p) <= 126 )
 		goto tr574;
 	goto tr566;
 tr574:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st438;
 tr578:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st438;
 st438:
 	if ( ++p == pe )
 		goto _test_eof438;
 case 438:
-#line 7988 "inc/vcf/validator_detail_v41.hpp"
+#line 7950 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 9: goto tr575;
 		case 10: goto tr576;
@@ -7994,46 +7956,38 @@ case 438:
 		goto tr578;
 	goto tr566;
 tr564:
-#line 208 "src/vcf/vcf.ragel"
+#line 202 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_header_line(*this);
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st521;
 tr576:
-#line 204 "src/vcf/vcf.ragel"
+#line 198 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_sample_name(*this);
     }
-#line 208 "src/vcf/vcf.ragel"
+#line 202 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_header_line(*this);
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st521;
 st521:
 	if ( ++p == pe )
 		goto _test_eof521;
 case 521:
-#line 8037 "inc/vcf/validator_detail_v41.hpp"
+#line 7991 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 10: goto tr700;
 		case 13: goto tr701;
@@ -8051,40 +8005,31 @@ case 521:
 tr704:
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st522;
 tr700:
-#line 70 "src/vcf/vcf.ragel"
+#line 66 "src/vcf/vcf.ragel"
 	{
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st522;
 st522:
 	if ( ++p == pe )
 		goto _test_eof522;
 case 522:
-#line 8088 "inc/vcf/validator_detail_v41.hpp"
+#line 8033 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 10: goto tr704;
 		case 13: goto tr705;
@@ -8093,82 +8038,72 @@ case 522:
 tr705:
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st439;
 tr701:
-#line 70 "src/vcf/vcf.ragel"
+#line 66 "src/vcf/vcf.ragel"
 	{
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st439;
 st439:
 	if ( ++p == pe )
 		goto _test_eof439;
 case 439:
-#line 8130 "inc/vcf/validator_detail_v41.hpp"
+#line 8066 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 10 )
 		goto st522;
 	goto st0;
 tr711:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st440;
 tr583:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st440;
 tr702:
-#line 70 "src/vcf/vcf.ragel"
+#line 66 "src/vcf/vcf.ragel"
 	{
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st440;
 st440:
 	if ( ++p == pe )
 		goto _test_eof440;
 case 440:
-#line 8172 "inc/vcf/validator_detail_v41.hpp"
+#line 8107 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 9: goto tr582;
 		case 59: goto tr583;
@@ -8188,21 +8123,21 @@ tr582:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 208 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
 	goto st441;
 tr641:
-#line 214 "src/vcf/vcf.ragel"
+#line 208 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -8211,31 +8146,31 @@ st441:
 	if ( ++p == pe )
 		goto _test_eof441;
 case 441:
-#line 8215 "inc/vcf/validator_detail_v41.hpp"
+#line 8150 "src/vcf/validator_detail_v41.cpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr585;
 	goto tr584;
 tr585:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st442;
 tr587:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st442;
 st442:
 	if ( ++p == pe )
 		goto _test_eof442;
 case 442:
-#line 8239 "inc/vcf/validator_detail_v41.hpp"
+#line 8174 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 9 )
 		goto tr586;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -8252,11 +8187,11 @@ tr586:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 208 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -8265,7 +8200,7 @@ st443:
 	if ( ++p == pe )
 		goto _test_eof443;
 case 443:
-#line 8269 "inc/vcf/validator_detail_v41.hpp"
+#line 8204 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) > 58 ) {
 		if ( 60 <= (*p) && (*p) <= 126 )
 			goto tr589;
@@ -8275,24 +8210,24 @@ case 443:
 tr589:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st444;
 tr591:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st444;
 st444:
 	if ( ++p == pe )
 		goto _test_eof444;
 case 444:
-#line 8296 "inc/vcf/validator_detail_v41.hpp"
+#line 8231 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 9: goto tr590;
 		case 59: goto tr592;
@@ -8305,11 +8240,11 @@ tr590:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 208 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -8318,7 +8253,7 @@ st445:
 	if ( ++p == pe )
 		goto _test_eof445;
 case 445:
-#line 8322 "inc/vcf/validator_detail_v41.hpp"
+#line 8257 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 65: goto tr594;
 		case 67: goto tr594;
@@ -8335,24 +8270,24 @@ case 445:
 tr594:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st446;
 tr596:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st446;
 st446:
 	if ( ++p == pe )
 		goto _test_eof446;
 case 446:
-#line 8356 "inc/vcf/validator_detail_v41.hpp"
+#line 8291 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 9: goto tr595;
 		case 65: goto tr596;
@@ -8372,11 +8307,11 @@ tr595:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 208 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -8385,7 +8320,7 @@ st447:
 	if ( ++p == pe )
 		goto _test_eof447;
 case 447:
-#line 8389 "inc/vcf/validator_detail_v41.hpp"
+#line 8324 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 42: goto tr598;
 		case 46: goto tr599;
@@ -8407,24 +8342,24 @@ case 447:
 tr598:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st448;
 tr662:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st448;
 st448:
 	if ( ++p == pe )
 		goto _test_eof448;
 case 448:
-#line 8428 "inc/vcf/validator_detail_v41.hpp"
+#line 8363 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 9: goto tr604;
 		case 44: goto tr605;
@@ -8435,11 +8370,11 @@ tr604:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 208 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -8448,7 +8383,7 @@ st449:
 	if ( ++p == pe )
 		goto _test_eof449;
 case 449:
-#line 8452 "inc/vcf/validator_detail_v41.hpp"
+#line 8387 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 43: goto tr607;
 		case 45: goto tr607;
@@ -8462,18 +8397,18 @@ case 449:
 tr607:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st450;
 st450:
 	if ( ++p == pe )
 		goto _test_eof450;
 case 450:
-#line 8477 "inc/vcf/validator_detail_v41.hpp"
+#line 8412 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 73 )
 		goto tr613;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -8482,24 +8417,24 @@ case 450:
 tr609:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st451;
 tr612:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st451;
 st451:
 	if ( ++p == pe )
 		goto _test_eof451;
 case 451:
-#line 8503 "inc/vcf/validator_detail_v41.hpp"
+#line 8438 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 9: goto tr614;
 		case 46: goto tr615;
@@ -8514,11 +8449,11 @@ tr614:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 208 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -8527,7 +8462,7 @@ st452:
 	if ( ++p == pe )
 		goto _test_eof452;
 case 452:
-#line 8531 "inc/vcf/validator_detail_v41.hpp"
+#line 8466 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 46: goto tr619;
 		case 58: goto tr618;
@@ -8556,14 +8491,14 @@ case 452:
 tr618:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st453;
 st453:
 	if ( ++p == pe )
 		goto _test_eof453;
 case 453:
-#line 8567 "inc/vcf/validator_detail_v41.hpp"
+#line 8502 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 58 )
 		goto st453;
 	if ( (*p) < 65 ) {
@@ -8590,24 +8525,24 @@ case 453:
 tr620:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st454;
 tr622:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st454;
 st454:
 	if ( ++p == pe )
 		goto _test_eof454;
 case 454:
-#line 8611 "inc/vcf/validator_detail_v41.hpp"
+#line 8546 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 9: goto tr623;
 		case 59: goto tr624;
@@ -8620,11 +8555,11 @@ tr623:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 208 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -8633,7 +8568,7 @@ st455:
 	if ( ++p == pe )
 		goto _test_eof455;
 case 455:
-#line 8637 "inc/vcf/validator_detail_v41.hpp"
+#line 8572 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 46: goto tr626;
 		case 49: goto tr627;
@@ -8648,18 +8583,18 @@ case 455:
 tr626:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st523;
 st523:
 	if ( ++p == pe )
 		goto _test_eof523;
 case 523:
-#line 8663 "inc/vcf/validator_detail_v41.hpp"
+#line 8598 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 9: goto tr707;
 		case 10: goto tr708;
@@ -8677,11 +8612,11 @@ tr707:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 208 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -8690,7 +8625,7 @@ st456:
 	if ( ++p == pe )
 		goto _test_eof456;
 case 456:
-#line 8694 "inc/vcf/validator_detail_v41.hpp"
+#line 8629 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) < 65 ) {
 		if ( 48 <= (*p) && (*p) <= 57 )
 			goto tr630;
@@ -8703,24 +8638,24 @@ case 456:
 tr630:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st457;
 tr632:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st457;
 st457:
 	if ( ++p == pe )
 		goto _test_eof457;
 case 457:
-#line 8724 "inc/vcf/validator_detail_v41.hpp"
+#line 8659 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 9: goto tr631;
 		case 58: goto tr633;
@@ -8739,11 +8674,11 @@ tr631:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 208 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -8752,7 +8687,7 @@ st458:
 	if ( ++p == pe )
 		goto _test_eof458;
 case 458:
-#line 8756 "inc/vcf/validator_detail_v41.hpp"
+#line 8691 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 46 )
 		goto tr636;
 	if ( (*p) < 48 ) {
@@ -8767,24 +8702,24 @@ case 458:
 tr635:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st524;
 tr645:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st524;
 st524:
 	if ( ++p == pe )
 		goto _test_eof524;
 case 524:
-#line 8788 "inc/vcf/validator_detail_v41.hpp"
+#line 8723 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 9: goto tr631;
 		case 10: goto tr708;
@@ -8799,51 +8734,44 @@ tr708:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 208 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 218 "src/vcf/vcf.ragel"
+#line 212 "src/vcf/vcf.ragel"
 	{
-        try {
-            // Handle all columns and build record
-            ParsePolicy::handle_body_line(*this);
+        // Handle all columns and build record
+        Error * error = ParsePolicy::handle_body_line(*this);
 
-            if (record != nullptr) {
-                auto duplicated_errors = previous_records.check_duplicates(*record);
-                for(auto &error_ptr : duplicated_errors) {
-                    ErrorPolicy::handle_error(*this, error_ptr.release());
-                }
+        if (error != nullptr) {
+            ErrorPolicy::handle_error(*this, error);
+        } else if (record != nullptr) {
+            auto duplicated_errors = ProfilePolicy::measure(profile, ProfiledStep::check_duplicates, [this] {
+                return previous_records.check_duplicates(*record);
+            });
+            for(auto &error_ptr : duplicated_errors) {
+                ErrorPolicy::handle_error(*this, error_ptr.release());
             }
 
-            try {
-                // Check warnings (non-blocking errors but potential mistakes anyway, only makes sense if the last record parsed was correct)
-                if (record != nullptr) {
-                    OptionalPolicy::optional_check_body_entry(*this, *record);
-                }
-            } catch (Error *warn) {
-                ErrorPolicy::handle_warning(*this, warn);
+            // Check warnings (non-blocking errors but potential mistakes anyway, only makes sense if the last record parsed was correct)
+            Error * warning = OptionalPolicy::optional_check_body_entry(*this, *record);
+            if (warning != nullptr) {
+                ErrorPolicy::handle_warning(*this, warning);
             }
-        } catch (Error *error) {
-            ErrorPolicy::handle_error(*this, error);
         }
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st525;
 st525:
 	if ( ++p == pe )
 		goto _test_eof525;
 case 525:
-#line 8847 "inc/vcf/validator_detail_v41.hpp"
+#line 8775 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 10: goto tr704;
 		case 13: goto tr705;
@@ -8859,12 +8787,11 @@ case 525:
 		goto tr711;
 	goto tr581;
 tr703:
-#line 70 "src/vcf/vcf.ragel"
+#line 66 "src/vcf/vcf.ragel"
 	{
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
     }
 	goto st459;
@@ -8872,7 +8799,7 @@ st459:
 	if ( ++p == pe )
 		goto _test_eof459;
 case 459:
-#line 8876 "inc/vcf/validator_detail_v41.hpp"
+#line 8803 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) < 65 ) {
 		if ( 48 <= (*p) && (*p) <= 57 )
 			goto tr638;
@@ -8885,24 +8812,24 @@ case 459:
 tr638:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st460;
 tr639:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st460;
 st460:
 	if ( ++p == pe )
 		goto _test_eof460;
 case 460:
-#line 8906 "inc/vcf/validator_detail_v41.hpp"
+#line 8833 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 59: goto tr639;
 		case 62: goto tr640;
@@ -8926,7 +8853,7 @@ st461:
 	if ( ++p == pe )
 		goto _test_eof461;
 case 461:
-#line 8930 "inc/vcf/validator_detail_v41.hpp"
+#line 8857 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 9 )
 		goto tr641;
 	goto tr581;
@@ -8935,65 +8862,58 @@ tr709:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 208 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 218 "src/vcf/vcf.ragel"
+#line 212 "src/vcf/vcf.ragel"
 	{
-        try {
-            // Handle all columns and build record
-            ParsePolicy::handle_body_line(*this);
+        // Handle all columns and build record
+        Error * error = ParsePolicy::handle_body_line(*this);
 
-            if (record != nullptr) {
-                auto duplicated_errors = previous_records.check_duplicates(*record);
-                for(auto &error_ptr : duplicated_errors) {
-                    ErrorPolicy::handle_error(*this, error_ptr.release());
-                }
+        if (error != nullptr) {
+            ErrorPolicy::handle_error(*this, error);
+        } else if (record != nullptr) {
+            auto duplicated_errors = ProfilePolicy::measure(profile, ProfiledStep::check_duplicates, [this] {
+                return previous_records.check_duplicates(*record);
+            });
+            for(auto &error_ptr : duplicated_errors) {
+                ErrorPolicy::handle_error(*this, error_ptr.release());
             }
 
-            try {
-                // Check warnings (non-blocking errors but potential mistakes anyway, only makes sense if the last record parsed was correct)
-                if (record != nullptr) {
-                    OptionalPolicy::optional_check_body_entry(*this, *record);
-                }
-            } catch (Error *warn) {
-                ErrorPolicy::handle_warning(*this, warn);
+            // Check warnings (non-blocking errors but potential mistakes anyway, only makes sense if the last record parsed was correct)
+            Error * warning = OptionalPolicy::optional_check_body_entry(*this, *record);
+            if (warning != nullptr) {
+                ErrorPolicy::handle_warning(*this, warning);
             }
-        } catch (Error *error) {
-            ErrorPolicy::handle_error(*this, error);
         }
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st462;
 st462:
 	if ( ++p == pe )
 		goto _test_eof462;
 case 462:
-#line 8983 "inc/vcf/validator_detail_v41.hpp"
+#line 8903 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 10 )
 		goto st525;
 	goto tr642;
 tr710:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st463;
 st463:
 	if ( ++p == pe )
 		goto _test_eof463;
 case 463:
-#line 8997 "inc/vcf/validator_detail_v41.hpp"
+#line 8917 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) > 57 ) {
 		if ( 59 <= (*p) && (*p) <= 126 )
 			goto tr645;
@@ -9003,24 +8923,24 @@ case 463:
 tr636:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st526;
 tr714:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st526;
 st526:
 	if ( ++p == pe )
 		goto _test_eof526;
 case 526:
-#line 9024 "inc/vcf/validator_detail_v41.hpp"
+#line 8944 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 9: goto tr631;
 		case 10: goto tr708;
@@ -9035,14 +8955,14 @@ case 526:
 tr713:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st527;
 st527:
 	if ( ++p == pe )
 		goto _test_eof527;
 case 527:
-#line 9046 "inc/vcf/validator_detail_v41.hpp"
+#line 8966 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 9: goto tr631;
 		case 10: goto tr708;
@@ -9062,24 +8982,24 @@ case 527:
 tr637:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st528;
 tr715:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st528;
 st528:
 	if ( ++p == pe )
 		goto _test_eof528;
 case 528:
-#line 9083 "inc/vcf/validator_detail_v41.hpp"
+#line 9003 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 9: goto tr631;
 		case 10: goto tr708;
@@ -9100,74 +9020,74 @@ case 528:
 tr627:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st464;
 st464:
 	if ( ++p == pe )
 		goto _test_eof464;
 case 464:
-#line 9115 "inc/vcf/validator_detail_v41.hpp"
+#line 9035 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 48 )
 		goto tr646;
 	goto tr625;
 tr646:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st465;
 st465:
 	if ( ++p == pe )
 		goto _test_eof465;
 case 465:
-#line 9129 "inc/vcf/validator_detail_v41.hpp"
+#line 9049 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 48 )
 		goto tr647;
 	goto tr625;
 tr647:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st466;
 st466:
 	if ( ++p == pe )
 		goto _test_eof466;
 case 466:
-#line 9143 "inc/vcf/validator_detail_v41.hpp"
+#line 9063 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 48 )
 		goto tr648;
 	goto tr625;
 tr648:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st467;
 st467:
 	if ( ++p == pe )
 		goto _test_eof467;
 case 467:
-#line 9157 "inc/vcf/validator_detail_v41.hpp"
+#line 9077 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 71 )
 		goto tr649;
 	goto tr625;
 tr649:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st529;
 st529:
 	if ( ++p == pe )
 		goto _test_eof529;
 case 529:
-#line 9171 "inc/vcf/validator_detail_v41.hpp"
+#line 9091 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 9: goto tr707;
 		case 10: goto tr708;
@@ -9186,7 +9106,7 @@ st468:
 	if ( ++p == pe )
 		goto _test_eof468;
 case 468:
-#line 9190 "inc/vcf/validator_detail_v41.hpp"
+#line 9110 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 49: goto tr627;
 		case 95: goto tr628;
@@ -9200,24 +9120,24 @@ case 468:
 tr628:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st530;
 tr718:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st530;
 st530:
 	if ( ++p == pe )
 		goto _test_eof530;
 case 530:
-#line 9221 "inc/vcf/validator_detail_v41.hpp"
+#line 9141 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 9: goto tr707;
 		case 10: goto tr708;
@@ -9239,14 +9159,14 @@ case 530:
 tr717:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st469;
 st469:
 	if ( ++p == pe )
 		goto _test_eof469;
 case 469:
-#line 9250 "inc/vcf/validator_detail_v41.hpp"
+#line 9170 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) > 58 ) {
 		if ( 60 <= (*p) && (*p) <= 126 )
 			goto tr651;
@@ -9256,14 +9176,14 @@ case 469:
 tr651:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st531;
 st531:
 	if ( ++p == pe )
 		goto _test_eof531;
 case 531:
-#line 9267 "inc/vcf/validator_detail_v41.hpp"
+#line 9187 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 9: goto tr707;
 		case 10: goto tr708;
@@ -9283,7 +9203,7 @@ st470:
 	if ( ++p == pe )
 		goto _test_eof470;
 case 470:
-#line 9287 "inc/vcf/validator_detail_v41.hpp"
+#line 9207 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 58 )
 		goto tr618;
 	if ( (*p) < 65 ) {
@@ -9310,18 +9230,18 @@ case 470:
 tr619:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st471;
 st471:
 	if ( ++p == pe )
 		goto _test_eof471;
 case 471:
-#line 9325 "inc/vcf/validator_detail_v41.hpp"
+#line 9245 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 9: goto tr623;
 		case 58: goto st453;
@@ -9350,28 +9270,28 @@ case 471:
 tr615:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st472;
 st472:
 	if ( ++p == pe )
 		goto _test_eof472;
 case 472:
-#line 9361 "inc/vcf/validator_detail_v41.hpp"
+#line 9281 "src/vcf/validator_detail_v41.cpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr652;
 	goto tr606;
 tr652:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st473;
 st473:
 	if ( ++p == pe )
 		goto _test_eof473;
 case 473:
-#line 9375 "inc/vcf/validator_detail_v41.hpp"
+#line 9295 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 9: goto tr614;
 		case 69: goto tr616;
@@ -9383,14 +9303,14 @@ case 473:
 tr616:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st474;
 st474:
 	if ( ++p == pe )
 		goto _test_eof474;
 case 474:
-#line 9394 "inc/vcf/validator_detail_v41.hpp"
+#line 9314 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 43: goto tr653;
 		case 45: goto tr653;
@@ -9401,28 +9321,28 @@ case 474:
 tr653:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st475;
 st475:
 	if ( ++p == pe )
 		goto _test_eof475;
 case 475:
-#line 9412 "inc/vcf/validator_detail_v41.hpp"
+#line 9332 "src/vcf/validator_detail_v41.cpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr654;
 	goto tr606;
 tr654:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st476;
 st476:
 	if ( ++p == pe )
 		goto _test_eof476;
 case 476:
-#line 9426 "inc/vcf/validator_detail_v41.hpp"
+#line 9346 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 9 )
 		goto tr614;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -9431,94 +9351,94 @@ case 476:
 tr610:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st477;
 tr613:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st477;
 st477:
 	if ( ++p == pe )
 		goto _test_eof477;
 case 477:
-#line 9452 "inc/vcf/validator_detail_v41.hpp"
+#line 9372 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 110 )
 		goto tr655;
 	goto tr606;
 tr655:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st478;
 st478:
 	if ( ++p == pe )
 		goto _test_eof478;
 case 478:
-#line 9466 "inc/vcf/validator_detail_v41.hpp"
+#line 9386 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 102 )
 		goto tr656;
 	goto tr606;
 tr608:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st479;
 tr656:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st479;
 st479:
 	if ( ++p == pe )
 		goto _test_eof479;
 case 479:
-#line 9490 "inc/vcf/validator_detail_v41.hpp"
+#line 9410 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 9 )
 		goto tr614;
 	goto tr606;
 tr611:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st480;
 st480:
 	if ( ++p == pe )
 		goto _test_eof480;
 case 480:
-#line 9508 "inc/vcf/validator_detail_v41.hpp"
+#line 9428 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 97 )
 		goto tr657;
 	goto tr606;
 tr657:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st481;
 st481:
 	if ( ++p == pe )
 		goto _test_eof481;
 case 481:
-#line 9522 "inc/vcf/validator_detail_v41.hpp"
+#line 9442 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 78 )
 		goto tr656;
 	goto tr606;
@@ -9532,7 +9452,7 @@ st482:
 	if ( ++p == pe )
 		goto _test_eof482;
 case 482:
-#line 9536 "inc/vcf/validator_detail_v41.hpp"
+#line 9456 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 42: goto tr598;
 		case 46: goto tr658;
@@ -9554,24 +9474,24 @@ case 482:
 tr658:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st483;
 tr682:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st483;
 st483:
 	if ( ++p == pe )
 		goto _test_eof483;
 case 483:
-#line 9575 "inc/vcf/validator_detail_v41.hpp"
+#line 9495 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 65: goto tr659;
 		case 67: goto tr659;
@@ -9588,14 +9508,14 @@ case 483:
 tr659:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st484;
 st484:
 	if ( ++p == pe )
 		goto _test_eof484;
 case 484:
-#line 9599 "inc/vcf/validator_detail_v41.hpp"
+#line 9519 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 9: goto tr604;
 		case 44: goto tr605;
@@ -9614,24 +9534,24 @@ case 484:
 tr600:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st485;
 tr660:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st485;
 st485:
 	if ( ++p == pe )
 		goto _test_eof485;
 case 485:
-#line 9635 "inc/vcf/validator_detail_v41.hpp"
+#line 9555 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 61 )
 		goto tr660;
 	if ( (*p) < 63 ) {
@@ -9664,14 +9584,14 @@ case 485:
 tr661:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st486;
 st486:
 	if ( ++p == pe )
 		goto _test_eof486;
 case 486:
-#line 9675 "inc/vcf/validator_detail_v41.hpp"
+#line 9595 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 62 )
 		goto tr662;
 	if ( (*p) < 45 ) {
@@ -9686,24 +9606,24 @@ case 486:
 tr601:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st487;
 tr663:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st487;
 st487:
 	if ( ++p == pe )
 		goto _test_eof487;
 case 487:
-#line 9707 "inc/vcf/validator_detail_v41.hpp"
+#line 9627 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 9: goto tr604;
 		case 44: goto tr605;
@@ -9725,14 +9645,14 @@ case 487:
 tr664:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st488;
 st488:
 	if ( ++p == pe )
 		goto _test_eof488;
 case 488:
-#line 9736 "inc/vcf/validator_detail_v41.hpp"
+#line 9656 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 60 )
 		goto tr667;
 	if ( (*p) < 65 ) {
@@ -9747,14 +9667,14 @@ case 488:
 tr666:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st489;
 st489:
 	if ( ++p == pe )
 		goto _test_eof489;
 case 489:
-#line 9758 "inc/vcf/validator_detail_v41.hpp"
+#line 9678 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 58: goto tr668;
 		case 61: goto tr666;
@@ -9771,28 +9691,28 @@ case 489:
 tr668:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st490;
 st490:
 	if ( ++p == pe )
 		goto _test_eof490;
 case 490:
-#line 9782 "inc/vcf/validator_detail_v41.hpp"
+#line 9702 "src/vcf/validator_detail_v41.cpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr669;
 	goto tr597;
 tr669:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st491;
 st491:
 	if ( ++p == pe )
 		goto _test_eof491;
 case 491:
-#line 9796 "inc/vcf/validator_detail_v41.hpp"
+#line 9716 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 91 )
 		goto tr662;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -9801,14 +9721,14 @@ case 491:
 tr667:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st492;
 st492:
 	if ( ++p == pe )
 		goto _test_eof492;
 case 492:
-#line 9812 "inc/vcf/validator_detail_v41.hpp"
+#line 9732 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) < 65 ) {
 		if ( 48 <= (*p) && (*p) <= 57 )
 			goto tr670;
@@ -9821,14 +9741,14 @@ case 492:
 tr670:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st493;
 st493:
 	if ( ++p == pe )
 		goto _test_eof493;
 case 493:
-#line 9832 "inc/vcf/validator_detail_v41.hpp"
+#line 9752 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 59: goto tr670;
 		case 62: goto tr671;
@@ -9845,28 +9765,28 @@ case 493:
 tr671:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st494;
 st494:
 	if ( ++p == pe )
 		goto _test_eof494;
 case 494:
-#line 9856 "inc/vcf/validator_detail_v41.hpp"
+#line 9776 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 58 )
 		goto tr668;
 	goto tr597;
 tr665:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st495;
 st495:
 	if ( ++p == pe )
 		goto _test_eof495;
 case 495:
-#line 9870 "inc/vcf/validator_detail_v41.hpp"
+#line 9790 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 60 )
 		goto tr673;
 	if ( (*p) < 65 ) {
@@ -9881,14 +9801,14 @@ case 495:
 tr672:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st496;
 st496:
 	if ( ++p == pe )
 		goto _test_eof496;
 case 496:
-#line 9892 "inc/vcf/validator_detail_v41.hpp"
+#line 9812 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 58: goto tr674;
 		case 61: goto tr672;
@@ -9905,28 +9825,28 @@ case 496:
 tr674:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st497;
 st497:
 	if ( ++p == pe )
 		goto _test_eof497;
 case 497:
-#line 9916 "inc/vcf/validator_detail_v41.hpp"
+#line 9836 "src/vcf/validator_detail_v41.cpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr675;
 	goto tr597;
 tr675:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st498;
 st498:
 	if ( ++p == pe )
 		goto _test_eof498;
 case 498:
-#line 9930 "inc/vcf/validator_detail_v41.hpp"
+#line 9850 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 93 )
 		goto tr662;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -9935,14 +9855,14 @@ case 498:
 tr673:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st499;
 st499:
 	if ( ++p == pe )
 		goto _test_eof499;
 case 499:
-#line 9946 "inc/vcf/validator_detail_v41.hpp"
+#line 9866 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) < 65 ) {
 		if ( 48 <= (*p) && (*p) <= 57 )
 			goto tr676;
@@ -9955,14 +9875,14 @@ case 499:
 tr676:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st500;
 st500:
 	if ( ++p == pe )
 		goto _test_eof500;
 case 500:
-#line 9966 "inc/vcf/validator_detail_v41.hpp"
+#line 9886 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 59: goto tr676;
 		case 62: goto tr677;
@@ -9979,32 +9899,32 @@ case 500:
 tr677:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st501;
 st501:
 	if ( ++p == pe )
 		goto _test_eof501;
 case 501:
-#line 9990 "inc/vcf/validator_detail_v41.hpp"
+#line 9910 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 58 )
 		goto tr674;
 	goto tr597;
 tr602:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st502;
 st502:
 	if ( ++p == pe )
 		goto _test_eof502;
 case 502:
-#line 10008 "inc/vcf/validator_detail_v41.hpp"
+#line 9928 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 60 )
 		goto tr679;
 	if ( (*p) < 65 ) {
@@ -10019,14 +9939,14 @@ case 502:
 tr678:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st503;
 st503:
 	if ( ++p == pe )
 		goto _test_eof503;
 case 503:
-#line 10030 "inc/vcf/validator_detail_v41.hpp"
+#line 9950 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 58: goto tr680;
 		case 61: goto tr678;
@@ -10043,28 +9963,28 @@ case 503:
 tr680:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st504;
 st504:
 	if ( ++p == pe )
 		goto _test_eof504;
 case 504:
-#line 10054 "inc/vcf/validator_detail_v41.hpp"
+#line 9974 "src/vcf/validator_detail_v41.cpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr681;
 	goto tr597;
 tr681:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st505;
 st505:
 	if ( ++p == pe )
 		goto _test_eof505;
 case 505:
-#line 10068 "inc/vcf/validator_detail_v41.hpp"
+#line 9988 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 91 )
 		goto tr682;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -10073,14 +9993,14 @@ case 505:
 tr679:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st506;
 st506:
 	if ( ++p == pe )
 		goto _test_eof506;
 case 506:
-#line 10084 "inc/vcf/validator_detail_v41.hpp"
+#line 10004 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) < 65 ) {
 		if ( 48 <= (*p) && (*p) <= 57 )
 			goto tr683;
@@ -10093,14 +10013,14 @@ case 506:
 tr683:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st507;
 st507:
 	if ( ++p == pe )
 		goto _test_eof507;
 case 507:
-#line 10104 "inc/vcf/validator_detail_v41.hpp"
+#line 10024 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 59: goto tr683;
 		case 62: goto tr684;
@@ -10117,32 +10037,32 @@ case 507:
 tr684:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st508;
 st508:
 	if ( ++p == pe )
 		goto _test_eof508;
 case 508:
-#line 10128 "inc/vcf/validator_detail_v41.hpp"
+#line 10048 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 58 )
 		goto tr680;
 	goto tr597;
 tr603:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st509;
 st509:
 	if ( ++p == pe )
 		goto _test_eof509;
 case 509:
-#line 10146 "inc/vcf/validator_detail_v41.hpp"
+#line 10066 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 60 )
 		goto tr686;
 	if ( (*p) < 65 ) {
@@ -10157,14 +10077,14 @@ case 509:
 tr685:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st510;
 st510:
 	if ( ++p == pe )
 		goto _test_eof510;
 case 510:
-#line 10168 "inc/vcf/validator_detail_v41.hpp"
+#line 10088 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 58: goto tr687;
 		case 61: goto tr685;
@@ -10181,28 +10101,28 @@ case 510:
 tr687:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st511;
 st511:
 	if ( ++p == pe )
 		goto _test_eof511;
 case 511:
-#line 10192 "inc/vcf/validator_detail_v41.hpp"
+#line 10112 "src/vcf/validator_detail_v41.cpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr688;
 	goto tr597;
 tr688:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st512;
 st512:
 	if ( ++p == pe )
 		goto _test_eof512;
 case 512:
-#line 10206 "inc/vcf/validator_detail_v41.hpp"
+#line 10126 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 93 )
 		goto tr682;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -10211,14 +10131,14 @@ case 512:
 tr686:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st513;
 st513:
 	if ( ++p == pe )
 		goto _test_eof513;
 case 513:
-#line 10222 "inc/vcf/validator_detail_v41.hpp"
+#line 10142 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) < 65 ) {
 		if ( 48 <= (*p) && (*p) <= 57 )
 			goto tr689;
@@ -10231,14 +10151,14 @@ case 513:
 tr689:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st514;
 st514:
 	if ( ++p == pe )
 		goto _test_eof514;
 case 514:
-#line 10242 "inc/vcf/validator_detail_v41.hpp"
+#line 10162 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 59: goto tr689;
 		case 62: goto tr690;
@@ -10255,32 +10175,32 @@ case 514:
 tr690:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st515;
 st515:
 	if ( ++p == pe )
 		goto _test_eof515;
 case 515:
-#line 10266 "inc/vcf/validator_detail_v41.hpp"
+#line 10186 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 58 )
 		goto tr687;
 	goto tr597;
 tr599:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st516;
 st516:
 	if ( ++p == pe )
 		goto _test_eof516;
 case 516:
-#line 10284 "inc/vcf/validator_detail_v41.hpp"
+#line 10204 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 9: goto tr604;
 		case 65: goto tr659;
@@ -10296,51 +10216,43 @@ case 516:
 	}
 	goto tr597;
 tr565:
-#line 208 "src/vcf/vcf.ragel"
+#line 202 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_header_line(*this);
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st517;
 tr577:
-#line 204 "src/vcf/vcf.ragel"
+#line 198 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_sample_name(*this);
     }
-#line 208 "src/vcf/vcf.ragel"
+#line 202 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_header_line(*this);
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st517;
 st517:
 	if ( ++p == pe )
 		goto _test_eof517;
 case 517:
-#line 10339 "inc/vcf/validator_detail_v41.hpp"
+#line 10251 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 10 )
 		goto st521;
 	goto tr566;
 tr23:
-#line 99 "src/vcf/vcf.ragel"
+#line 93 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_fileformat(*this);
@@ -10351,40 +10263,32 @@ tr23:
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st518;
 st518:
 	if ( ++p == pe )
 		goto _test_eof518;
 case 518:
-#line 10368 "inc/vcf/validator_detail_v41.hpp"
+#line 10276 "src/vcf/validator_detail_v41.cpp"
 	if ( (*p) == 10 )
 		goto st22;
 	goto tr0;
 tr695:
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st519;
 st519:
 	if ( ++p == pe )
 		goto _test_eof519;
 case 519:
-#line 10388 "inc/vcf/validator_detail_v41.hpp"
+#line 10292 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 10: goto tr694;
 		case 13: goto tr695;
@@ -10393,40 +10297,32 @@ case 519:
 tr694:
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
-#line 227 "src/vcf/vcf_v41.ragel"
+#line 229 "src/vcf/vcf_v41.ragel"
 	{ {goto st28;} }
 	goto st532;
 st532:
 	if ( ++p == pe )
 		goto _test_eof532;
 case 532:
-#line 10412 "inc/vcf/validator_detail_v41.hpp"
+#line 10312 "src/vcf/validator_detail_v41.cpp"
 	goto st0;
 tr698:
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st520;
 st520:
 	if ( ++p == pe )
 		goto _test_eof520;
 case 520:
-#line 10430 "inc/vcf/validator_detail_v41.hpp"
+#line 10326 "src/vcf/validator_detail_v41.cpp"
 	switch( (*p) ) {
 		case 10: goto tr697;
 		case 13: goto tr698;
@@ -10435,22 +10331,18 @@ case 520:
 tr697:
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
-#line 228 "src/vcf/vcf_v41.ragel"
+#line 230 "src/vcf/vcf_v41.ragel"
 	{ {goto st525;} }
 	goto st533;
 st533:
 	if ( ++p == pe )
 		goto _test_eof533;
 case 533:
-#line 10454 "inc/vcf/validator_detail_v41.hpp"
+#line 10346 "src/vcf/validator_detail_v41.cpp"
 	goto st0;
 	}
 	_test_eof2: cs = 2; goto _test_eof; 
@@ -11004,7 +10896,7 @@ case 533:
 	case 12: 
 	case 13: 
 	case 518: 
-#line 60 "src/vcf/vcf.ragel"
+#line 56 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
         p--; {goto st519;}
@@ -11058,19 +10950,18 @@ case 533:
 	case 71: 
 	case 72: 
 	case 73: 
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	break;
 	case 521: 
-#line 70 "src/vcf/vcf.ragel"
+#line 66 "src/vcf/vcf.ragel"
 	{
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
     }
 	break;
@@ -11084,22 +10975,21 @@ case 533:
 	case 437: 
 	case 438: 
 	case 517: 
-#line 78 "src/vcf/vcf.ragel"
+#line 73 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st520;}
     }
 	break;
 	case 462: 
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st520;}
@@ -11126,12 +11016,12 @@ case 533:
 	case 95: 
 	case 96: 
 	case 100: 
-#line 247 "src/vcf/vcf.ragel"
+#line 238 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
@@ -11145,12 +11035,12 @@ case 533:
 	case 308: 
 	case 309: 
 	case 310: 
-#line 259 "src/vcf/vcf.ragel"
+#line 250 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
@@ -11185,12 +11075,12 @@ case 533:
 	case 358: 
 	case 359: 
 	case 360: 
-#line 265 "src/vcf/vcf.ragel"
+#line 256 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
@@ -11219,12 +11109,12 @@ case 533:
 	case 128: 
 	case 129: 
 	case 133: 
-#line 271 "src/vcf/vcf.ragel"
+#line 262 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
@@ -11265,12 +11155,12 @@ case 533:
 	case 176: 
 	case 177: 
 	case 181: 
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
@@ -11310,12 +11200,12 @@ case 533:
 	case 224: 
 	case 225: 
 	case 229: 
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
@@ -11331,12 +11221,12 @@ case 533:
 	case 241: 
 	case 242: 
 	case 249: 
-#line 299 "src/vcf/vcf.ragel"
+#line 290 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
@@ -11353,12 +11243,12 @@ case 533:
 	case 369: 
 	case 370: 
 	case 371: 
-#line 320 "src/vcf/vcf.ragel"
+#line 311 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
@@ -11375,12 +11265,12 @@ case 533:
 	case 258: 
 	case 259: 
 	case 299: 
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
@@ -11423,29 +11313,27 @@ case 533:
 	case 427: 
 	case 428: 
 	case 429: 
-#line 379 "src/vcf/vcf.ragel"
+#line 370 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
             "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st520;}
     }
-#line 78 "src/vcf/vcf.ragel"
+#line 73 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st520;}
@@ -11455,12 +11343,12 @@ case 533:
 	case 459: 
 	case 460: 
 	case 461: 
-#line 396 "src/vcf/vcf.ragel"
+#line 386 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new ChromosomeBodyError{n_lines});
         p--; {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st520;}
@@ -11468,12 +11356,12 @@ case 533:
 	break;
 	case 441: 
 	case 442: 
-#line 402 "src/vcf/vcf.ragel"
+#line 392 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new PositionBodyError{n_lines});
         p--; {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st520;}
@@ -11481,12 +11369,12 @@ case 533:
 	break;
 	case 443: 
 	case 444: 
-#line 408 "src/vcf/vcf.ragel"
+#line 398 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new IdBodyError{n_lines});
         p--; {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st520;}
@@ -11494,12 +11382,12 @@ case 533:
 	break;
 	case 445: 
 	case 446: 
-#line 414 "src/vcf/vcf.ragel"
+#line 404 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new ReferenceAlleleBodyError{n_lines});
         p--; {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st520;}
@@ -11542,12 +11430,12 @@ case 533:
 	case 514: 
 	case 515: 
 	case 516: 
-#line 420 "src/vcf/vcf.ragel"
+#line 410 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new AlternateAllelesBodyError{n_lines});
         p--; {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st520;}
@@ -11566,12 +11454,12 @@ case 533:
 	case 479: 
 	case 480: 
 	case 481: 
-#line 426 "src/vcf/vcf.ragel"
+#line 416 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new QualityBodyError{n_lines});
         p--; {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st520;}
@@ -11582,26 +11470,27 @@ case 533:
 	case 454: 
 	case 470: 
 	case 471: 
-#line 432 "src/vcf/vcf.ragel"
+#line 422 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FilterBodyError{n_lines});
         p--; {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st520;}
     }
 	break;
 	case 463: 
-#line 454 "src/vcf/vcf.ragel"
+#line 444 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " is not a valid string";
-        ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str()});
+        ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str(), "",
+                                                              "Sample is not a valid string"});
         p--; {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st520;}
@@ -11615,13 +11504,13 @@ case 533:
 	case 19: 
 	case 20: 
 	case 21: 
-#line 29 "src/vcf/vcf_v41.ragel"
+#line 31 "src/vcf/vcf_v41.ragel"
 	{
         ErrorPolicy::handle_error(*this,
                 new FileformatError{n_lines, "The fileformat declaration is not 'fileformat=VCFv4.1'"});
         p--; {goto st519;}
     }
-#line 60 "src/vcf/vcf.ragel"
+#line 56 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
         p--; {goto st519;}
@@ -11629,12 +11518,12 @@ case 533:
 	break;
 	case 456: 
 	case 457: 
-#line 50 "src/vcf/vcf_v41.ragel"
+#line 52 "src/vcf/vcf_v41.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FormatBodyError{n_lines});
         p--; {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st520;}
@@ -11652,66 +11541,61 @@ case 533:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 208 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 218 "src/vcf/vcf.ragel"
+#line 212 "src/vcf/vcf.ragel"
 	{
-        try {
-            // Handle all columns and build record
-            ParsePolicy::handle_body_line(*this);
+        // Handle all columns and build record
+        Error * error = ParsePolicy::handle_body_line(*this);
 
-            if (record != nullptr) {
-                auto duplicated_errors = previous_records.check_duplicates(*record);
-                for(auto &error_ptr : duplicated_errors) {
-                    ErrorPolicy::handle_error(*this, error_ptr.release());
-                }
+        if (error != nullptr) {
+            ErrorPolicy::handle_error(*this, error);
+        } else if (record != nullptr) {
+            auto duplicated_errors = ProfilePolicy::measure(profile, ProfiledStep::check_duplicates, [this] {
+                return previous_records.check_duplicates(*record);
+            });
+            for(auto &error_ptr : duplicated_errors) {
+                ErrorPolicy::handle_error(*this, error_ptr.release());
             }
 
-            try {
-                // Check warnings (non-blocking errors but potential mistakes anyway, only makes sense if the last record parsed was correct)
-                if (record != nullptr) {
-                    OptionalPolicy::optional_check_body_entry(*this, *record);
-                }
-            } catch (Error *warn) {
-                ErrorPolicy::handle_warning(*this, warn);
+            // Check warnings (non-blocking errors but potential mistakes anyway, only makes sense if the last record parsed was correct)
+            Error * warning = OptionalPolicy::optional_check_body_entry(*this, *record);
+            if (warning != nullptr) {
+                ErrorPolicy::handle_warning(*this, warning);
             }
-        } catch (Error *error) {
-            ErrorPolicy::handle_error(*this, error);
         }
     }
 	break;
 	case 23: 
 	case 28: 
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
-#line 379 "src/vcf/vcf.ragel"
+#line 370 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
             "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st520;}
     }
-#line 78 "src/vcf/vcf.ragel"
+#line 73 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st520;}
@@ -11720,35 +11604,35 @@ case 533:
 	case 81: 
 	case 82: 
 	case 83: 
-#line 252 "src/vcf/vcf.ragel"
+#line 243 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines,
             "ALT metadata ID is not prefixed by DEL/INS/DUP/INV/CNV and suffixed by ':' and a text sequence"});
         p--; {goto st519;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 238 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	break;
 	case 104: 
-#line 271 "src/vcf/vcf.ragel"
+#line 262 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
         p--; {goto st519;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
@@ -11756,17 +11640,17 @@ case 533:
 	break;
 	case 163: 
 	case 164: 
-#line 293 "src/vcf/vcf.ragel"
+#line 284 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String"});
         p--; {goto st519;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
@@ -11774,17 +11658,17 @@ case 533:
 	break;
 	case 211: 
 	case 212: 
-#line 293 "src/vcf/vcf.ragel"
+#line 284 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String"});
         p--; {goto st519;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
@@ -11799,17 +11683,17 @@ case 533:
 	case 269: 
 	case 270: 
 	case 271: 
-#line 352 "src/vcf/vcf.ragel"
+#line 343 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)"});
         p--; {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
@@ -11824,17 +11708,17 @@ case 533:
 	case 279: 
 	case 280: 
 	case 281: 
-#line 357 "src/vcf/vcf.ragel"
+#line 348 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)"});
         p--; {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
@@ -11842,17 +11726,17 @@ case 533:
 	break;
 	case 340: 
 	case 341: 
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st519;}
     }
-#line 265 "src/vcf/vcf.ragel"
+#line 256 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
@@ -11861,17 +11745,17 @@ case 533:
 	case 114: 
 	case 115: 
 	case 116: 
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st519;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 262 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
@@ -11880,17 +11764,17 @@ case 533:
 	case 146: 
 	case 147: 
 	case 148: 
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st519;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
@@ -11899,17 +11783,17 @@ case 533:
 	case 194: 
 	case 195: 
 	case 196: 
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st519;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
@@ -11921,17 +11805,17 @@ case 533:
 	case 246: 
 	case 247: 
 	case 248: 
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st519;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 290 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
@@ -11939,17 +11823,17 @@ case 533:
 	break;
 	case 260: 
 	case 261: 
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
@@ -11961,17 +11845,17 @@ case 533:
 	case 101: 
 	case 102: 
 	case 103: 
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st519;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 238 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
@@ -11983,17 +11867,17 @@ case 533:
 	case 134: 
 	case 135: 
 	case 136: 
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st519;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 262 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
@@ -12005,17 +11889,17 @@ case 533:
 	case 182: 
 	case 183: 
 	case 184: 
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st519;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
@@ -12027,17 +11911,17 @@ case 533:
 	case 230: 
 	case 231: 
 	case 232: 
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st519;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
@@ -12062,17 +11946,17 @@ case 533:
 	case 300: 
 	case 301: 
 	case 302: 
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
@@ -12097,17 +11981,17 @@ case 533:
 	case 327: 
 	case 328: 
 	case 329: 
-#line 373 "src/vcf/vcf.ragel"
+#line 364 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata URL is not valid"});
         p--; {goto st519;}
     }
-#line 259 "src/vcf/vcf.ragel"
+#line 250 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
@@ -12134,17 +12018,17 @@ case 533:
 	case 390: 
 	case 391: 
 	case 392: 
-#line 373 "src/vcf/vcf.ragel"
+#line 364 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata URL is not valid"});
         p--; {goto st519;}
     }
-#line 320 "src/vcf/vcf.ragel"
+#line 311 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
@@ -12156,55 +12040,57 @@ case 533:
 	case 466: 
 	case 467: 
 	case 468: 
-#line 443 "src/vcf/vcf.ragel"
+#line 433 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info key is not a sequence of alphanumeric and/or punctuation characters"});
         p--; {goto st520;}
     }
-#line 438 "src/vcf/vcf.ragel"
+#line 428 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
         p--; {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st520;}
     }
 	break;
 	case 469: 
-#line 448 "src/vcf/vcf.ragel"
+#line 438 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info field value is not a comma-separated list of valid strings (maybe it contains whitespaces?)"});
         p--; {goto st520;}
     }
-#line 438 "src/vcf/vcf.ragel"
+#line 428 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
         p--; {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st520;}
     }
 	break;
 	case 458: 
-#line 461 "src/vcf/vcf.ragel"
+#line 452 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " does not start with a valid genotype";
-        ErrorPolicy::handle_error(*this, new SamplesFieldBodyError{n_lines, message_stream.str(), "", "GT"});
+        ErrorPolicy::handle_error(*this, new SamplesFieldBodyError{n_lines, message_stream.str(), "", "GT", -1,
+                                                                   "Sample does not start with a valid genotype"});
         p--; {goto st520;}
     }
-#line 454 "src/vcf/vcf.ragel"
+#line 444 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " is not a valid string";
-        ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str()});
+        ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str(), "",
+                                                              "Sample is not a valid string"});
         p--; {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st520;}
@@ -12213,17 +12099,17 @@ case 533:
 	case 156: 
 	case 157: 
 	case 185: 
-#line 36 "src/vcf/vcf_v41.ragel"
+#line 38 "src/vcf/vcf_v41.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "FORMAT metadata Number is not a number, A, G or dot"});
         p--; {goto st519;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
@@ -12232,189 +12118,275 @@ case 533:
 	case 204: 
 	case 205: 
 	case 233: 
-#line 42 "src/vcf/vcf_v41.ragel"
+#line 44 "src/vcf/vcf_v41.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Number is not a number, A, G or dot"});
         p--; {goto st519;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	break;
 	case 22: 
-#line 60 "src/vcf/vcf.ragel"
+#line 56 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
-#line 379 "src/vcf/vcf.ragel"
+#line 370 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
             "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st520;}
     }
-#line 78 "src/vcf/vcf.ragel"
+#line 73 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st520;}
     }
 	break;
 	case 272: 
-#line 352 "src/vcf/vcf.ragel"
+#line 343 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)"});
         p--; {goto st519;}
     }
-#line 357 "src/vcf/vcf.ragel"
+#line 348 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)"});
         p--; {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	break;
 	case 282: 
-#line 357 "src/vcf/vcf.ragel"
+#line 348 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)"});
         p--; {goto st519;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	break;
 	case 262: 
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st519;}
     }
-#line 352 "src/vcf/vcf.ragel"
+#line 343 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)"});
         p--; {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	break;
 	case 24: 
-#line 247 "src/vcf/vcf.ragel"
+#line 238 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
         p--; {goto st519;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 262 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
         p--; {goto st519;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st519;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st519;}
     }
-#line 259 "src/vcf/vcf.ragel"
+#line 250 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
         p--; {goto st519;}
     }
-#line 265 "src/vcf/vcf.ragel"
+#line 256 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
         p--; {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st519;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 290 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
         p--; {goto st519;}
     }
-#line 320 "src/vcf/vcf.ragel"
+#line 311 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
         p--; {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st519;}
     }
 	break;
-#line 12409 "inc/vcf/validator_detail_v41.hpp"
+#line 12293 "src/vcf/validator_detail_v41.cpp"
 	}
 	}
 
 	_out: {}
 	}
 
-#line 257 "src/vcf/vcf_v41.ragel"
+#line 264 "src/vcf/vcf_v41.ragel"
+
+      }
 
+      ParsePolicy::handle_buffer_end(*this, pe);
     }
+
+    template <typename Configuration>
+    void ParserImpl_v41<Configuration>::report_pending_records()
+    {
+      size_t lines_read = n_lines;
+
+      for (size_t i = 0; i < n_pending_records; ++i) {
+        PendingRecord & pending = pending_records[i];
+        Record const & pending_record = *pending.record;
+        n_lines = pending_record.line;  // as if the record had just been read
+
+        Error * error = pending.error;
+        pending.error = nullptr;
+        if (error == nullptr) {
+          error = ParsePolicy::handle_checked_record(*this, pending_record);
+        }
+        if (error != nullptr) {
+          ErrorPolicy::handle_error(*this, error);
+          continue;
+        }
+
+        auto duplicated_errors = ProfilePolicy::measure(profile, ProfiledStep::check_duplicates, [&] {
+          return previous_records.check_duplicates(pending_record);
+        });
+        for (auto &error_ptr : duplicated_errors) {
+          ErrorPolicy::handle_error(*this, error_ptr.release());
+        }
+
+        Error * warning = OptionalPolicy::optional_check_body_entry(*this, pending_record);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
+        }
+      }
+
+      n_pending_records = 0;
+      n_lines = lines_read;
+    }
+
+    template <typename Configuration>
+    ParserImpl * ParserImpl_v41<Configuration>::new_body_parser(std::shared_ptr<Source> source) const
+    {
+      auto parser = new ParserImpl_v41<Configuration>{source};
+      parser->cs = vcf_v41_en_main_body_section;
+      return parser;
+    }
+
+    template <typename Configuration>
+    size_t ParserImpl_v41<Configuration>::line_buffers_size() const
+    {
+      return ParsePolicy::line_buffers_size();
+    }
+
+    template <typename Configuration>
+    size_t ParserImpl_v41<Configuration>::header_size() const
+    {
+      return ParsePolicy::header_size();
+    }
+
+    template <typename Configuration>
+    bool ParserImpl_v41<Configuration>::skips_valid_lines() const
+    {
+      return ParsePolicy::skips_valid_lines;
+    }
+
+    template <typename Configuration>
+    char const * ParserImpl_v41<Configuration>::skip_valid_lines(char const * p, char const * pe)
+    {
+      if (cs != vcf_v41_en_main_body_section) {
+        return p;
+      }
+      typename ProfilePolicy::ParsingTimer parsing_timer{profile};
+      return ParsePolicy::skip_valid_lines(*this, p, pe);
+    }
+
+    // the only configurations of the parser, so the machine is compiled once, here
+    template class ParserImpl_v41<QuickValidatorCfg>;
+    template class ParserImpl_v41<FullValidatorCfg>;
+    template class ParserImpl_v41<ReaderCfg>;
+    template class ParserImpl_v41<ProfiledQuickValidatorCfg>;
+    template class ParserImpl_v41<ProfiledFullValidatorCfg>;
+    template class ParserImpl_v41<ProfiledReaderCfg>;
+    template class ParserImpl_v41<OrderValidatorCfg>;
+    template class ParserImpl_v41<RecordsValidatorCfg>;
+    template class ParserImpl_v41<ProfiledOrderValidatorCfg>;
+    template class ParserImpl_v41<ProfiledRecordsValidatorCfg>;
    
   }
 }
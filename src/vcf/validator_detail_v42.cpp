@@ -16,14 +16,16 @@
  * limitations under the License.
  */
 
+#include "vcf/validator.hpp"
 
-#line 233 "src/vcf/vcf_v42.ragel"
+
+#line 235 "src/vcf/vcf_v42.ragel"
 
 
 namespace
 {
   
-#line 27 "inc/vcf/validator_detail_v42.hpp"
+#line 29 "src/vcf/validator_detail_v42.cpp"
 static const int vcf_v42_start = 1;
 static const int vcf_v42_first_final = 593;
 static const int vcf_v42_error = 0;
@@ -35,7 +37,7 @@ static const int vcf_v42_en_meta_section_skip = 591;
 static const int vcf_v42_en_body_section_skip = 592;
 
 
-#line 239 "src/vcf/vcf_v42.ragel"
+#line 241 "src/vcf/vcf_v42.ragel"
 
 }
 
@@ -49,20 +51,25 @@ namespace ebi
     : ParserImpl{source}
     {
       
-#line 53 "inc/vcf/validator_detail_v42.hpp"
+#line 55 "src/vcf/validator_detail_v42.cpp"
 	{
 	cs = vcf_v42_start;
 	}
 
-#line 253 "src/vcf/vcf_v42.ragel"
+#line 255 "src/vcf/vcf_v42.ragel"
 
     }
 
     template <typename Configuration>
     void ParserImpl_v42<Configuration>::parse_buffer(char const * p, char const * pe, char const * eof)
     {
-      
-#line 66 "inc/vcf/validator_detail_v42.hpp"
+      ParsePolicy::handle_buffer_begin(*this, p);
+
+      {
+        typename ProfilePolicy::ParsingTimer parsing_timer{profile};
+
+        
+#line 73 "src/vcf/validator_detail_v42.cpp"
 	{
 	if ( p == pe )
 		goto _test_eof;
@@ -73,1136 +80,1131 @@ case 1:
 		goto st2;
 	goto tr0;
 tr0:
-#line 60 "src/vcf/vcf.ragel"
+#line 56 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr14:
-#line 29 "src/vcf/vcf_v42.ragel"
+#line 31 "src/vcf/vcf_v42.ragel"
 	{
         ErrorPolicy::handle_error(*this,
                 new FileformatError{n_lines, "The fileformat declaration is not 'fileformat=VCFv4.2'"});
         p--; {goto st591;}
     }
-#line 60 "src/vcf/vcf.ragel"
+#line 56 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr24:
-#line 60 "src/vcf/vcf.ragel"
+#line 56 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
-#line 379 "src/vcf/vcf.ragel"
+#line 370 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
             "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st592;}
     }
-#line 78 "src/vcf/vcf.ragel"
+#line 73 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st592;}
     }
 	goto st0;
 tr26:
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
-#line 379 "src/vcf/vcf.ragel"
+#line 370 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
             "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st592;}
     }
-#line 78 "src/vcf/vcf.ragel"
+#line 73 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st592;}
     }
 	goto st0;
 tr29:
-#line 247 "src/vcf/vcf.ragel"
+#line 238 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
         p--; {goto st591;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 262 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
         p--; {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st591;}
     }
-#line 259 "src/vcf/vcf.ragel"
+#line 250 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
         p--; {goto st591;}
     }
-#line 265 "src/vcf/vcf.ragel"
+#line 256 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
         p--; {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st591;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 290 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
         p--; {goto st591;}
     }
-#line 320 "src/vcf/vcf.ragel"
+#line 311 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr39:
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr125:
-#line 247 "src/vcf/vcf.ragel"
+#line 238 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr133:
-#line 252 "src/vcf/vcf.ragel"
+#line 243 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines,
             "ALT metadata ID is not prefixed by DEL/INS/DUP/INV/CNV and suffixed by ':' and a text sequence"});
         p--; {goto st591;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 238 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr152:
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st591;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 238 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr161:
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st591;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 238 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr175:
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st591;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st591;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 238 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr187:
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st591;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st591;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 238 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr193:
-#line 271 "src/vcf/vcf.ragel"
+#line 262 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
         p--; {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr196:
-#line 271 "src/vcf/vcf.ragel"
+#line 262 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr206:
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st591;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 262 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr225:
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st591;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 262 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr247:
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st591;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st591;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 262 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr259:
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st591;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st591;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 262 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr265:
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr275:
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr288:
-#line 36 "src/vcf/vcf_v42.ragel"
+#line 38 "src/vcf/vcf_v42.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "FORMAT metadata Number is not a number, A, R, G or dot"});
         p--; {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr297:
-#line 293 "src/vcf/vcf.ragel"
+#line 284 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String"});
         p--; {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr314:
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr336:
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st591;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr348:
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st591;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr355:
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr364:
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr377:
-#line 42 "src/vcf/vcf_v42.ragel"
+#line 44 "src/vcf/vcf_v42.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Number is not a number, A, R, G or dot"});
         p--; {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr386:
-#line 293 "src/vcf/vcf.ragel"
+#line 284 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String"});
         p--; {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr403:
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr425:
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st591;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr437:
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st591;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr444:
-#line 299 "src/vcf/vcf.ragel"
+#line 290 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr454:
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st591;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 290 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr466:
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr477:
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr482:
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st591;}
     }
-#line 352 "src/vcf/vcf.ragel"
+#line 343 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)"});
         p--; {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr484:
-#line 352 "src/vcf/vcf.ragel"
+#line 343 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)"});
         p--; {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr494:
-#line 352 "src/vcf/vcf.ragel"
+#line 343 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)"});
         p--; {goto st591;}
     }
-#line 357 "src/vcf/vcf.ragel"
+#line 348 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)"});
         p--; {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr497:
-#line 357 "src/vcf/vcf.ragel"
+#line 348 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)"});
         p--; {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr507:
-#line 357 "src/vcf/vcf.ragel"
+#line 348 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)"});
         p--; {goto st591;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr510:
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr533:
-#line 259 "src/vcf/vcf.ragel"
+#line 250 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr542:
-#line 373 "src/vcf/vcf.ragel"
+#line 364 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata URL is not valid"});
         p--; {goto st591;}
     }
-#line 259 "src/vcf/vcf.ragel"
+#line 250 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr563:
-#line 265 "src/vcf/vcf.ragel"
+#line 256 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr574:
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st591;}
     }
-#line 265 "src/vcf/vcf.ragel"
+#line 256 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr612:
-#line 320 "src/vcf/vcf.ragel"
+#line 311 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr624:
-#line 373 "src/vcf/vcf.ragel"
+#line 364 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata URL is not valid"});
         p--; {goto st591;}
     }
-#line 320 "src/vcf/vcf.ragel"
+#line 311 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	goto st0;
 tr647:
-#line 379 "src/vcf/vcf.ragel"
+#line 370 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
             "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st592;}
     }
-#line 78 "src/vcf/vcf.ragel"
+#line 73 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st592;}
     }
 	goto st0;
 tr687:
-#line 78 "src/vcf/vcf.ragel"
+#line 73 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st592;}
     }
 	goto st0;
 tr702:
-#line 396 "src/vcf/vcf.ragel"
+#line 386 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new ChromosomeBodyError{n_lines});
         p--; {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st592;}
     }
 	goto st0;
 tr705:
-#line 402 "src/vcf/vcf.ragel"
+#line 392 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new PositionBodyError{n_lines});
         p--; {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st592;}
     }
 	goto st0;
 tr709:
-#line 408 "src/vcf/vcf.ragel"
+#line 398 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new IdBodyError{n_lines});
         p--; {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st592;}
     }
 	goto st0;
 tr714:
-#line 414 "src/vcf/vcf.ragel"
+#line 404 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new ReferenceAlleleBodyError{n_lines});
         p--; {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st592;}
     }
 	goto st0;
 tr718:
-#line 420 "src/vcf/vcf.ragel"
+#line 410 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new AlternateAllelesBodyError{n_lines});
         p--; {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st592;}
     }
 	goto st0;
 tr727:
-#line 426 "src/vcf/vcf.ragel"
+#line 416 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new QualityBodyError{n_lines});
         p--; {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st592;}
     }
 	goto st0;
 tr738:
-#line 432 "src/vcf/vcf.ragel"
+#line 422 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FilterBodyError{n_lines});
         p--; {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st592;}
     }
 	goto st0;
 tr746:
-#line 443 "src/vcf/vcf.ragel"
+#line 433 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info key is not a sequence of alphanumeric and/or punctuation characters"});
         p--; {goto st592;}
     }
-#line 438 "src/vcf/vcf.ragel"
+#line 428 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
         p--; {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st592;}
     }
 	goto st0;
 tr750:
-#line 50 "src/vcf/vcf_v42.ragel"
+#line 52 "src/vcf/vcf_v42.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FormatBodyError{n_lines});
         p--; {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st592;}
     }
 	goto st0;
 tr755:
-#line 461 "src/vcf/vcf.ragel"
+#line 452 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " does not start with a valid genotype";
-        ErrorPolicy::handle_error(*this, new SamplesFieldBodyError{n_lines, message_stream.str(), "", "GT"});
+        ErrorPolicy::handle_error(*this, new SamplesFieldBodyError{n_lines, message_stream.str(), "", "GT", -1,
+                                                                   "Sample does not start with a valid genotype"});
         p--; {goto st592;}
     }
-#line 454 "src/vcf/vcf.ragel"
+#line 444 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " is not a valid string";
-        ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str()});
+        ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str(), "",
+                                                              "Sample is not a valid string"});
         p--; {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st592;}
     }
 	goto st0;
 tr763:
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st592;}
     }
 	goto st0;
 tr765:
-#line 454 "src/vcf/vcf.ragel"
+#line 444 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " is not a valid string";
-        ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str()});
+        ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str(), "",
+                                                              "Sample is not a valid string"});
         p--; {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st592;}
     }
 	goto st0;
 tr771:
-#line 448 "src/vcf/vcf.ragel"
+#line 438 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info field value is not a comma-separated list of valid strings (maybe it contains whitespaces?)"});
         p--; {goto st592;}
     }
-#line 438 "src/vcf/vcf.ragel"
+#line 428 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
         p--; {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st592;}
     }
 	goto st0;
 tr820:
-#line 78 "src/vcf/vcf.ragel"
+#line 73 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st592;}
     }
-#line 396 "src/vcf/vcf.ragel"
+#line 386 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new ChromosomeBodyError{n_lines});
         p--; {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st592;}
     }
 	goto st0;
 tr827:
-#line 438 "src/vcf/vcf.ragel"
+#line 428 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
         p--; {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st592;}
     }
 	goto st0;
-#line 1206 "inc/vcf/validator_detail_v42.hpp"
+#line 1208 "src/vcf/validator_detail_v42.cpp"
 st0:
 cs = 0;
 	goto _out;
@@ -1300,109 +1302,109 @@ case 14:
 tr15:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st15;
 st15:
 	if ( ++p == pe )
 		goto _test_eof15;
 case 15:
-#line 1315 "inc/vcf/validator_detail_v42.hpp"
+#line 1317 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 67 )
 		goto tr16;
 	goto tr14;
 tr16:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st16;
 st16:
 	if ( ++p == pe )
 		goto _test_eof16;
 case 16:
-#line 1329 "inc/vcf/validator_detail_v42.hpp"
+#line 1331 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 70 )
 		goto tr17;
 	goto tr14;
 tr17:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st17;
 st17:
 	if ( ++p == pe )
 		goto _test_eof17;
 case 17:
-#line 1343 "inc/vcf/validator_detail_v42.hpp"
+#line 1345 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 118 )
 		goto tr18;
 	goto tr14;
 tr18:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st18;
 st18:
 	if ( ++p == pe )
 		goto _test_eof18;
 case 18:
-#line 1357 "inc/vcf/validator_detail_v42.hpp"
+#line 1359 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 52 )
 		goto tr19;
 	goto tr14;
 tr19:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st19;
 st19:
 	if ( ++p == pe )
 		goto _test_eof19;
 case 19:
-#line 1371 "inc/vcf/validator_detail_v42.hpp"
+#line 1373 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 46 )
 		goto tr20;
 	goto tr14;
 tr20:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st20;
 st20:
 	if ( ++p == pe )
 		goto _test_eof20;
 case 20:
-#line 1385 "inc/vcf/validator_detail_v42.hpp"
+#line 1387 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 50 )
 		goto tr21;
 	goto tr14;
 tr21:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st21;
 st21:
 	if ( ++p == pe )
 		goto _test_eof21;
 case 21:
-#line 1399 "inc/vcf/validator_detail_v42.hpp"
+#line 1401 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 10: goto tr22;
 		case 13: goto tr23;
 	}
 	goto tr14;
 tr22:
-#line 99 "src/vcf/vcf.ragel"
+#line 93 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_fileformat(*this);
@@ -1413,20 +1415,16 @@ tr22:
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st22;
 st22:
 	if ( ++p == pe )
 		goto _test_eof22;
 case 22:
-#line 1430 "inc/vcf/validator_detail_v42.hpp"
+#line 1428 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 35 )
 		goto st23;
 	goto tr24;
@@ -1462,31 +1460,31 @@ case 24:
 tr30:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st25;
 tr40:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st25;
 st25:
 	if ( ++p == pe )
 		goto _test_eof25;
 case 25:
-#line 1483 "inc/vcf/validator_detail_v42.hpp"
+#line 1481 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 61 )
 		goto tr41;
 	if ( 32 <= (*p) && (*p) <= 126 )
 		goto tr40;
 	goto tr39;
 tr41:
-#line 188 "src/vcf/vcf.ragel"
+#line 182 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this);
     }
@@ -1495,7 +1493,7 @@ st26:
 	if ( ++p == pe )
 		goto _test_eof26;
 case 26:
-#line 1499 "inc/vcf/validator_detail_v42.hpp"
+#line 1497 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto st30;
 		case 60: goto st35;
@@ -1506,24 +1504,24 @@ case 26:
 tr42:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st27;
 tr47:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st27;
 st27:
 	if ( ++p == pe )
 		goto _test_eof27;
 case 27:
-#line 1527 "inc/vcf/validator_detail_v42.hpp"
+#line 1525 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 10: goto tr45;
 		case 13: goto tr46;
@@ -1536,7 +1534,7 @@ tr45:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 196 "src/vcf/vcf.ragel"
+#line 190 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_meta_line(*this);
@@ -1546,17 +1544,13 @@ tr45:
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st28;
 tr55:
-#line 196 "src/vcf/vcf.ragel"
+#line 190 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_meta_line(*this);
@@ -1566,20 +1560,16 @@ tr55:
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st28;
 st28:
 	if ( ++p == pe )
 		goto _test_eof28;
 case 28:
-#line 1583 "inc/vcf/validator_detail_v42.hpp"
+#line 1573 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 35 )
 		goto st23;
 	goto tr26;
@@ -1588,7 +1578,7 @@ tr46:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 196 "src/vcf/vcf.ragel"
+#line 190 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_meta_line(*this);
@@ -1598,17 +1588,13 @@ tr46:
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st29;
 tr56:
-#line 196 "src/vcf/vcf.ragel"
+#line 190 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_meta_line(*this);
@@ -1618,20 +1604,16 @@ tr56:
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st29;
 st29:
 	if ( ++p == pe )
 		goto _test_eof29;
 case 29:
-#line 1635 "inc/vcf/validator_detail_v42.hpp"
+#line 1617 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 10 )
 		goto st28;
 	goto tr39;
@@ -1649,24 +1631,24 @@ case 30:
 tr49:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st31;
 tr52:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st31;
 st31:
 	if ( ++p == pe )
 		goto _test_eof31;
 case 31:
-#line 1670 "inc/vcf/validator_detail_v42.hpp"
+#line 1652 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr53;
 		case 92: goto tr54;
@@ -1677,7 +1659,7 @@ case 31:
 tr50:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -1694,7 +1676,7 @@ st32:
 	if ( ++p == pe )
 		goto _test_eof32;
 case 32:
-#line 1698 "inc/vcf/validator_detail_v42.hpp"
+#line 1680 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -1703,24 +1685,24 @@ case 32:
 tr51:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st33;
 tr54:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st33;
 st33:
 	if ( ++p == pe )
 		goto _test_eof33;
 case 33:
-#line 1724 "inc/vcf/validator_detail_v42.hpp"
+#line 1706 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr57;
 		case 92: goto tr54;
@@ -1731,7 +1713,7 @@ case 33:
 tr57:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -1742,7 +1724,7 @@ st34:
 	if ( ++p == pe )
 		goto _test_eof34;
 case 34:
-#line 1746 "inc/vcf/validator_detail_v42.hpp"
+#line 1728 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -1786,24 +1768,24 @@ case 36:
 tr61:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st37;
 tr64:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st37;
 st37:
 	if ( ++p == pe )
 		goto _test_eof37;
 case 37:
-#line 1807 "inc/vcf/validator_detail_v42.hpp"
+#line 1789 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr65;
 		case 92: goto tr66;
@@ -1814,7 +1796,7 @@ case 37:
 tr62:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -1831,31 +1813,31 @@ st38:
 	if ( ++p == pe )
 		goto _test_eof38;
 case 38:
-#line 1835 "inc/vcf/validator_detail_v42.hpp"
+#line 1817 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 62 )
 		goto st32;
 	goto tr39;
 tr63:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st39;
 tr66:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st39;
 st39:
 	if ( ++p == pe )
 		goto _test_eof39;
 case 39:
-#line 1859 "inc/vcf/validator_detail_v42.hpp"
+#line 1841 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr68;
 		case 92: goto tr66;
@@ -1866,7 +1848,7 @@ case 39:
 tr68:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -1877,7 +1859,7 @@ st40:
 	if ( ++p == pe )
 		goto _test_eof40;
 case 40:
-#line 1881 "inc/vcf/validator_detail_v42.hpp"
+#line 1863 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr65;
 		case 62: goto tr69;
@@ -1889,14 +1871,14 @@ case 40:
 tr69:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st41;
 st41:
 	if ( ++p == pe )
 		goto _test_eof41;
 case 41:
-#line 1900 "inc/vcf/validator_detail_v42.hpp"
+#line 1882 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -1909,14 +1891,14 @@ case 41:
 tr59:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st42;
 st42:
 	if ( ++p == pe )
 		goto _test_eof42;
 case 42:
-#line 1920 "inc/vcf/validator_detail_v42.hpp"
+#line 1902 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 95 )
 		goto st42;
 	if ( (*p) < 48 ) {
@@ -1934,24 +1916,24 @@ case 42:
 tr60:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st43;
 tr71:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st43;
 st43:
 	if ( ++p == pe )
 		goto _test_eof43;
 case 43:
-#line 1955 "inc/vcf/validator_detail_v42.hpp"
+#line 1937 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr72;
 		case 95: goto tr71;
@@ -1969,7 +1951,7 @@ case 43:
 		goto tr71;
 	goto tr39;
 tr72:
-#line 192 "src/vcf/vcf.ragel"
+#line 186 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this);
     }
@@ -1978,7 +1960,7 @@ st44:
 	if ( ++p == pe )
 		goto _test_eof44;
 case 44:
-#line 1982 "inc/vcf/validator_detail_v42.hpp"
+#line 1964 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 34 )
 		goto st63;
 	if ( (*p) < 45 ) {
@@ -1993,24 +1975,24 @@ case 44:
 tr73:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st45;
 tr75:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st45;
 st45:
 	if ( ++p == pe )
 		goto _test_eof45;
 case 45:
-#line 2014 "inc/vcf/validator_detail_v42.hpp"
+#line 1996 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 44: goto tr76;
 		case 62: goto tr53;
@@ -2031,7 +2013,7 @@ st46:
 	if ( ++p == pe )
 		goto _test_eof46;
 case 46:
-#line 2035 "inc/vcf/validator_detail_v42.hpp"
+#line 2017 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 95 )
 		goto tr77;
 	if ( (*p) < 48 ) {
@@ -2049,14 +2031,14 @@ case 46:
 tr77:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st47;
 st47:
 	if ( ++p == pe )
 		goto _test_eof47;
 case 47:
-#line 2060 "inc/vcf/validator_detail_v42.hpp"
+#line 2042 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 95 )
 		goto st47;
 	if ( (*p) < 48 ) {
@@ -2074,24 +2056,24 @@ case 47:
 tr78:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st48;
 tr80:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st48;
 st48:
 	if ( ++p == pe )
 		goto _test_eof48;
 case 48:
-#line 2095 "inc/vcf/validator_detail_v42.hpp"
+#line 2077 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr81;
 		case 95: goto tr80;
@@ -2109,7 +2091,7 @@ case 48:
 		goto tr80;
 	goto tr39;
 tr81:
-#line 192 "src/vcf/vcf.ragel"
+#line 186 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this);
     }
@@ -2118,7 +2100,7 @@ st49:
 	if ( ++p == pe )
 		goto _test_eof49;
 case 49:
-#line 2122 "inc/vcf/validator_detail_v42.hpp"
+#line 2104 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 34 )
 		goto st50;
 	if ( (*p) < 45 ) {
@@ -2144,24 +2126,24 @@ case 50:
 tr83:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st51;
 tr86:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st51;
 st51:
 	if ( ++p == pe )
 		goto _test_eof51;
 case 51:
-#line 2165 "inc/vcf/validator_detail_v42.hpp"
+#line 2147 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 92: goto tr88;
@@ -2172,7 +2154,7 @@ case 51:
 tr84:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -2189,7 +2171,7 @@ st52:
 	if ( ++p == pe )
 		goto _test_eof52;
 case 52:
-#line 2193 "inc/vcf/validator_detail_v42.hpp"
+#line 2175 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 44: goto st46;
 		case 62: goto st32;
@@ -2198,24 +2180,24 @@ case 52:
 tr85:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st53;
 tr88:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st53;
 st53:
 	if ( ++p == pe )
 		goto _test_eof53;
 case 53:
-#line 2219 "inc/vcf/validator_detail_v42.hpp"
+#line 2201 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr90;
 		case 92: goto tr88;
@@ -2226,7 +2208,7 @@ case 53:
 tr90:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -2237,7 +2219,7 @@ st54:
 	if ( ++p == pe )
 		goto _test_eof54;
 case 54:
-#line 2241 "inc/vcf/validator_detail_v42.hpp"
+#line 2223 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 44: goto tr91;
@@ -2250,23 +2232,23 @@ case 54:
 tr105:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st55;
 tr91:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st55;
 tr102:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -2277,7 +2259,7 @@ st55:
 	if ( ++p == pe )
 		goto _test_eof55;
 case 55:
-#line 2281 "inc/vcf/validator_detail_v42.hpp"
+#line 2263 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 47: goto tr86;
@@ -2311,24 +2293,24 @@ case 55:
 tr93:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st56;
 tr95:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st56;
 st56:
 	if ( ++p == pe )
 		goto _test_eof56;
 case 56:
-#line 2332 "inc/vcf/validator_detail_v42.hpp"
+#line 2314 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 47: goto tr86;
@@ -2362,24 +2344,24 @@ case 56:
 tr94:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st57;
 tr96:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st57;
 st57:
 	if ( ++p == pe )
 		goto _test_eof57;
 case 57:
-#line 2383 "inc/vcf/validator_detail_v42.hpp"
+#line 2365 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 47: goto tr86;
@@ -2409,20 +2391,20 @@ case 57:
 		goto tr96;
 	goto tr39;
 tr97:
-#line 192 "src/vcf/vcf.ragel"
+#line 186 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st58;
 st58:
 	if ( ++p == pe )
 		goto _test_eof58;
 case 58:
-#line 2426 "inc/vcf/validator_detail_v42.hpp"
+#line 2408 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr99;
 		case 44: goto tr86;
@@ -2435,24 +2417,24 @@ case 58:
 tr101:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st59;
 tr98:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st59;
 st59:
 	if ( ++p == pe )
 		goto _test_eof59;
 case 59:
-#line 2456 "inc/vcf/validator_detail_v42.hpp"
+#line 2438 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 44: goto tr102;
@@ -2465,23 +2447,23 @@ case 59:
 tr106:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st60;
 tr92:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st60;
 tr103:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -2492,7 +2474,7 @@ st60:
 	if ( ++p == pe )
 		goto _test_eof60;
 case 60:
-#line 2496 "inc/vcf/validator_detail_v42.hpp"
+#line 2478 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -2505,24 +2487,24 @@ case 60:
 tr104:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st61;
 tr100:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st61;
 st61:
 	if ( ++p == pe )
 		goto _test_eof61;
 case 61:
-#line 2526 "inc/vcf/validator_detail_v42.hpp"
+#line 2508 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr90;
 		case 44: goto tr102;
@@ -2542,7 +2524,7 @@ st62:
 	if ( ++p == pe )
 		goto _test_eof62;
 case 62:
-#line 2546 "inc/vcf/validator_detail_v42.hpp"
+#line 2528 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr84;
 		case 44: goto tr105;
@@ -2566,24 +2548,24 @@ case 63:
 tr107:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st64;
 tr109:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st64;
 st64:
 	if ( ++p == pe )
 		goto _test_eof64;
 case 64:
-#line 2587 "inc/vcf/validator_detail_v42.hpp"
+#line 2569 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 92: goto tr110;
@@ -2594,24 +2576,24 @@ case 64:
 tr108:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st65;
 tr110:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st65;
 st65:
 	if ( ++p == pe )
 		goto _test_eof65;
 case 65:
-#line 2615 "inc/vcf/validator_detail_v42.hpp"
+#line 2597 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr111;
 		case 92: goto tr110;
@@ -2622,7 +2604,7 @@ case 65:
 tr111:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -2633,7 +2615,7 @@ st66:
 	if ( ++p == pe )
 		goto _test_eof66;
 case 66:
-#line 2637 "inc/vcf/validator_detail_v42.hpp"
+#line 2619 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 44: goto tr112;
@@ -2646,13 +2628,13 @@ case 66:
 tr112:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st67;
 tr122:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -2663,7 +2645,7 @@ st67:
 	if ( ++p == pe )
 		goto _test_eof67;
 case 67:
-#line 2667 "inc/vcf/validator_detail_v42.hpp"
+#line 2649 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 47: goto tr109;
@@ -2697,24 +2679,24 @@ case 67:
 tr116:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st68;
 tr114:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st68;
 st68:
 	if ( ++p == pe )
 		goto _test_eof68;
 case 68:
-#line 2718 "inc/vcf/validator_detail_v42.hpp"
+#line 2700 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 47: goto tr109;
@@ -2748,24 +2730,24 @@ case 68:
 tr117:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st69;
 tr115:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st69;
 st69:
 	if ( ++p == pe )
 		goto _test_eof69;
 case 69:
-#line 2769 "inc/vcf/validator_detail_v42.hpp"
+#line 2751 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 47: goto tr109;
@@ -2797,9 +2779,9 @@ case 69:
 tr118:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
-#line 192 "src/vcf/vcf.ragel"
+#line 186 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this);
     }
@@ -2808,7 +2790,7 @@ st70:
 	if ( ++p == pe )
 		goto _test_eof70;
 case 70:
-#line 2812 "inc/vcf/validator_detail_v42.hpp"
+#line 2794 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr99;
 		case 44: goto tr109;
@@ -2821,24 +2803,24 @@ case 70:
 tr121:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st71;
 tr119:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st71;
 st71:
 	if ( ++p == pe )
 		goto _test_eof71;
 case 71:
-#line 2842 "inc/vcf/validator_detail_v42.hpp"
+#line 2824 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 44: goto tr122;
@@ -2851,13 +2833,13 @@ case 71:
 tr113:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st72;
 tr123:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -2868,7 +2850,7 @@ st72:
 	if ( ++p == pe )
 		goto _test_eof72;
 case 72:
-#line 2872 "inc/vcf/validator_detail_v42.hpp"
+#line 2854 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -2881,24 +2863,24 @@ case 72:
 tr124:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st73;
 tr120:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st73;
 st73:
 	if ( ++p == pe )
 		goto _test_eof73;
 case 73:
-#line 2902 "inc/vcf/validator_detail_v42.hpp"
+#line 2884 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr111;
 		case 44: goto tr122;
@@ -2911,18 +2893,18 @@ case 73:
 tr31:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st74;
 st74:
 	if ( ++p == pe )
 		goto _test_eof74;
 case 74:
-#line 2926 "inc/vcf/validator_detail_v42.hpp"
+#line 2908 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 76: goto tr126;
@@ -2933,14 +2915,14 @@ case 74:
 tr126:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st75;
 st75:
 	if ( ++p == pe )
 		goto _test_eof75;
 case 75:
-#line 2944 "inc/vcf/validator_detail_v42.hpp"
+#line 2926 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 84: goto st76;
@@ -2958,7 +2940,7 @@ case 76:
 		goto tr40;
 	goto tr125;
 tr128:
-#line 108 "src/vcf/vcf.ragel"
+#line 102 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "ALT");
     }
@@ -2967,7 +2949,7 @@ st77:
 	if ( ++p == pe )
 		goto _test_eof77;
 case 77:
-#line 2971 "inc/vcf/validator_detail_v42.hpp"
+#line 2953 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 60 )
 		goto st78;
 	goto tr125;
@@ -3026,20 +3008,20 @@ case 81:
 		goto tr134;
 	goto tr133;
 tr134:
-#line 144 "src/vcf/vcf.ragel"
+#line 138 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st82;
 st82:
 	if ( ++p == pe )
 		goto _test_eof82;
 case 82:
-#line 3043 "inc/vcf/validator_detail_v42.hpp"
+#line 3025 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 61 )
 		goto st82;
 	if ( (*p) < 63 ) {
@@ -3072,28 +3054,28 @@ case 82:
 tr137:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st83;
 tr135:
-#line 144 "src/vcf/vcf.ragel"
+#line 138 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st83;
 st83:
 	if ( ++p == pe )
 		goto _test_eof83;
 case 83:
-#line 3097 "inc/vcf/validator_detail_v42.hpp"
+#line 3079 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 44: goto tr138;
 		case 61: goto tr137;
@@ -3114,7 +3096,7 @@ st84:
 	if ( ++p == pe )
 		goto _test_eof84;
 case 84:
-#line 3118 "inc/vcf/validator_detail_v42.hpp"
+#line 3100 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 68 )
 		goto st85;
 	goto tr125;
@@ -3203,7 +3185,7 @@ case 96:
 		goto tr151;
 	goto tr125;
 tr151:
-#line 156 "src/vcf/vcf.ragel"
+#line 150 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Description");
     }
@@ -3212,7 +3194,7 @@ st97:
 	if ( ++p == pe )
 		goto _test_eof97;
 case 97:
-#line 3216 "inc/vcf/validator_detail_v42.hpp"
+#line 3198 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr154;
 		case 92: goto tr155;
@@ -3223,24 +3205,24 @@ case 97:
 tr153:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st98;
 tr156:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st98;
 st98:
 	if ( ++p == pe )
 		goto _test_eof98;
 case 98:
-#line 3244 "inc/vcf/validator_detail_v42.hpp"
+#line 3226 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr157;
 		case 92: goto tr158;
@@ -3251,7 +3233,7 @@ case 98:
 tr154:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -3268,7 +3250,7 @@ st99:
 	if ( ++p == pe )
 		goto _test_eof99;
 case 99:
-#line 3272 "inc/vcf/validator_detail_v42.hpp"
+#line 3254 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 44: goto st100;
 		case 62: goto st114;
@@ -3295,14 +3277,14 @@ case 100:
 tr162:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st101;
 st101:
 	if ( ++p == pe )
 		goto _test_eof101;
 case 101:
-#line 3306 "inc/vcf/validator_detail_v42.hpp"
+#line 3288 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 95 )
 		goto st101;
 	if ( (*p) < 48 ) {
@@ -3320,24 +3302,24 @@ case 101:
 tr163:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st102;
 tr165:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st102;
 st102:
 	if ( ++p == pe )
 		goto _test_eof102;
 case 102:
-#line 3341 "inc/vcf/validator_detail_v42.hpp"
+#line 3323 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr166;
 		case 95: goto tr165;
@@ -3364,7 +3346,7 @@ st103:
 	if ( ++p == pe )
 		goto _test_eof103;
 case 103:
-#line 3368 "inc/vcf/validator_detail_v42.hpp"
+#line 3350 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 34 )
 		goto st104;
 	goto tr125;
@@ -3382,24 +3364,24 @@ case 104:
 tr168:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st105;
 tr170:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st105;
 st105:
 	if ( ++p == pe )
 		goto _test_eof105;
 case 105:
-#line 3403 "inc/vcf/validator_detail_v42.hpp"
+#line 3385 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr157;
 		case 92: goto tr171;
@@ -3410,24 +3392,24 @@ case 105:
 tr169:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st106;
 tr171:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st106;
 st106:
 	if ( ++p == pe )
 		goto _test_eof106;
 case 106:
-#line 3431 "inc/vcf/validator_detail_v42.hpp"
+#line 3413 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr172;
 		case 92: goto tr171;
@@ -3438,7 +3420,7 @@ case 106:
 tr172:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -3449,7 +3431,7 @@ st107:
 	if ( ++p == pe )
 		goto _test_eof107;
 case 107:
-#line 3453 "inc/vcf/validator_detail_v42.hpp"
+#line 3435 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr157;
 		case 44: goto tr173;
@@ -3462,24 +3444,24 @@ case 107:
 tr182:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st108;
 tr173:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st108;
 st108:
 	if ( ++p == pe )
 		goto _test_eof108;
 case 108:
-#line 3483 "inc/vcf/validator_detail_v42.hpp"
+#line 3465 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr157;
 		case 47: goto tr170;
@@ -3513,24 +3495,24 @@ case 108:
 tr176:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st109;
 tr178:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st109;
 st109:
 	if ( ++p == pe )
 		goto _test_eof109;
 case 109:
-#line 3534 "inc/vcf/validator_detail_v42.hpp"
+#line 3516 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr157;
 		case 47: goto tr170;
@@ -3564,24 +3546,24 @@ case 109:
 tr177:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st110;
 tr179:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st110;
 st110:
 	if ( ++p == pe )
 		goto _test_eof110;
 case 110:
-#line 3585 "inc/vcf/validator_detail_v42.hpp"
+#line 3567 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr157;
 		case 47: goto tr170;
@@ -3617,14 +3599,14 @@ tr180:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st111;
 st111:
 	if ( ++p == pe )
 		goto _test_eof111;
 case 111:
-#line 3628 "inc/vcf/validator_detail_v42.hpp"
+#line 3610 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr181;
 		case 92: goto tr171;
@@ -3642,7 +3624,7 @@ st112:
 	if ( ++p == pe )
 		goto _test_eof112;
 case 112:
-#line 3646 "inc/vcf/validator_detail_v42.hpp"
+#line 3628 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr154;
 		case 44: goto tr182;
@@ -3655,24 +3637,24 @@ case 112:
 tr183:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st113;
 tr174:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st113;
 st113:
 	if ( ++p == pe )
 		goto _test_eof113;
 case 113:
-#line 3676 "inc/vcf/validator_detail_v42.hpp"
+#line 3658 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -3694,24 +3676,24 @@ case 114:
 tr155:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st115;
 tr158:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st115;
 st115:
 	if ( ++p == pe )
 		goto _test_eof115;
 case 115:
-#line 3715 "inc/vcf/validator_detail_v42.hpp"
+#line 3697 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr184;
 		case 92: goto tr158;
@@ -3722,7 +3704,7 @@ case 115:
 tr184:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -3733,7 +3715,7 @@ st116:
 	if ( ++p == pe )
 		goto _test_eof116;
 case 116:
-#line 3737 "inc/vcf/validator_detail_v42.hpp"
+#line 3719 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr157;
 		case 44: goto tr185;
@@ -3746,14 +3728,14 @@ case 116:
 tr185:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st117;
 st117:
 	if ( ++p == pe )
 		goto _test_eof117;
 case 117:
-#line 3757 "inc/vcf/validator_detail_v42.hpp"
+#line 3739 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr157;
 		case 47: goto tr156;
@@ -3787,24 +3769,24 @@ case 117:
 tr190:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st118;
 tr188:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st118;
 st118:
 	if ( ++p == pe )
 		goto _test_eof118;
 case 118:
-#line 3808 "inc/vcf/validator_detail_v42.hpp"
+#line 3790 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr157;
 		case 47: goto tr156;
@@ -3838,24 +3820,24 @@ case 118:
 tr191:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st119;
 tr189:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st119;
 st119:
 	if ( ++p == pe )
 		goto _test_eof119;
 case 119:
-#line 3859 "inc/vcf/validator_detail_v42.hpp"
+#line 3841 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr157;
 		case 47: goto tr156;
@@ -3887,7 +3869,7 @@ case 119:
 tr192:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -3898,7 +3880,7 @@ st120:
 	if ( ++p == pe )
 		goto _test_eof120;
 case 120:
-#line 3902 "inc/vcf/validator_detail_v42.hpp"
+#line 3884 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr181;
 		case 92: goto tr158;
@@ -3909,14 +3891,14 @@ case 120:
 tr186:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st121;
 st121:
 	if ( ++p == pe )
 		goto _test_eof121;
 case 121:
-#line 3920 "inc/vcf/validator_detail_v42.hpp"
+#line 3902 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -3929,18 +3911,18 @@ case 121:
 tr32:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st122;
 st122:
 	if ( ++p == pe )
 		goto _test_eof122;
 case 122:
-#line 3944 "inc/vcf/validator_detail_v42.hpp"
+#line 3926 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 73: goto tr194;
@@ -3952,14 +3934,14 @@ case 122:
 tr194:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st123;
 st123:
 	if ( ++p == pe )
 		goto _test_eof123;
 case 123:
-#line 3963 "inc/vcf/validator_detail_v42.hpp"
+#line 3945 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 76: goto tr197;
@@ -3970,14 +3952,14 @@ case 123:
 tr197:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st124;
 st124:
 	if ( ++p == pe )
 		goto _test_eof124;
 case 124:
-#line 3981 "inc/vcf/validator_detail_v42.hpp"
+#line 3963 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 84: goto tr198;
@@ -3988,14 +3970,14 @@ case 124:
 tr198:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st125;
 st125:
 	if ( ++p == pe )
 		goto _test_eof125;
 case 125:
-#line 3999 "inc/vcf/validator_detail_v42.hpp"
+#line 3981 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 69: goto tr199;
@@ -4006,14 +3988,14 @@ case 125:
 tr199:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st126;
 st126:
 	if ( ++p == pe )
 		goto _test_eof126;
 case 126:
-#line 4017 "inc/vcf/validator_detail_v42.hpp"
+#line 3999 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 82: goto st127;
@@ -4031,7 +4013,7 @@ case 127:
 		goto tr40;
 	goto tr196;
 tr201:
-#line 120 "src/vcf/vcf.ragel"
+#line 114 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "FILTER");
     }
@@ -4040,7 +4022,7 @@ st128:
 	if ( ++p == pe )
 		goto _test_eof128;
 case 128:
-#line 4044 "inc/vcf/validator_detail_v42.hpp"
+#line 4026 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 60 )
 		goto st129;
 	goto tr196;
@@ -4084,20 +4066,20 @@ case 132:
 		goto tr208;
 	goto tr206;
 tr207:
-#line 144 "src/vcf/vcf.ragel"
+#line 138 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st133;
 st133:
 	if ( ++p == pe )
 		goto _test_eof133;
 case 133:
-#line 4101 "inc/vcf/validator_detail_v42.hpp"
+#line 4083 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 95 )
 		goto st133;
 	if ( (*p) < 48 ) {
@@ -4115,28 +4097,28 @@ case 133:
 tr210:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st134;
 tr208:
-#line 144 "src/vcf/vcf.ragel"
+#line 138 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st134;
 st134:
 	if ( ++p == pe )
 		goto _test_eof134;
 case 134:
-#line 4140 "inc/vcf/validator_detail_v42.hpp"
+#line 4122 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 44: goto tr211;
 		case 95: goto tr210;
@@ -4163,7 +4145,7 @@ st135:
 	if ( ++p == pe )
 		goto _test_eof135;
 case 135:
-#line 4167 "inc/vcf/validator_detail_v42.hpp"
+#line 4149 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 68 )
 		goto st136;
 	goto tr196;
@@ -4252,7 +4234,7 @@ case 147:
 		goto tr224;
 	goto tr196;
 tr224:
-#line 156 "src/vcf/vcf.ragel"
+#line 150 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Description");
     }
@@ -4261,7 +4243,7 @@ st148:
 	if ( ++p == pe )
 		goto _test_eof148;
 case 148:
-#line 4265 "inc/vcf/validator_detail_v42.hpp"
+#line 4247 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr227;
 		case 92: goto tr228;
@@ -4272,24 +4254,24 @@ case 148:
 tr226:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st149;
 tr229:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st149;
 st149:
 	if ( ++p == pe )
 		goto _test_eof149;
 case 149:
-#line 4293 "inc/vcf/validator_detail_v42.hpp"
+#line 4275 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr230;
 		case 92: goto tr231;
@@ -4300,7 +4282,7 @@ case 149:
 tr227:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -4317,7 +4299,7 @@ st150:
 	if ( ++p == pe )
 		goto _test_eof150;
 case 150:
-#line 4321 "inc/vcf/validator_detail_v42.hpp"
+#line 4303 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 44: goto st151;
 		case 62: goto st165;
@@ -4344,14 +4326,14 @@ case 151:
 tr234:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st152;
 st152:
 	if ( ++p == pe )
 		goto _test_eof152;
 case 152:
-#line 4355 "inc/vcf/validator_detail_v42.hpp"
+#line 4337 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 95 )
 		goto st152;
 	if ( (*p) < 48 ) {
@@ -4369,24 +4351,24 @@ case 152:
 tr235:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st153;
 tr237:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st153;
 st153:
 	if ( ++p == pe )
 		goto _test_eof153;
 case 153:
-#line 4390 "inc/vcf/validator_detail_v42.hpp"
+#line 4372 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr238;
 		case 95: goto tr237;
@@ -4413,7 +4395,7 @@ st154:
 	if ( ++p == pe )
 		goto _test_eof154;
 case 154:
-#line 4417 "inc/vcf/validator_detail_v42.hpp"
+#line 4399 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 34 )
 		goto st155;
 	goto tr196;
@@ -4431,24 +4413,24 @@ case 155:
 tr240:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st156;
 tr242:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st156;
 st156:
 	if ( ++p == pe )
 		goto _test_eof156;
 case 156:
-#line 4452 "inc/vcf/validator_detail_v42.hpp"
+#line 4434 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr230;
 		case 92: goto tr243;
@@ -4459,24 +4441,24 @@ case 156:
 tr241:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st157;
 tr243:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st157;
 st157:
 	if ( ++p == pe )
 		goto _test_eof157;
 case 157:
-#line 4480 "inc/vcf/validator_detail_v42.hpp"
+#line 4462 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr244;
 		case 92: goto tr243;
@@ -4487,7 +4469,7 @@ case 157:
 tr244:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -4498,7 +4480,7 @@ st158:
 	if ( ++p == pe )
 		goto _test_eof158;
 case 158:
-#line 4502 "inc/vcf/validator_detail_v42.hpp"
+#line 4484 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr230;
 		case 44: goto tr245;
@@ -4511,24 +4493,24 @@ case 158:
 tr254:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st159;
 tr245:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st159;
 st159:
 	if ( ++p == pe )
 		goto _test_eof159;
 case 159:
-#line 4532 "inc/vcf/validator_detail_v42.hpp"
+#line 4514 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr230;
 		case 47: goto tr242;
@@ -4562,24 +4544,24 @@ case 159:
 tr248:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st160;
 tr250:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st160;
 st160:
 	if ( ++p == pe )
 		goto _test_eof160;
 case 160:
-#line 4583 "inc/vcf/validator_detail_v42.hpp"
+#line 4565 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr230;
 		case 47: goto tr242;
@@ -4613,24 +4595,24 @@ case 160:
 tr249:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st161;
 tr251:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st161;
 st161:
 	if ( ++p == pe )
 		goto _test_eof161;
 case 161:
-#line 4634 "inc/vcf/validator_detail_v42.hpp"
+#line 4616 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr230;
 		case 47: goto tr242;
@@ -4666,14 +4648,14 @@ tr252:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st162;
 st162:
 	if ( ++p == pe )
 		goto _test_eof162;
 case 162:
-#line 4677 "inc/vcf/validator_detail_v42.hpp"
+#line 4659 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr253;
 		case 92: goto tr243;
@@ -4691,7 +4673,7 @@ st163:
 	if ( ++p == pe )
 		goto _test_eof163;
 case 163:
-#line 4695 "inc/vcf/validator_detail_v42.hpp"
+#line 4677 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr227;
 		case 44: goto tr254;
@@ -4704,24 +4686,24 @@ case 163:
 tr255:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st164;
 tr246:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st164;
 st164:
 	if ( ++p == pe )
 		goto _test_eof164;
 case 164:
-#line 4725 "inc/vcf/validator_detail_v42.hpp"
+#line 4707 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -4743,24 +4725,24 @@ case 165:
 tr228:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st166;
 tr231:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st166;
 st166:
 	if ( ++p == pe )
 		goto _test_eof166;
 case 166:
-#line 4764 "inc/vcf/validator_detail_v42.hpp"
+#line 4746 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr256;
 		case 92: goto tr231;
@@ -4771,7 +4753,7 @@ case 166:
 tr256:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -4782,7 +4764,7 @@ st167:
 	if ( ++p == pe )
 		goto _test_eof167;
 case 167:
-#line 4786 "inc/vcf/validator_detail_v42.hpp"
+#line 4768 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr230;
 		case 44: goto tr257;
@@ -4795,14 +4777,14 @@ case 167:
 tr257:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st168;
 st168:
 	if ( ++p == pe )
 		goto _test_eof168;
 case 168:
-#line 4806 "inc/vcf/validator_detail_v42.hpp"
+#line 4788 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr230;
 		case 47: goto tr229;
@@ -4836,24 +4818,24 @@ case 168:
 tr262:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st169;
 tr260:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st169;
 st169:
 	if ( ++p == pe )
 		goto _test_eof169;
 case 169:
-#line 4857 "inc/vcf/validator_detail_v42.hpp"
+#line 4839 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr230;
 		case 47: goto tr229;
@@ -4887,24 +4869,24 @@ case 169:
 tr263:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st170;
 tr261:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st170;
 st170:
 	if ( ++p == pe )
 		goto _test_eof170;
 case 170:
-#line 4908 "inc/vcf/validator_detail_v42.hpp"
+#line 4890 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr230;
 		case 47: goto tr229;
@@ -4936,7 +4918,7 @@ case 170:
 tr264:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -4947,7 +4929,7 @@ st171:
 	if ( ++p == pe )
 		goto _test_eof171;
 case 171:
-#line 4951 "inc/vcf/validator_detail_v42.hpp"
+#line 4933 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr253;
 		case 92: goto tr231;
@@ -4958,14 +4940,14 @@ case 171:
 tr258:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st172;
 st172:
 	if ( ++p == pe )
 		goto _test_eof172;
 case 172:
-#line 4969 "inc/vcf/validator_detail_v42.hpp"
+#line 4951 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -4978,14 +4960,14 @@ case 172:
 tr195:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st173;
 st173:
 	if ( ++p == pe )
 		goto _test_eof173;
 case 173:
-#line 4989 "inc/vcf/validator_detail_v42.hpp"
+#line 4971 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 82: goto tr266;
@@ -4996,14 +4978,14 @@ case 173:
 tr266:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st174;
 st174:
 	if ( ++p == pe )
 		goto _test_eof174;
 case 174:
-#line 5007 "inc/vcf/validator_detail_v42.hpp"
+#line 4989 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 77: goto tr267;
@@ -5014,14 +4996,14 @@ case 174:
 tr267:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st175;
 st175:
 	if ( ++p == pe )
 		goto _test_eof175;
 case 175:
-#line 5025 "inc/vcf/validator_detail_v42.hpp"
+#line 5007 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 65: goto tr268;
@@ -5032,14 +5014,14 @@ case 175:
 tr268:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st176;
 st176:
 	if ( ++p == pe )
 		goto _test_eof176;
 case 176:
-#line 5043 "inc/vcf/validator_detail_v42.hpp"
+#line 5025 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 84: goto st177;
@@ -5057,7 +5039,7 @@ case 177:
 		goto tr40;
 	goto tr265;
 tr270:
-#line 124 "src/vcf/vcf.ragel"
+#line 118 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "FORMAT");
     }
@@ -5066,7 +5048,7 @@ st178:
 	if ( ++p == pe )
 		goto _test_eof178;
 case 178:
-#line 5070 "inc/vcf/validator_detail_v42.hpp"
+#line 5052 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 60 )
 		goto st179;
 	goto tr265;
@@ -5110,20 +5092,20 @@ case 182:
 		goto tr277;
 	goto tr275;
 tr276:
-#line 144 "src/vcf/vcf.ragel"
+#line 138 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st183;
 st183:
 	if ( ++p == pe )
 		goto _test_eof183;
 case 183:
-#line 5127 "inc/vcf/validator_detail_v42.hpp"
+#line 5109 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 95 )
 		goto st183;
 	if ( (*p) < 48 ) {
@@ -5141,28 +5123,28 @@ case 183:
 tr279:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st184;
 tr277:
-#line 144 "src/vcf/vcf.ragel"
+#line 138 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st184;
 st184:
 	if ( ++p == pe )
 		goto _test_eof184;
 case 184:
-#line 5166 "inc/vcf/validator_detail_v42.hpp"
+#line 5148 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 44: goto tr280;
 		case 95: goto tr279;
@@ -5189,7 +5171,7 @@ st185:
 	if ( ++p == pe )
 		goto _test_eof185;
 case 185:
-#line 5193 "inc/vcf/validator_detail_v42.hpp"
+#line 5175 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 78 )
 		goto st186;
 	goto tr265;
@@ -5249,24 +5231,24 @@ case 192:
 		goto tr290;
 	goto tr288;
 tr289:
-#line 148 "src/vcf/vcf.ragel"
+#line 142 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Number");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st193;
 st193:
 	if ( ++p == pe )
 		goto _test_eof193;
 case 193:
-#line 5270 "inc/vcf/validator_detail_v42.hpp"
+#line 5252 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 44 )
 		goto tr291;
 	goto tr288;
@@ -5280,7 +5262,7 @@ st194:
 	if ( ++p == pe )
 		goto _test_eof194;
 case 194:
-#line 5284 "inc/vcf/validator_detail_v42.hpp"
+#line 5266 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 84 )
 		goto st195;
 	goto tr265;
@@ -5325,28 +5307,28 @@ case 199:
 tr300:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st200;
 tr298:
-#line 152 "src/vcf/vcf.ragel"
+#line 146 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Type");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st200;
 st200:
 	if ( ++p == pe )
 		goto _test_eof200;
 case 200:
-#line 5350 "inc/vcf/validator_detail_v42.hpp"
+#line 5332 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 44 )
 		goto tr299;
 	if ( (*p) > 90 ) {
@@ -5365,7 +5347,7 @@ st201:
 	if ( ++p == pe )
 		goto _test_eof201;
 case 201:
-#line 5369 "inc/vcf/validator_detail_v42.hpp"
+#line 5351 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 68 )
 		goto st202;
 	goto tr265;
@@ -5454,7 +5436,7 @@ case 213:
 		goto tr313;
 	goto tr265;
 tr313:
-#line 156 "src/vcf/vcf.ragel"
+#line 150 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Description");
     }
@@ -5463,7 +5445,7 @@ st214:
 	if ( ++p == pe )
 		goto _test_eof214;
 case 214:
-#line 5467 "inc/vcf/validator_detail_v42.hpp"
+#line 5449 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr316;
 		case 92: goto tr317;
@@ -5474,24 +5456,24 @@ case 214:
 tr315:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st215;
 tr318:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st215;
 st215:
 	if ( ++p == pe )
 		goto _test_eof215;
 case 215:
-#line 5495 "inc/vcf/validator_detail_v42.hpp"
+#line 5477 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr319;
 		case 92: goto tr320;
@@ -5502,7 +5484,7 @@ case 215:
 tr316:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -5519,7 +5501,7 @@ st216:
 	if ( ++p == pe )
 		goto _test_eof216;
 case 216:
-#line 5523 "inc/vcf/validator_detail_v42.hpp"
+#line 5505 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 44: goto st217;
 		case 62: goto st231;
@@ -5546,14 +5528,14 @@ case 217:
 tr323:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st218;
 st218:
 	if ( ++p == pe )
 		goto _test_eof218;
 case 218:
-#line 5557 "inc/vcf/validator_detail_v42.hpp"
+#line 5539 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 95 )
 		goto st218;
 	if ( (*p) < 48 ) {
@@ -5571,24 +5553,24 @@ case 218:
 tr324:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st219;
 tr326:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st219;
 st219:
 	if ( ++p == pe )
 		goto _test_eof219;
 case 219:
-#line 5592 "inc/vcf/validator_detail_v42.hpp"
+#line 5574 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr327;
 		case 95: goto tr326;
@@ -5615,7 +5597,7 @@ st220:
 	if ( ++p == pe )
 		goto _test_eof220;
 case 220:
-#line 5619 "inc/vcf/validator_detail_v42.hpp"
+#line 5601 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 34 )
 		goto st221;
 	goto tr265;
@@ -5633,24 +5615,24 @@ case 221:
 tr329:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st222;
 tr331:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st222;
 st222:
 	if ( ++p == pe )
 		goto _test_eof222;
 case 222:
-#line 5654 "inc/vcf/validator_detail_v42.hpp"
+#line 5636 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr319;
 		case 92: goto tr332;
@@ -5661,24 +5643,24 @@ case 222:
 tr330:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st223;
 tr332:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st223;
 st223:
 	if ( ++p == pe )
 		goto _test_eof223;
 case 223:
-#line 5682 "inc/vcf/validator_detail_v42.hpp"
+#line 5664 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr333;
 		case 92: goto tr332;
@@ -5689,7 +5671,7 @@ case 223:
 tr333:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -5700,7 +5682,7 @@ st224:
 	if ( ++p == pe )
 		goto _test_eof224;
 case 224:
-#line 5704 "inc/vcf/validator_detail_v42.hpp"
+#line 5686 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr319;
 		case 44: goto tr334;
@@ -5713,24 +5695,24 @@ case 224:
 tr343:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st225;
 tr334:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st225;
 st225:
 	if ( ++p == pe )
 		goto _test_eof225;
 case 225:
-#line 5734 "inc/vcf/validator_detail_v42.hpp"
+#line 5716 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr319;
 		case 47: goto tr331;
@@ -5764,24 +5746,24 @@ case 225:
 tr337:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st226;
 tr339:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st226;
 st226:
 	if ( ++p == pe )
 		goto _test_eof226;
 case 226:
-#line 5785 "inc/vcf/validator_detail_v42.hpp"
+#line 5767 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr319;
 		case 47: goto tr331;
@@ -5815,24 +5797,24 @@ case 226:
 tr338:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st227;
 tr340:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st227;
 st227:
 	if ( ++p == pe )
 		goto _test_eof227;
 case 227:
-#line 5836 "inc/vcf/validator_detail_v42.hpp"
+#line 5818 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr319;
 		case 47: goto tr331;
@@ -5868,14 +5850,14 @@ tr341:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st228;
 st228:
 	if ( ++p == pe )
 		goto _test_eof228;
 case 228:
-#line 5879 "inc/vcf/validator_detail_v42.hpp"
+#line 5861 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr342;
 		case 92: goto tr332;
@@ -5893,7 +5875,7 @@ st229:
 	if ( ++p == pe )
 		goto _test_eof229;
 case 229:
-#line 5897 "inc/vcf/validator_detail_v42.hpp"
+#line 5879 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr316;
 		case 44: goto tr343;
@@ -5906,24 +5888,24 @@ case 229:
 tr344:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st230;
 tr335:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st230;
 st230:
 	if ( ++p == pe )
 		goto _test_eof230;
 case 230:
-#line 5927 "inc/vcf/validator_detail_v42.hpp"
+#line 5909 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -5945,24 +5927,24 @@ case 231:
 tr317:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st232;
 tr320:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st232;
 st232:
 	if ( ++p == pe )
 		goto _test_eof232;
 case 232:
-#line 5966 "inc/vcf/validator_detail_v42.hpp"
+#line 5948 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr345;
 		case 92: goto tr320;
@@ -5973,7 +5955,7 @@ case 232:
 tr345:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -5984,7 +5966,7 @@ st233:
 	if ( ++p == pe )
 		goto _test_eof233;
 case 233:
-#line 5988 "inc/vcf/validator_detail_v42.hpp"
+#line 5970 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr319;
 		case 44: goto tr346;
@@ -5997,14 +5979,14 @@ case 233:
 tr346:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st234;
 st234:
 	if ( ++p == pe )
 		goto _test_eof234;
 case 234:
-#line 6008 "inc/vcf/validator_detail_v42.hpp"
+#line 5990 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr319;
 		case 47: goto tr318;
@@ -6038,24 +6020,24 @@ case 234:
 tr351:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st235;
 tr349:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st235;
 st235:
 	if ( ++p == pe )
 		goto _test_eof235;
 case 235:
-#line 6059 "inc/vcf/validator_detail_v42.hpp"
+#line 6041 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr319;
 		case 47: goto tr318;
@@ -6089,24 +6071,24 @@ case 235:
 tr352:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st236;
 tr350:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st236;
 st236:
 	if ( ++p == pe )
 		goto _test_eof236;
 case 236:
-#line 6110 "inc/vcf/validator_detail_v42.hpp"
+#line 6092 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr319;
 		case 47: goto tr318;
@@ -6138,7 +6120,7 @@ case 236:
 tr353:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -6149,7 +6131,7 @@ st237:
 	if ( ++p == pe )
 		goto _test_eof237;
 case 237:
-#line 6153 "inc/vcf/validator_detail_v42.hpp"
+#line 6135 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr342;
 		case 92: goto tr320;
@@ -6160,14 +6142,14 @@ case 237:
 tr347:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st238;
 st238:
 	if ( ++p == pe )
 		goto _test_eof238;
 case 238:
-#line 6171 "inc/vcf/validator_detail_v42.hpp"
+#line 6153 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -6180,28 +6162,28 @@ case 238:
 tr354:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st239;
 tr290:
-#line 148 "src/vcf/vcf.ragel"
+#line 142 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Number");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st239;
 st239:
 	if ( ++p == pe )
 		goto _test_eof239;
 case 239:
-#line 6205 "inc/vcf/validator_detail_v42.hpp"
+#line 6187 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 44 )
 		goto tr291;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -6210,18 +6192,18 @@ case 239:
 tr33:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st240;
 st240:
 	if ( ++p == pe )
 		goto _test_eof240;
 case 240:
-#line 6225 "inc/vcf/validator_detail_v42.hpp"
+#line 6207 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 78: goto tr356;
@@ -6232,14 +6214,14 @@ case 240:
 tr356:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st241;
 st241:
 	if ( ++p == pe )
 		goto _test_eof241;
 case 241:
-#line 6243 "inc/vcf/validator_detail_v42.hpp"
+#line 6225 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 70: goto tr357;
@@ -6250,14 +6232,14 @@ case 241:
 tr357:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st242;
 st242:
 	if ( ++p == pe )
 		goto _test_eof242;
 case 242:
-#line 6261 "inc/vcf/validator_detail_v42.hpp"
+#line 6243 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 79: goto st243;
@@ -6275,7 +6257,7 @@ case 243:
 		goto tr40;
 	goto tr355;
 tr359:
-#line 128 "src/vcf/vcf.ragel"
+#line 122 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "INFO");
     }
@@ -6284,7 +6266,7 @@ st244:
 	if ( ++p == pe )
 		goto _test_eof244;
 case 244:
-#line 6288 "inc/vcf/validator_detail_v42.hpp"
+#line 6270 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 60 )
 		goto st245;
 	goto tr355;
@@ -6328,20 +6310,20 @@ case 248:
 		goto tr366;
 	goto tr364;
 tr365:
-#line 144 "src/vcf/vcf.ragel"
+#line 138 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st249;
 st249:
 	if ( ++p == pe )
 		goto _test_eof249;
 case 249:
-#line 6345 "inc/vcf/validator_detail_v42.hpp"
+#line 6327 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 95 )
 		goto st249;
 	if ( (*p) < 48 ) {
@@ -6359,28 +6341,28 @@ case 249:
 tr368:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st250;
 tr366:
-#line 144 "src/vcf/vcf.ragel"
+#line 138 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st250;
 st250:
 	if ( ++p == pe )
 		goto _test_eof250;
 case 250:
-#line 6384 "inc/vcf/validator_detail_v42.hpp"
+#line 6366 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 44: goto tr369;
 		case 95: goto tr368;
@@ -6407,7 +6389,7 @@ st251:
 	if ( ++p == pe )
 		goto _test_eof251;
 case 251:
-#line 6411 "inc/vcf/validator_detail_v42.hpp"
+#line 6393 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 78 )
 		goto st252;
 	goto tr355;
@@ -6467,24 +6449,24 @@ case 258:
 		goto tr379;
 	goto tr377;
 tr378:
-#line 148 "src/vcf/vcf.ragel"
+#line 142 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Number");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st259;
 st259:
 	if ( ++p == pe )
 		goto _test_eof259;
 case 259:
-#line 6488 "inc/vcf/validator_detail_v42.hpp"
+#line 6470 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 44 )
 		goto tr380;
 	goto tr377;
@@ -6498,7 +6480,7 @@ st260:
 	if ( ++p == pe )
 		goto _test_eof260;
 case 260:
-#line 6502 "inc/vcf/validator_detail_v42.hpp"
+#line 6484 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 84 )
 		goto st261;
 	goto tr355;
@@ -6543,28 +6525,28 @@ case 265:
 tr389:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st266;
 tr387:
-#line 152 "src/vcf/vcf.ragel"
+#line 146 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Type");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st266;
 st266:
 	if ( ++p == pe )
 		goto _test_eof266;
 case 266:
-#line 6568 "inc/vcf/validator_detail_v42.hpp"
+#line 6550 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 44 )
 		goto tr388;
 	if ( (*p) > 90 ) {
@@ -6583,7 +6565,7 @@ st267:
 	if ( ++p == pe )
 		goto _test_eof267;
 case 267:
-#line 6587 "inc/vcf/validator_detail_v42.hpp"
+#line 6569 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 68 )
 		goto st268;
 	goto tr355;
@@ -6672,7 +6654,7 @@ case 279:
 		goto tr402;
 	goto tr355;
 tr402:
-#line 156 "src/vcf/vcf.ragel"
+#line 150 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Description");
     }
@@ -6681,7 +6663,7 @@ st280:
 	if ( ++p == pe )
 		goto _test_eof280;
 case 280:
-#line 6685 "inc/vcf/validator_detail_v42.hpp"
+#line 6667 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr405;
 		case 92: goto tr406;
@@ -6692,24 +6674,24 @@ case 280:
 tr404:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st281;
 tr407:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st281;
 st281:
 	if ( ++p == pe )
 		goto _test_eof281;
 case 281:
-#line 6713 "inc/vcf/validator_detail_v42.hpp"
+#line 6695 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr408;
 		case 92: goto tr409;
@@ -6720,7 +6702,7 @@ case 281:
 tr405:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -6737,7 +6719,7 @@ st282:
 	if ( ++p == pe )
 		goto _test_eof282;
 case 282:
-#line 6741 "inc/vcf/validator_detail_v42.hpp"
+#line 6723 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 44: goto st283;
 		case 62: goto st297;
@@ -6764,14 +6746,14 @@ case 283:
 tr412:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st284;
 st284:
 	if ( ++p == pe )
 		goto _test_eof284;
 case 284:
-#line 6775 "inc/vcf/validator_detail_v42.hpp"
+#line 6757 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 95 )
 		goto st284;
 	if ( (*p) < 48 ) {
@@ -6789,24 +6771,24 @@ case 284:
 tr413:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st285;
 tr415:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st285;
 st285:
 	if ( ++p == pe )
 		goto _test_eof285;
 case 285:
-#line 6810 "inc/vcf/validator_detail_v42.hpp"
+#line 6792 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr416;
 		case 95: goto tr415;
@@ -6833,7 +6815,7 @@ st286:
 	if ( ++p == pe )
 		goto _test_eof286;
 case 286:
-#line 6837 "inc/vcf/validator_detail_v42.hpp"
+#line 6819 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 34 )
 		goto st287;
 	goto tr355;
@@ -6851,24 +6833,24 @@ case 287:
 tr418:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st288;
 tr420:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st288;
 st288:
 	if ( ++p == pe )
 		goto _test_eof288;
 case 288:
-#line 6872 "inc/vcf/validator_detail_v42.hpp"
+#line 6854 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr408;
 		case 92: goto tr421;
@@ -6879,24 +6861,24 @@ case 288:
 tr419:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st289;
 tr421:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st289;
 st289:
 	if ( ++p == pe )
 		goto _test_eof289;
 case 289:
-#line 6900 "inc/vcf/validator_detail_v42.hpp"
+#line 6882 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr422;
 		case 92: goto tr421;
@@ -6907,7 +6889,7 @@ case 289:
 tr422:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -6918,7 +6900,7 @@ st290:
 	if ( ++p == pe )
 		goto _test_eof290;
 case 290:
-#line 6922 "inc/vcf/validator_detail_v42.hpp"
+#line 6904 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr408;
 		case 44: goto tr423;
@@ -6931,24 +6913,24 @@ case 290:
 tr432:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st291;
 tr423:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st291;
 st291:
 	if ( ++p == pe )
 		goto _test_eof291;
 case 291:
-#line 6952 "inc/vcf/validator_detail_v42.hpp"
+#line 6934 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr408;
 		case 47: goto tr420;
@@ -6982,24 +6964,24 @@ case 291:
 tr426:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st292;
 tr428:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st292;
 st292:
 	if ( ++p == pe )
 		goto _test_eof292;
 case 292:
-#line 7003 "inc/vcf/validator_detail_v42.hpp"
+#line 6985 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr408;
 		case 47: goto tr420;
@@ -7033,24 +7015,24 @@ case 292:
 tr427:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st293;
 tr429:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st293;
 st293:
 	if ( ++p == pe )
 		goto _test_eof293;
 case 293:
-#line 7054 "inc/vcf/validator_detail_v42.hpp"
+#line 7036 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr408;
 		case 47: goto tr420;
@@ -7086,14 +7068,14 @@ tr430:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st294;
 st294:
 	if ( ++p == pe )
 		goto _test_eof294;
 case 294:
-#line 7097 "inc/vcf/validator_detail_v42.hpp"
+#line 7079 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr431;
 		case 92: goto tr421;
@@ -7111,7 +7093,7 @@ st295:
 	if ( ++p == pe )
 		goto _test_eof295;
 case 295:
-#line 7115 "inc/vcf/validator_detail_v42.hpp"
+#line 7097 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr405;
 		case 44: goto tr432;
@@ -7124,24 +7106,24 @@ case 295:
 tr433:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st296;
 tr424:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st296;
 st296:
 	if ( ++p == pe )
 		goto _test_eof296;
 case 296:
-#line 7145 "inc/vcf/validator_detail_v42.hpp"
+#line 7127 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -7163,24 +7145,24 @@ case 297:
 tr406:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st298;
 tr409:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st298;
 st298:
 	if ( ++p == pe )
 		goto _test_eof298;
 case 298:
-#line 7184 "inc/vcf/validator_detail_v42.hpp"
+#line 7166 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr434;
 		case 92: goto tr409;
@@ -7191,7 +7173,7 @@ case 298:
 tr434:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -7202,7 +7184,7 @@ st299:
 	if ( ++p == pe )
 		goto _test_eof299;
 case 299:
-#line 7206 "inc/vcf/validator_detail_v42.hpp"
+#line 7188 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr408;
 		case 44: goto tr435;
@@ -7215,14 +7197,14 @@ case 299:
 tr435:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st300;
 st300:
 	if ( ++p == pe )
 		goto _test_eof300;
 case 300:
-#line 7226 "inc/vcf/validator_detail_v42.hpp"
+#line 7208 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr408;
 		case 47: goto tr407;
@@ -7256,24 +7238,24 @@ case 300:
 tr440:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st301;
 tr438:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st301;
 st301:
 	if ( ++p == pe )
 		goto _test_eof301;
 case 301:
-#line 7277 "inc/vcf/validator_detail_v42.hpp"
+#line 7259 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr408;
 		case 47: goto tr407;
@@ -7307,24 +7289,24 @@ case 301:
 tr441:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st302;
 tr439:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st302;
 st302:
 	if ( ++p == pe )
 		goto _test_eof302;
 case 302:
-#line 7328 "inc/vcf/validator_detail_v42.hpp"
+#line 7310 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr408;
 		case 47: goto tr407;
@@ -7356,7 +7338,7 @@ case 302:
 tr442:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -7367,7 +7349,7 @@ st303:
 	if ( ++p == pe )
 		goto _test_eof303;
 case 303:
-#line 7371 "inc/vcf/validator_detail_v42.hpp"
+#line 7353 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr431;
 		case 92: goto tr409;
@@ -7378,14 +7360,14 @@ case 303:
 tr436:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st304;
 st304:
 	if ( ++p == pe )
 		goto _test_eof304;
 case 304:
-#line 7389 "inc/vcf/validator_detail_v42.hpp"
+#line 7371 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -7398,28 +7380,28 @@ case 304:
 tr443:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st305;
 tr379:
-#line 148 "src/vcf/vcf.ragel"
+#line 142 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Number");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st305;
 st305:
 	if ( ++p == pe )
 		goto _test_eof305;
 case 305:
-#line 7423 "inc/vcf/validator_detail_v42.hpp"
+#line 7405 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 44 )
 		goto tr380;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -7428,18 +7410,18 @@ case 305:
 tr34:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st306;
 st306:
 	if ( ++p == pe )
 		goto _test_eof306;
 case 306:
-#line 7443 "inc/vcf/validator_detail_v42.hpp"
+#line 7425 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 69: goto tr445;
@@ -7450,14 +7432,14 @@ case 306:
 tr445:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st307;
 st307:
 	if ( ++p == pe )
 		goto _test_eof307;
 case 307:
-#line 7461 "inc/vcf/validator_detail_v42.hpp"
+#line 7443 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 68: goto tr446;
@@ -7468,14 +7450,14 @@ case 307:
 tr446:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st308;
 st308:
 	if ( ++p == pe )
 		goto _test_eof308;
 case 308:
-#line 7479 "inc/vcf/validator_detail_v42.hpp"
+#line 7461 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 73: goto tr447;
@@ -7486,14 +7468,14 @@ case 308:
 tr447:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st309;
 st309:
 	if ( ++p == pe )
 		goto _test_eof309;
 case 309:
-#line 7497 "inc/vcf/validator_detail_v42.hpp"
+#line 7479 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 71: goto tr448;
@@ -7504,14 +7486,14 @@ case 309:
 tr448:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st310;
 st310:
 	if ( ++p == pe )
 		goto _test_eof310;
 case 310:
-#line 7515 "inc/vcf/validator_detail_v42.hpp"
+#line 7497 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 82: goto tr449;
@@ -7522,14 +7504,14 @@ case 310:
 tr449:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st311;
 st311:
 	if ( ++p == pe )
 		goto _test_eof311;
 case 311:
-#line 7533 "inc/vcf/validator_detail_v42.hpp"
+#line 7515 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 69: goto tr450;
@@ -7540,14 +7522,14 @@ case 311:
 tr450:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st312;
 st312:
 	if ( ++p == pe )
 		goto _test_eof312;
 case 312:
-#line 7551 "inc/vcf/validator_detail_v42.hpp"
+#line 7533 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 69: goto st313;
@@ -7565,7 +7547,7 @@ case 313:
 		goto tr40;
 	goto tr444;
 tr452:
-#line 132 "src/vcf/vcf.ragel"
+#line 126 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "PEDIGREE");
     }
@@ -7574,7 +7556,7 @@ st314:
 	if ( ++p == pe )
 		goto _test_eof314;
 case 314:
-#line 7578 "inc/vcf/validator_detail_v42.hpp"
+#line 7560 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 60 )
 		goto st315;
 	goto tr444;
@@ -7588,7 +7570,7 @@ st315:
 	if ( ++p == pe )
 		goto _test_eof315;
 case 315:
-#line 7592 "inc/vcf/validator_detail_v42.hpp"
+#line 7574 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 95 )
 		goto tr455;
 	if ( (*p) < 48 ) {
@@ -7606,14 +7588,14 @@ case 315:
 tr455:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st316;
 st316:
 	if ( ++p == pe )
 		goto _test_eof316;
 case 316:
-#line 7617 "inc/vcf/validator_detail_v42.hpp"
+#line 7599 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 95 )
 		goto st316;
 	if ( (*p) < 48 ) {
@@ -7631,24 +7613,24 @@ case 316:
 tr456:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st317;
 tr458:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st317;
 st317:
 	if ( ++p == pe )
 		goto _test_eof317;
 case 317:
-#line 7652 "inc/vcf/validator_detail_v42.hpp"
+#line 7634 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr459;
 		case 95: goto tr458;
@@ -7675,7 +7657,7 @@ st318:
 	if ( ++p == pe )
 		goto _test_eof318;
 case 318:
-#line 7679 "inc/vcf/validator_detail_v42.hpp"
+#line 7661 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 95 )
 		goto tr460;
 	if ( (*p) < 48 ) {
@@ -7693,14 +7675,14 @@ case 318:
 tr460:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st319;
 st319:
 	if ( ++p == pe )
 		goto _test_eof319;
 case 319:
-#line 7704 "inc/vcf/validator_detail_v42.hpp"
+#line 7686 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 95 )
 		goto st319;
 	if ( (*p) < 48 ) {
@@ -7718,24 +7700,24 @@ case 319:
 tr461:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st320;
 tr463:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st320;
 st320:
 	if ( ++p == pe )
 		goto _test_eof320;
 case 320:
-#line 7739 "inc/vcf/validator_detail_v42.hpp"
+#line 7721 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 44: goto tr464;
 		case 62: goto tr465;
@@ -7763,7 +7745,7 @@ st321:
 	if ( ++p == pe )
 		goto _test_eof321;
 case 321:
-#line 7767 "inc/vcf/validator_detail_v42.hpp"
+#line 7749 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -7772,18 +7754,18 @@ case 321:
 tr35:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st322;
 st322:
 	if ( ++p == pe )
 		goto _test_eof322;
 case 322:
-#line 7787 "inc/vcf/validator_detail_v42.hpp"
+#line 7769 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 65: goto tr467;
@@ -7794,14 +7776,14 @@ case 322:
 tr467:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st323;
 st323:
 	if ( ++p == pe )
 		goto _test_eof323;
 case 323:
-#line 7805 "inc/vcf/validator_detail_v42.hpp"
+#line 7787 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 77: goto tr468;
@@ -7812,14 +7794,14 @@ case 323:
 tr468:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st324;
 st324:
 	if ( ++p == pe )
 		goto _test_eof324;
 case 324:
-#line 7823 "inc/vcf/validator_detail_v42.hpp"
+#line 7805 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 80: goto tr469;
@@ -7830,14 +7812,14 @@ case 324:
 tr469:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st325;
 st325:
 	if ( ++p == pe )
 		goto _test_eof325;
 case 325:
-#line 7841 "inc/vcf/validator_detail_v42.hpp"
+#line 7823 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 76: goto tr470;
@@ -7848,14 +7830,14 @@ case 325:
 tr470:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st326;
 st326:
 	if ( ++p == pe )
 		goto _test_eof326;
 case 326:
-#line 7859 "inc/vcf/validator_detail_v42.hpp"
+#line 7841 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 69: goto st327;
@@ -7873,7 +7855,7 @@ case 327:
 		goto tr40;
 	goto tr466;
 tr472:
-#line 140 "src/vcf/vcf.ragel"
+#line 134 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "SAMPLE");
     }
@@ -7882,7 +7864,7 @@ st328:
 	if ( ++p == pe )
 		goto _test_eof328;
 case 328:
-#line 7886 "inc/vcf/validator_detail_v42.hpp"
+#line 7868 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 60 )
 		goto st329;
 	goto tr466;
@@ -7926,20 +7908,20 @@ case 332:
 		goto tr479;
 	goto tr477;
 tr478:
-#line 144 "src/vcf/vcf.ragel"
+#line 138 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st333;
 st333:
 	if ( ++p == pe )
 		goto _test_eof333;
 case 333:
-#line 7943 "inc/vcf/validator_detail_v42.hpp"
+#line 7925 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 95 )
 		goto st333;
 	if ( (*p) < 48 ) {
@@ -7957,28 +7939,28 @@ case 333:
 tr481:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st334;
 tr479:
-#line 144 "src/vcf/vcf.ragel"
+#line 138 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st334;
 st334:
 	if ( ++p == pe )
 		goto _test_eof334;
 case 334:
-#line 7982 "inc/vcf/validator_detail_v42.hpp"
+#line 7964 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 44: goto tr483;
 		case 95: goto tr481;
@@ -8005,7 +7987,7 @@ st335:
 	if ( ++p == pe )
 		goto _test_eof335;
 case 335:
-#line 8009 "inc/vcf/validator_detail_v42.hpp"
+#line 7991 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 71 )
 		goto st336;
 	goto tr484;
@@ -8077,28 +8059,28 @@ case 343:
 tr495:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st344;
 tr493:
-#line 160 "src/vcf/vcf.ragel"
+#line 154 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Genomes");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st344;
 st344:
 	if ( ++p == pe )
 		goto _test_eof344;
 case 344:
-#line 8102 "inc/vcf/validator_detail_v42.hpp"
+#line 8084 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 44 )
 		goto tr496;
 	if ( (*p) < 35 ) {
@@ -8120,7 +8102,7 @@ st345:
 	if ( ++p == pe )
 		goto _test_eof345;
 case 345:
-#line 8124 "inc/vcf/validator_detail_v42.hpp"
+#line 8106 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 77 )
 		goto st346;
 	goto tr497;
@@ -8192,28 +8174,28 @@ case 353:
 tr508:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st354;
 tr506:
-#line 164 "src/vcf/vcf.ragel"
+#line 158 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Mixture");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st354;
 st354:
 	if ( ++p == pe )
 		goto _test_eof354;
 case 354:
-#line 8217 "inc/vcf/validator_detail_v42.hpp"
+#line 8199 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 44 )
 		goto tr509;
 	if ( (*p) < 35 ) {
@@ -8235,7 +8217,7 @@ st355:
 	if ( ++p == pe )
 		goto _test_eof355;
 case 355:
-#line 8239 "inc/vcf/validator_detail_v42.hpp"
+#line 8221 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 68 )
 		goto st356;
 	goto tr510;
@@ -8324,7 +8306,7 @@ case 367:
 		goto tr523;
 	goto tr510;
 tr523:
-#line 156 "src/vcf/vcf.ragel"
+#line 150 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Description");
     }
@@ -8333,7 +8315,7 @@ st368:
 	if ( ++p == pe )
 		goto _test_eof368;
 case 368:
-#line 8337 "inc/vcf/validator_detail_v42.hpp"
+#line 8319 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr525;
 		case 92: goto tr526;
@@ -8344,24 +8326,24 @@ case 368:
 tr524:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st369;
 tr527:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st369;
 st369:
 	if ( ++p == pe )
 		goto _test_eof369;
 case 369:
-#line 8365 "inc/vcf/validator_detail_v42.hpp"
+#line 8347 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr528;
 		case 92: goto tr529;
@@ -8372,7 +8354,7 @@ case 369:
 tr525:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -8389,7 +8371,7 @@ st370:
 	if ( ++p == pe )
 		goto _test_eof370;
 case 370:
-#line 8393 "inc/vcf/validator_detail_v42.hpp"
+#line 8375 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 62 )
 		goto st371;
 	goto tr510;
@@ -8405,24 +8387,24 @@ case 371:
 tr526:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st372;
 tr529:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st372;
 st372:
 	if ( ++p == pe )
 		goto _test_eof372;
 case 372:
-#line 8426 "inc/vcf/validator_detail_v42.hpp"
+#line 8408 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr531;
 		case 92: goto tr529;
@@ -8433,7 +8415,7 @@ case 372:
 tr531:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -8444,7 +8426,7 @@ st373:
 	if ( ++p == pe )
 		goto _test_eof373;
 case 373:
-#line 8448 "inc/vcf/validator_detail_v42.hpp"
+#line 8430 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr528;
 		case 62: goto tr532;
@@ -8456,14 +8438,14 @@ case 373:
 tr532:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st374;
 st374:
 	if ( ++p == pe )
 		goto _test_eof374;
 case 374:
-#line 8467 "inc/vcf/validator_detail_v42.hpp"
+#line 8449 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -8476,18 +8458,18 @@ case 374:
 tr36:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st375;
 st375:
 	if ( ++p == pe )
 		goto _test_eof375;
 case 375:
-#line 8491 "inc/vcf/validator_detail_v42.hpp"
+#line 8473 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 115: goto tr534;
@@ -8498,14 +8480,14 @@ case 375:
 tr534:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st376;
 st376:
 	if ( ++p == pe )
 		goto _test_eof376;
 case 376:
-#line 8509 "inc/vcf/validator_detail_v42.hpp"
+#line 8491 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 115: goto tr535;
@@ -8516,14 +8498,14 @@ case 376:
 tr535:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st377;
 st377:
 	if ( ++p == pe )
 		goto _test_eof377;
 case 377:
-#line 8527 "inc/vcf/validator_detail_v42.hpp"
+#line 8509 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 101: goto tr536;
@@ -8534,14 +8516,14 @@ case 377:
 tr536:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st378;
 st378:
 	if ( ++p == pe )
 		goto _test_eof378;
 case 378:
-#line 8545 "inc/vcf/validator_detail_v42.hpp"
+#line 8527 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 109: goto tr537;
@@ -8552,14 +8534,14 @@ case 378:
 tr537:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st379;
 st379:
 	if ( ++p == pe )
 		goto _test_eof379;
 case 379:
-#line 8563 "inc/vcf/validator_detail_v42.hpp"
+#line 8545 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 98: goto tr538;
@@ -8570,14 +8552,14 @@ case 379:
 tr538:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st380;
 st380:
 	if ( ++p == pe )
 		goto _test_eof380;
 case 380:
-#line 8581 "inc/vcf/validator_detail_v42.hpp"
+#line 8563 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 108: goto tr539;
@@ -8588,14 +8570,14 @@ case 380:
 tr539:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st381;
 st381:
 	if ( ++p == pe )
 		goto _test_eof381;
 case 381:
-#line 8599 "inc/vcf/validator_detail_v42.hpp"
+#line 8581 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 121: goto st382;
@@ -8613,7 +8595,7 @@ case 382:
 		goto tr40;
 	goto tr533;
 tr541:
-#line 112 "src/vcf/vcf.ragel"
+#line 106 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "assembly");
     }
@@ -8622,7 +8604,7 @@ st383:
 	if ( ++p == pe )
 		goto _test_eof383;
 case 383:
-#line 8626 "inc/vcf/validator_detail_v42.hpp"
+#line 8608 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) > 90 ) {
 		if ( 97 <= (*p) && (*p) <= 122 )
 			goto tr543;
@@ -8632,14 +8614,14 @@ case 383:
 tr543:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st384;
 st384:
 	if ( ++p == pe )
 		goto _test_eof384;
 case 384:
-#line 8643 "inc/vcf/validator_detail_v42.hpp"
+#line 8625 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 10: goto tr542;
 		case 13: goto tr545;
@@ -8652,20 +8634,16 @@ case 384:
 tr545:
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st385;
 st385:
 	if ( ++p == pe )
 		goto _test_eof385;
 case 385:
-#line 8669 "inc/vcf/validator_detail_v42.hpp"
+#line 8647 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 10: goto tr542;
 		case 13: goto tr545;
@@ -8753,29 +8731,25 @@ case 394:
 tr550:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st395;
 tr559:
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 196 "src/vcf/vcf.ragel"
+#line 190 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_meta_line(*this);
@@ -8788,7 +8762,7 @@ st395:
 	if ( ++p == pe )
 		goto _test_eof395;
 case 395:
-#line 8792 "inc/vcf/validator_detail_v42.hpp"
+#line 8766 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 10: goto tr45;
 		case 13: goto tr559;
@@ -8845,18 +8819,18 @@ case 401:
 tr37:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st402;
 st402:
 	if ( ++p == pe )
 		goto _test_eof402;
 case 402:
-#line 8860 "inc/vcf/validator_detail_v42.hpp"
+#line 8834 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 111: goto tr564;
@@ -8867,14 +8841,14 @@ case 402:
 tr564:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st403;
 st403:
 	if ( ++p == pe )
 		goto _test_eof403;
 case 403:
-#line 8878 "inc/vcf/validator_detail_v42.hpp"
+#line 8852 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 110: goto tr565;
@@ -8885,14 +8859,14 @@ case 403:
 tr565:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st404;
 st404:
 	if ( ++p == pe )
 		goto _test_eof404;
 case 404:
-#line 8896 "inc/vcf/validator_detail_v42.hpp"
+#line 8870 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 116: goto tr566;
@@ -8903,14 +8877,14 @@ case 404:
 tr566:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st405;
 st405:
 	if ( ++p == pe )
 		goto _test_eof405;
 case 405:
-#line 8914 "inc/vcf/validator_detail_v42.hpp"
+#line 8888 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 105: goto tr567;
@@ -8921,14 +8895,14 @@ case 405:
 tr567:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st406;
 st406:
 	if ( ++p == pe )
 		goto _test_eof406;
 case 406:
-#line 8932 "inc/vcf/validator_detail_v42.hpp"
+#line 8906 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 103: goto st407;
@@ -8946,7 +8920,7 @@ case 407:
 		goto tr40;
 	goto tr563;
 tr569:
-#line 116 "src/vcf/vcf.ragel"
+#line 110 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "contig");
     }
@@ -8955,7 +8929,7 @@ st408:
 	if ( ++p == pe )
 		goto _test_eof408;
 case 408:
-#line 8959 "inc/vcf/validator_detail_v42.hpp"
+#line 8933 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 60 )
 		goto st409;
 	goto tr563;
@@ -8996,28 +8970,28 @@ case 412:
 tr576:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st413;
 tr575:
-#line 144 "src/vcf/vcf.ragel"
+#line 138 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st413;
 st413:
 	if ( ++p == pe )
 		goto _test_eof413;
 case 413:
-#line 9021 "inc/vcf/validator_detail_v42.hpp"
+#line 8995 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 44: goto tr577;
 		case 59: goto tr576;
@@ -9039,7 +9013,7 @@ st414:
 	if ( ++p == pe )
 		goto _test_eof414;
 case 414:
-#line 9043 "inc/vcf/validator_detail_v42.hpp"
+#line 9017 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 95 )
 		goto tr579;
 	if ( (*p) < 48 ) {
@@ -9057,14 +9031,14 @@ case 414:
 tr579:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st415;
 st415:
 	if ( ++p == pe )
 		goto _test_eof415;
 case 415:
-#line 9068 "inc/vcf/validator_detail_v42.hpp"
+#line 9042 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 95 )
 		goto st415;
 	if ( (*p) < 48 ) {
@@ -9082,24 +9056,24 @@ case 415:
 tr580:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st416;
 tr582:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st416;
 st416:
 	if ( ++p == pe )
 		goto _test_eof416;
 case 416:
-#line 9103 "inc/vcf/validator_detail_v42.hpp"
+#line 9077 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr583;
 		case 95: goto tr582;
@@ -9126,7 +9100,7 @@ st417:
 	if ( ++p == pe )
 		goto _test_eof417;
 case 417:
-#line 9130 "inc/vcf/validator_detail_v42.hpp"
+#line 9104 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 34 )
 		goto st420;
 	if ( (*p) < 45 ) {
@@ -9141,24 +9115,24 @@ case 417:
 tr584:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st418;
 tr586:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st418;
 st418:
 	if ( ++p == pe )
 		goto _test_eof418;
 case 418:
-#line 9162 "inc/vcf/validator_detail_v42.hpp"
+#line 9136 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 44: goto tr577;
 		case 62: goto tr578;
@@ -9179,7 +9153,7 @@ st419:
 	if ( ++p == pe )
 		goto _test_eof419;
 case 419:
-#line 9183 "inc/vcf/validator_detail_v42.hpp"
+#line 9157 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -9199,24 +9173,24 @@ case 420:
 tr587:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st421;
 tr590:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st421;
 st421:
 	if ( ++p == pe )
 		goto _test_eof421;
 case 421:
-#line 9220 "inc/vcf/validator_detail_v42.hpp"
+#line 9194 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr591;
 		case 92: goto tr592;
@@ -9227,7 +9201,7 @@ case 421:
 tr588:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -9244,7 +9218,7 @@ st422:
 	if ( ++p == pe )
 		goto _test_eof422;
 case 422:
-#line 9248 "inc/vcf/validator_detail_v42.hpp"
+#line 9222 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 44: goto st414;
 		case 62: goto st419;
@@ -9253,24 +9227,24 @@ case 422:
 tr589:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st423;
 tr592:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st423;
 st423:
 	if ( ++p == pe )
 		goto _test_eof423;
 case 423:
-#line 9274 "inc/vcf/validator_detail_v42.hpp"
+#line 9248 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr595;
 		case 92: goto tr592;
@@ -9281,7 +9255,7 @@ case 423:
 tr595:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -9292,7 +9266,7 @@ st424:
 	if ( ++p == pe )
 		goto _test_eof424;
 case 424:
-#line 9296 "inc/vcf/validator_detail_v42.hpp"
+#line 9270 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr591;
 		case 44: goto tr596;
@@ -9305,23 +9279,23 @@ case 424:
 tr610:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st425;
 tr596:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st425;
 tr607:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -9332,7 +9306,7 @@ st425:
 	if ( ++p == pe )
 		goto _test_eof425;
 case 425:
-#line 9336 "inc/vcf/validator_detail_v42.hpp"
+#line 9310 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr591;
 		case 47: goto tr590;
@@ -9366,24 +9340,24 @@ case 425:
 tr598:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st426;
 tr600:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st426;
 st426:
 	if ( ++p == pe )
 		goto _test_eof426;
 case 426:
-#line 9387 "inc/vcf/validator_detail_v42.hpp"
+#line 9361 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr591;
 		case 47: goto tr590;
@@ -9417,24 +9391,24 @@ case 426:
 tr599:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st427;
 tr601:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st427;
 st427:
 	if ( ++p == pe )
 		goto _test_eof427;
 case 427:
-#line 9438 "inc/vcf/validator_detail_v42.hpp"
+#line 9412 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr591;
 		case 47: goto tr590;
@@ -9470,14 +9444,14 @@ tr602:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st428;
 st428:
 	if ( ++p == pe )
 		goto _test_eof428;
 case 428:
-#line 9481 "inc/vcf/validator_detail_v42.hpp"
+#line 9455 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr604;
 		case 44: goto tr590;
@@ -9490,24 +9464,24 @@ case 428:
 tr606:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st429;
 tr603:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st429;
 st429:
 	if ( ++p == pe )
 		goto _test_eof429;
 case 429:
-#line 9511 "inc/vcf/validator_detail_v42.hpp"
+#line 9485 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr591;
 		case 44: goto tr607;
@@ -9520,23 +9494,23 @@ case 429:
 tr611:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st430;
 tr597:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st430;
 tr608:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -9547,7 +9521,7 @@ st430:
 	if ( ++p == pe )
 		goto _test_eof430;
 case 430:
-#line 9551 "inc/vcf/validator_detail_v42.hpp"
+#line 9525 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -9560,24 +9534,24 @@ case 430:
 tr609:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st431;
 tr605:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st431;
 st431:
 	if ( ++p == pe )
 		goto _test_eof431;
 case 431:
-#line 9581 "inc/vcf/validator_detail_v42.hpp"
+#line 9555 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr595;
 		case 44: goto tr607;
@@ -9597,7 +9571,7 @@ st432:
 	if ( ++p == pe )
 		goto _test_eof432;
 case 432:
-#line 9601 "inc/vcf/validator_detail_v42.hpp"
+#line 9575 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 34: goto tr588;
 		case 44: goto tr610;
@@ -9610,18 +9584,18 @@ case 432:
 tr38:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st433;
 st433:
 	if ( ++p == pe )
 		goto _test_eof433;
 case 433:
-#line 9625 "inc/vcf/validator_detail_v42.hpp"
+#line 9599 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 101: goto tr613;
@@ -9632,14 +9606,14 @@ case 433:
 tr613:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st434;
 st434:
 	if ( ++p == pe )
 		goto _test_eof434;
 case 434:
-#line 9643 "inc/vcf/validator_detail_v42.hpp"
+#line 9617 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 100: goto tr614;
@@ -9650,14 +9624,14 @@ case 434:
 tr614:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st435;
 st435:
 	if ( ++p == pe )
 		goto _test_eof435;
 case 435:
-#line 9661 "inc/vcf/validator_detail_v42.hpp"
+#line 9635 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 105: goto tr615;
@@ -9668,14 +9642,14 @@ case 435:
 tr615:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st436;
 st436:
 	if ( ++p == pe )
 		goto _test_eof436;
 case 436:
-#line 9679 "inc/vcf/validator_detail_v42.hpp"
+#line 9653 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 103: goto tr616;
@@ -9686,14 +9660,14 @@ case 436:
 tr616:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st437;
 st437:
 	if ( ++p == pe )
 		goto _test_eof437;
 case 437:
-#line 9697 "inc/vcf/validator_detail_v42.hpp"
+#line 9671 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 114: goto tr617;
@@ -9704,14 +9678,14 @@ case 437:
 tr617:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st438;
 st438:
 	if ( ++p == pe )
 		goto _test_eof438;
 case 438:
-#line 9715 "inc/vcf/validator_detail_v42.hpp"
+#line 9689 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 101: goto tr618;
@@ -9722,14 +9696,14 @@ case 438:
 tr618:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st439;
 st439:
 	if ( ++p == pe )
 		goto _test_eof439;
 case 439:
-#line 9733 "inc/vcf/validator_detail_v42.hpp"
+#line 9707 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 101: goto tr619;
@@ -9740,14 +9714,14 @@ case 439:
 tr619:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st440;
 st440:
 	if ( ++p == pe )
 		goto _test_eof440;
 case 440:
-#line 9751 "inc/vcf/validator_detail_v42.hpp"
+#line 9725 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 68: goto tr620;
@@ -9758,14 +9732,14 @@ case 440:
 tr620:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st441;
 st441:
 	if ( ++p == pe )
 		goto _test_eof441;
 case 441:
-#line 9769 "inc/vcf/validator_detail_v42.hpp"
+#line 9743 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 66: goto st442;
@@ -9783,7 +9757,7 @@ case 442:
 		goto tr40;
 	goto tr612;
 tr622:
-#line 136 "src/vcf/vcf.ragel"
+#line 130 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "pedigreeDB");
     }
@@ -9792,7 +9766,7 @@ st443:
 	if ( ++p == pe )
 		goto _test_eof443;
 case 443:
-#line 9796 "inc/vcf/validator_detail_v42.hpp"
+#line 9770 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 60 )
 		goto st444;
 	goto tr612;
@@ -9809,14 +9783,14 @@ case 444:
 tr625:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st445;
 st445:
 	if ( ++p == pe )
 		goto _test_eof445;
 case 445:
-#line 9820 "inc/vcf/validator_detail_v42.hpp"
+#line 9794 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 10: goto tr624;
 		case 13: goto tr627;
@@ -9829,20 +9803,16 @@ case 445:
 tr627:
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st446;
 st446:
 	if ( ++p == pe )
 		goto _test_eof446;
 case 446:
-#line 9846 "inc/vcf/validator_detail_v42.hpp"
+#line 9816 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 10: goto tr624;
 		case 13: goto tr627;
@@ -9930,30 +9900,26 @@ case 455:
 tr632:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st456;
 tr641:
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st456;
 st456:
 	if ( ++p == pe )
 		goto _test_eof456;
 case 456:
-#line 9957 "inc/vcf/validator_detail_v42.hpp"
+#line 9923 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 10: goto tr624;
 		case 13: goto tr641;
@@ -9963,7 +9929,7 @@ case 456:
 tr642:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -9974,7 +9940,7 @@ st457:
 	if ( ++p == pe )
 		goto _test_eof457;
 case 457:
-#line 9978 "inc/vcf/validator_detail_v42.hpp"
+#line 9944 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr643;
@@ -9984,19 +9950,15 @@ case 457:
 tr643:
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
-#line 196 "src/vcf/vcf.ragel"
+#line 190 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_meta_line(*this);
@@ -10009,7 +9971,7 @@ st458:
 	if ( ++p == pe )
 		goto _test_eof458;
 case 458:
-#line 10013 "inc/vcf/validator_detail_v42.hpp"
+#line 9975 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 10: goto st28;
 		case 13: goto tr641;
@@ -10100,7 +10062,7 @@ case 469:
 		goto tr652;
 	goto tr647;
 tr652:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -10109,7 +10071,7 @@ st470:
 	if ( ++p == pe )
 		goto _test_eof470;
 case 470:
-#line 10113 "inc/vcf/validator_detail_v42.hpp"
+#line 10075 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 80 )
 		goto st471;
 	goto tr647;
@@ -10135,7 +10097,7 @@ case 473:
 		goto tr656;
 	goto tr647;
 tr656:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -10144,7 +10106,7 @@ st474:
 	if ( ++p == pe )
 		goto _test_eof474;
 case 474:
-#line 10148 "inc/vcf/validator_detail_v42.hpp"
+#line 10110 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 73 )
 		goto st475;
 	goto tr647;
@@ -10163,7 +10125,7 @@ case 476:
 		goto tr659;
 	goto tr647;
 tr659:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -10172,7 +10134,7 @@ st477:
 	if ( ++p == pe )
 		goto _test_eof477;
 case 477:
-#line 10176 "inc/vcf/validator_detail_v42.hpp"
+#line 10138 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 82 )
 		goto st478;
 	goto tr647;
@@ -10198,7 +10160,7 @@ case 480:
 		goto tr663;
 	goto tr647;
 tr663:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -10207,7 +10169,7 @@ st481:
 	if ( ++p == pe )
 		goto _test_eof481;
 case 481:
-#line 10211 "inc/vcf/validator_detail_v42.hpp"
+#line 10173 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 65 )
 		goto st482;
 	goto tr647;
@@ -10233,7 +10195,7 @@ case 484:
 		goto tr667;
 	goto tr647;
 tr667:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -10242,7 +10204,7 @@ st485:
 	if ( ++p == pe )
 		goto _test_eof485;
 case 485:
-#line 10246 "inc/vcf/validator_detail_v42.hpp"
+#line 10208 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 81 )
 		goto st486;
 	goto tr647;
@@ -10275,7 +10237,7 @@ case 489:
 		goto tr672;
 	goto tr647;
 tr672:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -10284,7 +10246,7 @@ st490:
 	if ( ++p == pe )
 		goto _test_eof490;
 case 490:
-#line 10288 "inc/vcf/validator_detail_v42.hpp"
+#line 10250 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 70 )
 		goto st491;
 	goto tr647;
@@ -10331,7 +10293,7 @@ case 496:
 		goto tr679;
 	goto tr647;
 tr679:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -10340,7 +10302,7 @@ st497:
 	if ( ++p == pe )
 		goto _test_eof497;
 case 497:
-#line 10344 "inc/vcf/validator_detail_v42.hpp"
+#line 10306 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 73 )
 		goto st498;
 	goto tr647;
@@ -10376,7 +10338,7 @@ case 501:
 	}
 	goto tr647;
 tr684:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -10385,7 +10347,7 @@ st502:
 	if ( ++p == pe )
 		goto _test_eof502;
 case 502:
-#line 10389 "inc/vcf/validator_detail_v42.hpp"
+#line 10351 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 70 )
 		goto st503;
 	goto tr687;
@@ -10432,17 +10394,17 @@ case 508:
 		goto tr694;
 	goto tr687;
 tr694:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
 	goto st509;
 tr696:
-#line 204 "src/vcf/vcf.ragel"
+#line 198 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_sample_name(*this);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -10451,31 +10413,31 @@ st509:
 	if ( ++p == pe )
 		goto _test_eof509;
 case 509:
-#line 10455 "inc/vcf/validator_detail_v42.hpp"
+#line 10417 "src/vcf/validator_detail_v42.cpp"
 	if ( 32 <= (*p) && (*p) <= 126 )
 		goto tr695;
 	goto tr687;
 tr695:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st510;
 tr699:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st510;
 st510:
 	if ( ++p == pe )
 		goto _test_eof510;
 case 510:
-#line 10479 "inc/vcf/validator_detail_v42.hpp"
+#line 10441 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 9: goto tr696;
 		case 10: goto tr697;
@@ -10485,46 +10447,38 @@ case 510:
 		goto tr699;
 	goto tr687;
 tr685:
-#line 208 "src/vcf/vcf.ragel"
+#line 202 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_header_line(*this);
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st593;
 tr697:
-#line 204 "src/vcf/vcf.ragel"
+#line 198 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_sample_name(*this);
     }
-#line 208 "src/vcf/vcf.ragel"
+#line 202 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_header_line(*this);
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st593;
 st593:
 	if ( ++p == pe )
 		goto _test_eof593;
 case 593:
-#line 10528 "inc/vcf/validator_detail_v42.hpp"
+#line 10482 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 10: goto tr821;
 		case 13: goto tr822;
@@ -10542,40 +10496,31 @@ case 593:
 tr825:
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st594;
 tr821:
-#line 70 "src/vcf/vcf.ragel"
+#line 66 "src/vcf/vcf.ragel"
 	{
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st594;
 st594:
 	if ( ++p == pe )
 		goto _test_eof594;
 case 594:
-#line 10579 "inc/vcf/validator_detail_v42.hpp"
+#line 10524 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 10: goto tr825;
 		case 13: goto tr826;
@@ -10584,82 +10529,72 @@ case 594:
 tr826:
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st511;
 tr822:
-#line 70 "src/vcf/vcf.ragel"
+#line 66 "src/vcf/vcf.ragel"
 	{
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st511;
 st511:
 	if ( ++p == pe )
 		goto _test_eof511;
 case 511:
-#line 10621 "inc/vcf/validator_detail_v42.hpp"
+#line 10557 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 10 )
 		goto st594;
 	goto st0;
 tr832:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st512;
 tr704:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st512;
 tr823:
-#line 70 "src/vcf/vcf.ragel"
+#line 66 "src/vcf/vcf.ragel"
 	{
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st512;
 st512:
 	if ( ++p == pe )
 		goto _test_eof512;
 case 512:
-#line 10663 "inc/vcf/validator_detail_v42.hpp"
+#line 10598 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 9: goto tr703;
 		case 59: goto tr704;
@@ -10679,21 +10614,21 @@ tr703:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 208 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
 	goto st513;
 tr762:
-#line 214 "src/vcf/vcf.ragel"
+#line 208 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -10702,31 +10637,31 @@ st513:
 	if ( ++p == pe )
 		goto _test_eof513;
 case 513:
-#line 10706 "inc/vcf/validator_detail_v42.hpp"
+#line 10641 "src/vcf/validator_detail_v42.cpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr706;
 	goto tr705;
 tr706:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st514;
 tr708:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st514;
 st514:
 	if ( ++p == pe )
 		goto _test_eof514;
 case 514:
-#line 10730 "inc/vcf/validator_detail_v42.hpp"
+#line 10665 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 9 )
 		goto tr707;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -10743,11 +10678,11 @@ tr707:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 208 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -10756,7 +10691,7 @@ st515:
 	if ( ++p == pe )
 		goto _test_eof515;
 case 515:
-#line 10760 "inc/vcf/validator_detail_v42.hpp"
+#line 10695 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) > 58 ) {
 		if ( 60 <= (*p) && (*p) <= 126 )
 			goto tr710;
@@ -10766,24 +10701,24 @@ case 515:
 tr710:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st516;
 tr712:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st516;
 st516:
 	if ( ++p == pe )
 		goto _test_eof516;
 case 516:
-#line 10787 "inc/vcf/validator_detail_v42.hpp"
+#line 10722 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 9: goto tr711;
 		case 59: goto tr713;
@@ -10796,11 +10731,11 @@ tr711:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 208 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -10809,7 +10744,7 @@ st517:
 	if ( ++p == pe )
 		goto _test_eof517;
 case 517:
-#line 10813 "inc/vcf/validator_detail_v42.hpp"
+#line 10748 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 65: goto tr715;
 		case 67: goto tr715;
@@ -10826,24 +10761,24 @@ case 517:
 tr715:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st518;
 tr717:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st518;
 st518:
 	if ( ++p == pe )
 		goto _test_eof518;
 case 518:
-#line 10847 "inc/vcf/validator_detail_v42.hpp"
+#line 10782 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 9: goto tr716;
 		case 65: goto tr717;
@@ -10863,11 +10798,11 @@ tr716:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 208 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -10876,7 +10811,7 @@ st519:
 	if ( ++p == pe )
 		goto _test_eof519;
 case 519:
-#line 10880 "inc/vcf/validator_detail_v42.hpp"
+#line 10815 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 42: goto tr719;
 		case 46: goto tr720;
@@ -10898,24 +10833,24 @@ case 519:
 tr719:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st520;
 tr783:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st520;
 st520:
 	if ( ++p == pe )
 		goto _test_eof520;
 case 520:
-#line 10919 "inc/vcf/validator_detail_v42.hpp"
+#line 10854 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 9: goto tr725;
 		case 44: goto tr726;
@@ -10926,11 +10861,11 @@ tr725:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 208 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -10939,7 +10874,7 @@ st521:
 	if ( ++p == pe )
 		goto _test_eof521;
 case 521:
-#line 10943 "inc/vcf/validator_detail_v42.hpp"
+#line 10878 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 43: goto tr728;
 		case 45: goto tr728;
@@ -10953,18 +10888,18 @@ case 521:
 tr728:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st522;
 st522:
 	if ( ++p == pe )
 		goto _test_eof522;
 case 522:
-#line 10968 "inc/vcf/validator_detail_v42.hpp"
+#line 10903 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 73 )
 		goto tr734;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -10973,24 +10908,24 @@ case 522:
 tr730:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st523;
 tr733:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st523;
 st523:
 	if ( ++p == pe )
 		goto _test_eof523;
 case 523:
-#line 10994 "inc/vcf/validator_detail_v42.hpp"
+#line 10929 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 9: goto tr735;
 		case 46: goto tr736;
@@ -11005,11 +10940,11 @@ tr735:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 208 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -11018,7 +10953,7 @@ st524:
 	if ( ++p == pe )
 		goto _test_eof524;
 case 524:
-#line 11022 "inc/vcf/validator_detail_v42.hpp"
+#line 10957 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 46: goto tr740;
 		case 58: goto tr739;
@@ -11047,14 +10982,14 @@ case 524:
 tr739:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st525;
 st525:
 	if ( ++p == pe )
 		goto _test_eof525;
 case 525:
-#line 11058 "inc/vcf/validator_detail_v42.hpp"
+#line 10993 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 58 )
 		goto st525;
 	if ( (*p) < 65 ) {
@@ -11081,24 +11016,24 @@ case 525:
 tr741:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st526;
 tr743:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st526;
 st526:
 	if ( ++p == pe )
 		goto _test_eof526;
 case 526:
-#line 11102 "inc/vcf/validator_detail_v42.hpp"
+#line 11037 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 9: goto tr744;
 		case 59: goto tr745;
@@ -11111,11 +11046,11 @@ tr744:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 208 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -11124,7 +11059,7 @@ st527:
 	if ( ++p == pe )
 		goto _test_eof527;
 case 527:
-#line 11128 "inc/vcf/validator_detail_v42.hpp"
+#line 11063 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 46: goto tr747;
 		case 49: goto tr748;
@@ -11139,18 +11074,18 @@ case 527:
 tr747:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st595;
 st595:
 	if ( ++p == pe )
 		goto _test_eof595;
 case 595:
-#line 11154 "inc/vcf/validator_detail_v42.hpp"
+#line 11089 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 9: goto tr828;
 		case 10: goto tr829;
@@ -11168,11 +11103,11 @@ tr828:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 208 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -11181,7 +11116,7 @@ st528:
 	if ( ++p == pe )
 		goto _test_eof528;
 case 528:
-#line 11185 "inc/vcf/validator_detail_v42.hpp"
+#line 11120 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) < 65 ) {
 		if ( 48 <= (*p) && (*p) <= 57 )
 			goto tr751;
@@ -11194,24 +11129,24 @@ case 528:
 tr751:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st529;
 tr753:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st529;
 st529:
 	if ( ++p == pe )
 		goto _test_eof529;
 case 529:
-#line 11215 "inc/vcf/validator_detail_v42.hpp"
+#line 11150 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 9: goto tr752;
 		case 58: goto tr754;
@@ -11230,11 +11165,11 @@ tr752:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 208 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -11243,7 +11178,7 @@ st530:
 	if ( ++p == pe )
 		goto _test_eof530;
 case 530:
-#line 11247 "inc/vcf/validator_detail_v42.hpp"
+#line 11182 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 46 )
 		goto tr757;
 	if ( (*p) < 48 ) {
@@ -11258,24 +11193,24 @@ case 530:
 tr756:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st596;
 tr766:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st596;
 st596:
 	if ( ++p == pe )
 		goto _test_eof596;
 case 596:
-#line 11279 "inc/vcf/validator_detail_v42.hpp"
+#line 11214 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 9: goto tr752;
 		case 10: goto tr829;
@@ -11290,51 +11225,44 @@ tr829:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 208 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 218 "src/vcf/vcf.ragel"
+#line 212 "src/vcf/vcf.ragel"
 	{
-        try {
-            // Handle all columns and build record
-            ParsePolicy::handle_body_line(*this);
+        // Handle all columns and build record
+        Error * error = ParsePolicy::handle_body_line(*this);
 
-            if (record != nullptr) {
-                auto duplicated_errors = previous_records.check_duplicates(*record);
-                for(auto &error_ptr : duplicated_errors) {
-                    ErrorPolicy::handle_error(*this, error_ptr.release());
-                }
+        if (error != nullptr) {
+            ErrorPolicy::handle_error(*this, error);
+        } else if (record != nullptr) {
+            auto duplicated_errors = ProfilePolicy::measure(profile, ProfiledStep::check_duplicates, [this] {
+                return previous_records.check_duplicates(*record);
+            });
+            for(auto &error_ptr : duplicated_errors) {
+                ErrorPolicy::handle_error(*this, error_ptr.release());
             }
 
-            try {
-                // Check warnings (non-blocking errors but potential mistakes anyway, only makes sense if the last record parsed was correct)
-                if (record != nullptr) {
-                    OptionalPolicy::optional_check_body_entry(*this, *record);
-                }
-            } catch (Error *warn) {
-                ErrorPolicy::handle_warning(*this, warn);
+            // Check warnings (non-blocking errors but potential mistakes anyway, only makes sense if the last record parsed was correct)
+            Error * warning = OptionalPolicy::optional_check_body_entry(*this, *record);
+            if (warning != nullptr) {
+                ErrorPolicy::handle_warning(*this, warning);
             }
-        } catch (Error *error) {
-            ErrorPolicy::handle_error(*this, error);
         }
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st597;
 st597:
 	if ( ++p == pe )
 		goto _test_eof597;
 case 597:
-#line 11338 "inc/vcf/validator_detail_v42.hpp"
+#line 11266 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 10: goto tr825;
 		case 13: goto tr826;
@@ -11350,12 +11278,11 @@ case 597:
 		goto tr832;
 	goto tr702;
 tr824:
-#line 70 "src/vcf/vcf.ragel"
+#line 66 "src/vcf/vcf.ragel"
 	{
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
     }
 	goto st531;
@@ -11363,7 +11290,7 @@ st531:
 	if ( ++p == pe )
 		goto _test_eof531;
 case 531:
-#line 11367 "inc/vcf/validator_detail_v42.hpp"
+#line 11294 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) < 65 ) {
 		if ( 48 <= (*p) && (*p) <= 57 )
 			goto tr759;
@@ -11376,24 +11303,24 @@ case 531:
 tr759:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st532;
 tr760:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st532;
 st532:
 	if ( ++p == pe )
 		goto _test_eof532;
 case 532:
-#line 11397 "inc/vcf/validator_detail_v42.hpp"
+#line 11324 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 59: goto tr760;
 		case 62: goto tr761;
@@ -11417,7 +11344,7 @@ st533:
 	if ( ++p == pe )
 		goto _test_eof533;
 case 533:
-#line 11421 "inc/vcf/validator_detail_v42.hpp"
+#line 11348 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 9 )
 		goto tr762;
 	goto tr702;
@@ -11426,65 +11353,58 @@ tr830:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 208 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 218 "src/vcf/vcf.ragel"
+#line 212 "src/vcf/vcf.ragel"
 	{
-        try {
-            // Handle all columns and build record
-            ParsePolicy::handle_body_line(*this);
+        // Handle all columns and build record
+        Error * error = ParsePolicy::handle_body_line(*this);
 
-            if (record != nullptr) {
-                auto duplicated_errors = previous_records.check_duplicates(*record);
-                for(auto &error_ptr : duplicated_errors) {
-                    ErrorPolicy::handle_error(*this, error_ptr.release());
-                }
+        if (error != nullptr) {
+            ErrorPolicy::handle_error(*this, error);
+        } else if (record != nullptr) {
+            auto duplicated_errors = ProfilePolicy::measure(profile, ProfiledStep::check_duplicates, [this] {
+                return previous_records.check_duplicates(*record);
+            });
+            for(auto &error_ptr : duplicated_errors) {
+                ErrorPolicy::handle_error(*this, error_ptr.release());
             }
 
-            try {
-                // Check warnings (non-blocking errors but potential mistakes anyway, only makes sense if the last record parsed was correct)
-                if (record != nullptr) {
-                    OptionalPolicy::optional_check_body_entry(*this, *record);
-                }
-            } catch (Error *warn) {
-                ErrorPolicy::handle_warning(*this, warn);
+            // Check warnings (non-blocking errors but potential mistakes anyway, only makes sense if the last record parsed was correct)
+            Error * warning = OptionalPolicy::optional_check_body_entry(*this, *record);
+            if (warning != nullptr) {
+                ErrorPolicy::handle_warning(*this, warning);
             }
-        } catch (Error *error) {
-            ErrorPolicy::handle_error(*this, error);
         }
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st534;
 st534:
 	if ( ++p == pe )
 		goto _test_eof534;
 case 534:
-#line 11474 "inc/vcf/validator_detail_v42.hpp"
+#line 11394 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 10 )
 		goto st597;
 	goto tr763;
 tr831:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st535;
 st535:
 	if ( ++p == pe )
 		goto _test_eof535;
 case 535:
-#line 11488 "inc/vcf/validator_detail_v42.hpp"
+#line 11408 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) > 57 ) {
 		if ( 59 <= (*p) && (*p) <= 126 )
 			goto tr766;
@@ -11494,24 +11414,24 @@ case 535:
 tr757:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st598;
 tr835:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st598;
 st598:
 	if ( ++p == pe )
 		goto _test_eof598;
 case 598:
-#line 11515 "inc/vcf/validator_detail_v42.hpp"
+#line 11435 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 9: goto tr752;
 		case 10: goto tr829;
@@ -11526,14 +11446,14 @@ case 598:
 tr834:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st599;
 st599:
 	if ( ++p == pe )
 		goto _test_eof599;
 case 599:
-#line 11537 "inc/vcf/validator_detail_v42.hpp"
+#line 11457 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 9: goto tr752;
 		case 10: goto tr829;
@@ -11553,24 +11473,24 @@ case 599:
 tr758:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st600;
 tr836:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st600;
 st600:
 	if ( ++p == pe )
 		goto _test_eof600;
 case 600:
-#line 11574 "inc/vcf/validator_detail_v42.hpp"
+#line 11494 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 9: goto tr752;
 		case 10: goto tr829;
@@ -11591,74 +11511,74 @@ case 600:
 tr748:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st536;
 st536:
 	if ( ++p == pe )
 		goto _test_eof536;
 case 536:
-#line 11606 "inc/vcf/validator_detail_v42.hpp"
+#line 11526 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 48 )
 		goto tr767;
 	goto tr746;
 tr767:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st537;
 st537:
 	if ( ++p == pe )
 		goto _test_eof537;
 case 537:
-#line 11620 "inc/vcf/validator_detail_v42.hpp"
+#line 11540 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 48 )
 		goto tr768;
 	goto tr746;
 tr768:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st538;
 st538:
 	if ( ++p == pe )
 		goto _test_eof538;
 case 538:
-#line 11634 "inc/vcf/validator_detail_v42.hpp"
+#line 11554 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 48 )
 		goto tr769;
 	goto tr746;
 tr769:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st539;
 st539:
 	if ( ++p == pe )
 		goto _test_eof539;
 case 539:
-#line 11648 "inc/vcf/validator_detail_v42.hpp"
+#line 11568 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 71 )
 		goto tr770;
 	goto tr746;
 tr770:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st601;
 st601:
 	if ( ++p == pe )
 		goto _test_eof601;
 case 601:
-#line 11662 "inc/vcf/validator_detail_v42.hpp"
+#line 11582 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 9: goto tr828;
 		case 10: goto tr829;
@@ -11677,7 +11597,7 @@ st540:
 	if ( ++p == pe )
 		goto _test_eof540;
 case 540:
-#line 11681 "inc/vcf/validator_detail_v42.hpp"
+#line 11601 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 49: goto tr748;
 		case 95: goto tr749;
@@ -11691,24 +11611,24 @@ case 540:
 tr749:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st602;
 tr839:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st602;
 st602:
 	if ( ++p == pe )
 		goto _test_eof602;
 case 602:
-#line 11712 "inc/vcf/validator_detail_v42.hpp"
+#line 11632 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 9: goto tr828;
 		case 10: goto tr829;
@@ -11730,14 +11650,14 @@ case 602:
 tr838:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st541;
 st541:
 	if ( ++p == pe )
 		goto _test_eof541;
 case 541:
-#line 11741 "inc/vcf/validator_detail_v42.hpp"
+#line 11661 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) > 58 ) {
 		if ( 60 <= (*p) && (*p) <= 126 )
 			goto tr772;
@@ -11747,14 +11667,14 @@ case 541:
 tr772:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st603;
 st603:
 	if ( ++p == pe )
 		goto _test_eof603;
 case 603:
-#line 11758 "inc/vcf/validator_detail_v42.hpp"
+#line 11678 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 9: goto tr828;
 		case 10: goto tr829;
@@ -11774,7 +11694,7 @@ st542:
 	if ( ++p == pe )
 		goto _test_eof542;
 case 542:
-#line 11778 "inc/vcf/validator_detail_v42.hpp"
+#line 11698 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 58 )
 		goto tr739;
 	if ( (*p) < 65 ) {
@@ -11801,18 +11721,18 @@ case 542:
 tr740:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st543;
 st543:
 	if ( ++p == pe )
 		goto _test_eof543;
 case 543:
-#line 11816 "inc/vcf/validator_detail_v42.hpp"
+#line 11736 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 9: goto tr744;
 		case 58: goto st525;
@@ -11841,28 +11761,28 @@ case 543:
 tr736:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st544;
 st544:
 	if ( ++p == pe )
 		goto _test_eof544;
 case 544:
-#line 11852 "inc/vcf/validator_detail_v42.hpp"
+#line 11772 "src/vcf/validator_detail_v42.cpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr773;
 	goto tr727;
 tr773:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st545;
 st545:
 	if ( ++p == pe )
 		goto _test_eof545;
 case 545:
-#line 11866 "inc/vcf/validator_detail_v42.hpp"
+#line 11786 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 9: goto tr735;
 		case 69: goto tr737;
@@ -11874,14 +11794,14 @@ case 545:
 tr737:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st546;
 st546:
 	if ( ++p == pe )
 		goto _test_eof546;
 case 546:
-#line 11885 "inc/vcf/validator_detail_v42.hpp"
+#line 11805 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 43: goto tr774;
 		case 45: goto tr774;
@@ -11892,28 +11812,28 @@ case 546:
 tr774:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st547;
 st547:
 	if ( ++p == pe )
 		goto _test_eof547;
 case 547:
-#line 11903 "inc/vcf/validator_detail_v42.hpp"
+#line 11823 "src/vcf/validator_detail_v42.cpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr775;
 	goto tr727;
 tr775:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st548;
 st548:
 	if ( ++p == pe )
 		goto _test_eof548;
 case 548:
-#line 11917 "inc/vcf/validator_detail_v42.hpp"
+#line 11837 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 9 )
 		goto tr735;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -11922,94 +11842,94 @@ case 548:
 tr731:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st549;
 tr734:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st549;
 st549:
 	if ( ++p == pe )
 		goto _test_eof549;
 case 549:
-#line 11943 "inc/vcf/validator_detail_v42.hpp"
+#line 11863 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 110 )
 		goto tr776;
 	goto tr727;
 tr776:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st550;
 st550:
 	if ( ++p == pe )
 		goto _test_eof550;
 case 550:
-#line 11957 "inc/vcf/validator_detail_v42.hpp"
+#line 11877 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 102 )
 		goto tr777;
 	goto tr727;
 tr729:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st551;
 tr777:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st551;
 st551:
 	if ( ++p == pe )
 		goto _test_eof551;
 case 551:
-#line 11981 "inc/vcf/validator_detail_v42.hpp"
+#line 11901 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 9 )
 		goto tr735;
 	goto tr727;
 tr732:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st552;
 st552:
 	if ( ++p == pe )
 		goto _test_eof552;
 case 552:
-#line 11999 "inc/vcf/validator_detail_v42.hpp"
+#line 11919 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 97 )
 		goto tr778;
 	goto tr727;
 tr778:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st553;
 st553:
 	if ( ++p == pe )
 		goto _test_eof553;
 case 553:
-#line 12013 "inc/vcf/validator_detail_v42.hpp"
+#line 11933 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 78 )
 		goto tr777;
 	goto tr727;
@@ -12023,7 +11943,7 @@ st554:
 	if ( ++p == pe )
 		goto _test_eof554;
 case 554:
-#line 12027 "inc/vcf/validator_detail_v42.hpp"
+#line 11947 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 42: goto tr719;
 		case 46: goto tr779;
@@ -12045,24 +11965,24 @@ case 554:
 tr779:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st555;
 tr803:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st555;
 st555:
 	if ( ++p == pe )
 		goto _test_eof555;
 case 555:
-#line 12066 "inc/vcf/validator_detail_v42.hpp"
+#line 11986 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 65: goto tr780;
 		case 67: goto tr780;
@@ -12079,14 +11999,14 @@ case 555:
 tr780:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st556;
 st556:
 	if ( ++p == pe )
 		goto _test_eof556;
 case 556:
-#line 12090 "inc/vcf/validator_detail_v42.hpp"
+#line 12010 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 9: goto tr725;
 		case 44: goto tr726;
@@ -12105,24 +12025,24 @@ case 556:
 tr721:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st557;
 tr781:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st557;
 st557:
 	if ( ++p == pe )
 		goto _test_eof557;
 case 557:
-#line 12126 "inc/vcf/validator_detail_v42.hpp"
+#line 12046 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 61 )
 		goto tr781;
 	if ( (*p) < 63 ) {
@@ -12155,14 +12075,14 @@ case 557:
 tr782:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st558;
 st558:
 	if ( ++p == pe )
 		goto _test_eof558;
 case 558:
-#line 12166 "inc/vcf/validator_detail_v42.hpp"
+#line 12086 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 62 )
 		goto tr783;
 	if ( (*p) < 45 ) {
@@ -12177,24 +12097,24 @@ case 558:
 tr722:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st559;
 tr784:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st559;
 st559:
 	if ( ++p == pe )
 		goto _test_eof559;
 case 559:
-#line 12198 "inc/vcf/validator_detail_v42.hpp"
+#line 12118 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 9: goto tr725;
 		case 44: goto tr726;
@@ -12216,14 +12136,14 @@ case 559:
 tr785:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st560;
 st560:
 	if ( ++p == pe )
 		goto _test_eof560;
 case 560:
-#line 12227 "inc/vcf/validator_detail_v42.hpp"
+#line 12147 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 60 )
 		goto tr788;
 	if ( (*p) < 65 ) {
@@ -12238,14 +12158,14 @@ case 560:
 tr787:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st561;
 st561:
 	if ( ++p == pe )
 		goto _test_eof561;
 case 561:
-#line 12249 "inc/vcf/validator_detail_v42.hpp"
+#line 12169 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 58: goto tr789;
 		case 61: goto tr787;
@@ -12262,28 +12182,28 @@ case 561:
 tr789:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st562;
 st562:
 	if ( ++p == pe )
 		goto _test_eof562;
 case 562:
-#line 12273 "inc/vcf/validator_detail_v42.hpp"
+#line 12193 "src/vcf/validator_detail_v42.cpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr790;
 	goto tr718;
 tr790:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st563;
 st563:
 	if ( ++p == pe )
 		goto _test_eof563;
 case 563:
-#line 12287 "inc/vcf/validator_detail_v42.hpp"
+#line 12207 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 91 )
 		goto tr783;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -12292,14 +12212,14 @@ case 563:
 tr788:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st564;
 st564:
 	if ( ++p == pe )
 		goto _test_eof564;
 case 564:
-#line 12303 "inc/vcf/validator_detail_v42.hpp"
+#line 12223 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) < 65 ) {
 		if ( 48 <= (*p) && (*p) <= 57 )
 			goto tr791;
@@ -12312,14 +12232,14 @@ case 564:
 tr791:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st565;
 st565:
 	if ( ++p == pe )
 		goto _test_eof565;
 case 565:
-#line 12323 "inc/vcf/validator_detail_v42.hpp"
+#line 12243 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 59: goto tr791;
 		case 62: goto tr792;
@@ -12336,28 +12256,28 @@ case 565:
 tr792:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st566;
 st566:
 	if ( ++p == pe )
 		goto _test_eof566;
 case 566:
-#line 12347 "inc/vcf/validator_detail_v42.hpp"
+#line 12267 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 58 )
 		goto tr789;
 	goto tr718;
 tr786:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st567;
 st567:
 	if ( ++p == pe )
 		goto _test_eof567;
 case 567:
-#line 12361 "inc/vcf/validator_detail_v42.hpp"
+#line 12281 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 60 )
 		goto tr794;
 	if ( (*p) < 65 ) {
@@ -12372,14 +12292,14 @@ case 567:
 tr793:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st568;
 st568:
 	if ( ++p == pe )
 		goto _test_eof568;
 case 568:
-#line 12383 "inc/vcf/validator_detail_v42.hpp"
+#line 12303 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 58: goto tr795;
 		case 61: goto tr793;
@@ -12396,28 +12316,28 @@ case 568:
 tr795:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st569;
 st569:
 	if ( ++p == pe )
 		goto _test_eof569;
 case 569:
-#line 12407 "inc/vcf/validator_detail_v42.hpp"
+#line 12327 "src/vcf/validator_detail_v42.cpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr796;
 	goto tr718;
 tr796:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st570;
 st570:
 	if ( ++p == pe )
 		goto _test_eof570;
 case 570:
-#line 12421 "inc/vcf/validator_detail_v42.hpp"
+#line 12341 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 93 )
 		goto tr783;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -12426,14 +12346,14 @@ case 570:
 tr794:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st571;
 st571:
 	if ( ++p == pe )
 		goto _test_eof571;
 case 571:
-#line 12437 "inc/vcf/validator_detail_v42.hpp"
+#line 12357 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) < 65 ) {
 		if ( 48 <= (*p) && (*p) <= 57 )
 			goto tr797;
@@ -12446,14 +12366,14 @@ case 571:
 tr797:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st572;
 st572:
 	if ( ++p == pe )
 		goto _test_eof572;
 case 572:
-#line 12457 "inc/vcf/validator_detail_v42.hpp"
+#line 12377 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 59: goto tr797;
 		case 62: goto tr798;
@@ -12470,32 +12390,32 @@ case 572:
 tr798:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st573;
 st573:
 	if ( ++p == pe )
 		goto _test_eof573;
 case 573:
-#line 12481 "inc/vcf/validator_detail_v42.hpp"
+#line 12401 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 58 )
 		goto tr795;
 	goto tr718;
 tr723:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st574;
 st574:
 	if ( ++p == pe )
 		goto _test_eof574;
 case 574:
-#line 12499 "inc/vcf/validator_detail_v42.hpp"
+#line 12419 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 60 )
 		goto tr800;
 	if ( (*p) < 65 ) {
@@ -12510,14 +12430,14 @@ case 574:
 tr799:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st575;
 st575:
 	if ( ++p == pe )
 		goto _test_eof575;
 case 575:
-#line 12521 "inc/vcf/validator_detail_v42.hpp"
+#line 12441 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 58: goto tr801;
 		case 61: goto tr799;
@@ -12534,28 +12454,28 @@ case 575:
 tr801:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st576;
 st576:
 	if ( ++p == pe )
 		goto _test_eof576;
 case 576:
-#line 12545 "inc/vcf/validator_detail_v42.hpp"
+#line 12465 "src/vcf/validator_detail_v42.cpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr802;
 	goto tr718;
 tr802:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st577;
 st577:
 	if ( ++p == pe )
 		goto _test_eof577;
 case 577:
-#line 12559 "inc/vcf/validator_detail_v42.hpp"
+#line 12479 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 91 )
 		goto tr803;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -12564,14 +12484,14 @@ case 577:
 tr800:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st578;
 st578:
 	if ( ++p == pe )
 		goto _test_eof578;
 case 578:
-#line 12575 "inc/vcf/validator_detail_v42.hpp"
+#line 12495 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) < 65 ) {
 		if ( 48 <= (*p) && (*p) <= 57 )
 			goto tr804;
@@ -12584,14 +12504,14 @@ case 578:
 tr804:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st579;
 st579:
 	if ( ++p == pe )
 		goto _test_eof579;
 case 579:
-#line 12595 "inc/vcf/validator_detail_v42.hpp"
+#line 12515 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 59: goto tr804;
 		case 62: goto tr805;
@@ -12608,32 +12528,32 @@ case 579:
 tr805:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st580;
 st580:
 	if ( ++p == pe )
 		goto _test_eof580;
 case 580:
-#line 12619 "inc/vcf/validator_detail_v42.hpp"
+#line 12539 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 58 )
 		goto tr801;
 	goto tr718;
 tr724:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st581;
 st581:
 	if ( ++p == pe )
 		goto _test_eof581;
 case 581:
-#line 12637 "inc/vcf/validator_detail_v42.hpp"
+#line 12557 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 60 )
 		goto tr807;
 	if ( (*p) < 65 ) {
@@ -12648,14 +12568,14 @@ case 581:
 tr806:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st582;
 st582:
 	if ( ++p == pe )
 		goto _test_eof582;
 case 582:
-#line 12659 "inc/vcf/validator_detail_v42.hpp"
+#line 12579 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 58: goto tr808;
 		case 61: goto tr806;
@@ -12672,28 +12592,28 @@ case 582:
 tr808:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st583;
 st583:
 	if ( ++p == pe )
 		goto _test_eof583;
 case 583:
-#line 12683 "inc/vcf/validator_detail_v42.hpp"
+#line 12603 "src/vcf/validator_detail_v42.cpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr809;
 	goto tr718;
 tr809:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st584;
 st584:
 	if ( ++p == pe )
 		goto _test_eof584;
 case 584:
-#line 12697 "inc/vcf/validator_detail_v42.hpp"
+#line 12617 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 93 )
 		goto tr803;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -12702,14 +12622,14 @@ case 584:
 tr807:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st585;
 st585:
 	if ( ++p == pe )
 		goto _test_eof585;
 case 585:
-#line 12713 "inc/vcf/validator_detail_v42.hpp"
+#line 12633 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) < 65 ) {
 		if ( 48 <= (*p) && (*p) <= 57 )
 			goto tr810;
@@ -12722,14 +12642,14 @@ case 585:
 tr810:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st586;
 st586:
 	if ( ++p == pe )
 		goto _test_eof586;
 case 586:
-#line 12733 "inc/vcf/validator_detail_v42.hpp"
+#line 12653 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 59: goto tr810;
 		case 62: goto tr811;
@@ -12746,32 +12666,32 @@ case 586:
 tr811:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st587;
 st587:
 	if ( ++p == pe )
 		goto _test_eof587;
 case 587:
-#line 12757 "inc/vcf/validator_detail_v42.hpp"
+#line 12677 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 58 )
 		goto tr808;
 	goto tr718;
 tr720:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st588;
 st588:
 	if ( ++p == pe )
 		goto _test_eof588;
 case 588:
-#line 12775 "inc/vcf/validator_detail_v42.hpp"
+#line 12695 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 9: goto tr725;
 		case 65: goto tr780;
@@ -12787,51 +12707,43 @@ case 588:
 	}
 	goto tr718;
 tr686:
-#line 208 "src/vcf/vcf.ragel"
+#line 202 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_header_line(*this);
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st589;
 tr698:
-#line 204 "src/vcf/vcf.ragel"
+#line 198 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_sample_name(*this);
     }
-#line 208 "src/vcf/vcf.ragel"
+#line 202 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_header_line(*this);
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st589;
 st589:
 	if ( ++p == pe )
 		goto _test_eof589;
 case 589:
-#line 12830 "inc/vcf/validator_detail_v42.hpp"
+#line 12742 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 10 )
 		goto st593;
 	goto tr687;
 tr23:
-#line 99 "src/vcf/vcf.ragel"
+#line 93 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_fileformat(*this);
@@ -12842,40 +12754,32 @@ tr23:
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st590;
 st590:
 	if ( ++p == pe )
 		goto _test_eof590;
 case 590:
-#line 12859 "inc/vcf/validator_detail_v42.hpp"
+#line 12767 "src/vcf/validator_detail_v42.cpp"
 	if ( (*p) == 10 )
 		goto st22;
 	goto tr0;
 tr816:
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st591;
 st591:
 	if ( ++p == pe )
 		goto _test_eof591;
 case 591:
-#line 12879 "inc/vcf/validator_detail_v42.hpp"
+#line 12783 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 10: goto tr815;
 		case 13: goto tr816;
@@ -12884,40 +12788,32 @@ case 591:
 tr815:
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
-#line 231 "src/vcf/vcf_v42.ragel"
+#line 233 "src/vcf/vcf_v42.ragel"
 	{ {goto st28;} }
 	goto st604;
 st604:
 	if ( ++p == pe )
 		goto _test_eof604;
 case 604:
-#line 12903 "inc/vcf/validator_detail_v42.hpp"
+#line 12803 "src/vcf/validator_detail_v42.cpp"
 	goto st0;
 tr819:
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st592;
 st592:
 	if ( ++p == pe )
 		goto _test_eof592;
 case 592:
-#line 12921 "inc/vcf/validator_detail_v42.hpp"
+#line 12817 "src/vcf/validator_detail_v42.cpp"
 	switch( (*p) ) {
 		case 10: goto tr818;
 		case 13: goto tr819;
@@ -12926,22 +12822,18 @@ case 592:
 tr818:
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
-#line 232 "src/vcf/vcf_v42.ragel"
+#line 234 "src/vcf/vcf_v42.ragel"
 	{ {goto st597;} }
 	goto st605;
 st605:
 	if ( ++p == pe )
 		goto _test_eof605;
 case 605:
-#line 12945 "inc/vcf/validator_detail_v42.hpp"
+#line 12837 "src/vcf/validator_detail_v42.cpp"
 	goto st0;
 	}
 	_test_eof2: cs = 2; goto _test_eof; 
@@ -13567,7 +13459,7 @@ case 605:
 	case 12: 
 	case 13: 
 	case 590: 
-#line 60 "src/vcf/vcf.ragel"
+#line 56 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
         p--; {goto st591;}
@@ -13621,19 +13513,18 @@ case 605:
 	case 71: 
 	case 72: 
 	case 73: 
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	break;
 	case 593: 
-#line 70 "src/vcf/vcf.ragel"
+#line 66 "src/vcf/vcf.ragel"
 	{
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
     }
 	break;
@@ -13647,22 +13538,21 @@ case 605:
 	case 509: 
 	case 510: 
 	case 589: 
-#line 78 "src/vcf/vcf.ragel"
+#line 73 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st592;}
     }
 	break;
 	case 534: 
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st592;}
@@ -13690,12 +13580,12 @@ case 605:
 	case 96: 
 	case 103: 
 	case 114: 
-#line 247 "src/vcf/vcf.ragel"
+#line 238 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
@@ -13709,12 +13599,12 @@ case 605:
 	case 380: 
 	case 381: 
 	case 382: 
-#line 259 "src/vcf/vcf.ragel"
+#line 250 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
@@ -13749,12 +13639,12 @@ case 605:
 	case 430: 
 	case 431: 
 	case 432: 
-#line 265 "src/vcf/vcf.ragel"
+#line 256 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
@@ -13784,12 +13674,12 @@ case 605:
 	case 147: 
 	case 154: 
 	case 165: 
-#line 271 "src/vcf/vcf.ragel"
+#line 262 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
@@ -13831,12 +13721,12 @@ case 605:
 	case 213: 
 	case 220: 
 	case 231: 
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
@@ -13877,12 +13767,12 @@ case 605:
 	case 279: 
 	case 286: 
 	case 297: 
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
@@ -13898,12 +13788,12 @@ case 605:
 	case 313: 
 	case 314: 
 	case 321: 
-#line 299 "src/vcf/vcf.ragel"
+#line 290 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
@@ -13920,12 +13810,12 @@ case 605:
 	case 441: 
 	case 442: 
 	case 443: 
-#line 320 "src/vcf/vcf.ragel"
+#line 311 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
@@ -13942,12 +13832,12 @@ case 605:
 	case 330: 
 	case 331: 
 	case 371: 
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
@@ -13990,29 +13880,27 @@ case 605:
 	case 499: 
 	case 500: 
 	case 501: 
-#line 379 "src/vcf/vcf.ragel"
+#line 370 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
             "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st592;}
     }
-#line 78 "src/vcf/vcf.ragel"
+#line 73 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st592;}
@@ -14022,12 +13910,12 @@ case 605:
 	case 531: 
 	case 532: 
 	case 533: 
-#line 396 "src/vcf/vcf.ragel"
+#line 386 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new ChromosomeBodyError{n_lines});
         p--; {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st592;}
@@ -14035,12 +13923,12 @@ case 605:
 	break;
 	case 513: 
 	case 514: 
-#line 402 "src/vcf/vcf.ragel"
+#line 392 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new PositionBodyError{n_lines});
         p--; {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st592;}
@@ -14048,12 +13936,12 @@ case 605:
 	break;
 	case 515: 
 	case 516: 
-#line 408 "src/vcf/vcf.ragel"
+#line 398 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new IdBodyError{n_lines});
         p--; {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st592;}
@@ -14061,12 +13949,12 @@ case 605:
 	break;
 	case 517: 
 	case 518: 
-#line 414 "src/vcf/vcf.ragel"
+#line 404 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new ReferenceAlleleBodyError{n_lines});
         p--; {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st592;}
@@ -14109,12 +13997,12 @@ case 605:
 	case 586: 
 	case 587: 
 	case 588: 
-#line 420 "src/vcf/vcf.ragel"
+#line 410 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new AlternateAllelesBodyError{n_lines});
         p--; {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st592;}
@@ -14133,12 +14021,12 @@ case 605:
 	case 551: 
 	case 552: 
 	case 553: 
-#line 426 "src/vcf/vcf.ragel"
+#line 416 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new QualityBodyError{n_lines});
         p--; {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st592;}
@@ -14149,26 +14037,27 @@ case 605:
 	case 526: 
 	case 542: 
 	case 543: 
-#line 432 "src/vcf/vcf.ragel"
+#line 422 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FilterBodyError{n_lines});
         p--; {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st592;}
     }
 	break;
 	case 535: 
-#line 454 "src/vcf/vcf.ragel"
+#line 444 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " is not a valid string";
-        ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str()});
+        ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str(), "",
+                                                              "Sample is not a valid string"});
         p--; {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st592;}
@@ -14182,13 +14071,13 @@ case 605:
 	case 19: 
 	case 20: 
 	case 21: 
-#line 29 "src/vcf/vcf_v42.ragel"
+#line 31 "src/vcf/vcf_v42.ragel"
 	{
         ErrorPolicy::handle_error(*this,
                 new FileformatError{n_lines, "The fileformat declaration is not 'fileformat=VCFv4.2'"});
         p--; {goto st591;}
     }
-#line 60 "src/vcf/vcf.ragel"
+#line 56 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
         p--; {goto st591;}
@@ -14196,12 +14085,12 @@ case 605:
 	break;
 	case 528: 
 	case 529: 
-#line 50 "src/vcf/vcf_v42.ragel"
+#line 52 "src/vcf/vcf_v42.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FormatBodyError{n_lines});
         p--; {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st592;}
@@ -14219,66 +14108,61 @@ case 605:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 208 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 218 "src/vcf/vcf.ragel"
+#line 212 "src/vcf/vcf.ragel"
 	{
-        try {
-            // Handle all columns and build record
-            ParsePolicy::handle_body_line(*this);
+        // Handle all columns and build record
+        Error * error = ParsePolicy::handle_body_line(*this);
 
-            if (record != nullptr) {
-                auto duplicated_errors = previous_records.check_duplicates(*record);
-                for(auto &error_ptr : duplicated_errors) {
-                    ErrorPolicy::handle_error(*this, error_ptr.release());
-                }
+        if (error != nullptr) {
+            ErrorPolicy::handle_error(*this, error);
+        } else if (record != nullptr) {
+            auto duplicated_errors = ProfilePolicy::measure(profile, ProfiledStep::check_duplicates, [this] {
+                return previous_records.check_duplicates(*record);
+            });
+            for(auto &error_ptr : duplicated_errors) {
+                ErrorPolicy::handle_error(*this, error_ptr.release());
             }
 
-            try {
-                // Check warnings (non-blocking errors but potential mistakes anyway, only makes sense if the last record parsed was correct)
-                if (record != nullptr) {
-                    OptionalPolicy::optional_check_body_entry(*this, *record);
-                }
-            } catch (Error *warn) {
-                ErrorPolicy::handle_warning(*this, warn);
+            // Check warnings (non-blocking errors but potential mistakes anyway, only makes sense if the last record parsed was correct)
+            Error * warning = OptionalPolicy::optional_check_body_entry(*this, *record);
+            if (warning != nullptr) {
+                ErrorPolicy::handle_warning(*this, warning);
             }
-        } catch (Error *error) {
-            ErrorPolicy::handle_error(*this, error);
         }
     }
 	break;
 	case 23: 
 	case 28: 
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
-#line 379 "src/vcf/vcf.ragel"
+#line 370 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
             "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st592;}
     }
-#line 78 "src/vcf/vcf.ragel"
+#line 73 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st592;}
@@ -14287,35 +14171,35 @@ case 605:
 	case 81: 
 	case 82: 
 	case 83: 
-#line 252 "src/vcf/vcf.ragel"
+#line 243 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines,
             "ALT metadata ID is not prefixed by DEL/INS/DUP/INV/CNV and suffixed by ':' and a text sequence"});
         p--; {goto st591;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 238 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	break;
 	case 122: 
-#line 271 "src/vcf/vcf.ragel"
+#line 262 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
         p--; {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
@@ -14323,17 +14207,17 @@ case 605:
 	break;
 	case 199: 
 	case 200: 
-#line 293 "src/vcf/vcf.ragel"
+#line 284 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String"});
         p--; {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
@@ -14341,17 +14225,17 @@ case 605:
 	break;
 	case 265: 
 	case 266: 
-#line 293 "src/vcf/vcf.ragel"
+#line 284 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String"});
         p--; {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
@@ -14366,17 +14250,17 @@ case 605:
 	case 341: 
 	case 342: 
 	case 343: 
-#line 352 "src/vcf/vcf.ragel"
+#line 343 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)"});
         p--; {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
@@ -14391,17 +14275,17 @@ case 605:
 	case 351: 
 	case 352: 
 	case 353: 
-#line 357 "src/vcf/vcf.ragel"
+#line 348 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)"});
         p--; {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
@@ -14410,17 +14294,17 @@ case 605:
 	case 100: 
 	case 101: 
 	case 102: 
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st591;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 238 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
@@ -14428,17 +14312,17 @@ case 605:
 	break;
 	case 412: 
 	case 413: 
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st591;}
     }
-#line 265 "src/vcf/vcf.ragel"
+#line 256 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
@@ -14450,17 +14334,17 @@ case 605:
 	case 151: 
 	case 152: 
 	case 153: 
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st591;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 262 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
@@ -14472,17 +14356,17 @@ case 605:
 	case 217: 
 	case 218: 
 	case 219: 
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
@@ -14494,17 +14378,17 @@ case 605:
 	case 283: 
 	case 284: 
 	case 285: 
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
@@ -14516,17 +14400,17 @@ case 605:
 	case 318: 
 	case 319: 
 	case 320: 
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st591;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 290 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
@@ -14534,17 +14418,17 @@ case 605:
 	break;
 	case 332: 
 	case 333: 
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
@@ -14564,17 +14448,17 @@ case 605:
 	case 116: 
 	case 120: 
 	case 121: 
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st591;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 238 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
@@ -14594,17 +14478,17 @@ case 605:
 	case 167: 
 	case 171: 
 	case 172: 
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st591;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 262 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
@@ -14624,17 +14508,17 @@ case 605:
 	case 233: 
 	case 237: 
 	case 238: 
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
@@ -14654,17 +14538,17 @@ case 605:
 	case 299: 
 	case 303: 
 	case 304: 
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
@@ -14689,17 +14573,17 @@ case 605:
 	case 372: 
 	case 373: 
 	case 374: 
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
@@ -14724,17 +14608,17 @@ case 605:
 	case 399: 
 	case 400: 
 	case 401: 
-#line 373 "src/vcf/vcf.ragel"
+#line 364 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata URL is not valid"});
         p--; {goto st591;}
     }
-#line 259 "src/vcf/vcf.ragel"
+#line 250 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
@@ -14761,17 +14645,17 @@ case 605:
 	case 462: 
 	case 463: 
 	case 464: 
-#line 373 "src/vcf/vcf.ragel"
+#line 364 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata URL is not valid"});
         p--; {goto st591;}
     }
-#line 320 "src/vcf/vcf.ragel"
+#line 311 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
@@ -14783,55 +14667,57 @@ case 605:
 	case 538: 
 	case 539: 
 	case 540: 
-#line 443 "src/vcf/vcf.ragel"
+#line 433 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info key is not a sequence of alphanumeric and/or punctuation characters"});
         p--; {goto st592;}
     }
-#line 438 "src/vcf/vcf.ragel"
+#line 428 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
         p--; {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st592;}
     }
 	break;
 	case 541: 
-#line 448 "src/vcf/vcf.ragel"
+#line 438 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info field value is not a comma-separated list of valid strings (maybe it contains whitespaces?)"});
         p--; {goto st592;}
     }
-#line 438 "src/vcf/vcf.ragel"
+#line 428 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
         p--; {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st592;}
     }
 	break;
 	case 530: 
-#line 461 "src/vcf/vcf.ragel"
+#line 452 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " does not start with a valid genotype";
-        ErrorPolicy::handle_error(*this, new SamplesFieldBodyError{n_lines, message_stream.str(), "", "GT"});
+        ErrorPolicy::handle_error(*this, new SamplesFieldBodyError{n_lines, message_stream.str(), "", "GT", -1,
+                                                                   "Sample does not start with a valid genotype"});
         p--; {goto st592;}
     }
-#line 454 "src/vcf/vcf.ragel"
+#line 444 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " is not a valid string";
-        ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str()});
+        ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str(), "",
+                                                              "Sample is not a valid string"});
         p--; {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st592;}
@@ -14840,17 +14726,17 @@ case 605:
 	case 192: 
 	case 193: 
 	case 239: 
-#line 36 "src/vcf/vcf_v42.ragel"
+#line 38 "src/vcf/vcf_v42.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "FORMAT metadata Number is not a number, A, R, G or dot"});
         p--; {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
@@ -14859,122 +14745,120 @@ case 605:
 	case 258: 
 	case 259: 
 	case 305: 
-#line 42 "src/vcf/vcf_v42.ragel"
+#line 44 "src/vcf/vcf_v42.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Number is not a number, A, R, G or dot"});
         p--; {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	break;
 	case 22: 
-#line 60 "src/vcf/vcf.ragel"
+#line 56 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
-#line 379 "src/vcf/vcf.ragel"
+#line 370 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
             "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st592;}
     }
-#line 78 "src/vcf/vcf.ragel"
+#line 73 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st592;}
     }
 	break;
 	case 344: 
-#line 352 "src/vcf/vcf.ragel"
+#line 343 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)"});
         p--; {goto st591;}
     }
-#line 357 "src/vcf/vcf.ragel"
+#line 348 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)"});
         p--; {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	break;
 	case 354: 
-#line 357 "src/vcf/vcf.ragel"
+#line 348 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)"});
         p--; {goto st591;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	break;
 	case 334: 
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st591;}
     }
-#line 352 "src/vcf/vcf.ragel"
+#line 343 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)"});
         p--; {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
@@ -14983,22 +14867,22 @@ case 605:
 	case 108: 
 	case 109: 
 	case 110: 
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st591;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st591;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 238 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
@@ -15007,22 +14891,22 @@ case 605:
 	case 159: 
 	case 160: 
 	case 161: 
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st591;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st591;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 262 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
@@ -15031,22 +14915,22 @@ case 605:
 	case 225: 
 	case 226: 
 	case 227: 
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st591;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
@@ -15055,22 +14939,22 @@ case 605:
 	case 291: 
 	case 292: 
 	case 293: 
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st591;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
@@ -15079,22 +14963,22 @@ case 605:
 	case 117: 
 	case 118: 
 	case 119: 
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st591;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st591;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 238 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
@@ -15103,22 +14987,22 @@ case 605:
 	case 168: 
 	case 169: 
 	case 170: 
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st591;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st591;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 262 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
@@ -15127,22 +15011,22 @@ case 605:
 	case 234: 
 	case 235: 
 	case 236: 
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st591;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
@@ -15151,89 +15035,177 @@ case 605:
 	case 300: 
 	case 301: 
 	case 302: 
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st591;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	break;
 	case 24: 
-#line 247 "src/vcf/vcf.ragel"
+#line 238 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
         p--; {goto st591;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 262 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
         p--; {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st591;}
     }
-#line 259 "src/vcf/vcf.ragel"
+#line 250 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
         p--; {goto st591;}
     }
-#line 265 "src/vcf/vcf.ragel"
+#line 256 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
         p--; {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st591;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 290 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
         p--; {goto st591;}
     }
-#line 320 "src/vcf/vcf.ragel"
+#line 311 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
         p--; {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st591;}
     }
 	break;
-#line 15228 "inc/vcf/validator_detail_v42.hpp"
+#line 15112 "src/vcf/validator_detail_v42.cpp"
 	}
 	}
 
 	_out: {}
 	}
 
-#line 261 "src/vcf/vcf_v42.ragel"
+#line 268 "src/vcf/vcf_v42.ragel"
+
+      }
 
+      ParsePolicy::handle_buffer_end(*this, pe);
     }
+
+    template <typename Configuration>
+    void ParserImpl_v42<Configuration>::report_pending_records()
+    {
+      size_t lines_read = n_lines;
+
+      for (size_t i = 0; i < n_pending_records; ++i) {
+        PendingRecord & pending = pending_records[i];
+        Record const & pending_record = *pending.record;
+        n_lines = pending_record.line;  // as if the record had just been read
+
+        Error * error = pending.error;
+        pending.error = nullptr;
+        if (error == nullptr) {
+          error = ParsePolicy::handle_checked_record(*this, pending_record);
+        }
+        if (error != nullptr) {
+          ErrorPolicy::handle_error(*this, error);
+          continue;
+        }
+
+        auto duplicated_errors = ProfilePolicy::measure(profile, ProfiledStep::check_duplicates, [&] {
+          return previous_records.check_duplicates(pending_record);
+        });
+        for (auto &error_ptr : duplicated_errors) {
+          ErrorPolicy::handle_error(*this, error_ptr.release());
+        }
+
+        Error * warning = OptionalPolicy::optional_check_body_entry(*this, pending_record);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
+        }
+      }
+
+      n_pending_records = 0;
+      n_lines = lines_read;
+    }
+
+    template <typename Configuration>
+    ParserImpl * ParserImpl_v42<Configuration>::new_body_parser(std::shared_ptr<Source> source) const
+    {
+      auto parser = new ParserImpl_v42<Configuration>{source};
+      parser->cs = vcf_v42_en_main_body_section;
+      return parser;
+    }
+
+    template <typename Configuration>
+    size_t ParserImpl_v42<Configuration>::line_buffers_size() const
+    {
+      return ParsePolicy::line_buffers_size();
+    }
+
+    template <typename Configuration>
+    size_t ParserImpl_v42<Configuration>::header_size() const
+    {
+      return ParsePolicy::header_size();
+    }
+
+    template <typename Configuration>
+    bool ParserImpl_v42<Configuration>::skips_valid_lines() const
+    {
+      return ParsePolicy::skips_valid_lines;
+    }
+
+    template <typename Configuration>
+    char const * ParserImpl_v42<Configuration>::skip_valid_lines(char const * p, char const * pe)
+    {
+      if (cs != vcf_v42_en_main_body_section) {
+        return p;
+      }
+      typename ProfilePolicy::ParsingTimer parsing_timer{profile};
+      return ParsePolicy::skip_valid_lines(*this, p, pe);
+    }
+
+    // the only configurations of the parser, so the machine is compiled once, here
+    template class ParserImpl_v42<QuickValidatorCfg>;
+    template class ParserImpl_v42<FullValidatorCfg>;
+    template class ParserImpl_v42<ReaderCfg>;
+    template class ParserImpl_v42<ProfiledQuickValidatorCfg>;
+    template class ParserImpl_v42<ProfiledFullValidatorCfg>;
+    template class ParserImpl_v42<ProfiledReaderCfg>;
+    template class ParserImpl_v42<OrderValidatorCfg>;
+    template class ParserImpl_v42<RecordsValidatorCfg>;
+    template class ParserImpl_v42<ProfiledOrderValidatorCfg>;
+    template class ParserImpl_v42<ProfiledRecordsValidatorCfg>;
    
   }
 }
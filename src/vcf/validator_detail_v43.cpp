@@ -16,14 +16,16 @@
  * limitations under the License.
  */
 
+#include "vcf/validator.hpp"
 
-#line 263 "src/vcf/vcf_v43.ragel"
+
+#line 265 "src/vcf/vcf_v43.ragel"
 
 
 namespace
 {
   
-#line 27 "inc/vcf/validator_detail_v43.hpp"
+#line 29 "src/vcf/validator_detail_v43.cpp"
 static const int vcf_v43_start = 1;
 static const int vcf_v43_first_final = 661;
 static const int vcf_v43_error = 0;
@@ -35,7 +37,7 @@ static const int vcf_v43_en_meta_section_skip = 659;
 static const int vcf_v43_en_body_section_skip = 660;
 
 
-#line 269 "src/vcf/vcf_v43.ragel"
+#line 271 "src/vcf/vcf_v43.ragel"
 
 }
 
@@ -49,20 +51,25 @@ namespace ebi
     : ParserImpl{source}
     {
       
-#line 53 "inc/vcf/validator_detail_v43.hpp"
+#line 55 "src/vcf/validator_detail_v43.cpp"
 	{
 	cs = vcf_v43_start;
 	}
 
-#line 283 "src/vcf/vcf_v43.ragel"
+#line 285 "src/vcf/vcf_v43.ragel"
 
     }
 
     template <typename Configuration>
     void ParserImpl_v43<Configuration>::parse_buffer(char const * p, char const * pe, char const * eof)
     {
-      
-#line 66 "inc/vcf/validator_detail_v43.hpp"
+      ParsePolicy::handle_buffer_begin(*this, p);
+
+      {
+        typename ProfilePolicy::ParsingTimer parsing_timer{profile};
+
+        
+#line 73 "src/vcf/validator_detail_v43.cpp"
 	{
 	if ( p == pe )
 		goto _test_eof;
@@ -73,1155 +80,1150 @@ case 1:
 		goto st2;
 	goto tr0;
 tr0:
-#line 60 "src/vcf/vcf.ragel"
+#line 56 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr14:
-#line 29 "src/vcf/vcf_v43.ragel"
+#line 31 "src/vcf/vcf_v43.ragel"
 	{
         ErrorPolicy::handle_error(*this,
                 new FileformatError{n_lines, "The fileformat declaration is not 'fileformat=VCFv4.3'"});
         p--; {goto st659;}
     }
-#line 60 "src/vcf/vcf.ragel"
+#line 56 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr24:
-#line 60 "src/vcf/vcf.ragel"
+#line 56 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
-#line 379 "src/vcf/vcf.ragel"
+#line 370 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
             "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st660;}
     }
-#line 78 "src/vcf/vcf.ragel"
+#line 73 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st660;}
     }
 	goto st0;
 tr26:
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
-#line 379 "src/vcf/vcf.ragel"
+#line 370 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
             "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st660;}
     }
-#line 78 "src/vcf/vcf.ragel"
+#line 73 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st660;}
     }
 	goto st0;
 tr29:
-#line 247 "src/vcf/vcf.ragel"
+#line 238 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
         p--; {goto st659;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 262 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
         p--; {goto st659;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st659;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st659;}
     }
-#line 259 "src/vcf/vcf.ragel"
+#line 250 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
         p--; {goto st659;}
     }
-#line 265 "src/vcf/vcf.ragel"
+#line 256 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
         p--; {goto st659;}
     }
-#line 326 "src/vcf/vcf.ragel"
+#line 317 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in META metadata"});
         p--; {goto st659;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st659;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 290 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
         p--; {goto st659;}
     }
-#line 320 "src/vcf/vcf.ragel"
+#line 311 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr40:
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr126:
-#line 247 "src/vcf/vcf.ragel"
+#line 238 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr134:
-#line 252 "src/vcf/vcf.ragel"
+#line 243 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines,
             "ALT metadata ID is not prefixed by DEL/INS/DUP/INV/CNV and suffixed by ':' and a text sequence"});
         p--; {goto st659;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 238 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr153:
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st659;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 238 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr162:
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st659;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 238 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr176:
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st659;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st659;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 238 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr188:
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st659;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st659;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 238 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr194:
-#line 271 "src/vcf/vcf.ragel"
+#line 262 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
         p--; {goto st659;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr197:
-#line 271 "src/vcf/vcf.ragel"
+#line 262 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr207:
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st659;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 262 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr226:
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st659;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 262 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr248:
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st659;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st659;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 262 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr260:
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st659;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st659;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 262 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr266:
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr276:
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st659;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr289:
-#line 36 "src/vcf/vcf_v43.ragel"
+#line 38 "src/vcf/vcf_v43.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "FORMAT metadata Number is not a number, A, R, G or dot"});
         p--; {goto st659;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr298:
-#line 293 "src/vcf/vcf.ragel"
+#line 284 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String"});
         p--; {goto st659;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr315:
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st659;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr337:
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st659;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st659;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr349:
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st659;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st659;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr356:
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr365:
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st659;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr378:
-#line 42 "src/vcf/vcf_v43.ragel"
+#line 44 "src/vcf/vcf_v43.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Number is not a number, A, R, G or dot"});
         p--; {goto st659;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr387:
-#line 293 "src/vcf/vcf.ragel"
+#line 284 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String"});
         p--; {goto st659;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr404:
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st659;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr426:
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st659;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st659;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr438:
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st659;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st659;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr445:
-#line 326 "src/vcf/vcf.ragel"
+#line 317 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in META metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr454:
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st659;}
     }
-#line 326 "src/vcf/vcf.ragel"
+#line 317 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in META metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr467:
-#line 331 "src/vcf/vcf.ragel"
+#line 322 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "META metadata Number is not a dot"});
         p--; {goto st659;}
     }
-#line 326 "src/vcf/vcf.ragel"
+#line 317 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in META metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr475:
-#line 336 "src/vcf/vcf.ragel"
+#line 327 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "META metadata Type is not String"});
         p--; {goto st659;}
     }
-#line 326 "src/vcf/vcf.ragel"
+#line 317 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in META metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr492:
-#line 341 "src/vcf/vcf.ragel"
+#line 332 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "META metadata Values is not a square-bracket delimited list of values"});
         p--; {goto st659;}
     }
-#line 326 "src/vcf/vcf.ragel"
+#line 317 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in META metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr498:
-#line 299 "src/vcf/vcf.ragel"
+#line 290 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr511:
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st659;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 290 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr517:
-#line 314 "src/vcf/vcf.ragel"
+#line 305 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "PEDIGREE metadata sequence of Name_N is not valid"});
         p--; {goto st659;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 290 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr527:
-#line 309 "src/vcf/vcf.ragel"
+#line 300 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "PEDIGREE metadata Father or Mother is not valid"});
         p--; {goto st659;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 290 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr564:
-#line 304 "src/vcf/vcf.ragel"
+#line 295 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "PEDIGREE metadata Original is not valid"});
         p--; {goto st659;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 290 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr569:
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr580:
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st659;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr620:
-#line 259 "src/vcf/vcf.ragel"
+#line 250 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr629:
-#line 373 "src/vcf/vcf.ragel"
+#line 364 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata URL is not valid"});
         p--; {goto st659;}
     }
-#line 259 "src/vcf/vcf.ragel"
+#line 250 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr650:
-#line 265 "src/vcf/vcf.ragel"
+#line 256 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr661:
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st659;}
     }
-#line 265 "src/vcf/vcf.ragel"
+#line 256 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr699:
-#line 320 "src/vcf/vcf.ragel"
+#line 311 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr711:
-#line 373 "src/vcf/vcf.ragel"
+#line 364 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata URL is not valid"});
         p--; {goto st659;}
     }
-#line 320 "src/vcf/vcf.ragel"
+#line 311 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	goto st0;
 tr734:
-#line 379 "src/vcf/vcf.ragel"
+#line 370 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
             "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st660;}
     }
-#line 78 "src/vcf/vcf.ragel"
+#line 73 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st660;}
     }
 	goto st0;
 tr774:
-#line 78 "src/vcf/vcf.ragel"
+#line 73 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st660;}
     }
 	goto st0;
 tr789:
-#line 396 "src/vcf/vcf.ragel"
+#line 386 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new ChromosomeBodyError{n_lines});
         p--; {goto st660;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st660;}
     }
 	goto st0;
 tr792:
-#line 402 "src/vcf/vcf.ragel"
+#line 392 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new PositionBodyError{n_lines});
         p--; {goto st660;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st660;}
     }
 	goto st0;
 tr796:
-#line 408 "src/vcf/vcf.ragel"
+#line 398 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new IdBodyError{n_lines});
         p--; {goto st660;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st660;}
     }
 	goto st0;
 tr801:
-#line 414 "src/vcf/vcf.ragel"
+#line 404 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new ReferenceAlleleBodyError{n_lines});
         p--; {goto st660;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st660;}
     }
 	goto st0;
 tr805:
-#line 420 "src/vcf/vcf.ragel"
+#line 410 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new AlternateAllelesBodyError{n_lines});
         p--; {goto st660;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st660;}
     }
 	goto st0;
 tr814:
-#line 426 "src/vcf/vcf.ragel"
+#line 416 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new QualityBodyError{n_lines});
         p--; {goto st660;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st660;}
     }
 	goto st0;
 tr825:
-#line 432 "src/vcf/vcf.ragel"
+#line 422 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FilterBodyError{n_lines});
         p--; {goto st660;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st660;}
     }
 	goto st0;
 tr833:
-#line 443 "src/vcf/vcf.ragel"
+#line 433 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info key is not a sequence of alphanumeric and/or punctuation characters"});
         p--; {goto st660;}
     }
-#line 438 "src/vcf/vcf.ragel"
+#line 428 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
         p--; {goto st660;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st660;}
     }
 	goto st0;
 tr837:
-#line 50 "src/vcf/vcf_v43.ragel"
+#line 52 "src/vcf/vcf_v43.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FormatBodyError{n_lines, "Format does not start with a letter/underscore followed by alphanumeric/underscore/dot characters"});
         p--; {goto st660;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st660;}
     }
 	goto st0;
 tr842:
-#line 461 "src/vcf/vcf.ragel"
+#line 452 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " does not start with a valid genotype";
-        ErrorPolicy::handle_error(*this, new SamplesFieldBodyError{n_lines, message_stream.str(), "", "GT"});
+        ErrorPolicy::handle_error(*this, new SamplesFieldBodyError{n_lines, message_stream.str(), "", "GT", -1,
+                                                                   "Sample does not start with a valid genotype"});
         p--; {goto st660;}
     }
-#line 454 "src/vcf/vcf.ragel"
+#line 444 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " is not a valid string";
-        ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str()});
+        ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str(), "",
+                                                              "Sample is not a valid string"});
         p--; {goto st660;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st660;}
     }
 	goto st0;
 tr850:
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st660;}
     }
 	goto st0;
 tr852:
-#line 454 "src/vcf/vcf.ragel"
+#line 444 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " is not a valid string";
-        ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str()});
+        ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str(), "",
+                                                              "Sample is not a valid string"});
         p--; {goto st660;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st660;}
     }
 	goto st0;
 tr858:
-#line 448 "src/vcf/vcf.ragel"
+#line 438 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info field value is not a comma-separated list of valid strings (maybe it contains whitespaces?)"});
         p--; {goto st660;}
     }
-#line 438 "src/vcf/vcf.ragel"
+#line 428 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
         p--; {goto st660;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st660;}
     }
 	goto st0;
 tr908:
-#line 78 "src/vcf/vcf.ragel"
+#line 73 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st660;}
     }
-#line 396 "src/vcf/vcf.ragel"
+#line 386 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new ChromosomeBodyError{n_lines});
         p--; {goto st660;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st660;}
     }
 	goto st0;
 tr915:
-#line 438 "src/vcf/vcf.ragel"
+#line 428 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
         p--; {goto st660;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st660;}
     }
 	goto st0;
-#line 1225 "inc/vcf/validator_detail_v43.hpp"
+#line 1227 "src/vcf/validator_detail_v43.cpp"
 st0:
 cs = 0;
 	goto _out;
@@ -1319,109 +1321,109 @@ case 14:
 tr15:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st15;
 st15:
 	if ( ++p == pe )
 		goto _test_eof15;
 case 15:
-#line 1334 "inc/vcf/validator_detail_v43.hpp"
+#line 1336 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 67 )
 		goto tr16;
 	goto tr14;
 tr16:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st16;
 st16:
 	if ( ++p == pe )
 		goto _test_eof16;
 case 16:
-#line 1348 "inc/vcf/validator_detail_v43.hpp"
+#line 1350 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 70 )
 		goto tr17;
 	goto tr14;
 tr17:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st17;
 st17:
 	if ( ++p == pe )
 		goto _test_eof17;
 case 17:
-#line 1362 "inc/vcf/validator_detail_v43.hpp"
+#line 1364 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 118 )
 		goto tr18;
 	goto tr14;
 tr18:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st18;
 st18:
 	if ( ++p == pe )
 		goto _test_eof18;
 case 18:
-#line 1376 "inc/vcf/validator_detail_v43.hpp"
+#line 1378 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 52 )
 		goto tr19;
 	goto tr14;
 tr19:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st19;
 st19:
 	if ( ++p == pe )
 		goto _test_eof19;
 case 19:
-#line 1390 "inc/vcf/validator_detail_v43.hpp"
+#line 1392 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 46 )
 		goto tr20;
 	goto tr14;
 tr20:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st20;
 st20:
 	if ( ++p == pe )
 		goto _test_eof20;
 case 20:
-#line 1404 "inc/vcf/validator_detail_v43.hpp"
+#line 1406 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 51 )
 		goto tr21;
 	goto tr14;
 tr21:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st21;
 st21:
 	if ( ++p == pe )
 		goto _test_eof21;
 case 21:
-#line 1418 "inc/vcf/validator_detail_v43.hpp"
+#line 1420 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 10: goto tr22;
 		case 13: goto tr23;
 	}
 	goto tr14;
 tr22:
-#line 99 "src/vcf/vcf.ragel"
+#line 93 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_fileformat(*this);
@@ -1432,20 +1434,16 @@ tr22:
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st22;
 st22:
 	if ( ++p == pe )
 		goto _test_eof22;
 case 22:
-#line 1449 "inc/vcf/validator_detail_v43.hpp"
+#line 1447 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 35 )
 		goto st23;
 	goto tr24;
@@ -1482,31 +1480,31 @@ case 24:
 tr30:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st25;
 tr41:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st25;
 st25:
 	if ( ++p == pe )
 		goto _test_eof25;
 case 25:
-#line 1503 "inc/vcf/validator_detail_v43.hpp"
+#line 1501 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 61 )
 		goto tr42;
 	if ( 32 <= (*p) && (*p) <= 126 )
 		goto tr41;
 	goto tr40;
 tr42:
-#line 188 "src/vcf/vcf.ragel"
+#line 182 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this);
     }
@@ -1515,7 +1513,7 @@ st26:
 	if ( ++p == pe )
 		goto _test_eof26;
 case 26:
-#line 1519 "inc/vcf/validator_detail_v43.hpp"
+#line 1517 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto st30;
 		case 60: goto st35;
@@ -1526,24 +1524,24 @@ case 26:
 tr43:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st27;
 tr48:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st27;
 st27:
 	if ( ++p == pe )
 		goto _test_eof27;
 case 27:
-#line 1547 "inc/vcf/validator_detail_v43.hpp"
+#line 1545 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 10: goto tr46;
 		case 13: goto tr47;
@@ -1556,7 +1554,7 @@ tr46:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 196 "src/vcf/vcf.ragel"
+#line 190 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_meta_line(*this);
@@ -1566,17 +1564,13 @@ tr46:
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st28;
 tr56:
-#line 196 "src/vcf/vcf.ragel"
+#line 190 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_meta_line(*this);
@@ -1586,20 +1580,16 @@ tr56:
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st28;
 st28:
 	if ( ++p == pe )
 		goto _test_eof28;
 case 28:
-#line 1603 "inc/vcf/validator_detail_v43.hpp"
+#line 1593 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 35 )
 		goto st23;
 	goto tr26;
@@ -1608,7 +1598,7 @@ tr47:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 196 "src/vcf/vcf.ragel"
+#line 190 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_meta_line(*this);
@@ -1618,17 +1608,13 @@ tr47:
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st29;
 tr57:
-#line 196 "src/vcf/vcf.ragel"
+#line 190 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_meta_line(*this);
@@ -1638,20 +1624,16 @@ tr57:
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st29;
 st29:
 	if ( ++p == pe )
 		goto _test_eof29;
 case 29:
-#line 1655 "inc/vcf/validator_detail_v43.hpp"
+#line 1637 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 10 )
 		goto st28;
 	goto tr40;
@@ -1669,24 +1651,24 @@ case 30:
 tr50:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st31;
 tr53:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st31;
 st31:
 	if ( ++p == pe )
 		goto _test_eof31;
 case 31:
-#line 1690 "inc/vcf/validator_detail_v43.hpp"
+#line 1672 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr54;
 		case 92: goto tr55;
@@ -1697,7 +1679,7 @@ case 31:
 tr51:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -1714,7 +1696,7 @@ st32:
 	if ( ++p == pe )
 		goto _test_eof32;
 case 32:
-#line 1718 "inc/vcf/validator_detail_v43.hpp"
+#line 1700 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 10: goto tr56;
 		case 13: goto tr57;
@@ -1723,24 +1705,24 @@ case 32:
 tr52:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st33;
 tr55:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st33;
 st33:
 	if ( ++p == pe )
 		goto _test_eof33;
 case 33:
-#line 1744 "inc/vcf/validator_detail_v43.hpp"
+#line 1726 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr58;
 		case 92: goto tr55;
@@ -1751,7 +1733,7 @@ case 33:
 tr58:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -1762,7 +1744,7 @@ st34:
 	if ( ++p == pe )
 		goto _test_eof34;
 case 34:
-#line 1766 "inc/vcf/validator_detail_v43.hpp"
+#line 1748 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 10: goto tr56;
 		case 13: goto tr57;
@@ -1806,24 +1788,24 @@ case 36:
 tr62:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st37;
 tr65:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st37;
 st37:
 	if ( ++p == pe )
 		goto _test_eof37;
 case 37:
-#line 1827 "inc/vcf/validator_detail_v43.hpp"
+#line 1809 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr66;
 		case 92: goto tr67;
@@ -1834,7 +1816,7 @@ case 37:
 tr63:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -1851,31 +1833,31 @@ st38:
 	if ( ++p == pe )
 		goto _test_eof38;
 case 38:
-#line 1855 "inc/vcf/validator_detail_v43.hpp"
+#line 1837 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 62 )
 		goto st32;
 	goto tr40;
 tr64:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st39;
 tr67:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st39;
 st39:
 	if ( ++p == pe )
 		goto _test_eof39;
 case 39:
-#line 1879 "inc/vcf/validator_detail_v43.hpp"
+#line 1861 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr69;
 		case 92: goto tr67;
@@ -1886,7 +1868,7 @@ case 39:
 tr69:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -1897,7 +1879,7 @@ st40:
 	if ( ++p == pe )
 		goto _test_eof40;
 case 40:
-#line 1901 "inc/vcf/validator_detail_v43.hpp"
+#line 1883 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr66;
 		case 62: goto tr70;
@@ -1909,14 +1891,14 @@ case 40:
 tr70:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st41;
 st41:
 	if ( ++p == pe )
 		goto _test_eof41;
 case 41:
-#line 1920 "inc/vcf/validator_detail_v43.hpp"
+#line 1902 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 10: goto tr56;
 		case 13: goto tr57;
@@ -1929,14 +1911,14 @@ case 41:
 tr60:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st42;
 st42:
 	if ( ++p == pe )
 		goto _test_eof42;
 case 42:
-#line 1940 "inc/vcf/validator_detail_v43.hpp"
+#line 1922 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 95 )
 		goto st42;
 	if ( (*p) < 48 ) {
@@ -1954,24 +1936,24 @@ case 42:
 tr61:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st43;
 tr72:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st43;
 st43:
 	if ( ++p == pe )
 		goto _test_eof43;
 case 43:
-#line 1975 "inc/vcf/validator_detail_v43.hpp"
+#line 1957 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr73;
 		case 95: goto tr72;
@@ -1989,7 +1971,7 @@ case 43:
 		goto tr72;
 	goto tr40;
 tr73:
-#line 192 "src/vcf/vcf.ragel"
+#line 186 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this);
     }
@@ -1998,7 +1980,7 @@ st44:
 	if ( ++p == pe )
 		goto _test_eof44;
 case 44:
-#line 2002 "inc/vcf/validator_detail_v43.hpp"
+#line 1984 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 34 )
 		goto st63;
 	if ( (*p) < 45 ) {
@@ -2013,24 +1995,24 @@ case 44:
 tr74:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st45;
 tr76:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st45;
 st45:
 	if ( ++p == pe )
 		goto _test_eof45;
 case 45:
-#line 2034 "inc/vcf/validator_detail_v43.hpp"
+#line 2016 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 44: goto tr77;
 		case 62: goto tr54;
@@ -2051,7 +2033,7 @@ st46:
 	if ( ++p == pe )
 		goto _test_eof46;
 case 46:
-#line 2055 "inc/vcf/validator_detail_v43.hpp"
+#line 2037 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 95 )
 		goto tr78;
 	if ( (*p) < 48 ) {
@@ -2069,14 +2051,14 @@ case 46:
 tr78:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st47;
 st47:
 	if ( ++p == pe )
 		goto _test_eof47;
 case 47:
-#line 2080 "inc/vcf/validator_detail_v43.hpp"
+#line 2062 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 95 )
 		goto st47;
 	if ( (*p) < 48 ) {
@@ -2094,24 +2076,24 @@ case 47:
 tr79:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st48;
 tr81:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st48;
 st48:
 	if ( ++p == pe )
 		goto _test_eof48;
 case 48:
-#line 2115 "inc/vcf/validator_detail_v43.hpp"
+#line 2097 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr82;
 		case 95: goto tr81;
@@ -2129,7 +2111,7 @@ case 48:
 		goto tr81;
 	goto tr40;
 tr82:
-#line 192 "src/vcf/vcf.ragel"
+#line 186 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this);
     }
@@ -2138,7 +2120,7 @@ st49:
 	if ( ++p == pe )
 		goto _test_eof49;
 case 49:
-#line 2142 "inc/vcf/validator_detail_v43.hpp"
+#line 2124 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 34 )
 		goto st50;
 	if ( (*p) < 45 ) {
@@ -2164,24 +2146,24 @@ case 50:
 tr84:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st51;
 tr87:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st51;
 st51:
 	if ( ++p == pe )
 		goto _test_eof51;
 case 51:
-#line 2185 "inc/vcf/validator_detail_v43.hpp"
+#line 2167 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr88;
 		case 92: goto tr89;
@@ -2192,7 +2174,7 @@ case 51:
 tr85:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -2209,7 +2191,7 @@ st52:
 	if ( ++p == pe )
 		goto _test_eof52;
 case 52:
-#line 2213 "inc/vcf/validator_detail_v43.hpp"
+#line 2195 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 44: goto st46;
 		case 62: goto st32;
@@ -2218,24 +2200,24 @@ case 52:
 tr86:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st53;
 tr89:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st53;
 st53:
 	if ( ++p == pe )
 		goto _test_eof53;
 case 53:
-#line 2239 "inc/vcf/validator_detail_v43.hpp"
+#line 2221 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr91;
 		case 92: goto tr89;
@@ -2246,7 +2228,7 @@ case 53:
 tr91:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -2257,7 +2239,7 @@ st54:
 	if ( ++p == pe )
 		goto _test_eof54;
 case 54:
-#line 2261 "inc/vcf/validator_detail_v43.hpp"
+#line 2243 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr88;
 		case 44: goto tr92;
@@ -2270,23 +2252,23 @@ case 54:
 tr106:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st55;
 tr92:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st55;
 tr103:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -2297,7 +2279,7 @@ st55:
 	if ( ++p == pe )
 		goto _test_eof55;
 case 55:
-#line 2301 "inc/vcf/validator_detail_v43.hpp"
+#line 2283 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr88;
 		case 47: goto tr87;
@@ -2331,24 +2313,24 @@ case 55:
 tr94:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st56;
 tr96:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st56;
 st56:
 	if ( ++p == pe )
 		goto _test_eof56;
 case 56:
-#line 2352 "inc/vcf/validator_detail_v43.hpp"
+#line 2334 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr88;
 		case 47: goto tr87;
@@ -2382,24 +2364,24 @@ case 56:
 tr95:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st57;
 tr97:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st57;
 st57:
 	if ( ++p == pe )
 		goto _test_eof57;
 case 57:
-#line 2403 "inc/vcf/validator_detail_v43.hpp"
+#line 2385 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr88;
 		case 47: goto tr87;
@@ -2429,20 +2411,20 @@ case 57:
 		goto tr97;
 	goto tr40;
 tr98:
-#line 192 "src/vcf/vcf.ragel"
+#line 186 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st58;
 st58:
 	if ( ++p == pe )
 		goto _test_eof58;
 case 58:
-#line 2446 "inc/vcf/validator_detail_v43.hpp"
+#line 2428 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr100;
 		case 44: goto tr87;
@@ -2455,24 +2437,24 @@ case 58:
 tr102:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st59;
 tr99:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st59;
 st59:
 	if ( ++p == pe )
 		goto _test_eof59;
 case 59:
-#line 2476 "inc/vcf/validator_detail_v43.hpp"
+#line 2458 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr88;
 		case 44: goto tr103;
@@ -2485,23 +2467,23 @@ case 59:
 tr107:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st60;
 tr93:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st60;
 tr104:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -2512,7 +2494,7 @@ st60:
 	if ( ++p == pe )
 		goto _test_eof60;
 case 60:
-#line 2516 "inc/vcf/validator_detail_v43.hpp"
+#line 2498 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 10: goto tr56;
 		case 13: goto tr57;
@@ -2525,24 +2507,24 @@ case 60:
 tr105:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st61;
 tr101:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st61;
 st61:
 	if ( ++p == pe )
 		goto _test_eof61;
 case 61:
-#line 2546 "inc/vcf/validator_detail_v43.hpp"
+#line 2528 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr91;
 		case 44: goto tr103;
@@ -2562,7 +2544,7 @@ st62:
 	if ( ++p == pe )
 		goto _test_eof62;
 case 62:
-#line 2566 "inc/vcf/validator_detail_v43.hpp"
+#line 2548 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr85;
 		case 44: goto tr106;
@@ -2586,24 +2568,24 @@ case 63:
 tr108:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st64;
 tr110:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st64;
 st64:
 	if ( ++p == pe )
 		goto _test_eof64;
 case 64:
-#line 2607 "inc/vcf/validator_detail_v43.hpp"
+#line 2589 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr88;
 		case 92: goto tr111;
@@ -2614,24 +2596,24 @@ case 64:
 tr109:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st65;
 tr111:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st65;
 st65:
 	if ( ++p == pe )
 		goto _test_eof65;
 case 65:
-#line 2635 "inc/vcf/validator_detail_v43.hpp"
+#line 2617 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr112;
 		case 92: goto tr111;
@@ -2642,7 +2624,7 @@ case 65:
 tr112:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -2653,7 +2635,7 @@ st66:
 	if ( ++p == pe )
 		goto _test_eof66;
 case 66:
-#line 2657 "inc/vcf/validator_detail_v43.hpp"
+#line 2639 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr88;
 		case 44: goto tr113;
@@ -2666,13 +2648,13 @@ case 66:
 tr113:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st67;
 tr123:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -2683,7 +2665,7 @@ st67:
 	if ( ++p == pe )
 		goto _test_eof67;
 case 67:
-#line 2687 "inc/vcf/validator_detail_v43.hpp"
+#line 2669 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr88;
 		case 47: goto tr110;
@@ -2717,24 +2699,24 @@ case 67:
 tr117:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st68;
 tr115:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st68;
 st68:
 	if ( ++p == pe )
 		goto _test_eof68;
 case 68:
-#line 2738 "inc/vcf/validator_detail_v43.hpp"
+#line 2720 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr88;
 		case 47: goto tr110;
@@ -2768,24 +2750,24 @@ case 68:
 tr118:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st69;
 tr116:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st69;
 st69:
 	if ( ++p == pe )
 		goto _test_eof69;
 case 69:
-#line 2789 "inc/vcf/validator_detail_v43.hpp"
+#line 2771 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr88;
 		case 47: goto tr110;
@@ -2817,9 +2799,9 @@ case 69:
 tr119:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
-#line 192 "src/vcf/vcf.ragel"
+#line 186 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this);
     }
@@ -2828,7 +2810,7 @@ st70:
 	if ( ++p == pe )
 		goto _test_eof70;
 case 70:
-#line 2832 "inc/vcf/validator_detail_v43.hpp"
+#line 2814 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr100;
 		case 44: goto tr110;
@@ -2841,24 +2823,24 @@ case 70:
 tr122:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st71;
 tr120:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st71;
 st71:
 	if ( ++p == pe )
 		goto _test_eof71;
 case 71:
-#line 2862 "inc/vcf/validator_detail_v43.hpp"
+#line 2844 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr88;
 		case 44: goto tr123;
@@ -2871,13 +2853,13 @@ case 71:
 tr114:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st72;
 tr124:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -2888,7 +2870,7 @@ st72:
 	if ( ++p == pe )
 		goto _test_eof72;
 case 72:
-#line 2892 "inc/vcf/validator_detail_v43.hpp"
+#line 2874 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 10: goto tr56;
 		case 13: goto tr57;
@@ -2901,24 +2883,24 @@ case 72:
 tr125:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st73;
 tr121:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st73;
 st73:
 	if ( ++p == pe )
 		goto _test_eof73;
 case 73:
-#line 2922 "inc/vcf/validator_detail_v43.hpp"
+#line 2904 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr112;
 		case 44: goto tr123;
@@ -2931,18 +2913,18 @@ case 73:
 tr31:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st74;
 st74:
 	if ( ++p == pe )
 		goto _test_eof74;
 case 74:
-#line 2946 "inc/vcf/validator_detail_v43.hpp"
+#line 2928 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 76: goto tr127;
@@ -2953,14 +2935,14 @@ case 74:
 tr127:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st75;
 st75:
 	if ( ++p == pe )
 		goto _test_eof75;
 case 75:
-#line 2964 "inc/vcf/validator_detail_v43.hpp"
+#line 2946 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 84: goto st76;
@@ -2978,7 +2960,7 @@ case 76:
 		goto tr41;
 	goto tr126;
 tr129:
-#line 108 "src/vcf/vcf.ragel"
+#line 102 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "ALT");
     }
@@ -2987,7 +2969,7 @@ st77:
 	if ( ++p == pe )
 		goto _test_eof77;
 case 77:
-#line 2991 "inc/vcf/validator_detail_v43.hpp"
+#line 2973 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 60 )
 		goto st78;
 	goto tr126;
@@ -3046,20 +3028,20 @@ case 81:
 		goto tr135;
 	goto tr134;
 tr135:
-#line 144 "src/vcf/vcf.ragel"
+#line 138 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st82;
 st82:
 	if ( ++p == pe )
 		goto _test_eof82;
 case 82:
-#line 3063 "inc/vcf/validator_detail_v43.hpp"
+#line 3045 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 61 )
 		goto st82;
 	if ( (*p) < 63 ) {
@@ -3092,28 +3074,28 @@ case 82:
 tr138:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st83;
 tr136:
-#line 144 "src/vcf/vcf.ragel"
+#line 138 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st83;
 st83:
 	if ( ++p == pe )
 		goto _test_eof83;
 case 83:
-#line 3117 "inc/vcf/validator_detail_v43.hpp"
+#line 3099 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 44: goto tr139;
 		case 61: goto tr138;
@@ -3134,7 +3116,7 @@ st84:
 	if ( ++p == pe )
 		goto _test_eof84;
 case 84:
-#line 3138 "inc/vcf/validator_detail_v43.hpp"
+#line 3120 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 68 )
 		goto st85;
 	goto tr126;
@@ -3223,7 +3205,7 @@ case 96:
 		goto tr152;
 	goto tr126;
 tr152:
-#line 156 "src/vcf/vcf.ragel"
+#line 150 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Description");
     }
@@ -3232,7 +3214,7 @@ st97:
 	if ( ++p == pe )
 		goto _test_eof97;
 case 97:
-#line 3236 "inc/vcf/validator_detail_v43.hpp"
+#line 3218 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr155;
 		case 92: goto tr156;
@@ -3243,24 +3225,24 @@ case 97:
 tr154:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st98;
 tr157:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st98;
 st98:
 	if ( ++p == pe )
 		goto _test_eof98;
 case 98:
-#line 3264 "inc/vcf/validator_detail_v43.hpp"
+#line 3246 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr158;
 		case 92: goto tr159;
@@ -3271,7 +3253,7 @@ case 98:
 tr155:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -3288,7 +3270,7 @@ st99:
 	if ( ++p == pe )
 		goto _test_eof99;
 case 99:
-#line 3292 "inc/vcf/validator_detail_v43.hpp"
+#line 3274 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 44: goto st100;
 		case 62: goto st114;
@@ -3315,14 +3297,14 @@ case 100:
 tr163:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st101;
 st101:
 	if ( ++p == pe )
 		goto _test_eof101;
 case 101:
-#line 3326 "inc/vcf/validator_detail_v43.hpp"
+#line 3308 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 95 )
 		goto st101;
 	if ( (*p) < 48 ) {
@@ -3340,24 +3322,24 @@ case 101:
 tr164:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st102;
 tr166:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st102;
 st102:
 	if ( ++p == pe )
 		goto _test_eof102;
 case 102:
-#line 3361 "inc/vcf/validator_detail_v43.hpp"
+#line 3343 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr167;
 		case 95: goto tr166;
@@ -3384,7 +3366,7 @@ st103:
 	if ( ++p == pe )
 		goto _test_eof103;
 case 103:
-#line 3388 "inc/vcf/validator_detail_v43.hpp"
+#line 3370 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 34 )
 		goto st104;
 	goto tr126;
@@ -3402,24 +3384,24 @@ case 104:
 tr169:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st105;
 tr171:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st105;
 st105:
 	if ( ++p == pe )
 		goto _test_eof105;
 case 105:
-#line 3423 "inc/vcf/validator_detail_v43.hpp"
+#line 3405 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr158;
 		case 92: goto tr172;
@@ -3430,24 +3412,24 @@ case 105:
 tr170:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st106;
 tr172:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st106;
 st106:
 	if ( ++p == pe )
 		goto _test_eof106;
 case 106:
-#line 3451 "inc/vcf/validator_detail_v43.hpp"
+#line 3433 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr173;
 		case 92: goto tr172;
@@ -3458,7 +3440,7 @@ case 106:
 tr173:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -3469,7 +3451,7 @@ st107:
 	if ( ++p == pe )
 		goto _test_eof107;
 case 107:
-#line 3473 "inc/vcf/validator_detail_v43.hpp"
+#line 3455 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr158;
 		case 44: goto tr174;
@@ -3482,24 +3464,24 @@ case 107:
 tr183:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st108;
 tr174:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st108;
 st108:
 	if ( ++p == pe )
 		goto _test_eof108;
 case 108:
-#line 3503 "inc/vcf/validator_detail_v43.hpp"
+#line 3485 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr158;
 		case 47: goto tr171;
@@ -3533,24 +3515,24 @@ case 108:
 tr177:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st109;
 tr179:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st109;
 st109:
 	if ( ++p == pe )
 		goto _test_eof109;
 case 109:
-#line 3554 "inc/vcf/validator_detail_v43.hpp"
+#line 3536 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr158;
 		case 47: goto tr171;
@@ -3584,24 +3566,24 @@ case 109:
 tr178:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st110;
 tr180:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st110;
 st110:
 	if ( ++p == pe )
 		goto _test_eof110;
 case 110:
-#line 3605 "inc/vcf/validator_detail_v43.hpp"
+#line 3587 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr158;
 		case 47: goto tr171;
@@ -3637,14 +3619,14 @@ tr181:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st111;
 st111:
 	if ( ++p == pe )
 		goto _test_eof111;
 case 111:
-#line 3648 "inc/vcf/validator_detail_v43.hpp"
+#line 3630 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr182;
 		case 92: goto tr172;
@@ -3662,7 +3644,7 @@ st112:
 	if ( ++p == pe )
 		goto _test_eof112;
 case 112:
-#line 3666 "inc/vcf/validator_detail_v43.hpp"
+#line 3648 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr155;
 		case 44: goto tr183;
@@ -3675,24 +3657,24 @@ case 112:
 tr184:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st113;
 tr175:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st113;
 st113:
 	if ( ++p == pe )
 		goto _test_eof113;
 case 113:
-#line 3696 "inc/vcf/validator_detail_v43.hpp"
+#line 3678 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 10: goto tr56;
 		case 13: goto tr57;
@@ -3714,24 +3696,24 @@ case 114:
 tr156:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st115;
 tr159:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st115;
 st115:
 	if ( ++p == pe )
 		goto _test_eof115;
 case 115:
-#line 3735 "inc/vcf/validator_detail_v43.hpp"
+#line 3717 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr185;
 		case 92: goto tr159;
@@ -3742,7 +3724,7 @@ case 115:
 tr185:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -3753,7 +3735,7 @@ st116:
 	if ( ++p == pe )
 		goto _test_eof116;
 case 116:
-#line 3757 "inc/vcf/validator_detail_v43.hpp"
+#line 3739 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr158;
 		case 44: goto tr186;
@@ -3766,14 +3748,14 @@ case 116:
 tr186:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st117;
 st117:
 	if ( ++p == pe )
 		goto _test_eof117;
 case 117:
-#line 3777 "inc/vcf/validator_detail_v43.hpp"
+#line 3759 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr158;
 		case 47: goto tr157;
@@ -3807,24 +3789,24 @@ case 117:
 tr191:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st118;
 tr189:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st118;
 st118:
 	if ( ++p == pe )
 		goto _test_eof118;
 case 118:
-#line 3828 "inc/vcf/validator_detail_v43.hpp"
+#line 3810 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr158;
 		case 47: goto tr157;
@@ -3858,24 +3840,24 @@ case 118:
 tr192:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st119;
 tr190:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st119;
 st119:
 	if ( ++p == pe )
 		goto _test_eof119;
 case 119:
-#line 3879 "inc/vcf/validator_detail_v43.hpp"
+#line 3861 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr158;
 		case 47: goto tr157;
@@ -3907,7 +3889,7 @@ case 119:
 tr193:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -3918,7 +3900,7 @@ st120:
 	if ( ++p == pe )
 		goto _test_eof120;
 case 120:
-#line 3922 "inc/vcf/validator_detail_v43.hpp"
+#line 3904 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr182;
 		case 92: goto tr159;
@@ -3929,14 +3911,14 @@ case 120:
 tr187:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st121;
 st121:
 	if ( ++p == pe )
 		goto _test_eof121;
 case 121:
-#line 3940 "inc/vcf/validator_detail_v43.hpp"
+#line 3922 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 10: goto tr56;
 		case 13: goto tr57;
@@ -3949,18 +3931,18 @@ case 121:
 tr32:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st122;
 st122:
 	if ( ++p == pe )
 		goto _test_eof122;
 case 122:
-#line 3964 "inc/vcf/validator_detail_v43.hpp"
+#line 3946 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 73: goto tr195;
@@ -3972,14 +3954,14 @@ case 122:
 tr195:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st123;
 st123:
 	if ( ++p == pe )
 		goto _test_eof123;
 case 123:
-#line 3983 "inc/vcf/validator_detail_v43.hpp"
+#line 3965 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 76: goto tr198;
@@ -3990,14 +3972,14 @@ case 123:
 tr198:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st124;
 st124:
 	if ( ++p == pe )
 		goto _test_eof124;
 case 124:
-#line 4001 "inc/vcf/validator_detail_v43.hpp"
+#line 3983 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 84: goto tr199;
@@ -4008,14 +3990,14 @@ case 124:
 tr199:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st125;
 st125:
 	if ( ++p == pe )
 		goto _test_eof125;
 case 125:
-#line 4019 "inc/vcf/validator_detail_v43.hpp"
+#line 4001 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 69: goto tr200;
@@ -4026,14 +4008,14 @@ case 125:
 tr200:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st126;
 st126:
 	if ( ++p == pe )
 		goto _test_eof126;
 case 126:
-#line 4037 "inc/vcf/validator_detail_v43.hpp"
+#line 4019 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 82: goto st127;
@@ -4051,7 +4033,7 @@ case 127:
 		goto tr41;
 	goto tr197;
 tr202:
-#line 120 "src/vcf/vcf.ragel"
+#line 114 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "FILTER");
     }
@@ -4060,7 +4042,7 @@ st128:
 	if ( ++p == pe )
 		goto _test_eof128;
 case 128:
-#line 4064 "inc/vcf/validator_detail_v43.hpp"
+#line 4046 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 60 )
 		goto st129;
 	goto tr197;
@@ -4104,20 +4086,20 @@ case 132:
 		goto tr209;
 	goto tr207;
 tr208:
-#line 144 "src/vcf/vcf.ragel"
+#line 138 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st133;
 st133:
 	if ( ++p == pe )
 		goto _test_eof133;
 case 133:
-#line 4121 "inc/vcf/validator_detail_v43.hpp"
+#line 4103 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 95 )
 		goto st133;
 	if ( (*p) < 48 ) {
@@ -4135,28 +4117,28 @@ case 133:
 tr211:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st134;
 tr209:
-#line 144 "src/vcf/vcf.ragel"
+#line 138 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st134;
 st134:
 	if ( ++p == pe )
 		goto _test_eof134;
 case 134:
-#line 4160 "inc/vcf/validator_detail_v43.hpp"
+#line 4142 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 44: goto tr212;
 		case 95: goto tr211;
@@ -4183,7 +4165,7 @@ st135:
 	if ( ++p == pe )
 		goto _test_eof135;
 case 135:
-#line 4187 "inc/vcf/validator_detail_v43.hpp"
+#line 4169 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 68 )
 		goto st136;
 	goto tr197;
@@ -4272,7 +4254,7 @@ case 147:
 		goto tr225;
 	goto tr197;
 tr225:
-#line 156 "src/vcf/vcf.ragel"
+#line 150 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Description");
     }
@@ -4281,7 +4263,7 @@ st148:
 	if ( ++p == pe )
 		goto _test_eof148;
 case 148:
-#line 4285 "inc/vcf/validator_detail_v43.hpp"
+#line 4267 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr228;
 		case 92: goto tr229;
@@ -4292,24 +4274,24 @@ case 148:
 tr227:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st149;
 tr230:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st149;
 st149:
 	if ( ++p == pe )
 		goto _test_eof149;
 case 149:
-#line 4313 "inc/vcf/validator_detail_v43.hpp"
+#line 4295 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr231;
 		case 92: goto tr232;
@@ -4320,7 +4302,7 @@ case 149:
 tr228:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -4337,7 +4319,7 @@ st150:
 	if ( ++p == pe )
 		goto _test_eof150;
 case 150:
-#line 4341 "inc/vcf/validator_detail_v43.hpp"
+#line 4323 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 44: goto st151;
 		case 62: goto st165;
@@ -4364,14 +4346,14 @@ case 151:
 tr235:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st152;
 st152:
 	if ( ++p == pe )
 		goto _test_eof152;
 case 152:
-#line 4375 "inc/vcf/validator_detail_v43.hpp"
+#line 4357 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 95 )
 		goto st152;
 	if ( (*p) < 48 ) {
@@ -4389,24 +4371,24 @@ case 152:
 tr236:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st153;
 tr238:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st153;
 st153:
 	if ( ++p == pe )
 		goto _test_eof153;
 case 153:
-#line 4410 "inc/vcf/validator_detail_v43.hpp"
+#line 4392 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr239;
 		case 95: goto tr238;
@@ -4433,7 +4415,7 @@ st154:
 	if ( ++p == pe )
 		goto _test_eof154;
 case 154:
-#line 4437 "inc/vcf/validator_detail_v43.hpp"
+#line 4419 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 34 )
 		goto st155;
 	goto tr197;
@@ -4451,24 +4433,24 @@ case 155:
 tr241:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st156;
 tr243:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st156;
 st156:
 	if ( ++p == pe )
 		goto _test_eof156;
 case 156:
-#line 4472 "inc/vcf/validator_detail_v43.hpp"
+#line 4454 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr231;
 		case 92: goto tr244;
@@ -4479,24 +4461,24 @@ case 156:
 tr242:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st157;
 tr244:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st157;
 st157:
 	if ( ++p == pe )
 		goto _test_eof157;
 case 157:
-#line 4500 "inc/vcf/validator_detail_v43.hpp"
+#line 4482 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr245;
 		case 92: goto tr244;
@@ -4507,7 +4489,7 @@ case 157:
 tr245:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -4518,7 +4500,7 @@ st158:
 	if ( ++p == pe )
 		goto _test_eof158;
 case 158:
-#line 4522 "inc/vcf/validator_detail_v43.hpp"
+#line 4504 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr231;
 		case 44: goto tr246;
@@ -4531,24 +4513,24 @@ case 158:
 tr255:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st159;
 tr246:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st159;
 st159:
 	if ( ++p == pe )
 		goto _test_eof159;
 case 159:
-#line 4552 "inc/vcf/validator_detail_v43.hpp"
+#line 4534 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr231;
 		case 47: goto tr243;
@@ -4582,24 +4564,24 @@ case 159:
 tr249:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st160;
 tr251:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st160;
 st160:
 	if ( ++p == pe )
 		goto _test_eof160;
 case 160:
-#line 4603 "inc/vcf/validator_detail_v43.hpp"
+#line 4585 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr231;
 		case 47: goto tr243;
@@ -4633,24 +4615,24 @@ case 160:
 tr250:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st161;
 tr252:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st161;
 st161:
 	if ( ++p == pe )
 		goto _test_eof161;
 case 161:
-#line 4654 "inc/vcf/validator_detail_v43.hpp"
+#line 4636 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr231;
 		case 47: goto tr243;
@@ -4686,14 +4668,14 @@ tr253:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st162;
 st162:
 	if ( ++p == pe )
 		goto _test_eof162;
 case 162:
-#line 4697 "inc/vcf/validator_detail_v43.hpp"
+#line 4679 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr254;
 		case 92: goto tr244;
@@ -4711,7 +4693,7 @@ st163:
 	if ( ++p == pe )
 		goto _test_eof163;
 case 163:
-#line 4715 "inc/vcf/validator_detail_v43.hpp"
+#line 4697 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr228;
 		case 44: goto tr255;
@@ -4724,24 +4706,24 @@ case 163:
 tr256:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st164;
 tr247:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st164;
 st164:
 	if ( ++p == pe )
 		goto _test_eof164;
 case 164:
-#line 4745 "inc/vcf/validator_detail_v43.hpp"
+#line 4727 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 10: goto tr56;
 		case 13: goto tr57;
@@ -4763,24 +4745,24 @@ case 165:
 tr229:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st166;
 tr232:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st166;
 st166:
 	if ( ++p == pe )
 		goto _test_eof166;
 case 166:
-#line 4784 "inc/vcf/validator_detail_v43.hpp"
+#line 4766 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr257;
 		case 92: goto tr232;
@@ -4791,7 +4773,7 @@ case 166:
 tr257:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -4802,7 +4784,7 @@ st167:
 	if ( ++p == pe )
 		goto _test_eof167;
 case 167:
-#line 4806 "inc/vcf/validator_detail_v43.hpp"
+#line 4788 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr231;
 		case 44: goto tr258;
@@ -4815,14 +4797,14 @@ case 167:
 tr258:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st168;
 st168:
 	if ( ++p == pe )
 		goto _test_eof168;
 case 168:
-#line 4826 "inc/vcf/validator_detail_v43.hpp"
+#line 4808 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr231;
 		case 47: goto tr230;
@@ -4856,24 +4838,24 @@ case 168:
 tr263:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st169;
 tr261:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st169;
 st169:
 	if ( ++p == pe )
 		goto _test_eof169;
 case 169:
-#line 4877 "inc/vcf/validator_detail_v43.hpp"
+#line 4859 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr231;
 		case 47: goto tr230;
@@ -4907,24 +4889,24 @@ case 169:
 tr264:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st170;
 tr262:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st170;
 st170:
 	if ( ++p == pe )
 		goto _test_eof170;
 case 170:
-#line 4928 "inc/vcf/validator_detail_v43.hpp"
+#line 4910 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr231;
 		case 47: goto tr230;
@@ -4956,7 +4938,7 @@ case 170:
 tr265:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -4967,7 +4949,7 @@ st171:
 	if ( ++p == pe )
 		goto _test_eof171;
 case 171:
-#line 4971 "inc/vcf/validator_detail_v43.hpp"
+#line 4953 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr254;
 		case 92: goto tr232;
@@ -4978,14 +4960,14 @@ case 171:
 tr259:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st172;
 st172:
 	if ( ++p == pe )
 		goto _test_eof172;
 case 172:
-#line 4989 "inc/vcf/validator_detail_v43.hpp"
+#line 4971 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 10: goto tr56;
 		case 13: goto tr57;
@@ -4998,14 +4980,14 @@ case 172:
 tr196:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st173;
 st173:
 	if ( ++p == pe )
 		goto _test_eof173;
 case 173:
-#line 5009 "inc/vcf/validator_detail_v43.hpp"
+#line 4991 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 82: goto tr267;
@@ -5016,14 +4998,14 @@ case 173:
 tr267:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st174;
 st174:
 	if ( ++p == pe )
 		goto _test_eof174;
 case 174:
-#line 5027 "inc/vcf/validator_detail_v43.hpp"
+#line 5009 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 77: goto tr268;
@@ -5034,14 +5016,14 @@ case 174:
 tr268:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st175;
 st175:
 	if ( ++p == pe )
 		goto _test_eof175;
 case 175:
-#line 5045 "inc/vcf/validator_detail_v43.hpp"
+#line 5027 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 65: goto tr269;
@@ -5052,14 +5034,14 @@ case 175:
 tr269:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st176;
 st176:
 	if ( ++p == pe )
 		goto _test_eof176;
 case 176:
-#line 5063 "inc/vcf/validator_detail_v43.hpp"
+#line 5045 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 84: goto st177;
@@ -5077,7 +5059,7 @@ case 177:
 		goto tr41;
 	goto tr266;
 tr271:
-#line 124 "src/vcf/vcf.ragel"
+#line 118 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "FORMAT");
     }
@@ -5086,7 +5068,7 @@ st178:
 	if ( ++p == pe )
 		goto _test_eof178;
 case 178:
-#line 5090 "inc/vcf/validator_detail_v43.hpp"
+#line 5072 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 60 )
 		goto st179;
 	goto tr266;
@@ -5130,20 +5112,20 @@ case 182:
 		goto tr278;
 	goto tr276;
 tr277:
-#line 144 "src/vcf/vcf.ragel"
+#line 138 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st183;
 st183:
 	if ( ++p == pe )
 		goto _test_eof183;
 case 183:
-#line 5147 "inc/vcf/validator_detail_v43.hpp"
+#line 5129 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 95 )
 		goto st183;
 	if ( (*p) < 48 ) {
@@ -5161,28 +5143,28 @@ case 183:
 tr280:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st184;
 tr278:
-#line 144 "src/vcf/vcf.ragel"
+#line 138 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st184;
 st184:
 	if ( ++p == pe )
 		goto _test_eof184;
 case 184:
-#line 5186 "inc/vcf/validator_detail_v43.hpp"
+#line 5168 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 44: goto tr281;
 		case 95: goto tr280;
@@ -5209,7 +5191,7 @@ st185:
 	if ( ++p == pe )
 		goto _test_eof185;
 case 185:
-#line 5213 "inc/vcf/validator_detail_v43.hpp"
+#line 5195 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 78 )
 		goto st186;
 	goto tr266;
@@ -5269,24 +5251,24 @@ case 192:
 		goto tr291;
 	goto tr289;
 tr290:
-#line 148 "src/vcf/vcf.ragel"
+#line 142 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Number");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st193;
 st193:
 	if ( ++p == pe )
 		goto _test_eof193;
 case 193:
-#line 5290 "inc/vcf/validator_detail_v43.hpp"
+#line 5272 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 44 )
 		goto tr292;
 	goto tr289;
@@ -5300,7 +5282,7 @@ st194:
 	if ( ++p == pe )
 		goto _test_eof194;
 case 194:
-#line 5304 "inc/vcf/validator_detail_v43.hpp"
+#line 5286 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 84 )
 		goto st195;
 	goto tr266;
@@ -5345,28 +5327,28 @@ case 199:
 tr301:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st200;
 tr299:
-#line 152 "src/vcf/vcf.ragel"
+#line 146 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Type");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st200;
 st200:
 	if ( ++p == pe )
 		goto _test_eof200;
 case 200:
-#line 5370 "inc/vcf/validator_detail_v43.hpp"
+#line 5352 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 44 )
 		goto tr300;
 	if ( (*p) > 90 ) {
@@ -5385,7 +5367,7 @@ st201:
 	if ( ++p == pe )
 		goto _test_eof201;
 case 201:
-#line 5389 "inc/vcf/validator_detail_v43.hpp"
+#line 5371 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 68 )
 		goto st202;
 	goto tr266;
@@ -5474,7 +5456,7 @@ case 213:
 		goto tr314;
 	goto tr266;
 tr314:
-#line 156 "src/vcf/vcf.ragel"
+#line 150 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Description");
     }
@@ -5483,7 +5465,7 @@ st214:
 	if ( ++p == pe )
 		goto _test_eof214;
 case 214:
-#line 5487 "inc/vcf/validator_detail_v43.hpp"
+#line 5469 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr317;
 		case 92: goto tr318;
@@ -5494,24 +5476,24 @@ case 214:
 tr316:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st215;
 tr319:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st215;
 st215:
 	if ( ++p == pe )
 		goto _test_eof215;
 case 215:
-#line 5515 "inc/vcf/validator_detail_v43.hpp"
+#line 5497 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr320;
 		case 92: goto tr321;
@@ -5522,7 +5504,7 @@ case 215:
 tr317:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -5539,7 +5521,7 @@ st216:
 	if ( ++p == pe )
 		goto _test_eof216;
 case 216:
-#line 5543 "inc/vcf/validator_detail_v43.hpp"
+#line 5525 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 44: goto st217;
 		case 62: goto st231;
@@ -5566,14 +5548,14 @@ case 217:
 tr324:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st218;
 st218:
 	if ( ++p == pe )
 		goto _test_eof218;
 case 218:
-#line 5577 "inc/vcf/validator_detail_v43.hpp"
+#line 5559 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 95 )
 		goto st218;
 	if ( (*p) < 48 ) {
@@ -5591,24 +5573,24 @@ case 218:
 tr325:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st219;
 tr327:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st219;
 st219:
 	if ( ++p == pe )
 		goto _test_eof219;
 case 219:
-#line 5612 "inc/vcf/validator_detail_v43.hpp"
+#line 5594 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr328;
 		case 95: goto tr327;
@@ -5635,7 +5617,7 @@ st220:
 	if ( ++p == pe )
 		goto _test_eof220;
 case 220:
-#line 5639 "inc/vcf/validator_detail_v43.hpp"
+#line 5621 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 34 )
 		goto st221;
 	goto tr266;
@@ -5653,24 +5635,24 @@ case 221:
 tr330:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st222;
 tr332:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st222;
 st222:
 	if ( ++p == pe )
 		goto _test_eof222;
 case 222:
-#line 5674 "inc/vcf/validator_detail_v43.hpp"
+#line 5656 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr320;
 		case 92: goto tr333;
@@ -5681,24 +5663,24 @@ case 222:
 tr331:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st223;
 tr333:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st223;
 st223:
 	if ( ++p == pe )
 		goto _test_eof223;
 case 223:
-#line 5702 "inc/vcf/validator_detail_v43.hpp"
+#line 5684 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr334;
 		case 92: goto tr333;
@@ -5709,7 +5691,7 @@ case 223:
 tr334:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -5720,7 +5702,7 @@ st224:
 	if ( ++p == pe )
 		goto _test_eof224;
 case 224:
-#line 5724 "inc/vcf/validator_detail_v43.hpp"
+#line 5706 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr320;
 		case 44: goto tr335;
@@ -5733,24 +5715,24 @@ case 224:
 tr344:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st225;
 tr335:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st225;
 st225:
 	if ( ++p == pe )
 		goto _test_eof225;
 case 225:
-#line 5754 "inc/vcf/validator_detail_v43.hpp"
+#line 5736 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr320;
 		case 47: goto tr332;
@@ -5784,24 +5766,24 @@ case 225:
 tr338:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st226;
 tr340:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st226;
 st226:
 	if ( ++p == pe )
 		goto _test_eof226;
 case 226:
-#line 5805 "inc/vcf/validator_detail_v43.hpp"
+#line 5787 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr320;
 		case 47: goto tr332;
@@ -5835,24 +5817,24 @@ case 226:
 tr339:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st227;
 tr341:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st227;
 st227:
 	if ( ++p == pe )
 		goto _test_eof227;
 case 227:
-#line 5856 "inc/vcf/validator_detail_v43.hpp"
+#line 5838 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr320;
 		case 47: goto tr332;
@@ -5888,14 +5870,14 @@ tr342:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st228;
 st228:
 	if ( ++p == pe )
 		goto _test_eof228;
 case 228:
-#line 5899 "inc/vcf/validator_detail_v43.hpp"
+#line 5881 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr343;
 		case 92: goto tr333;
@@ -5913,7 +5895,7 @@ st229:
 	if ( ++p == pe )
 		goto _test_eof229;
 case 229:
-#line 5917 "inc/vcf/validator_detail_v43.hpp"
+#line 5899 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr317;
 		case 44: goto tr344;
@@ -5926,24 +5908,24 @@ case 229:
 tr345:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st230;
 tr336:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st230;
 st230:
 	if ( ++p == pe )
 		goto _test_eof230;
 case 230:
-#line 5947 "inc/vcf/validator_detail_v43.hpp"
+#line 5929 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 10: goto tr56;
 		case 13: goto tr57;
@@ -5965,24 +5947,24 @@ case 231:
 tr318:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st232;
 tr321:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st232;
 st232:
 	if ( ++p == pe )
 		goto _test_eof232;
 case 232:
-#line 5986 "inc/vcf/validator_detail_v43.hpp"
+#line 5968 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr346;
 		case 92: goto tr321;
@@ -5993,7 +5975,7 @@ case 232:
 tr346:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -6004,7 +5986,7 @@ st233:
 	if ( ++p == pe )
 		goto _test_eof233;
 case 233:
-#line 6008 "inc/vcf/validator_detail_v43.hpp"
+#line 5990 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr320;
 		case 44: goto tr347;
@@ -6017,14 +5999,14 @@ case 233:
 tr347:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st234;
 st234:
 	if ( ++p == pe )
 		goto _test_eof234;
 case 234:
-#line 6028 "inc/vcf/validator_detail_v43.hpp"
+#line 6010 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr320;
 		case 47: goto tr319;
@@ -6058,24 +6040,24 @@ case 234:
 tr352:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st235;
 tr350:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st235;
 st235:
 	if ( ++p == pe )
 		goto _test_eof235;
 case 235:
-#line 6079 "inc/vcf/validator_detail_v43.hpp"
+#line 6061 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr320;
 		case 47: goto tr319;
@@ -6109,24 +6091,24 @@ case 235:
 tr353:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st236;
 tr351:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st236;
 st236:
 	if ( ++p == pe )
 		goto _test_eof236;
 case 236:
-#line 6130 "inc/vcf/validator_detail_v43.hpp"
+#line 6112 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr320;
 		case 47: goto tr319;
@@ -6158,7 +6140,7 @@ case 236:
 tr354:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -6169,7 +6151,7 @@ st237:
 	if ( ++p == pe )
 		goto _test_eof237;
 case 237:
-#line 6173 "inc/vcf/validator_detail_v43.hpp"
+#line 6155 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr343;
 		case 92: goto tr321;
@@ -6180,14 +6162,14 @@ case 237:
 tr348:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st238;
 st238:
 	if ( ++p == pe )
 		goto _test_eof238;
 case 238:
-#line 6191 "inc/vcf/validator_detail_v43.hpp"
+#line 6173 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 10: goto tr56;
 		case 13: goto tr57;
@@ -6200,28 +6182,28 @@ case 238:
 tr355:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st239;
 tr291:
-#line 148 "src/vcf/vcf.ragel"
+#line 142 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Number");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st239;
 st239:
 	if ( ++p == pe )
 		goto _test_eof239;
 case 239:
-#line 6225 "inc/vcf/validator_detail_v43.hpp"
+#line 6207 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 44 )
 		goto tr292;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -6230,18 +6212,18 @@ case 239:
 tr33:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st240;
 st240:
 	if ( ++p == pe )
 		goto _test_eof240;
 case 240:
-#line 6245 "inc/vcf/validator_detail_v43.hpp"
+#line 6227 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 78: goto tr357;
@@ -6252,14 +6234,14 @@ case 240:
 tr357:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st241;
 st241:
 	if ( ++p == pe )
 		goto _test_eof241;
 case 241:
-#line 6263 "inc/vcf/validator_detail_v43.hpp"
+#line 6245 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 70: goto tr358;
@@ -6270,14 +6252,14 @@ case 241:
 tr358:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st242;
 st242:
 	if ( ++p == pe )
 		goto _test_eof242;
 case 242:
-#line 6281 "inc/vcf/validator_detail_v43.hpp"
+#line 6263 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 79: goto st243;
@@ -6295,7 +6277,7 @@ case 243:
 		goto tr41;
 	goto tr356;
 tr360:
-#line 128 "src/vcf/vcf.ragel"
+#line 122 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "INFO");
     }
@@ -6304,7 +6286,7 @@ st244:
 	if ( ++p == pe )
 		goto _test_eof244;
 case 244:
-#line 6308 "inc/vcf/validator_detail_v43.hpp"
+#line 6290 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 60 )
 		goto st245;
 	goto tr356;
@@ -6348,20 +6330,20 @@ case 248:
 		goto tr367;
 	goto tr365;
 tr366:
-#line 144 "src/vcf/vcf.ragel"
+#line 138 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st249;
 st249:
 	if ( ++p == pe )
 		goto _test_eof249;
 case 249:
-#line 6365 "inc/vcf/validator_detail_v43.hpp"
+#line 6347 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 95 )
 		goto st249;
 	if ( (*p) < 48 ) {
@@ -6379,28 +6361,28 @@ case 249:
 tr369:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st250;
 tr367:
-#line 144 "src/vcf/vcf.ragel"
+#line 138 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st250;
 st250:
 	if ( ++p == pe )
 		goto _test_eof250;
 case 250:
-#line 6404 "inc/vcf/validator_detail_v43.hpp"
+#line 6386 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 44: goto tr370;
 		case 95: goto tr369;
@@ -6427,7 +6409,7 @@ st251:
 	if ( ++p == pe )
 		goto _test_eof251;
 case 251:
-#line 6431 "inc/vcf/validator_detail_v43.hpp"
+#line 6413 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 78 )
 		goto st252;
 	goto tr356;
@@ -6487,24 +6469,24 @@ case 258:
 		goto tr380;
 	goto tr378;
 tr379:
-#line 148 "src/vcf/vcf.ragel"
+#line 142 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Number");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st259;
 st259:
 	if ( ++p == pe )
 		goto _test_eof259;
 case 259:
-#line 6508 "inc/vcf/validator_detail_v43.hpp"
+#line 6490 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 44 )
 		goto tr381;
 	goto tr378;
@@ -6518,7 +6500,7 @@ st260:
 	if ( ++p == pe )
 		goto _test_eof260;
 case 260:
-#line 6522 "inc/vcf/validator_detail_v43.hpp"
+#line 6504 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 84 )
 		goto st261;
 	goto tr356;
@@ -6563,28 +6545,28 @@ case 265:
 tr390:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st266;
 tr388:
-#line 152 "src/vcf/vcf.ragel"
+#line 146 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Type");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st266;
 st266:
 	if ( ++p == pe )
 		goto _test_eof266;
 case 266:
-#line 6588 "inc/vcf/validator_detail_v43.hpp"
+#line 6570 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 44 )
 		goto tr389;
 	if ( (*p) > 90 ) {
@@ -6603,7 +6585,7 @@ st267:
 	if ( ++p == pe )
 		goto _test_eof267;
 case 267:
-#line 6607 "inc/vcf/validator_detail_v43.hpp"
+#line 6589 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 68 )
 		goto st268;
 	goto tr356;
@@ -6692,7 +6674,7 @@ case 279:
 		goto tr403;
 	goto tr356;
 tr403:
-#line 156 "src/vcf/vcf.ragel"
+#line 150 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Description");
     }
@@ -6701,7 +6683,7 @@ st280:
 	if ( ++p == pe )
 		goto _test_eof280;
 case 280:
-#line 6705 "inc/vcf/validator_detail_v43.hpp"
+#line 6687 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr406;
 		case 92: goto tr407;
@@ -6712,24 +6694,24 @@ case 280:
 tr405:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st281;
 tr408:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st281;
 st281:
 	if ( ++p == pe )
 		goto _test_eof281;
 case 281:
-#line 6733 "inc/vcf/validator_detail_v43.hpp"
+#line 6715 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr409;
 		case 92: goto tr410;
@@ -6740,7 +6722,7 @@ case 281:
 tr406:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -6757,7 +6739,7 @@ st282:
 	if ( ++p == pe )
 		goto _test_eof282;
 case 282:
-#line 6761 "inc/vcf/validator_detail_v43.hpp"
+#line 6743 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 44: goto st283;
 		case 62: goto st297;
@@ -6784,14 +6766,14 @@ case 283:
 tr413:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st284;
 st284:
 	if ( ++p == pe )
 		goto _test_eof284;
 case 284:
-#line 6795 "inc/vcf/validator_detail_v43.hpp"
+#line 6777 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 95 )
 		goto st284;
 	if ( (*p) < 48 ) {
@@ -6809,24 +6791,24 @@ case 284:
 tr414:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st285;
 tr416:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st285;
 st285:
 	if ( ++p == pe )
 		goto _test_eof285;
 case 285:
-#line 6830 "inc/vcf/validator_detail_v43.hpp"
+#line 6812 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr417;
 		case 95: goto tr416;
@@ -6853,7 +6835,7 @@ st286:
 	if ( ++p == pe )
 		goto _test_eof286;
 case 286:
-#line 6857 "inc/vcf/validator_detail_v43.hpp"
+#line 6839 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 34 )
 		goto st287;
 	goto tr356;
@@ -6871,24 +6853,24 @@ case 287:
 tr419:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st288;
 tr421:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st288;
 st288:
 	if ( ++p == pe )
 		goto _test_eof288;
 case 288:
-#line 6892 "inc/vcf/validator_detail_v43.hpp"
+#line 6874 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr409;
 		case 92: goto tr422;
@@ -6899,24 +6881,24 @@ case 288:
 tr420:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st289;
 tr422:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st289;
 st289:
 	if ( ++p == pe )
 		goto _test_eof289;
 case 289:
-#line 6920 "inc/vcf/validator_detail_v43.hpp"
+#line 6902 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr423;
 		case 92: goto tr422;
@@ -6927,7 +6909,7 @@ case 289:
 tr423:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -6938,7 +6920,7 @@ st290:
 	if ( ++p == pe )
 		goto _test_eof290;
 case 290:
-#line 6942 "inc/vcf/validator_detail_v43.hpp"
+#line 6924 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr409;
 		case 44: goto tr424;
@@ -6951,24 +6933,24 @@ case 290:
 tr433:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st291;
 tr424:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st291;
 st291:
 	if ( ++p == pe )
 		goto _test_eof291;
 case 291:
-#line 6972 "inc/vcf/validator_detail_v43.hpp"
+#line 6954 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr409;
 		case 47: goto tr421;
@@ -7002,24 +6984,24 @@ case 291:
 tr427:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st292;
 tr429:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st292;
 st292:
 	if ( ++p == pe )
 		goto _test_eof292;
 case 292:
-#line 7023 "inc/vcf/validator_detail_v43.hpp"
+#line 7005 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr409;
 		case 47: goto tr421;
@@ -7053,24 +7035,24 @@ case 292:
 tr428:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st293;
 tr430:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st293;
 st293:
 	if ( ++p == pe )
 		goto _test_eof293;
 case 293:
-#line 7074 "inc/vcf/validator_detail_v43.hpp"
+#line 7056 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr409;
 		case 47: goto tr421;
@@ -7106,14 +7088,14 @@ tr431:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st294;
 st294:
 	if ( ++p == pe )
 		goto _test_eof294;
 case 294:
-#line 7117 "inc/vcf/validator_detail_v43.hpp"
+#line 7099 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr432;
 		case 92: goto tr422;
@@ -7131,7 +7113,7 @@ st295:
 	if ( ++p == pe )
 		goto _test_eof295;
 case 295:
-#line 7135 "inc/vcf/validator_detail_v43.hpp"
+#line 7117 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr406;
 		case 44: goto tr433;
@@ -7144,24 +7126,24 @@ case 295:
 tr434:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st296;
 tr425:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st296;
 st296:
 	if ( ++p == pe )
 		goto _test_eof296;
 case 296:
-#line 7165 "inc/vcf/validator_detail_v43.hpp"
+#line 7147 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 10: goto tr56;
 		case 13: goto tr57;
@@ -7183,24 +7165,24 @@ case 297:
 tr407:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st298;
 tr410:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st298;
 st298:
 	if ( ++p == pe )
 		goto _test_eof298;
 case 298:
-#line 7204 "inc/vcf/validator_detail_v43.hpp"
+#line 7186 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr435;
 		case 92: goto tr410;
@@ -7211,7 +7193,7 @@ case 298:
 tr435:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -7222,7 +7204,7 @@ st299:
 	if ( ++p == pe )
 		goto _test_eof299;
 case 299:
-#line 7226 "inc/vcf/validator_detail_v43.hpp"
+#line 7208 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr409;
 		case 44: goto tr436;
@@ -7235,14 +7217,14 @@ case 299:
 tr436:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st300;
 st300:
 	if ( ++p == pe )
 		goto _test_eof300;
 case 300:
-#line 7246 "inc/vcf/validator_detail_v43.hpp"
+#line 7228 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr409;
 		case 47: goto tr408;
@@ -7276,24 +7258,24 @@ case 300:
 tr441:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st301;
 tr439:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st301;
 st301:
 	if ( ++p == pe )
 		goto _test_eof301;
 case 301:
-#line 7297 "inc/vcf/validator_detail_v43.hpp"
+#line 7279 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr409;
 		case 47: goto tr408;
@@ -7327,24 +7309,24 @@ case 301:
 tr442:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st302;
 tr440:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st302;
 st302:
 	if ( ++p == pe )
 		goto _test_eof302;
 case 302:
-#line 7348 "inc/vcf/validator_detail_v43.hpp"
+#line 7330 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr409;
 		case 47: goto tr408;
@@ -7376,7 +7358,7 @@ case 302:
 tr443:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -7387,7 +7369,7 @@ st303:
 	if ( ++p == pe )
 		goto _test_eof303;
 case 303:
-#line 7391 "inc/vcf/validator_detail_v43.hpp"
+#line 7373 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr432;
 		case 92: goto tr410;
@@ -7398,14 +7380,14 @@ case 303:
 tr437:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st304;
 st304:
 	if ( ++p == pe )
 		goto _test_eof304;
 case 304:
-#line 7409 "inc/vcf/validator_detail_v43.hpp"
+#line 7391 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 10: goto tr56;
 		case 13: goto tr57;
@@ -7418,28 +7400,28 @@ case 304:
 tr444:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st305;
 tr380:
-#line 148 "src/vcf/vcf.ragel"
+#line 142 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Number");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st305;
 st305:
 	if ( ++p == pe )
 		goto _test_eof305;
 case 305:
-#line 7443 "inc/vcf/validator_detail_v43.hpp"
+#line 7425 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 44 )
 		goto tr381;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -7448,18 +7430,18 @@ case 305:
 tr34:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st306;
 st306:
 	if ( ++p == pe )
 		goto _test_eof306;
 case 306:
-#line 7463 "inc/vcf/validator_detail_v43.hpp"
+#line 7445 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 69: goto tr446;
@@ -7470,14 +7452,14 @@ case 306:
 tr446:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st307;
 st307:
 	if ( ++p == pe )
 		goto _test_eof307;
 case 307:
-#line 7481 "inc/vcf/validator_detail_v43.hpp"
+#line 7463 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 84: goto tr447;
@@ -7488,14 +7470,14 @@ case 307:
 tr447:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st308;
 st308:
 	if ( ++p == pe )
 		goto _test_eof308;
 case 308:
-#line 7499 "inc/vcf/validator_detail_v43.hpp"
+#line 7481 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 65: goto st309;
@@ -7513,7 +7495,7 @@ case 309:
 		goto tr41;
 	goto tr445;
 tr449:
-#line 168 "src/vcf/vcf.ragel"
+#line 162 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "META");
     }
@@ -7522,7 +7504,7 @@ st310:
 	if ( ++p == pe )
 		goto _test_eof310;
 case 310:
-#line 7526 "inc/vcf/validator_detail_v43.hpp"
+#line 7508 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 60 )
 		goto st311;
 	goto tr445;
@@ -7566,20 +7548,20 @@ case 314:
 		goto tr456;
 	goto tr454;
 tr455:
-#line 144 "src/vcf/vcf.ragel"
+#line 138 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st315;
 st315:
 	if ( ++p == pe )
 		goto _test_eof315;
 case 315:
-#line 7583 "inc/vcf/validator_detail_v43.hpp"
+#line 7565 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 95 )
 		goto st315;
 	if ( (*p) < 48 ) {
@@ -7597,28 +7579,28 @@ case 315:
 tr458:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st316;
 tr456:
-#line 144 "src/vcf/vcf.ragel"
+#line 138 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st316;
 st316:
 	if ( ++p == pe )
 		goto _test_eof316;
 case 316:
-#line 7622 "inc/vcf/validator_detail_v43.hpp"
+#line 7604 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 44: goto tr459;
 		case 95: goto tr458;
@@ -7645,7 +7627,7 @@ st317:
 	if ( ++p == pe )
 		goto _test_eof317;
 case 317:
-#line 7649 "inc/vcf/validator_detail_v43.hpp"
+#line 7631 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 78 )
 		goto st318;
 	goto tr445;
@@ -7699,7 +7681,7 @@ case 324:
 		goto tr468;
 	goto tr467;
 tr468:
-#line 148 "src/vcf/vcf.ragel"
+#line 142 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Number");
     }
@@ -7708,7 +7690,7 @@ st325:
 	if ( ++p == pe )
 		goto _test_eof325;
 case 325:
-#line 7712 "inc/vcf/validator_detail_v43.hpp"
+#line 7694 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 44 )
 		goto st326;
 	goto tr467;
@@ -7755,7 +7737,7 @@ case 331:
 		goto tr476;
 	goto tr475;
 tr476:
-#line 152 "src/vcf/vcf.ragel"
+#line 146 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Type");
     }
@@ -7764,7 +7746,7 @@ st332:
 	if ( ++p == pe )
 		goto _test_eof332;
 case 332:
-#line 7768 "inc/vcf/validator_detail_v43.hpp"
+#line 7750 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 116 )
 		goto st333;
 	goto tr475;
@@ -7860,7 +7842,7 @@ case 345:
 		goto tr490;
 	goto tr445;
 tr490:
-#line 172 "src/vcf/vcf.ragel"
+#line 166 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Values");
     }
@@ -7869,7 +7851,7 @@ st346:
 	if ( ++p == pe )
 		goto _test_eof346;
 case 346:
-#line 7873 "inc/vcf/validator_detail_v43.hpp"
+#line 7855 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 61 )
 		goto tr491;
 	if ( (*p) < 45 ) {
@@ -7884,24 +7866,24 @@ case 346:
 tr491:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st347;
 tr493:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st347;
 st347:
 	if ( ++p == pe )
 		goto _test_eof347;
 case 347:
-#line 7905 "inc/vcf/validator_detail_v43.hpp"
+#line 7887 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 44: goto tr494;
 		case 61: goto tr493;
@@ -7916,14 +7898,14 @@ case 347:
 tr494:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st348;
 st348:
 	if ( ++p == pe )
 		goto _test_eof348;
 case 348:
-#line 7927 "inc/vcf/validator_detail_v43.hpp"
+#line 7909 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 32: goto tr496;
 		case 61: goto tr493;
@@ -7943,14 +7925,14 @@ case 348:
 tr496:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st349;
 st349:
 	if ( ++p == pe )
 		goto _test_eof349;
 case 349:
-#line 7954 "inc/vcf/validator_detail_v43.hpp"
+#line 7936 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 61 )
 		goto tr493;
 	if ( (*p) < 45 ) {
@@ -7965,7 +7947,7 @@ case 349:
 tr495:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -7976,7 +7958,7 @@ st350:
 	if ( ++p == pe )
 		goto _test_eof350;
 case 350:
-#line 7980 "inc/vcf/validator_detail_v43.hpp"
+#line 7962 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 44: goto tr494;
 		case 62: goto st351;
@@ -8000,18 +7982,18 @@ case 351:
 tr35:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st352;
 st352:
 	if ( ++p == pe )
 		goto _test_eof352;
 case 352:
-#line 8015 "inc/vcf/validator_detail_v43.hpp"
+#line 7997 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 69: goto tr499;
@@ -8022,14 +8004,14 @@ case 352:
 tr499:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st353;
 st353:
 	if ( ++p == pe )
 		goto _test_eof353;
 case 353:
-#line 8033 "inc/vcf/validator_detail_v43.hpp"
+#line 8015 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 68: goto tr500;
@@ -8040,14 +8022,14 @@ case 353:
 tr500:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st354;
 st354:
 	if ( ++p == pe )
 		goto _test_eof354;
 case 354:
-#line 8051 "inc/vcf/validator_detail_v43.hpp"
+#line 8033 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 73: goto tr501;
@@ -8058,14 +8040,14 @@ case 354:
 tr501:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st355;
 st355:
 	if ( ++p == pe )
 		goto _test_eof355;
 case 355:
-#line 8069 "inc/vcf/validator_detail_v43.hpp"
+#line 8051 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 71: goto tr502;
@@ -8076,14 +8058,14 @@ case 355:
 tr502:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st356;
 st356:
 	if ( ++p == pe )
 		goto _test_eof356;
 case 356:
-#line 8087 "inc/vcf/validator_detail_v43.hpp"
+#line 8069 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 82: goto tr503;
@@ -8094,14 +8076,14 @@ case 356:
 tr503:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st357;
 st357:
 	if ( ++p == pe )
 		goto _test_eof357;
 case 357:
-#line 8105 "inc/vcf/validator_detail_v43.hpp"
+#line 8087 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 69: goto tr504;
@@ -8112,14 +8094,14 @@ case 357:
 tr504:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st358;
 st358:
 	if ( ++p == pe )
 		goto _test_eof358;
 case 358:
-#line 8123 "inc/vcf/validator_detail_v43.hpp"
+#line 8105 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 69: goto st359;
@@ -8137,7 +8119,7 @@ case 359:
 		goto tr41;
 	goto tr498;
 tr506:
-#line 132 "src/vcf/vcf.ragel"
+#line 126 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "PEDIGREE");
     }
@@ -8146,7 +8128,7 @@ st360:
 	if ( ++p == pe )
 		goto _test_eof360;
 case 360:
-#line 8150 "inc/vcf/validator_detail_v43.hpp"
+#line 8132 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 60 )
 		goto st361;
 	goto tr498;
@@ -8190,20 +8172,20 @@ case 364:
 		goto tr513;
 	goto tr511;
 tr512:
-#line 144 "src/vcf/vcf.ragel"
+#line 138 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st365;
 st365:
 	if ( ++p == pe )
 		goto _test_eof365;
 case 365:
-#line 8207 "inc/vcf/validator_detail_v43.hpp"
+#line 8189 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 95 )
 		goto st365;
 	if ( (*p) < 48 ) {
@@ -8221,28 +8203,28 @@ case 365:
 tr515:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st366;
 tr513:
-#line 144 "src/vcf/vcf.ragel"
+#line 138 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st366;
 st366:
 	if ( ++p == pe )
 		goto _test_eof366;
 case 366:
-#line 8246 "inc/vcf/validator_detail_v43.hpp"
+#line 8228 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 44: goto tr516;
 		case 95: goto tr515;
@@ -8269,7 +8251,7 @@ st367:
 	if ( ++p == pe )
 		goto _test_eof367;
 case 367:
-#line 8273 "inc/vcf/validator_detail_v43.hpp"
+#line 8255 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 70: goto st368;
 		case 78: goto tr519;
@@ -8337,20 +8319,20 @@ case 374:
 		goto tr529;
 	goto tr527;
 tr528:
-#line 180 "src/vcf/vcf.ragel"
+#line 174 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Father");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st375;
 st375:
 	if ( ++p == pe )
 		goto _test_eof375;
 case 375:
-#line 8354 "inc/vcf/validator_detail_v43.hpp"
+#line 8336 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 95 )
 		goto st375;
 	if ( (*p) < 48 ) {
@@ -8368,28 +8350,28 @@ case 375:
 tr531:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st376;
 tr529:
-#line 180 "src/vcf/vcf.ragel"
+#line 174 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Father");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st376;
 st376:
 	if ( ++p == pe )
 		goto _test_eof376;
 case 376:
-#line 8393 "inc/vcf/validator_detail_v43.hpp"
+#line 8375 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 44: goto tr532;
 		case 95: goto tr531;
@@ -8416,7 +8398,7 @@ st377:
 	if ( ++p == pe )
 		goto _test_eof377;
 case 377:
-#line 8420 "inc/vcf/validator_detail_v43.hpp"
+#line 8402 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 77 )
 		goto st378;
 	goto tr498;
@@ -8481,20 +8463,20 @@ case 384:
 		goto tr541;
 	goto tr527;
 tr540:
-#line 184 "src/vcf/vcf.ragel"
+#line 178 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Mother");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st385;
 st385:
 	if ( ++p == pe )
 		goto _test_eof385;
 case 385:
-#line 8498 "inc/vcf/validator_detail_v43.hpp"
+#line 8480 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 95 )
 		goto st385;
 	if ( (*p) < 48 ) {
@@ -8512,28 +8494,28 @@ case 385:
 tr543:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st386;
 tr541:
-#line 184 "src/vcf/vcf.ragel"
+#line 178 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Mother");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st386;
 st386:
 	if ( ++p == pe )
 		goto _test_eof386;
 case 386:
-#line 8537 "inc/vcf/validator_detail_v43.hpp"
+#line 8519 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 62: goto tr544;
 		case 95: goto tr543;
@@ -8560,7 +8542,7 @@ st387:
 	if ( ++p == pe )
 		goto _test_eof387;
 case 387:
-#line 8564 "inc/vcf/validator_detail_v43.hpp"
+#line 8546 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 10: goto tr56;
 		case 13: goto tr57;
@@ -8569,88 +8551,88 @@ case 387:
 tr519:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st388;
 st388:
 	if ( ++p == pe )
 		goto _test_eof388;
 case 388:
-#line 8584 "inc/vcf/validator_detail_v43.hpp"
+#line 8566 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 97 )
 		goto tr545;
 	goto tr517;
 tr545:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st389;
 st389:
 	if ( ++p == pe )
 		goto _test_eof389;
 case 389:
-#line 8598 "inc/vcf/validator_detail_v43.hpp"
+#line 8580 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 109 )
 		goto tr546;
 	goto tr517;
 tr546:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st390;
 st390:
 	if ( ++p == pe )
 		goto _test_eof390;
 case 390:
-#line 8612 "inc/vcf/validator_detail_v43.hpp"
+#line 8594 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 101 )
 		goto tr547;
 	goto tr517;
 tr547:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st391;
 st391:
 	if ( ++p == pe )
 		goto _test_eof391;
 case 391:
-#line 8626 "inc/vcf/validator_detail_v43.hpp"
+#line 8608 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 95 )
 		goto tr548;
 	goto tr517;
 tr548:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st392;
 st392:
 	if ( ++p == pe )
 		goto _test_eof392;
 case 392:
-#line 8640 "inc/vcf/validator_detail_v43.hpp"
+#line 8622 "src/vcf/validator_detail_v43.cpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr549;
 	goto tr517;
 tr549:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st393;
 st393:
 	if ( ++p == pe )
 		goto _test_eof393;
 case 393:
-#line 8654 "inc/vcf/validator_detail_v43.hpp"
+#line 8636 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 61 )
 		goto tr550;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -8666,7 +8648,7 @@ st394:
 	if ( ++p == pe )
 		goto _test_eof394;
 case 394:
-#line 8670 "inc/vcf/validator_detail_v43.hpp"
+#line 8652 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 95 )
 		goto tr551;
 	if ( (*p) < 48 ) {
@@ -8684,14 +8666,14 @@ case 394:
 tr551:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st395;
 st395:
 	if ( ++p == pe )
 		goto _test_eof395;
 case 395:
-#line 8695 "inc/vcf/validator_detail_v43.hpp"
+#line 8677 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 95 )
 		goto st395;
 	if ( (*p) < 48 ) {
@@ -8709,24 +8691,24 @@ case 395:
 tr552:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st396;
 tr554:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st396;
 st396:
 	if ( ++p == pe )
 		goto _test_eof396;
 case 396:
-#line 8730 "inc/vcf/validator_detail_v43.hpp"
+#line 8712 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 44: goto tr555;
 		case 62: goto tr544;
@@ -8754,7 +8736,7 @@ st397:
 	if ( ++p == pe )
 		goto _test_eof397;
 case 397:
-#line 8758 "inc/vcf/validator_detail_v43.hpp"
+#line 8740 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 78 )
 		goto tr519;
 	goto tr517;
@@ -8833,20 +8815,20 @@ case 406:
 		goto tr566;
 	goto tr564;
 tr565:
-#line 176 "src/vcf/vcf.ragel"
+#line 170 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Original");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st407;
 st407:
 	if ( ++p == pe )
 		goto _test_eof407;
 case 407:
-#line 8850 "inc/vcf/validator_detail_v43.hpp"
+#line 8832 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 95 )
 		goto st407;
 	if ( (*p) < 48 ) {
@@ -8864,28 +8846,28 @@ case 407:
 tr568:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st408;
 tr566:
-#line 176 "src/vcf/vcf.ragel"
+#line 170 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Original");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st408;
 st408:
 	if ( ++p == pe )
 		goto _test_eof408;
 case 408:
-#line 8889 "inc/vcf/validator_detail_v43.hpp"
+#line 8871 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 62: goto tr544;
 		case 95: goto tr568;
@@ -8905,18 +8887,18 @@ case 408:
 tr36:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st409;
 st409:
 	if ( ++p == pe )
 		goto _test_eof409;
 case 409:
-#line 8920 "inc/vcf/validator_detail_v43.hpp"
+#line 8902 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 65: goto tr570;
@@ -8927,14 +8909,14 @@ case 409:
 tr570:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st410;
 st410:
 	if ( ++p == pe )
 		goto _test_eof410;
 case 410:
-#line 8938 "inc/vcf/validator_detail_v43.hpp"
+#line 8920 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 77: goto tr571;
@@ -8945,14 +8927,14 @@ case 410:
 tr571:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st411;
 st411:
 	if ( ++p == pe )
 		goto _test_eof411;
 case 411:
-#line 8956 "inc/vcf/validator_detail_v43.hpp"
+#line 8938 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 80: goto tr572;
@@ -8963,14 +8945,14 @@ case 411:
 tr572:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st412;
 st412:
 	if ( ++p == pe )
 		goto _test_eof412;
 case 412:
-#line 8974 "inc/vcf/validator_detail_v43.hpp"
+#line 8956 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 76: goto tr573;
@@ -8981,14 +8963,14 @@ case 412:
 tr573:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st413;
 st413:
 	if ( ++p == pe )
 		goto _test_eof413;
 case 413:
-#line 8992 "inc/vcf/validator_detail_v43.hpp"
+#line 8974 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 69: goto st414;
@@ -9006,7 +8988,7 @@ case 414:
 		goto tr41;
 	goto tr569;
 tr575:
-#line 140 "src/vcf/vcf.ragel"
+#line 134 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "SAMPLE");
     }
@@ -9015,7 +8997,7 @@ st415:
 	if ( ++p == pe )
 		goto _test_eof415;
 case 415:
-#line 9019 "inc/vcf/validator_detail_v43.hpp"
+#line 9001 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 60 )
 		goto st416;
 	goto tr569;
@@ -9059,20 +9041,20 @@ case 419:
 		goto tr582;
 	goto tr580;
 tr581:
-#line 144 "src/vcf/vcf.ragel"
+#line 138 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st420;
 st420:
 	if ( ++p == pe )
 		goto _test_eof420;
 case 420:
-#line 9076 "inc/vcf/validator_detail_v43.hpp"
+#line 9058 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 95 )
 		goto st420;
 	if ( (*p) < 48 ) {
@@ -9090,28 +9072,28 @@ case 420:
 tr584:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st421;
 tr582:
-#line 144 "src/vcf/vcf.ragel"
+#line 138 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st421;
 st421:
 	if ( ++p == pe )
 		goto _test_eof421;
 case 421:
-#line 9115 "inc/vcf/validator_detail_v43.hpp"
+#line 9097 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 44: goto tr585;
 		case 62: goto tr586;
@@ -9139,7 +9121,7 @@ st422:
 	if ( ++p == pe )
 		goto _test_eof422;
 case 422:
-#line 9143 "inc/vcf/validator_detail_v43.hpp"
+#line 9125 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 95 )
 		goto tr587;
 	if ( (*p) < 48 ) {
@@ -9157,14 +9139,14 @@ case 422:
 tr587:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st423;
 st423:
 	if ( ++p == pe )
 		goto _test_eof423;
 case 423:
-#line 9168 "inc/vcf/validator_detail_v43.hpp"
+#line 9150 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 95 )
 		goto st423;
 	if ( (*p) < 48 ) {
@@ -9182,24 +9164,24 @@ case 423:
 tr588:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st424;
 tr590:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st424;
 st424:
 	if ( ++p == pe )
 		goto _test_eof424;
 case 424:
-#line 9203 "inc/vcf/validator_detail_v43.hpp"
+#line 9185 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr591;
 		case 95: goto tr590;
@@ -9226,7 +9208,7 @@ st425:
 	if ( ++p == pe )
 		goto _test_eof425;
 case 425:
-#line 9230 "inc/vcf/validator_detail_v43.hpp"
+#line 9212 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 34 )
 		goto st428;
 	if ( (*p) < 45 ) {
@@ -9241,24 +9223,24 @@ case 425:
 tr592:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st426;
 tr594:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st426;
 st426:
 	if ( ++p == pe )
 		goto _test_eof426;
 case 426:
-#line 9262 "inc/vcf/validator_detail_v43.hpp"
+#line 9244 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 44: goto tr585;
 		case 62: goto tr586;
@@ -9279,7 +9261,7 @@ st427:
 	if ( ++p == pe )
 		goto _test_eof427;
 case 427:
-#line 9283 "inc/vcf/validator_detail_v43.hpp"
+#line 9265 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 10: goto tr56;
 		case 13: goto tr57;
@@ -9299,24 +9281,24 @@ case 428:
 tr595:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st429;
 tr598:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st429;
 st429:
 	if ( ++p == pe )
 		goto _test_eof429;
 case 429:
-#line 9320 "inc/vcf/validator_detail_v43.hpp"
+#line 9302 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr599;
 		case 92: goto tr600;
@@ -9327,7 +9309,7 @@ case 429:
 tr596:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -9344,7 +9326,7 @@ st430:
 	if ( ++p == pe )
 		goto _test_eof430;
 case 430:
-#line 9348 "inc/vcf/validator_detail_v43.hpp"
+#line 9330 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 44: goto st422;
 		case 62: goto st427;
@@ -9353,24 +9335,24 @@ case 430:
 tr597:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st431;
 tr600:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st431;
 st431:
 	if ( ++p == pe )
 		goto _test_eof431;
 case 431:
-#line 9374 "inc/vcf/validator_detail_v43.hpp"
+#line 9356 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr603;
 		case 92: goto tr600;
@@ -9381,7 +9363,7 @@ case 431:
 tr603:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -9392,7 +9374,7 @@ st432:
 	if ( ++p == pe )
 		goto _test_eof432;
 case 432:
-#line 9396 "inc/vcf/validator_detail_v43.hpp"
+#line 9378 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr599;
 		case 44: goto tr604;
@@ -9405,23 +9387,23 @@ case 432:
 tr618:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st433;
 tr604:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st433;
 tr615:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -9432,7 +9414,7 @@ st433:
 	if ( ++p == pe )
 		goto _test_eof433;
 case 433:
-#line 9436 "inc/vcf/validator_detail_v43.hpp"
+#line 9418 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr599;
 		case 47: goto tr598;
@@ -9466,24 +9448,24 @@ case 433:
 tr606:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st434;
 tr608:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st434;
 st434:
 	if ( ++p == pe )
 		goto _test_eof434;
 case 434:
-#line 9487 "inc/vcf/validator_detail_v43.hpp"
+#line 9469 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr599;
 		case 47: goto tr598;
@@ -9517,24 +9499,24 @@ case 434:
 tr607:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st435;
 tr609:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st435;
 st435:
 	if ( ++p == pe )
 		goto _test_eof435;
 case 435:
-#line 9538 "inc/vcf/validator_detail_v43.hpp"
+#line 9520 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr599;
 		case 47: goto tr598;
@@ -9570,14 +9552,14 @@ tr610:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st436;
 st436:
 	if ( ++p == pe )
 		goto _test_eof436;
 case 436:
-#line 9581 "inc/vcf/validator_detail_v43.hpp"
+#line 9563 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr612;
 		case 44: goto tr598;
@@ -9590,24 +9572,24 @@ case 436:
 tr614:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st437;
 tr611:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st437;
 st437:
 	if ( ++p == pe )
 		goto _test_eof437;
 case 437:
-#line 9611 "inc/vcf/validator_detail_v43.hpp"
+#line 9593 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr599;
 		case 44: goto tr615;
@@ -9620,23 +9602,23 @@ case 437:
 tr619:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st438;
 tr605:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st438;
 tr616:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -9647,7 +9629,7 @@ st438:
 	if ( ++p == pe )
 		goto _test_eof438;
 case 438:
-#line 9651 "inc/vcf/validator_detail_v43.hpp"
+#line 9633 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 10: goto tr56;
 		case 13: goto tr57;
@@ -9660,24 +9642,24 @@ case 438:
 tr617:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st439;
 tr613:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st439;
 st439:
 	if ( ++p == pe )
 		goto _test_eof439;
 case 439:
-#line 9681 "inc/vcf/validator_detail_v43.hpp"
+#line 9663 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr603;
 		case 44: goto tr615;
@@ -9697,7 +9679,7 @@ st440:
 	if ( ++p == pe )
 		goto _test_eof440;
 case 440:
-#line 9701 "inc/vcf/validator_detail_v43.hpp"
+#line 9683 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr596;
 		case 44: goto tr618;
@@ -9710,18 +9692,18 @@ case 440:
 tr37:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st441;
 st441:
 	if ( ++p == pe )
 		goto _test_eof441;
 case 441:
-#line 9725 "inc/vcf/validator_detail_v43.hpp"
+#line 9707 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 115: goto tr621;
@@ -9732,14 +9714,14 @@ case 441:
 tr621:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st442;
 st442:
 	if ( ++p == pe )
 		goto _test_eof442;
 case 442:
-#line 9743 "inc/vcf/validator_detail_v43.hpp"
+#line 9725 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 115: goto tr622;
@@ -9750,14 +9732,14 @@ case 442:
 tr622:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st443;
 st443:
 	if ( ++p == pe )
 		goto _test_eof443;
 case 443:
-#line 9761 "inc/vcf/validator_detail_v43.hpp"
+#line 9743 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 101: goto tr623;
@@ -9768,14 +9750,14 @@ case 443:
 tr623:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st444;
 st444:
 	if ( ++p == pe )
 		goto _test_eof444;
 case 444:
-#line 9779 "inc/vcf/validator_detail_v43.hpp"
+#line 9761 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 109: goto tr624;
@@ -9786,14 +9768,14 @@ case 444:
 tr624:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st445;
 st445:
 	if ( ++p == pe )
 		goto _test_eof445;
 case 445:
-#line 9797 "inc/vcf/validator_detail_v43.hpp"
+#line 9779 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 98: goto tr625;
@@ -9804,14 +9786,14 @@ case 445:
 tr625:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st446;
 st446:
 	if ( ++p == pe )
 		goto _test_eof446;
 case 446:
-#line 9815 "inc/vcf/validator_detail_v43.hpp"
+#line 9797 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 108: goto tr626;
@@ -9822,14 +9804,14 @@ case 446:
 tr626:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st447;
 st447:
 	if ( ++p == pe )
 		goto _test_eof447;
 case 447:
-#line 9833 "inc/vcf/validator_detail_v43.hpp"
+#line 9815 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 121: goto st448;
@@ -9847,7 +9829,7 @@ case 448:
 		goto tr41;
 	goto tr620;
 tr628:
-#line 112 "src/vcf/vcf.ragel"
+#line 106 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "assembly");
     }
@@ -9856,7 +9838,7 @@ st449:
 	if ( ++p == pe )
 		goto _test_eof449;
 case 449:
-#line 9860 "inc/vcf/validator_detail_v43.hpp"
+#line 9842 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) > 90 ) {
 		if ( 97 <= (*p) && (*p) <= 122 )
 			goto tr630;
@@ -9866,14 +9848,14 @@ case 449:
 tr630:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st450;
 st450:
 	if ( ++p == pe )
 		goto _test_eof450;
 case 450:
-#line 9877 "inc/vcf/validator_detail_v43.hpp"
+#line 9859 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 10: goto tr629;
 		case 13: goto tr632;
@@ -9886,20 +9868,16 @@ case 450:
 tr632:
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st451;
 st451:
 	if ( ++p == pe )
 		goto _test_eof451;
 case 451:
-#line 9903 "inc/vcf/validator_detail_v43.hpp"
+#line 9881 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 10: goto tr629;
 		case 13: goto tr632;
@@ -9987,29 +9965,25 @@ case 460:
 tr637:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st461;
 tr646:
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 196 "src/vcf/vcf.ragel"
+#line 190 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_meta_line(*this);
@@ -10022,7 +9996,7 @@ st461:
 	if ( ++p == pe )
 		goto _test_eof461;
 case 461:
-#line 10026 "inc/vcf/validator_detail_v43.hpp"
+#line 10000 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 10: goto tr46;
 		case 13: goto tr646;
@@ -10079,18 +10053,18 @@ case 467:
 tr38:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st468;
 st468:
 	if ( ++p == pe )
 		goto _test_eof468;
 case 468:
-#line 10094 "inc/vcf/validator_detail_v43.hpp"
+#line 10068 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 111: goto tr651;
@@ -10101,14 +10075,14 @@ case 468:
 tr651:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st469;
 st469:
 	if ( ++p == pe )
 		goto _test_eof469;
 case 469:
-#line 10112 "inc/vcf/validator_detail_v43.hpp"
+#line 10086 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 110: goto tr652;
@@ -10119,14 +10093,14 @@ case 469:
 tr652:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st470;
 st470:
 	if ( ++p == pe )
 		goto _test_eof470;
 case 470:
-#line 10130 "inc/vcf/validator_detail_v43.hpp"
+#line 10104 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 116: goto tr653;
@@ -10137,14 +10111,14 @@ case 470:
 tr653:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st471;
 st471:
 	if ( ++p == pe )
 		goto _test_eof471;
 case 471:
-#line 10148 "inc/vcf/validator_detail_v43.hpp"
+#line 10122 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 105: goto tr654;
@@ -10155,14 +10129,14 @@ case 471:
 tr654:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st472;
 st472:
 	if ( ++p == pe )
 		goto _test_eof472;
 case 472:
-#line 10166 "inc/vcf/validator_detail_v43.hpp"
+#line 10140 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 103: goto st473;
@@ -10180,7 +10154,7 @@ case 473:
 		goto tr41;
 	goto tr650;
 tr656:
-#line 116 "src/vcf/vcf.ragel"
+#line 110 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "contig");
     }
@@ -10189,7 +10163,7 @@ st474:
 	if ( ++p == pe )
 		goto _test_eof474;
 case 474:
-#line 10193 "inc/vcf/validator_detail_v43.hpp"
+#line 10167 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 60 )
 		goto st475;
 	goto tr650;
@@ -10241,28 +10215,28 @@ case 478:
 tr663:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st479;
 tr662:
-#line 144 "src/vcf/vcf.ragel"
+#line 138 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st479;
 st479:
 	if ( ++p == pe )
 		goto _test_eof479;
 case 479:
-#line 10266 "inc/vcf/validator_detail_v43.hpp"
+#line 10240 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 44: goto tr664;
 		case 59: goto tr663;
@@ -10291,7 +10265,7 @@ st480:
 	if ( ++p == pe )
 		goto _test_eof480;
 case 480:
-#line 10295 "inc/vcf/validator_detail_v43.hpp"
+#line 10269 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 95 )
 		goto tr666;
 	if ( (*p) < 48 ) {
@@ -10309,14 +10283,14 @@ case 480:
 tr666:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st481;
 st481:
 	if ( ++p == pe )
 		goto _test_eof481;
 case 481:
-#line 10320 "inc/vcf/validator_detail_v43.hpp"
+#line 10294 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 95 )
 		goto st481;
 	if ( (*p) < 48 ) {
@@ -10334,24 +10308,24 @@ case 481:
 tr667:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st482;
 tr669:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st482;
 st482:
 	if ( ++p == pe )
 		goto _test_eof482;
 case 482:
-#line 10355 "inc/vcf/validator_detail_v43.hpp"
+#line 10329 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr670;
 		case 95: goto tr669;
@@ -10378,7 +10352,7 @@ st483:
 	if ( ++p == pe )
 		goto _test_eof483;
 case 483:
-#line 10382 "inc/vcf/validator_detail_v43.hpp"
+#line 10356 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 34 )
 		goto st486;
 	if ( (*p) < 45 ) {
@@ -10393,24 +10367,24 @@ case 483:
 tr671:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st484;
 tr673:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st484;
 st484:
 	if ( ++p == pe )
 		goto _test_eof484;
 case 484:
-#line 10414 "inc/vcf/validator_detail_v43.hpp"
+#line 10388 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 44: goto tr664;
 		case 62: goto tr665;
@@ -10431,7 +10405,7 @@ st485:
 	if ( ++p == pe )
 		goto _test_eof485;
 case 485:
-#line 10435 "inc/vcf/validator_detail_v43.hpp"
+#line 10409 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 10: goto tr56;
 		case 13: goto tr57;
@@ -10451,24 +10425,24 @@ case 486:
 tr674:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st487;
 tr677:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st487;
 st487:
 	if ( ++p == pe )
 		goto _test_eof487;
 case 487:
-#line 10472 "inc/vcf/validator_detail_v43.hpp"
+#line 10446 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr678;
 		case 92: goto tr679;
@@ -10479,7 +10453,7 @@ case 487:
 tr675:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -10496,7 +10470,7 @@ st488:
 	if ( ++p == pe )
 		goto _test_eof488;
 case 488:
-#line 10500 "inc/vcf/validator_detail_v43.hpp"
+#line 10474 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 44: goto st480;
 		case 62: goto st485;
@@ -10505,24 +10479,24 @@ case 488:
 tr676:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st489;
 tr679:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st489;
 st489:
 	if ( ++p == pe )
 		goto _test_eof489;
 case 489:
-#line 10526 "inc/vcf/validator_detail_v43.hpp"
+#line 10500 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr682;
 		case 92: goto tr679;
@@ -10533,7 +10507,7 @@ case 489:
 tr682:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -10544,7 +10518,7 @@ st490:
 	if ( ++p == pe )
 		goto _test_eof490;
 case 490:
-#line 10548 "inc/vcf/validator_detail_v43.hpp"
+#line 10522 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr678;
 		case 44: goto tr683;
@@ -10557,23 +10531,23 @@ case 490:
 tr697:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st491;
 tr683:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st491;
 tr694:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -10584,7 +10558,7 @@ st491:
 	if ( ++p == pe )
 		goto _test_eof491;
 case 491:
-#line 10588 "inc/vcf/validator_detail_v43.hpp"
+#line 10562 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr678;
 		case 47: goto tr677;
@@ -10618,24 +10592,24 @@ case 491:
 tr685:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st492;
 tr687:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st492;
 st492:
 	if ( ++p == pe )
 		goto _test_eof492;
 case 492:
-#line 10639 "inc/vcf/validator_detail_v43.hpp"
+#line 10613 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr678;
 		case 47: goto tr677;
@@ -10669,24 +10643,24 @@ case 492:
 tr686:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st493;
 tr688:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st493;
 st493:
 	if ( ++p == pe )
 		goto _test_eof493;
 case 493:
-#line 10690 "inc/vcf/validator_detail_v43.hpp"
+#line 10664 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr678;
 		case 47: goto tr677;
@@ -10722,14 +10696,14 @@ tr689:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st494;
 st494:
 	if ( ++p == pe )
 		goto _test_eof494;
 case 494:
-#line 10733 "inc/vcf/validator_detail_v43.hpp"
+#line 10707 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr691;
 		case 44: goto tr677;
@@ -10742,24 +10716,24 @@ case 494:
 tr693:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st495;
 tr690:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st495;
 st495:
 	if ( ++p == pe )
 		goto _test_eof495;
 case 495:
-#line 10763 "inc/vcf/validator_detail_v43.hpp"
+#line 10737 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr678;
 		case 44: goto tr694;
@@ -10772,23 +10746,23 @@ case 495:
 tr698:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st496;
 tr684:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st496;
 tr695:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -10799,7 +10773,7 @@ st496:
 	if ( ++p == pe )
 		goto _test_eof496;
 case 496:
-#line 10803 "inc/vcf/validator_detail_v43.hpp"
+#line 10777 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 10: goto tr56;
 		case 13: goto tr57;
@@ -10812,24 +10786,24 @@ case 496:
 tr696:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st497;
 tr692:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st497;
 st497:
 	if ( ++p == pe )
 		goto _test_eof497;
 case 497:
-#line 10833 "inc/vcf/validator_detail_v43.hpp"
+#line 10807 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr682;
 		case 44: goto tr694;
@@ -10849,7 +10823,7 @@ st498:
 	if ( ++p == pe )
 		goto _test_eof498;
 case 498:
-#line 10853 "inc/vcf/validator_detail_v43.hpp"
+#line 10827 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 34: goto tr675;
 		case 44: goto tr697;
@@ -10862,18 +10836,18 @@ case 498:
 tr39:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st499;
 st499:
 	if ( ++p == pe )
 		goto _test_eof499;
 case 499:
-#line 10877 "inc/vcf/validator_detail_v43.hpp"
+#line 10851 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 101: goto tr700;
@@ -10884,14 +10858,14 @@ case 499:
 tr700:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st500;
 st500:
 	if ( ++p == pe )
 		goto _test_eof500;
 case 500:
-#line 10895 "inc/vcf/validator_detail_v43.hpp"
+#line 10869 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 100: goto tr701;
@@ -10902,14 +10876,14 @@ case 500:
 tr701:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st501;
 st501:
 	if ( ++p == pe )
 		goto _test_eof501;
 case 501:
-#line 10913 "inc/vcf/validator_detail_v43.hpp"
+#line 10887 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 105: goto tr702;
@@ -10920,14 +10894,14 @@ case 501:
 tr702:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st502;
 st502:
 	if ( ++p == pe )
 		goto _test_eof502;
 case 502:
-#line 10931 "inc/vcf/validator_detail_v43.hpp"
+#line 10905 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 103: goto tr703;
@@ -10938,14 +10912,14 @@ case 502:
 tr703:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st503;
 st503:
 	if ( ++p == pe )
 		goto _test_eof503;
 case 503:
-#line 10949 "inc/vcf/validator_detail_v43.hpp"
+#line 10923 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 114: goto tr704;
@@ -10956,14 +10930,14 @@ case 503:
 tr704:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st504;
 st504:
 	if ( ++p == pe )
 		goto _test_eof504;
 case 504:
-#line 10967 "inc/vcf/validator_detail_v43.hpp"
+#line 10941 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 101: goto tr705;
@@ -10974,14 +10948,14 @@ case 504:
 tr705:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st505;
 st505:
 	if ( ++p == pe )
 		goto _test_eof505;
 case 505:
-#line 10985 "inc/vcf/validator_detail_v43.hpp"
+#line 10959 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 101: goto tr706;
@@ -10992,14 +10966,14 @@ case 505:
 tr706:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st506;
 st506:
 	if ( ++p == pe )
 		goto _test_eof506;
 case 506:
-#line 11003 "inc/vcf/validator_detail_v43.hpp"
+#line 10977 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 68: goto tr707;
@@ -11010,14 +10984,14 @@ case 506:
 tr707:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st507;
 st507:
 	if ( ++p == pe )
 		goto _test_eof507;
 case 507:
-#line 11021 "inc/vcf/validator_detail_v43.hpp"
+#line 10995 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 66: goto st508;
@@ -11035,7 +11009,7 @@ case 508:
 		goto tr41;
 	goto tr699;
 tr709:
-#line 136 "src/vcf/vcf.ragel"
+#line 130 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "pedigreeDB");
     }
@@ -11044,7 +11018,7 @@ st509:
 	if ( ++p == pe )
 		goto _test_eof509;
 case 509:
-#line 11048 "inc/vcf/validator_detail_v43.hpp"
+#line 11022 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 60 )
 		goto st510;
 	goto tr699;
@@ -11061,14 +11035,14 @@ case 510:
 tr712:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st511;
 st511:
 	if ( ++p == pe )
 		goto _test_eof511;
 case 511:
-#line 11072 "inc/vcf/validator_detail_v43.hpp"
+#line 11046 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 10: goto tr711;
 		case 13: goto tr714;
@@ -11081,20 +11055,16 @@ case 511:
 tr714:
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st512;
 st512:
 	if ( ++p == pe )
 		goto _test_eof512;
 case 512:
-#line 11098 "inc/vcf/validator_detail_v43.hpp"
+#line 11068 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 10: goto tr711;
 		case 13: goto tr714;
@@ -11182,30 +11152,26 @@ case 521:
 tr719:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st522;
 tr728:
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st522;
 st522:
 	if ( ++p == pe )
 		goto _test_eof522;
 case 522:
-#line 11209 "inc/vcf/validator_detail_v43.hpp"
+#line 11175 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 10: goto tr711;
 		case 13: goto tr728;
@@ -11215,7 +11181,7 @@ case 522:
 tr729:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -11226,7 +11192,7 @@ st523:
 	if ( ++p == pe )
 		goto _test_eof523;
 case 523:
-#line 11230 "inc/vcf/validator_detail_v43.hpp"
+#line 11196 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 10: goto tr56;
 		case 13: goto tr730;
@@ -11236,19 +11202,15 @@ case 523:
 tr730:
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
-#line 196 "src/vcf/vcf.ragel"
+#line 190 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_meta_line(*this);
@@ -11261,7 +11223,7 @@ st524:
 	if ( ++p == pe )
 		goto _test_eof524;
 case 524:
-#line 11265 "inc/vcf/validator_detail_v43.hpp"
+#line 11227 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 10: goto st28;
 		case 13: goto tr728;
@@ -11352,7 +11314,7 @@ case 535:
 		goto tr739;
 	goto tr734;
 tr739:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -11361,7 +11323,7 @@ st536:
 	if ( ++p == pe )
 		goto _test_eof536;
 case 536:
-#line 11365 "inc/vcf/validator_detail_v43.hpp"
+#line 11327 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 80 )
 		goto st537;
 	goto tr734;
@@ -11387,7 +11349,7 @@ case 539:
 		goto tr743;
 	goto tr734;
 tr743:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -11396,7 +11358,7 @@ st540:
 	if ( ++p == pe )
 		goto _test_eof540;
 case 540:
-#line 11400 "inc/vcf/validator_detail_v43.hpp"
+#line 11362 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 73 )
 		goto st541;
 	goto tr734;
@@ -11415,7 +11377,7 @@ case 542:
 		goto tr746;
 	goto tr734;
 tr746:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -11424,7 +11386,7 @@ st543:
 	if ( ++p == pe )
 		goto _test_eof543;
 case 543:
-#line 11428 "inc/vcf/validator_detail_v43.hpp"
+#line 11390 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 82 )
 		goto st544;
 	goto tr734;
@@ -11450,7 +11412,7 @@ case 546:
 		goto tr750;
 	goto tr734;
 tr750:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -11459,7 +11421,7 @@ st547:
 	if ( ++p == pe )
 		goto _test_eof547;
 case 547:
-#line 11463 "inc/vcf/validator_detail_v43.hpp"
+#line 11425 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 65 )
 		goto st548;
 	goto tr734;
@@ -11485,7 +11447,7 @@ case 550:
 		goto tr754;
 	goto tr734;
 tr754:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -11494,7 +11456,7 @@ st551:
 	if ( ++p == pe )
 		goto _test_eof551;
 case 551:
-#line 11498 "inc/vcf/validator_detail_v43.hpp"
+#line 11460 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 81 )
 		goto st552;
 	goto tr734;
@@ -11527,7 +11489,7 @@ case 555:
 		goto tr759;
 	goto tr734;
 tr759:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -11536,7 +11498,7 @@ st556:
 	if ( ++p == pe )
 		goto _test_eof556;
 case 556:
-#line 11540 "inc/vcf/validator_detail_v43.hpp"
+#line 11502 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 70 )
 		goto st557;
 	goto tr734;
@@ -11583,7 +11545,7 @@ case 562:
 		goto tr766;
 	goto tr734;
 tr766:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -11592,7 +11554,7 @@ st563:
 	if ( ++p == pe )
 		goto _test_eof563;
 case 563:
-#line 11596 "inc/vcf/validator_detail_v43.hpp"
+#line 11558 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 73 )
 		goto st564;
 	goto tr734;
@@ -11628,7 +11590,7 @@ case 567:
 	}
 	goto tr734;
 tr771:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -11637,7 +11599,7 @@ st568:
 	if ( ++p == pe )
 		goto _test_eof568;
 case 568:
-#line 11641 "inc/vcf/validator_detail_v43.hpp"
+#line 11603 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 70 )
 		goto st569;
 	goto tr774;
@@ -11684,17 +11646,17 @@ case 574:
 		goto tr781;
 	goto tr774;
 tr781:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
 	goto st575;
 tr783:
-#line 204 "src/vcf/vcf.ragel"
+#line 198 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_sample_name(*this);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -11703,31 +11665,31 @@ st575:
 	if ( ++p == pe )
 		goto _test_eof575;
 case 575:
-#line 11707 "inc/vcf/validator_detail_v43.hpp"
+#line 11669 "src/vcf/validator_detail_v43.cpp"
 	if ( 32 <= (*p) && (*p) <= 126 )
 		goto tr782;
 	goto tr774;
 tr782:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st576;
 tr786:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st576;
 st576:
 	if ( ++p == pe )
 		goto _test_eof576;
 case 576:
-#line 11731 "inc/vcf/validator_detail_v43.hpp"
+#line 11693 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 9: goto tr783;
 		case 10: goto tr784;
@@ -11737,46 +11699,38 @@ case 576:
 		goto tr786;
 	goto tr774;
 tr772:
-#line 208 "src/vcf/vcf.ragel"
+#line 202 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_header_line(*this);
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st661;
 tr784:
-#line 204 "src/vcf/vcf.ragel"
+#line 198 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_sample_name(*this);
     }
-#line 208 "src/vcf/vcf.ragel"
+#line 202 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_header_line(*this);
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st661;
 st661:
 	if ( ++p == pe )
 		goto _test_eof661;
 case 661:
-#line 11780 "inc/vcf/validator_detail_v43.hpp"
+#line 11734 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 10: goto tr909;
 		case 13: goto tr910;
@@ -11803,40 +11757,31 @@ case 661:
 tr913:
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st662;
 tr909:
-#line 70 "src/vcf/vcf.ragel"
+#line 66 "src/vcf/vcf.ragel"
 	{
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st662;
 st662:
 	if ( ++p == pe )
 		goto _test_eof662;
 case 662:
-#line 11840 "inc/vcf/validator_detail_v43.hpp"
+#line 11785 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 10: goto tr913;
 		case 13: goto tr914;
@@ -11845,82 +11790,72 @@ case 662:
 tr914:
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st577;
 tr910:
-#line 70 "src/vcf/vcf.ragel"
+#line 66 "src/vcf/vcf.ragel"
 	{
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st577;
 st577:
 	if ( ++p == pe )
 		goto _test_eof577;
 case 577:
-#line 11882 "inc/vcf/validator_detail_v43.hpp"
+#line 11818 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 10 )
 		goto st662;
 	goto st0;
 tr920:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st578;
 tr791:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st578;
 tr911:
-#line 70 "src/vcf/vcf.ragel"
+#line 66 "src/vcf/vcf.ragel"
 	{
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st578;
 st578:
 	if ( ++p == pe )
 		goto _test_eof578;
 case 578:
-#line 11924 "inc/vcf/validator_detail_v43.hpp"
+#line 11859 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 9: goto tr790;
 		case 43: goto tr791;
@@ -11944,21 +11879,21 @@ tr790:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 208 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
 	goto st579;
 tr849:
-#line 214 "src/vcf/vcf.ragel"
+#line 208 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -11967,31 +11902,31 @@ st579:
 	if ( ++p == pe )
 		goto _test_eof579;
 case 579:
-#line 11971 "inc/vcf/validator_detail_v43.hpp"
+#line 11906 "src/vcf/validator_detail_v43.cpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr793;
 	goto tr792;
 tr793:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st580;
 tr795:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st580;
 st580:
 	if ( ++p == pe )
 		goto _test_eof580;
 case 580:
-#line 11995 "inc/vcf/validator_detail_v43.hpp"
+#line 11930 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 9 )
 		goto tr794;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -12008,11 +11943,11 @@ tr794:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 208 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -12021,7 +11956,7 @@ st581:
 	if ( ++p == pe )
 		goto _test_eof581;
 case 581:
-#line 12025 "inc/vcf/validator_detail_v43.hpp"
+#line 11960 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) > 58 ) {
 		if ( 60 <= (*p) && (*p) <= 126 )
 			goto tr797;
@@ -12031,24 +11966,24 @@ case 581:
 tr797:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st582;
 tr799:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st582;
 st582:
 	if ( ++p == pe )
 		goto _test_eof582;
 case 582:
-#line 12052 "inc/vcf/validator_detail_v43.hpp"
+#line 11987 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 9: goto tr798;
 		case 59: goto tr800;
@@ -12061,11 +11996,11 @@ tr798:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 208 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -12074,7 +12009,7 @@ st583:
 	if ( ++p == pe )
 		goto _test_eof583;
 case 583:
-#line 12078 "inc/vcf/validator_detail_v43.hpp"
+#line 12013 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 65: goto tr802;
 		case 67: goto tr802;
@@ -12091,24 +12026,24 @@ case 583:
 tr802:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st584;
 tr804:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st584;
 st584:
 	if ( ++p == pe )
 		goto _test_eof584;
 case 584:
-#line 12112 "inc/vcf/validator_detail_v43.hpp"
+#line 12047 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 9: goto tr803;
 		case 65: goto tr804;
@@ -12128,11 +12063,11 @@ tr803:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 208 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -12141,7 +12076,7 @@ st585:
 	if ( ++p == pe )
 		goto _test_eof585;
 case 585:
-#line 12145 "inc/vcf/validator_detail_v43.hpp"
+#line 12080 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 42: goto tr806;
 		case 46: goto tr807;
@@ -12163,24 +12098,24 @@ case 585:
 tr806:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st586;
 tr871:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st586;
 st586:
 	if ( ++p == pe )
 		goto _test_eof586;
 case 586:
-#line 12184 "inc/vcf/validator_detail_v43.hpp"
+#line 12119 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 9: goto tr812;
 		case 44: goto tr813;
@@ -12191,11 +12126,11 @@ tr812:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 208 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -12204,7 +12139,7 @@ st587:
 	if ( ++p == pe )
 		goto _test_eof587;
 case 587:
-#line 12208 "inc/vcf/validator_detail_v43.hpp"
+#line 12143 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 43: goto tr815;
 		case 45: goto tr815;
@@ -12218,18 +12153,18 @@ case 587:
 tr815:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st588;
 st588:
 	if ( ++p == pe )
 		goto _test_eof588;
 case 588:
-#line 12233 "inc/vcf/validator_detail_v43.hpp"
+#line 12168 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 73 )
 		goto tr821;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -12238,24 +12173,24 @@ case 588:
 tr817:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st589;
 tr820:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st589;
 st589:
 	if ( ++p == pe )
 		goto _test_eof589;
 case 589:
-#line 12259 "inc/vcf/validator_detail_v43.hpp"
+#line 12194 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 9: goto tr822;
 		case 46: goto tr823;
@@ -12270,11 +12205,11 @@ tr822:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 208 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -12283,7 +12218,7 @@ st590:
 	if ( ++p == pe )
 		goto _test_eof590;
 case 590:
-#line 12287 "inc/vcf/validator_detail_v43.hpp"
+#line 12222 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 46: goto tr827;
 		case 58: goto tr826;
@@ -12312,14 +12247,14 @@ case 590:
 tr826:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 	goto st591;
 st591:
 	if ( ++p == pe )
 		goto _test_eof591;
 case 591:
-#line 12323 "inc/vcf/validator_detail_v43.hpp"
+#line 12258 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 58 )
 		goto st591;
 	if ( (*p) < 65 ) {
@@ -12346,24 +12281,24 @@ case 591:
 tr828:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st592;
 tr830:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st592;
 st592:
 	if ( ++p == pe )
 		goto _test_eof592;
 case 592:
-#line 12367 "inc/vcf/validator_detail_v43.hpp"
+#line 12302 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 9: goto tr831;
 		case 59: goto tr832;
@@ -12376,11 +12311,11 @@ tr831:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 208 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -12389,7 +12324,7 @@ st593:
 	if ( ++p == pe )
 		goto _test_eof593;
 case 593:
-#line 12393 "inc/vcf/validator_detail_v43.hpp"
+#line 12328 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 46: goto tr834;
 		case 49: goto tr835;
@@ -12404,18 +12339,18 @@ case 593:
 tr834:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st663;
 st663:
 	if ( ++p == pe )
 		goto _test_eof663;
 case 663:
-#line 12419 "inc/vcf/validator_detail_v43.hpp"
+#line 12354 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 9: goto tr916;
 		case 10: goto tr917;
@@ -12433,11 +12368,11 @@ tr916:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 208 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -12446,7 +12381,7 @@ st594:
 	if ( ++p == pe )
 		goto _test_eof594;
 case 594:
-#line 12450 "inc/vcf/validator_detail_v43.hpp"
+#line 12385 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 95 )
 		goto tr838;
 	if ( (*p) > 90 ) {
@@ -12458,24 +12393,24 @@ case 594:
 tr838:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st595;
 tr840:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st595;
 st595:
 	if ( ++p == pe )
 		goto _test_eof595;
 case 595:
-#line 12479 "inc/vcf/validator_detail_v43.hpp"
+#line 12414 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 9: goto tr839;
 		case 37: goto tr840;
@@ -12497,11 +12432,11 @@ tr839:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 208 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -12510,7 +12445,7 @@ st596:
 	if ( ++p == pe )
 		goto _test_eof596;
 case 596:
-#line 12514 "inc/vcf/validator_detail_v43.hpp"
+#line 12449 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 46 )
 		goto tr844;
 	if ( (*p) < 48 ) {
@@ -12525,24 +12460,24 @@ case 596:
 tr843:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st664;
 tr853:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st664;
 st664:
 	if ( ++p == pe )
 		goto _test_eof664;
 case 664:
-#line 12546 "inc/vcf/validator_detail_v43.hpp"
+#line 12481 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 9: goto tr839;
 		case 10: goto tr917;
@@ -12557,51 +12492,44 @@ tr917:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 208 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 218 "src/vcf/vcf.ragel"
+#line 212 "src/vcf/vcf.ragel"
 	{
-        try {
-            // Handle all columns and build record
-            ParsePolicy::handle_body_line(*this);
+        // Handle all columns and build record
+        Error * error = ParsePolicy::handle_body_line(*this);
 
-            if (record != nullptr) {
-                auto duplicated_errors = previous_records.check_duplicates(*record);
-                for(auto &error_ptr : duplicated_errors) {
-                    ErrorPolicy::handle_error(*this, error_ptr.release());
-                }
+        if (error != nullptr) {
+            ErrorPolicy::handle_error(*this, error);
+        } else if (record != nullptr) {
+            auto duplicated_errors = ProfilePolicy::measure(profile, ProfiledStep::check_duplicates, [this] {
+                return previous_records.check_duplicates(*record);
+            });
+            for(auto &error_ptr : duplicated_errors) {
+                ErrorPolicy::handle_error(*this, error_ptr.release());
             }
 
-            try {
-                // Check warnings (non-blocking errors but potential mistakes anyway, only makes sense if the last record parsed was correct)
-                if (record != nullptr) {
-                    OptionalPolicy::optional_check_body_entry(*this, *record);
-                }
-            } catch (Error *warn) {
-                ErrorPolicy::handle_warning(*this, warn);
+            // Check warnings (non-blocking errors but potential mistakes anyway, only makes sense if the last record parsed was correct)
+            Error * warning = OptionalPolicy::optional_check_body_entry(*this, *record);
+            if (warning != nullptr) {
+                ErrorPolicy::handle_warning(*this, warning);
             }
-        } catch (Error *error) {
-            ErrorPolicy::handle_error(*this, error);
         }
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st665;
 st665:
 	if ( ++p == pe )
 		goto _test_eof665;
 case 665:
-#line 12605 "inc/vcf/validator_detail_v43.hpp"
+#line 12533 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 10: goto tr913;
 		case 13: goto tr914;
@@ -12626,12 +12554,11 @@ case 665:
 		goto tr920;
 	goto tr789;
 tr912:
-#line 70 "src/vcf/vcf.ragel"
+#line 66 "src/vcf/vcf.ragel"
 	{
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
     }
 	goto st597;
@@ -12639,7 +12566,7 @@ st597:
 	if ( ++p == pe )
 		goto _test_eof597;
 case 597:
-#line 12643 "inc/vcf/validator_detail_v43.hpp"
+#line 12570 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 43: goto tr846;
 		case 59: goto tr846;
@@ -12663,24 +12590,24 @@ case 597:
 tr846:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st598;
 tr847:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st598;
 st598:
 	if ( ++p == pe )
 		goto _test_eof598;
 case 598:
-#line 12684 "inc/vcf/validator_detail_v43.hpp"
+#line 12611 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 43: goto tr847;
 		case 59: goto tr847;
@@ -12709,7 +12636,7 @@ st599:
 	if ( ++p == pe )
 		goto _test_eof599;
 case 599:
-#line 12713 "inc/vcf/validator_detail_v43.hpp"
+#line 12640 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 9 )
 		goto tr849;
 	goto tr789;
@@ -12718,65 +12645,58 @@ tr918:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 208 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 218 "src/vcf/vcf.ragel"
+#line 212 "src/vcf/vcf.ragel"
 	{
-        try {
-            // Handle all columns and build record
-            ParsePolicy::handle_body_line(*this);
+        // Handle all columns and build record
+        Error * error = ParsePolicy::handle_body_line(*this);
 
-            if (record != nullptr) {
-                auto duplicated_errors = previous_records.check_duplicates(*record);
-                for(auto &error_ptr : duplicated_errors) {
-                    ErrorPolicy::handle_error(*this, error_ptr.release());
-                }
+        if (error != nullptr) {
+            ErrorPolicy::handle_error(*this, error);
+        } else if (record != nullptr) {
+            auto duplicated_errors = ProfilePolicy::measure(profile, ProfiledStep::check_duplicates, [this] {
+                return previous_records.check_duplicates(*record);
+            });
+            for(auto &error_ptr : duplicated_errors) {
+                ErrorPolicy::handle_error(*this, error_ptr.release());
             }
 
-            try {
-                // Check warnings (non-blocking errors but potential mistakes anyway, only makes sense if the last record parsed was correct)
-                if (record != nullptr) {
-                    OptionalPolicy::optional_check_body_entry(*this, *record);
-                }
-            } catch (Error *warn) {
-                ErrorPolicy::handle_warning(*this, warn);
+            // Check warnings (non-blocking errors but potential mistakes anyway, only makes sense if the last record parsed was correct)
+            Error * warning = OptionalPolicy::optional_check_body_entry(*this, *record);
+            if (warning != nullptr) {
+                ErrorPolicy::handle_warning(*this, warning);
             }
-        } catch (Error *error) {
-            ErrorPolicy::handle_error(*this, error);
         }
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st600;
 st600:
 	if ( ++p == pe )
 		goto _test_eof600;
 case 600:
-#line 12766 "inc/vcf/validator_detail_v43.hpp"
+#line 12686 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 10 )
 		goto st665;
 	goto tr850;
 tr919:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st601;
 st601:
 	if ( ++p == pe )
 		goto _test_eof601;
 case 601:
-#line 12780 "inc/vcf/validator_detail_v43.hpp"
+#line 12700 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) > 57 ) {
 		if ( 59 <= (*p) && (*p) <= 126 )
 			goto tr853;
@@ -12786,24 +12706,24 @@ case 601:
 tr844:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st666;
 tr923:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st666;
 st666:
 	if ( ++p == pe )
 		goto _test_eof666;
 case 666:
-#line 12807 "inc/vcf/validator_detail_v43.hpp"
+#line 12727 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 9: goto tr839;
 		case 10: goto tr917;
@@ -12818,14 +12738,14 @@ case 666:
 tr922:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st667;
 st667:
 	if ( ++p == pe )
 		goto _test_eof667;
 case 667:
-#line 12829 "inc/vcf/validator_detail_v43.hpp"
+#line 12749 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 9: goto tr839;
 		case 10: goto tr917;
@@ -12845,24 +12765,24 @@ case 667:
 tr845:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st668;
 tr924:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st668;
 st668:
 	if ( ++p == pe )
 		goto _test_eof668;
 case 668:
-#line 12866 "inc/vcf/validator_detail_v43.hpp"
+#line 12786 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 9: goto tr839;
 		case 10: goto tr917;
@@ -12883,74 +12803,74 @@ case 668:
 tr835:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st602;
 st602:
 	if ( ++p == pe )
 		goto _test_eof602;
 case 602:
-#line 12898 "inc/vcf/validator_detail_v43.hpp"
+#line 12818 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 48 )
 		goto tr854;
 	goto tr833;
 tr854:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st603;
 st603:
 	if ( ++p == pe )
 		goto _test_eof603;
 case 603:
-#line 12912 "inc/vcf/validator_detail_v43.hpp"
+#line 12832 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 48 )
 		goto tr855;
 	goto tr833;
 tr855:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st604;
 st604:
 	if ( ++p == pe )
 		goto _test_eof604;
 case 604:
-#line 12926 "inc/vcf/validator_detail_v43.hpp"
+#line 12846 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 48 )
 		goto tr856;
 	goto tr833;
 tr856:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st605;
 st605:
 	if ( ++p == pe )
 		goto _test_eof605;
 case 605:
-#line 12940 "inc/vcf/validator_detail_v43.hpp"
+#line 12860 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 71 )
 		goto tr857;
 	goto tr833;
 tr857:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st669;
 st669:
 	if ( ++p == pe )
 		goto _test_eof669;
 case 669:
-#line 12954 "inc/vcf/validator_detail_v43.hpp"
+#line 12874 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 9: goto tr916;
 		case 10: goto tr917;
@@ -12969,7 +12889,7 @@ st606:
 	if ( ++p == pe )
 		goto _test_eof606;
 case 606:
-#line 12973 "inc/vcf/validator_detail_v43.hpp"
+#line 12893 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 49: goto tr835;
 		case 95: goto tr836;
@@ -12983,24 +12903,24 @@ case 606:
 tr836:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st670;
 tr927:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st670;
 st670:
 	if ( ++p == pe )
 		goto _test_eof670;
 case 670:
-#line 13004 "inc/vcf/validator_detail_v43.hpp"
+#line 12924 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 9: goto tr916;
 		case 10: goto tr917;
@@ -13022,14 +12942,14 @@ case 670:
 tr926:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st607;
 st607:
 	if ( ++p == pe )
 		goto _test_eof607;
 case 607:
-#line 13033 "inc/vcf/validator_detail_v43.hpp"
+#line 12953 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) > 58 ) {
 		if ( 60 <= (*p) && (*p) <= 126 )
 			goto tr859;
@@ -13039,14 +12959,14 @@ case 607:
 tr859:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st671;
 st671:
 	if ( ++p == pe )
 		goto _test_eof671;
 case 671:
-#line 13050 "inc/vcf/validator_detail_v43.hpp"
+#line 12970 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 9: goto tr916;
 		case 10: goto tr917;
@@ -13066,7 +12986,7 @@ st608:
 	if ( ++p == pe )
 		goto _test_eof608;
 case 608:
-#line 13070 "inc/vcf/validator_detail_v43.hpp"
+#line 12990 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 58 )
 		goto tr826;
 	if ( (*p) < 65 ) {
@@ -13093,18 +13013,18 @@ case 608:
 tr827:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st609;
 st609:
 	if ( ++p == pe )
 		goto _test_eof609;
 case 609:
-#line 13108 "inc/vcf/validator_detail_v43.hpp"
+#line 13028 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 9: goto tr831;
 		case 58: goto st591;
@@ -13133,28 +13053,28 @@ case 609:
 tr823:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st610;
 st610:
 	if ( ++p == pe )
 		goto _test_eof610;
 case 610:
-#line 13144 "inc/vcf/validator_detail_v43.hpp"
+#line 13064 "src/vcf/validator_detail_v43.cpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr860;
 	goto tr814;
 tr860:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st611;
 st611:
 	if ( ++p == pe )
 		goto _test_eof611;
 case 611:
-#line 13158 "inc/vcf/validator_detail_v43.hpp"
+#line 13078 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 9: goto tr822;
 		case 69: goto tr824;
@@ -13166,14 +13086,14 @@ case 611:
 tr824:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st612;
 st612:
 	if ( ++p == pe )
 		goto _test_eof612;
 case 612:
-#line 13177 "inc/vcf/validator_detail_v43.hpp"
+#line 13097 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 43: goto tr861;
 		case 45: goto tr861;
@@ -13184,28 +13104,28 @@ case 612:
 tr861:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st613;
 st613:
 	if ( ++p == pe )
 		goto _test_eof613;
 case 613:
-#line 13195 "inc/vcf/validator_detail_v43.hpp"
+#line 13115 "src/vcf/validator_detail_v43.cpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr862;
 	goto tr814;
 tr862:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st614;
 st614:
 	if ( ++p == pe )
 		goto _test_eof614;
 case 614:
-#line 13209 "inc/vcf/validator_detail_v43.hpp"
+#line 13129 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 9 )
 		goto tr822;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -13214,94 +13134,94 @@ case 614:
 tr818:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st615;
 tr821:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st615;
 st615:
 	if ( ++p == pe )
 		goto _test_eof615;
 case 615:
-#line 13235 "inc/vcf/validator_detail_v43.hpp"
+#line 13155 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 110 )
 		goto tr863;
 	goto tr814;
 tr863:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st616;
 st616:
 	if ( ++p == pe )
 		goto _test_eof616;
 case 616:
-#line 13249 "inc/vcf/validator_detail_v43.hpp"
+#line 13169 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 102 )
 		goto tr864;
 	goto tr814;
 tr816:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st617;
 tr864:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st617;
 st617:
 	if ( ++p == pe )
 		goto _test_eof617;
 case 617:
-#line 13273 "inc/vcf/validator_detail_v43.hpp"
+#line 13193 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 9 )
 		goto tr822;
 	goto tr814;
 tr819:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st618;
 st618:
 	if ( ++p == pe )
 		goto _test_eof618;
 case 618:
-#line 13291 "inc/vcf/validator_detail_v43.hpp"
+#line 13211 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 97 )
 		goto tr865;
 	goto tr814;
 tr865:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st619;
 st619:
 	if ( ++p == pe )
 		goto _test_eof619;
 case 619:
-#line 13305 "inc/vcf/validator_detail_v43.hpp"
+#line 13225 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 78 )
 		goto tr864;
 	goto tr814;
@@ -13315,7 +13235,7 @@ st620:
 	if ( ++p == pe )
 		goto _test_eof620;
 case 620:
-#line 13319 "inc/vcf/validator_detail_v43.hpp"
+#line 13239 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 42: goto tr806;
 		case 46: goto tr866;
@@ -13337,24 +13257,24 @@ case 620:
 tr866:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st621;
 tr891:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st621;
 st621:
 	if ( ++p == pe )
 		goto _test_eof621;
 case 621:
-#line 13358 "inc/vcf/validator_detail_v43.hpp"
+#line 13278 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 65: goto tr867;
 		case 67: goto tr867;
@@ -13371,14 +13291,14 @@ case 621:
 tr867:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st622;
 st622:
 	if ( ++p == pe )
 		goto _test_eof622;
 case 622:
-#line 13382 "inc/vcf/validator_detail_v43.hpp"
+#line 13302 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 9: goto tr812;
 		case 44: goto tr813;
@@ -13397,18 +13317,18 @@ case 622:
 tr808:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st623;
 st623:
 	if ( ++p == pe )
 		goto _test_eof623;
 case 623:
-#line 13412 "inc/vcf/validator_detail_v43.hpp"
+#line 13332 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 42: goto tr869;
 		case 61: goto tr868;
@@ -13443,14 +13363,14 @@ case 623:
 tr868:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st624;
 st624:
 	if ( ++p == pe )
 		goto _test_eof624;
 case 624:
-#line 13454 "inc/vcf/validator_detail_v43.hpp"
+#line 13374 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 61 )
 		goto tr868;
 	if ( (*p) < 63 ) {
@@ -13483,14 +13403,14 @@ case 624:
 tr870:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st625;
 st625:
 	if ( ++p == pe )
 		goto _test_eof625;
 case 625:
-#line 13494 "inc/vcf/validator_detail_v43.hpp"
+#line 13414 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 62 )
 		goto tr871;
 	if ( (*p) < 45 ) {
@@ -13505,14 +13425,14 @@ case 625:
 tr869:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st626;
 st626:
 	if ( ++p == pe )
 		goto _test_eof626;
 case 626:
-#line 13516 "inc/vcf/validator_detail_v43.hpp"
+#line 13436 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 62 )
 		goto tr871;
 	if ( (*p) < 61 ) {
@@ -13545,24 +13465,24 @@ case 626:
 tr809:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st627;
 tr872:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st627;
 st627:
 	if ( ++p == pe )
 		goto _test_eof627;
 case 627:
-#line 13566 "inc/vcf/validator_detail_v43.hpp"
+#line 13486 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 9: goto tr812;
 		case 44: goto tr813;
@@ -13584,14 +13504,14 @@ case 627:
 tr873:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st628;
 st628:
 	if ( ++p == pe )
 		goto _test_eof628;
 case 628:
-#line 13595 "inc/vcf/validator_detail_v43.hpp"
+#line 13515 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 43: goto tr875;
 		case 59: goto tr875;
@@ -13616,14 +13536,14 @@ case 628:
 tr875:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st629;
 st629:
 	if ( ++p == pe )
 		goto _test_eof629;
 case 629:
-#line 13627 "inc/vcf/validator_detail_v43.hpp"
+#line 13547 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 43: goto tr875;
 		case 58: goto tr877;
@@ -13644,28 +13564,28 @@ case 629:
 tr877:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st630;
 st630:
 	if ( ++p == pe )
 		goto _test_eof630;
 case 630:
-#line 13655 "inc/vcf/validator_detail_v43.hpp"
+#line 13575 "src/vcf/validator_detail_v43.cpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr878;
 	goto tr805;
 tr878:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st631;
 st631:
 	if ( ++p == pe )
 		goto _test_eof631;
 case 631:
-#line 13669 "inc/vcf/validator_detail_v43.hpp"
+#line 13589 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 91 )
 		goto tr871;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -13674,14 +13594,14 @@ case 631:
 tr876:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st632;
 st632:
 	if ( ++p == pe )
 		goto _test_eof632;
 case 632:
-#line 13685 "inc/vcf/validator_detail_v43.hpp"
+#line 13605 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 43: goto tr879;
 		case 59: goto tr879;
@@ -13705,14 +13625,14 @@ case 632:
 tr879:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st633;
 st633:
 	if ( ++p == pe )
 		goto _test_eof633;
 case 633:
-#line 13716 "inc/vcf/validator_detail_v43.hpp"
+#line 13636 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 43: goto tr879;
 		case 59: goto tr879;
@@ -13734,28 +13654,28 @@ case 633:
 tr880:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st634;
 st634:
 	if ( ++p == pe )
 		goto _test_eof634;
 case 634:
-#line 13745 "inc/vcf/validator_detail_v43.hpp"
+#line 13665 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 58 )
 		goto tr877;
 	goto tr805;
 tr874:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st635;
 st635:
 	if ( ++p == pe )
 		goto _test_eof635;
 case 635:
-#line 13759 "inc/vcf/validator_detail_v43.hpp"
+#line 13679 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 43: goto tr881;
 		case 59: goto tr881;
@@ -13780,14 +13700,14 @@ case 635:
 tr881:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st636;
 st636:
 	if ( ++p == pe )
 		goto _test_eof636;
 case 636:
-#line 13791 "inc/vcf/validator_detail_v43.hpp"
+#line 13711 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 43: goto tr881;
 		case 58: goto tr883;
@@ -13808,28 +13728,28 @@ case 636:
 tr883:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st637;
 st637:
 	if ( ++p == pe )
 		goto _test_eof637;
 case 637:
-#line 13819 "inc/vcf/validator_detail_v43.hpp"
+#line 13739 "src/vcf/validator_detail_v43.cpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr884;
 	goto tr805;
 tr884:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st638;
 st638:
 	if ( ++p == pe )
 		goto _test_eof638;
 case 638:
-#line 13833 "inc/vcf/validator_detail_v43.hpp"
+#line 13753 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 93 )
 		goto tr871;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -13838,14 +13758,14 @@ case 638:
 tr882:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st639;
 st639:
 	if ( ++p == pe )
 		goto _test_eof639;
 case 639:
-#line 13849 "inc/vcf/validator_detail_v43.hpp"
+#line 13769 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 43: goto tr885;
 		case 59: goto tr885;
@@ -13869,14 +13789,14 @@ case 639:
 tr885:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st640;
 st640:
 	if ( ++p == pe )
 		goto _test_eof640;
 case 640:
-#line 13880 "inc/vcf/validator_detail_v43.hpp"
+#line 13800 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 43: goto tr885;
 		case 59: goto tr885;
@@ -13898,32 +13818,32 @@ case 640:
 tr886:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st641;
 st641:
 	if ( ++p == pe )
 		goto _test_eof641;
 case 641:
-#line 13909 "inc/vcf/validator_detail_v43.hpp"
+#line 13829 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 58 )
 		goto tr883;
 	goto tr805;
 tr810:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st642;
 st642:
 	if ( ++p == pe )
 		goto _test_eof642;
 case 642:
-#line 13927 "inc/vcf/validator_detail_v43.hpp"
+#line 13847 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 43: goto tr887;
 		case 59: goto tr887;
@@ -13948,14 +13868,14 @@ case 642:
 tr887:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st643;
 st643:
 	if ( ++p == pe )
 		goto _test_eof643;
 case 643:
-#line 13959 "inc/vcf/validator_detail_v43.hpp"
+#line 13879 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 43: goto tr887;
 		case 58: goto tr889;
@@ -13976,28 +13896,28 @@ case 643:
 tr889:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st644;
 st644:
 	if ( ++p == pe )
 		goto _test_eof644;
 case 644:
-#line 13987 "inc/vcf/validator_detail_v43.hpp"
+#line 13907 "src/vcf/validator_detail_v43.cpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr890;
 	goto tr805;
 tr890:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st645;
 st645:
 	if ( ++p == pe )
 		goto _test_eof645;
 case 645:
-#line 14001 "inc/vcf/validator_detail_v43.hpp"
+#line 13921 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 91 )
 		goto tr891;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -14006,14 +13926,14 @@ case 645:
 tr888:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st646;
 st646:
 	if ( ++p == pe )
 		goto _test_eof646;
 case 646:
-#line 14017 "inc/vcf/validator_detail_v43.hpp"
+#line 13937 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 43: goto tr892;
 		case 59: goto tr892;
@@ -14037,14 +13957,14 @@ case 646:
 tr892:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st647;
 st647:
 	if ( ++p == pe )
 		goto _test_eof647;
 case 647:
-#line 14048 "inc/vcf/validator_detail_v43.hpp"
+#line 13968 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 43: goto tr892;
 		case 59: goto tr892;
@@ -14066,32 +13986,32 @@ case 647:
 tr893:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st648;
 st648:
 	if ( ++p == pe )
 		goto _test_eof648;
 case 648:
-#line 14077 "inc/vcf/validator_detail_v43.hpp"
+#line 13997 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 58 )
 		goto tr889;
 	goto tr805;
 tr811:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st649;
 st649:
 	if ( ++p == pe )
 		goto _test_eof649;
 case 649:
-#line 14095 "inc/vcf/validator_detail_v43.hpp"
+#line 14015 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 43: goto tr894;
 		case 59: goto tr894;
@@ -14116,14 +14036,14 @@ case 649:
 tr894:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st650;
 st650:
 	if ( ++p == pe )
 		goto _test_eof650;
 case 650:
-#line 14127 "inc/vcf/validator_detail_v43.hpp"
+#line 14047 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 43: goto tr894;
 		case 58: goto tr896;
@@ -14144,28 +14064,28 @@ case 650:
 tr896:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st651;
 st651:
 	if ( ++p == pe )
 		goto _test_eof651;
 case 651:
-#line 14155 "inc/vcf/validator_detail_v43.hpp"
+#line 14075 "src/vcf/validator_detail_v43.cpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr897;
 	goto tr805;
 tr897:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st652;
 st652:
 	if ( ++p == pe )
 		goto _test_eof652;
 case 652:
-#line 14169 "inc/vcf/validator_detail_v43.hpp"
+#line 14089 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 93 )
 		goto tr891;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -14174,14 +14094,14 @@ case 652:
 tr895:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st653;
 st653:
 	if ( ++p == pe )
 		goto _test_eof653;
 case 653:
-#line 14185 "inc/vcf/validator_detail_v43.hpp"
+#line 14105 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 43: goto tr898;
 		case 59: goto tr898;
@@ -14205,14 +14125,14 @@ case 653:
 tr898:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st654;
 st654:
 	if ( ++p == pe )
 		goto _test_eof654;
 case 654:
-#line 14216 "inc/vcf/validator_detail_v43.hpp"
+#line 14136 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 43: goto tr898;
 		case 59: goto tr898;
@@ -14234,32 +14154,32 @@ case 654:
 tr899:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st655;
 st655:
 	if ( ++p == pe )
 		goto _test_eof655;
 case 655:
-#line 14245 "inc/vcf/validator_detail_v43.hpp"
+#line 14165 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 58 )
 		goto tr896;
 	goto tr805;
 tr807:
 #line 31 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_begin(*this);
+        ParsePolicy::handle_token_begin(*this, p);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st656;
 st656:
 	if ( ++p == pe )
 		goto _test_eof656;
 case 656:
-#line 14263 "inc/vcf/validator_detail_v43.hpp"
+#line 14183 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 9: goto tr812;
 		case 65: goto tr867;
@@ -14275,51 +14195,43 @@ case 656:
 	}
 	goto tr805;
 tr773:
-#line 208 "src/vcf/vcf.ragel"
+#line 202 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_header_line(*this);
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st657;
 tr785:
-#line 204 "src/vcf/vcf.ragel"
+#line 198 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_sample_name(*this);
     }
-#line 208 "src/vcf/vcf.ragel"
+#line 202 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_header_line(*this);
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st657;
 st657:
 	if ( ++p == pe )
 		goto _test_eof657;
 case 657:
-#line 14318 "inc/vcf/validator_detail_v43.hpp"
+#line 14230 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 10 )
 		goto st661;
 	goto tr774;
 tr23:
-#line 99 "src/vcf/vcf.ragel"
+#line 93 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_fileformat(*this);
@@ -14330,40 +14242,32 @@ tr23:
     }
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st658;
 st658:
 	if ( ++p == pe )
 		goto _test_eof658;
 case 658:
-#line 14347 "inc/vcf/validator_detail_v43.hpp"
+#line 14255 "src/vcf/validator_detail_v43.cpp"
 	if ( (*p) == 10 )
 		goto st22;
 	goto tr0;
 tr904:
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st659;
 st659:
 	if ( ++p == pe )
 		goto _test_eof659;
 case 659:
-#line 14367 "inc/vcf/validator_detail_v43.hpp"
+#line 14271 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 10: goto tr903;
 		case 13: goto tr904;
@@ -14372,40 +14276,32 @@ case 659:
 tr903:
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
-#line 261 "src/vcf/vcf_v43.ragel"
+#line 263 "src/vcf/vcf_v43.ragel"
 	{ {goto st28;} }
 	goto st672;
 st672:
 	if ( ++p == pe )
 		goto _test_eof672;
 case 672:
-#line 14391 "inc/vcf/validator_detail_v43.hpp"
+#line 14291 "src/vcf/validator_detail_v43.cpp"
 	goto st0;
 tr907:
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st660;
 st660:
 	if ( ++p == pe )
 		goto _test_eof660;
 case 660:
-#line 14409 "inc/vcf/validator_detail_v43.hpp"
+#line 14305 "src/vcf/validator_detail_v43.cpp"
 	switch( (*p) ) {
 		case 10: goto tr906;
 		case 13: goto tr907;
@@ -14414,22 +14310,18 @@ case 660:
 tr906:
 #line 43 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_newline(*this);
+        ParsePolicy::handle_newline(*this, p);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
-#line 262 "src/vcf/vcf_v43.ragel"
+#line 264 "src/vcf/vcf_v43.ragel"
 	{ {goto st665;} }
 	goto st673;
 st673:
 	if ( ++p == pe )
 		goto _test_eof673;
 case 673:
-#line 14433 "inc/vcf/validator_detail_v43.hpp"
+#line 14325 "src/vcf/validator_detail_v43.cpp"
 	goto st0;
 	}
 	_test_eof2: cs = 2; goto _test_eof; 
@@ -15123,7 +15015,7 @@ case 673:
 	case 12: 
 	case 13: 
 	case 658: 
-#line 60 "src/vcf/vcf.ragel"
+#line 56 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
         p--; {goto st659;}
@@ -15177,39 +15069,37 @@ case 673:
 	case 71: 
 	case 72: 
 	case 73: 
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	break;
 	case 661: 
-#line 70 "src/vcf/vcf.ragel"
+#line 66 "src/vcf/vcf.ragel"
 	{
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
     }
 	break;
 	case 657: 
-#line 78 "src/vcf/vcf.ragel"
+#line 73 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st660;}
     }
 	break;
 	case 600: 
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st660;}
@@ -15237,12 +15127,12 @@ case 673:
 	case 96: 
 	case 103: 
 	case 114: 
-#line 247 "src/vcf/vcf.ragel"
+#line 238 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -15256,12 +15146,12 @@ case 673:
 	case 446: 
 	case 447: 
 	case 448: 
-#line 259 "src/vcf/vcf.ragel"
+#line 250 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -15296,12 +15186,12 @@ case 673:
 	case 496: 
 	case 497: 
 	case 498: 
-#line 265 "src/vcf/vcf.ragel"
+#line 256 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -15331,12 +15221,12 @@ case 673:
 	case 147: 
 	case 154: 
 	case 165: 
-#line 271 "src/vcf/vcf.ragel"
+#line 262 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -15378,12 +15268,12 @@ case 673:
 	case 213: 
 	case 220: 
 	case 231: 
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -15424,12 +15314,12 @@ case 673:
 	case 279: 
 	case 286: 
 	case 297: 
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -15469,12 +15359,12 @@ case 673:
 	case 403: 
 	case 404: 
 	case 405: 
-#line 299 "src/vcf/vcf.ragel"
+#line 290 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -15491,12 +15381,12 @@ case 673:
 	case 507: 
 	case 508: 
 	case 509: 
-#line 320 "src/vcf/vcf.ragel"
+#line 311 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -15534,12 +15424,12 @@ case 673:
 	case 348: 
 	case 349: 
 	case 351: 
-#line 326 "src/vcf/vcf.ragel"
+#line 317 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in META metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -15574,12 +15464,12 @@ case 673:
 	case 438: 
 	case 439: 
 	case 440: 
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -15589,12 +15479,12 @@ case 673:
 	case 597: 
 	case 598: 
 	case 599: 
-#line 396 "src/vcf/vcf.ragel"
+#line 386 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new ChromosomeBodyError{n_lines});
         p--; {goto st660;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st660;}
@@ -15602,12 +15492,12 @@ case 673:
 	break;
 	case 579: 
 	case 580: 
-#line 402 "src/vcf/vcf.ragel"
+#line 392 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new PositionBodyError{n_lines});
         p--; {goto st660;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st660;}
@@ -15615,12 +15505,12 @@ case 673:
 	break;
 	case 581: 
 	case 582: 
-#line 408 "src/vcf/vcf.ragel"
+#line 398 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new IdBodyError{n_lines});
         p--; {goto st660;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st660;}
@@ -15628,12 +15518,12 @@ case 673:
 	break;
 	case 583: 
 	case 584: 
-#line 414 "src/vcf/vcf.ragel"
+#line 404 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new ReferenceAlleleBodyError{n_lines});
         p--; {goto st660;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st660;}
@@ -15678,12 +15568,12 @@ case 673:
 	case 654: 
 	case 655: 
 	case 656: 
-#line 420 "src/vcf/vcf.ragel"
+#line 410 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new AlternateAllelesBodyError{n_lines});
         p--; {goto st660;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st660;}
@@ -15702,12 +15592,12 @@ case 673:
 	case 617: 
 	case 618: 
 	case 619: 
-#line 426 "src/vcf/vcf.ragel"
+#line 416 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new QualityBodyError{n_lines});
         p--; {goto st660;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st660;}
@@ -15718,12 +15608,12 @@ case 673:
 	case 592: 
 	case 608: 
 	case 609: 
-#line 432 "src/vcf/vcf.ragel"
+#line 422 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FilterBodyError{n_lines});
         p--; {goto st660;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st660;}
@@ -15737,13 +15627,13 @@ case 673:
 	case 19: 
 	case 20: 
 	case 21: 
-#line 29 "src/vcf/vcf_v43.ragel"
+#line 31 "src/vcf/vcf_v43.ragel"
 	{
         ErrorPolicy::handle_error(*this,
                 new FileformatError{n_lines, "The fileformat declaration is not 'fileformat=VCFv4.3'"});
         p--; {goto st659;}
     }
-#line 60 "src/vcf/vcf.ragel"
+#line 56 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
         p--; {goto st659;}
@@ -15751,12 +15641,12 @@ case 673:
 	break;
 	case 594: 
 	case 595: 
-#line 50 "src/vcf/vcf_v43.ragel"
+#line 52 "src/vcf/vcf_v43.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FormatBodyError{n_lines, "Format does not start with a letter/underscore followed by alphanumeric/underscore/dot characters"});
         p--; {goto st660;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st660;}
@@ -15771,20 +15661,19 @@ case 673:
 	case 574: 
 	case 575: 
 	case 576: 
-#line 55 "src/vcf/vcf_v43.ragel"
+#line 57 "src/vcf/vcf_v43.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines, "There is no newline at the end of the file"});
         p--; {goto st660;}
     }
-#line 78 "src/vcf/vcf.ragel"
+#line 73 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st660;}
@@ -15793,35 +15682,35 @@ case 673:
 	case 81: 
 	case 82: 
 	case 83: 
-#line 252 "src/vcf/vcf.ragel"
+#line 243 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines,
             "ALT metadata ID is not prefixed by DEL/INS/DUP/INV/CNV and suffixed by ':' and a text sequence"});
         p--; {goto st659;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 238 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	break;
 	case 122: 
-#line 271 "src/vcf/vcf.ragel"
+#line 262 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
         p--; {goto st659;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -15829,17 +15718,17 @@ case 673:
 	break;
 	case 199: 
 	case 200: 
-#line 293 "src/vcf/vcf.ragel"
+#line 284 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String"});
         p--; {goto st659;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -15847,17 +15736,17 @@ case 673:
 	break;
 	case 265: 
 	case 266: 
-#line 293 "src/vcf/vcf.ragel"
+#line 284 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String"});
         p--; {goto st659;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -15866,17 +15755,17 @@ case 673:
 	case 406: 
 	case 407: 
 	case 408: 
-#line 304 "src/vcf/vcf.ragel"
+#line 295 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "PEDIGREE metadata Original is not valid"});
         p--; {goto st659;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 290 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -15888,17 +15777,17 @@ case 673:
 	case 384: 
 	case 385: 
 	case 386: 
-#line 309 "src/vcf/vcf.ragel"
+#line 300 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "PEDIGREE metadata Father or Mother is not valid"});
         p--; {goto st659;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 290 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -15915,17 +15804,17 @@ case 673:
 	case 395: 
 	case 396: 
 	case 397: 
-#line 314 "src/vcf/vcf.ragel"
+#line 305 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "PEDIGREE metadata sequence of Name_N is not valid"});
         p--; {goto st659;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 290 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -15933,17 +15822,17 @@ case 673:
 	break;
 	case 324: 
 	case 325: 
-#line 331 "src/vcf/vcf.ragel"
+#line 322 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "META metadata Number is not a dot"});
         p--; {goto st659;}
     }
-#line 326 "src/vcf/vcf.ragel"
+#line 317 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in META metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -15956,17 +15845,17 @@ case 673:
 	case 335: 
 	case 336: 
 	case 337: 
-#line 336 "src/vcf/vcf.ragel"
+#line 327 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "META metadata Type is not String"});
         p--; {goto st659;}
     }
-#line 326 "src/vcf/vcf.ragel"
+#line 317 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in META metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -15974,17 +15863,17 @@ case 673:
 	break;
 	case 347: 
 	case 350: 
-#line 341 "src/vcf/vcf.ragel"
+#line 332 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "META metadata Values is not a square-bracket delimited list of values"});
         p--; {goto st659;}
     }
-#line 326 "src/vcf/vcf.ragel"
+#line 317 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in META metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -15993,17 +15882,17 @@ case 673:
 	case 100: 
 	case 101: 
 	case 102: 
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st659;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 238 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -16011,17 +15900,17 @@ case 673:
 	break;
 	case 478: 
 	case 479: 
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st659;}
     }
-#line 265 "src/vcf/vcf.ragel"
+#line 256 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -16033,17 +15922,17 @@ case 673:
 	case 151: 
 	case 152: 
 	case 153: 
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st659;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 262 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -16055,17 +15944,17 @@ case 673:
 	case 217: 
 	case 218: 
 	case 219: 
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st659;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -16077,17 +15966,17 @@ case 673:
 	case 283: 
 	case 284: 
 	case 285: 
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st659;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -16096,17 +15985,17 @@ case 673:
 	case 364: 
 	case 365: 
 	case 366: 
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st659;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 290 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -16115,17 +16004,17 @@ case 673:
 	case 314: 
 	case 315: 
 	case 316: 
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st659;}
     }
-#line 326 "src/vcf/vcf.ragel"
+#line 317 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in META metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -16134,17 +16023,17 @@ case 673:
 	case 419: 
 	case 420: 
 	case 421: 
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st659;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -16164,17 +16053,17 @@ case 673:
 	case 116: 
 	case 120: 
 	case 121: 
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st659;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 238 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -16194,17 +16083,17 @@ case 673:
 	case 167: 
 	case 171: 
 	case 172: 
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st659;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 262 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -16224,17 +16113,17 @@ case 673:
 	case 233: 
 	case 237: 
 	case 238: 
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st659;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -16254,17 +16143,17 @@ case 673:
 	case 299: 
 	case 303: 
 	case 304: 
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st659;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -16289,17 +16178,17 @@ case 673:
 	case 465: 
 	case 466: 
 	case 467: 
-#line 373 "src/vcf/vcf.ragel"
+#line 364 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata URL is not valid"});
         p--; {goto st659;}
     }
-#line 259 "src/vcf/vcf.ragel"
+#line 250 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -16326,17 +16215,17 @@ case 673:
 	case 528: 
 	case 529: 
 	case 530: 
-#line 373 "src/vcf/vcf.ragel"
+#line 364 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata URL is not valid"});
         p--; {goto st659;}
     }
-#line 320 "src/vcf/vcf.ragel"
+#line 311 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -16345,17 +16234,17 @@ case 673:
 	case 192: 
 	case 193: 
 	case 239: 
-#line 36 "src/vcf/vcf_v43.ragel"
+#line 38 "src/vcf/vcf_v43.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "FORMAT metadata Number is not a number, A, R, G or dot"});
         p--; {goto st659;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -16364,17 +16253,17 @@ case 673:
 	case 258: 
 	case 259: 
 	case 305: 
-#line 42 "src/vcf/vcf_v43.ragel"
+#line 44 "src/vcf/vcf_v43.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Number is not a number, A, R, G or dot"});
         p--; {goto st659;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -16417,53 +16306,52 @@ case 673:
 	case 565: 
 	case 566: 
 	case 567: 
-#line 55 "src/vcf/vcf_v43.ragel"
+#line 57 "src/vcf/vcf_v43.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines, "There is no newline at the end of the file"});
         p--; {goto st660;}
     }
-#line 379 "src/vcf/vcf.ragel"
+#line 370 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
             "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st660;}
     }
-#line 78 "src/vcf/vcf.ragel"
+#line 73 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st660;}
     }
 	break;
 	case 601: 
-#line 55 "src/vcf/vcf_v43.ragel"
+#line 57 "src/vcf/vcf_v43.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines, "There is no newline at the end of the file"});
         p--; {goto st660;}
     }
-#line 454 "src/vcf/vcf.ragel"
+#line 444 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " is not a valid string";
-        ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str()});
+        ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str(), "",
+                                                              "Sample is not a valid string"});
         p--; {goto st660;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st660;}
@@ -16478,76 +16366,71 @@ case 673:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 208 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 55 "src/vcf/vcf_v43.ragel"
+#line 57 "src/vcf/vcf_v43.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines, "There is no newline at the end of the file"});
         p--; {goto st660;}
     }
-#line 218 "src/vcf/vcf.ragel"
+#line 212 "src/vcf/vcf.ragel"
 	{
-        try {
-            // Handle all columns and build record
-            ParsePolicy::handle_body_line(*this);
+        // Handle all columns and build record
+        Error * error = ParsePolicy::handle_body_line(*this);
 
-            if (record != nullptr) {
-                auto duplicated_errors = previous_records.check_duplicates(*record);
-                for(auto &error_ptr : duplicated_errors) {
-                    ErrorPolicy::handle_error(*this, error_ptr.release());
-                }
+        if (error != nullptr) {
+            ErrorPolicy::handle_error(*this, error);
+        } else if (record != nullptr) {
+            auto duplicated_errors = ProfilePolicy::measure(profile, ProfiledStep::check_duplicates, [this] {
+                return previous_records.check_duplicates(*record);
+            });
+            for(auto &error_ptr : duplicated_errors) {
+                ErrorPolicy::handle_error(*this, error_ptr.release());
             }
 
-            try {
-                // Check warnings (non-blocking errors but potential mistakes anyway, only makes sense if the last record parsed was correct)
-                if (record != nullptr) {
-                    OptionalPolicy::optional_check_body_entry(*this, *record);
-                }
-            } catch (Error *warn) {
-                ErrorPolicy::handle_warning(*this, warn);
+            // Check warnings (non-blocking errors but potential mistakes anyway, only makes sense if the last record parsed was correct)
+            Error * warning = OptionalPolicy::optional_check_body_entry(*this, *record);
+            if (warning != nullptr) {
+                ErrorPolicy::handle_warning(*this, warning);
             }
-        } catch (Error *error) {
-            ErrorPolicy::handle_error(*this, error);
         }
     }
 	break;
 	case 23: 
 	case 28: 
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
-#line 55 "src/vcf/vcf_v43.ragel"
+#line 57 "src/vcf/vcf_v43.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines, "There is no newline at the end of the file"});
         p--; {goto st660;}
     }
-#line 379 "src/vcf/vcf.ragel"
+#line 370 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
             "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st660;}
     }
-#line 78 "src/vcf/vcf.ragel"
+#line 73 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st660;}
@@ -16556,22 +16439,22 @@ case 673:
 	case 108: 
 	case 109: 
 	case 110: 
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st659;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st659;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 238 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -16580,22 +16463,22 @@ case 673:
 	case 159: 
 	case 160: 
 	case 161: 
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st659;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st659;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 262 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -16604,22 +16487,22 @@ case 673:
 	case 225: 
 	case 226: 
 	case 227: 
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st659;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st659;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -16628,22 +16511,22 @@ case 673:
 	case 291: 
 	case 292: 
 	case 293: 
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st659;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st659;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -16652,22 +16535,22 @@ case 673:
 	case 117: 
 	case 118: 
 	case 119: 
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st659;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st659;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 238 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -16676,22 +16559,22 @@ case 673:
 	case 168: 
 	case 169: 
 	case 170: 
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st659;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st659;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 262 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -16700,22 +16583,22 @@ case 673:
 	case 234: 
 	case 235: 
 	case 236: 
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st659;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st659;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -16724,22 +16607,22 @@ case 673:
 	case 300: 
 	case 301: 
 	case 302: 
-#line 368 "src/vcf/vcf.ragel"
+#line 359 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
         p--; {goto st659;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 354 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
         p--; {goto st659;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
@@ -16751,44 +16634,44 @@ case 673:
 	case 604: 
 	case 605: 
 	case 606: 
-#line 443 "src/vcf/vcf.ragel"
+#line 433 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info key is not a sequence of alphanumeric and/or punctuation characters"});
         p--; {goto st660;}
     }
-#line 55 "src/vcf/vcf_v43.ragel"
+#line 57 "src/vcf/vcf_v43.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines, "There is no newline at the end of the file"});
         p--; {goto st660;}
     }
-#line 438 "src/vcf/vcf.ragel"
+#line 428 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
         p--; {goto st660;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st660;}
     }
 	break;
 	case 607: 
-#line 448 "src/vcf/vcf.ragel"
+#line 438 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info field value is not a comma-separated list of valid strings (maybe it contains whitespaces?)"});
         p--; {goto st660;}
     }
-#line 55 "src/vcf/vcf_v43.ragel"
+#line 57 "src/vcf/vcf_v43.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines, "There is no newline at the end of the file"});
         p--; {goto st660;}
     }
-#line 438 "src/vcf/vcf.ragel"
+#line 428 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
         p--; {goto st660;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st660;}
@@ -16797,7 +16680,7 @@ case 673:
 	case 666: 
 	case 667: 
 	case 668: 
-#line 55 "src/vcf/vcf_v43.ragel"
+#line 57 "src/vcf/vcf_v43.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines, "There is no newline at the end of the file"});
         p--; {goto st660;}
@@ -16806,173 +16689,258 @@ case 673:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 208 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 218 "src/vcf/vcf.ragel"
+#line 212 "src/vcf/vcf.ragel"
 	{
-        try {
-            // Handle all columns and build record
-            ParsePolicy::handle_body_line(*this);
+        // Handle all columns and build record
+        Error * error = ParsePolicy::handle_body_line(*this);
 
-            if (record != nullptr) {
-                auto duplicated_errors = previous_records.check_duplicates(*record);
-                for(auto &error_ptr : duplicated_errors) {
-                    ErrorPolicy::handle_error(*this, error_ptr.release());
-                }
+        if (error != nullptr) {
+            ErrorPolicy::handle_error(*this, error);
+        } else if (record != nullptr) {
+            auto duplicated_errors = ProfilePolicy::measure(profile, ProfiledStep::check_duplicates, [this] {
+                return previous_records.check_duplicates(*record);
+            });
+            for(auto &error_ptr : duplicated_errors) {
+                ErrorPolicy::handle_error(*this, error_ptr.release());
             }
 
-            try {
-                // Check warnings (non-blocking errors but potential mistakes anyway, only makes sense if the last record parsed was correct)
-                if (record != nullptr) {
-                    OptionalPolicy::optional_check_body_entry(*this, *record);
-                }
-            } catch (Error *warn) {
-                ErrorPolicy::handle_warning(*this, warn);
+            // Check warnings (non-blocking errors but potential mistakes anyway, only makes sense if the last record parsed was correct)
+            Error * warning = OptionalPolicy::optional_check_body_entry(*this, *record);
+            if (warning != nullptr) {
+                ErrorPolicy::handle_warning(*this, warning);
             }
-        } catch (Error *error) {
-            ErrorPolicy::handle_error(*this, error);
         }
     }
 	break;
 	case 596: 
-#line 55 "src/vcf/vcf_v43.ragel"
+#line 57 "src/vcf/vcf_v43.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines, "There is no newline at the end of the file"});
         p--; {goto st660;}
     }
-#line 461 "src/vcf/vcf.ragel"
+#line 452 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " does not start with a valid genotype";
-        ErrorPolicy::handle_error(*this, new SamplesFieldBodyError{n_lines, message_stream.str(), "", "GT"});
+        ErrorPolicy::handle_error(*this, new SamplesFieldBodyError{n_lines, message_stream.str(), "", "GT", -1,
+                                                                   "Sample does not start with a valid genotype"});
         p--; {goto st660;}
     }
-#line 454 "src/vcf/vcf.ragel"
+#line 444 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " is not a valid string";
-        ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str()});
+        ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str(), "",
+                                                              "Sample is not a valid string"});
         p--; {goto st660;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 85 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
         p--; {goto st660;}
     }
 	break;
 	case 22: 
-#line 60 "src/vcf/vcf.ragel"
+#line 56 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
-#line 55 "src/vcf/vcf_v43.ragel"
+#line 57 "src/vcf/vcf_v43.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines, "There is no newline at the end of the file"});
         p--; {goto st660;}
     }
-#line 379 "src/vcf/vcf.ragel"
+#line 370 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
             "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st660;}
     }
-#line 78 "src/vcf/vcf.ragel"
+#line 73 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
-        try {
-          OptionalPolicy::optional_check_meta_section(*this);
-        } catch (Error *warn) {
-          ErrorPolicy::handle_warning(*this, warn);
+        Error * warning = OptionalPolicy::optional_check_meta_section(*this);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
         }
         
         p--; {goto st660;}
     }
 	break;
 	case 24: 
-#line 247 "src/vcf/vcf.ragel"
+#line 238 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
         p--; {goto st659;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 262 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
         p--; {goto st659;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 268 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
         p--; {goto st659;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
         p--; {goto st659;}
     }
-#line 259 "src/vcf/vcf.ragel"
+#line 250 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
         p--; {goto st659;}
     }
-#line 265 "src/vcf/vcf.ragel"
+#line 256 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
         p--; {goto st659;}
     }
-#line 326 "src/vcf/vcf.ragel"
+#line 317 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in META metadata"});
         p--; {goto st659;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 338 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
         p--; {goto st659;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 290 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
         p--; {goto st659;}
     }
-#line 320 "src/vcf/vcf.ragel"
+#line 311 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
         p--; {goto st659;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 61 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
         p--; {goto st659;}
     }
 	break;
-#line 16967 "inc/vcf/validator_detail_v43.hpp"
+#line 16847 "src/vcf/validator_detail_v43.cpp"
 	}
 	}
 
 	_out: {}
 	}
 
-#line 291 "src/vcf/vcf_v43.ragel"
+#line 298 "src/vcf/vcf_v43.ragel"
+
+      }
+
+      ParsePolicy::handle_buffer_end(*this, pe);
+    }
+
+    template <typename Configuration>
+    void ParserImpl_v43<Configuration>::report_pending_records()
+    {
+      size_t lines_read = n_lines;
+
+      for (size_t i = 0; i < n_pending_records; ++i) {
+        PendingRecord & pending = pending_records[i];
+        Record const & pending_record = *pending.record;
+        n_lines = pending_record.line;  // as if the record had just been read
+
+        Error * error = pending.error;
+        pending.error = nullptr;
+        if (error == nullptr) {
+          error = ParsePolicy::handle_checked_record(*this, pending_record);
+        }
+        if (error != nullptr) {
+          ErrorPolicy::handle_error(*this, error);
+          continue;
+        }
+
+        auto duplicated_errors = ProfilePolicy::measure(profile, ProfiledStep::check_duplicates, [&] {
+          return previous_records.check_duplicates(pending_record);
+        });
+        for (auto &error_ptr : duplicated_errors) {
+          ErrorPolicy::handle_error(*this, error_ptr.release());
+        }
+
+        Error * warning = OptionalPolicy::optional_check_body_entry(*this, pending_record);
+        if (warning != nullptr) {
+          ErrorPolicy::handle_warning(*this, warning);
+        }
+      }
+
+      n_pending_records = 0;
+      n_lines = lines_read;
+    }
+
+    template <typename Configuration>
+    ParserImpl * ParserImpl_v43<Configuration>::new_body_parser(std::shared_ptr<Source> source) const
+    {
+      auto parser = new ParserImpl_v43<Configuration>{source};
+      parser->cs = vcf_v43_en_main_body_section;
+      return parser;
+    }
+
+    template <typename Configuration>
+    size_t ParserImpl_v43<Configuration>::line_buffers_size() const
+    {
+      return ParsePolicy::line_buffers_size();
+    }
 
+    template <typename Configuration>
+    size_t ParserImpl_v43<Configuration>::header_size() const
+    {
+      return ParsePolicy::header_size();
     }
+
+    template <typename Configuration>
+    bool ParserImpl_v43<Configuration>::skips_valid_lines() const
+    {
+      return ParsePolicy::skips_valid_lines;
+    }
+
+    template <typename Configuration>
+    char const * ParserImpl_v43<Configuration>::skip_valid_lines(char const * p, char const * pe)
+    {
+      if (cs != vcf_v43_en_main_body_section) {
+        return p;
+      }
+      typename ProfilePolicy::ParsingTimer parsing_timer{profile};
+      return ParsePolicy::skip_valid_lines(*this, p, pe);
+    }
+
+    // the only configurations of the parser, so the machine is compiled once, here
+    template class ParserImpl_v43<QuickValidatorCfg>;
+    template class ParserImpl_v43<FullValidatorCfg>;
+    template class ParserImpl_v43<ReaderCfg>;
+    template class ParserImpl_v43<ProfiledQuickValidatorCfg>;
+    template class ParserImpl_v43<ProfiledFullValidatorCfg>;
+    template class ParserImpl_v43<ProfiledReaderCfg>;
+    template class ParserImpl_v43<OrderValidatorCfg>;
+    template class ParserImpl_v43<RecordsValidatorCfg>;
+    template class ParserImpl_v43<ProfiledOrderValidatorCfg>;
+    template class ParserImpl_v43<ProfiledRecordsValidatorCfg>;
     
   }
 }
@@ -0,0 +1,90 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Compares the time per match of the hand-written field matchers and the regular expressions they replaced.
+ * Usage: bench_field_matchers [iterations]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/regex.hpp>
+
+#include "vcf/field_matchers.hpp"
+
+namespace
+{
+  /**
+   * @return nanoseconds per call of `match` on each input
+   */
+  double time_per_match(std::function<bool(std::string const &)> match, std::vector<std::string> const & inputs,
+                        size_t iterations)
+  {
+      size_t matched = 0;
+      auto start = std::chrono::steady_clock::now();
+      for (size_t i = 0; i < iterations; ++i) {
+          for (auto & input : inputs) {
+              matched += match(input);
+          }
+      }
+      auto end = std::chrono::steady_clock::now();
+
+      // use the result, so the calls are not optimized out
+      if (matched == size_t(-1)) {
+          std::cout << matched << std::endl;
+      }
+      return std::chrono::duration<double, std::nano>(end - start).count() / (iterations * inputs.size());
+  }
+
+  void compare(std::string const & name, std::string const & pattern, boost::regex::flag_type flags,
+               std::function<bool(std::string const &)> matcher, std::vector<std::string> const & inputs,
+               size_t iterations)
+  {
+      boost::regex regex{pattern, flags};
+      double regex_time = time_per_match([&regex](std::string const & s) { return boost::regex_match(s, regex); },
+                                         inputs, iterations);
+      double matcher_time = time_per_match(matcher, inputs, iterations);
+
+      std::cout << std::left << std::setw(20) << name << std::right << std::fixed << std::setprecision(1)
+                << std::setw(12) << regex_time << std::setw(12) << matcher_time
+                << std::setw(10) << regex_time / matcher_time << "x" << std::endl;
+  }
+}
+
+int main(int argc, char** argv)
+{
+    size_t iterations = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100000;
+
+    std::cout << std::left << std::setw(20) << "matcher" << std::right << std::setw(12) << "regex (ns)"
+              << std::setw(12) << "hand (ns)" << std::setw(11) << "speedup" << std::endl;
+
+    compare("symbolic allele", "<([a-zA-Z0-9:_]+)>", boost::regex::normal, ebi::vcf::is_symbolic_allele,
+            {"<DEL>", "<DUP:TANDEM>", "<INS:ME:ALU>", "<CN0>", "<DEL"}, iterations);
+    compare("bases", "[ACGTN]+", boost::regex::icase, ebi::vcf::is_bases,
+            {"A", "C", "GT", "ACGTACGTAC", "<DEL>", "acgtn"}, iterations);
+    compare("INFO AA", "((?![,;=])[[:print:]])+", boost::regex::normal, ebi::vcf::is_printable_without_separators,
+            {"A", "T", "ACG", "."}, iterations);
+    compare("INFO CIGAR", "([0-9]+[MIDNSHPX])+", boost::regex::normal, ebi::vcf::is_cigar,
+            {"1M", "10M2I3D", "150M", "3M1D20M"}, iterations);
+
+    return 0;
+}
@@ -0,0 +1,211 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * Measures the throughput of the whole validation, for every validation level and VCF version, over synthetic
+ * inputs of different shapes. The results are written as tab-separated values, one line per run, so they can be
+ * compared between releases.
+ * Usage: bench_validator [scale]
+ *
+ * The scale multiplies the number of records of every input (1 by default).
+ *
+ * The first column is the code generation style of the ragel machines it was built with; the bench_ragel_styles
+ * target builds and runs it with each style to compare them.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "vcf/report_writer.hpp"
+#include "vcf/validator.hpp"
+
+#ifndef RAGEL_CODEGEN
+#define RAGEL_CODEGEN "unknown"
+#endif
+
+namespace
+{
+  std::atomic<size_t> allocations{0};
+}
+
+void * operator new(size_t size)
+{
+    ++allocations;
+    void * memory = std::malloc(size == 0 ? 1 : size);
+    if (memory == nullptr) {
+        throw std::bad_alloc{};
+    }
+    return memory;
+}
+
+void operator delete(void * memory) noexcept
+{
+    std::free(memory);
+}
+
+namespace
+{
+  /**
+   * Counts the reports without writing them anywhere
+   */
+  class CountingReportWriter : public ebi::vcf::ReportWriter
+  {
+    public:
+      virtual void write_error(ebi::vcf::Error &error) override { ++errors; }
+      virtual void write_warning(ebi::vcf::Error &error) override { ++warnings; }
+      virtual void write_message(const std::string &report_result) override { }
+      virtual std::string get_filename() override { return ""; }
+
+      size_t errors = 0;
+      size_t warnings = 0;
+  };
+
+  struct Input
+  {
+      std::string name;
+      size_t records;
+      size_t samples;
+      bool gvcf;
+      bool errors;
+  };
+
+  std::string generate(Input const & input, std::string const & version)
+  {
+      // like the files of the variant callers, the older versions use <NON_REF>, which they report as malformed
+      bool v43 = version == "4.3";
+      std::string reference_block = v43 ? "<*>" : "<NON_REF>";
+      std::ostringstream vcf;
+      vcf << "##fileformat=VCFv" << version << "\n"
+          << "##INFO=<ID=DP,Number=1,Type=Integer,Description=\"Depth\">\n"
+          << "##INFO=<ID=END,Number=1,Type=Integer,Description=\"End of the reference block\">\n"
+          << "##FORMAT=<ID=GT,Number=1,Type=String,Description=\"Genotype\">\n"
+          << "##FORMAT=<ID=DP,Number=1,Type=Integer,Description=\"Depth\">\n"
+          << "##contig=<ID=1,length=249250621>\n"
+          << "##reference=file:///references/GRCh37.fa\n";
+      vcf << "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO";
+      if (input.samples != 0) {
+          vcf << "\tFORMAT";
+          for (size_t s = 0; s < input.samples; ++s) {
+              vcf << "\tS" << s;
+          }
+      }
+      vcf << "\n";
+
+      char const bases[] = "ACGT";
+      size_t position = 1000;
+      for (size_t r = 0; r < input.records; ++r) {
+          bool block = input.gvcf && r % 2 == 1;
+          char reference = bases[r % 4];
+          char alternate = bases[(r + 1) % 4];
+
+          vcf << "1\t" << position << "\t" << (block ? std::string{"."} : "rs" + std::to_string(r)) << "\t"
+              << reference << "\t";
+          if (block) {
+              vcf << reference_block << "\t.\t.\tEND=" << position + 9;
+          } else if (input.gvcf) {
+              vcf << alternate << "," << reference_block << "\t50\tPASS\tDP=12";
+          } else if (input.errors) {
+              // an error in QUAL and a warning in INFO in every record
+              vcf << alternate << "\tq" << r % 10 << "\tPASS\tDP=x";
+          } else {
+              vcf << alternate << "\t50\tPASS\tDP=12";
+          }
+          if (input.samples != 0) {
+              vcf << "\tGT:DP";
+              std::string sample = block ? "\t0/0:20" : "\t0/1:12";
+              for (size_t s = 0; s < input.samples; ++s) {
+                  vcf << sample;
+              }
+          }
+          vcf << "\n";
+          position += block ? 10 : 1;
+      }
+      return vcf.str();
+  }
+
+  void run(std::string const & level_name, ebi::vcf::ValidationLevel level, std::string const & version,
+           Input const & input, std::string const & text)
+  {
+      std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> outputs;
+      auto counter = new CountingReportWriter;
+      outputs.emplace_back(counter);
+      std::istringstream stream{text};
+
+      // the parser logs its progress to the standard output, which is only for the results here
+      std::streambuf * results = std::cout.rdbuf(nullptr);
+
+      size_t allocations_before = allocations;
+      auto start = std::chrono::steady_clock::now();
+      bool is_valid;
+      try {
+          is_valid = ebi::vcf::is_valid_vcf_file(stream, "benchmark.vcf", level, outputs);
+      } catch (ebi::vcf::Error * error) {
+          // the stop level ends at the first error
+          ++counter->errors;
+          delete error;
+          is_valid = false;
+      }
+      auto end = std::chrono::steady_clock::now();
+      size_t run_allocations = allocations - allocations_before;
+
+      std::cout.rdbuf(results);
+      std::cout.clear();
+
+      double seconds = std::chrono::duration<double>(end - start).count();
+      std::cout << RAGEL_CODEGEN << "\t" << version << "\t" << level_name << "\t" << input.name << "\t" << text.size() << "\t"
+                << input.records << "\t" << seconds << "\t" << text.size() / seconds / 1e6 << "\t"
+                << input.records / seconds << "\t" << double(run_allocations) / input.records << "\t"
+                << is_valid << "\t" << counter->errors << "\t" << counter->warnings << std::endl;
+  }
+}
+
+int main(int argc, char** argv)
+{
+    size_t scale = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1;
+
+    std::vector<Input> inputs{
+            {"sites-only", 200000 * scale, 0, false, false},
+            {"1k-samples", 2000 * scale, 1000, false, false},
+            {"100k-samples", 20 * scale, 100000, false, false},
+            {"gvcf", 100000 * scale, 1, true, false},
+            {"error-dense", 100000 * scale, 0, false, true},
+    };
+    std::vector<std::pair<std::string, ebi::vcf::ValidationLevel>> levels{
+            {ebi::vcf::ERROR, ebi::vcf::ValidationLevel::error},
+            {ebi::vcf::WARNING, ebi::vcf::ValidationLevel::warning},
+            {ebi::vcf::STOP, ebi::vcf::ValidationLevel::stop},
+    };
+
+    std::cout << "ragel\tversion\tlevel\tinput\tbytes\trecords\tseconds\tMB/s\trecords/s\tallocations/record\tvalid"
+              << "\terrors\twarnings" << std::endl;
+    for (std::string version : {"4.1", "4.2", "4.3"}) {
+        for (auto & input : inputs) {
+            std::string text = generate(input, version);
+            for (auto & level : levels) {
+                run(level.first, level.second, version, input, text);
+            }
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,472 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Writes synthetic VCF files of any size, to load test the validator with inputs that can be shared. The INFO and
+ * FORMAT fields are taken from the predefined tags of the chosen version, and errors of several classes can be
+ * injected at a given rate per record.
+ * Usage: vcf_generator [OPTIONS] > output.vcf
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+#include "util/string_utils.hpp"
+#include "vcf/file_structure.hpp"
+#include "vcf/string_constants.hpp"
+
+namespace
+{
+  namespace po = boost::program_options;
+
+  const char VCF_VERSION[] = "vcf-version";
+  const char RECORDS[] = "records";
+  const char SIZE[] = "size";
+  const char SAMPLES_OPTION[] = "samples";
+  const char INFO_FIELDS[] = "info-fields";
+  const char FORMAT_FIELDS[] = "format-fields";
+  const char MAX_ALTERNATES[] = "max-alternates";
+  const char PLOIDY[] = "ploidy";
+  const char CONTIGS[] = "contigs";
+  const char GVCF_RATIO[] = "gvcf-ratio";
+  const char ERROR_RATE[] = "error-rate";
+  const char SEED[] = "seed";
+
+  /**
+   * Kinds of errors that can be injected in the records
+   */
+  enum class ErrorClass { position, reference, quality, info_type, cardinality, genotype, unsorted, duplicate };
+
+  const std::map<std::string, ErrorClass> error_classes = {
+          { "position", ErrorClass::position },       // POS is not a number
+          { "reference", ErrorClass::reference },     // REF is not made of bases
+          { "quality", ErrorClass::quality },         // QUAL is not a number
+          { "info-type", ErrorClass::info_type },     // INFO DP is not an integer
+          { "cardinality", ErrorClass::cardinality }, // INFO AC has one value more than alternate alleles
+          { "genotype", ErrorClass::genotype },       // GT of the first sample refers to a missing allele
+          { "unsorted", ErrorClass::unsorted },       // POS goes backwards
+          { "duplicate", ErrorClass::duplicate },     // the record is written twice
+  };
+
+  struct Tag
+  {
+      std::string id;
+      std::string type;
+      std::string number;
+  };
+
+  struct Parameters
+  {
+      std::string version;
+      size_t records;
+      uint64_t size;
+      size_t samples;
+      size_t info_fields;
+      size_t format_fields;
+      size_t max_alternates;
+      size_t ploidy;
+      size_t contigs;
+      double gvcf_ratio;
+      std::map<ErrorClass, double> error_rates;
+  };
+
+  po::options_description build_command_line_options()
+  {
+      po::options_description description("Usage: vcf_generator [OPTIONS] > output.vcf\nAllowed options");
+
+      description.add_options()
+          (ebi::vcf::HELP_OPTION, "Display this help")
+          (ebi::vcf::OUTPUT_OPTION, po::value<std::string>()->default_value(ebi::vcf::STDOUT), "Write to a file or stdout")
+          (VCF_VERSION, po::value<std::string>()->default_value("4.3"), "VCF version (4.1, 4.2, 4.3)")
+          (RECORDS, po::value<size_t>()->default_value(1000), "Number of records, if no size is given")
+          (SIZE, po::value<std::string>(), "Approximate size of the output, with an optional K, M, G or T suffix")
+          (SAMPLES_OPTION, po::value<size_t>()->default_value(1), "Number of samples")
+          (INFO_FIELDS, po::value<size_t>()->default_value(4), "Number of INFO fields in each record")
+          (FORMAT_FIELDS, po::value<size_t>()->default_value(3), "Number of FORMAT fields in each record, GT included")
+          (MAX_ALTERNATES, po::value<size_t>()->default_value(1), "Maximum number of alternate alleles of a record")
+          (PLOIDY, po::value<size_t>()->default_value(2), "Number of alleles in each genotype")
+          (CONTIGS, po::value<size_t>()->default_value(1), "Number of contigs the records are spread across")
+          (GVCF_RATIO, po::value<double>()->default_value(0), "Fraction of the records that are gVCF reference blocks")
+          (ERROR_RATE, po::value<std::vector<std::string>>()->multitoken(), "Errors to inject, as class=rate with the "
+                  "rate per record. Classes: position, reference, quality, info-type, cardinality, genotype, "
+                  "unsorted, duplicate")
+          (SEED, po::value<uint64_t>()->default_value(42), "Seed of the random generator")
+      ;
+
+      return description;
+  }
+
+  uint64_t parse_size(std::string const & size)
+  {
+      size_t digits;
+      uint64_t value = std::stoull(size, &digits);
+      std::string suffix = size.substr(digits);
+      if (suffix.empty()) {
+          return value;
+      }
+      std::string const units = "KMGT";
+      size_t exponent = units.find(static_cast<char>(toupper(suffix[0])));
+      if (suffix.size() > 2 || exponent == std::string::npos) {
+          throw std::invalid_argument{"Please use one of the K, M, G or T suffixes for the size"};
+      }
+      return value << (10 * (exponent + 1));
+  }
+
+  std::map<ErrorClass, double> parse_error_rates(std::vector<std::string> const & rates)
+  {
+      std::map<ErrorClass, double> error_rates;
+      for (auto & rate : rates) {
+          std::vector<std::string> parts;
+          ebi::util::string_split(rate, "=", parts);
+          auto error_class = parts.size() == 2 ? error_classes.find(parts[0]) : error_classes.end();
+          if (error_class == error_classes.end()) {
+              throw std::invalid_argument{"Please describe the errors as class=rate, with a known class: " + rate};
+          }
+          error_rates[error_class->second] = std::stod(parts[1]);
+      }
+      return error_rates;
+  }
+
+  /**
+   * The first `count` predefined tags with a numeric or flag type, skipping the ones whose values depend on other
+   * columns and would make the records invalid
+   */
+  std::vector<Tag> select_tags(ebi::vcf::PredefinedTagTable const & predefined_tags,
+                               std::vector<std::string> const & excluded, size_t count)
+  {
+      std::vector<Tag> tags;
+      for (auto it = predefined_tags.begin(); it != predefined_tags.end() && tags.size() < count; ++it) {
+          std::string id{it->id, it->id_size};
+          auto & type = ebi::vcf::type_name(it->type);
+          if ((type == ebi::vcf::INTEGER || type == ebi::vcf::FLOAT || type == ebi::vcf::FLAG)
+                  && std::find(excluded.begin(), excluded.end(), id) == excluded.end()) {
+              tags.push_back({id, type, it->number});
+          }
+      }
+      return tags;
+  }
+
+  class Generator
+  {
+    public:
+      Generator(Parameters const & parameters, uint64_t seed, std::ostream & output)
+          : parameters(parameters), random{seed}, output(output), written{0}, position{0}, contig{0}
+      {
+          bool v43 = parameters.version == "4.3";
+          reference_block = v43 ? ebi::vcf::GVCF_NON_VARIANT_ALLELE : "<NON_REF>";
+
+          // END and the fields counted by alleles are written separately, as they have to match the record
+          info_tags = select_tags(v43 ? ebi::vcf::info_v43 : ebi::vcf::info_v41_v42,
+                                  {ebi::vcf::AC, ebi::vcf::DP, ebi::vcf::END, ebi::vcf::SVLEN, ebi::vcf::CICN,
+                                   ebi::vcf::CICNADJ, ebi::vcf::CIEND, ebi::vcf::CILEN, ebi::vcf::CIPOS,
+                                   ebi::vcf::IMPRECISE},
+                                  parameters.info_fields);
+          format_tags = select_tags(v43 ? ebi::vcf::format_v43 : ebi::vcf::format_v41_v42, {ebi::vcf::GT},
+                                    parameters.format_fields > 0 ? parameters.format_fields - 1 : 0);
+      }
+
+      void write_header()
+      {
+          std::string line = "##fileformat=VCFv" + parameters.version + "\n";
+          line += "##INFO=<ID=AC,Number=A,Type=Integer,Description=\"Allele count\">\n";
+          line += "##INFO=<ID=DP,Number=1,Type=Integer,Description=\"Combined depth\">\n";
+          line += "##INFO=<ID=END,Number=1,Type=Integer,Description=\"End position of the reference block\">\n";
+          for (auto & tag : info_tags) {
+              line += "##INFO=<ID=" + tag.id + ",Number=" + tag.number + ",Type=" + tag.type
+                      + ",Description=\"Synthetic " + tag.id + "\">\n";
+          }
+          line += "##FORMAT=<ID=GT,Number=1,Type=String,Description=\"Genotype\">\n";
+          for (auto & tag : format_tags) {
+              line += "##FORMAT=<ID=" + tag.id + ",Number=" + tag.number + ",Type=" + tag.type
+                      + ",Description=\"Synthetic " + tag.id + "\">\n";
+          }
+          for (size_t c = 0; c < parameters.contigs; ++c) {
+              line += "##contig=<ID=" + std::to_string(c + 1) + ",length=4000000000>\n";
+          }
+          line += "##reference=file:///references/synthetic.fa\n";
+          line += "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO";
+          if (parameters.samples != 0) {
+              line += "\tFORMAT";
+              for (size_t s = 0; s < parameters.samples; ++s) {
+                  line += "\tS" + std::to_string(s);
+              }
+          }
+          line += "\n";
+          write(line);
+      }
+
+      void write_body()
+      {
+          for (size_t r = 0; !finished(r); ++r) {
+              // the records are spread evenly across the contigs, by the fraction of the output written so far
+              double progress = parameters.size != 0 ? double(written) / parameters.size
+                                                     : double(r) / parameters.records;
+              size_t next_contig = std::min(parameters.contigs - 1, static_cast<size_t>(progress * parameters.contigs));
+              if (next_contig != contig) {
+                  contig = next_contig;
+                  position = 0;
+              }
+              position += 1 + random() % 100;
+
+              bool block = chance(parameters.gvcf_ratio);
+              size_t record_position = position;
+              if (injects(ErrorClass::unsorted) && position > 1) {
+                  record_position = position - 1 - random() % std::min<size_t>(position - 1, 1000);
+              }
+              write_record(r, record_position, block);
+              if (injects(ErrorClass::duplicate)) {
+                  write(line);
+              }
+          }
+      }
+
+    private:
+      Parameters const & parameters;
+      std::mt19937_64 random;
+      std::ostream & output;
+      uint64_t written;
+      size_t position;
+      size_t contig;
+      std::string reference_block;
+      std::vector<Tag> info_tags;
+      std::vector<Tag> format_tags;
+      std::string line;
+      std::string sample_fields;
+
+      bool finished(size_t records) const
+      {
+          return parameters.size != 0 ? written >= parameters.size : records >= parameters.records;
+      }
+
+      bool chance(double rate)
+      {
+          return rate > 0 && std::generate_canonical<double, 32>(random) < rate;
+      }
+
+      bool injects(ErrorClass error_class)
+      {
+          auto rate = parameters.error_rates.find(error_class);
+          return rate != parameters.error_rates.end() && chance(rate->second);
+      }
+
+      void write(std::string const & text)
+      {
+          output.write(text.data(), text.size());
+          written += text.size();
+      }
+
+      size_t cardinality(std::string const & number, size_t alternates) const
+      {
+          if (number == ebi::vcf::A) {
+              return alternates;
+          } else if (number == ebi::vcf::R) {
+              return alternates + 1;
+          } else if (number == ebi::vcf::G) {
+              // combinations with repetition of the ploidy among the alleles
+              size_t alleles = alternates + 1;
+              size_t combinations = 1;
+              for (size_t k = 1; k <= parameters.ploidy; ++k) {
+                  combinations = combinations * (alleles + k - 1) / k;
+              }
+              return combinations;
+          } else if (number == ebi::vcf::UNKNOWN_CARDINALITY) {
+              return 1;
+          }
+          return std::stoul(number);
+      }
+
+      void append_values(std::string & text, Tag const & tag, size_t alternates)
+      {
+          static const char * floats[] = {"0", "0.25", "0.5", "1"};
+          size_t count = cardinality(tag.number, alternates);
+          for (size_t i = 0; i < count; ++i) {
+              if (i != 0) {
+                  text += ',';
+              }
+              text += tag.type == ebi::vcf::FLOAT ? floats[random() % 4] : std::to_string(random() % 100);
+          }
+      }
+
+      void append_genotype(std::string & text, size_t alternates, bool block, bool missing_allele)
+      {
+          for (size_t p = 0; p < parameters.ploidy; ++p) {
+              if (p != 0) {
+                  text += '/';
+              }
+              if (p == 0 && missing_allele) {
+                  text += std::to_string(alternates + 1);
+              } else {
+                  text += block ? "0" : std::to_string(random() % (alternates + 1));
+              }
+          }
+      }
+
+      void write_record(size_t index, size_t record_position, bool block)
+      {
+          static const char bases[] = "ACGT";
+          char reference = bases[random() % 4];
+
+          // SNVs first, then insertions of increasing length, so the alleles never repeat
+          std::vector<std::string> alternates;
+          if (block) {
+              alternates.push_back(reference_block);
+          } else {
+              size_t count = 1 + random() % parameters.max_alternates;
+              for (size_t b = 0; b < 4 && alternates.size() < count; ++b) {
+                  if (bases[b] != reference) {
+                      alternates.emplace_back(1, bases[b]);
+                  }
+              }
+              while (alternates.size() < count) {
+                  alternates.push_back(std::string(1, reference) + std::string(alternates.size() - 2, 'A'));
+              }
+          }
+          size_t block_length = block ? 1 + random() % 1000 : 0;
+
+          line.clear();
+          line += std::to_string(contig + 1);
+          line += '\t';
+          line += injects(ErrorClass::position) ? "p" + std::to_string(record_position)
+                                                : std::to_string(record_position);
+          line += '\t';
+          line += block ? "." : "rs" + std::to_string(index);
+          line += '\t';
+          line += injects(ErrorClass::reference) ? 'Z' : reference;
+          line += '\t';
+          for (size_t a = 0; a < alternates.size(); ++a) {
+              if (a != 0) {
+                  line += ',';
+              }
+              line += alternates[a];
+          }
+          line += '\t';
+          line += block ? "." : injects(ErrorClass::quality) ? "q" + std::to_string(random() % 100)
+                                                              : std::to_string(random() % 100);
+          line += block ? "\t.\t" : "\tPASS\t";
+
+          if (block) {
+              line += "END=" + std::to_string(record_position + block_length - 1);
+              position += block_length - 1;
+          } else {
+              bool wrong_count = injects(ErrorClass::cardinality);
+              line += "AC=";
+              append_values(line, {ebi::vcf::AC, ebi::vcf::INTEGER, ebi::vcf::A}, alternates.size() + wrong_count);
+              line += injects(ErrorClass::info_type) ? ";DP=x" : ";DP=" + std::to_string(random() % 1000);
+              for (auto & tag : info_tags) {
+                  line += ';';
+                  line += tag.id;
+                  if (tag.type != ebi::vcf::FLAG) {
+                      line += '=';
+                      append_values(line, tag, alternates.size());
+                  }
+              }
+          }
+
+          if (parameters.samples != 0) {
+              line += "\tGT";
+              for (auto & tag : format_tags) {
+                  line += ':' + tag.id;
+              }
+
+              // only the genotypes change between samples, the rest of the values are shared
+              sample_fields.clear();
+              for (auto & tag : format_tags) {
+                  sample_fields += ':';
+                  append_values(sample_fields, tag, alternates.size());
+              }
+              bool wrong_genotype = injects(ErrorClass::genotype);
+              for (size_t s = 0; s < parameters.samples; ++s) {
+                  line += '\t';
+                  append_genotype(line, alternates.size(), block, s == 0 && wrong_genotype);
+                  line += sample_fields;
+              }
+          }
+          line += '\n';
+          write(line);
+      }
+  };
+}
+
+int main(int argc, char** argv)
+{
+    po::options_description desc = build_command_line_options();
+    po::variables_map vm;
+    Parameters parameters;
+    try {
+        po::store(po::parse_command_line(argc, argv, desc), vm);
+        po::notify(vm);
+
+        if (vm.count(ebi::vcf::HELP)) {
+            std::cout << desc << std::endl;
+            return 0;
+        }
+
+        parameters.version = vm[VCF_VERSION].as<std::string>();
+        if (parameters.version != "4.1" && parameters.version != "4.2" && parameters.version != "4.3") {
+            throw std::invalid_argument{"Please choose one of the versions 4.1, 4.2 or 4.3"};
+        }
+        parameters.records = vm[RECORDS].as<size_t>();
+        parameters.size = vm.count(SIZE) ? parse_size(vm[SIZE].as<std::string>()) : 0;
+        parameters.samples = vm[SAMPLES_OPTION].as<size_t>();
+        parameters.info_fields = vm[INFO_FIELDS].as<size_t>();
+        parameters.format_fields = vm[FORMAT_FIELDS].as<size_t>();
+        parameters.max_alternates = vm[MAX_ALTERNATES].as<size_t>();
+        parameters.ploidy = vm[PLOIDY].as<size_t>();
+        parameters.contigs = vm[CONTIGS].as<size_t>();
+        parameters.gvcf_ratio = vm[GVCF_RATIO].as<double>();
+        if (vm.count(ERROR_RATE)) {
+            parameters.error_rates = parse_error_rates(vm[ERROR_RATE].as<std::vector<std::string>>());
+        }
+        if (parameters.ploidy == 0 || parameters.contigs == 0 || parameters.max_alternates == 0) {
+            throw std::invalid_argument{"Please use at least one allele in the genotypes, one contig and one "
+                                        "alternate allele"};
+        }
+    } catch (std::exception const & ex) {
+        std::cout << desc << std::endl;
+        std::cerr << ex.what() << std::endl;
+        return 1;
+    }
+
+    std::ios_base::sync_with_stdio(false);
+    std::ofstream file;
+    std::vector<char> buffer(1 << 20);
+    auto output_path = vm[ebi::vcf::OUTPUT].as<std::string>();
+    std::ostream * output = &std::cout;
+    if (output_path != ebi::vcf::STDOUT) {
+        file.rdbuf()->pubsetbuf(buffer.data(), buffer.size());
+        file.open(output_path);
+        if (!file) {
+            std::cerr << "Couldn't open file " << output_path << std::endl;
+            return 1;
+        }
+        output = &file;
+    }
+
+    Generator generator{parameters, vm[SEED].as<uint64_t>(), *output};
+    generator.write_header();
+    generator.write_body();
+    output->flush();
+    return output->good() ? 0 : 1;
+}
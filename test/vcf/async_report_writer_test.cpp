@@ -0,0 +1,118 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "catch/catch.hpp"
+
+#include "vcf/async_report_writer.hpp"
+#include "vcf/report_writer.hpp"
+#include "test_utils.hpp"
+
+namespace ebi
+{
+  /**
+   * Collects what it's asked to write, optionally waiting until it's released
+   */
+  class RecordingReportWriter : public CollectingReportWriter
+  {
+    public:
+      virtual void write_error(vcf::Error &error) override
+      {
+          wait();
+          CollectingReportWriter::write_error(error);
+      }
+
+      virtual void write_warning(vcf::Error &error) override
+      {
+          wait();
+          CollectingReportWriter::write_warning(error);
+      }
+
+      virtual void write_message(const std::string &report_result) override
+      {
+          if (report_result == "fail") {
+              throw std::runtime_error{"can't write"};
+          }
+          reports_before_messages.push_back(reports.size());
+          CollectingReportWriter::write_message(report_result);
+      }
+
+      virtual std::string get_filename() override { return "recording"; }
+
+      void wait()
+      {
+          while (blocked) {
+              std::this_thread::yield();
+          }
+      }
+
+      std::vector<size_t> reports_before_messages;
+      std::atomic<bool> blocked{false};
+  };
+
+  TEST_CASE("Unit test: asynchronous report writer", "[output]")
+  {
+      auto recorder = new RecordingReportWriter;
+      vcf::AsyncReportWriter writer{std::unique_ptr<vcf::ReportWriter>{recorder}, 2};
+
+      SECTION("Everything is written in order, from copies of the errors")
+      {
+          CHECK(writer.get_filename() == "recording");
+          {
+              vcf::PositionBodyError position_error{1};
+              vcf::QualityBodyError quality_error{2};
+              writer.write_error(position_error);
+              writer.write_batch({{vcf::Severity::ERROR, &quality_error}, {vcf::Severity::WARNING, &quality_error}});
+          }
+          writer.write_message("result");
+          writer.close();
+
+          auto lines = recorder->descriptions();
+          REQUIRE(lines.size() == 3);
+          CHECK(lines[0] == vcf::PositionBodyError{1}.what());
+          CHECK(lines[1] == vcf::QualityBodyError{2}.what());
+          CHECK(lines[2] == std::string{vcf::QualityBodyError{2}.what()} + " (warning)");
+          CHECK(recorder->messages == std::vector<std::string>{"result"});
+          CHECK(recorder->reports_before_messages == std::vector<size_t>{3});
+      }
+
+      SECTION("A batch bigger than the queue is accepted when the queue is empty")
+      {
+          vcf::PositionBodyError position_error{1};
+          std::vector<vcf::ReportedError> batch(5, vcf::ReportedError{vcf::Severity::ERROR, &position_error});
+          recorder->blocked = true;
+          writer.write_batch(batch);
+          recorder->blocked = false;
+          writer.write_batch(batch);
+          writer.close();
+          CHECK(recorder->reports.size() == 10);
+      }
+
+      SECTION("The exceptions of the output are rethrown")
+      {
+          writer.write_message("fail");
+          CHECK_THROWS_AS(writer.close(), std::runtime_error);
+          CHECK_NOTHROW(writer.close());
+      }
+  }
+}
@@ -0,0 +1,214 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "catch/catch.hpp"
+
+#include "vcf/bcf_parser.hpp"
+#include "vcf/validator.hpp"
+#include "test_utils.hpp"
+
+namespace ebi
+{
+  namespace
+  {
+    struct Reports
+    {
+        std::vector<std::string> errors;
+        std::vector<std::string> warnings;
+    };
+
+    bool validate(std::string const & input, size_t block_size, Reports & reports)
+    {
+        std::istringstream stream{input};
+        util::StreamBlockReader reader{stream, block_size};
+        std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+        auto writer = new CollectingReportWriter;
+        outputs.emplace_back(writer);
+        bool is_valid = vcf::is_valid_vcf_file(reader, "input", vcf::ValidationLevel::warning, outputs);
+        reports.errors = writer->errors(true);
+        reports.warnings = writer->warnings(true);
+        return is_valid;
+    }
+
+    /*
+     * Encoding of the fields of a BCF record, little-endian
+     */
+
+    std::string uint32(uint32_t value)
+    {
+        std::string bytes;
+        for (int i = 0; i < 4; ++i) {
+            bytes += static_cast<char>((value >> (8 * i)) & 0xFF);
+        }
+        return bytes;
+    }
+
+    std::string float_bits(float value)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof bits);
+        return uint32(bits);
+    }
+
+    std::string typed_string(std::string const & text)
+    {
+        return std::string(1, static_cast<char>(text.size() << 4 | 7)) + text;
+    }
+
+    std::string typed_ints(std::vector<int> const & values)
+    {
+        std::string bytes(1, static_cast<char>(values.size() << 4 | 1));
+        for (int value : values) {
+            bytes += static_cast<char>(value);
+        }
+        return bytes;
+    }
+
+    std::string record(std::string const & shared, std::string const & individual)
+    {
+        return uint32(shared.size()) + uint32(individual.size()) + shared + individual;
+    }
+
+    std::string const header =
+            "##fileformat=VCFv4.2\n"
+            "##contig=<ID=1,length=1000>\n"
+            "##FILTER=<ID=q10,Description=\"Quality below 10\">\n"
+            "##INFO=<ID=DP,Number=1,Type=Integer,Description=\"Depth, in reads\">\n"
+            "##INFO=<ID=DB,Number=0,Type=Flag,Description=\"In dbSNP\">\n"
+            "##FORMAT=<ID=GT,Number=1,Type=String,Description=\"Genotype\">\n"
+            "##FORMAT=<ID=GQ,Number=1,Type=Integer,Description=\"Genotype quality\">\n"
+            "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\tFORMAT\tS1\tS2\n";
+
+    // the keys are the indexes of the IDs in the header, after PASS
+    int const q10 = 1, DP = 2, DB = 3, GT = 4, GQ = 5;
+
+    std::string const body =
+            "1\t100\trs1\tA\tG\t30\tPASS\tDP=5;DB\tGT:GQ\t0|1:20\t1/1:.\n"
+            "1\t200\t.\tC\tT,G\t.\tq10\tDP=7\tGT:GQ\t0/0:30\t./.:10\n"
+            "1\t100\trs2\tA\tG\t30\tPASS\tDP=5\tGT\t0/1\t0/1\n";
+
+    std::string bcf(std::string const & records)
+    {
+        return std::string{"BCF\2\2"} + uint32(header.size() + 1) + header + '\0' + records;
+    }
+
+    /**
+     * The records of the body, encoded
+     */
+    std::vector<std::string> records()
+    {
+        return {
+            record(uint32(0) + uint32(99) + uint32(1) + float_bits(30) + uint32(2 << 16 | 2) + uint32(2 << 24 | 2)
+                   + typed_string("rs1") + typed_string("A") + typed_string("G") + typed_ints({0})
+                   + typed_ints({DP}) + typed_ints({5}) + typed_ints({DB}) + std::string(1, '\0'),
+                   typed_ints({GT}) + std::string(1, 0x21) + "\2\5" + "\4\4"
+                   + typed_ints({GQ}) + std::string(1, 0x11) + "\24" + "\x80"),
+            record(uint32(0) + uint32(199) + uint32(1) + uint32(0x7F800001) + uint32(3 << 16 | 1)
+                   + uint32(2 << 24 | 2)
+                   + typed_string("") + typed_string("C") + typed_string("T") + typed_string("G")
+                   + typed_ints({q10}) + typed_ints({DP}) + typed_ints({7}),
+                   typed_ints({GT}) + std::string(1, 0x21) + "\2\2" + std::string(2, '\0')
+                   + typed_ints({GQ}) + std::string(1, 0x11) + "\36" + "\12"),
+            record(uint32(0) + uint32(99) + uint32(1) + float_bits(30) + uint32(2 << 16 | 1) + uint32(1 << 24 | 2)
+                   + typed_string("rs2") + typed_string("A") + typed_string("G") + typed_ints({0})
+                   + typed_ints({DP}) + typed_ints({5}),
+                   typed_ints({GT}) + std::string(1, 0x21) + "\2\4" + "\2\4"),
+        };
+    }
+  }
+
+  TEST_CASE("BCF input detected by its magic string", "[bcf]")
+  {
+      std::string input = bcf("");
+      CHECK(vcf::is_bcf(input.data(), input.data() + input.size()));
+      CHECK_FALSE(vcf::is_bcf(header.data(), header.data() + header.size()));
+      CHECK_FALSE(vcf::is_bcf(input.data(), input.data() + 3));
+  }
+
+  TEST_CASE("BCF records checked like their VCF lines", "[bcf]")
+  {
+      std::vector<std::string> encoded = records();
+      std::string input = bcf(encoded[0] + encoded[1] + encoded[2]);
+
+      Reports text_reports;
+      CHECK_FALSE(validate(header + body, util::default_block_size, text_reports));
+      REQUIRE_FALSE(text_reports.errors.empty());
+
+      SECTION("In a single block")
+      {
+          Reports reports;
+          CHECK_FALSE(validate(input, util::default_block_size, reports));
+          CHECK(reports.errors == text_reports.errors);
+          CHECK(reports.warnings == text_reports.warnings);
+      }
+
+      SECTION("Split in blocks smaller than the fields")
+      {
+          Reports reports;
+          CHECK_FALSE(validate(input, 3, reports));
+          CHECK(reports.errors == text_reports.errors);
+          CHECK(reports.warnings == text_reports.warnings);
+      }
+
+      SECTION("Without the duplicated variant")
+      {
+          Reports reports;
+          Reports valid_text_reports;
+          bool text_valid = validate(header + body.substr(0, body.rfind("1\t100")), util::default_block_size,
+                                     valid_text_reports);
+          CHECK(validate(bcf(encoded[0] + encoded[1]), util::default_block_size, reports) == text_valid);
+          CHECK(reports.errors == valid_text_reports.errors);
+          CHECK(reports.warnings == valid_text_reports.warnings);
+      }
+  }
+
+  TEST_CASE("BCF input whose binary structure is not valid", "[bcf]")
+  {
+      std::vector<std::string> encoded = records();
+      Reports reports;
+
+      SECTION("A contig not in the header")
+      {
+          std::string unknown_contig = encoded[0];
+          unknown_contig[8] = 5;
+          CHECK_FALSE(validate(bcf(unknown_contig + encoded[1]), util::default_block_size, reports));
+          REQUIRE(reports.errors.size() == 1);
+          CHECK(reports.errors[0] == "9: Line 9: The BCF record is not valid: The contig 5 is not in the header.");
+      }
+
+      SECTION("A record cut short")
+      {
+          std::string input = bcf(encoded[0] + encoded[1]);
+          CHECK_FALSE(validate(input.substr(0, input.size() - 3), util::default_block_size, reports));
+          REQUIRE_FALSE(reports.errors.empty());
+          CHECK(reports.errors.back() == "10: Line 10: The BCF input ends in the middle of a record.");
+      }
+
+      SECTION("A header cut short")
+      {
+          CHECK_FALSE(validate(bcf("").substr(0, 30), util::default_block_size, reports));
+          REQUIRE(reports.errors.size() == 1);
+          CHECK(reports.errors[0] == "1: Line 1: The BCF input ends before its header does.");
+      }
+  }
+}
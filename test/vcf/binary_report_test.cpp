@@ -0,0 +1,141 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include "catch/catch.hpp"
+
+#include "vcf/binary_report.hpp"
+#include "vcf/validator.hpp"
+
+namespace ebi
+{
+  TEST_CASE("Binary report", "[output]")
+  {
+      std::string report_name = "test/input_files/binary_report_test.errors.bin";
+
+      SECTION("Write and read errors of every kind")
+      {
+          {
+              vcf::BinaryReportWriter writer{report_name};
+              vcf::MetaSectionError meta_error{2, "meta error", vcf::ErrorFix::RECOVERABLE_VALUE, "value", "expected"};
+              vcf::InfoBodyError info_error{5, "info error", "details", vcf::ErrorFix::RECOVERABLE_VALUE, "AC", "1"};
+              vcf::SamplesFieldBodyError samples_error{7, "samples error", "more details", "GT", 2};
+              vcf::FilterBodyError filter_error{8, "filter error", vcf::ErrorFix::RECOVERABLE_VALUE, "q10"};
+              writer.write_error(meta_error);
+              writer.write_warning(info_error);
+              writer.write_error(samples_error);
+              writer.write_error(filter_error);
+          }
+
+          vcf::BinaryReportReader reader{report_name};
+          CHECK(reader.count_errors() == 3);
+          CHECK(reader.count_warnings() == 1);
+
+          std::vector<std::shared_ptr<vcf::Error>> errors;
+          reader.for_each_error([&](std::shared_ptr<vcf::Error> error) { errors.push_back(error); });
+          REQUIRE(errors.size() == 3);
+
+          auto meta_error = std::dynamic_pointer_cast<vcf::MetaSectionError>(errors[0]);
+          REQUIRE(meta_error);
+          CHECK(meta_error->line == 2);
+          CHECK(meta_error->message == "meta error");
+          CHECK(meta_error->error_fix == vcf::ErrorFix::RECOVERABLE_VALUE);
+          CHECK(meta_error->value == "value");
+          CHECK(meta_error->expected_value == "expected");
+          CHECK(meta_error->severity == vcf::Severity::ERROR);
+
+          auto samples_error = std::dynamic_pointer_cast<vcf::SamplesFieldBodyError>(errors[1]);
+          REQUIRE(samples_error);
+          CHECK(samples_error->detailed_message == "more details");
+          CHECK(samples_error->field == "GT");
+          CHECK(samples_error->field_cardinality == 2);
+
+          auto filter_error = std::dynamic_pointer_cast<vcf::FilterBodyError>(errors[2]);
+          REQUIRE(filter_error);
+          CHECK(filter_error->field == "q10");
+
+          std::vector<std::shared_ptr<vcf::Error>> warnings;
+          reader.for_each_warning([&](std::shared_ptr<vcf::Error> error) { warnings.push_back(error); });
+          REQUIRE(warnings.size() == 1);
+          auto info_error = std::dynamic_pointer_cast<vcf::InfoBodyError>(warnings[0]);
+          REQUIRE(info_error);
+          CHECK(info_error->line == 5);
+          CHECK(info_error->field == "AC");
+          CHECK(info_error->expected_value == "1");
+          CHECK(info_error->severity == vcf::Severity::WARNING);
+      }
+
+      SECTION("Errors written out of order are read sorted by line")
+      {
+          {
+              vcf::BinaryReportWriter writer{report_name};
+              vcf::DuplicationError second{9, "A duplicated variant was found", "It occurs in lines 3 and 9"};
+              vcf::DuplicationError first{3, "A duplicated variant was found"};
+              vcf::PositionBodyError position_error{12};
+              writer.write_error(second);
+              writer.write_error(first);
+              writer.write_error(position_error);
+          }
+
+          vcf::BinaryReportReader reader{report_name};
+          std::vector<size_t> lines;
+          reader.for_each_error([&](std::shared_ptr<vcf::Error> error) { lines.push_back(error->line); });
+          CHECK(lines == (std::vector<size_t>{3, 9, 12}));
+      }
+
+      SECTION("Report of the validator")
+      {
+          std::string path = "test/input_files/v4.1/failed/failed_body_duplicated_000.vcf";
+          {
+              std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+              outputs.emplace_back(new vcf::BinaryReportWriter{report_name});
+              std::ifstream input{path};
+              CHECK_FALSE(vcf::is_valid_vcf_file(input, path, vcf::ValidationLevel::warning, outputs));
+          }
+
+          CHECK(vcf::binary_report::is_binary_report(report_name));
+          vcf::BinaryReportReader reader{report_name};
+          CHECK(reader.count_errors() > 0);
+
+          size_t errors_read = 0;
+          size_t previous_line = 0;
+          reader.for_each_error([&](std::shared_ptr<vcf::Error> error) {
+              CHECK(previous_line <= error->line);
+              CHECK(dynamic_cast<vcf::DuplicationError *>(error.get()) != nullptr);
+              previous_line = error->line;
+              ++errors_read;
+          });
+          CHECK(errors_read == reader.count_errors());
+      }
+
+      SECTION("Other files are rejected")
+      {
+          CHECK_FALSE(vcf::binary_report::is_binary_report("test/input_files/v4.1/failed/failed_body_duplicated_000.vcf"));
+          CHECK_THROWS_AS(vcf::BinaryReportReader{"test/input_files/v4.1/failed/failed_body_duplicated_000.vcf"},
+                          std::runtime_error);
+      }
+
+      boost::filesystem::remove(report_name);
+  }
+}
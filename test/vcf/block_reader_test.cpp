@@ -0,0 +1,447 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <fstream>
+#include <mutex>
+#include <set>
+#include <sstream>
+
+#include <boost/filesystem.hpp>
+
+#include "catch/catch.hpp"
+
+#include "util/block_reader.hpp"
+#include "util/range_request_block_reader.hpp"
+#include "util/read_ahead_block_reader.hpp"
+#include "util/stream_utils.hpp"
+#include "vcf/validator.hpp"
+#include "test_utils.hpp"
+
+namespace ebi
+{
+  class FailingBlockReader : public util::BlockReader
+  {
+    protected:
+      bool next_block(util::Block & block) override { throw std::runtime_error{"read failed"}; }
+  };
+
+  /**
+   * Input in memory, whose reads from some offsets fail: the first time, or always
+   */
+  class MemoryRangeSource : public util::RangeSource
+  {
+    public:
+      MemoryRangeSource(std::string contents, std::set<uint64_t> failing_once, std::set<uint64_t> failing)
+      : contents(std::move(contents)), failing_once(std::move(failing_once)), failing(std::move(failing))
+      {
+      }
+
+      uint64_t size() override { return contents.size(); }
+
+      void read(uint64_t offset, size_t size, std::vector<char> & data) override
+      {
+          {
+              std::lock_guard<std::mutex> lock{mutex};
+              if (failing.count(offset) != 0 || failing_once.erase(offset) != 0) {
+                  throw std::runtime_error{"request failed"};
+              }
+          }
+          data.assign(contents.begin() + offset, contents.begin() + offset + size);
+      }
+
+    private:
+      std::string contents;
+      std::set<uint64_t> failing_once;
+      std::set<uint64_t> failing;
+      std::mutex mutex;
+  };
+
+  std::vector<std::string> validate_blocks(util::BlockReader &reader, std::string const &path, size_t threads = 1)
+  {
+      std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+      auto report = new CollectingReportWriter{};
+      outputs.emplace_back(report);
+      vcf::is_valid_vcf_file(reader, path, vcf::ValidationLevel::warning, outputs, threads);
+      return report->descriptions();
+  }
+
+  std::vector<std::string> validate_mapped(std::string const &path, size_t threads)
+  {
+      std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+      auto report = new CollectingReportWriter{};
+      outputs.emplace_back(report);
+      util::MappedFileBlockReader reader{path};
+      vcf::is_valid_vcf_file(reader, path, vcf::ValidationLevel::warning, outputs, threads);
+      return report->descriptions();
+  }
+
+  std::vector<std::string> validate_lines(std::string const &path)
+  {
+      std::ifstream input{path};
+      auto source = std::make_shared<vcf::Source>(path, vcf::InputFormat::VCF_FILE_VCF, vcf::Version::v43);
+      vcf::FullValidator_v43 validator{source};
+      std::vector<std::string> reports;
+      std::vector<char> line;
+
+      auto collect = [&]() {
+          for (auto &error : validator.errors()) {
+              reports.push_back(error->what());
+          }
+          for (auto &warning : validator.warnings()) {
+              reports.push_back(warning->what() + std::string{" (warning)"});
+          }
+      };
+
+      while (util::readline(input, line).size() != 0) {
+          validator.parse(line);
+          collect();
+      }
+      validator.end();
+      collect();
+
+      return reports;
+  }
+
+  TEST_CASE("Block readers", "[block_reader]")
+  {
+      std::string text{"##fileformat=VCFv4.3\n#CHROM\n\n1\t100\n1\t200"};
+
+      SECTION("Lines spanning several blocks")
+      {
+          for (size_t block_size : {1, 3, 7, 1024}) {
+              std::stringstream block_stream{text};
+              std::stringstream line_stream{text};
+              util::StreamBlockReader reader{block_stream, block_size};
+              std::vector<char> block_line, line;
+
+              do {
+                  util::readline(line_stream, line);
+                  reader.readline(block_line);
+                  CHECK(block_line == line);
+              } while (line.size() != 0);
+          }
+      }
+
+      SECTION("Lines and blocks mixed")
+      {
+          std::stringstream stream{text};
+          util::StreamBlockReader reader{stream, 8};
+          std::vector<char> line;
+          util::Block block;
+
+          reader.readline(line);
+          std::string rest{line.begin(), line.end()};
+          while (reader.read(block)) {
+              rest.append(block.data, block.size);
+          }
+          CHECK(rest == text);
+      }
+
+      SECTION("Memory mapped file")
+      {
+          std::string path{"test/input_files/v4.3/passed/passed_body_alt.vcf"};
+          std::ifstream input{path};
+          std::string expected{std::istreambuf_iterator<char>{input}, std::istreambuf_iterator<char>{}};
+
+          util::MappedFileBlockReader reader{path, 100};
+          std::string contents;
+          util::Block block;
+          while (reader.read(block)) {
+              CHECK(block.size <= 100);
+              contents.append(block.data, block.size);
+          }
+          CHECK(contents == expected);
+      }
+
+      SECTION("Copying lines")
+      {
+          for (size_t block_size : {1, 3, 7, 1024}) {
+              std::stringstream stream{text};
+              util::StreamBlockReader reader{stream, block_size};
+              std::stringstream copy;
+              std::vector<char> line;
+
+              CHECK(reader.copy_lines(2, copy) == 2);
+              CHECK(copy.str() == "##fileformat=VCFv4.3\n#CHROM\n");
+              reader.readline(line);
+              CHECK(line == std::vector<char>{'\n'});
+              reader.copy_rest(copy);
+              CHECK(copy.str() == "##fileformat=VCFv4.3\n#CHROM\n1\t100\n1\t200");
+          }
+
+          std::stringstream stream{text};
+          util::StreamBlockReader reader{stream, 4};
+          std::stringstream copy;
+          CHECK(reader.copy_lines(10, copy) == 4);
+          CHECK(copy.str() == text);
+      }
+  }
+
+  TEST_CASE("Reading ahead in another thread", "[block_reader]")
+  {
+      std::string path{"test/input_files/v4.3/passed/passed_body_alt.vcf"};
+      std::ifstream input{path};
+      std::string expected{std::istreambuf_iterator<char>{input}, std::istreambuf_iterator<char>{}};
+      util::Block block;
+
+      SECTION("Blocks are provided in order")
+      {
+          for (size_t buffers : {2, 4, 16}) {
+              util::MappedFileBlockReader source{path, 7};
+              util::ReadAheadBlockReader reader{source, buffers};
+              std::string contents;
+              while (reader.read(block)) {
+                  contents.append(block.data, block.size);
+              }
+              CHECK(contents == expected);
+          }
+      }
+
+      SECTION("Stopping before the end of the input")
+      {
+          util::MappedFileBlockReader source{path, 7};
+          util::ReadAheadBlockReader reader{source, 2};
+          std::vector<char> line;
+          reader.readline(line);
+          CHECK(std::string(line.begin(), line.end()) == "##fileformat=VCFv4.3\n");
+      }
+
+      SECTION("Errors are forwarded to the reading thread")
+      {
+          FailingBlockReader source;
+          util::ReadAheadBlockReader reader{source};
+          CHECK_THROWS_AS(reader.read(block), std::runtime_error);
+      }
+
+      SECTION("Mapped files are not copied")
+      {
+          util::MappedFileBlockReader source{path, 7};
+          util::Block mapped = source.contents();
+          REQUIRE(source.is_in_memory());
+
+          util::ReadAheadBlockReader reader{source, 2};
+          std::string contents;
+          while (reader.read(block)) {
+              CHECK(block.data == mapped.data + contents.size());
+              contents.append(block.data, block.size);
+          }
+          CHECK(contents == expected);
+      }
+  }
+
+  TEST_CASE("Reading with several range requests", "[block_reader]")
+  {
+      std::string path{"test/input_files/v4.3/passed/passed_body_alt.vcf"};
+      std::ifstream input{path};
+      std::string expected{std::istreambuf_iterator<char>{input}, std::istreambuf_iterator<char>{}};
+      util::Block block;
+
+      SECTION("Blocks are provided in order")
+      {
+          for (size_t connections : {1, 3, 8}) {
+              for (size_t block_size : {7, 100, 1 << 20}) {
+                  MemoryRangeSource source{expected, {}, {}};
+                  util::RangeRequestBlockReader reader{source, connections, block_size};
+                  std::string contents;
+                  while (reader.read(block)) {
+                      CHECK(block.size <= block_size);
+                      contents.append(block.data, block.size);
+                  }
+                  CHECK(contents == expected);
+              }
+          }
+      }
+
+      SECTION("Stopping before the end of the input")
+      {
+          MemoryRangeSource source{expected, {}, {}};
+          util::RangeRequestBlockReader reader{source, 4, 7};
+          std::vector<char> line;
+          reader.readline(line);
+          CHECK(std::string(line.begin(), line.end()) == "##fileformat=VCFv4.3\n");
+      }
+
+      SECTION("Failed requests are retried")
+      {
+          MemoryRangeSource source{expected, {0, 200, 300}, {}};
+          util::RangeRequestBlockReader reader{source, 3, 100, 2};
+          std::string contents;
+          while (reader.read(block)) {
+              contents.append(block.data, block.size);
+          }
+          CHECK(contents == expected);
+      }
+
+      SECTION("Errors are thrown once the blocks before them are read")
+      {
+          MemoryRangeSource source{expected, {}, {300}};
+          util::RangeRequestBlockReader reader{source, 3, 100, 2};
+          std::string contents;
+          auto read_all = [&] {
+              while (reader.read(block)) {
+                  contents.append(block.data, block.size);
+              }
+          };
+          CHECK_THROWS_AS(read_all(), std::runtime_error);
+          CHECK(contents == expected.substr(0, 300));
+      }
+
+      SECTION("Compressed input")
+      {
+          std::string compressed_path{"test/input_files/v4.3/regions/regions.vcf.gz"};
+          std::ifstream compressed_input{compressed_path};
+          std::string compressed{std::istreambuf_iterator<char>{compressed_input}, std::istreambuf_iterator<char>{}};
+
+          for (size_t threads : {1, 2}) {
+              MemoryRangeSource source{compressed, {}, {}};
+              util::RangeRequestBlockReader reader{source, 4, 1000};
+              util::MappedFileBlockReader mapped{compressed_path};
+              CHECK(validate_blocks(reader, compressed_path, threads) == validate_blocks(mapped, compressed_path));
+          }
+      }
+  }
+
+  TEST_CASE("Validation in blocks reports like validation by lines", "[block_reader]")
+  {
+      auto folder = boost::filesystem::path("test/input_files/v4.3/failed");
+      std::vector<boost::filesystem::path> v;
+      copy(boost::filesystem::directory_iterator(folder), boost::filesystem::directory_iterator(), back_inserter(v));
+
+      for (auto path : v) {
+          if (path.filename().string().find("failed_fileformat") == 0) {
+              continue;   // validation doesn't start without a fileformat
+          }
+          SECTION(path.string())
+          {
+              std::vector<std::string> by_lines = validate_lines(path.string());
+
+              util::MappedFileBlockReader mapped_reader{path.string()};
+              CHECK(validate_blocks(mapped_reader, path.string()) == by_lines);
+
+              std::ifstream input{path.string()};
+              util::StreamBlockReader small_reader{input, 5};
+              std::vector<std::string> by_small_blocks = validate_blocks(small_reader, path.string());
+
+              // a line split between blocks may report its warnings before its errors
+              std::sort(by_lines.begin(), by_lines.end());
+              std::sort(by_small_blocks.begin(), by_small_blocks.end());
+              CHECK(by_small_blocks == by_lines);
+          }
+      }
+  }
+
+  TEST_CASE("Validation with several threads reports like validation with one", "[block_reader]")
+  {
+      for (auto folder : {"test/input_files/v4.1/failed", "test/input_files/v4.2/failed",
+                          "test/input_files/v4.3/failed", "test/input_files/v4.3/passed"}) {
+          std::vector<boost::filesystem::path> v;
+          copy(boost::filesystem::directory_iterator(folder), boost::filesystem::directory_iterator(),
+               back_inserter(v));
+
+          for (auto path : v) {
+              SECTION(path.string())
+              {
+                  util::MappedFileBlockReader serial_reader{path.string()};
+                  std::vector<std::string> serial = validate_blocks(serial_reader, path.string());
+
+                  util::MappedFileBlockReader parallel_reader{path.string()};
+                  CHECK(validate_blocks(parallel_reader, path.string(), 4) == serial);
+
+                  // the body of a mapped file is split in chunks, with as few as one line each
+                  for (size_t threads : {2, 4, 16}) {
+                      CHECK(validate_mapped(path.string(), threads) == serial);
+                  }
+
+                  // the records of a block are checked after it's parsed, even those in lines split between blocks
+                  std::ifstream serial_input{path.string()};
+                  util::StreamBlockReader serial_small_reader{serial_input, 5};
+                  std::vector<std::string> serial_small = validate_blocks(serial_small_reader, path.string());
+
+                  std::ifstream parallel_input{path.string()};
+                  util::StreamBlockReader parallel_small_reader{parallel_input, 5};
+                  CHECK(validate_blocks(parallel_small_reader, path.string(), 4) == serial_small);
+              }
+          }
+      }
+  }
+
+  TEST_CASE("Validation in chunks reports like validation in a single pass", "[block_reader]")
+  {
+      auto path = boost::filesystem::path{"/tmp/"} / "chunked_validation.vcf";
+      std::string header = "##fileformat=VCFv4.3\n##reference=file:///reference.fa\n##contig=<ID=1>\n##contig=<ID=2>\n"
+                           "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\n";
+      auto write_file = [&](std::vector<std::string> const & lines) {
+          std::ofstream output{path.string()};
+          output << header;
+          for (auto & line : lines) {
+              output << line << "\n";
+          }
+      };
+      auto record = [](std::string const & chromosome, size_t position, std::string const & alternate) {
+          return chromosome + "\t" + std::to_string(position) + "\t.\tA\t" + alternate + "\t.\t.\t.";
+      };
+
+      std::vector<std::string> sorted;
+      for (size_t position = 1; position <= 200; ++position) {
+          sorted.push_back(record(position <= 100 ? "1" : "2", position, "C"));
+      }
+
+      SECTION("Sorted records")
+      {
+          write_file(sorted);
+          auto serial = validate_mapped(path.string(), 1);
+          CHECK(serial.empty());
+          for (size_t threads : {2, 3, 8, 64}) {
+              CHECK(validate_mapped(path.string(), threads) == serial);
+          }
+      }
+
+      SECTION("Unsorted and duplicated records across the whole file")
+      {
+          std::vector<std::string> lines = sorted;
+          lines.insert(lines.begin() + 150, record("1", 20, "C"));     // contig already finished
+          lines.insert(lines.begin() + 120, record("2", 110, "C"));    // duplicate of a near line
+          lines.insert(lines.begin() + 60, record("1", 10, "G"));      // position out of order
+          lines.insert(lines.begin() + 30, record("1", 5, "C"));       // duplicate of a distant line
+          lines.push_back(record("3", 1, "C"));                        // no contig meta
+          write_file(lines);
+
+          auto serial = validate_mapped(path.string(), 1);
+          CHECK(serial.size() >= 5);
+          for (size_t threads : {2, 3, 8, 64}) {
+              CHECK(validate_mapped(path.string(), threads) == serial);
+          }
+      }
+
+      SECTION("Error that stops the validation in the middle of the body")
+      {
+          std::vector<std::string> lines = sorted;
+          lines.insert(lines.begin() + 150, record("1", 20, "C"));
+          lines.insert(lines.begin() + 90, "");                        // empty line in the body
+          lines.insert(lines.begin() + 30, record("1", 5, "C"));
+          write_file(lines);
+
+          auto serial = validate_mapped(path.string(), 1);
+          CHECK_FALSE(serial.empty());
+          for (size_t threads : {2, 3, 8, 64}) {
+              CHECK(validate_mapped(path.string(), threads) == serial);
+          }
+      }
+
+      boost::filesystem::remove(path);
+  }
+}
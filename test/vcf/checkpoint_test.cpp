@@ -0,0 +1,341 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include "catch/catch.hpp"
+
+#include "vcf/checkpoint.hpp"
+#include "vcf/hash_record_cache.hpp"
+#include "vcf/validator.hpp"
+#include "test_utils.hpp"
+
+namespace ebi
+{
+  namespace
+  {
+    /**
+     * Reports kept in memory like in a file, and the batches they were written in
+     */
+    struct Reports
+    {
+        std::vector<std::string> lines;
+        size_t batches = 0;
+    };
+
+    /**
+     * Writes to some Reports, and is interrupted at some batch, like the process could be
+     */
+    class InterruptedReportWriter : public vcf::ReportWriter
+    {
+      public:
+        InterruptedReportWriter(Reports & reports, size_t interrupted_batch)
+        : reports(reports), interrupted_batch{interrupted_batch}
+        {
+        }
+
+        virtual void write_error(vcf::Error &error) override { reports.lines.push_back(report(error)); }
+        virtual void write_warning(vcf::Error &error) override { reports.lines.push_back(report(error) + " (warning)"); }
+        virtual void write_message(const std::string &report_result) override { }
+        virtual std::string get_filename() override { return "in memory"; }
+
+        virtual void write_batch(std::vector<vcf::ReportedError> const & batch) override
+        {
+            if (++reports.batches == interrupted_batch) {
+                throw std::runtime_error{"Interrupted"};
+            }
+            vcf::ReportWriter::write_batch(batch);
+        }
+
+        virtual void save_checkpoint(std::ostream &checkpoint) override
+        {
+            util::write_number(checkpoint, reports.lines.size());
+        }
+
+        virtual void load_checkpoint(std::istream &checkpoint) override
+        {
+            reports.lines.resize(util::read_number(checkpoint));
+        }
+
+      private:
+        static std::string report(vcf::Error &error)
+        {
+            return std::to_string(error.line) + ": " + error.what();
+        }
+
+        Reports & reports;
+        size_t interrupted_batch;
+    };
+
+    std::string const checkpoint_path = "checkpoint_test.checkpoint";
+
+    /**
+     * Validates a file with a checkpoint before every small block, or resumes it from the last one, until the
+     * batch `interrupted_batch` of reports if it is not 0
+     */
+    bool validate(std::string const & path,
+                  vcf::ValidationLevel level,
+                  Reports & reports,
+                  bool resume,
+                  size_t interrupted_batch = 0)
+    {
+        vcf::Checkpoints checkpoints{checkpoint_path, std::chrono::seconds{0}};
+        if (resume) {
+            checkpoints.load();
+        }
+        vcf::MemoryBudget memory;
+        memory.block_size = 100;
+        std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+        outputs.emplace_back(new InterruptedReportWriter{reports, interrupted_batch});
+        util::MappedFileBlockReader input{path};
+        return vcf::is_valid_vcf_file_with_checkpoints(input, path, level, outputs, &checkpoints, nullptr, 1,
+                                                       nullptr, nullptr, &memory);
+    }
+
+    std::string const state_path = "checkpoint_test.state";
+
+    /**
+     * Validates a file after the lines validated the last time, keeping its state in small blocks
+     */
+    bool validate_incrementally(std::string const & path, vcf::ValidationLevel level, Reports & reports)
+    {
+        vcf::IncrementalState state{state_path};
+        if (boost::filesystem::exists(state_path)) {
+            state.load();
+        }
+        vcf::MemoryBudget memory;
+        memory.block_size = 100;
+        std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+        outputs.emplace_back(new InterruptedReportWriter{reports, 0});
+        util::MappedFileBlockReader input{path};
+        return vcf::is_valid_vcf_file_with_checkpoints(input, path, level, outputs, nullptr, &state, 1, nullptr,
+                                                       nullptr, &memory);
+    }
+
+    size_t report_line(std::string const & report)
+    {
+        return std::stoul(report);
+    }
+
+    /**
+     * Interrupts the validation at each batch of reports, and checks that resuming it from the last checkpoint
+     * reports the same as validating it at once
+     */
+    void check_resumed_validations(std::string const & path, vcf::ValidationLevel level)
+    {
+        Reports complete;
+        bool is_valid = validate(path, level, complete, false);
+        CHECK_FALSE(boost::filesystem::exists(checkpoint_path));
+        REQUIRE(complete.batches > 1);
+
+        for (size_t batch = 1; batch <= complete.batches; ++batch) {
+            Reports interrupted;
+            CHECK_THROWS_AS(validate(path, level, interrupted, false, batch), std::runtime_error);
+
+            // the file keeps the reports until the checkpoint, or none if there is no checkpoint yet
+            bool resume = boost::filesystem::exists(checkpoint_path);
+            Reports resumed;
+            if (resume) {
+                resumed.lines = interrupted.lines;
+            }
+            CHECK(validate(path, level, resumed, resume) == is_valid);
+            CHECK(resumed.lines == complete.lines);
+            CHECK_FALSE(boost::filesystem::exists(checkpoint_path));
+        }
+    }
+    /**
+     * Writes a file with errors and warnings found in a single line, and along several ones
+     */
+    void write_test_file(std::string const & path)
+    {
+        std::ofstream file{path};
+        file << "##fileformat=VCFv4.3\n"
+                "##contig=<ID=1>\n"
+                "##INFO=<ID=DP,Number=1,Type=Integer,Description=\"Depth\">\n"
+                "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\n";
+        for (size_t position = 100; position < 130; ++position) {
+            file << "1\t" << position << "\t.\tA\tT\t.\tPASS\tDP=" << position << "\n";
+            if (position % 7 == 0) {
+                file << "1\t" << position << "\t.\tA\tT\t.\tPASS\tDP=1\n";     // duplicated
+            }
+            if (position % 9 == 0) {
+                file << "2\t" << position << "\t.\tA\tT\t.\tPASS\tDP=1\n";     // contig 1 not contiguous
+            }
+            if (position % 11 == 0) {
+                file << "1\t" << position << "\t.\tA\tT\t.\tPASS\tDP=x\n";     // not an Integer
+            }
+            if (position % 13 == 0) {
+                file << "1\t" << position << "\t.\tA\tT\tQ\tPASS\tDP=1\n";    // syntax error
+            }
+        }
+    }
+  }
+
+  TEST_CASE("Variants to find duplicates saved in a checkpoint", "[checkpoint]")
+  {
+      vcf::HashRecordCache cache{3};
+      for (size_t position = 100; position <= 104; ++position) {
+          cache.check_duplicates(build_mock_record({position, "A", {"T"}}));
+      }
+
+      std::stringstream saved;
+      cache.save(saved);
+      vcf::HashRecordCache loaded;
+      loaded.load(saved);
+
+      CHECK(loaded.first_line() == cache.first_line());
+      CHECK(loaded.check_duplicates(build_mock_record({104, "A", {"T"}})).size() == 2);
+      cache.check_duplicates(build_mock_record({104, "A", {"T"}}));
+      for (size_t position : {102, 103, 101, 104}) {
+          CHECK(loaded.check_duplicates(build_mock_record({position, "A", {"T"}})).size()
+                == cache.check_duplicates(build_mock_record({position, "A", {"T"}})).size());
+      }
+
+      std::stringstream truncated{"3\n2\n"};
+      CHECK_THROWS_AS(loaded.load(truncated), std::runtime_error);
+  }
+
+  TEST_CASE("Validation resumed from a checkpoint", "[checkpoint]")
+  {
+      std::string path = "checkpoint_test.vcf";
+      write_test_file(path);
+
+      SECTION("Plain file, warning level")
+      {
+          check_resumed_validations(path, vcf::ValidationLevel::warning);
+      }
+
+      SECTION("Plain file, error level")
+      {
+          check_resumed_validations(path, vcf::ValidationLevel::error);
+      }
+
+      SECTION("BGZF file")
+      {
+          check_resumed_validations("test/input_files/v4.3/regions/regions.vcf.gz", vcf::ValidationLevel::warning);
+      }
+
+      SECTION("A checkpoint of another input is rejected")
+      {
+          Reports reports;
+          CHECK_THROWS_AS(validate(path, vcf::ValidationLevel::warning, reports, false, 3), std::runtime_error);
+          REQUIRE(boost::filesystem::exists(checkpoint_path));
+          CHECK_THROWS_AS(validate("test/input_files/v4.3/regions/regions.vcf.gz", vcf::ValidationLevel::warning,
+                                   reports, true),
+                          std::runtime_error);
+          CHECK_THROWS_AS(validate(path, vcf::ValidationLevel::error, reports, true), std::runtime_error);
+          boost::filesystem::remove(checkpoint_path);
+      }
+
+      boost::filesystem::remove(path);
+  }
+
+  TEST_CASE("Validation of the lines appended to a file", "[checkpoint]")
+  {
+      std::string path = "checkpoint_test.vcf";
+      write_test_file(path);
+      std::string contents;
+      {
+          std::ifstream file{path};
+          contents.assign(std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{});
+      }
+      Reports complete;
+      bool is_valid = validate_incrementally(path, vcf::ValidationLevel::warning, complete);
+      REQUIRE(boost::filesystem::exists(state_path));
+      boost::filesystem::remove(state_path);
+
+      SECTION("Appended after a whole line")
+      {
+          for (size_t end = contents.find("\n1\t") + 1; end != contents.size(); ++end) {
+              if (contents[end] != '\n') {
+                  continue;
+              }
+              std::ofstream{path, std::ios::trunc | std::ios::binary} << contents.substr(0, end + 1);
+              Reports reports;
+              validate_incrementally(path, vcf::ValidationLevel::warning, reports);
+              std::ofstream{path, std::ios::app | std::ios::binary} << contents.substr(end + 1);
+              CHECK(validate_incrementally(path, vcf::ValidationLevel::warning, reports) == is_valid);
+              CHECK(reports.lines == complete.lines);
+              boost::filesystem::remove(state_path);
+          }
+      }
+
+      SECTION("Appended in the middle of a line, which is validated again")
+      {
+          size_t end = contents.find("DP=x");
+          std::ofstream{path, std::ios::trunc | std::ios::binary} << contents.substr(0, end);
+          Reports reports;
+          validate_incrementally(path, vcf::ValidationLevel::warning, reports);
+          std::ofstream{path, std::ios::app | std::ios::binary} << contents.substr(end);
+          reports.lines.clear();
+          CHECK_FALSE(validate_incrementally(path, vcf::ValidationLevel::warning, reports));
+
+          size_t line = std::count(contents.begin(), contents.begin() + end, '\n') + 1;
+          std::vector<std::string> expected;
+          for (auto & report : complete.lines) {
+              if (report_line(report) >= line) {
+                  expected.push_back(report);
+              }
+          }
+          CHECK(reports.lines == expected);
+      }
+
+      SECTION("A changed file is validated from the beginning")
+      {
+          std::ofstream{path, std::ios::trunc | std::ios::binary} << contents.substr(0, contents.size() / 2);
+          Reports reports;
+          validate_incrementally(path, vcf::ValidationLevel::warning, reports);
+
+          std::string changed = contents;
+          changed[contents.size() / 2 - 10] = 'C';
+          std::ofstream{path, std::ios::trunc | std::ios::binary} << changed;
+          reports.lines.clear();
+          validate_incrementally(path, vcf::ValidationLevel::warning, reports);
+          Reports expected;
+          boost::filesystem::remove(state_path);
+          validate_incrementally(path, vcf::ValidationLevel::warning, expected);
+          CHECK(reports.lines == expected.lines);
+      }
+
+      SECTION("A file validated at another level is validated from the beginning")
+      {
+          std::ofstream{path, std::ios::trunc | std::ios::binary} << contents.substr(0, contents.size() / 2);
+          Reports reports;
+          validate_incrementally(path, vcf::ValidationLevel::warning, reports);
+
+          std::ofstream{path, std::ios::trunc | std::ios::binary} << contents;
+          reports.lines.clear();
+          validate_incrementally(path, vcf::ValidationLevel::error, reports);
+          Reports expected;
+          boost::filesystem::remove(state_path);
+          validate_incrementally(path, vcf::ValidationLevel::error, expected);
+          CHECK(reports.lines == expected.lines);
+      }
+
+      boost::filesystem::remove(state_path);
+      boost::filesystem::remove(path);
+  }
+}
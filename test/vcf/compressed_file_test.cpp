@@ -15,9 +15,13 @@
  */
 
 #include <fstream>
+#include <sstream>
 
 #include "catch/catch.hpp"
 
+#include "util/bgzf_block_reader.hpp"
+#include "util/bgzf_writer.hpp"
+#include "util/gzip_block_reader.hpp"
 #include "vcf/validator.hpp"
 
 namespace ebi
@@ -90,4 +94,170 @@ namespace ebi
           }
       }
   }
+
+  TEST_CASE("Tests for gzipped files", "[compressed]")
+  {
+      std::string plain_path = "test/input_files/v4.3/passed/passed_body_alt.vcf";
+      std::string gzip_path = "test/input_files/v4.3/gzip_files/passed_gzip.vcf.gz";
+      std::string bgzip_path = "test/input_files/v4.3/gzip_files/passed_bgzip.vcf.gz";
+      util::Block block;
+
+      SECTION("Gzip and BGZF magic numbers")
+      {
+          util::MappedFileBlockReader plain{plain_path};
+          REQUIRE(plain.peek(block));
+          CHECK_FALSE(util::is_gzip(block));
+
+          util::MappedFileBlockReader gzip{gzip_path};
+          REQUIRE(gzip.peek(block));
+          CHECK(util::is_gzip(block));
+          CHECK_FALSE(util::is_bgzf(block));
+
+          util::MappedFileBlockReader bgzip{bgzip_path};
+          REQUIRE(bgzip.peek(block));
+          CHECK(util::is_gzip(block));
+          CHECK(util::is_bgzf(block));
+      }
+
+      SECTION("Decompressed contents")
+      {
+          std::ifstream input{plain_path};
+          std::string expected{std::istreambuf_iterator<char>{input}, std::istreambuf_iterator<char>{}};
+
+          for (auto path : {gzip_path, bgzip_path}) {
+              util::MappedFileBlockReader compressed{path, 64};
+              util::GzipBlockReader decompressed{compressed, 100};
+              std::string contents;
+              while (decompressed.read(block)) {
+                  contents.append(block.data, block.size);
+              }
+              CHECK(contents == expected);
+          }
+      }
+
+      SECTION("BGZF decompressed in several threads")
+      {
+          std::ifstream input{plain_path};
+          std::string expected{std::istreambuf_iterator<char>{input}, std::istreambuf_iterator<char>{}};
+
+          for (size_t threads : {1, 2, 4}) {
+              util::MappedFileBlockReader compressed{bgzip_path, 64};
+              util::BgzfBlockReader decompressed{compressed, threads};
+              std::string contents;
+              while (decompressed.read(block)) {
+                  contents.append(block.data, block.size);
+              }
+              CHECK(contents == expected);
+          }
+      }
+
+      SECTION("BGZF block with an uncompressed size larger than allowed")
+      {
+          std::ifstream input{bgzip_path};
+          std::string bytes{std::istreambuf_iterator<char>{input}, std::istreambuf_iterator<char>{}};
+          size_t first_block_size = static_cast<unsigned char>(bytes[16])
+                                    + (static_cast<unsigned char>(bytes[17]) << 8) + 1;
+          // the ISIZE field closes the block
+          bytes.replace(first_block_size - 4, 4, "\xff\xff\xff\xff");
+
+          std::istringstream stream{bytes};
+          util::StreamBlockReader compressed{stream};
+          util::BgzfBlockReader decompressed{compressed, 1};
+          try {
+              while (decompressed.read(block)) {
+              }
+              FAIL("The corrupted block was inflated");
+          } catch (std::runtime_error const & error) {
+              CHECK(std::string{error.what()} == "Couldn't decompress the BGZF input: corrupted block");
+          }
+      }
+
+      SECTION("Many empty BGZF blocks in a row")
+      {
+          std::ifstream plain_input{plain_path};
+          std::string expected{std::istreambuf_iterator<char>{plain_input}, std::istreambuf_iterator<char>{}};
+
+          std::ifstream input{bgzip_path};
+          std::string bytes{std::istreambuf_iterator<char>{input}, std::istreambuf_iterator<char>{}};
+          std::string empty_blocks;
+          for (size_t i = 0; i < 100000; ++i) {
+              empty_blocks.append(util::bgzf_eof_marker, util::bgzf_eof_marker_size);
+          }
+
+          std::istringstream stream{empty_blocks + bytes + empty_blocks};
+          util::StreamBlockReader compressed{stream};
+          util::BgzfBlockReader decompressed{compressed, 1};
+          std::string contents;
+          while (decompressed.read(block)) {
+              contents.append(block.data, block.size);
+          }
+          CHECK(contents == expected);
+      }
+  }
+
+  TEST_CASE("Writing BGZF", "[compressed]")
+  {
+      std::string plain_path = "test/input_files/v4.3/passed/passed_body_alt.vcf";
+      std::string bgzip_path = "test/input_files/v4.3/gzip_files/passed_bgzip.vcf.gz";
+      util::Block block;
+
+      SECTION("Same bytes as bgzip")
+      {
+          // this file was written by bgzip in blocks of 200 bytes of text
+          std::ifstream bgzip_input{bgzip_path};
+          std::string expected{std::istreambuf_iterator<char>{bgzip_input}, std::istreambuf_iterator<char>{}};
+
+          for (size_t threads : {1, 2, 4}) {
+              std::ifstream input{plain_path};
+              std::ostringstream compressed;
+              util::BgzfStreamBuffer buffer{compressed, threads, Z_DEFAULT_COMPRESSION, 200};
+              std::ostream output{&buffer};
+              output << input.rdbuf() << std::flush;
+              buffer.close();
+              CHECK(compressed.str() == expected);
+          }
+      }
+
+      SECTION("Compressed and decompressed in several threads")
+      {
+          std::string text;
+          for (size_t i = 0; i < 20000; ++i) {
+              text += "1\t" + std::to_string(i * 100) + "\t.\tA\tC\t.\tPASS\tDP=" + std::to_string(i % 7) + "\n";
+          }
+
+          std::string single_thread;
+          for (size_t threads : {1, 4}) {
+              std::ostringstream compressed;
+              {
+                  util::BgzfStreamBuffer buffer{compressed, threads};
+                  std::ostream output{&buffer};
+                  for (size_t i = 0; i < text.size(); i += 1000) {
+                      output << text.substr(i, 1000);
+                  }
+              }
+              if (threads == 1) {
+                  single_thread = compressed.str();
+              } else {
+                  CHECK(compressed.str() == single_thread);
+              }
+
+              std::istringstream stream{compressed.str()};
+              util::StreamBlockReader reader{stream};
+              util::BgzfBlockReader decompressed{reader, threads};
+              std::string contents;
+              while (decompressed.read(block)) {
+                  contents.append(block.data, block.size);
+              }
+              CHECK(contents == text);
+          }
+      }
+
+      SECTION("Only the end-of-file marker for an empty text")
+      {
+          std::ostringstream compressed;
+          util::BgzfStreamBuffer buffer{compressed, 1};
+          buffer.close();
+          CHECK(compressed.str() == std::string(util::bgzf_eof_marker, util::bgzf_eof_marker_size));
+      }
+  }
 }
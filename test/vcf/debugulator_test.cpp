@@ -19,9 +19,11 @@
 
 #include "catch/catch.hpp"
 
+#include "vcf/binary_report.hpp"
 #include "vcf/odb_report.hpp"
 #include "vcf/debugulator.hpp"
 #include "vcf/string_constants.hpp"
+#include "vcf/validator.hpp"
 
 namespace ebi
 {
@@ -502,6 +504,69 @@ namespace ebi
       }
   }
 
+  TEST_CASE("Fixing all the errors of a line at once", "[debugulator]")
+  {
+      size_t line_number = 8;
+      std::string string_line = "chr\tpos\tdupid;dupid\tref\talt\tqual\tdupfil;filter;dupfil\tAA=1;AA=1;BB=2;BB=3\tGT:GH:GT\t0|1:2:0|1\n";
+      std::vector<char> line{string_line.begin(), string_line.end()};
+
+      ebi::vcf::IdBodyError id_error{line_number, "Duplicate ID fields", ebi::vcf::ErrorFix::DUPLICATE_VALUES};
+      ebi::vcf::FilterBodyError filter_error{line_number, "Duplicate filter strings", ebi::vcf::ErrorFix::DUPLICATE_VALUES};
+      ebi::vcf::InfoBodyError info_error{line_number, "Duplicate INFO fields", "", ebi::vcf::ErrorFix::DUPLICATE_VALUES};
+      ebi::vcf::FormatBodyError format_error{line_number, "Duplicate format fields", ebi::vcf::ErrorFix::DUPLICATE_VALUES};
+      ebi::vcf::Error unfixable_error{line_number, "not fixable"};
+
+      SECTION("Every fix applied to the same line, written once")
+      {
+          std::stringstream output;
+          vcf::Fixer fixer{output};
+          fixer.fix(line_number, line, {&id_error, &unfixable_error, &filter_error, &info_error, &format_error});
+
+          CHECK(output.str() == "chr\tpos\tdupid\tref\talt\tqual\tdupfil;filter\tAA=1\tGT:GH\t0|1:2\n");
+          CHECK(fixer.get_ignored_errors() == 1);
+      }
+
+      SECTION("Removed after being fixed")
+      {
+          ebi::vcf::DuplicationError duplication_error{line_number, "Duplicated variant"};
+          std::stringstream output;
+          vcf::Fixer fixer{output};
+          fixer.fix(line_number, line, {&id_error, &duplication_error, &unfixable_error});
+
+          CHECK(output.str() == "");
+          CHECK(fixer.get_ignored_errors() == 0);
+      }
+
+      SECTION("Only unfixable errors")
+      {
+          std::stringstream output;
+          vcf::Fixer fixer{output};
+          fixer.fix(line_number, line, {&unfixable_error, &unfixable_error});
+
+          CHECK(output.str() == string_line);
+          CHECK(fixer.get_ignored_errors() == 2);
+      }
+
+      SECTION("Several errors of a line in a report")
+      {
+          std::string report_name = "test/input_files/debugulator_test.errors.bin";
+          {
+              vcf::BinaryReportWriter writer{report_name};
+              writer.write_error(id_error);
+              writer.write_error(info_error);
+          }
+          vcf::BinaryReportReader report{report_name};
+
+          std::stringstream input{"line " + std::string(line_number - 1, '\n') + string_line + "last line\n"};
+          std::stringstream output;
+          CHECK(vcf::debugulator::fix_vcf_file(input, report, output) == 0);
+          CHECK(output.str() == "line " + std::string(line_number - 1, '\n')
+                                + "chr\tpos\tdupid\tref\talt\tqual\tdupfil;filter;dupfil\tAA=1\tGT:GH:GT\t0|1:2:0|1\n"
+                                + "last line\n");
+          boost::filesystem::remove(report_name);
+      }
+  }
+
   TEST_CASE("Empty report", "[debugulator]")
   {
       boost::filesystem::path path{"test/input_files/complexfile_passed_000.vcf.errors.1472743634194.db"};
@@ -515,5 +580,118 @@ namespace ebi
       }
   }
 
-}
+  TEST_CASE("Copying the lines without errors", "[debugulator]")
+  {
+      std::string input_text = "line 1\nline 2 is longer\nline 3\n\nline 5\nline 6 without newline";
+      std::string report_name = "test/input_files/debugulator_test.errors.bin";
+      {
+          vcf::BinaryReportWriter writer{report_name};
+          vcf::Error second_line_error{2, "not fixable"};
+          vcf::Error fifth_line_error{5, "not fixable"};
+          writer.write_error(second_line_error);
+          writer.write_error(fifth_line_error);
+      }
+      vcf::BinaryReportReader report{report_name};
+
+      SECTION("Lines spanning several blocks")
+      {
+          std::stringstream input{input_text};
+          util::StreamBlockReader reader{input, 5};
+          std::stringstream output;
+          CHECK(vcf::debugulator::fix_vcf_file(reader, report, output) == 2);
+          CHECK(output.str() == input_text);
+      }
+
+      SECTION("Input shorter than the report")
+      {
+          std::stringstream input{"line 1\nline 2\nline 3\n"};
+          std::stringstream output;
+          CHECK_THROWS_AS(vcf::debugulator::fix_vcf_file(input, report, output), std::runtime_error);
+          CHECK(output.str() == "line 1\nline 2\nline 3\n");
+      }
+
+      boost::filesystem::remove(report_name);
+  }
+
+  TEST_CASE("Fixing while validating", "[debugulator]")
+  {
+      std::vector<std::string> files = {"failed_body_duplicated_001.vcf", "failed_body_info_031.vcf",
+                                        "failed_body_info_036.vcf", "failed_body_sample_000.vcf",
+                                        "failed_body_sample_005.vcf", "failed_body_sample_006.vcf"};
+
+      for (size_t i = 1; i <= 3; ++i) {
+          for (auto & file : files) {
+              auto path = boost::filesystem::path("test/input_files/v4." + std::to_string(i) + "/failed/" + file);
+              SECTION(path.string())
+              {
+                  // fixed in two passes, with a report
+                  std::string report_name = "test/input_files/debugulator_test.errors.bin";
+                  {
+                      std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+                      outputs.emplace_back(new vcf::BinaryReportWriter{report_name});
+                      std::ifstream input{path.string()};
+                      vcf::is_valid_vcf_file(input, path.string(), vcf::ValidationLevel::warning, outputs);
+                  }
+                  std::stringstream expected;
+                  {
+                      vcf::BinaryReportReader report{report_name};
+                      std::ifstream input{path.string()};
+                      vcf::debugulator::fix_vcf_file(input, report, expected);
+                  }
+                  boost::filesystem::remove(report_name);
+
+                  // fixed in one pass, with blocks that split the lines
+                  std::ifstream input{path.string()};
+                  util::StreamBlockReader reader{input, 7};
+                  std::vector<std::unique_ptr<vcf::ReportWriter>> no_outputs;
+                  std::stringstream fixed;
+                  vcf::debugulator::StreamingFixer fixer{fixed};
+                  CHECK_FALSE(vcf::is_valid_vcf_file(reader, path.string(), vcf::ValidationLevel::warning,
+                                                     no_outputs, 1, &fixer));
+                  fixer.finish();
+                  CHECK(fixed.str() == expected.str());
+
+                  // and with the body split in chunks validated in parallel
+                  util::MappedFileBlockReader mapped{path.string()};
+                  std::stringstream fixed_in_chunks;
+                  vcf::debugulator::StreamingFixer chunks_fixer{fixed_in_chunks};
+                  CHECK_FALSE(vcf::is_valid_vcf_file(mapped, path.string(), vcf::ValidationLevel::warning,
+                                                     no_outputs, 2, &chunks_fixer));
+                  chunks_fixer.finish();
+                  CHECK(fixed_in_chunks.str() == expected.str());
+              }
+          }
+      }
+  }
+
+  TEST_CASE("Lines held until their errors are known", "[debugulator]")
+  {
+      std::stringstream fixed;
+      vcf::debugulator::StreamingFixer fixer{fixed};
 
+      fixer.add_input("line 1\nline", "line 1\nline" + 11);
+      fixer.add_error(vcf::Error{2, "not fixable"});
+      fixer.write_until(3);
+      CHECK(fixed.str() == "line 1\n");
+
+      fixer.add_input(" 2\nline 3\nline 4\n", " 2\nline 3\nline 4\n" + 17);
+      fixer.add_error(vcf::DuplicationError{3});
+      fixer.write_until(4);
+      CHECK(fixed.str() == "line 1\nline 2\n");
+
+      SECTION("Errors of lines not written yet")
+      {
+          fixer.add_error(vcf::DuplicationError{4});
+          CHECK(fixer.finish() == 1);
+          CHECK(fixed.str() == "line 1\nline 2\n");
+      }
+
+      SECTION("Errors of lines already written")
+      {
+          fixer.write_until(5);
+          fixer.add_error(vcf::DuplicationError{4});
+          CHECK(fixer.finish() == 2);
+          CHECK(fixed.str() == "line 1\nline 2\nline 4\n");
+      }
+  }
+}
@@ -0,0 +1,74 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <vector>
+
+#include <boost/regex.hpp>
+
+#include "catch/catch.hpp"
+
+#include "vcf/field_matchers.hpp"
+
+namespace ebi
+{
+  /**
+   * All the strings of up to `max_length` characters from `alphabet`
+   */
+  std::vector<std::string> all_strings(std::string const & alphabet, size_t max_length)
+  {
+      std::vector<std::string> strings{""};
+      size_t begin = 0;
+      for (size_t length = 1; length <= max_length; ++length) {
+          size_t end = strings.size();
+          for (size_t i = begin; i < end; ++i) {
+              for (char c : alphabet) {
+                  strings.push_back(strings[i] + c);
+              }
+          }
+          begin = end;
+      }
+      return strings;
+  }
+
+  TEST_CASE("Field matchers behave like the regular expressions", "[matchers]")
+  {
+      std::vector<std::string> inputs = all_strings("<>Ac1M:_,; =~\x7f\xe9", 3);
+      for (int c = 0; c < 256; ++c) {
+          inputs.push_back(std::string(1, static_cast<char>(c)));
+          inputs.push_back("<" + std::string(1, static_cast<char>(c)) + ">");
+      }
+      for (std::string s : { "<DEL>", "<DUP:TANDEM>", "<INS:ME:ALU>", "<DEL>>", "<<DEL>", "ACGTNacgtn", "ACGTX",
+                             "10M2I3D", "10M2", "M10", "0X", "12345", "this is (printable)", "AA=1" }) {
+          inputs.push_back(s);
+      }
+
+      boost::regex symbolic_regex("<([a-zA-Z0-9:_]+)>");
+      boost::regex bases_regex("[ACGTN]+", boost::regex::icase);
+      boost::regex printable_regex("((?![,;=])[[:print:]])+");
+      boost::regex cigar_regex("([0-9]+[MIDNSHPX])+");
+
+      for (auto & input : inputs) {
+          INFO("Input: '" << input << "'");
+          CHECK( vcf::is_symbolic_allele(input) == boost::regex_match(input, symbolic_regex) );
+          CHECK( vcf::is_bases(input) == boost::regex_match(input, bases_regex) );
+          CHECK( vcf::is_printable_without_separators(input) == boost::regex_match(input, printable_regex) );
+          CHECK( vcf::is_cigar(input) == boost::regex_match(input, cigar_regex) );
+      }
+
+      CHECK( vcf::symbolic_allele_id("<DUP:TANDEM>") == "DUP:TANDEM" );
+  }
+}
@@ -0,0 +1,405 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include "catch/catch.hpp"
+
+#include "vcf/duplicate_filter.hpp"
+#include "vcf/external_record_cache.hpp"
+#include "vcf/hash_record_cache.hpp"
+#include "vcf/record_cache.hpp"
+#include "test_utils.hpp"
+
+namespace ebi
+{
+    size_t count_hashed_duplicates(vcf::HashRecordCache &cache, TestMultiRecord summary)
+    {
+        return cache.check_duplicates(build_mock_record(summary)).size();
+    }
+
+    /** a gVCF reference block from `position` to `end`, or a variant with <*> if `end` is 0 */
+    vcf::Record build_block(size_t line, size_t position, size_t end, std::vector<std::string> alternates = {"<*>"})
+    {
+        // the symbolic alleles are not valid in the version of the mock source, so they are set after checking it
+        auto record = build_mock_record({position, "C", {"T"}});
+        record.line = line;
+        record.alternate_alleles = alternates;
+        if (end != 0) {
+            record.info = {{vcf::END, std::to_string(end)}};
+        }
+        return record;
+    }
+
+    TEST_CASE("HashRecordCache tests: capacity==1")
+    {
+        vcf::HashRecordCache cache{1};
+
+        cache.check_duplicates(build_mock_record({100, "A", {"T"}}));
+
+        SECTION("There's no duplicate") {
+            CHECK( count_hashed_duplicates(cache, {101, "A", {"T"}}) == 0 );
+        }
+        SECTION("No duplicate detected because capacity is too small") {
+            CHECK( count_hashed_duplicates(cache, {101, "A", {"T"}}) == 0 );
+            CHECK( count_hashed_duplicates(cache, {99, "GA", {"GT", "C"}}) == 0 );
+        }
+        SECTION("One simple duplicate") {
+            CHECK( count_hashed_duplicates(cache, {100, "A", {"T"}}) == 2 );
+        }
+        SECTION("One multiallelic duplicate") {
+            CHECK( count_hashed_duplicates(cache, {99, "GA", {"GT", "C"}}) == 2 );
+        }
+        SECTION("Triplicate") {
+            CHECK( count_hashed_duplicates(cache, {99, "GA", {"GT", "C"}}) == 2 );
+            // triplicate missed, reported as duplicate
+            CHECK( count_hashed_duplicates(cache, {99, "GA", {"GT"}}) == 2 );
+        }
+    }
+
+    TEST_CASE("HashRecordCache tests: capacity==5")
+    {
+        vcf::HashRecordCache cache{5};
+
+        for (size_t position = 100; position <= 105; ++position) {
+            cache.check_duplicates(build_mock_record({position, "A", {"T"}}));
+        }
+
+        SECTION("There's no duplicate") {
+            CHECK( count_hashed_duplicates(cache, {106, "A", {"T"}}) == 0 );
+        }
+        SECTION("No duplicate detected because capacity is too small") {
+            CHECK( count_hashed_duplicates(cache, {99, "GA", {"GT", "C"}}) == 0 );
+        }
+        SECTION("One simple duplicate") {
+            CHECK( count_hashed_duplicates(cache, {103, "A", {"T"}}) == 2 );
+        }
+        SECTION("One multiallelic duplicate") {
+            CHECK( count_hashed_duplicates(cache, {100, "GA", {"GT", "C"}}) == 2 );
+        }
+        SECTION("Triplicate")
+        {
+            CHECK( count_hashed_duplicates(cache, {104, "GA", {"GT", "C"}}) == 2 );
+            // the first occurrence should not be reported again
+            CHECK( count_hashed_duplicates(cache, {104, "GA", {"GT"}}) == 1 );
+        }
+    }
+
+    TEST_CASE("HashRecordCache tests: unlimited capacity")
+    {
+        vcf::HashRecordCache cache{0};
+
+        for (size_t position = 100; position <= 105; ++position) {
+            cache.check_duplicates(build_mock_record({position, "A", {"T"}}));
+        }
+
+        SECTION("Duplicate detected because there's no capacity limitation") {
+            CHECK( count_hashed_duplicates(cache, {99, "GA", {"GT", "C"}}) == 2 );
+        }
+        SECTION("Triplicate")
+        {
+            CHECK( count_hashed_duplicates(cache, {100, "GA", {"GT", "C"}}) == 2 );
+            CHECK( count_hashed_duplicates(cache, {100, "GA", {"GT"}}) == 1 );
+        }
+    }
+
+    TEST_CASE("HashRecordCache reports like RecordCache", "[record_cache]")
+    {
+        std::vector<TestMultiRecord> records = {
+                {100, "A", {"T"}}, {101, "A", {"T", "C"}}, {101, "A", {"C"}}, {102, "G", {"GT"}},
+                {102, "G", {"GT"}}, {102, "G", {"GT", "T"}}, {103, "AT", {"A"}}, {105, "C", {"T"}},
+                {106, "C", {"T"}}, {106, "C", {"T"}}, {107, "C", {"A"}}, {108, "CA", {"TA"}}};
+
+        for (size_t capacity : {0, 1, 2, 5}) {
+            vcf::RecordCache cache{capacity};
+            vcf::HashRecordCache hash_cache{capacity};
+            for (auto & record : records) {
+                auto errors = cache.check_duplicates(build_mock_record(record));
+                auto hash_errors = hash_cache.check_duplicates(build_mock_record(record));
+                REQUIRE( hash_errors.size() == errors.size() );
+                for (size_t i = 0; i < errors.size(); ++i) {
+                    CHECK( std::string{hash_errors[i]->what()} == errors[i]->what() );
+                }
+            }
+        }
+    }
+
+    TEST_CASE("HashRecordCache forgets the oldest variants, not the smallest", "[record_cache]")
+    {
+        // sorted, but contig 10 is smaller than contig 2 for RecordCache, which then forgets it first
+        auto record_in = [](std::string const & chromosome, size_t line) {
+            auto record = build_mock_record({100, "A", {"T"}});
+            record.chromosome = chromosome;
+            record.contig = vcf::intern_contig(chromosome);
+            record.line = line;
+            return record;
+        };
+
+        vcf::RecordCache cache{1};
+        vcf::HashRecordCache hash_cache{1};
+        CHECK( cache.check_duplicates(record_in("2", 1)).size() == 0 );
+        CHECK( hash_cache.check_duplicates(record_in("2", 1)).size() == 0 );
+        CHECK( cache.check_duplicates(record_in("10", 2)).size() == 0 );
+        CHECK( hash_cache.check_duplicates(record_in("10", 2)).size() == 0 );
+
+        CHECK( cache.check_duplicates(record_in("10", 3)).size() == 0 );
+        CHECK( hash_cache.check_duplicates(record_in("10", 3)).size() == 2 );
+    }
+
+    TEST_CASE("HashRecordCache appended in chunks", "[record_cache]")
+    {
+        vcf::HashRecordCache first{3};
+        first.check_duplicates(build_mock_record({100, "A", {"T"}}));
+        first.check_duplicates(build_mock_record({101, "A", {"T"}}));
+
+        SECTION("Following variants")
+        {
+            vcf::HashRecordCache later{3};
+            later.check_duplicates(build_mock_record({102, "A", {"T"}}));
+            later.check_duplicates(build_mock_record({103, "A", {"T"}}));
+            REQUIRE( first.precedes(later) );
+
+            first.append(later);
+            CHECK( count_hashed_duplicates(first, {101, "A", {"T"}}) == 2 );
+            // only the last 3 are kept
+            CHECK( count_hashed_duplicates(first, {100, "A", {"T"}}) == 0 );
+        }
+
+        SECTION("Overlapping variants")
+        {
+            vcf::HashRecordCache later{3};
+            later.check_duplicates(build_mock_record({101, "A", {"T"}}));
+            CHECK_FALSE( first.precedes(later) );
+        }
+
+        SECTION("Nothing checked later")
+        {
+            CHECK( first.precedes(vcf::HashRecordCache{3}) );
+        }
+    }
+
+    TEST_CASE("Duplicates sorted externally are reported like an unlimited RecordCache", "[record_cache]")
+    {
+        std::vector<TestMultiRecord> records = {
+                {106, "C", {"T"}}, {100, "A", {"T"}}, {101, "A", {"T", "C"}}, {102, "G", {"GT"}},
+                {101, "A", {"C"}}, {107, "C", {"A"}}, {102, "G", {"GT"}}, {102, "G", {"GT", "T"}},
+                {103, "AT", {"A"}}, {105, "C", {"T"}}, {106, "C", {"T"}}, {108, "CA", {"TA"}},
+                {100, "A", {"T"}}};
+
+        std::vector<size_t> lines;
+        std::vector<std::string> messages;
+        vcf::RecordCache unlimited{0};
+        for (size_t i = 0; i < records.size(); ++i) {
+            auto record = build_mock_record(records[i]);
+            record.line = i + 1;
+            for (auto & error : unlimited.check_duplicates(record)) {
+                lines.push_back(error->line);
+                messages.push_back(error->what());
+            }
+        }
+        REQUIRE( lines.size() == 9 );
+
+        for (size_t run_capacity : {1, 2, 3, 1000}) {
+            auto runs = std::make_shared<vcf::ExternalRecordCache>(
+                    boost::filesystem::temp_directory_path().string(), run_capacity);
+            vcf::HashRecordCache cache{1};
+            cache.spill_to(runs);
+            for (size_t i = 0; i < records.size(); ++i) {
+                auto record = build_mock_record(records[i]);
+                record.line = i + 1;
+                CHECK( cache.check_duplicates(record).empty() );
+            }
+            CHECK( cache.first_line() == 1 );
+
+            auto errors = runs->find_duplicates();
+            REQUIRE( errors.size() == lines.size() );
+            for (size_t i = 0; i < errors.size(); ++i) {
+                CHECK( errors[i]->line == lines[i] );
+                CHECK( std::string{errors[i]->what()} == messages[i] );
+            }
+            CHECK( runs->written_runs() == 0 );
+        }
+    }
+
+    TEST_CASE("Duplicates sorted externally in several merges", "[record_cache]")
+    {
+        size_t const variants = 3 * vcf::ExternalRecordCache::max_merged_runs;
+        vcf::ExternalRecordCache runs{boost::filesystem::temp_directory_path().string(), 1};
+        std::vector<vcf::NormalizedAllele> alleles;
+        for (size_t i = 0; i < variants; ++i) {
+            // every variant occurs twice, as far apart as possible
+            auto record = build_mock_record({100 + i % (variants / 2), "A", {"T"}});
+            record.line = i + 1;
+            vcf::normalize_alleles(record, alleles);
+            runs.add(record, alleles);
+        }
+        CHECK( runs.written_runs() == variants );
+
+        auto errors = runs.find_duplicates();
+        REQUIRE( errors.size() == variants );
+        for (size_t i = 0; i < variants / 2; ++i) {
+            CHECK( errors[2 * i]->line == i + 1 );
+            CHECK( errors[2 * i + 1]->line == i + 1 + variants / 2 );
+        }
+    }
+
+    TEST_CASE("Duplicates of forgotten variants found by a filter", "[record_cache]")
+    {
+        std::string directory = boost::filesystem::temp_directory_path().string();
+
+        SECTION("Sizes of the filter")
+        {
+            vcf::DuplicateFilter filter{directory, 1000, 0.01};
+            CHECK( filter.bit_count() >= 9585 );
+            CHECK( filter.bit_count() < 9585 + 64 );
+            CHECK( filter.hash_count() == 7 );
+            CHECK_THROWS_AS( (vcf::DuplicateFilter{directory, 1000, 1}), std::invalid_argument );
+        }
+
+        SECTION("Duplicates further away than the cache")
+        {
+            auto filter = std::make_shared<vcf::DuplicateFilter>(directory, 100);
+            vcf::HashRecordCache cache{2};
+            cache.filter_forgotten(filter);
+
+            // the same position with different alleles, and then the first ones again
+            std::vector<TestMultiRecord> records;
+            for (size_t inserted = 1; inserted <= 20; ++inserted) {
+                records.push_back({100, "A", {"A" + std::string(inserted, 'C')}});
+            }
+            records.push_back({100, "A", {"AC", "ACC"}});
+            records.push_back({100, "A", {"AC"}});
+
+            size_t close_duplicates = 0;
+            for (size_t i = 0; i < records.size(); ++i) {
+                auto record = build_mock_record(records[i]);
+                record.line = i + 1;
+                close_duplicates += cache.check_duplicates(record).size();
+            }
+            // the last one is close to the previous occurrence, and both are reported
+            CHECK( close_duplicates == 2 );
+            CHECK( cache.first_line() == 1 );
+
+            auto errors = filter->find_duplicates();
+            REQUIRE( errors.size() == 4 );
+            CHECK( errors[0]->line == 1 );
+            CHECK( errors[1]->line == 21 );
+            CHECK( std::string{errors[1]->what()} == "Line 21: Duplicated variant 1:101:>C found. It occurs in lines 1 and 21." );
+            CHECK( errors[2]->line == 2 );
+            CHECK( errors[3]->line == 21 );
+            CHECK( std::string{errors[3]->what()} == "Line 21: Duplicated variant 1:101:>CC found. It occurs in lines 2 and 21." );
+        }
+
+        SECTION("False positives are discarded")
+        {
+            // a filter much smaller than needed, so almost every variant is a suspect
+            auto filter = std::make_shared<vcf::DuplicateFilter>(directory, 1, 0.5);
+            vcf::HashRecordCache cache{1};
+            cache.filter_forgotten(filter);
+            for (size_t position = 100; position < 300; ++position) {
+                auto record = build_mock_record({position, "A", {"T"}});
+                record.line = position;
+                CHECK( cache.check_duplicates(record).empty() );
+            }
+            CHECK( filter->suspect_count() > 0 );
+            CHECK( filter->find_duplicates().empty() );
+        }
+    }
+
+    TEST_CASE("gVCF reference blocks reported like RecordCache", "[record_cache]")
+    {
+        std::vector<vcf::Record> records = {
+                build_block(1, 100, 110), build_block(2, 100, 110), build_block(3, 100, 105, {"<NON_REF>"}),
+                build_block(4, 100, 0, {"T", "<*>"}), build_block(5, 111, 120), build_block(6, 111, 120),
+                build_block(7, 111, 120), build_block(8, 105, 108), build_block(9, 105, 108),
+                build_block(10, 105, 108), build_block(11, 121, 0, {"<*>"}), build_block(12, 121, 130)};
+        REQUIRE( records[0].is_reference_block() );
+        REQUIRE_FALSE( records[3].is_reference_block() );
+        REQUIRE_FALSE( records[10].is_reference_block() );
+
+        // with a smaller capacity, RecordCache would forget blocks of the same start that are still compared
+        for (size_t capacity : {0, 5}) {
+            vcf::RecordCache cache{capacity};
+            vcf::HashRecordCache hash_cache{capacity};
+            for (auto & record : records) {
+                auto errors = cache.check_duplicates(record);
+                auto hash_errors = hash_cache.check_duplicates(record);
+                REQUIRE( hash_errors.size() == errors.size() );
+                for (size_t i = 0; i < errors.size(); ++i) {
+                    CHECK( hash_errors[i]->line == errors[i]->line );
+                    CHECK( std::string{hash_errors[i]->what()} == errors[i]->what() );
+                }
+            }
+            CHECK( hash_cache.first_line() <= 12 );
+        }
+
+        auto & source = *mock_source();
+        CHECK( (source.input_format & vcf::VCF_FILE_GVCF) != 0 );
+        source.input_format = vcf::VCF_FILE_VCF;
+    }
+
+    TEST_CASE("gVCF reference blocks appended in chunks and saved", "[record_cache]")
+    {
+        vcf::HashRecordCache first{3};
+        first.check_duplicates(build_block(1, 100, 110));
+        first.check_duplicates(build_block(2, 111, 120));
+
+        SECTION("Following blocks")
+        {
+            vcf::HashRecordCache later{3};
+            later.check_duplicates(build_block(3, 121, 130));
+            REQUIRE( first.precedes(later) );
+            first.append(later);
+            CHECK( first.first_line() == 3 );
+            CHECK( first.check_duplicates(build_block(4, 121, 130)).size() == 2 );
+        }
+
+        SECTION("A block that starts where the last one of the previous chunk started")
+        {
+            vcf::HashRecordCache later{3};
+            later.check_duplicates(build_block(3, 111, 115));
+            CHECK_FALSE( first.precedes(later) );
+        }
+
+        SECTION("Blocks of the same start in both chunks")
+        {
+            vcf::HashRecordCache later{3};
+            later.check_duplicates(build_block(3, 111, 0, {"T"}));
+            REQUIRE( first.precedes(later) );
+            first.append(later);
+            CHECK( first.check_duplicates(build_block(4, 111, 120)).size() == 2 );
+            CHECK( first.check_duplicates(build_block(5, 111, 0, {"T"})).size() == 2 );
+        }
+
+        SECTION("Saved and loaded")
+        {
+            std::stringstream saved;
+            first.save(saved);
+            vcf::HashRecordCache loaded;
+            loaded.load(saved);
+            CHECK( loaded.first_line() == 2 );
+            auto errors = loaded.check_duplicates(build_block(3, 111, 118));
+            REQUIRE( errors.size() == 2 );
+            CHECK( errors[0]->line == 2 );
+        }
+    }
+}
@@ -0,0 +1,179 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include "catch/catch.hpp"
+
+#include "vcf/header_cache.hpp"
+#include "vcf/validator.hpp"
+#include "test_utils.hpp"
+
+namespace ebi
+{
+  namespace
+  {
+    // without a reference, the meta section has a warning
+    std::string const shared_header =
+            "##fileformat=VCFv4.3\n"
+            "##contig=<ID=1>\n"
+            "##INFO=<ID=DP,Number=1,Type=Integer,Description=\"Depth\">\n"
+            "##FORMAT=<ID=GT,Number=1,Type=String,Description=\"Genotype\">\n"
+            "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\tFORMAT\tSample1\n";
+
+    void write_file(std::string const & path, std::string const & header, size_t first_position)
+    {
+        std::ofstream file{path};
+        file << header;
+        for (size_t position = first_position; position < first_position + 40; ++position) {
+            file << "1\t" << position << "\t.\tA\tT\t.\tPASS\tDP=" << position << "\tGT\t0|1\n";
+            if (position % 7 == 0) {
+                file << "1\t" << position << "\t.\tA\tT\t.\tPASS\tDP=1\tGT\t0|1\n";   // duplicated
+            }
+            if (position % 11 == 0) {
+                file << "1\t" << position << "\t.\tA\tT\t.\tPASS\tDP=x\tGT\t0|1\n";   // not an Integer
+            }
+            if (position % 13 == 0) {
+                file << "1\t" << position << "\t.\tA\tT\tQ\tPASS\tDP=1\tGT\t0|1\n";   // syntax error
+            }
+        }
+    }
+
+    bool validate(std::string const & path, vcf::ValidationLevel level, size_t threads, vcf::HeaderCache * headers,
+                  std::vector<std::string> & reports)
+    {
+        auto report = new CollectingReportWriter{};
+        std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+        outputs.emplace_back(report);
+        util::MappedFileBlockReader input{path};
+        bool is_valid = vcf::is_valid_vcf_file(input, path, level, outputs, threads, nullptr, nullptr, nullptr,
+                                               nullptr, vcf::RecordSampling{}, headers);
+        reports = report->descriptions(true);
+        return is_valid;
+    }
+
+    /**
+     * Validates the files with and without the cache, which must report the same
+     */
+    void check_same_reports(std::vector<std::string> const & paths, vcf::ValidationLevel level, size_t threads,
+                            vcf::HeaderCache & headers)
+    {
+        for (auto & path : paths) {
+            std::vector<std::string> expected;
+            std::vector<std::string> reports;
+            bool is_valid = validate(path, level, threads, nullptr, expected);
+            CHECK(validate(path, level, threads, &headers, reports) == is_valid);
+            CHECK(reports == expected);
+            CHECK_FALSE(expected.empty());
+        }
+    }
+  }
+
+  TEST_CASE("Headers reused by the files of a batch", "[header_cache]")
+  {
+      std::vector<std::string> shards{"header_cache_test_1.vcf", "header_cache_test_2.vcf",
+                                      "header_cache_test_3.vcf"};
+      for (size_t i = 0; i < shards.size(); ++i) {
+          write_file(shards[i], shared_header, 100 + 40 * i);
+      }
+      vcf::HeaderCache headers;
+
+      SECTION("Parsed once, at each level")
+      {
+          check_same_reports(shards, vcf::ValidationLevel::warning, 1, headers);
+          CHECK(headers.size() == 1);
+          CHECK(headers.misses() == 1);
+          CHECK(headers.hits() == 2);
+
+          check_same_reports(shards, vcf::ValidationLevel::error, 1, headers);
+          CHECK(headers.size() == 2);
+          CHECK(headers.hits() == 4);
+      }
+
+      SECTION("Bodies split in chunks")
+      {
+          check_same_reports(shards, vcf::ValidationLevel::warning, 3, headers);
+          CHECK(headers.hits() == 2);
+      }
+
+      SECTION("A header with errors is not kept")
+      {
+          std::string wrong_header = shared_header;
+          wrong_header.replace(wrong_header.find(",Description=\"Depth\""), 20, "");
+          std::string path = "header_cache_test_wrong.vcf";
+          write_file(path, wrong_header, 100);
+
+          check_same_reports({path, path}, vcf::ValidationLevel::warning, 1, headers);
+          CHECK(headers.size() == 0);
+          CHECK(headers.hits() == 0);
+          boost::filesystem::remove(path);
+      }
+
+      for (auto & shard : shards) {
+          boost::filesystem::remove(shard);
+      }
+  }
+
+  TEST_CASE("Header cache", "[header_cache]")
+  {
+      auto cached = [](std::string const & text, vcf::ValidationLevel level) {
+          std::shared_ptr<vcf::CachedHeader> header = std::make_shared<vcf::CachedHeader>();
+          header->text = text;
+          header->level = level;
+          header->profiled = false;
+          return header;
+      };
+      auto find = [](vcf::HeaderCache & headers, std::string const & text, vcf::ValidationLevel level) {
+          return headers.find(text.data(), text.data() + text.size(), level, false);
+      };
+
+      SECTION("Only the same text at the same level")
+      {
+          vcf::HeaderCache headers;
+          headers.add(cached("##fileformat=VCFv4.3\n", vcf::ValidationLevel::warning));
+          CHECK(find(headers, "##fileformat=VCFv4.3\n", vcf::ValidationLevel::warning));
+          CHECK_FALSE(find(headers, "##fileformat=VCFv4.2\n", vcf::ValidationLevel::warning));
+          CHECK_FALSE(find(headers, "##fileformat=VCFv4.3\n", vcf::ValidationLevel::error));
+          CHECK(headers.hits() == 1);
+          CHECK(headers.misses() == 2);
+      }
+
+      SECTION("Added once")
+      {
+          vcf::HeaderCache headers;
+          headers.add(cached("#CHROM\n", vcf::ValidationLevel::warning));
+          headers.add(cached("#CHROM\n", vcf::ValidationLevel::warning));
+          CHECK(headers.size() == 1);
+      }
+
+      SECTION("The oldest forgotten first")
+      {
+          vcf::HeaderCache headers{2};
+          headers.add(cached("1", vcf::ValidationLevel::warning));
+          headers.add(cached("2", vcf::ValidationLevel::warning));
+          headers.add(cached("3", vcf::ValidationLevel::warning));
+          CHECK(headers.size() == 2);
+          CHECK_FALSE(find(headers, "1", vcf::ValidationLevel::warning));
+          CHECK(find(headers, "2", vcf::ValidationLevel::warning));
+          CHECK(find(headers, "3", vcf::ValidationLevel::warning));
+      }
+  }
+}
@@ -0,0 +1,145 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "catch/catch.hpp"
+
+#include "vcf/line_scanner.hpp"
+#include "vcf/validator.hpp"
+
+namespace ebi
+{
+  bool is_skipped(std::string const & line)
+  {
+      char const * next = vcf::skip_valid_body_line(line.data(), line.data() + line.size());
+      return next == line.data() + line.size();
+  }
+
+  TEST_CASE("Body lines skipped by the syntax validation", "[line_scanner]")
+  {
+      std::string const samples = "\tGT:DP\t0/1:12\t1|1:.\t./.:3";
+
+      SECTION("Usual valid lines")
+      {
+          CHECK(is_skipped("1\t100\t.\tA\tC\t.\t.\t.\n"));
+          CHECK(is_skipped("chr1\t100\trs123;rs456\tACGTN\tC,T,*\t50\tPASS\tDP=12;AF=0.5,0.2;1000G;DB\n"));
+          CHECK(is_skipped("GL000192.1\t100\trs1\tacgt\t<DEL>,<NON_REF>,<CN:2>\t-1.5e+3\tq10;s50\t.\n"));
+          CHECK(is_skipped("X\t1\t.\tA\tG\t10.5\tPASS\t_key.2=a=b,c" + samples + "\n"));
+          CHECK(is_skipped("X\t1\t.\tA\tG\t10\tPASS\t." + samples + "\r\n"));
+      }
+
+      SECTION("Long lines of samples")
+      {
+          std::string line = "1\t100\t.\tA\tC\t.\t.\t.\tGT:AD:DP";
+          for (size_t i = 0; i < 100; ++i) {
+              line += "\t0/1:10,2:12";
+          }
+          CHECK(is_skipped(line + "\n"));
+          CHECK_FALSE(is_skipped(line + ":\n"));
+          CHECK_FALSE(is_skipped(line + "\t\n"));
+          CHECK_FALSE(is_skipped(line + " \n"));
+
+          // every position of a block
+          for (size_t i = 40; i < 80; ++i) {
+              std::string empty_field = line;
+              empty_field.insert(i, ":");
+              empty_field[i + 1] = ':';
+              CHECK_FALSE(is_skipped(empty_field + "\n"));
+
+              std::string control_char = line;
+              control_char[i] = '\x01';
+              CHECK_FALSE(is_skipped(control_char + "\n"));
+
+              std::string non_ascii = line;
+              non_ascii[i] = '\xe9';
+              CHECK_FALSE(is_skipped(non_ascii + "\n"));
+          }
+      }
+
+      SECTION("Invalid lines are parsed")
+      {
+          CHECK_FALSE(is_skipped("\n"));
+          CHECK_FALSE(is_skipped("chr:1\t100\t.\tA\tC\t.\t.\t.\n"));
+          CHECK_FALSE(is_skipped("1\t1a\t.\tA\tC\t.\t.\t.\n"));
+          CHECK_FALSE(is_skipped("1\t100\trs1;\tA\tC\t.\t.\t.\n"));
+          CHECK_FALSE(is_skipped("1\t100\t.\tAX\tC\t.\t.\t.\n"));
+          CHECK_FALSE(is_skipped("1\t100\t.\tA\tC,\t.\t.\t.\n"));
+          CHECK_FALSE(is_skipped("1\t100\t.\tA\t<>\t.\t.\t.\n"));
+          CHECK_FALSE(is_skipped("1\t100\t.\tA\tC\t1.\t.\t.\n"));
+          CHECK_FALSE(is_skipped("1\t100\t.\tA\tC\t.\t;\t.\n"));
+          CHECK_FALSE(is_skipped("1\t100\t.\tA\tC\t.\t.\tDP=\n"));
+          CHECK_FALSE(is_skipped("1\t100\t.\tA\tC\t.\t.\t1DP=1\n"));
+          CHECK_FALSE(is_skipped("1\t100\t.\tA\tC\t.\t.\tDP=1 2\n"));
+          CHECK_FALSE(is_skipped("1\t100\t.\tA\tC\t.\t.\t.\tGT\n"));
+          CHECK_FALSE(is_skipped("1\t100\t.\tA\tC\t.\t.\t.\t\t0/1\n"));
+          CHECK_FALSE(is_skipped("1\t100\t.\tA\tC\t.\t.\t.\r"));
+      }
+
+      SECTION("Lines valid only in some versions, or rarely found, are parsed")
+      {
+          CHECK_FALSE(is_skipped("<1>\t100\t.\tA\tC\t.\t.\t.\n"));
+          CHECK_FALSE(is_skipped("1\t100\t.\tA\t<*>\t.\t.\t.\n"));
+          CHECK_FALSE(is_skipped("1\t100\t.\tA\tA[2:300[\t.\t.\t.\n"));
+          CHECK_FALSE(is_skipped("1\t100\t.\tA\tC\tInf\t.\t.\n"));
+          CHECK_FALSE(is_skipped("1\t100\t.\tA\tC\t.\t.\t.\tG_T" + samples.substr(6) + "\n"));
+      }
+
+      SECTION("Incomplete lines are parsed")
+      {
+          CHECK_FALSE(is_skipped("1\t100\t.\tA\tC\t.\t.\t."));
+          CHECK_FALSE(is_skipped("1\t100\t.\tA\tC\t.\t.\t." + samples));
+      }
+
+      SECTION("Only the first line is skipped")
+      {
+          std::string lines = "1\t100\t.\tA\tC\t.\t.\t.\n2\t200\t.\tA\tC\t.\t.\t.\n";
+          char const * next = vcf::skip_valid_body_line(lines.data(), lines.data() + lines.size());
+          CHECK(next == lines.data() + lines.find('\n') + 1);
+      }
+  }
+
+  TEST_CASE("Errors found after skipping valid lines", "[line_scanner]")
+  {
+      std::string const header = "##fileformat=VCFv4.3\n"
+                                 "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\tFORMAT\tS1\n";
+      std::string const valid = "1\t100\t.\tA\tC\t.\tPASS\tDP=1\tGT\t0/1\n";
+      std::string const invalid = "1\t101\t.\tA\tC\tq\tPASS\tDP=1\tGT\t0/1\n";
+      std::string const breakend = "1\t102\t.\tA\tA[2:300[\t.\tPASS\tDP=1\tGT\t0/1\n";
+
+      auto source = std::make_shared<vcf::Source>("test.vcf", vcf::InputFormat::VCF_FILE_VCF, vcf::Version::v43);
+      vcf::QuickValidator_v43 validator{source};
+      std::vector<size_t> error_lines;
+      auto parse = [&validator, &error_lines](std::string const & text) {
+          validator.parse(text);
+          for (auto & error : validator.errors()) {
+              error_lines.push_back(error->line);
+          }
+      };
+
+      // the invalid line is split between two blocks the second time
+      parse(header + valid + valid + invalid + breakend + valid);
+      parse(valid + invalid.substr(0, 10));
+      parse(invalid.substr(10) + valid);
+      validator.end();
+
+      CHECK_FALSE(validator.is_valid());
+      CHECK(error_lines == (std::vector<size_t>{5, 9}));
+      CHECK(validator.lines_read() == 10);
+  }
+}
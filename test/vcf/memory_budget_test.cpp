@@ -0,0 +1,157 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include "catch/catch.hpp"
+
+#include "util/block_reader.hpp"
+#include "util/read_ahead_block_reader.hpp"
+#include "vcf/async_report_writer.hpp"
+#include "vcf/hash_record_cache.hpp"
+#include "vcf/memory_budget.hpp"
+#include "vcf/validator.hpp"
+
+namespace ebi
+{
+  size_t const megabyte = 1024 * 1024;
+
+  TEST_CASE("Sizes of a memory budget", "[memory]")
+  {
+      SECTION("No limit keeps the usual sizes")
+      {
+          vcf::MemoryBudget budget;
+          CHECK(budget.limit == 0);
+          CHECK(budget.block_size == util::default_block_size);
+          CHECK(budget.read_ahead_buffers == util::default_read_ahead_buffers);
+          CHECK(budget.record_cache_capacity == vcf::HashRecordCache::default_capacity);
+          CHECK(budget.max_queued_errors == vcf::AsyncReportWriter::default_max_queued_errors);
+      }
+
+      SECTION("A large limit keeps the usual sizes")
+      {
+          vcf::MemoryBudget budget{4096 * megabyte, 1, 1};
+          CHECK(budget.limit == 4096 * megabyte);
+          CHECK(budget.block_size == util::default_block_size);
+          CHECK(budget.record_cache_capacity == vcf::HashRecordCache::default_capacity);
+          CHECK(budget.max_queued_errors == vcf::AsyncReportWriter::default_max_queued_errors);
+      }
+
+      SECTION("A small limit shrinks the buffers and the queues")
+      {
+          vcf::MemoryBudget budget{vcf::MemoryBudget::min_limit, 4, 3};
+          CHECK(budget.block_size < util::default_block_size);
+          CHECK(budget.max_queued_errors < vcf::AsyncReportWriter::default_max_queued_errors);
+          CHECK(budget.max_queued_errors > 0);
+
+          size_t input = (budget.read_ahead_buffers + 2) * budget.block_size;
+          size_t reports = 3 * budget.max_queued_errors * vcf::MemoryBudget::queued_error_size;
+          size_t cache = budget.record_cache_capacity * vcf::MemoryBudget::cached_variant_size;
+          CHECK(vcf::MemoryBudget::base_memory + input + reports + cache <= budget.limit);
+      }
+
+      SECTION("A limit that can't be met is refused")
+      {
+          CHECK_THROWS_AS((vcf::MemoryBudget{vcf::MemoryBudget::min_limit - 1, 1, 1}), std::invalid_argument);
+      }
+  }
+
+  TEST_CASE("High-water marks of a memory budget", "[memory]")
+  {
+      vcf::MemoryBudget budget;
+      budget.record(vcf::MemoryArea::header, 100);
+      budget.record(vcf::MemoryArea::header, 50);
+      CHECK(budget.high_water_mark(vcf::MemoryArea::header) == 100);
+      CHECK(budget.high_water_mark(vcf::MemoryArea::record_cache) == 0);
+
+      std::ostringstream table;
+      budget.write(table);
+      CHECK(table.str().find("header") != std::string::npos);
+      CHECK(table.str().find("peak resident memory") != std::string::npos);
+      CHECK(vcf::MemoryBudget::peak_rss() > 0);
+  }
+
+  TEST_CASE("Memory recorded by a validation", "[memory]")
+  {
+      std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+      std::string path = "test/input_files/v4.3/passed/passed_body_info.vcf";
+
+      for (size_t threads : {1, 3}) {
+          vcf::MemoryBudget budget{64 * megabyte, threads, 1};
+          std::ifstream input{path};
+          CHECK(vcf::is_valid_vcf_file(input, path, vcf::ValidationLevel::warning, outputs, threads, nullptr,
+                                       nullptr, nullptr, &budget));
+
+          CHECK(budget.high_water_mark(vcf::MemoryArea::input_buffers)
+                == (budget.read_ahead_buffers + 2) * budget.block_size);
+          CHECK(budget.high_water_mark(vcf::MemoryArea::header) > 0);
+          CHECK(budget.high_water_mark(vcf::MemoryArea::line_buffers) > 0);
+          CHECK(budget.high_water_mark(vcf::MemoryArea::record_cache) > 0);
+      }
+  }
+
+  TEST_CASE("Duplicates found at the end of a validation", "[memory]")
+  {
+      std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+      std::stringstream vcf;
+      vcf << "##fileformat=VCFv4.3\n"
+             "##contig=<ID=1>\n"
+             "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\n";
+      // the first and last variants are the same, and the position doesn't change so the file is sorted
+      vcf << "1\t100\t.\tA\tT\t.\tPASS\t.\n";
+      for (size_t inserted = 1; inserted <= 100; ++inserted) {
+          vcf << "1\t100\t.\tA\tA" << std::string(inserted, 'C') << "\t.\tPASS\t.\n";
+      }
+      vcf << "1\t100\t.\tA\tT\t.\tPASS\t.\n";
+      std::string contents = vcf.str();
+
+      for (size_t threads : {1, 3}) {
+          vcf::MemoryBudget budget;
+          budget.record_cache_capacity = 1;
+          budget.sorted_run_capacity = 7;
+
+          SECTION("Only the recent variants are compared in memory")
+          {
+              std::istringstream input{contents};
+              CHECK(vcf::is_valid_vcf_file(input, "duplicates.vcf", vcf::ValidationLevel::warning, outputs, threads,
+                                           nullptr, nullptr, nullptr, &budget));
+          }
+
+          SECTION("All the variants are compared when sorted externally")
+          {
+              budget.spill_directory = boost::filesystem::temp_directory_path().string();
+              std::istringstream input{contents};
+              CHECK_FALSE(vcf::is_valid_vcf_file(input, "duplicates.vcf", vcf::ValidationLevel::warning, outputs,
+                                                 threads, nullptr, nullptr, nullptr, &budget));
+          }
+
+          SECTION("The forgotten variants are compared with a filter")
+          {
+              budget.filtered_variants = 100;
+              std::istringstream input{contents};
+              CHECK_FALSE(vcf::is_valid_vcf_file(input, "duplicates.vcf", vcf::ValidationLevel::warning, outputs,
+                                                 threads, nullptr, nullptr, nullptr, &budget));
+          }
+      }
+  }
+}
@@ -2030,4 +2030,87 @@ namespace ebi
                             vcf::MetaSectionError* );
         }
     }
+
+    TEST_CASE("Header schema", "[schema]")
+    {
+        std::shared_ptr<vcf::Source> source{
+            new vcf::Source{
+                "Example VCF source",
+                vcf::InputFormat::VCF_FILE_VCF,
+                vcf::Version::v43,
+                {},
+                { "Sample1" }}};
+
+        source->meta_entries.emplace(vcf::INFO,
+            vcf::MetaEntry{1, vcf::INFO,
+                { { vcf::ID, "XD" }, { vcf::NUMBER, "1" }, { vcf::TYPE, vcf::INTEGER }, { vcf::DESCRIPTION, "Extra depth" } },
+                source});
+        source->meta_entries.emplace(vcf::INFO,
+            vcf::MetaEntry{2, vcf::INFO,
+                { { vcf::ID, "XD" }, { vcf::NUMBER, "2" }, { vcf::TYPE, vcf::FLOAT }, { vcf::DESCRIPTION, "Extra depth" } },
+                source});
+        source->meta_entries.emplace(vcf::FILTER,
+            vcf::MetaEntry{3, vcf::FILTER, { { vcf::ID, "q10" }, { vcf::DESCRIPTION, "Quality below 10" } }, source});
+
+        SECTION("Entries are found by type and ID")
+        {
+            auto dp = source->schema().find(vcf::INFO, "XD");
+            REQUIRE( dp != nullptr );
+            CHECK( dp->id == "XD" );
+            CHECK( dp->number == "1" );
+            CHECK( dp->type == vcf::INTEGER );
+
+            auto filter = source->schema().find(vcf::FILTER, "q10");
+            REQUIRE( filter != nullptr );
+            CHECK( filter->number == "" );
+
+            CHECK( source->schema().find(vcf::FORMAT, "XD") == nullptr );
+            CHECK( source->schema().find(vcf::INFO, "q10") == nullptr );
+        }
+
+        SECTION("FORMAT columns are resolved once")
+        {
+            source->meta_entries.emplace(vcf::FORMAT,
+                vcf::MetaEntry{4, vcf::FORMAT,
+                    { { vcf::ID, "XD" }, { vcf::NUMBER, "1" }, { vcf::TYPE, vcf::INTEGER }, { vcf::DESCRIPTION, "Extra depth" } },
+                    source});
+
+            auto & layout = source->format_layout({ vcf::GT, "XD", vcf::DP, "ZZ" });
+            CHECK( layout.gt_index == 0 );
+            REQUIRE( layout.fields.size() == 4 );
+            CHECK( layout.fields[0] == nullptr );
+            CHECK( layout.predefined[0] != nullptr );
+            CHECK( layout.fields[1] == source->schema().find(vcf::FORMAT, "XD") );
+            CHECK( layout.predefined[1] == nullptr );
+            CHECK( layout.predefined[2]->type == vcf::PredefinedType::INTEGER );
+            CHECK( layout.fields[3] == nullptr );
+            CHECK( layout.predefined[3] == nullptr );
+
+            CHECK( &source->format_layout({ vcf::GT, "XD", vcf::DP, "ZZ" }) == &layout );
+            CHECK( source->format_layout({ "XD", vcf::GT }).gt_index == 1 );
+        }
+
+        SECTION("Entries added later are indexed")
+        {
+            CHECK( source->schema().find(vcf::CONTIG, "chr1") == nullptr );
+            source->meta_entries.emplace(vcf::CONTIG, vcf::MetaEntry{4, vcf::CONTIG, { { vcf::ID, "chr1" } }, source});
+            CHECK( source->schema().find(vcf::CONTIG, "chr1") != nullptr );
+        }
+
+        SECTION("Body sources share the schema without the entries")
+        {
+            auto body = source->body_source();
+            CHECK( body->meta_entries.empty() );
+            CHECK( body->samples_names == source->samples_names );
+            CHECK( &body->schema() == &source->schema() );
+
+            auto copy = std::make_shared<vcf::Source>(*body);
+            CHECK( &copy->schema() == &source->schema() );
+
+            source->meta_entries.emplace(vcf::CONTIG, vcf::MetaEntry{4, vcf::CONTIG, { { vcf::ID, "chr1" } }, source});
+            CHECK( source->schema().find(vcf::CONTIG, "chr1") != nullptr );
+            CHECK( body->schema().find(vcf::CONTIG, "chr1") == nullptr );
+            CHECK( body->schema().find(vcf::INFO, "XD") != nullptr );
+        }
+    }
 }
@@ -379,5 +379,59 @@ namespace ebi
           CHECK((comparison_pad_at_left.first) == (comparison_pad_at_left.second));
       }
   }
+
+  TEST_CASE("Record normalization into a reused buffer", "[normalize]")
+  {
+      std::vector<vcf::NormalizedAllele> alleles;
+
+      SECTION("Ranges of the original alleles")
+      {
+          auto record = build_mock_record({1000, "TCACCC", {"TGACGC", "T"}});
+          vcf::normalize_alleles(record, alleles);
+
+          REQUIRE(alleles.size() == 2);
+          CHECK(alleles[0].position == 1001);
+          CHECK(alleles[0].alternate_index == 0);
+          CHECK(alleles[0].reference_begin == 1);
+          CHECK(alleles[0].reference_length == 4);
+          CHECK(alleles[0].alternate_begin == 1);
+          CHECK(alleles[0].alternate_length == 4);
+          CHECK(alleles[1].alternate_index == 1);
+          CHECK(alleles[1].alternate_length == 0);
+          CHECK((vcf::make_record_core(record, alleles[0])) == (vcf::RecordCore{1, "1", 1001, "CACC", "GACG"}));
+      }
+      SECTION("Same results as the RecordCores")
+      {
+          std::vector<TestMultiRecord> origins{{1000, "GT", {"GTGT", "GTT"}},
+                                               {1000, "GTT", {"GT", "G"}},
+                                               {10040, "TGACGTAACGATT", {"T", "TGACGTAACGGTT", "TGACGTAATAC"}}};
+          for (auto & origin : origins) {
+              auto record = build_mock_record(origin);
+
+              vcf::normalize_alleles(record, alleles);
+              auto record_cores = vcf::normalize(record);
+              REQUIRE(alleles.size() == record_cores.size());
+              for (size_t i = 0; i < alleles.size(); ++i) {
+                  CHECK((vcf::make_record_core(record, alleles[i])) == (record_cores[i]));
+                  CHECK(vcf::same_variant(record_cores[i], record, alleles[i]));
+              }
+
+              vcf::normalize_alleles_right_alignment(record, alleles);
+              record_cores = vcf::normalize_right_alignment(record);
+              REQUIRE(alleles.size() == record_cores.size());
+              for (size_t i = 0; i < alleles.size(); ++i) {
+                  CHECK((vcf::make_record_core(record, alleles[i])) == (record_cores[i]));
+              }
+          }
+      }
+      SECTION("Different variants")
+      {
+          auto record = build_mock_record({1000, "TCACCC", {"TGACGC"}});
+          vcf::normalize_alleles(record, alleles);
+          CHECK_FALSE(vcf::same_variant({1, "1", 1001, "CACC", "GACC"}, record, alleles[0]));
+          CHECK_FALSE(vcf::same_variant({1, "1", 1000, "CACC", "GACG"}, record, alleles[0]));
+          CHECK_FALSE(vcf::same_variant({1, "2", 1001, "CACC", "GACG"}, record, alleles[0]));
+      }
+  }
 }
 
@@ -0,0 +1,115 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <clocale>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "catch/catch.hpp"
+
+#include "util/number_utils.hpp"
+
+namespace ebi
+{
+  namespace
+  {
+    std::vector<std::string> const numbers{
+        "", ".", "-", "+", " ", "0", "-0", "+7", "12", "-12", "007", " 42", "\t-3", "12abc", "1.5", "-0.25", "3.",
+        ".5", "+.5", "1e5", "1E-3", "0.000001", "123456789012345", "1234567890123456", "0.1234567890123456789",
+        "2147483647", "2147483648", "-2147483648", "-2147483649", "99999999999999999999", "1e39", "1e-40",
+        "1e-4000", "1e5000", "inf", "-nan", "0x1A", "abc", "1..2", "1.2.3", "--1", ":1",
+    };
+  }
+
+  TEST_CASE("Numbers parsed like the standard library", "[number_utils]")
+  {
+      for (auto & number : numbers) {
+          INFO("Number: '" << number << "'");
+
+          int expected_int = 0;
+          bool valid_int = true;
+          try {
+              expected_int = std::stoi(number);
+          } catch (std::logic_error const &) {
+              valid_int = false;
+          }
+          int parsed_int = 0;
+          CHECK(util::parse_int(number, parsed_int) == valid_int);
+          if (valid_int) {
+              CHECK(parsed_int == expected_int);
+          }
+
+          float expected_float = 0;
+          bool valid_float = true;
+          try {
+              expected_float = std::stof(number);
+          } catch (std::logic_error const &) {
+              valid_float = false;
+          }
+          float parsed_float = 0;
+          CHECK(util::parse_float(number, parsed_float) == valid_float);
+          if (valid_float && expected_float == expected_float) {
+              CHECK(parsed_float == expected_float);
+          }
+
+          long double expected_long_double = 0;
+          bool valid_long_double = true;
+          try {
+              expected_long_double = std::stold(number);
+          } catch (std::logic_error const &) {
+              valid_long_double = false;
+          }
+          long double parsed_long_double = 0;
+          CHECK(util::parse_long_double(number, parsed_long_double) == valid_long_double);
+          if (valid_long_double && expected_long_double == expected_long_double) {
+              // the plain decimals are converted with the precision of a double
+              CHECK(static_cast<double>(parsed_long_double) == static_cast<double>(expected_long_double));
+          }
+      }
+  }
+
+  TEST_CASE("Numbers parsed with a decimal point in any locale", "[number_utils]")
+  {
+      // only checked if one of these locales, whose decimal separator is a comma, is installed
+      std::string previous_locale = std::setlocale(LC_NUMERIC, nullptr);
+      bool comma_locale = false;
+      for (char const * name : {"de_DE.UTF-8", "de_DE.utf8", "de_DE", "fr_FR.UTF-8", "fr_FR.utf8", "fr_FR"}) {
+          if (std::setlocale(LC_NUMERIC, name) != nullptr) {
+              comma_locale = true;
+              break;
+          }
+      }
+      if (!comma_locale) {
+          WARN("No locale with a decimal comma is installed");
+          return;
+      }
+
+      // these have exponents or long mantissas, so they are not converted directly
+      float parsed_float = 0;
+      CHECK(util::parse_float("1.5e2", parsed_float));
+      CHECK(parsed_float == 150.0f);
+      long double parsed_long_double = 0;
+      CHECK(util::parse_long_double("0.1234567890123456789", parsed_long_double));
+      CHECK(static_cast<double>(parsed_long_double) == 0.1234567890123456789);
+
+      // the comma is not a decimal separator, so the number ends before it
+      CHECK(util::parse_float("2,5e1", parsed_float));
+      CHECK(parsed_float == 2.0f);
+
+      std::setlocale(LC_NUMERIC, previous_locale.c_str());
+  }
+}
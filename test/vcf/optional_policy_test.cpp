@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 
+#include <memory>
+
 #include "catch/catch.hpp"
 
 #include "vcf/error.hpp"
@@ -21,7 +23,19 @@
 
 namespace ebi
 {
-    
+    namespace
+    {
+      /**
+       * Takes ownership of the warning returned by a check, and tells whether it has the expected type
+       */
+      template <typename T>
+      bool is_warning(vcf::Error * warning)
+      {
+          std::unique_ptr<vcf::Error> owned{warning};
+          return dynamic_cast<T *>(owned.get()) != nullptr;
+      }
+    }
+
     TEST_CASE("Info predefined tags warnings", "[body info warnings]")
     {
         std::shared_ptr<vcf::Source> source{
@@ -90,7 +104,7 @@ namespace ebi
                         source
                 });
 
-                CHECK_NOTHROW( (optional_policy.optional_check_body_entry(parsing_state, vcf::Record{
+                CHECK( (optional_policy.optional_check_body_entry(parsing_state, vcf::Record{
                                     1,
                                     "chr1",
                                     123456,
@@ -102,9 +116,9 @@ namespace ebi
                                     { { confidence_interval_tag, "0,0" } },
                                     { vcf::GT },
                                     { "1|0" },
-                                    source})) );
+                                    source}) == nullptr) );
 
-                CHECK_THROWS_AS( (optional_policy.optional_check_body_entry(parsing_state, vcf::Record{
+                CHECK( (is_warning<vcf::InfoBodyError>(optional_policy.optional_check_body_entry(parsing_state, vcf::Record{
                                     1,
                                     "chr1",
                                     123456,
@@ -116,10 +130,9 @@ namespace ebi
                                     { { confidence_interval_tag, "1,2" } },
                                     { vcf::GT },
                                     { "0|1" },
-                                    source})),
-                                vcf::InfoBodyError*);
+                                    source}))) );
 
-                CHECK_THROWS_AS( (optional_policy.optional_check_body_entry(parsing_state, vcf::Record{
+                CHECK( (is_warning<vcf::InfoBodyError>(optional_policy.optional_check_body_entry(parsing_state, vcf::Record{
                                     1,
                                     "chr1",
                                     123456,
@@ -131,8 +144,7 @@ namespace ebi
                                     { { confidence_interval_tag, "-1,-2" } },
                                     { vcf::GT },
                                     { "0|1" },
-                                    source})),
-                                vcf::InfoBodyError*);
+                                    source}))) );
             }
         }
     }
@@ -240,7 +252,7 @@ namespace ebi
 
         SECTION("gVCF fields should have INFO END")
         {
-            CHECK_NOTHROW( (optional_policy.optional_check_body_entry(parsing_state2, vcf::Record{
+            CHECK( (optional_policy.optional_check_body_entry(parsing_state2, vcf::Record{
                                 1,
                                 "chr1",
                                 123456,
@@ -252,9 +264,9 @@ namespace ebi
                                 { { vcf::END, "2" } },
                                 { "XYZ" },
                                 { "11" },
-                                sources[1]})) );
+                                sources[1]}) == nullptr) );
 
-             CHECK_THROWS_AS( (optional_policy.optional_check_body_entry(parsing_state2, vcf::Record{
+             CHECK( (is_warning<vcf::InfoBodyError>(optional_policy.optional_check_body_entry(parsing_state2, vcf::Record{
                                 1,
                                 "chr1",
                                 123456,
@@ -266,13 +278,12 @@ namespace ebi
                                 { { "ABC", "7" } },
                                 { "XYZ" },
                                 { "7" },
-                                sources[1]})),
-                            vcf::InfoBodyError*);
+                                sources[1]}))) );
         }
 
         SECTION("gVCF fields should have 0/0 genotype")
         {
-            CHECK_NOTHROW( (optional_policy.optional_check_body_entry(parsing_state1, vcf::Record{
+            CHECK( (optional_policy.optional_check_body_entry(parsing_state1, vcf::Record{
                                 1,
                                 "chr1",
                                 123456,
@@ -284,9 +295,9 @@ namespace ebi
                                 { { vcf::END, "0" } },
                                 { vcf::GT, "XYZ" },
                                 { "0", "1:9" },
-                                sources[0]})) );
+                                sources[0]}) == nullptr) );
 
-            CHECK_NOTHROW( (optional_policy.optional_check_body_entry(parsing_state3, vcf::Record{
+            CHECK( (optional_policy.optional_check_body_entry(parsing_state3, vcf::Record{
                                 1,
                                 "chr1",
                                 123456,
@@ -298,9 +309,9 @@ namespace ebi
                                 { { vcf::END, "0" } },
                                 { vcf::GT, "XYZ" },
                                 { "0|0/0:12", "1|0|1:5" },
-                                sources[2]})) );
+                                sources[2]}) == nullptr) );
 
-            CHECK_NOTHROW( (optional_policy.optional_check_body_entry(parsing_state2, vcf::Record{
+            CHECK( (optional_policy.optional_check_body_entry(parsing_state2, vcf::Record{
                                 1,
                                 "chr1",
                                 123456,
@@ -312,9 +323,9 @@ namespace ebi
                                 { { vcf::END, "0" } },
                                 { vcf::GT },
                                 { "0/0" },
-                                sources[1]})) );
+                                sources[1]}) == nullptr) );
 
-            CHECK_NOTHROW( (optional_policy.optional_check_body_entry(parsing_state2, vcf::Record{
+            CHECK( (optional_policy.optional_check_body_entry(parsing_state2, vcf::Record{
                                 1,
                                 "chr1",
                                 123456,
@@ -326,9 +337,9 @@ namespace ebi
                                 { { vcf::END, "0" } },
                                 { "XYZ" },
                                 { "15" },
-                                sources[1]})) );
+                                sources[1]}) == nullptr) );
 
-            CHECK_THROWS_AS( (optional_policy.optional_check_body_entry(parsing_state2, vcf::Record{
+            CHECK( (is_warning<vcf::AlternateAllelesBodyError>(optional_policy.optional_check_body_entry(parsing_state2, vcf::Record{
                                 1,
                                 "chr1",
                                 123456,
@@ -340,8 +351,65 @@ namespace ebi
                                 { { vcf::END, "0" } },
                                 { vcf::GT },
                                 { "0|1" },
-                                sources[1]})),
-                            vcf::AlternateAllelesBodyError*);
+                                sources[1]}))) );
+        }
+    }
+
+    TEST_CASE("Meta definitions warnings", "[body meta warnings]")
+    {
+        std::shared_ptr<vcf::Source> source{
+            new vcf::Source{
+                "Example VCF source",
+                vcf::InputFormat::VCF_FILE_VCF | vcf::InputFormat::VCF_FILE_BGZIP,
+                vcf::Version::v43,
+                {},
+                { "Sample1" }}};
+
+        source->meta_entries.emplace(vcf::REFERENCE, vcf::MetaEntry{1, vcf::REFERENCE, "file", source});
+        source->meta_entries.emplace(vcf::CONTIG, vcf::MetaEntry{2, vcf::CONTIG, { { vcf::ID, "chr1" } }, source});
+        source->meta_entries.emplace(vcf::ALT,
+            vcf::MetaEntry{3, vcf::ALT, { { vcf::ID, "DEL:ME" }, { vcf::DESCRIPTION, "Deletion of an element" } },
+                           source});
+        source->meta_entries.emplace(vcf::FILTER,
+            vcf::MetaEntry{4, vcf::FILTER, { { vcf::ID, "q10" }, { vcf::DESCRIPTION, "Quality below 10" } }, source});
+        source->meta_entries.emplace(vcf::INFO,
+            vcf::MetaEntry{5, vcf::INFO,
+                { { vcf::ID, "XD" }, { vcf::NUMBER, "1" }, { vcf::TYPE, vcf::INTEGER }, { vcf::DESCRIPTION, "Depth" } },
+                source});
+        source->meta_entries.emplace(vcf::FORMAT,
+            vcf::MetaEntry{6, vcf::FORMAT,
+                { { vcf::ID, vcf::GT }, { vcf::NUMBER, "1" }, { vcf::TYPE, vcf::STRING }, { vcf::DESCRIPTION, "Genotype" } },
+                source});
+
+        vcf::ParsingState parsing_state{source};
+        vcf::ValidateOptionalPolicy optional_policy;
+
+        auto check = [&](std::string const & chromosome, std::vector<std::string> const & alternates,
+                         std::vector<std::string> const & filters, std::multimap<std::string, std::string> const & info,
+                         std::vector<std::string> const & format, std::vector<std::string> const & samples) {
+            return optional_policy.optional_check_body_entry(parsing_state, vcf::Record{
+                    7, chromosome, 123456, { "id123" }, "A", alternates, 1.0, filters, info, format, samples, source});
+        };
+
+        SECTION("Every ID described")
+        {
+            for (int i = 0; i < 2; ++i) {
+                CHECK( check("chr1", { "<DEL:ME>" }, { "q10" }, { { "XD", "3" } }, { vcf::GT }, { "0|1" }) == nullptr );
+            }
+        }
+
+        SECTION("IDs not described")
+        {
+            CHECK( is_warning<vcf::NoMetaDefinitionError>(
+                    check("chr2", { "C" }, { vcf::PASS }, { { "XD", "3" } }, { vcf::GT }, { "0|1" })) );
+            CHECK( is_warning<vcf::NoMetaDefinitionError>(
+                    check("chr1", { "<INS:ME>" }, { vcf::PASS }, { { "XD", "3" } }, { vcf::GT }, { "0|1" })) );
+            CHECK( is_warning<vcf::NoMetaDefinitionError>(
+                    check("chr1", { "C" }, { "q10", "q20" }, { { "XD", "3" } }, { vcf::GT }, { "0|1" })) );
+            CHECK( is_warning<vcf::NoMetaDefinitionError>(
+                    check("chr1", { "C" }, { vcf::PASS }, { { "XD", "3" }, { "YD", "3" } }, { vcf::GT }, { "0|1" })) );
+            CHECK( is_warning<vcf::NoMetaDefinitionError>(
+                    check("chr1", { "C" }, { vcf::PASS }, { { "XD", "3" } }, { vcf::GT, "ZD" }, { "0|1:3" })) );
         }
     }
 }
@@ -49,6 +49,17 @@ namespace ebi
       }
   }
 
+  TEST_CASE("Gzipped and BGZF files are decompressed", "[compressed]")
+  {
+      CHECK(is_valid("test/input_files/v4.3/gzip_files/passed_gzip.vcf.gz"));
+      CHECK(is_valid("test/input_files/v4.3/gzip_files/passed_bgzip.vcf.gz"));
+      CHECK_FALSE(is_valid("test/input_files/v4.3/gzip_files/failed_gzip.vcf.gz"));
+
+      std::ifstream input{"test/input_files/v4.3/gzip_files/passed_bgzip.vcf.gz"};
+      std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> outputs;
+      CHECK(vcf::is_valid_vcf_file(input, "passed_bgzip.vcf.gz", vcf::ValidationLevel::warning, outputs, 3));
+  }
+
   TEST_CASE("Files that pass the validation under specification v4.3", "[passed]")
   {
       auto folder = boost::filesystem::path("test/input_files/v4.3/passed");
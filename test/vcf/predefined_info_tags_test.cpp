@@ -15,6 +15,7 @@
  */
 
 #include <memory>
+#include <string>
 
 #include "catch/catch.hpp"
 
@@ -1130,4 +1131,40 @@ namespace ebi
                         vcf::InfoBodyError*);
         }
     }
+
+    TEST_CASE("Predefined tags tables", "[record][keyvalue]")
+    {
+        for (vcf::PredefinedTagTable const * table : {&vcf::info_v41_v42, &vcf::info_v43, &vcf::format_v41_v42,
+                                                      &vcf::format_v43}) {
+            for (auto & tag : *table) {
+                std::string id{tag.id, tag.id_size};
+                CHECK( table->find(id) == &tag );
+                CHECK( table->find(id + "X") == nullptr );
+                auto suffix = table->find(id.substr(1));
+                CHECK( (suffix == nullptr || std::string{suffix->id, suffix->id_size} == id.substr(1)) );
+            }
+            CHECK( table->find("") == nullptr );
+        }
+
+        auto tag = vcf::info_v43.find(vcf::AD);
+        REQUIRE( tag != nullptr );
+        CHECK( tag->type == vcf::PredefinedType::INTEGER );
+        CHECK( std::string{tag->number} == vcf::R );
+        CHECK( tag->cardinality.kind == vcf::Cardinality::Kind::R );
+        CHECK( vcf::info_v41_v42.find(vcf::AD) == nullptr );
+
+        tag = vcf::info_v43.find(vcf::MEINFO);
+        REQUIRE( tag != nullptr );
+        CHECK( tag->type == vcf::PredefinedType::STRING );
+        CHECK( tag->cardinality.kind == vcf::Cardinality::Kind::FIXED );
+        CHECK( tag->cardinality.value == 4 );
+
+        tag = vcf::format_v43.find(vcf::CNL);
+        REQUIRE( tag != nullptr );
+        CHECK( tag->cardinality.kind == vcf::Cardinality::Kind::G );
+        tag = vcf::format_v41_v42.find(vcf::CNL);
+        REQUIRE( tag != nullptr );
+        CHECK( tag->cardinality.kind == vcf::Cardinality::Kind::UNKNOWN );
+        CHECK( vcf::type_name(vcf::info_v43.find(vcf::MQ)->type) == vcf::MISSING_VALUE );
+    }
 }
@@ -0,0 +1,87 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "catch/catch.hpp"
+
+#include "vcf/profile_policy.hpp"
+#include "vcf/report_writer.hpp"
+#include "vcf/validator.hpp"
+#include "test_utils.hpp"
+
+namespace ebi
+{
+  bool is_valid_profiled(std::string const & path, vcf::Profile & profile, size_t threads = 1)
+  {
+      std::ifstream input{path};
+      std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+      outputs.emplace_back(new vcf::ProfiledReportWriter{
+              std::unique_ptr<vcf::ReportWriter>{new CollectingReportWriter{}}, profile});
+      return vcf::is_valid_vcf_file(input, path, vcf::ValidationLevel::warning, outputs, threads, nullptr, &profile);
+  }
+
+  TEST_CASE("Profile of a validation", "[profile]")
+  {
+      vcf::Profile profile;
+
+      SECTION("Every record is measured once per check")
+      {
+          CHECK(is_valid_profiled("test/input_files/v4.3/passed/passed_body_info.vcf", profile));
+
+          CHECK(profile.calls(vcf::ProfiledStep::parsing) > 0);
+          CHECK(profile.calls(vcf::ProfiledStep::check_chromosome) == 51);
+          CHECK(profile.calls(vcf::ProfiledStep::check_info) == 51);
+          CHECK(profile.calls(vcf::ProfiledStep::check_samples) == 51);
+          CHECK(profile.calls(vcf::ProfiledStep::check_duplicates) == 51);
+          CHECK(profile.calls(vcf::ProfiledStep::check_body_entry_position_zero) == 51);
+          CHECK(profile.calls(vcf::ProfiledStep::optional_check_meta_section) == 1);
+      }
+
+      SECTION("The checks run by several threads are added up")
+      {
+          CHECK(is_valid_profiled("test/input_files/v4.3/passed/passed_body_info.vcf", profile, 4));
+
+          CHECK(profile.calls(vcf::ProfiledStep::check_info) == 51);
+          CHECK(profile.calls(vcf::ProfiledStep::check_duplicates) == 51);
+      }
+
+      SECTION("The reports are measured when they are written")
+      {
+          CHECK_FALSE(is_valid_profiled("test/input_files/v4.3/failed/failed_body_alt_000.vcf", profile));
+
+          CHECK(profile.calls(vcf::ProfiledStep::report_writing) > 0);
+      }
+
+      SECTION("Only the steps that were run are listed")
+      {
+          profile.add(vcf::ProfiledStep::check_quality, std::chrono::milliseconds{2});
+          profile.add(vcf::ProfiledStep::check_quality, std::chrono::milliseconds{1});
+
+          std::ostringstream table;
+          profile.write(table);
+          std::string text = table.str();
+          CHECK(text.find("Record::check_quality") != std::string::npos);
+          CHECK(text.find("Record::check_info") == std::string::npos);
+          CHECK(profile.calls(vcf::ProfiledStep::check_quality) == 2);
+          CHECK(profile.time(vcf::ProfiledStep::check_quality) == std::chrono::milliseconds{3});
+      }
+  }
+}
@@ -0,0 +1,110 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include "catch/catch.hpp"
+
+#include "util/block_reader.hpp"
+#include "vcf/progress.hpp"
+#include "vcf/validator.hpp"
+
+namespace ebi
+{
+  TEST_CASE("Progress of a validation", "[progress]")
+  {
+      std::vector<vcf::Progress> calls;
+      vcf::ProgressMonitor monitor{[&calls](vcf::Progress const & progress) { calls.push_back(progress); },
+                                   std::chrono::seconds{0}};
+      std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+
+      SECTION("Every block is reported with no interval, and then the end")
+      {
+          std::string path = "test/input_files/v4.3/passed/passed_body_info.vcf";
+          std::ifstream input{path};
+          util::StreamBlockReader reader{input, 1024};
+          CHECK(vcf::is_valid_vcf_file(reader, path, vcf::ValidationLevel::warning, outputs, 1, nullptr, nullptr,
+                                       &monitor));
+
+          auto size = boost::filesystem::file_size(path);
+          REQUIRE(calls.size() > 2);
+          CHECK_FALSE(calls[calls.size() - 2].finished);
+          vcf::Progress const & last = calls.back();
+          CHECK(last.finished);
+          CHECK(last.lines == 63);
+          CHECK(last.bytes == size);
+          CHECK(last.input_bytes == size);
+          CHECK(last.input_size == 0);
+          CHECK(last.contig == "19");
+          CHECK(last.position == 100);
+          CHECK(last.errors == 0);
+      }
+
+      SECTION("The errors are counted and the size of a mapped file is known")
+      {
+          std::string path = "test/input_files/v4.3/failed/failed_body_alt_000.vcf";
+          util::MappedFileBlockReader reader{path};
+          CHECK_FALSE(vcf::is_valid_vcf_file(reader, path, vcf::ValidationLevel::warning, outputs, 1, nullptr,
+                                             nullptr, &monitor));
+
+          REQUIRE_FALSE(calls.empty());
+          vcf::Progress const & last = calls.back();
+          CHECK(last.finished);
+          CHECK(last.errors == 1);
+          CHECK(last.input_size == boost::filesystem::file_size(path));
+          CHECK(last.input_bytes == last.input_size);
+      }
+
+      SECTION("Only the end is reported if the interval never passes")
+      {
+          vcf::ProgressMonitor slow_monitor{[&calls](vcf::Progress const & progress) { calls.push_back(progress); }};
+          std::string path = "test/input_files/v4.3/passed/passed_body_info.vcf";
+          std::ifstream input{path};
+          util::StreamBlockReader reader{input, 1024};
+          CHECK(vcf::is_valid_vcf_file(reader, path, vcf::ValidationLevel::error, outputs, 1, nullptr, nullptr,
+                                       &slow_monitor));
+
+          REQUIRE(calls.size() == 1);
+          CHECK(calls[0].finished);
+          CHECK(calls[0].lines == 63);
+          CHECK(calls[0].contig.empty());
+      }
+  }
+
+  TEST_CASE("Progress line", "[progress]")
+  {
+      vcf::Progress progress{1000, 50000000, 25000000, 100000000, "20", 123456, 2, 3, std::chrono::seconds{10},
+                             false};
+
+      CHECK(progress.megabytes_per_second() == Approx(5.0));
+      REQUIRE(progress.has_eta());
+      CHECK(progress.eta() == std::chrono::seconds{30});
+
+      std::ostringstream line;
+      line << progress;
+      CHECK(line.str() == "1000 lines, 50.0 MB (25.0% of the input), at 20:123456, 5.0 MB/s, 2 errors, "
+                          "3 warnings, ETA 0:00:30");
+
+      progress.finished = true;
+      CHECK_FALSE(progress.has_eta());
+  }
+}
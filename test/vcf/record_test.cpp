@@ -18,6 +18,7 @@
 
 #include "catch/catch.hpp"
 
+#include "util/worker_pool.hpp"
 #include "vcf/file_structure.hpp"
 #include "vcf/error.hpp"
 
@@ -132,6 +133,35 @@ namespace ebi
                                 source}) );
         }
 
+        SECTION("Reused record")
+        {
+            vcf::Record record{
+                    1,
+                    "chr1",
+                    123456,
+                    { "id123", "id456" },
+                    "A",
+                    { "AC", "AT" },
+                    1.0,
+                    { vcf::PASS },
+                    { {vcf::AN, "12"}, {vcf::AF, "0.5,0.3"} },
+                    { vcf::GT, vcf::DP },
+                    { "0|1" },
+                    source};
+
+            record.assign(2, "chr2", 123457, { "id789" }, "A", { "T" }, 2.0, { vcf::PASS }, { {vcf::AN, "12"} },
+                          { vcf::GT }, { "0|1" }, source.get());
+
+            CHECK(record == (vcf::Record{2, "chr2", 123457, { "id789" }, "A", { "T" }, 2.0, { vcf::PASS },
+                                         { {vcf::AN, "12"} }, { vcf::GT }, { "0|1" }, source}));
+            CHECK(record.line == 2);
+            CHECK(record.types == std::vector<vcf::RecordType>{vcf::RecordType::SNV});
+
+            CHECK_THROWS_AS( record.assign(3, "chr:3", 123458, { "id789" }, "A", { "T" }, 2.0, { vcf::PASS },
+                                           { {vcf::AN, "12"} }, { vcf::GT }, { "0|1" }, source.get()),
+                             vcf::ChromosomeBodyError*);
+        }
+
         SECTION("Chromosome with whitespaces") 
         {
             CHECK_THROWS_AS( (vcf::Record{
@@ -860,5 +890,184 @@ namespace ebi
                             source}),
                         vcf::InfoBodyError*);
         }
+
+        SECTION("Long INFO values checked without splitting them")
+        {
+            size_t n_values = vcf::Record::long_info_value_size / 4;
+            std::string sequence(vcf::Record::long_info_value_size, 'A');
+            std::string frequencies;
+            std::string cigars;
+            for (size_t i = 0; i < n_values; ++i) {
+                frequencies += "0.5,";
+                cigars += "10M";
+            }
+            auto record = [&](std::multimap<std::string, std::string> const & info) {
+                return vcf::Record{1, "chr1", 123456, { "id123" }, "A", { "AC", "AT" }, 1.0, { vcf::PASS },
+                                   info, { vcf::GT }, { "0|1" }, source};
+            };
+
+            CHECK_NOTHROW( record({ {vcf::AA, sequence}, {vcf::AF, "0.5,0.3"} }) );
+            CHECK_NOTHROW( record({ {vcf::CIGAR, "1M," + cigars} }) );
+            CHECK_THROWS_AS( record({ {vcf::AF, frequencies + "0.5"} }), vcf::InfoBodyError* );
+            CHECK_THROWS_AS( record({ {vcf::AF, sequence} }), vcf::InfoBodyError* );
+            CHECK_THROWS_AS( record({ {vcf::AA, sequence + ","} }), vcf::InfoBodyError* );
+            CHECK_THROWS_AS( record({ {vcf::CIGAR, "1M," + cigars + "!"} }), vcf::InfoBodyError* );
+            CHECK_THROWS_AS( record({ {vcf::AN, "1," + sequence} }), vcf::InfoBodyError* );
+        }
+    }
+
+    TEST_CASE("Record with many samples checked in several threads", "[constructor]")
+    {
+        size_t n_samples = vcf::Record::parallel_samples_threshold * 2;
+        std::vector<std::string> names;
+        for (size_t i = 0; i < n_samples; ++i) {
+            names.push_back("Sample" + std::to_string(i + 1));
+        }
+        std::shared_ptr<vcf::Source> source{
+            new vcf::Source{
+                "Example VCF source",
+                vcf::InputFormat::VCF_FILE_VCF,
+                vcf::Version::v43,
+                {},
+                names}};
+
+        source->meta_entries.emplace(vcf::FORMAT,
+            vcf::MetaEntry{
+                1,
+                vcf::FORMAT,
+                {
+                    { vcf::ID, vcf::DP },
+                    { vcf::NUMBER, "1" },
+                    { vcf::TYPE, vcf::INTEGER },
+                    { vcf::DESCRIPTION, "Read depth" }
+                },
+                source
+        });
+
+        util::WorkerPool workers{4};
+        std::vector<std::string> samples(n_samples, "0|1:10");
+
+        // returns the message of the error thrown, or an empty string if the record is valid
+        auto check = [&](util::WorkerPool * pool) {
+            vcf::Record record;
+            record.assign_unchecked(1, "chr1", 123456, { "id123" }, "A", { "C" }, 1.0, { vcf::PASS },
+                                    { {vcf::AN, "12"} }, { vcf::GT, vcf::DP }, samples, source.get());
+            try {
+                record.check(source->format_layout(record.format), pool);
+            } catch (vcf::Error * error) {
+                std::unique_ptr<vcf::Error> owned{error};
+                return std::string{error->what()};
+            }
+            return std::string{};
+        };
+
+        SECTION("Valid samples")
+        {
+            CHECK(check(nullptr) == "");
+            CHECK(check(&workers) == "");
+        }
+
+        SECTION("First failing sample")
+        {
+            samples[n_samples - 10] = "0|1:x";
+            samples[n_samples / 3] = "0|1:10:5";
+            samples[n_samples / 3 + 1] = "0|1:x";
+
+            std::string serial = check(nullptr);
+            CHECK(serial.find("Sample #" + std::to_string(n_samples / 3 + 1) + " ") != std::string::npos);
+            CHECK(check(&workers) == serial);
+
+            vcf::Record record;
+            record.assign_unchecked(1, "chr1", 123456, { "id123" }, "A", { "C" }, 1.0, { vcf::PASS },
+                                    { {vcf::AN, "12"} }, { vcf::GT, vcf::DP }, samples, source.get());
+            CHECK_THROWS_AS(record.check(source->format_layout(record.format), &workers), vcf::SamplesBodyError*);
+        }
+    }
+
+    TEST_CASE("Record with unsplit samples", "[constructor]")
+    {
+        std::shared_ptr<vcf::Source> source{
+            new vcf::Source{
+                "Example VCF source",
+                vcf::InputFormat::VCF_FILE_VCF,
+                vcf::Version::v43,
+                {},
+                { "Sample1", "Sample2", "Sample3" }}};
+
+        source->meta_entries.emplace(vcf::FORMAT,
+            vcf::MetaEntry{
+                1,
+                vcf::FORMAT,
+                {
+                    { vcf::ID, vcf::DP },
+                    { vcf::NUMBER, "1" },
+                    { vcf::TYPE, vcf::INTEGER },
+                    { vcf::DESCRIPTION, "Read depth" }
+                },
+                source
+        });
+
+        vcf::Record record;
+        auto assign = [&](std::string const & samples) {
+            record.assign_unchecked(1, "chr1", 123456, { "id123" }, "A", { "C" }, 1.0, { vcf::PASS },
+                                    { {vcf::AN, "12"} }, { vcf::GT, vcf::DP }, {}, source.get());
+            record.unsplit_samples = samples;
+        };
+        auto validate = [&](unsigned checks) {
+            std::unique_ptr<vcf::Error> error{record.validate(source->format_layout(record.format), nullptr, nullptr,
+                                                              checks)};
+            return error == nullptr;
+        };
+
+        SECTION("Split on demand")
+        {
+            assign("0|1:10\t0|0:\t1|1:3");
+            CHECK(record.n_samples() == 3);
+            CHECK(record.samples.empty());
+
+            record.split_samples();
+            CHECK(record.samples == (std::vector<std::string>{"0|1:10", "0|0:", "1|1:3"}));
+            CHECK(record.unsplit_samples.empty());
+            CHECK(record.n_samples() == 3);
+        }
+
+        SECTION("Only counted without the checks of the samples")
+        {
+            assign("0|1:x\t0|0:1\t1|1:3");
+            CHECK(validate(vcf::RECORD_CHECK_FIELDS));
+            CHECK(record.samples.empty());
+            CHECK_FALSE(validate(vcf::RECORD_CHECK_ALL));
+
+            assign("0|1:10\t0|0:1");
+            CHECK_FALSE(validate(vcf::RECORD_CHECK_FIELDS));
+            CHECK(validate(0));
+        }
+    }
+
+    TEST_CASE("Cardinality of the fields", "[constructor]")
+    {
+        SECTION("Parsed from the Number")
+        {
+            using Kind = vcf::Cardinality::Kind;
+            CHECK(vcf::Cardinality::parse(vcf::A).kind == Kind::A);
+            CHECK(vcf::Cardinality::parse(vcf::R).kind == Kind::R);
+            CHECK(vcf::Cardinality::parse(vcf::G).kind == Kind::G);
+            CHECK(vcf::Cardinality::parse(".").kind == Kind::UNKNOWN);
+            CHECK(vcf::Cardinality::parse("0").kind == Kind::FIXED);
+            CHECK(vcf::Cardinality::parse("12").value == 12);
+            CHECK(vcf::Cardinality::parse("-1").kind == Kind::INVALID);
+            CHECK(vcf::Cardinality::parse("X").kind == Kind::INVALID);
+        }
+
+        SECTION("Possible genotypes memoized by ploidy")
+        {
+            vcf::GenotypeCounts counts;
+            CHECK(counts.count(2, 2) == 6);
+            CHECK(counts.count(2, 1) == 3);
+            CHECK(counts.count(2, 2) == 6);
+            CHECK(counts.count(1, 2) == 3);
+            CHECK(counts.count(1, 3) == 4);
+            CHECK(counts.count(1, 100) == vcf::GenotypeCounts::compute(1, 100));
+        }
     }
 }
@@ -0,0 +1,380 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "catch/catch.hpp"
+
+#include "util/bgzf_writer.hpp"
+#include "util/gzip_block_reader.hpp"
+#include "vcf/region_index.hpp"
+#include "vcf/validator.hpp"
+#include "test_utils.hpp"
+
+namespace ebi
+{
+  namespace
+  {
+    std::string const regions_folder = "test/input_files/v4.3/regions/";
+
+    /**
+     * "contig:position" of the records read in some regions, with an index that may not be next to the file
+     */
+    std::vector<std::string> read_indexed_records(std::string const & path, std::string const & index_path,
+                                                  std::vector<std::string> const & texts)
+    {
+        std::vector<vcf::Region> regions;
+        for (auto & text : texts) {
+            regions.push_back(vcf::parse_region(text));
+        }
+        util::MappedFileBlockReader input{path};
+        vcf::RegionIndex index{index_path};
+        vcf::RegionBlockReader reader{input.contents(), index, regions, 64};
+
+        std::vector<std::string> records;
+        std::vector<char> line;
+        while (!reader.readline(line).empty()) {
+            std::string record{line.begin(), line.end()};
+            size_t position_end = record.find('\t', record.find('\t') + 1);
+            records.push_back(record.substr(0, position_end).replace(record.find('\t'), 1, ":"));
+        }
+        return records;
+    }
+
+    std::vector<std::string> read_records(std::string const & file, std::vector<std::string> const & texts)
+    {
+        return read_indexed_records(regions_folder + file, vcf::RegionIndex::find(regions_folder + file), texts);
+    }
+
+    bool is_valid_in_regions(std::vector<std::string> const & texts, std::vector<size_t> & error_lines)
+    {
+        std::vector<vcf::Region> regions;
+        for (auto & text : texts) {
+            regions.push_back(vcf::parse_region(text));
+        }
+        std::string path = regions_folder + "regions.vcf.gz";
+        util::MappedFileBlockReader input{path};
+        vcf::RegionIndex index{path + ".tbi"};
+
+        auto writer = new CollectingReportWriter;
+        std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+        outputs.emplace_back(writer);
+        bool is_valid = vcf::is_valid_vcf_regions(input, path, regions, index, vcf::ValidationLevel::warning,
+                                                  outputs);
+        error_lines = writer->error_lines();
+        return is_valid;
+    }
+
+    /**
+     * Validates a whole file, split by its index with several threads
+     */
+    bool is_valid_indexed(std::string const & file, size_t threads, std::vector<size_t> & error_lines)
+    {
+        std::string path = regions_folder + file;
+        util::MappedFileBlockReader input{path};
+        vcf::RegionIndex index{vcf::RegionIndex::find(path)};
+
+        auto writer = new CollectingReportWriter;
+        std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+        outputs.emplace_back(writer);
+        bool is_valid = vcf::is_valid_vcf_indexed(input, path, index, vcf::ValidationLevel::warning, outputs,
+                                                  threads);
+        error_lines = writer->error_lines();
+        return is_valid;
+    }
+
+    /**
+     * Validates a whole file adding its lines to an index
+     * @return why the index can't be written, or empty if it can
+     */
+    std::string build_index(std::string const & path, vcf::RegionIndexBuilder & index, size_t threads = 1)
+    {
+        util::MappedFileBlockReader input{path};
+        std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+        outputs.emplace_back(new CollectingReportWriter);
+        vcf::is_valid_vcf_file(input, path, vcf::ValidationLevel::warning, outputs, threads, nullptr, nullptr,
+                               nullptr, nullptr, vcf::RecordSampling{}, nullptr, &index);
+        return index.failure();
+    }
+
+    /**
+     * Writes a text compressed with BGZF in blocks of `block_size` bytes
+     */
+    void write_bgzf(std::string const & path, std::string const & text, size_t block_size)
+    {
+        std::ofstream file{path, std::ios::out | std::ios::binary};
+        util::BgzfStreamBuffer buffer{file, 1, Z_DEFAULT_COMPRESSION, block_size};
+        std::ostream output{&buffer};
+        output << text;
+        buffer.close();
+    }
+  }
+
+  TEST_CASE("Regions given in the command line", "[regions]")
+  {
+      SECTION("Whole contigs")
+      {
+          vcf::Region region = vcf::parse_region("chr1");
+          CHECK(region.contig == "chr1");
+          CHECK(region.begin == 0);
+          CHECK(region.end == vcf::max_region_end);
+
+          CHECK(vcf::parse_region("HLA-A*01:01N").contig == "HLA-A*01:01N");
+      }
+
+      SECTION("Positions are 1-based and inclusive")
+      {
+          vcf::Region region = vcf::parse_region("chr1:1,000-2,000");
+          CHECK(region.contig == "chr1");
+          CHECK(region.begin == 999);
+          CHECK(region.end == 2000);
+
+          region = vcf::parse_region("X:500");
+          CHECK(region.begin == 499);
+          CHECK(region.end == vcf::max_region_end);
+
+          CHECK(vcf::parse_region("X:500-").end == vcf::max_region_end);
+      }
+
+      SECTION("Invalid regions")
+      {
+          CHECK_THROWS_AS(vcf::parse_region(""), std::invalid_argument);
+          CHECK_THROWS_AS(vcf::parse_region("1:0-10"), std::invalid_argument);
+          CHECK_THROWS_AS(vcf::parse_region("1:20-10"), std::invalid_argument);
+          CHECK_THROWS_AS(vcf::parse_region("1:10-20-30"), std::invalid_argument);
+      }
+  }
+
+  TEST_CASE("Regions of a BED file", "[regions]")
+  {
+      std::istringstream bed{"browser position chr1:1-100\n"
+                             "track name=regions\n"
+                             "# comment\n"
+                             "\n"
+                             "chr1\t0\t100\tname\r\n"
+                             "chr2\t50\t50\n"};
+      auto regions = vcf::read_bed_regions(bed);
+      REQUIRE(regions.size() == 2);
+      CHECK(regions[0].contig == "chr1");
+      CHECK(regions[0].begin == 0);
+      CHECK(regions[0].end == 100);
+      CHECK(regions[1].begin == 50);
+      CHECK(regions[1].end == 51);
+
+      std::istringstream invalid{"chr1\t100\n"};
+      CHECK_THROWS_AS(vcf::read_bed_regions(invalid), std::invalid_argument);
+  }
+
+  TEST_CASE("Records read with a tabix or CSI index", "[regions]")
+  {
+      for (std::string file : {"regions.vcf.gz", "regions_csi.vcf.gz"}) {
+          SECTION(file)
+          {
+              CHECK(read_records(file, {"1:49000-51000"})
+                    == (std::vector<std::string>{"1:49000", "1:50000", "1:51000"}));
+              CHECK(read_records(file, {"2:150-250"}) == std::vector<std::string>{"2:200"});
+              CHECK(read_records(file, {"3"}).size() == 10);
+              CHECK(read_records(file, {"2"}).size() == 50);
+              CHECK(read_records(file, {"1"}).size() == 100);
+              CHECK(read_records(file, {"X"}).empty());
+          }
+
+          SECTION(file + ", records overlapping by their reference allele or INFO END")
+          {
+              // 1:3000 has the reference ACGT, and 1:20000 is a deletion until 30000
+              CHECK(read_records(file, {"1:3003-3003"}) == std::vector<std::string>{"1:3000"});
+              CHECK(read_records(file, {"1:3004-3004"}).empty());
+              CHECK(read_records(file, {"1:25100-25200"}) == std::vector<std::string>{"1:20000"});
+          }
+
+          SECTION(file + ", overlapping regions in any order")
+          {
+              CHECK(read_records(file, {"3:1-20", "1:6000-8000", "1:5000-7000", "3:15-30"})
+                    == (std::vector<std::string>{"1:5000", "1:6000", "1:7000", "1:8000", "3:10", "3:20", "3:30"}));
+          }
+      }
+  }
+
+  TEST_CASE("Validation of some regions", "[regions]")
+  {
+      std::vector<size_t> error_lines;
+
+      SECTION("Regions without errors")
+      {
+          CHECK(is_valid_in_regions({"1:60000-70000", "2:1-1000", "X"}, error_lines));
+          CHECK(error_lines.empty());
+      }
+
+      SECTION("The lines of the errors count the header and the records in the regions")
+      {
+          CHECK_FALSE(is_valid_in_regions({"1:49000-51000", "2:3950-4000"}, error_lines));
+          CHECK(error_lines == (std::vector<size_t>{13, 15}));
+      }
+
+      SECTION("Only BGZF files can be validated by regions")
+      {
+          util::MappedFileBlockReader input{"test/input_files/v4.3/passed/passed_body_info.vcf"};
+          vcf::RegionIndex index{regions_folder + "regions.vcf.gz.tbi"};
+          std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+          CHECK_THROWS_AS(vcf::is_valid_vcf_regions(input, "passed_body_info.vcf", {vcf::parse_region("1")}, index,
+                                                    vcf::ValidationLevel::error, outputs),
+                          std::invalid_argument);
+      }
+
+      SECTION("The index must be a tabix or CSI one")
+      {
+          CHECK_THROWS_AS(vcf::RegionIndex{regions_folder + "regions.vcf.gz"}, std::runtime_error);
+          CHECK_THROWS_AS(vcf::RegionIndex{regions_folder + "missing.tbi"}, std::runtime_error);
+      }
+
+      SECTION("Counts of contigs larger than the index")
+      {
+          std::string const path = (boost::filesystem::temp_directory_path()
+                                    / boost::filesystem::unique_path()).string();
+          for (std::string index_file : {"regions.vcf.gz.tbi", "regions_csi.vcf.gz.csi"}) {
+              util::MappedFileBlockReader compressed{regions_folder + index_file};
+              util::GzipBlockReader reader{compressed};
+              std::string bytes;
+              util::Block block;
+              while (reader.read(block)) {
+                  bytes.append(block.data, block.size);
+              }
+              // the count of contigs follows the magic number in tabix, and the auxiliary data in CSI
+              size_t count_offset = 4;
+              if (bytes.compare(0, 4, "CSI\1") == 0) {
+                  count_offset = 16 + static_cast<unsigned char>(bytes[12])
+                                 + (static_cast<unsigned char>(bytes[13]) << 8);
+              }
+              bytes.replace(count_offset, 4, "\xff\xff\xff\x7f");
+              write_bgzf(path, bytes, 1000);
+
+              try {
+                  vcf::RegionIndex index{path};
+                  FAIL("The index of " + index_file + " was read");
+              } catch (std::runtime_error const & error) {
+                  CHECK(std::string{error.what()} == "Couldn't read the index " + path + ": The index is truncated");
+              }
+          }
+          boost::filesystem::remove(path);
+      }
+  }
+
+  TEST_CASE("Validation of a whole file split by its index", "[regions]")
+  {
+      for (std::string file : {"regions.vcf.gz", "regions_csi.vcf.gz"}) {
+          SECTION(file + ", offsets of the records")
+          {
+              vcf::RegionIndex index{vcf::RegionIndex::find(regions_folder + file)};
+              std::vector<util::VirtualOffset> offsets = index.record_offsets();
+              CHECK(offsets.size() > 3);
+              CHECK(std::is_sorted(offsets.begin(), offsets.end()));
+              CHECK(std::adjacent_find(offsets.begin(), offsets.end()) == offsets.end());
+          }
+
+          SECTION(file + ", the same reports as a single pass")
+          {
+              std::vector<size_t> expected;
+              CHECK_FALSE(is_valid_indexed(file, 1, expected));
+              CHECK_FALSE(expected.empty());
+              for (size_t threads : {2, 3, 8}) {
+                  std::vector<size_t> error_lines;
+                  CHECK_FALSE(is_valid_indexed(file, threads, error_lines));
+                  CHECK(error_lines == expected);
+              }
+          }
+      }
+  }
+
+  TEST_CASE("Index written while validating", "[regions]")
+  {
+      using Format = vcf::RegionIndexBuilder::Format;
+      std::vector<std::string> const queries[] = {{"1:49000-51000"}, {"2:150-250"}, {"3"}, {"2"}, {"1:3003-3003"},
+                                                  {"1:3004-3004"}, {"1:25100-25200"}, {"3:1-20", "1:6000-8000"}};
+      std::string const index_path = (boost::filesystem::temp_directory_path()
+                                      / boost::filesystem::unique_path()).string();
+
+      for (Format format : {Format::TABIX, Format::CSI}) {
+          std::string const name = format == Format::TABIX ? "tabix" : "CSI";
+          for (size_t threads : {1, 3}) {
+              SECTION(name + " index, " + std::to_string(threads) + " threads")
+              {
+                  // the file is the same as regions_csi.vcf.gz, whose index is tested with CSI
+                  std::string file = format == Format::TABIX ? "regions.vcf.gz" : "regions_csi.vcf.gz";
+                  vcf::RegionIndexBuilder index{format};
+                  REQUIRE(build_index(regions_folder + file, index, threads) == "");
+                  index.write(index_path);
+                  for (auto & query : queries) {
+                      CHECK(read_indexed_records(regions_folder + file, index_path, query) == read_records(file, query));
+                  }
+              }
+          }
+
+          SECTION(name + " index of lines split across compressed blocks")
+          {
+              util::MappedFileBlockReader compressed{regions_folder + "regions.vcf.gz"};
+              util::GzipBlockReader reader{compressed};
+              std::string text;
+              util::Block block;
+              while (reader.read(block)) {
+                  text.append(block.data, block.size);
+              }
+              std::string path = index_path + ".vcf.gz";
+              write_bgzf(path, text, 100);
+
+              vcf::RegionIndexBuilder index{format};
+              REQUIRE(build_index(path, index) == "");
+              index.write(index_path);
+              for (auto & query : queries) {
+                  CHECK(read_indexed_records(path, index_path, query) == read_records("regions.vcf.gz", query));
+              }
+              boost::filesystem::remove(path);
+          }
+      }
+
+      SECTION("Only sorted records are indexed")
+      {
+          std::string header = "##fileformat=VCFv4.3\n#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\n";
+          std::string path = index_path + ".vcf.gz";
+
+          write_bgzf(path, header + "1\t200\t.\tA\tC\t.\t.\t.\n1\t100\t.\tA\tC\t.\t.\t.\n", 1000);
+          vcf::RegionIndexBuilder unsorted{Format::TABIX};
+          CHECK(build_index(path, unsorted) == "the contig 1 is not sorted by position, the line 4 is before the "
+                                               "previous one");
+          CHECK_THROWS_AS(unsorted.write(index_path), std::runtime_error);
+
+          write_bgzf(path, header + "1\t100\t.\tA\tC\t.\t.\t.\n2\t100\t.\tA\tC\t.\t.\t.\n"
+                           "1\t200\t.\tA\tC\t.\t.\t.\n", 1000);
+          vcf::RegionIndexBuilder not_together{Format::TABIX};
+          CHECK(build_index(path, not_together) == "the records of the contig 1 are not together, the line 5 is "
+                                                   "after others");
+          boost::filesystem::remove(path);
+      }
+
+      SECTION("Only BGZF files are indexed")
+      {
+          vcf::RegionIndexBuilder index{Format::TABIX};
+          CHECK(build_index("test/input_files/v4.3/passed/passed_body_info.vcf", index)
+                == "it is not compressed with BGZF");
+      }
+
+      boost::filesystem::remove(index_path);
+  }
+}
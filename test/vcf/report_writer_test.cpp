@@ -14,9 +14,11 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <memory>
 #include <iostream>
 #include <fstream>
+#include <sstream>
 
 #include <boost/filesystem.hpp>
 
@@ -130,6 +132,56 @@ namespace ebi
           CHECK(typeid(*errors[2]).name() == typeid(ebi::vcf::SamplesBodyError).name());
       }
 
+      SECTION("Write in several transactions")
+      {
+          std::string small_batches_db_name = "test/input_files/sqlite_test.batches.errors.odb.db";
+          {
+              ebi::vcf::OdbReportRW small_batches{small_batches_db_name, 2};
+              for (size_t line = 5; line > 0; --line) {
+                  ebi::vcf::Error test_error{line, "testing errors"};
+                  small_batches.write_error(test_error);
+              }
+          }
+
+          {
+              ebi::vcf::OdbReportRW reader{small_batches_db_name};
+              CHECK(reader.count_errors() == 5);
+              std::vector<size_t> lines;
+              reader.for_each_error([&](std::shared_ptr<ebi::vcf::Error> error) {
+                  lines.push_back(error->line);
+              });
+              CHECK(lines == (std::vector<size_t>{1, 2, 3, 4, 5}));
+          }
+
+          boost::filesystem::remove(boost::filesystem::path{small_batches_db_name});
+      }
+
+      SECTION("The destructor commits the last transaction, even if it is not full")
+      {
+          std::string partial_batch_db_name = "test/input_files/sqlite_test.partial_batch.errors.odb.db";
+          {
+              // two full transactions of 2 rows, and the last row in a third one that is never flushed
+              ebi::vcf::OdbReportRW writer{partial_batch_db_name, 2};
+              for (size_t line = 1; line <= 5; ++line) {
+                  ebi::vcf::Error test_error{line, "testing errors"};
+                  writer.write_error(test_error);
+              }
+          }
+
+          {
+              ebi::vcf::OdbReportRW reader{partial_batch_db_name};
+              CHECK(reader.count_errors() == 5);
+              CHECK(reader.count_warnings() == 0);
+              size_t last_line = 0;
+              reader.for_each_error([&](std::shared_ptr<ebi::vcf::Error> error) {
+                  last_line = error->line;
+              });
+              CHECK(last_line == 5);
+          }
+
+          boost::filesystem::remove(boost::filesystem::path{partial_batch_db_name});
+      }
+
 
       boost::filesystem::path db_file{db_name};
       boost::filesystem::remove(db_file);
@@ -197,14 +249,241 @@ namespace ebi
           ebi::vcf::SummaryTracker reporter;
           ebi::vcf::FormatBodyError error{7, "format body error"};
 
-          reporter.add_to_summary(error.message, error.line);
-          REQUIRE(reporter.error_summary_report[error.message].occurrences == 1);
-          REQUIRE(reporter.error_summary_report[error.message].first_occurrence_line == 7);
+          ebi::vcf::SummaryTracker::Key key = reporter.key_of(ebi::vcf::Severity::ERROR, error.type_message());
+
+          reporter.add_to_summary(ebi::vcf::Severity::ERROR, error.type_message(), error.line);
+          REQUIRE(reporter.error_summary_report[key].occurrences == 1);
+          REQUIRE(reporter.error_summary_report[key].first_occurrence_line == 7);
+
+          reporter.add_to_summary(ebi::vcf::Severity::ERROR, error.type_message(), 11);
+          REQUIRE(reporter.error_summary_report[key].occurrences == 2);
+          REQUIRE(reporter.error_summary_report[key].first_occurrence_line == 7);
+      }
+
+      SECTION("SummaryTracker should keep errors and warnings with the same message apart")
+      {
+          ebi::vcf::SummaryTracker reporter;
+          ebi::vcf::FormatBodyError error{7, "format body error"};
+          ebi::vcf::FormatBodyError same_message{9, "format body error"};
+          REQUIRE(error.type_message() == same_message.type_message());
+
+          reporter.add_to_summary(ebi::vcf::Severity::ERROR, error.type_message(), error.line);
+          reporter.add_to_summary(ebi::vcf::Severity::WARNING, same_message.type_message(), same_message.line);
+          REQUIRE(reporter.error_order.size() == 2);
+          REQUIRE(reporter.error_summary_report[reporter.error_order[1]].first_occurrence_line == 9);
+      }
+
+      SECTION("SummaryTracker should group the messages with values by their template")
+      {
+          ebi::vcf::SummaryTracker reporter;
+          ebi::vcf::NoMetaDefinitionError chr1{7, "Chromosome/contig 'chr1' is not described", "Contig is not described"};
+          ebi::vcf::NoMetaDefinitionError chr2{9, "Chromosome/contig 'chr2' is not described", "Contig is not described"};
+          ebi::vcf::DuplicationError duplicate{11, "Duplicated variant chr1:100:A>T found"};
+
+          reporter.add_to_summary(ebi::vcf::Severity::ERROR, chr1.type_message(), chr1.line);
+          reporter.add_to_summary(ebi::vcf::Severity::ERROR, chr2.type_message(), chr2.line);
+          reporter.add_to_summary(ebi::vcf::Severity::ERROR, duplicate.type_message(), duplicate.line);
+          REQUIRE(reporter.error_order.size() == 2);
+          CHECK(reporter.messages.text(reporter.error_order[0].second) == "Contig is not described");
+          CHECK(reporter.error_summary_report[reporter.error_order[0]].occurrences == 2);
+          CHECK(reporter.messages.text(reporter.error_order[1].second) == "A duplicated variant was found");
+      }
+
+      SECTION("SummaryTracker should count a batch like the errors one by one")
+      {
+          ebi::vcf::FormatBodyError format_error{7, "format body error"};
+          ebi::vcf::FormatBodyError later_format_error{8, "format body error"};
+          ebi::vcf::QualityBodyError quality_error{9};
+          std::vector<ebi::vcf::ReportedError> batch{{ebi::vcf::Severity::ERROR, &format_error},
+                                                     {ebi::vcf::Severity::ERROR, &later_format_error},
+                                                     {ebi::vcf::Severity::WARNING, &later_format_error},
+                                                     {ebi::vcf::Severity::ERROR, &quality_error},
+                                                     {ebi::vcf::Severity::ERROR, &format_error}};
+
+          ebi::vcf::SummaryTracker one_by_one;
+          for (auto & reported : batch) {
+              one_by_one.add_to_summary(reported.severity, reported.error->type_message(), reported.error->line);
+          }
+          ebi::vcf::SummaryTracker batched;
+          batched.add_to_summary(batch);
+
+          REQUIRE(batched.error_order == one_by_one.error_order);
+          for (auto & key : batched.error_order) {
+              CHECK(batched.error_summary_report[key].occurrences == one_by_one.error_summary_report[key].occurrences);
+              CHECK(batched.error_summary_report[key].first_occurrence_line
+                    == one_by_one.error_summary_report[key].first_occurrence_line);
+          }
+          CHECK(batched.error_summary_report[batched.error_order[0]].occurrences == 3);
+      }
+
+      SECTION("SummaryTracker should merge the summaries of parts of the input in order of their first line")
+      {
+          ebi::vcf::FormatBodyError format_error{7, "format body error"};
+          ebi::vcf::QualityBodyError quality_error{9};
+
+          ebi::vcf::SummaryTracker second_part;
+          second_part.add_to_summary(ebi::vcf::Severity::ERROR, format_error.type_message(), 20);
+          second_part.add_to_summary(ebi::vcf::Severity::WARNING, format_error.type_message(), 21);
+          second_part.add_to_summary(ebi::vcf::Severity::ERROR, quality_error.type_message(), 22);
+
+          ebi::vcf::SummaryTracker first_part;
+          first_part.add_to_summary(ebi::vcf::Severity::ERROR, quality_error.type_message(), 3);
+          first_part.add_to_summary(ebi::vcf::Severity::ERROR, format_error.type_message(), 30);
+
+          first_part.merge(second_part);
+          auto format_key = first_part.key_of(ebi::vcf::Severity::ERROR, format_error.type_message());
+          auto quality_key = first_part.key_of(ebi::vcf::Severity::ERROR, quality_error.type_message());
+          auto warning_key = first_part.key_of(ebi::vcf::Severity::WARNING, format_error.type_message());
+          REQUIRE(first_part.error_order == (std::vector<ebi::vcf::SummaryTracker::Key>{quality_key, format_key,
+                                                                                         warning_key}));
+          CHECK(first_part.error_summary_report[quality_key].occurrences == 2);
+          CHECK(first_part.error_summary_report[quality_key].first_occurrence_line == 3);
+          CHECK(first_part.error_summary_report[format_key].occurrences == 2);
+          CHECK(first_part.error_summary_report[format_key].first_occurrence_line == 20);
+          CHECK(first_part.error_summary_report[warning_key].occurrences == 1);
+      }
+  }
+
+  TEST_CASE("Unit test: limited report writer", "[output]")
+  {
+      auto counter = new CollectingReportWriter;
+
+      SECTION("Limit of errors of each type")
+      {
+          vcf::LimitedReportWriter writer{std::unique_ptr<vcf::ReportWriter>{counter}, 2, 0};
+          vcf::PositionBodyError position_error{1};
+          vcf::QualityBodyError quality_error{2};
+          for (int i = 0; i < 5; ++i) {
+              writer.write_error(position_error);
+              writer.write_error(quality_error);
+              writer.write_warning(position_error);
+          }
+          CHECK(counter->errors().size() == 4);
+          CHECK(counter->warnings().size() == 2);
+          CHECK(writer.omitted_errors() == 9);
+          CHECK_FALSE(writer.is_full());
+
+          writer.write_message("result");
+          REQUIRE(counter->messages.size() == 2);
+          CHECK(counter->messages[1] == "result");
+      }
+
+      SECTION("Limit of errors in total")
+      {
+          vcf::LimitedReportWriter writer{std::unique_ptr<vcf::ReportWriter>{counter}, 0, 3};
+          vcf::PositionBodyError position_error{1};
+          for (int i = 0; i < 5; ++i) {
+              CHECK(writer.is_full() == (i >= 3));
+              writer.write_error(position_error);
+          }
+          CHECK(counter->errors().size() == 3);
+          CHECK(writer.omitted_errors() == 2);
+      }
+
+      SECTION("Batches are limited like single errors")
+      {
+          vcf::LimitedReportWriter writer{std::unique_ptr<vcf::ReportWriter>{counter}, 2, 0};
+          vcf::PositionBodyError position_error{1};
+          vcf::QualityBodyError quality_error{2};
+          std::vector<vcf::ReportedError> batch;
+          for (int i = 0; i < 5; ++i) {
+              batch.push_back({vcf::Severity::ERROR, &position_error});
+              batch.push_back({vcf::Severity::ERROR, &quality_error});
+              batch.push_back({vcf::Severity::WARNING, &position_error});
+          }
+          writer.write_batch(batch);
+          CHECK(counter->errors().size() == 4);
+          CHECK(counter->warnings().size() == 2);
+          CHECK(writer.omitted_errors() == 9);
+      }
+
+      SECTION("Types of errors by class and message without values")
+      {
+          vcf::LimitedReportWriter writer{std::unique_ptr<vcf::ReportWriter>{counter}, 1, 0};
+          vcf::NoMetaDefinitionError chr1{1, "Chromosome/contig 'chr1' is not described", "Contig is not described"};
+          vcf::NoMetaDefinitionError chr2{2, "Chromosome/contig 'chr2' is not described", "Contig is not described"};
+          vcf::PositionBodyError position_error{3, "Contig is not described"};
+          writer.write_error(chr1);
+          writer.write_error(chr2);
+          writer.write_error(position_error);
+          REQUIRE(counter->reports.size() == 2);
+          CHECK(counter->reports[0].line == 1);
+          CHECK(counter->reports[1].line == 3);
+          CHECK(writer.omitted_errors() == 1);
+          CHECK(writer.max_errors_per_type() == 1);
+      }
+  }
+
+  TEST_CASE("Unit test: parser limited to some errors of each type", "[output]")
+  {
+      vcf::ParsingState state{std::make_shared<vcf::Source>("test.vcf", vcf::InputFormat::VCF_FILE_VCF,
+                                                            vcf::Version::v43)};
+      state.max_reports_per_type = 2;
+      for (size_t line = 1; line <= 5; ++line) {
+          std::string contig = "chr" + std::to_string(line);
+          state.add_error(std::unique_ptr<vcf::Error>{new vcf::NoMetaDefinitionError{
+                  line, "Chromosome/contig '" + contig + "' is not described", "Contig is not described"}});
+          state.add_warning(std::unique_ptr<vcf::Error>{new vcf::PositionBodyError{line}});
+      }
+      CHECK(state.errors.size() == 2);
+      CHECK(state.warnings.size() == 2);
+      CHECK(state.n_omitted_errors == 3);
+      CHECK(state.n_omitted_warnings == 3);
+
+      // the types already seen are still full after reporting the rest
+      state.clear();
+      CHECK(state.n_omitted_errors == 0);
+      state.add_error(std::unique_ptr<vcf::Error>{new vcf::PositionBodyError{6}});
+      state.add_error(std::unique_ptr<vcf::Error>{new vcf::NoMetaDefinitionError{6, "Other", "Contig is not described"}});
+      CHECK(state.errors.size() == 1);
+      CHECK(state.n_omitted_errors == 1);
+  }
+
+  TEST_CASE("Integration test: the parser only keeps the errors that the reports write", "[output]")
+  {
+      std::string header = "##fileformat=VCFv4.3\n"
+              "##contig=<ID=chr0>\n"
+              "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\n";
+      std::string records;
+      for (size_t i = 1; i <= 1000; ++i) {
+          records += "chr" + std::to_string(i) + "\t1\t.\tA\tT\t.\tPASS\t.\n";
+      }
+      std::stringstream input{header + records};
+      util::StreamBlockReader reader{input, 4096};
+
+      auto counter = new CollectingReportWriter;
+      auto writer = new vcf::LimitedReportWriter{std::unique_ptr<vcf::ReportWriter>{counter}, 3, 0};
+      std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+      outputs.emplace_back(writer);
+
+      CHECK(vcf::is_valid_vcf_file(reader, "stdin", vcf::ValidationLevel::warning, outputs));
+      auto warnings = counter->warnings(true);
+      CHECK(std::count_if(warnings.begin(), warnings.end(), [](std::string const & warning) {
+          return warning.find("is not described") != std::string::npos;
+      }) == 3);
+      CHECK(writer->omitted_errors() == 997);
+  }
 
-          reporter.add_to_summary(error.message, 11);
-          REQUIRE(reporter.error_summary_report[error.message].occurrences == 2);
-          REQUIRE(reporter.error_summary_report[error.message].first_occurrence_line == 7);
+  TEST_CASE("Integration test: validation stops when the reports are full", "[output]")
+  {
+      std::string header = "##fileformat=VCFv4.1\n"
+              "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\n";
+      std::string records;
+      for (size_t i = 0; i < 20000; ++i) {
+          records += "1\t0\t.\tA\tT\t.\tPASS\t.\n";
       }
+      std::stringstream input{header + records};
+      util::StreamBlockReader reader{input, 4096};
+
+      auto counter = new CollectingReportWriter;
+      auto writer = new vcf::LimitedReportWriter{std::unique_ptr<vcf::ReportWriter>{counter}, 0, 10};
+      std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+      outputs.emplace_back(writer);
+
+      CHECK_FALSE(vcf::is_valid_vcf_file(reader, "stdin", vcf::ValidationLevel::warning, outputs));
+      CHECK(counter->reports.size() == 10);
+      // the input is read in blocks, and the rest of the block where the limit was reached is still counted
+      CHECK(counter->reports.size() + writer->omitted_errors() < 1000);
   }
 
   TEST_CASE("Integration test: summary report", "[output]")
@@ -0,0 +1,153 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "catch/catch.hpp"
+
+#include "util/string_utils.hpp"
+#include "vcf/sample_index.hpp"
+
+namespace ebi
+{
+  void check_index_like_split(vcf::SampleIndex & index, std::string const & sample)
+  {
+      INFO("Sample: '" << sample << "'");
+      index.build(sample);
+
+      std::vector<std::string> subfields;
+      util::string_split(sample, ":", subfields);
+      REQUIRE( index.subfields.size() == subfields.size() );
+
+      for (size_t i = 0; i < subfields.size(); ++i) {
+          CHECK( index.subfield_string(i) == subfields[i] );
+
+          std::vector<std::string> values;
+          util::string_split(subfields[i], ",", values);
+          CHECK( index.value_strings(index.subfields[i]) == values );
+      }
+  }
+
+  TEST_CASE("Sample index", "[sample_index]")
+  {
+      vcf::SampleIndex index;
+
+      SECTION("Splits like string_split")
+      {
+          // every string of up to 5 characters, to cover empty parts and delimiters at both ends
+          std::vector<std::string> samples{""};
+          for (size_t begin = 0, length = 1; length <= 5; ++length) {
+              size_t end = samples.size();
+              for (size_t i = begin; i < end; ++i) {
+                  for (char c : std::string{":,1."}) {
+                      samples.push_back(samples[i] + c);
+                  }
+              }
+              begin = end;
+          }
+          // long samples use the vectorized search
+          samples.push_back("0/1:35,12,0:47:99:1126,0,2841,1237,3001,4106:.:.,.:12345678901234567890");
+          samples.push_back(",:0|1:::1,,2,:,,:" + std::string(40, '9') + ":,");
+
+          for (auto & sample : samples) {
+              check_index_like_split(index, sample);
+          }
+      }
+
+      SECTION("Values are classified")
+      {
+          index.build("0/1:.:-12,+3,123456789,1234567890:0.5,-.5,3.,1e5,.:abc,-,1.2.3");
+          std::vector<vcf::ValueClass> classes;
+          for (auto & value : index.values) {
+              classes.push_back(value.value_class);
+          }
+
+          using vcf::ValueClass;
+          CHECK( classes == (std::vector<ValueClass>{
+                  ValueClass::OTHER,
+                  ValueClass::MISSING,
+                  ValueClass::INTEGER, ValueClass::INTEGER, ValueClass::INTEGER, ValueClass::DECIMAL,
+                  ValueClass::DECIMAL, ValueClass::DECIMAL, ValueClass::DECIMAL, ValueClass::OTHER, ValueClass::MISSING,
+                  ValueClass::OTHER, ValueClass::OTHER, ValueClass::OTHER }) );
+      }
+  }
+
+  TEST_CASE("Genotype", "[sample_index]")
+  {
+      vcf::Genotype genotype;
+
+      SECTION("Splits like string_split")
+      {
+          // every genotype of up to 5 characters, to cover empty alleles and separators at both ends
+          std::vector<std::string> genotypes{""};
+          for (size_t begin = 0, length = 1; length <= 5; ++length) {
+              size_t end = genotypes.size();
+              for (size_t i = begin; i < end; ++i) {
+                  for (char c : std::string{"/|1."}) {
+                      genotypes.push_back(genotypes[i] + c);
+                  }
+              }
+              begin = end;
+          }
+
+          for (auto & gt : genotypes) {
+              INFO("Genotype: '" << gt << "'");
+              std::string sample = gt + ":1/2";
+              genotype.decode(sample);
+
+              std::vector<std::string> alleles;
+              util::string_split(gt, "/|", alleles);
+              REQUIRE( genotype.alleles.size() == alleles.size() );
+              for (size_t i = 0; i < alleles.size(); ++i) {
+                  CHECK( genotype.allele_string(genotype.alleles[i]) == alleles[i] );
+              }
+              CHECK( genotype.ploidy == 1 + std::count_if(gt.begin(), gt.end(), [](char c) {
+                  return c == '/' || c == '|';
+              }) );
+          }
+      }
+
+      SECTION("Alleles are classified")
+      {
+          std::string sample = "0|12/./x1//" + std::string(30, '9');
+          genotype.decode(sample);
+
+          using vcf::Genotype;
+          std::vector<Genotype::AlleleClass> classes;
+          for (auto & allele : genotype.alleles) {
+              classes.push_back(allele.allele_class);
+          }
+          CHECK( classes == (std::vector<Genotype::AlleleClass>{
+                  Genotype::AlleleClass::INDEX, Genotype::AlleleClass::INDEX, Genotype::AlleleClass::MISSING,
+                  Genotype::AlleleClass::OTHER, Genotype::AlleleClass::EMPTY, Genotype::AlleleClass::INDEX }) );
+          CHECK( genotype.alleles[1].index == 12 );
+          CHECK( genotype.alleles[1].phased );
+          CHECK_FALSE( genotype.alleles[2].phased );
+          CHECK( genotype.alleles[5].index == std::numeric_limits<size_t>::max() );
+          CHECK_FALSE( genotype.is_all_reference() );
+
+          std::string reference = "0|0/0:1";
+          genotype.decode(reference);
+          CHECK( genotype.is_all_reference() );
+          std::string not_reference = "0/00";
+          genotype.decode(not_reference);
+          CHECK_FALSE( genotype.is_all_reference() );
+      }
+  }
+}
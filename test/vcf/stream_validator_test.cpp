@@ -0,0 +1,133 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include "catch/catch.hpp"
+
+#include "vcf/stream_validator.hpp"
+#include "vcf/validator.hpp"
+#include "test_utils.hpp"
+
+namespace ebi
+{
+  namespace
+  {
+    struct Reports
+    {
+        std::vector<std::string> errors;
+        std::vector<std::string> warnings;
+        size_t records = 0;
+    };
+
+    void listen(vcf::StreamValidator & validator, Reports & reports)
+    {
+        validator.on_error([&reports](vcf::Severity severity, vcf::Error const & error) {
+            (severity == vcf::Severity::ERROR ? reports.errors : reports.warnings).push_back(error.what());
+        });
+        validator.on_record([&reports](vcf::Record const & record) {
+            ++reports.records;
+        });
+    }
+
+    std::string read_file(boost::filesystem::path const & path)
+    {
+        std::ifstream input{path.string()};
+        return std::string{std::istreambuf_iterator<char>{input}, std::istreambuf_iterator<char>{}};
+    }
+  }
+
+  TEST_CASE("Streaming validation", "[stream]")
+  {
+      std::vector<boost::filesystem::path> paths{"test/input_files/v4.3/passed/passed_body_alt.vcf",
+                                                 "test/input_files/v4.3/failed/failed_body_alt_000.vcf",
+                                                 "test/input_files/v4.2/failed/failed_body_pos_000.vcf",
+                                                 "test/input_files/v4.1/failed/failed_fileformat_000.vcf"};
+
+      SECTION("Reports the same as a file, whatever the size of the pieces")
+      {
+          for (auto & path : paths) {
+              auto expected = new CollectingReportWriter;
+              std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+              outputs.emplace_back(expected);
+              std::ifstream input{path.string()};
+              bool expected_valid = vcf::is_valid_vcf_file(input, path.string(), vcf::ValidationLevel::warning,
+                                                           outputs);
+
+              std::string text = read_file(path);
+              vcf::StreamValidator validator{vcf::ValidationLevel::warning, path.string()};
+              for (size_t piece : {size_t{1}, size_t{7}, text.size()}) {
+                  Reports reports;
+                  listen(validator, reports);
+                  for (size_t i = 0; i < text.size(); i += piece) {
+                      validator.push(text.data() + i, std::min(piece, text.size() - i));
+                  }
+                  CHECK(validator.finish() == expected_valid);
+                  CHECK(reports.errors == expected->errors());
+                  CHECK(reports.warnings == expected->warnings());
+                  validator.reset();
+              }
+          }
+      }
+
+      SECTION("Records are delivered as they are read")
+      {
+          std::string text = read_file(paths[0]);
+          vcf::StreamValidator validator;
+          Reports reports;
+          listen(validator, reports);
+          validator.push(text.data(), text.size());
+          CHECK(validator.finish());
+          CHECK(reports.records > 0);
+          CHECK(reports.errors.empty());
+      }
+
+      SECTION("The stop level ends at the first error")
+      {
+          std::string text = read_file(paths[1]);
+          vcf::StreamValidator validator{vcf::ValidationLevel::stop};
+          Reports reports;
+          listen(validator, reports);
+          validator.push(text.data(), text.size());
+          CHECK_FALSE(validator.is_valid());
+          CHECK_FALSE(validator.finish());
+          CHECK(reports.errors.size() == 1);
+      }
+
+      SECTION("A stream without fileformat is not valid")
+      {
+          std::string text = "not a VCF";
+          vcf::StreamValidator validator;
+          Reports reports;
+          listen(validator, reports);
+          validator.push(text.data(), text.size());
+          CHECK_FALSE(validator.finish());
+          CHECK(reports.errors.size() == 1);
+
+          validator.reset();
+          CHECK(validator.is_valid());
+          CHECK_FALSE(validator.finish());
+          CHECK(reports.errors.size() == 2);
+      }
+  }
+}
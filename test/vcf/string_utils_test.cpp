@@ -0,0 +1,97 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "catch/catch.hpp"
+
+#include "util/string_utils.hpp"
+
+namespace ebi
+{
+  namespace
+  {
+    std::vector<std::string> const texts{
+        "", ",", ",,", "a", "a,", ",a", "a,b", "a,,b", "a,b,", "a,b,,", ",a,b", "ab,cd;ef", "0/1|2", "DP=3", "=3",
+        "A=b=c", "AB;CD=1,2;EF",
+    };
+
+    /**
+     * Former implementation of string_split, which the new ones must behave like
+     */
+    std::vector<std::string> strpbrk_split(std::string const & s, char const * delims)
+    {
+        std::vector<std::string> output;
+        if (s.size() > 0) {
+            char const* p = s.c_str();
+            char const* q = strpbrk(p+1, delims);
+            for( ; q != NULL; q = strpbrk(p, delims) ) {
+                output.push_back(std::string(p, q));
+                p = q + 1;
+            }
+            if (p < &(s.back()) + 1) {
+                output.push_back(std::string(p));
+            }
+        }
+        return output;
+    }
+  }
+
+  TEST_CASE("Strings split", "[string_utils]")
+  {
+      for (char const * delims : {",", ";=", "/|"}) {
+          for (auto & text : texts) {
+              INFO("Text: '" << text << "', delimiters: '" << delims << "'");
+              auto expected = strpbrk_split(text, delims);
+
+              std::vector<std::string> split;
+              util::string_split(text, delims, split);
+              CHECK(split == expected);
+
+              std::vector<std::string> viewed;
+              for (auto & part : util::split_view(text, delims)) {
+                  viewed.push_back(part.str());
+              }
+              CHECK(viewed == expected);
+
+              std::vector<std::string> reused{"x", "y", "z", "long enough not to fit in a small string"};
+              util::string_split_into(text, delims, reused);
+              CHECK(reused == expected);
+          }
+      }
+  }
+
+  TEST_CASE("Parts of a string seen in place", "[string_utils]")
+  {
+      std::string text = "DP=3";
+      auto parts = util::split_view(text, "=");
+      auto part = parts.begin();
+      REQUIRE(part != parts.end());
+      CHECK(*part == "DP");
+      CHECK(*part != "D");
+      CHECK(part->begin == text.data());
+      CHECK((++part)->str() == "3");
+      CHECK(++part == parts.end());
+
+      std::vector<std::string> reused{"a", "b"};
+      auto capacity = reused.capacity();
+      util::string_split_into("x", ",", reused);
+      CHECK(reused == std::vector<std::string>{"x"});
+      CHECK(reused.capacity() == capacity);
+  }
+}
@@ -18,11 +18,14 @@
 #define EBI_TEST_UTILS_HPP
 
 #include <memory>
+#include <string>
 #include <vector>
 #include <fstream>
 #include <algorithm>
 
+#include "vcf/error.hpp"
 #include "vcf/file_structure.hpp"
+#include "vcf/report_writer.hpp"
 
 namespace ebi
 {
@@ -40,15 +43,19 @@ namespace ebi
       std::string normalized_alternate;
   };
 
-  inline vcf::Record build_mock_record(TestMultiRecord summary)
+  /** records don't own their source, so the one used by the mock records is kept for the whole test run */
+  inline std::shared_ptr<vcf::Source> const & mock_source()
   {
+      static std::shared_ptr<vcf::Source> source;
+      if (source) {
+          return source;
+      }
 
-//      std::shared_ptr<vcf::Source> source{std::make_shared<Source>(
-      std::shared_ptr<vcf::Source> source{new vcf::Source{"filename.vcf",
-                                                          vcf::VCF_FILE_VCF,
-                                                          vcf::Version::v41,
-                                                          {},
-                                                          {"NA001", "NA002", "NA003", "NA004"}}};
+      source.reset(new vcf::Source{"filename.vcf",
+                                   vcf::VCF_FILE_VCF,
+                                   vcf::Version::v41,
+                                   {},
+                                   {"NA001", "NA002", "NA003", "NA004"}});
 
       source->meta_entries.emplace(vcf::FORMAT,
                                    vcf::MetaEntry{
@@ -62,11 +69,100 @@ namespace ebi
                                            },
                                            source
                                    });
+      return source;
+  }
 
+  inline vcf::Record build_mock_record(TestMultiRecord summary)
+  {
+      auto & source = mock_source();
       return vcf::Record{1, "1", summary.normalized_pos, {vcf::MISSING_VALUE}, summary.normalized_reference, summary.normalized_alternate,
                          0, {vcf::MISSING_VALUE}, {{vcf::MISSING_VALUE, ""}}, {vcf::GT}, {"0/0", "0/1", "0/1", "1/1"}, source};
   }
 
+  /**
+   * Keeps in memory the errors and warnings written, in order, and the messages, to check them after a validation
+   */
+  class CollectingReportWriter : public vcf::ReportWriter
+  {
+    public:
+      struct Report
+      {
+          vcf::Severity severity;
+          size_t line;
+          std::string message;
+      };
+
+      virtual void write_error(vcf::Error &error) override
+      {
+          reports.push_back({vcf::Severity::ERROR, error.line, error.what()});
+      }
+
+      virtual void write_warning(vcf::Error &error) override
+      {
+          reports.push_back({vcf::Severity::WARNING, error.line, error.what()});
+      }
+
+      virtual void write_message(const std::string &report_result) override { messages.push_back(report_result); }
+      virtual std::string get_filename() override { return ""; }
+
+      /** messages of the errors, preceded by "line: " if `numbered` */
+      std::vector<std::string> errors(bool numbered = false) const
+      {
+          return descriptions(numbered, vcf::Severity::ERROR);
+      }
+
+      /** messages of the warnings, preceded by "line: " if `numbered` */
+      std::vector<std::string> warnings(bool numbered = false) const
+      {
+          return descriptions(numbered, vcf::Severity::WARNING);
+      }
+
+      std::vector<size_t> error_lines() const { return lines(vcf::Severity::ERROR); }
+      std::vector<size_t> warning_lines() const { return lines(vcf::Severity::WARNING); }
+
+      /** every report in order, like the text report writes them: the warnings end with " (warning)" */
+      std::vector<std::string> descriptions(bool numbered = false) const
+      {
+          std::vector<std::string> result;
+          for (auto & report : reports) {
+              result.push_back(description(report, numbered)
+                               + (report.severity == vcf::Severity::WARNING ? " (warning)" : ""));
+          }
+          return result;
+      }
+
+      std::vector<Report> reports;
+      std::vector<std::string> messages;
+
+    private:
+      static std::string description(Report const & report, bool numbered)
+      {
+          return numbered ? std::to_string(report.line) + ": " + report.message : report.message;
+      }
+
+      std::vector<std::string> descriptions(bool numbered, vcf::Severity severity) const
+      {
+          std::vector<std::string> result;
+          for (auto & report : reports) {
+              if (report.severity == severity) {
+                  result.push_back(description(report, numbered));
+              }
+          }
+          return result;
+      }
+
+      std::vector<size_t> lines(vcf::Severity severity) const
+      {
+          std::vector<size_t> result;
+          for (auto & report : reports) {
+              if (report.severity == severity) {
+                  result.push_back(report.line);
+              }
+          }
+          return result;
+      }
+  };
+
   /** simple count for small tests, no need to optimize further */
   inline long count_lines(std::istream &input_stream)
   {
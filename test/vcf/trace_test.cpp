@@ -0,0 +1,67 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "catch/catch.hpp"
+
+#include "util/trace.hpp"
+
+namespace ebi
+{
+  TEST_CASE("Trace of the threads", "[trace]")
+  {
+      // the events of a thread are kept in its own buffer, so a new thread gets the capacity of this start
+      util::Trace::start(4);
+      std::thread thread{[] {
+          util::Trace::name_thread("traced");
+          for (int64_t i = 0; i < 10; ++i) {
+              util::TraceSpan span{"parsing", "parse", "line", i};
+          }
+          util::Trace::counter("queue", 3);
+      }};
+      thread.join();
+      util::Trace::stop();
+      {
+          util::TraceSpan span{"parsing", "not recorded"};
+      }
+
+      std::ostringstream output;
+      util::Trace::write(output);
+      std::string trace = output.str();
+
+      SECTION("Only the last events of each thread are kept")
+      {
+          CHECK(trace.find("{\"traceEvents\":[") == 0);
+          CHECK(trace.find("\"args\":{\"name\":\"traced\"}") != std::string::npos);
+          CHECK(trace.find("\"args\":{\"line\":6}") == std::string::npos);
+          CHECK(trace.find("\"cat\":\"parsing\",\"ph\":\"X\"") != std::string::npos);
+          for (std::string arg : {"7", "8", "9"}) {
+              CHECK(trace.find("\"args\":{\"line\":" + arg + "}") != std::string::npos);
+          }
+          CHECK(trace.find("{\"name\":\"queue\",\"ph\":\"C\"") != std::string::npos);
+          CHECK(trace.find("\"args\":{\"value\":3}") != std::string::npos);
+      }
+
+      SECTION("Nothing is recorded once stopped")
+      {
+          CHECK(trace.find("not recorded") == std::string::npos);
+          CHECK_FALSE(util::Trace::is_enabled());
+      }
+  }
+}
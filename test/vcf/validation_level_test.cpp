@@ -0,0 +1,140 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "catch/catch.hpp"
+
+#include "vcf/validator.hpp"
+#include "test_utils.hpp"
+
+namespace ebi
+{
+  namespace
+  {
+    // the reference is missing, so there is a warning for the meta section
+    std::string const input =
+            "##fileformat=VCFv4.3\n"
+            "##contig=<ID=chr1>\n"
+            "##INFO=<ID=DP,Number=1,Type=Integer,Description=\"Depth\">\n"
+            "##FORMAT=<ID=GT,Number=1,Type=String,Description=\"Genotype\">\n"
+            "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\tFORMAT\tSample1\n"
+            "chr1\t100\t.\tA\tC\t.\tPASS\tDP=3\tGT\t0|1\n"
+            "chr1\t100\t.\tA\tC\t.\tPASS\tDP=3\tGT\t0|1\n"      // duplicated, both lines are reported
+            "chr1\t200\t.\tA\tC\t.\tPASS\tDP=a\tGT\t0|1\n"      // wrong type of INFO
+            "chr1\t300\t.\tA\tC\t.\tPASS\tDP=3\tGT\t0|7\n"      // allele of GT out of range
+            "chr1\t250\t.\tA\tC\t.\tPASS\tDP=3\tGT\t0|1\n"      // out of order, if the previous line is kept
+            "chr1\t400\t.\tA\tC\t.\tPASS\tDP=3\tGT\t0|1\t0|1\n"; // more samples than in the header
+
+    CollectingReportWriter & validate(vcf::ValidationLevel level,
+                                      std::vector<std::unique_ptr<vcf::ReportWriter>> & outputs,
+                                      vcf::RecordSampling const & sampling = vcf::RecordSampling{})
+    {
+        std::istringstream stream{input};
+        auto report = new CollectingReportWriter{};
+        outputs.emplace_back(report);
+        CHECK_FALSE(vcf::is_valid_vcf_file(stream, "input", level, outputs, 1, nullptr, nullptr, nullptr, nullptr,
+                                           sampling));
+        return *report;
+    }
+  }
+
+  TEST_CASE("Validation levels", "[validation_level]")
+  {
+      std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+
+      SECTION("Everything checked")
+      {
+          auto & report = validate(vcf::ValidationLevel::warning, outputs);
+          CHECK(report.error_lines() == (std::vector<size_t>{6, 7, 8, 9, 11}));
+          CHECK_FALSE(report.warning_lines().empty());
+      }
+
+      SECTION("Order and duplicates checked, not the fields")
+      {
+          auto & report = validate(vcf::ValidationLevel::order, outputs);
+          CHECK(report.error_lines() == (std::vector<size_t>{6, 7, 10}));
+          CHECK(report.warning_lines().empty());
+      }
+
+      SECTION("Fields checked but the samples")
+      {
+          auto & report = validate(vcf::ValidationLevel::records, outputs);
+          CHECK(report.error_lines() == (std::vector<size_t>{6, 7, 8, 10, 11}));
+          CHECK(report.warning_lines().empty());
+      }
+
+      SECTION("Order and duplicates checked, everything else on the even lines")
+      {
+          auto & report = validate(vcf::ValidationLevel::triage, outputs, vcf::RecordSampling::every(2));
+          CHECK(report.error_lines() == (std::vector<size_t>{6, 7, 8, 10}));
+          CHECK_FALSE(report.warning_lines().empty());
+      }
+
+      SECTION("Triage of every record")
+      {
+          auto & report = validate(vcf::ValidationLevel::triage, outputs);
+          CHECK(report.error_lines() == (std::vector<size_t>{6, 7, 8, 9, 11}));
+      }
+  }
+
+  TEST_CASE("Record sampling", "[validation_level]")
+  {
+      SECTION("Every record")
+      {
+          vcf::RecordSampling sampling;
+          CHECK(sampling.selects_all());
+          CHECK(sampling.selects(7));
+          CHECK(sampling.description() == "every record");
+      }
+
+      SECTION("Periodic")
+      {
+          auto sampling = vcf::RecordSampling::every(10);
+          CHECK_FALSE(sampling.selects_all());
+          CHECK(sampling.selects(20));
+          CHECK_FALSE(sampling.selects(21));
+          CHECK(sampling.rate() == 0.1);
+          CHECK(sampling.description() == "1 of every 10 records");
+          CHECK_THROWS_AS(vcf::RecordSampling::every(0), std::invalid_argument);
+      }
+
+      SECTION("Random")
+      {
+          auto sampling = vcf::RecordSampling::random(0.25, 42);
+          size_t selected = 0;
+          for (size_t line = 0; line < 100000; ++line) {
+              selected += sampling.selects(line);
+          }
+          CHECK(selected > 24000);
+          CHECK(selected < 26000);
+
+          auto same = vcf::RecordSampling::random(0.25, 42);
+          size_t differences = 0;
+          for (size_t line = 0; line < 1000; ++line) {
+              differences += same.selects(line) != sampling.selects(line);
+          }
+          CHECK(differences == 0);
+
+          CHECK(vcf::RecordSampling::random(1).selects_all());
+          CHECK_THROWS_AS(vcf::RecordSampling::random(0), std::invalid_argument);
+          CHECK_THROWS_AS(vcf::RecordSampling::random(1.5), std::invalid_argument);
+      }
+  }
+}
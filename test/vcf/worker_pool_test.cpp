@@ -0,0 +1,60 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+#include "catch/catch.hpp"
+
+#include "util/worker_pool.hpp"
+
+namespace ebi
+{
+  TEST_CASE("Worker pool", "[worker_pool]")
+  {
+      SECTION("Every task of every batch runs once")
+      {
+          for (size_t threads : {1, 2, 8}) {
+              util::WorkerPool pool{threads};
+              CHECK(pool.size() == threads);
+
+              for (size_t tasks : {0, 1, 7, 1000}) {
+                  std::vector<size_t> runs(tasks, 0);
+                  pool.run(tasks, [&runs](size_t i) { ++runs[i]; });
+                  CHECK(std::count(runs.begin(), runs.end(), 1) == static_cast<long>(tasks));
+              }
+          }
+      }
+
+      SECTION("Exceptions are rethrown by the caller")
+      {
+          util::WorkerPool pool{4};
+          std::vector<size_t> runs(100, 0);
+          CHECK_THROWS_AS(pool.run(runs.size(), [&runs](size_t i) {
+              ++runs[i];
+              if (i == 50) {
+                  throw std::runtime_error{"task failed"};
+              }
+          }), std::runtime_error);
+
+          // the rest of the batch still runs, and the pool can be used again
+          CHECK(std::accumulate(runs.begin(), runs.end(), size_t{0}) == runs.size());
+          pool.run(runs.size(), [&runs](size_t i) { --runs[i]; });
+          CHECK(std::accumulate(runs.begin(), runs.end(), size_t{0}) == 0);
+      }
+  }
+}